@@ -16,7 +16,7 @@
 package hwdbg.communication.interpreter
 
 import chisel3._
-import chisel3.util.{switch, is}
+import chisel3.util.{switch, is, log2Ceil}
 import circt.stage.ChiselStage
 
 import hwdbg.configs._
@@ -25,7 +25,7 @@ import hwdbg.script._
 
 object InterpreterScriptBufferHandlerEnums {
   object State extends ChiselEnum {
-    val sIdle, sReadSizeOfBuffer, sReadTypeOfOperator, sReadValueOfOperator, sDone = Value
+    val sIdle, sReadSizeOfBuffer, sReadTypeOfOperator, sReadValueOfOperator, sReadPackedWord, sExtractPackedSymbol, sDone = Value
   }
 }
 
@@ -83,6 +83,25 @@ class InterpreterScriptBufferHandler(
 
   val regTargetOperator = Reg(new HwdbgShortSymbol(instanceInfo.scriptVariableLength))
 
+  //
+  // Whether the script buffer is bit-packed or each "Type" and "Value" is in a separate BRAM word
+  //
+  val bitPackedScriptBuffer =
+    HwdbgScriptCapabilities.isCapabilitySupported(instanceInfo.scriptCapabilities, HwdbgScriptCapabilities.bit_packed_script_buffer)
+
+  //
+  // Width of the fields of each symbol in the bit-packed script buffer
+  //
+  val packedTypeWidth = ScriptConstants.SYMBOL_TYPE_BIT_PACKED_WIDTH
+  val packedSymbolWidth = packedTypeWidth + instanceInfo.scriptVariableLength
+  val packedBitsWidth = packedSymbolWidth + instanceInfo.bramDataWidth
+
+  //
+  // Remaining bits of the received words (bit-packed script buffer)
+  //
+  val regPackedBits = RegInit(0.U(packedBitsWidth.W))
+  val regNumberOfPackedBits = RegInit(0.U(log2Ceil(packedBitsWidth + 1).W))
+
   //
   // Apply the chip enable signal
   //
@@ -119,7 +138,19 @@ class InterpreterScriptBufferHandler(
           //
           // Move to the configuration state
           //
-          state := sReadTypeOfOperator
+          if (bitPackedScriptBuffer) {
+
+            //
+            // No bits are remained from previous configurations
+            //
+            regPackedBits := 0.U
+            regNumberOfPackedBits := 0.U
+
+            state := sReadPackedWord
+
+          } else {
+            state := sReadTypeOfOperator
+          }
 
         }.otherwise {
 
@@ -210,6 +241,93 @@ class InterpreterScriptBufferHandler(
           state := sReadValueOfOperator
         }
       }
+      is(sReadPackedWord) {
+
+        //
+        // Not valid for configuring yet
+        //
+        configureStage := false.B
+
+        when(io.dataValidInput) {
+
+          //
+          // Append the received word after the remaining bits
+          //
+          regPackedBits := (regPackedBits | (io.receivingData << regNumberOfPackedBits))(packedBitsWidth - 1, 0)
+          regNumberOfPackedBits := regNumberOfPackedBits + instanceInfo.bramDataWidth.U
+
+          //
+          // Next, we need to extract the symbols
+          //
+          state := sExtractPackedSymbol
+
+        }.otherwise {
+
+          //
+          // Stay at the same state since the data is not received yet
+          //
+          state := sReadPackedWord
+        }
+      }
+      is(sExtractPackedSymbol) {
+
+        when(regNumberOfPackedBits >= packedSymbolWidth.U) {
+
+          //
+          // Configure the stages
+          //
+          configureStage := true.B
+
+          //
+          // Read the operator's "Type" and "Value" data (the lower bits are "Type")
+          //
+          regTargetOperator.Type := regPackedBits(packedTypeWidth - 1, 0)
+          regTargetOperator.Value := regPackedBits(packedSymbolWidth - 1, packedTypeWidth)
+
+          //
+          // Remove the symbol from the remaining bits
+          //
+          regPackedBits := regPackedBits >> packedSymbolWidth
+          regNumberOfPackedBits := regNumberOfPackedBits - packedSymbolWidth.U
+
+          //
+          // Decrement the remaining symbols
+          //
+          regScriptNumberOfSymbols := regScriptNumberOfSymbols - 1.U
+
+          //
+          // Check if reading is scripts are finished or not
+          //
+          when(regScriptNumberOfSymbols === 0.U) {
+
+            //
+            // Configurartion was done
+            //
+            state := sDone
+
+          }.otherwise {
+
+            //
+            // Extract the next symbol (if enough bits are remained)
+            //
+            state := sExtractPackedSymbol
+          }
+
+        }.otherwise {
+
+          //
+          // Not valid for configuring
+          //
+          configureStage := false.B
+
+          //
+          // The symbol is not completely received, request next data
+          //
+          readNextData := true.B
+
+          state := sReadPackedWord
+        }
+      }
       is(sDone) {
 
         //
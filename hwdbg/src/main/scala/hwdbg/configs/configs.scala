@@ -159,6 +159,11 @@ object ScriptEngineConfigurations {
     HwdbgScriptCapabilities.func_jnz,
     HwdbgScriptCapabilities.func_mov
     // HwdbgScriptCapabilities.func_printf,
+
+    //
+    // Script buffer encoding
+    //
+    // HwdbgScriptCapabilities.bit_packed_script_buffer
   )
 }
 
@@ -264,6 +269,11 @@ object HwdbgScriptCapabilities {
   val func_mov: Long = 1L << 24
   val func_printf: Long = 1L << 25
 
+  //
+  // Script buffer encoding
+  //
+  val bit_packed_script_buffer: Long = 1L << 26
+
   def allCapabilities: Seq[Long] = Seq(
     assign_local_global_var,
     assign_registers,
@@ -290,7 +300,8 @@ object HwdbgScriptCapabilities {
     func_jz,
     func_jnz,
     func_mov,
-    func_printf
+    func_printf,
+    bit_packed_script_buffer
   )
 
   //
@@ -483,6 +494,7 @@ object LoadConfiguration {
         case "func_jz" => Some(HwdbgScriptCapabilities.func_jz)
         case "func_jnz" => Some(HwdbgScriptCapabilities.func_jnz)
         case "func_mov" => Some(HwdbgScriptCapabilities.func_mov)
+        case "bit_packed_script_buffer" => Some(HwdbgScriptCapabilities.bit_packed_script_buffer)
         case _ => None
       }
 
@@ -215,3 +215,265 @@ HwdbgTestCreateTestCases()
     //
     return ReadDirectoryAndCreateHwdbgTestCases(dirPath);
 }
+
+/**
+ * @brief Read the 32-bit words of a BRAM dump (hex) file
+ * @details Lines started with ';' are comments, the first hex number of
+ * other lines is the content of the BRAM word. If PrefixOfArea is not NULL,
+ * only the words after the line that starts with it are read (and the
+ * 'mem_N:' prefix of each line is skipped)
+ *
+ * @param FilePath
+ * @param PrefixOfArea
+ * @param Words
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+HwdbgTestReadBramWords(const char * FilePath, const char * PrefixOfArea, std::vector<UINT32> & Words)
+{
+    std::ifstream File(FilePath);
+    std::string   Line;
+    BOOLEAN       IsInArea = PrefixOfArea == NULL;
+
+    if (!File.is_open())
+    {
+        return FALSE;
+    }
+
+    while (std::getline(File, Line))
+    {
+        if (!IsInArea)
+        {
+            IsInArea = Line.rfind(PrefixOfArea, 0) == 0;
+            continue;
+        }
+
+        if (Line.empty() || Line[0] == ';')
+        {
+            continue;
+        }
+
+        //
+        // Skip the 'mem_N:' prefix (if any)
+        //
+        size_t Start = Line.find(':');
+        Start        = (Line.rfind("mem_", 0) == 0 && Start != std::string::npos) ? Start + 1 : 0;
+
+        std::istringstream Iss(Line.substr(Start));
+        std::string        Token;
+
+        if (!(Iss >> Token) || Token.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+        {
+            //
+            // Not a memory line (e.g., the title of the next area)
+            //
+            if (PrefixOfArea != NULL)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        Words.push_back((UINT32)std::stoul(Token, nullptr, 16));
+    }
+
+    return !Words.empty();
+}
+
+/**
+ * @brief Pack and unpack a short symbol buffer and compare the result
+ *
+ * @param Symbols
+ * @param NumberOfSymbols
+ * @param ScriptVariableLength
+ * @param BramDataWidth
+ * @param PackedBufferSize Size of the packed buffer
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+HwdbgTestBitPackRoundTrip(const HWDBG_SHORT_SYMBOL * Symbols,
+                          UINT32                     NumberOfSymbols,
+                          UINT32                     ScriptVariableLength,
+                          UINT32                     BramDataWidth,
+                          size_t *                   PackedBufferSize)
+{
+    UINT64                          ValueMask = ScriptVariableLength == 64 ? ~0ull : (1ull << ScriptVariableLength) - 1;
+    std::vector<UINT8>              PackedBuffer(HwdbgScriptPackingComputePackedSize(NumberOfSymbols, ScriptVariableLength, BramDataWidth));
+    std::vector<HWDBG_SHORT_SYMBOL> UnpackedSymbols(NumberOfSymbols);
+
+    *PackedBufferSize = PackedBuffer.size();
+
+    if (!HwdbgScriptPackingPackSymbols(Symbols, NumberOfSymbols, ScriptVariableLength, BramDataWidth, PackedBuffer.data(), PackedBuffer.size()) ||
+        !HwdbgScriptPackingUnpackSymbols(PackedBuffer.data(), PackedBuffer.size(), ScriptVariableLength, BramDataWidth, UnpackedSymbols.data(), NumberOfSymbols))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < NumberOfSymbols; i++)
+    {
+        if (UnpackedSymbols[i].Type != Symbols[i].Type || UnpackedSymbols[i].Value != (Symbols[i].Value & ValueMask))
+        {
+            std::cout << "[-] Mismatch at symbol " << i << " (variable length: " << ScriptVariableLength
+                      << ", BRAM data width: " << BramDataWidth << ")" << std::endl;
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the bit-packed encoding of the hwdbg script buffer
+ * @details The short symbol buffers are extracted from the compiled scripts
+ * (which use one BRAM word per type and value), packed, unpacked and compared.
+ * The number of stages that fit in the debugger area of the sample instance
+ * is also reported for both of the encodings
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+HwdbgTestBitPackedScriptBuffer()
+{
+    CHAR                       TempPath[MAX_PATH]    = {0};
+    std::vector<UINT32>        InstanceInfoWords;
+    HWDBG_INSTANCE_INFORMATION InstanceInfo          = {0};
+    UINT32                     HeaderWords           = sizeof(DEBUGGER_REMOTE_PACKET) / sizeof(UINT32);
+    UINT32                     NumberOfTestedScripts = 0;
+    size_t                     PackedBufferSize      = 0;
+
+    //
+    // Read the sample instance info (debuggee to debugger area of the BRAM)
+    //
+    if (!hyperdbg_u_setup_path_for_filename(HWDBG_TEST_READ_INSTANCE_INFO_PATH, TempPath, MAX_PATH, FALSE) ||
+        !HwdbgTestReadBramWords(TempPath, "PL to PS area", InstanceInfoWords) ||
+        InstanceInfoWords.size() < HeaderWords + sizeof(HWDBG_INSTANCE_INFORMATION) / sizeof(UINT32))
+    {
+        std::cout << "[-] Could not read the sample instance info" << std::endl;
+        return FALSE;
+    }
+
+    memcpy(&InstanceInfo, &InstanceInfoWords[HeaderWords], sizeof(HWDBG_INSTANCE_INFORMATION));
+
+    UINT32 SymbolsPerStage = 1 + InstanceInfo.maximumNumberOfSupportedGetScriptOperators + InstanceInfo.maximumNumberOfSupportedSetScriptOperators;
+    UINT32 BytesPerWord    = (InstanceInfo.bramDataWidth + 7) / 8;
+
+    std::cout << "Instance: script variable length: " << InstanceInfo.scriptVariableLength
+              << " bits, BRAM data width: " << InstanceInfo.bramDataWidth
+              << " bits, symbol width (bit-packed): " << HwdbgScriptPackingGetSymbolWidth(InstanceInfo.scriptVariableLength)
+              << " bits" << std::endl;
+
+    //
+    // Round-trip the compiled scripts
+    //
+    if (!hyperdbg_u_setup_path_for_filename(HWDBG_SCRIPT_TEST_CASE_COMPILED_SCRIPTS_DIRECTORY, TempPath, MAX_PATH, FALSE))
+    {
+        std::cout << "[-] Could not find the compiled hwdbg scripts" << std::endl;
+        return FALSE;
+    }
+
+    try
+    {
+        for (const auto & Entry : fs::directory_iterator(TempPath))
+        {
+            std::vector<UINT32>             Words;
+            std::vector<HWDBG_SHORT_SYMBOL> Symbols;
+
+            if (!Entry.is_regular_file() || !HwdbgTestReadBramWords(Entry.path().string().c_str(), NULL, Words) ||
+                Words.size() <= HeaderWords)
+            {
+                continue;
+            }
+
+            //
+            // The number of symbols is sent minus one
+            //
+            UINT32 NumberOfSymbols = Words[HeaderWords] + 1;
+
+            if (Words.size() < HeaderWords + 1 + (size_t)NumberOfSymbols * 2)
+            {
+                std::cout << "[-] Invalid compiled script: " << Entry.path().filename().string() << std::endl;
+                return FALSE;
+            }
+
+            for (UINT32 i = 0; i < NumberOfSymbols; i++)
+            {
+                HWDBG_SHORT_SYMBOL Symbol = {0};
+
+                Symbol.Type  = Words[HeaderWords + 1 + (i * 2)];
+                Symbol.Value = Words[HeaderWords + 1 + (i * 2) + 1];
+
+                Symbols.push_back(Symbol);
+            }
+
+            if (!HwdbgTestBitPackRoundTrip(Symbols.data(), NumberOfSymbols, InstanceInfo.scriptVariableLength, InstanceInfo.bramDataWidth, &PackedBufferSize))
+            {
+                std::cout << "[-] Bit-packing round-trip failed: " << Entry.path().filename().string() << std::endl;
+                return FALSE;
+            }
+
+            std::cout << "[+] " << Entry.path().filename().string() << ": " << NumberOfSymbols / SymbolsPerStage
+                      << " stages, " << (size_t)NumberOfSymbols * 2 * BytesPerWord << " bytes => "
+                      << PackedBufferSize << " bytes (bit-packed)" << std::endl;
+
+            NumberOfTestedScripts++;
+        }
+    }
+    catch (const fs::filesystem_error & e)
+    {
+        std::cerr << "Filesystem error: " << e.what() << std::endl;
+        return FALSE;
+    }
+
+    if (NumberOfTestedScripts == 0)
+    {
+        std::cout << "[-] No compiled hwdbg script is found" << std::endl;
+        return FALSE;
+    }
+
+    //
+    // Round-trip random symbols with widths that cross the BRAM word boundaries
+    //
+    const UINT32 Widths[][2] = {{8, 8}, {8, 32}, {13, 24}, {31, 32}, {33, 64}, {64, 64}};
+    UINT64       Seed        = 0x9e3779b97f4a7c15ull;
+
+    for (const auto & Width : Widths)
+    {
+        std::vector<HWDBG_SHORT_SYMBOL> Symbols(97);
+
+        for (auto & Symbol : Symbols)
+        {
+            Seed         = Seed * 6364136223846793005ull + 1442695040888963407ull;
+            Symbol.Type  = (Seed >> 59) % (SYMBOL_RETURN_VALUE_TYPE + 1);
+            Symbol.Value = Seed ^ (Seed >> 17);
+        }
+
+        if (!HwdbgTestBitPackRoundTrip(Symbols.data(), (UINT32)Symbols.size(), Width[0], Width[1], &PackedBufferSize))
+        {
+            return FALSE;
+        }
+    }
+
+    //
+    // A type that does not fit should be rejected
+    //
+    HWDBG_SHORT_SYMBOL InvalidSymbol                 = {1ull << HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH, 0};
+    UINT8              InvalidBuffer[sizeof(UINT64)] = {0};
+
+    if (HwdbgScriptPackingPackSymbols(&InvalidSymbol, 1, 8, 32, InvalidBuffer, sizeof(InvalidBuffer)))
+    {
+        std::cout << "[-] A symbol type wider than the type field is accepted" << std::endl;
+        return FALSE;
+    }
+
+    //
+    // Report the number of stages that fit into the debugger area
+    //
+    std::cout << "Maximum number of stages in the debugger area: "
+              << HwdbgScriptPackingComputeMaximumNumberOfStages(&InstanceInfo, FALSE) << " (one BRAM word per field) => "
+              << HwdbgScriptPackingComputeMaximumNumberOfStages(&InstanceInfo, TRUE) << " (bit-packed)" << std::endl;
+
+    return TRUE;
+}
@@ -58,6 +58,366 @@ main(int argc, char * argv[])
             printf("\n[x] The script semantic test cases failed\n");
         }
     }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SYMBOL_SYNCHRONIZATION))
+    {
+        //
+        // # Test case 3
+        // Testing symbol table synchronization
+        //
+        if (TestSymbolSynchronization())
+        {
+            printf("\n[*] The symbol synchronization test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The symbol synchronization test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_COMMAND_PARSER_BENCHMARK))
+    {
+        //
+        // # Test case 4
+        // Benchmarking command parser
+        //
+        if (TestCommandParserBenchmark())
+        {
+            printf("\n[*] The command parser benchmark passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The command parser benchmark failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_EVENT_TRACE))
+    {
+        //
+        // # Test case 5
+        // Testing the binary event trace
+        //
+        if (TestEventTrace())
+        {
+            printf("\n[*] The event trace test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The event trace test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_STEP_TRACE))
+    {
+        //
+        // # Test case 6
+        // Testing the encoder and decoder of the step traces
+        //
+        if (TestStepTrace())
+        {
+            printf("\n[*] The step trace test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The step trace test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_BULK_READ))
+    {
+        //
+        // # Test case 7
+        // Testing the bulk memory reads and their pipeline
+        //
+        if (TestBulkRead())
+        {
+            printf("\n[*] The bulk read test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The bulk read test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_PCI_ID_INDEX))
+    {
+        //
+        // # Test case 8
+        // Testing the binary index of the PCI ID database
+        //
+        if (TestPciIdIndex())
+        {
+            printf("\n[*] The PCI ID index test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The PCI ID index test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_PCI_WALK))
+    {
+        //
+        // # Test case 9
+        // Testing the topology-aware enumeration of the PCI devices
+        //
+        if (TestPciWalk())
+        {
+            printf("\n[*] The PCI walk test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The PCI walk test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_KD_CACHE))
+    {
+        //
+        // # Test case 10
+        // Testing the cache of the halted debuggee
+        //
+        if (TestKdCache())
+        {
+            printf("\n[*] The kd cache test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The kd cache test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_TSC_OFFSET))
+    {
+        //
+        // # Test case 11
+        // Testing the TSC offsetting (hiding the time spent in vmx-root)
+        //
+        if (TestTscOffset())
+        {
+            printf("\n[*] The TSC offsetting test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The TSC offsetting test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SYSCALL_TABLE))
+    {
+        //
+        // # Test case 12
+        // Testing the resolution of the system-calls from the service table
+        //
+        if (TestSyscallTable())
+        {
+            printf("\n[*] The syscall table test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The syscall table test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SYSCALL_SITE_CACHE))
+    {
+        //
+        // # Test case 13
+        // Testing the cache of the SYSCALL and SYSRET sites (replaying traces of the #UDs)
+        //
+        if (TestSyscallSiteCache())
+        {
+            printf("\n[*] The syscall site cache test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The syscall site cache test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_EVENT_SAMPLING))
+    {
+        //
+        // # Test case 14
+        // Testing the sampling policies of the events
+        //
+        if (TestEventSampling())
+        {
+            printf("\n[*] The event sampling test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The event sampling test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SCRIPT_FILTER))
+    {
+        //
+        // # Test case 15
+        // Testing the fast-path filters of the scripts
+        //
+        if (TestScriptFilter())
+        {
+            printf("\n[*] The script filter test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The script filter test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SUB_PAGE_PERMISSION))
+    {
+        //
+        // # Test case 16
+        // Testing the tables of the sub-page write permissions (SPP)
+        //
+        if (TestSubPagePermission())
+        {
+            printf("\n[*] The sub-page permission test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The sub-page permission test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_MEMORY_ACCESS_EMULATOR))
+    {
+        //
+        // # Test case 17
+        // Testing the emulator of the trapped memory accesses (EPT hooks)
+        //
+        if (TestMemoryAccessEmulator())
+        {
+            printf("\n[*] The memory access emulator test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The memory access emulator test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_EPTP_VIEW))
+    {
+        //
+        // # Test case 18
+        // Testing the EPTP list and the views of the hidden hooks
+        //
+        if (TestEptpView())
+        {
+            printf("\n[*] The EPTP view test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The EPTP view test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SHARED_EPT))
+    {
+        //
+        // # Test case 19
+        // Testing the shared EPT hierarchy and the private regions of the cores
+        //
+        if (TestSharedEpt())
+        {
+            printf("\n[*] The shared EPT test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The shared EPT test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_MTRR_MAP))
+    {
+        //
+        // # Test case 20
+        // Testing the MTRR map and the 1GB pages of the EPT
+        //
+        if (TestMtrrMap())
+        {
+            printf("\n[*] The MTRR map test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The MTRR map test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_HOOK_BATCH))
+    {
+        //
+        // # Test case 21
+        // Testing the batches of EPT hooks
+        //
+        if (TestHookBatch())
+        {
+            printf("\n[*] The batches of EPT hooks test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The batches of EPT hooks test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_DETOUR_HASH))
+    {
+        //
+        // # Test case 22
+        // Testing the hash of the detours of the inline EPT hooks
+        //
+        if (TestDetourHash())
+        {
+            printf("\n[*] The detour hash test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The detour hash test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_SAMPLE_PROFILE))
+    {
+        //
+        // # Test case 23
+        // Testing the histograms of the sampling profiler
+        //
+        if (TestSampleProfile())
+        {
+            printf("\n[*] The sample profile test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The sample profile test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_PT_DECODE))
+    {
+        //
+        // # Test case 24
+        // Testing the decoder of Intel Processor Trace
+        //
+        if (TestPtDecode())
+        {
+            printf("\n[*] The processor trace decoder test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The processor trace decoder test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_LBR_DECODE))
+    {
+        //
+        // # Test case 25
+        // Testing the decoder of the Last Branch Records
+        //
+        if (TestLbrDecode())
+        {
+            printf("\n[*] The last branch records decoder test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The last branch records decoder test cases failed\n");
+        }
+    }
+    else if (!strcmp(argv[1], TEST_CASE_PARAMETER_FOR_TYPE_LAYOUT))
+    {
+        //
+        // # Test case 26
+        // Testing the precompiled layouts of the structures
+        //
+        if (TestTypeLayout())
+        {
+            printf("\n[*] The type-layout test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The type-layout test cases failed\n");
+        }
+    }
     else if (!strcmp(argv[1], TEST_HWDBG_FUNCTIONALITIES))
     {
         //
@@ -72,6 +432,20 @@ main(int argc, char * argv[])
             printf("\n[x] The hwdbg test cases failed\n");
         }
     }
+    else if (!strcmp(argv[1], TEST_HWDBG_BIT_PACKED_SCRIPT_BUFFER))
+    {
+        //
+        // # Test hwdbg bit-packed script buffer
+        //
+        if (HwdbgTestBitPackedScriptBuffer())
+        {
+            printf("\n[*] The hwdbg bit-packed script buffer test cases passed successfully\n");
+        }
+        else
+        {
+            printf("\n[x] The hwdbg bit-packed script buffer test cases failed\n");
+        }
+    }
     else
     {
         printf("unknown test case\n");
@@ -0,0 +1,438 @@
+/**
+ * @file test-bulk-read.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the bulk (multi-page) memory reads and their pipeline
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Start address of the simulated range (not page aligned)
+ *
+ */
+#define TEST_BULK_READ_ADDRESS 0xffffc00012340800ull
+
+/**
+ * @brief Size of the simulated range (not page aligned)
+ *
+ */
+#define TEST_BULK_READ_SIZE ((16 * 1024 * 1024) + 0x123)
+
+/**
+ * @brief Simulated latency of each request (the round-trip to the debuggee)
+ *
+ */
+#define TEST_BULK_READ_LATENCY_IN_MICROSECONDS 100
+
+/**
+ * @brief Each page whose page number is a multiple of this value is not available
+ *
+ */
+#define TEST_BULK_READ_INVALID_PAGES_INTERVAL 37
+
+/**
+ * @brief Maximum number of requests in flight in the tests
+ *
+ */
+#define TEST_BULK_READ_MAXIMUM_SLOTS 8
+
+/**
+ * @brief The simulated debuggee and the receiver of the read memory
+ *
+ */
+typedef struct _TEST_BULK_READ_BACKEND
+{
+    const UINT8 *        Memory; // The simulated memory of the range
+    BOOLEAN              IsAsync;
+    UINT64               FailingAddress; // The request that contains this address fails
+    UINT64               NumberOfSubmits;
+    UINT64               NumberOfCompletes;
+    std::future<BOOLEAN> Results[TEST_BULK_READ_MAXIMUM_SLOTS];
+    std::vector<UINT8>   Output;
+
+} TEST_BULK_READ_BACKEND, *PTEST_BULK_READ_BACKEND;
+
+/**
+ * @brief Check whether a page of the simulated memory is available
+ *
+ * @param Address
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestBulkReadIsAddressValid(UINT64 Address)
+{
+    return ((Address / NORMAL_PAGE_SIZE) % TEST_BULK_READ_INVALID_PAGES_INTERVAL) != 0;
+}
+
+/**
+ * @brief Serve a bulk read request the way the debuggee does
+ *
+ * @param Backend
+ * @param Request
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestBulkReadServeRequest(PTEST_BULK_READ_BACKEND Backend, PDEBUGGER_BULK_READ_MEMORY Request)
+{
+    UINT8 * Buffer   = (UINT8 *)Request + SIZEOF_DEBUGGER_BULK_READ_MEMORY;
+    auto    Deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(TEST_BULK_READ_LATENCY_IN_MICROSECONDS);
+    UINT64  PageAddress;
+    UINT32  PageSize;
+    UINT32  Offset;
+
+    //
+    // Simulate the round-trip, the core is free for the other requests in
+    // the meantime (sleeping is not precise enough)
+    //
+    while (std::chrono::steady_clock::now() < Deadline)
+    {
+        std::this_thread::yield();
+    }
+
+    if (!BulkReadIsRequestValid(Request, DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES) ||
+        (Backend->FailingAddress >= Request->Address && Backend->FailingAddress - Request->Address < Request->Size))
+    {
+        Request->KernelStatus = DEBUGGER_ERROR_READING_MEMORY_INVALID_PARAMETER;
+        return TRUE;
+    }
+
+    for (UINT32 i = 0; BulkReadGetPage(Request, i, &PageAddress, &PageSize, &Offset); i++)
+    {
+        if (TestBulkReadIsAddressValid(PageAddress))
+        {
+            memcpy(&Buffer[Offset], &Backend->Memory[PageAddress - TEST_BULK_READ_ADDRESS], PageSize);
+            BulkReadSetPageValid(Request, i);
+        }
+        else
+        {
+            //
+            // Garbage, the pipeline should zero it
+            //
+            memset(&Buffer[Offset], 0xcc, PageSize);
+        }
+    }
+
+    Request->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+    return TRUE;
+}
+
+/**
+ * @brief Submit callback of the simulated pipeline
+ *
+ * @param Slot
+ * @param Request
+ * @param RequestBufferSize
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestBulkReadSubmit(UINT32 Slot, PDEBUGGER_BULK_READ_MEMORY Request, UINT32 RequestBufferSize, PVOID Context)
+{
+    PTEST_BULK_READ_BACKEND Backend = (PTEST_BULK_READ_BACKEND)Context;
+
+    if (RequestBufferSize != SIZEOF_DEBUGGER_BULK_READ_MEMORY + Request->Size)
+    {
+        return FALSE;
+    }
+
+    Backend->NumberOfSubmits++;
+    Backend->Results[Slot] = std::async(Backend->IsAsync ? std::launch::async : std::launch::deferred,
+                                        TestBulkReadServeRequest,
+                                        Backend,
+                                        Request);
+
+    return TRUE;
+}
+
+/**
+ * @brief Complete callback of the simulated pipeline
+ *
+ * @param Slot
+ * @param Request
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestBulkReadComplete(UINT32 Slot, PDEBUGGER_BULK_READ_MEMORY Request, PVOID Context)
+{
+    PTEST_BULK_READ_BACKEND Backend = (PTEST_BULK_READ_BACKEND)Context;
+
+    UNREFERENCED_PARAMETER(Request);
+
+    Backend->NumberOfCompletes++;
+
+    return Backend->Results[Slot].get();
+}
+
+/**
+ * @brief Write callback of the simulated pipeline
+ *
+ * @param Buffer
+ * @param Length
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestBulkReadWrite(const VOID * Buffer, UINT32 Length, PVOID Context)
+{
+    PTEST_BULK_READ_BACKEND Backend = (PTEST_BULK_READ_BACKEND)Context;
+
+    Backend->Output.insert(Backend->Output.end(), (const UINT8 *)Buffer, (const UINT8 *)Buffer + Length);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the simulated range with a pipeline
+ *
+ * @param Name
+ * @param PagesPerRequest
+ * @param NumberOfSlots
+ * @param FailingAddress
+ * @param Memory The simulated memory of the range
+ * @param Expected The expected image of the range
+ * @param ExpectedInvalidPages
+ * @param Time Elapsed time in milliseconds
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestBulkReadRunPipeline(const CHAR *               Name,
+                        UINT32                     PagesPerRequest,
+                        UINT32                     NumberOfSlots,
+                        UINT64                     FailingAddress,
+                        const std::vector<UINT8> & Memory,
+                        const std::vector<UINT8> & Expected,
+                        UINT64                     ExpectedInvalidPages,
+                        double *                   Time)
+{
+    BULK_READ_PIPELINE         Pipeline                            = {0};
+    TEST_BULK_READ_BACKEND     Backend                             = {};
+    PDEBUGGER_BULK_READ_MEMORY Slots[TEST_BULK_READ_MAXIMUM_SLOTS] = {0};
+    BOOLEAN                    IsFailureExpected                   = FailingAddress != 0;
+    BOOLEAN                    Result                              = TRUE;
+    BOOLEAN                    IsRead;
+    UINT64                     FirstPage;
+    UINT64                     RequestSpan;
+    UINT64                     WrittenSize;
+
+    Backend.Memory         = Memory.data();
+    Backend.IsAsync        = NumberOfSlots > 1;
+    Backend.FailingAddress = FailingAddress;
+    Backend.Output.reserve(Expected.size());
+
+    for (UINT32 i = 0; i < NumberOfSlots; i++)
+    {
+        Slots[i] = (PDEBUGGER_BULK_READ_MEMORY)malloc(SIZEOF_DEBUGGER_BULK_READ_MEMORY + (PagesPerRequest * NORMAL_PAGE_SIZE));
+    }
+
+    Pipeline.Address         = TEST_BULK_READ_ADDRESS;
+    Pipeline.Size            = TEST_BULK_READ_SIZE;
+    Pipeline.Pid             = 4;
+    Pipeline.MemoryType      = DEBUGGER_READ_VIRTUAL_ADDRESS;
+    Pipeline.PagesPerRequest = PagesPerRequest;
+    Pipeline.NumberOfSlots   = NumberOfSlots;
+    Pipeline.Slots           = Slots;
+    Pipeline.Submit          = TestBulkReadSubmit;
+    Pipeline.Complete        = TestBulkReadComplete;
+    Pipeline.Write           = TestBulkReadWrite;
+    Pipeline.Context         = &Backend;
+
+    auto Start = std::chrono::high_resolution_clock::now();
+
+    IsRead = BulkReadPipelineRun(&Pipeline);
+
+    *Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+    //
+    // All the requests in flight should be completed (even after a failure)
+    //
+    if (Backend.NumberOfSubmits != Backend.NumberOfCompletes)
+    {
+        printf("[-] %s : %llu request(s) are not completed\n", Name, Backend.NumberOfSubmits - Backend.NumberOfCompletes);
+        Result = FALSE;
+    }
+
+    if (IsFailureExpected)
+    {
+        //
+        // Only the requests before the failed request should be written
+        //
+        FirstPage   = TEST_BULK_READ_ADDRESS - (TEST_BULK_READ_ADDRESS % NORMAL_PAGE_SIZE);
+        RequestSpan = (UINT64)PagesPerRequest * NORMAL_PAGE_SIZE;
+        WrittenSize = FirstPage + (((FailingAddress - FirstPage) / RequestSpan) * RequestSpan) - TEST_BULK_READ_ADDRESS;
+
+        if (IsRead || Pipeline.KernelStatus != DEBUGGER_ERROR_READING_MEMORY_INVALID_PARAMETER ||
+            Backend.Output.size() != WrittenSize ||
+            memcmp(Backend.Output.data(), Expected.data(), WrittenSize) != 0)
+        {
+            printf("[-] %s : the failed request is not detected\n", Name);
+            Result = FALSE;
+        }
+    }
+    else if (!IsRead || Backend.Output != Expected || Pipeline.NumberOfInvalidPages != ExpectedInvalidPages)
+    {
+        printf("[-] %s : the read memory doesn't match the simulated memory\n", Name);
+        Result = FALSE;
+    }
+    else
+    {
+        printf("[*] %s : %llu request(s), %llu invalid page(s), %.1f ms, %.1f MB/s\n",
+               Name,
+               Pipeline.NumberOfRequests,
+               Pipeline.NumberOfInvalidPages,
+               *Time,
+               *Time == 0 ? 0.0 : ((double)TEST_BULK_READ_SIZE / (1024 * 1024)) / (*Time / 1000));
+    }
+
+    for (UINT32 i = 0; i < NumberOfSlots; i++)
+    {
+        free(Slots[i]);
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Test the bulk (multi-page) memory reads and their pipeline
+ * @details Reads a simulated range of the debuggee (with unavailable pages)
+ * one page per request (the previous way of '.dump') and with bulk requests
+ * with a different number of requests in flight, and checks the validation
+ * of the ranges and the handling of the failed requests
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestBulkRead()
+{
+    BOOLEAN                   OverallResult        = TRUE;
+    UINT64                    ExpectedInvalidPages = 0;
+    double                    PageByPageTime       = 0;
+    double                    Time                 = 0;
+    DEBUGGER_BULK_READ_MEMORY Request              = {0};
+    UINT64                    RandomState          = 0x9E3779B97F4A7C15ull;
+    std::vector<UINT8>        Memory(TEST_BULK_READ_SIZE);
+    std::vector<UINT8>        Expected(TEST_BULK_READ_SIZE);
+    UINT64                    PageAddress;
+    UINT32                    PageSize;
+    UINT32                    Offset;
+
+    //
+    // Build the simulated memory and the expected image of the range (the
+    // pages that are not available are zeroed)
+    //
+    for (UINT64 i = 0; i < TEST_BULK_READ_SIZE; i++)
+    {
+        UINT64 Address = TEST_BULK_READ_ADDRESS + i;
+
+        RandomState ^= RandomState << 13;
+        RandomState ^= RandomState >> 7;
+        RandomState ^= RandomState << 17;
+
+        Memory[i]   = (UINT8)RandomState;
+        Expected[i] = TestBulkReadIsAddressValid(Address) ? Memory[i] : 0;
+
+        if (!TestBulkReadIsAddressValid(Address) && (i == 0 || Address % NORMAL_PAGE_SIZE == 0))
+        {
+            ExpectedInvalidPages++;
+        }
+    }
+
+    //
+    // Check the ranges of the requests
+    //
+    BulkReadInitializeRequest(&Request, 0x1ff0, 0x20, 0, DEBUGGER_READ_PHYSICAL_ADDRESS);
+
+    if (!BulkReadIsRequestValid(&Request, 2) || BulkReadIsRequestValid(&Request, 1) ||
+        !BulkReadGetPage(&Request, 1, &PageAddress, &PageSize, &Offset) ||
+        PageAddress != 0x2000 || PageSize != 0x10 || Offset != 0x10 ||
+        BulkReadGetPage(&Request, 2, &PageAddress, &PageSize, &Offset))
+    {
+        printf("[-] the pages of a request are not computed correctly\n");
+        OverallResult = FALSE;
+    }
+
+    BulkReadInitializeRequest(&Request, 0xfffffffffffff000, NORMAL_PAGE_SIZE, 0, DEBUGGER_READ_VIRTUAL_ADDRESS);
+
+    if (!BulkReadIsRequestValid(&Request, 1))
+    {
+        printf("[-] the last page of the address space is not accepted\n");
+        OverallResult = FALSE;
+    }
+
+    Request.Size++;
+
+    if (BulkReadIsRequestValid(&Request, DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES))
+    {
+        printf("[-] the wrapping range is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    if (BulkReadGetRequestSize(0x1800, MAXUINT64, 4) != 0x3800 || BulkReadGetRequestSize(0x1800, 0x100, 4) != 0x100)
+    {
+        printf("[-] the size of the next request is not computed correctly\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // One page per request, one request at a time (the previous way of '.dump')
+    //
+    if (!TestBulkReadRunPipeline("page by page    ", 1, 1, 0, Memory, Expected, ExpectedInvalidPages, &PageByPageTime))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Debugger Mode (one request at a time)
+    //
+    if (!TestBulkReadRunPipeline("16 pages x 1    ", DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES_OVER_SERIAL, 1, 0, Memory, Expected, ExpectedInvalidPages, &Time))
+    {
+        OverallResult = FALSE;
+    }
+
+    if (!TestBulkReadRunPipeline("64 pages x 1    ", DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES, 1, 0, Memory, Expected, ExpectedInvalidPages, &Time))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // VMI Mode (a few requests in flight)
+    //
+    if (!TestBulkReadRunPipeline("64 pages x 4    ", DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES, 4, 0, Memory, Expected, ExpectedInvalidPages, &Time))
+    {
+        OverallResult = FALSE;
+    }
+    else
+    {
+        printf("[*] bulk reads with 4 requests in flight are %.1fx faster than reading page by page\n",
+               Time == 0 ? 0.0 : PageByPageTime / Time);
+    }
+
+    //
+    // A failed request stops the pipeline after the requests in flight
+    //
+    if (!TestBulkReadRunPipeline("failed request  ",
+                                 DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES,
+                                 TEST_BULK_READ_MAXIMUM_SLOTS,
+                                 TEST_BULK_READ_ADDRESS + (TEST_BULK_READ_SIZE / 2),
+                                 Memory,
+                                 Expected,
+                                 ExpectedInvalidPages,
+                                 &Time))
+    {
+        OverallResult = FALSE;
+    }
+
+    return OverallResult;
+}
@@ -0,0 +1,466 @@
+/**
+ * @file test-detour-hash.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the hash of the detours of the inline EPT hooks
+ * @details The return addresses of 1k to 100k detours are found by walking
+ * a list (the same way as the handler of the detours used to walk the list
+ * of the detours) and by the hash, then the results and the time of both
+ * of the methods are compared, and the records that a reader finds while
+ * another thread changes them are checked
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The simulated detours
+ *
+ */
+#define TEST_DETOUR_HASH_FUNCTIONS_BASE      0xfffff80000000000ull
+#define TEST_DETOUR_HASH_LIST_LOOKUPS        20000000 // Count of the visited nodes of the list for each count of the detours
+#define TEST_DETOUR_HASH_HASH_LOOKUPS        1000000
+#define TEST_DETOUR_HASH_CONCURRENT_DETOURS  64
+#define TEST_DETOUR_HASH_CONCURRENT_UPDATES  200000
+#define TEST_DETOUR_HASH_SMALL_CAPACITY      16
+
+/**
+ * @brief A node of the list of the detours (HIDDEN_HOOKS_DETOUR_DETAILS)
+ *
+ */
+typedef struct _TEST_DETOUR_HASH_NODE
+{
+    struct _TEST_DETOUR_HASH_NODE * Next;
+    UINT64                          HookedFunctionAddress;
+    UINT64                          ReturnAddress;
+
+} TEST_DETOUR_HASH_NODE, *PTEST_DETOUR_HASH_NODE;
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestDetourHashRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief The precomputed record of a hooked function
+ *
+ * @param HookedFunctionAddress
+ * @param Generation Count of the times that the record is changed
+ *
+ * @return DETOUR_HASH_RECORD
+ */
+static DETOUR_HASH_RECORD
+TestDetourHashMakeRecord(UINT64 HookedFunctionAddress, UINT64 Generation)
+{
+    DETOUR_HASH_RECORD Record;
+
+    Record.ReturnAddress   = HookedFunctionAddress + 0x100000000ull + Generation * 0x100;
+    Record.PhysicalAddress = Record.ReturnAddress ^ 0xfffff00000000000ull;
+    Record.HookingTag      = ~Record.ReturnAddress;
+
+    return Record;
+}
+
+/**
+ * @brief Check whether the fields of a record belong to the same change
+ *
+ * @param HookedFunctionAddress
+ * @param Record
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestDetourHashIsConsistent(UINT64 HookedFunctionAddress, const DETOUR_HASH_RECORD * Record)
+{
+    UINT64 Generation = (Record->ReturnAddress - HookedFunctionAddress - 0x100000000ull) / 0x100;
+
+    DETOUR_HASH_RECORD Expected = TestDetourHashMakeRecord(HookedFunctionAddress, Generation);
+
+    return Expected.ReturnAddress == Record->ReturnAddress && Expected.PhysicalAddress == Record->PhysicalAddress &&
+           Expected.HookingTag == Record->HookingTag;
+}
+
+/**
+ * @brief Find the return address by walking the list (the legacy method)
+ *
+ * @param Head
+ * @param HookedFunctionAddress
+ *
+ * @return UINT64
+ */
+static UINT64
+TestDetourHashListLookup(PTEST_DETOUR_HASH_NODE Head, UINT64 HookedFunctionAddress)
+{
+    for (PTEST_DETOUR_HASH_NODE Node = Head; Node != NULL; Node = Node->Next)
+    {
+        if (Node->HookedFunctionAddress == HookedFunctionAddress)
+        {
+            return Node->ReturnAddress;
+        }
+    }
+
+    return HookedFunctionAddress;
+}
+
+/**
+ * @brief Compare the methods for a count of the detours
+ *
+ * @param NumberOfDetours
+ * @param Seed
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestDetourHashCompareMethods(UINT32 NumberOfDetours, UINT64 * Seed)
+{
+    vector<UINT64>                   Addresses;
+    vector<PTEST_DETOUR_HASH_NODE>   Nodes;
+    vector<DETOUR_HASH_ENTRY>        Entries;
+    set<UINT64>                      UniqueAddresses;
+    DETOUR_HASH                      Hash;
+    DETOUR_HASH_RECORD               Record;
+    chrono::steady_clock::time_point Start;
+    PTEST_DETOUR_HASH_NODE           Head     = NULL;
+    UINT32                           Capacity = 1;
+    UINT32                           ListLookups;
+    double                           ListTime;
+    double                           HashTime;
+    UINT64                           Checksum = 0;
+    UINT64                           Other    = 0;
+    BOOLEAN                          Result   = FALSE;
+
+    //
+    // The hooked functions are 16-byte aligned functions of the kernel
+    //
+    while (UniqueAddresses.size() < NumberOfDetours)
+    {
+        UINT64 Address = TEST_DETOUR_HASH_FUNCTIONS_BASE + (TestDetourHashRandom(Seed) % 0x4000000) * 0x10;
+
+        if (UniqueAddresses.insert(Address).second)
+        {
+            Addresses.push_back(Address);
+        }
+    }
+
+    //
+    // Keep the load factor of the hash under a half
+    //
+    while (Capacity < NumberOfDetours * 2)
+    {
+        Capacity <<= 1;
+    }
+
+    Entries.resize(Capacity);
+
+    if (!DetourHashInitialize(&Hash, Entries.data(), Capacity))
+    {
+        printf("[-] the hash is not initialized\n");
+        return FALSE;
+    }
+
+    for (auto Address : Addresses)
+    {
+        PTEST_DETOUR_HASH_NODE Node = new TEST_DETOUR_HASH_NODE;
+
+        Record = TestDetourHashMakeRecord(Address, 0);
+
+        Node->HookedFunctionAddress = Address;
+        Node->ReturnAddress         = Record.ReturnAddress;
+        Node->Next                  = Head;
+        Head                        = Node;
+
+        Nodes.push_back(Node);
+
+        if (!DetourHashInsert(&Hash, Address, &Record))
+        {
+            printf("[-] the detour of 0x%llx is not added\n", Address);
+            goto Cleanup;
+        }
+    }
+
+    //
+    // Both methods should find the same return addresses
+    //
+    for (auto Address : Addresses)
+    {
+        if (!DetourHashLookup(&Hash, Address, &Record) || Record.ReturnAddress != TestDetourHashListLookup(Head, Address) ||
+            !TestDetourHashIsConsistent(Address, &Record))
+        {
+            printf("[-] the detour of 0x%llx is not found\n", Address);
+            goto Cleanup;
+        }
+    }
+
+    //
+    // Measure the calls to random hooked functions
+    //
+    ListLookups = TEST_DETOUR_HASH_LIST_LOOKUPS / NumberOfDetours;
+
+    Start = chrono::steady_clock::now();
+
+    for (UINT32 i = 0; i < ListLookups; i++)
+    {
+        Checksum += TestDetourHashListLookup(Head, Addresses[TestDetourHashRandom(Seed) % NumberOfDetours]);
+    }
+
+    ListTime = chrono::duration<double, nano>(chrono::steady_clock::now() - Start).count() / ListLookups;
+
+    Start = chrono::steady_clock::now();
+
+    for (UINT32 i = 0; i < TEST_DETOUR_HASH_HASH_LOOKUPS; i++)
+    {
+        DetourHashLookup(&Hash, Addresses[TestDetourHashRandom(Seed) % NumberOfDetours], &Record);
+        Other += Record.ReturnAddress;
+    }
+
+    HashTime = chrono::duration<double, nano>(chrono::steady_clock::now() - Start).count() / TEST_DETOUR_HASH_HASH_LOOKUPS;
+
+    printf("[*] %6u detours (capacity 0x%05x) : list %10.1f ns per call, hash %5.1f ns per call (checksum 0x%llx)\n",
+           NumberOfDetours,
+           Capacity,
+           ListTime,
+           HashTime,
+           Checksum ^ Other);
+
+    //
+    // Remove half of the detours, the removed ones are not found and the
+    // probes of the others still reach them
+    //
+    for (UINT32 i = 0; i < NumberOfDetours; i += 2)
+    {
+        if (!DetourHashRemove(&Hash, Addresses[i]) || DetourHashRemove(&Hash, Addresses[i]))
+        {
+            printf("[-] the detour of 0x%llx is not removed\n", Addresses[i]);
+            goto Cleanup;
+        }
+    }
+
+    for (UINT32 i = 0; i < NumberOfDetours; i++)
+    {
+        if (DetourHashLookup(&Hash, Addresses[i], &Record) != (i % 2 == 1))
+        {
+            printf("[-] the detour of 0x%llx is %s\n", Addresses[i], i % 2 ? "not found" : "found after its removal");
+            goto Cleanup;
+        }
+    }
+
+    //
+    // Add them again with the new records
+    //
+    for (UINT32 i = 0; i < NumberOfDetours; i += 2)
+    {
+        Record = TestDetourHashMakeRecord(Addresses[i], 1);
+
+        if (!DetourHashInsert(&Hash, Addresses[i], &Record))
+        {
+            printf("[-] the detour of 0x%llx is not added again\n", Addresses[i]);
+            goto Cleanup;
+        }
+    }
+
+    for (UINT32 i = 0; i < NumberOfDetours; i++)
+    {
+        if (!DetourHashLookup(&Hash, Addresses[i], &Record) ||
+            Record.ReturnAddress != TestDetourHashMakeRecord(Addresses[i], i % 2 ? 0 : 1).ReturnAddress)
+        {
+            printf("[-] the detour of 0x%llx is not found after adding it again\n", Addresses[i]);
+            goto Cleanup;
+        }
+    }
+
+    //
+    // Remove all of them, all of the entries are emptied
+    //
+    for (auto Address : Addresses)
+    {
+        DetourHashRemove(&Hash, Address);
+    }
+
+    for (auto & Entry : Entries)
+    {
+        if (Entry.HookedFunctionAddress != DETOUR_HASH_EMPTY_KEY)
+        {
+            printf("[-] the entries are not emptied\n");
+            goto Cleanup;
+        }
+    }
+
+    Result = TRUE;
+
+Cleanup:
+    for (auto Node : Nodes)
+    {
+        delete Node;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Test a full hash
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestDetourHashFull()
+{
+    DETOUR_HASH_ENTRY  Entries[TEST_DETOUR_HASH_SMALL_CAPACITY] = {0};
+    DETOUR_HASH        Hash;
+    DETOUR_HASH_RECORD Record;
+
+    if (DetourHashInitialize(&Hash, Entries, TEST_DETOUR_HASH_SMALL_CAPACITY - 1) ||
+        !DetourHashInitialize(&Hash, Entries, TEST_DETOUR_HASH_SMALL_CAPACITY))
+    {
+        printf("[-] the capacity is not checked\n");
+        return FALSE;
+    }
+
+    for (UINT64 i = 0; i <= TEST_DETOUR_HASH_SMALL_CAPACITY; i++)
+    {
+        UINT64 Address = TEST_DETOUR_HASH_FUNCTIONS_BASE + i * 0x10;
+
+        Record = TestDetourHashMakeRecord(Address, 0);
+
+        if (DetourHashInsert(&Hash, Address, &Record) != (i < TEST_DETOUR_HASH_SMALL_CAPACITY))
+        {
+            printf("[-] the hash is not full after 0x%x detours\n", TEST_DETOUR_HASH_SMALL_CAPACITY);
+            return FALSE;
+        }
+    }
+
+    //
+    // A missing address is not found in a full hash, and an existing one is updated
+    //
+    Record = TestDetourHashMakeRecord(TEST_DETOUR_HASH_FUNCTIONS_BASE, 1);
+
+    if (DetourHashLookup(&Hash, TEST_DETOUR_HASH_FUNCTIONS_BASE + 8, &Record) ||
+        !DetourHashInsert(&Hash, TEST_DETOUR_HASH_FUNCTIONS_BASE, &Record) ||
+        !DetourHashLookup(&Hash, TEST_DETOUR_HASH_FUNCTIONS_BASE, &Record) ||
+        Record.ReturnAddress != TestDetourHashMakeRecord(TEST_DETOUR_HASH_FUNCTIONS_BASE, 1).ReturnAddress)
+    {
+        printf("[-] the full hash is not valid\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the readers while another thread changes the records
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestDetourHashConcurrent()
+{
+    static DETOUR_HASH_ENTRY Entries[TEST_DETOUR_HASH_CONCURRENT_DETOURS * 2];
+    DETOUR_HASH              Hash;
+    DETOUR_HASH_RECORD       Record;
+    volatile BOOLEAN         Finished     = FALSE;
+    UINT64                   Hits         = 0;
+    UINT64                   Misses       = 0;
+    UINT64                   Inconsistent = 0;
+
+    DetourHashInitialize(&Hash, Entries, TEST_DETOUR_HASH_CONCURRENT_DETOURS * 2);
+
+    for (UINT64 i = 0; i < TEST_DETOUR_HASH_CONCURRENT_DETOURS; i++)
+    {
+        Record = TestDetourHashMakeRecord(TEST_DETOUR_HASH_FUNCTIONS_BASE + i * 0x10, 0);
+
+        DetourHashInsert(&Hash, TEST_DETOUR_HASH_FUNCTIONS_BASE + i * 0x10, &Record);
+    }
+
+    //
+    // The writer updates, removes and adds the detours again
+    //
+    thread Writer([&]() {
+        UINT64 Seed = 0x57524954;
+
+        for (UINT64 Generation = 1; Generation <= TEST_DETOUR_HASH_CONCURRENT_UPDATES; Generation++)
+        {
+            UINT64             Address   = TEST_DETOUR_HASH_FUNCTIONS_BASE + (TestDetourHashRandom(&Seed) % TEST_DETOUR_HASH_CONCURRENT_DETOURS) * 0x10;
+            DETOUR_HASH_RECORD NewRecord = TestDetourHashMakeRecord(Address, Generation);
+
+            if (Generation % 16 == 0)
+            {
+                DetourHashRemove(&Hash, Address);
+            }
+
+            DetourHashInsert(&Hash, Address, &NewRecord);
+        }
+
+        Finished = TRUE;
+    });
+
+    UINT64 Seed = 0x52454144;
+
+    while (!Finished)
+    {
+        UINT64             Address = TEST_DETOUR_HASH_FUNCTIONS_BASE + (TestDetourHashRandom(&Seed) % TEST_DETOUR_HASH_CONCURRENT_DETOURS) * 0x10;
+        DETOUR_HASH_RECORD Found;
+
+        if (!DetourHashLookup(&Hash, Address, &Found))
+        {
+            Misses++;
+            continue;
+        }
+
+        Hits++;
+
+        if (!TestDetourHashIsConsistent(Address, &Found))
+        {
+            Inconsistent++;
+        }
+    }
+
+    Writer.join();
+
+    printf("[*] concurrent readers : %llu hits, %llu misses (the list is used), %llu inconsistent records\n", Hits, Misses, Inconsistent);
+
+    if (Inconsistent != 0)
+    {
+        printf("[-] the readers found inconsistent records\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the hash of the detours
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestDetourHash()
+{
+    UINT64 Seed           = 0x44455452;
+    UINT32 DetourCounts[] = {1000, 10000, 100000};
+
+    for (auto NumberOfDetours : DetourCounts)
+    {
+        if (!TestDetourHashCompareMethods(NumberOfDetours, &Seed))
+        {
+            return FALSE;
+        }
+    }
+
+    if (!TestDetourHashFull())
+    {
+        return FALSE;
+    }
+
+    return TestDetourHashConcurrent();
+}
@@ -0,0 +1,687 @@
+/**
+ * @file test-eptp-view.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the EPTP list and the views of the hidden hooks
+ * @details A simulated EPT (the same layout as the identity tables of the
+ * cores) is hooked, then the read view is built as an overlay of it and
+ * both of the views are walked the same way as the processor; at last the
+ * traces of the instructions are replayed on the views to count the exits
+ * of the views and the exits of the MTF restore of the hooked entries
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The simulated memory
+ *
+ */
+#define TEST_EPTP_VIEW_NUMBER_OF_GB       4ull
+#define TEST_EPTP_VIEW_NUMBER_OF_HOOKS    48
+#define TEST_EPTP_VIEW_MAXIMUM_TABLES     64
+#define TEST_EPTP_VIEW_OVERLAY_BASE       0x100000000000ull // Physical address of the tables of the overlay
+#define TEST_EPTP_VIEW_FAKE_PAGES_BASE    0x200000000000ull // Physical address of the fake pages of the hooks
+#define TEST_EPTP_VIEW_MEMORY_TYPE_WB     (6ull << 3)
+#define TEST_EPTP_VIEW_EPTP_FLAGS         0x5e // Write-back, page-walk length of 4 and accessed and dirty flags
+#define TEST_EPTP_VIEW_NUMBER_OF_ACCESSES 100000
+
+/**
+ * @brief The simulated EPT and the tables of the overlay
+ *
+ */
+typedef struct _TEST_EPTP_VIEW_MEMORY
+{
+    vector<vector<UINT64>> Tables; // The physical address of the table i is (i + 1) * EPTP_VIEW_PAGE_SIZE
+    vector<UINT64>         OverlayTables;
+    UINT64                 RootPhysicalAddress;
+    map<UINT64, UINT64>    OriginalEntries; // The hooked pages and their original entries
+    map<UINT64, UINT64>    FakePages;       // The hooked pages and their fake pages
+
+} TEST_EPTP_VIEW_MEMORY, *PTEST_EPTP_VIEW_MEMORY;
+
+/**
+ * @brief An instruction of a trace
+ *
+ */
+typedef struct _TEST_EPTP_VIEW_INSTRUCTION
+{
+    UINT64  Rip;
+    BOOLEAN HasDataAccess;
+    UINT64  DataAddress;
+
+} TEST_EPTP_VIEW_INSTRUCTION, *PTEST_EPTP_VIEW_INSTRUCTION;
+
+/**
+ * @brief The state of a simulated core
+ *
+ */
+typedef struct _TEST_EPTP_VIEW_CORE
+{
+    UINT32 CurrentView;
+    UINT64 SwitchRip;
+    UINT64 Exits;
+
+} TEST_EPTP_VIEW_CORE, *PTEST_EPTP_VIEW_CORE;
+
+/**
+ * @brief Convert the physical address of a table to its virtual address
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+static PVOID
+TestEptpViewPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context)
+{
+    PTEST_EPTP_VIEW_MEMORY Memory = (PTEST_EPTP_VIEW_MEMORY)Context;
+    UINT64                 Index;
+
+    if (PhysicalAddress >= TEST_EPTP_VIEW_OVERLAY_BASE)
+    {
+        Index = (PhysicalAddress - TEST_EPTP_VIEW_OVERLAY_BASE) / EPTP_VIEW_PAGE_SIZE;
+
+        if (Index >= TEST_EPTP_VIEW_MAXIMUM_TABLES)
+        {
+            return NULL;
+        }
+
+        return &Memory->OverlayTables[Index * EPTP_VIEW_TABLE_ENTRIES];
+    }
+
+    Index = PhysicalAddress / EPTP_VIEW_PAGE_SIZE;
+
+    if (Index == 0 || Index > Memory->Tables.size())
+    {
+        return NULL;
+    }
+
+    return Memory->Tables[Index - 1].data();
+}
+
+/**
+ * @brief Allocate a table of the simulated EPT
+ *
+ * @param Memory
+ *
+ * @return UINT64 The physical address of the table
+ */
+static UINT64
+TestEptpViewAllocateTable(PTEST_EPTP_VIEW_MEMORY Memory)
+{
+    Memory->Tables.emplace_back(EPTP_VIEW_TABLE_ENTRIES, 0);
+
+    return Memory->Tables.size() * EPTP_VIEW_PAGE_SIZE;
+}
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT32
+ */
+static UINT32
+TestEptpViewRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return (UINT32)(*State >> 33);
+}
+
+/**
+ * @brief Build the identity EPT with the 2 MB pages
+ *
+ * @param Memory
+ *
+ * @return VOID
+ */
+static VOID
+TestEptpViewBuildEpt(PTEST_EPTP_VIEW_MEMORY Memory)
+{
+    UINT64 Pml3PhysicalAddress;
+    UINT64 Pml2PhysicalAddress;
+
+    Memory->RootPhysicalAddress = TestEptpViewAllocateTable(Memory);
+    Pml3PhysicalAddress         = TestEptpViewAllocateTable(Memory);
+
+    Memory->Tables[Memory->RootPhysicalAddress / EPTP_VIEW_PAGE_SIZE - 1][0] = Pml3PhysicalAddress | EPTP_VIEW_ENTRY_PRESENT;
+
+    for (UINT64 Gb = 0; Gb < TEST_EPTP_VIEW_NUMBER_OF_GB; Gb++)
+    {
+        Pml2PhysicalAddress = TestEptpViewAllocateTable(Memory);
+
+        Memory->Tables[Pml3PhysicalAddress / EPTP_VIEW_PAGE_SIZE - 1][Gb] = Pml2PhysicalAddress | EPTP_VIEW_ENTRY_PRESENT;
+
+        for (UINT64 i = 0; i < EPTP_VIEW_TABLE_ENTRIES; i++)
+        {
+            Memory->Tables[Pml2PhysicalAddress / EPTP_VIEW_PAGE_SIZE - 1][i] =
+                ((Gb << 30) + (i << 21)) | EPTP_VIEW_ENTRY_PRESENT | EPTP_VIEW_ENTRY_LARGE_PAGE | TEST_EPTP_VIEW_MEMORY_TYPE_WB;
+        }
+    }
+}
+
+/**
+ * @brief Hook a page the same as the hidden hooks (split the 2 MB page and
+ * make the page execute-only on the fake page)
+ *
+ * @param Memory
+ * @param PhysicalAddress
+ *
+ * @return VOID
+ */
+static VOID
+TestEptpViewHookPage(PTEST_EPTP_VIEW_MEMORY Memory, UINT64 PhysicalAddress)
+{
+    UINT64 * Pml3 = (UINT64 *)TestEptpViewPhysicalToVirtual(Memory->Tables[Memory->RootPhysicalAddress / EPTP_VIEW_PAGE_SIZE - 1][0] & EPTP_VIEW_ENTRY_ADDRESS, Memory);
+    UINT64 * Pml2 = (UINT64 *)TestEptpViewPhysicalToVirtual(Pml3[(PhysicalAddress >> 30) & 511] & EPTP_VIEW_ENTRY_ADDRESS, Memory);
+    UINT64 * Pml2Entry = &Pml2[(PhysicalAddress >> 21) & 511];
+    UINT64 * Pml1;
+    UINT64   Pml1PhysicalAddress;
+    UINT64   FakePage;
+
+    PhysicalAddress &= ~((UINT64)EPTP_VIEW_PAGE_SIZE - 1);
+
+    if (Memory->OriginalEntries.count(PhysicalAddress))
+    {
+        return;
+    }
+
+    if (*Pml2Entry & EPTP_VIEW_ENTRY_LARGE_PAGE)
+    {
+        Pml1PhysicalAddress = TestEptpViewAllocateTable(Memory);
+        Pml1                = (UINT64 *)TestEptpViewPhysicalToVirtual(Pml1PhysicalAddress, Memory);
+
+        for (UINT64 i = 0; i < EPTP_VIEW_TABLE_ENTRIES; i++)
+        {
+            Pml1[i] = ((*Pml2Entry & EPTP_VIEW_ENTRY_ADDRESS) + i * EPTP_VIEW_PAGE_SIZE) | EPTP_VIEW_ENTRY_PRESENT | TEST_EPTP_VIEW_MEMORY_TYPE_WB;
+        }
+
+        *Pml2Entry = Pml1PhysicalAddress | EPTP_VIEW_ENTRY_PRESENT;
+    }
+
+    Pml1     = (UINT64 *)TestEptpViewPhysicalToVirtual(*Pml2Entry & EPTP_VIEW_ENTRY_ADDRESS, Memory);
+    FakePage = TEST_EPTP_VIEW_FAKE_PAGES_BASE + Memory->FakePages.size() * EPTP_VIEW_PAGE_SIZE;
+
+    Memory->OriginalEntries[PhysicalAddress] = Pml1[(PhysicalAddress >> 12) & 511];
+    Memory->FakePages[PhysicalAddress]       = FakePage;
+
+    Pml1[(PhysicalAddress >> 12) & 511] = FakePage | EPTP_VIEW_ENTRY_EXECUTE | TEST_EPTP_VIEW_MEMORY_TYPE_WB;
+}
+
+/**
+ * @brief Build the read view of the hooked pages
+ *
+ * @param Memory
+ * @param Overlay
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEptpViewBuildReadView(PTEST_EPTP_VIEW_MEMORY Memory, PEPTP_VIEW_OVERLAY Overlay)
+{
+    if (!EptpViewOverlayReset(Overlay, Memory->RootPhysicalAddress))
+    {
+        return FALSE;
+    }
+
+    for (auto & Hook : Memory->OriginalEntries)
+    {
+        if (!EptpViewOverlaySetEntry(Overlay, Hook.first, EptpViewGetReadViewEntry(Hook.second)))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the EPTP list and the target views
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEptpViewList()
+{
+    EPTP_VIEW_LIST List;
+    vector<UINT64> Entries(EPTP_VIEW_LIST_ENTRIES, 0xffffffffffffffffull);
+    UINT64         ExecuteEptp = 0x1234000 | TEST_EPTP_VIEW_EPTP_FLAGS;
+    UINT64         ReadEptp    = EptpViewGetEptp(ExecuteEptp, TEST_EPTP_VIEW_OVERLAY_BASE);
+
+    EptpViewListInitialize(&List, Entries.data(), 0x5000);
+
+    if (Entries[EPTP_VIEW_LIST_ENTRIES - 1] != 0 || EptpViewListFind(&List, ExecuteEptp) != EPTP_VIEW_NONE)
+    {
+        printf("[-] the EPTP list is not cleared\n");
+        return FALSE;
+    }
+
+    if (ReadEptp != (TEST_EPTP_VIEW_OVERLAY_BASE | TEST_EPTP_VIEW_EPTP_FLAGS))
+    {
+        printf("[-] the EPTP of the read view is %llx\n", ReadEptp);
+        return FALSE;
+    }
+
+    if (!EptpViewListSet(&List, EPTP_VIEW_EXECUTE, ExecuteEptp) ||
+        !EptpViewListSet(&List, EPTP_VIEW_READ, ReadEptp) ||
+        EptpViewListSet(&List, EPTP_VIEW_LIST_ENTRIES, ReadEptp))
+    {
+        printf("[-] the entries of the EPTP list are not set correctly\n");
+        return FALSE;
+    }
+
+    if (EptpViewListFind(&List, ExecuteEptp) != EPTP_VIEW_EXECUTE ||
+        EptpViewListFind(&List, ReadEptp) != EPTP_VIEW_READ ||
+        EptpViewListFind(&List, ReadEptp ^ 0x40) != EPTP_VIEW_NONE ||
+        EptpViewListFind(&List, 0) != EPTP_VIEW_NONE)
+    {
+        printf("[-] the views are not found in the EPTP list\n");
+        return FALSE;
+    }
+
+    //
+    // Reading or writing the execute-only pages moves to the read view, and
+    // executing the non-executable pages of the read view moves back
+    //
+    if (EptpViewGetTargetView(EPTP_VIEW_EXECUTE, TRUE, FALSE, FALSE) != EPTP_VIEW_READ ||
+        EptpViewGetTargetView(EPTP_VIEW_EXECUTE, FALSE, TRUE, FALSE) != EPTP_VIEW_READ ||
+        EptpViewGetTargetView(EPTP_VIEW_EXECUTE, FALSE, FALSE, TRUE) != EPTP_VIEW_NONE ||
+        EptpViewGetTargetView(EPTP_VIEW_READ, FALSE, FALSE, TRUE) != EPTP_VIEW_EXECUTE ||
+        EptpViewGetTargetView(EPTP_VIEW_READ, TRUE, FALSE, FALSE) != EPTP_VIEW_NONE ||
+        EptpViewGetTargetView(EPTP_VIEW_NONE, TRUE, FALSE, FALSE) != EPTP_VIEW_NONE)
+    {
+        printf("[-] the target views are not valid\n");
+        return FALSE;
+    }
+
+    if (EptpViewGetReadViewEntry(0x1000 | EPTP_VIEW_ENTRY_PRESENT | EPTP_VIEW_ENTRY_USER_EXECUTE | TEST_EPTP_VIEW_MEMORY_TYPE_WB) !=
+        (0x1000 | EPTP_VIEW_ENTRY_READ | EPTP_VIEW_ENTRY_WRITE | TEST_EPTP_VIEW_MEMORY_TYPE_WB))
+    {
+        printf("[-] the entry of the read view is executable\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the overlay of the read view
+ *
+ * @param Memory The hooked EPT
+ * @param Overlay
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEptpViewOverlay(PTEST_EPTP_VIEW_MEMORY Memory, PEPTP_VIEW_OVERLAY Overlay)
+{
+    vector<vector<UINT64>> SourceTables = Memory->Tables;
+    set<UINT64>            HookedGbs;
+    set<UINT64>            Hooked2Mbs;
+    UINT32                 ExpectedTables;
+    UINT64                 ReadRoot = Overlay->TablesPhysicalAddress;
+
+    if (!TestEptpViewBuildReadView(Memory, Overlay))
+    {
+        printf("[-] the read view is not built\n");
+        return FALSE;
+    }
+
+    //
+    // The root, the PML3 and the tables on the path to the hooked pages
+    //
+    for (auto & Hook : Memory->OriginalEntries)
+    {
+        HookedGbs.insert(Hook.first >> 30);
+        Hooked2Mbs.insert(Hook.first >> 21);
+    }
+
+    ExpectedTables = 2 + (UINT32)HookedGbs.size() + (UINT32)Hooked2Mbs.size();
+
+    if (Overlay->NumberOfTables != ExpectedTables)
+    {
+        printf("[-] the read view has %u tables, expected %u\n", Overlay->NumberOfTables, ExpectedTables);
+        return FALSE;
+    }
+
+    if (SourceTables != Memory->Tables)
+    {
+        printf("[-] the tables of the execute view are changed\n");
+        return FALSE;
+    }
+
+    //
+    // The hooked pages are readable in the read view, the rest of the
+    // memory is the same in both of the views
+    //
+    for (auto & Hook : Memory->OriginalEntries)
+    {
+        UINT64 ExecuteEntry = EptpViewTranslate(Memory->RootPhysicalAddress, Hook.first, TestEptpViewPhysicalToVirtual, Memory);
+        UINT64 ReadEntry    = EptpViewTranslate(ReadRoot, Hook.first, TestEptpViewPhysicalToVirtual, Memory);
+
+        if ((ExecuteEntry & EPTP_VIEW_ENTRY_PRESENT) != EPTP_VIEW_ENTRY_EXECUTE ||
+            (ExecuteEntry & EPTP_VIEW_ENTRY_ADDRESS) != Memory->FakePages[Hook.first] ||
+            ReadEntry != EptpViewGetReadViewEntry(Hook.second))
+        {
+            printf("[-] the entries of the hooked page %llx are %llx and %llx\n", Hook.first, ExecuteEntry, ReadEntry);
+            return FALSE;
+        }
+    }
+
+    for (UINT64 Address = 0; Address < (TEST_EPTP_VIEW_NUMBER_OF_GB << 30) + (1ull << 30); Address += EPTP_VIEW_PAGE_SIZE)
+    {
+        if (!Hooked2Mbs.count(Address >> 21) && (Address & ((1ull << 21) - 1)) != 0)
+        {
+            continue;
+        }
+
+        if (Memory->OriginalEntries.count(Address))
+        {
+            continue;
+        }
+
+        if (EptpViewTranslate(Memory->RootPhysicalAddress, Address, TestEptpViewPhysicalToVirtual, Memory) !=
+            EptpViewTranslate(ReadRoot, Address, TestEptpViewPhysicalToVirtual, Memory))
+        {
+            printf("[-] the page %llx is not the same in the views\n", Address);
+            return FALSE;
+        }
+    }
+
+    //
+    // The pages that are not split can't be changed, and the overlay can't
+    // use more tables than its pages
+    //
+    EPTP_VIEW_OVERLAY Small;
+
+    EptpViewOverlayInitialize(&Small,
+                              Memory->OverlayTables.data(),
+                              TEST_EPTP_VIEW_OVERLAY_BASE,
+                              3,
+                              TestEptpViewPhysicalToVirtual,
+                              Memory);
+
+    if (!EptpViewOverlayReset(&Small, Memory->RootPhysicalAddress) ||
+        EptpViewOverlaySetEntry(&Small, (TEST_EPTP_VIEW_NUMBER_OF_GB << 30) + 0x1000, 0) ||
+        EptpViewOverlaySetEntry(&Small, Memory->OriginalEntries.begin()->first, 0) ||
+        Small.NumberOfTables != 3)
+    {
+        printf("[-] the overlay changed a page without the tables\n");
+        return FALSE;
+    }
+
+    for (UINT64 Address = 0; Address < (TEST_EPTP_VIEW_NUMBER_OF_GB << 30); Address += (1ull << 21))
+    {
+        if (!(EptpViewTranslate(Memory->RootPhysicalAddress, Address, TestEptpViewPhysicalToVirtual, Memory) & EPTP_VIEW_ENTRY_LARGE_PAGE))
+        {
+            continue;
+        }
+
+        if (EptpViewOverlayReset(&Small, Memory->RootPhysicalAddress) && EptpViewOverlaySetEntry(&Small, Address, 0))
+        {
+            printf("[-] the overlay changed the 4 KB entry of the large page %llx\n", Address);
+            return FALSE;
+        }
+
+        break;
+    }
+
+    //
+    // Rebuild the read view (the test above used the same tables)
+    //
+    return TestEptpViewBuildReadView(Memory, Overlay);
+}
+
+/**
+ * @brief Run an instruction on the views, the same as the handler of the
+ * EPT violations of the hidden hooks
+ *
+ * @param Memory
+ * @param Overlay
+ * @param Core
+ * @param Instruction
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEptpViewRunOnViews(PTEST_EPTP_VIEW_MEMORY      Memory,
+                       PEPTP_VIEW_OVERLAY          Overlay,
+                       PTEST_EPTP_VIEW_CORE        Core,
+                       PTEST_EPTP_VIEW_INSTRUCTION Instruction)
+{
+    UINT64 RipPage  = Instruction->Rip & ~((UINT64)EPTP_VIEW_PAGE_SIZE - 1);
+    UINT64 DataPage = Instruction->DataAddress & ~((UINT64)EPTP_VIEW_PAGE_SIZE - 1);
+
+    for (UINT32 Attempt = 0; Attempt < 4; Attempt++)
+    {
+        UINT64 Root       = Core->CurrentView == EPTP_VIEW_EXECUTE ? Memory->RootPhysicalAddress : Overlay->TablesPhysicalAddress;
+        UINT64 FetchEntry = EptpViewTranslate(Root, RipPage, TestEptpViewPhysicalToVirtual, Memory);
+        UINT64 DataEntry;
+
+        if (!(FetchEntry & EPTP_VIEW_ENTRY_EXECUTE))
+        {
+            Core->Exits++;
+
+            if (EptpViewGetTargetView(Core->CurrentView, FALSE, FALSE, TRUE) != EPTP_VIEW_EXECUTE)
+            {
+                printf("[-] unexpected execute violation at %llx\n", Instruction->Rip);
+                return FALSE;
+            }
+
+            Core->CurrentView = EPTP_VIEW_EXECUTE;
+
+            if (Instruction->Rip == Core->SwitchRip)
+            {
+                //
+                // The instruction needs both of the views, it's stepped by
+                // the MTF on the original entries
+                //
+                Core->Exits++;
+                return TRUE;
+            }
+
+            continue;
+        }
+
+        if (Memory->FakePages.count(RipPage) &&
+            (FetchEntry & EPTP_VIEW_ENTRY_ADDRESS) != Memory->FakePages[RipPage])
+        {
+            printf("[-] the original page of the hooked page %llx is executed\n", RipPage);
+            return FALSE;
+        }
+
+        if (!Instruction->HasDataAccess)
+        {
+            return TRUE;
+        }
+
+        DataEntry = EptpViewTranslate(Root, DataPage, TestEptpViewPhysicalToVirtual, Memory);
+
+        if (!(DataEntry & EPTP_VIEW_ENTRY_READ))
+        {
+            Core->Exits++;
+
+            if (EptpViewGetTargetView(Core->CurrentView, TRUE, FALSE, FALSE) != EPTP_VIEW_READ)
+            {
+                printf("[-] unexpected read violation at %llx\n", Instruction->Rip);
+                return FALSE;
+            }
+
+            Core->CurrentView = EPTP_VIEW_READ;
+            Core->SwitchRip   = Instruction->Rip;
+
+            continue;
+        }
+
+        if (Memory->FakePages.count(DataPage) && (DataEntry & EPTP_VIEW_ENTRY_ADDRESS) != DataPage)
+        {
+            printf("[-] the fake page of the hooked page %llx is read\n", DataPage);
+            return FALSE;
+        }
+
+        return TRUE;
+    }
+
+    printf("[-] the instruction at %llx doesn't make progress\n", Instruction->Rip);
+    return FALSE;
+}
+
+/**
+ * @brief Replay a trace with both of the MTF restore and the views
+ *
+ * @param Memory
+ * @param Overlay
+ * @param Name
+ * @param Trace
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEptpViewReplayTrace(PTEST_EPTP_VIEW_MEMORY              Memory,
+                        PEPTP_VIEW_OVERLAY                  Overlay,
+                        const char *                        Name,
+                        vector<TEST_EPTP_VIEW_INSTRUCTION> & Trace)
+{
+    TEST_EPTP_VIEW_CORE Core        = {EPTP_VIEW_EXECUTE, 0, 0};
+    UINT64              ExitsOfMtf  = 0;
+    UINT64              DataOfHooks = 0;
+
+    for (auto & Instruction : Trace)
+    {
+        //
+        // Without the views, each access to a hooked page restores the
+        // original entry and steps the instruction with the MTF
+        //
+        if (Instruction.HasDataAccess && Memory->OriginalEntries.count(Instruction.DataAddress & ~((UINT64)EPTP_VIEW_PAGE_SIZE - 1)))
+        {
+            ExitsOfMtf += 2;
+            DataOfHooks++;
+        }
+
+        if (!TestEptpViewRunOnViews(Memory, Overlay, &Core, &Instruction))
+        {
+            return FALSE;
+        }
+    }
+
+    printf("[*] %s : %llu reads of the hooked pages, %llu exits with MTF, %llu exits with the views\n",
+           Name,
+           DataOfHooks,
+           ExitsOfMtf,
+           Core.Exits);
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the EPTP list and the views of the hidden hooks
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestEptpView()
+{
+    TEST_EPTP_VIEW_MEMORY              Memory;
+    EPTP_VIEW_OVERLAY                  Overlay;
+    vector<UINT64>                     Hooks;
+    vector<TEST_EPTP_VIEW_INSTRUCTION> Trace;
+    UINT64                             Seed     = 0xe97;
+    UINT64                             CodePage = 0x7654000; // A page that is not hooked
+
+    if (!TestEptpViewList())
+    {
+        return FALSE;
+    }
+
+    //
+    // Hook the pages of a few kernel modules (the neighbor pages share the
+    // tables of the lower levels)
+    //
+    TestEptpViewBuildEpt(&Memory);
+
+    for (UINT32 i = 0; i < TEST_EPTP_VIEW_NUMBER_OF_HOOKS; i++)
+    {
+        UINT64 Module = (1 + TestEptpViewRandom(&Seed) % 5) * 0x2a400000ull;
+        UINT64 Page   = Module + (TestEptpViewRandom(&Seed) % 0x600) * EPTP_VIEW_PAGE_SIZE;
+
+        TestEptpViewHookPage(&Memory, Page);
+    }
+
+    for (auto & Hook : Memory.OriginalEntries)
+    {
+        Hooks.push_back(Hook.first);
+    }
+
+    Memory.OverlayTables.assign((size_t)TEST_EPTP_VIEW_MAXIMUM_TABLES * EPTP_VIEW_TABLE_ENTRIES, 0);
+
+    EptpViewOverlayInitialize(&Overlay,
+                              Memory.OverlayTables.data(),
+                              TEST_EPTP_VIEW_OVERLAY_BASE,
+                              TEST_EPTP_VIEW_MAXIMUM_TABLES,
+                              TestEptpViewPhysicalToVirtual,
+                              &Memory);
+
+    if (!TestEptpViewOverlay(&Memory, &Overlay))
+    {
+        return FALSE;
+    }
+
+    printf("[*] %llu hooked pages, the read view has %u tables\n", (UINT64)Hooks.size(), Overlay.NumberOfTables);
+
+    //
+    // An integrity check that reads the hooked pages (8 bytes at a time) while
+    // the hooked functions are called
+    //
+    for (UINT32 i = 0; i < TEST_EPTP_VIEW_NUMBER_OF_ACCESSES; i++)
+    {
+        UINT64 Page = Hooks[(i / (EPTP_VIEW_PAGE_SIZE / 8)) % Hooks.size()];
+
+        if (TestEptpViewRandom(&Seed) % 64 == 0)
+        {
+            Trace.push_back({Hooks[TestEptpViewRandom(&Seed) % Hooks.size()] + 0x10, FALSE, 0});
+        }
+
+        Trace.push_back({CodePage + 0x20, TRUE, Page + (i * 8) % EPTP_VIEW_PAGE_SIZE});
+    }
+
+    if (!TestEptpViewReplayTrace(&Memory, &Overlay, "integrity check of the hooked pages", Trace))
+    {
+        return FALSE;
+    }
+
+    //
+    // The hooked functions that read the data of the other hooked pages
+    //
+    Trace.clear();
+
+    for (UINT32 i = 0; i < TEST_EPTP_VIEW_NUMBER_OF_ACCESSES; i++)
+    {
+        UINT64 Function = Hooks[TestEptpViewRandom(&Seed) % Hooks.size()];
+        UINT64 Data     = Hooks[TestEptpViewRandom(&Seed) % Hooks.size()];
+
+        Trace.push_back({Function + 0x40, TestEptpViewRandom(&Seed) % 4 == 0, Data + 0x100});
+    }
+
+    if (!TestEptpViewReplayTrace(&Memory, &Overlay, "hooked functions that read the hooked pages", Trace))
+    {
+        return FALSE;
+    }
+
+    //
+    // The functions that read their own page (e.g., jump tables)
+    //
+    Trace.clear();
+
+    for (UINT32 i = 0; i < TEST_EPTP_VIEW_NUMBER_OF_ACCESSES; i++)
+    {
+        UINT64 Function = Hooks[TestEptpViewRandom(&Seed) % Hooks.size()];
+
+        Trace.push_back({Function + 0x80, TRUE, Function + 0x800});
+    }
+
+    return TestEptpViewReplayTrace(&Memory, &Overlay, "hooked functions that read their own page", Trace);
+}
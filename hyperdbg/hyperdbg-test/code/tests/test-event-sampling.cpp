@@ -0,0 +1,436 @@
+/**
+ * @file test-event-sampling.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the sampling policies of the events
+ * @details Each policy is checked against its definition, the first-N
+ * policy is also checked with concurrent cores, and the cost of a single
+ * check is measured for each policy
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Tag of the event of the tests
+ *
+ */
+#define TEST_EVENT_SAMPLING_TAG 0x1000002
+
+/**
+ * @brief Number of the simulated cores
+ *
+ */
+#define TEST_EVENT_SAMPLING_NUMBER_OF_CORES 4
+
+/**
+ * @brief Number of the checks of the benchmark
+ *
+ */
+#define TEST_EVENT_SAMPLING_BENCHMARK_CHECKS 4000000
+
+/**
+ * @brief Initialize the sampling of the event of the tests
+ *
+ * @param Sampling
+ * @param CoreStates
+ * @param Type
+ * @param Parameter1
+ * @param Parameter2
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventSamplingInitialize(PEVENT_SAMPLING              Sampling,
+                            PEVENT_SAMPLING_CORE_STATE   CoreStates,
+                            DEBUGGER_EVENT_SAMPLING_TYPE Type,
+                            UINT64                       Parameter1,
+                            UINT64                       Parameter2)
+{
+    DEBUGGER_EVENT_SAMPLING_POLICY Policy = {Type, Parameter1, Parameter2};
+
+    if (!EventSamplingValidatePolicy(&Policy))
+    {
+        printf("[-] a valid sampling policy (type: %x) is rejected\n", Type);
+        return FALSE;
+    }
+
+    memset(CoreStates, 0, sizeof(EVENT_SAMPLING_CORE_STATE) * TEST_EVENT_SAMPLING_NUMBER_OF_CORES);
+    EventSamplingInitialize(Sampling, &Policy, 0);
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the every-Nth policy
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventSamplingEveryNth()
+{
+    EVENT_SAMPLING            Sampling;
+    EVENT_SAMPLING_CORE_STATE CoreStates[TEST_EVENT_SAMPLING_NUMBER_OF_CORES];
+    UINT32                    Triggered[TEST_EVENT_SAMPLING_NUMBER_OF_CORES] = {0};
+
+    if (!TestEventSamplingInitialize(&Sampling, CoreStates, DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH, 100, 0))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < 10000; i++)
+    {
+        UINT32 Core = i % TEST_EVENT_SAMPLING_NUMBER_OF_CORES;
+
+        if (EventSamplingCheck(&Sampling, &CoreStates[Core], TEST_EVENT_SAMPLING_TAG, Core, i) != EVENT_SAMPLING_RESULT_SKIP)
+        {
+            //
+            // The first trigger of each core and then each 100th trigger
+            //
+            if ((i / TEST_EVENT_SAMPLING_NUMBER_OF_CORES) % 100 != 0)
+            {
+                printf("[-] every-Nth: trigger %u is sampled\n", i);
+                return FALSE;
+            }
+
+            Triggered[Core]++;
+        }
+    }
+
+    for (UINT32 Core = 0; Core < TEST_EVENT_SAMPLING_NUMBER_OF_CORES; Core++)
+    {
+        if (Triggered[Core] != 25 || CoreStates[Core].NumberOfSkipped != 2475)
+        {
+            printf("[-] every-Nth: %u triggers are sampled on core %u\n", Triggered[Core], Core);
+            return FALSE;
+        }
+    }
+
+    //
+    // The state of the core is reset once it's used by another event
+    //
+    if (EventSamplingCheck(&Sampling, &CoreStates[0], TEST_EVENT_SAMPLING_TAG + 1, 0, 0) != EVENT_SAMPLING_RESULT_TRIGGER ||
+        CoreStates[0].NumberOfTriggered != 1)
+    {
+        printf("[-] every-Nth: the state of the core is not reset for a new event\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the probabilistic policy
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventSamplingProbabilistic()
+{
+    EVENT_SAMPLING            Sampling;
+    EVENT_SAMPLING_CORE_STATE CoreStates[TEST_EVENT_SAMPLING_NUMBER_OF_CORES];
+    UINT64                    Probabilities[] = {EVENT_SAMPLING_PROBABILITY_ONE / 4, EVENT_SAMPLING_PROBABILITY_ONE / 1000, EVENT_SAMPLING_PROBABILITY_ONE};
+    UINT64                    Triggered;
+    UINT64                    Expected;
+
+    for (UINT64 Probability : Probabilities)
+    {
+        if (!TestEventSamplingInitialize(&Sampling, CoreStates, DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC, Probability, 0))
+        {
+            return FALSE;
+        }
+
+        Triggered = 0;
+
+        for (UINT32 i = 0; i < 1000000; i++)
+        {
+            UINT32 Core = i % TEST_EVENT_SAMPLING_NUMBER_OF_CORES;
+
+            if (EventSamplingCheck(&Sampling, &CoreStates[Core], TEST_EVENT_SAMPLING_TAG, Core, i) != EVENT_SAMPLING_RESULT_SKIP)
+            {
+                Triggered++;
+            }
+        }
+
+        //
+        // Within 5% (and 20 triggers) of the expected triggers
+        //
+        Expected = (1000000 * Probability) >> 32;
+
+        if (Triggered + Expected / 20 + 20 < Expected || Triggered > Expected + Expected / 20 + 20)
+        {
+            printf("[-] probabilistic: %llu triggers are sampled, expected %llu\n", Triggered, Expected);
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the token bucket policy
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventSamplingTokenBucket()
+{
+    EVENT_SAMPLING            Sampling;
+    EVENT_SAMPLING_CORE_STATE CoreStates[TEST_EVENT_SAMPLING_NUMBER_OF_CORES];
+    UINT64                    Triggered = 0;
+    UINT64                    Tsc       = 1000000;
+
+    if (!TestEventSamplingInitialize(&Sampling, CoreStates, DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET, 1000, 10))
+    {
+        return FALSE;
+    }
+
+    //
+    // The burst is allowed at the start
+    //
+    for (UINT32 i = 0; i < 100; i++)
+    {
+        if (EventSamplingCheck(&Sampling, &CoreStates[0], TEST_EVENT_SAMPLING_TAG, 0, Tsc) != EVENT_SAMPLING_RESULT_SKIP)
+        {
+            Triggered++;
+        }
+    }
+
+    if (Triggered != 10)
+    {
+        printf("[-] token bucket: %llu triggers are sampled in the burst\n", Triggered);
+        return FALSE;
+    }
+
+    //
+    // A trigger each 10 cycles for a million cycles, only a trigger
+    // per 1000 cycles is sampled
+    //
+    Triggered = 0;
+
+    for (UINT32 i = 0; i < 100000; i++)
+    {
+        Tsc += 10;
+
+        if (EventSamplingCheck(&Sampling, &CoreStates[0], TEST_EVENT_SAMPLING_TAG, 0, Tsc) != EVENT_SAMPLING_RESULT_SKIP)
+        {
+            Triggered++;
+        }
+    }
+
+    if (Triggered != 1000)
+    {
+        printf("[-] token bucket: %llu triggers are sampled in 1000000 cycles\n", Triggered);
+        return FALSE;
+    }
+
+    //
+    // A long idle time doesn't fill the bucket more than the burst
+    //
+    Tsc += 1000000000;
+    Triggered = 0;
+
+    for (UINT32 i = 0; i < 100; i++)
+    {
+        if (EventSamplingCheck(&Sampling, &CoreStates[0], TEST_EVENT_SAMPLING_TAG, 0, Tsc) != EVENT_SAMPLING_RESULT_SKIP)
+        {
+            Triggered++;
+        }
+    }
+
+    if (Triggered != 10)
+    {
+        printf("[-] token bucket: %llu triggers are sampled after the idle time\n", Triggered);
+        return FALSE;
+    }
+
+    //
+    // Each core has its own bucket
+    //
+    if (EventSamplingCheck(&Sampling, &CoreStates[1], TEST_EVENT_SAMPLING_TAG, 1, Tsc) != EVENT_SAMPLING_RESULT_TRIGGER)
+    {
+        printf("[-] token bucket: the bucket of another core is used\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the first-N policy while the cores are running concurrently
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventSamplingFirstN()
+{
+    EVENT_SAMPLING            Sampling;
+    EVENT_SAMPLING_CORE_STATE CoreStates[TEST_EVENT_SAMPLING_NUMBER_OF_CORES];
+    std::vector<std::thread>  Cores;
+    volatile LONG64           Triggered;
+    volatile LONG64           Disabled;
+
+    if (!TestEventSamplingInitialize(&Sampling, CoreStates, DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N, 5000, 0))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 Round = 0; Round < 2; Round++)
+    {
+        Triggered = 0;
+        Disabled  = 0;
+        Cores.clear();
+
+        for (UINT32 Core = 0; Core < TEST_EVENT_SAMPLING_NUMBER_OF_CORES; Core++)
+        {
+            Cores.emplace_back([&, Core]() {
+                for (UINT32 i = 0; i < 100000; i++)
+                {
+                    EVENT_SAMPLING_RESULT Result = EventSamplingCheck(&Sampling, &CoreStates[Core], TEST_EVENT_SAMPLING_TAG, Core, i);
+
+                    if (Result != EVENT_SAMPLING_RESULT_SKIP)
+                    {
+                        InterlockedIncrement64(&Triggered);
+                    }
+
+                    if (Result == EVENT_SAMPLING_RESULT_TRIGGER_AND_DISABLE)
+                    {
+                        InterlockedIncrement64(&Disabled);
+                    }
+                }
+            });
+        }
+
+        for (auto & Core : Cores)
+        {
+            Core.join();
+        }
+
+        if (Triggered != 5000 || Disabled != 1)
+        {
+            printf("[-] first-N: %lld triggers are sampled and the event is disabled %lld times\n",
+                   Triggered,
+                   Disabled);
+            return FALSE;
+        }
+
+        //
+        // Enabling the event again gives the N triggers again
+        //
+        EventSamplingReset(&Sampling);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check that the invalid policies are rejected
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventSamplingInvalidPolicies()
+{
+    DEBUGGER_EVENT_SAMPLING_POLICY Policies[] = {
+        {DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH, 0, 0},
+        {DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N, 0, 0},
+        {DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC, 0, 0},
+        {DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC, EVENT_SAMPLING_PROBABILITY_ONE + 1, 0},
+        {DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET, 0, 10},
+        {DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET, 1000, 0},
+        {DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET, 1000, EVENT_SAMPLING_MAXIMUM_BURST + 1},
+        {(DEBUGGER_EVENT_SAMPLING_TYPE)5, 1, 1},
+    };
+
+    for (auto & Policy : Policies)
+    {
+        if (EventSamplingValidatePolicy(&Policy))
+        {
+            printf("[-] an invalid sampling policy (type: %x, %llx, %llx) is accepted\n",
+                   Policy.Type,
+                   Policy.Parameter1,
+                   Policy.Parameter2);
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Measure the cost of a check of each policy
+ *
+ * @return VOID
+ */
+static VOID
+TestEventSamplingBenchmark()
+{
+    EVENT_SAMPLING            Sampling;
+    EVENT_SAMPLING_CORE_STATE CoreStates[TEST_EVENT_SAMPLING_NUMBER_OF_CORES];
+    volatile UINT64           Triggered;
+
+    struct
+    {
+        const char *                 Name;
+        DEBUGGER_EVENT_SAMPLING_TYPE Type;
+        UINT64                       Parameter1;
+        UINT64                       Parameter2;
+    } Policies[] = {
+        {"every-Nth", DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH, 100, 0},
+        {"probabilistic", DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC, EVENT_SAMPLING_PROBABILITY_ONE / 100, 0},
+        {"token bucket", DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET, 3000, 16},
+        {"first-N (exhausted)", DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N, 100, 0},
+    };
+
+    for (auto & Policy : Policies)
+    {
+        TestEventSamplingInitialize(&Sampling, CoreStates, Policy.Type, Policy.Parameter1, Policy.Parameter2);
+
+        Triggered  = 0;
+        auto Start = std::chrono::high_resolution_clock::now();
+
+        for (UINT64 i = 0; i < TEST_EVENT_SAMPLING_BENCHMARK_CHECKS; i++)
+        {
+            //
+            // The TSC advances about 30 cycles for each trigger
+            //
+            if (EventSamplingCheck(&Sampling, &CoreStates[0], TEST_EVENT_SAMPLING_TAG, 0, i * 30) != EVENT_SAMPLING_RESULT_SKIP)
+            {
+                Triggered = Triggered + 1;
+            }
+        }
+
+        auto Elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - Start).count();
+
+        printf("[*] %s : %.2f ns per check, %.1f M checks per second, %llu of %u triggers are sampled\n",
+               Policy.Name,
+               (double)Elapsed / TEST_EVENT_SAMPLING_BENCHMARK_CHECKS,
+               TEST_EVENT_SAMPLING_BENCHMARK_CHECKS * 1000.0 / (Elapsed ? Elapsed : 1),
+               (UINT64)Triggered,
+               TEST_EVENT_SAMPLING_BENCHMARK_CHECKS);
+    }
+}
+
+/**
+ * @brief Test the sampling policies of the events
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestEventSampling()
+{
+    if (!TestEventSamplingEveryNth() ||
+        !TestEventSamplingProbabilistic() ||
+        !TestEventSamplingTokenBucket() ||
+        !TestEventSamplingFirstN() ||
+        !TestEventSamplingInvalidPolicies())
+    {
+        return FALSE;
+    }
+
+    TestEventSamplingBenchmark();
+
+    return TRUE;
+}
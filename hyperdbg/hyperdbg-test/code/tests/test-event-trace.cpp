@@ -0,0 +1,435 @@
+/**
+ * @file test-event-trace.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the binary event trace recorder and queries
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of simulated cores
+ *
+ */
+#define TEST_EVENT_TRACE_NUMBER_OF_CORES 8
+
+/**
+ * @brief Number of simulated triggered events
+ *
+ */
+#define TEST_EVENT_TRACE_NUMBER_OF_RECORDS 200000
+
+/**
+ * @brief Context of the query callback that accumulates the matched records
+ *
+ */
+typedef struct _TEST_EVENT_TRACE_QUERY_CONTEXT
+{
+    UINT64 NumberOfRecords;
+    UINT64 Checksum;
+
+} TEST_EVENT_TRACE_QUERY_CONTEXT, *PTEST_EVENT_TRACE_QUERY_CONTEXT;
+
+/**
+ * @brief Generate a pseudo-random number (xorshift64)
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestEventTraceRandom(UINT64 * State)
+{
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return *State;
+}
+
+/**
+ * @brief Compute an order-independent checksum of a record
+ *
+ * @param Record
+ *
+ * @return UINT64
+ */
+static UINT64
+TestEventTraceRecordChecksum(const EVENT_TRACE_RECORD * Record)
+{
+    return (Record->Tsc * 0x9E3779B97F4A7C15ull) ^ (Record->Tag << 17) ^ Record->Registers[0] ^
+           ((UINT64)Record->Core << 48) ^ Record->Rip;
+}
+
+/**
+ * @brief Callback of the queries
+ *
+ * @param Record
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventTraceQueryCallback(const EVENT_TRACE_RECORD * Record, PVOID Context)
+{
+    PTEST_EVENT_TRACE_QUERY_CONTEXT QueryContext = (PTEST_EVENT_TRACE_QUERY_CONTEXT)Context;
+
+    QueryContext->NumberOfRecords++;
+    QueryContext->Checksum += TestEventTraceRecordChecksum(Record);
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether a record matches the query (brute-force)
+ *
+ * @param Record
+ * @param Query
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventTraceIsRecordMatched(const EVENT_TRACE_RECORD * Record, const EVENT_TRACE_QUERY * Query)
+{
+    return (!Query->FilterByTag || Record->Tag == Query->Tag) &&
+           (!Query->FilterByCore || Record->Core == Query->Core) &&
+           Record->Tsc >= Query->MinimumTsc &&
+           Record->Tsc <= Query->MaximumTsc;
+}
+
+/**
+ * @brief Run a query over the indexed file and compare it with a
+ * brute-force scan of the generated records
+ *
+ * @param Name
+ * @param FileBuffer
+ * @param Index
+ * @param Records
+ * @param Query
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestEventTracePerformQuery(const char *                                 Name,
+                           const UINT8 *                                FileBuffer,
+                           const std::vector<EVENT_TRACE_INDEX_ENTRY> & Index,
+                           const std::vector<EVENT_TRACE_RECORD> &      Records,
+                           const EVENT_TRACE_QUERY *                    Query)
+{
+    TEST_EVENT_TRACE_QUERY_CONTEXT Context         = {0};
+    EVENT_TRACE_QUERY_RESULT       Result          = {0};
+    UINT64                         ExpectedRecords = 0;
+    UINT64                         ExpectedSum     = 0;
+    BOOLEAN                        IsMatched;
+
+    auto IndexedStart = std::chrono::high_resolution_clock::now();
+
+    EventTraceQuery(FileBuffer,
+                    Index.data(),
+                    Index.size(),
+                    Query,
+                    TestEventTraceQueryCallback,
+                    &Context,
+                    &Result);
+
+    auto IndexedEnd = std::chrono::high_resolution_clock::now();
+
+    for (const EVENT_TRACE_RECORD & Record : Records)
+    {
+        if (TestEventTraceIsRecordMatched(&Record, Query))
+        {
+            ExpectedRecords++;
+            ExpectedSum += TestEventTraceRecordChecksum(&Record);
+        }
+    }
+
+    auto ScanEnd = std::chrono::high_resolution_clock::now();
+
+    IsMatched = Context.NumberOfRecords == ExpectedRecords &&
+                Context.Checksum == ExpectedSum &&
+                Result.NumberOfMatchedRecords == ExpectedRecords;
+
+    printf("[%c] %-28s : %7llu record(s), skipped %5llu/%5llu block(s), indexed %6lld us, scan %6lld us\n",
+           IsMatched ? '+' : '-',
+           Name,
+           Context.NumberOfRecords,
+           Result.NumberOfSkippedBlocks,
+           Result.NumberOfSkippedBlocks + Result.NumberOfVisitedBlocks,
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(IndexedEnd - IndexedStart).count(),
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(ScanEnd - IndexedEnd).count());
+
+    return IsMatched;
+}
+
+/**
+ * @brief Test the binary event trace by recording simulated events of
+ * several cores into blocks, appending them to a file, and comparing the
+ * indexed queries with a brute-force scan
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestEventTrace()
+{
+    BOOLEAN                              OverallResult = TRUE;
+    UINT64                               RandomState   = 0x2545F4914F6CDD1Dull;
+    UINT64                               Tsc           = 0x100000;
+    UINT64                               FileSize      = 0;
+    UINT64                               NumberOfEntries;
+    UINT64                               MiddleTsc     = 0;
+    UINT8                                RegisterId    = 0;
+    UINT8 *                              FileBuffer    = NULL;
+    PEVENT_TRACE_BLOCK                   Blocks        = NULL;
+    PEVENT_TRACE_FILE_HEADER             FileHeader;
+    UINT64                               FileBufferSize;
+    EVENT_TRACE_QUERY                    Query;
+    std::vector<EVENT_TRACE_RECORD>      Records;
+    std::vector<EVENT_TRACE_INDEX_ENTRY> Index;
+
+    //
+    // Each record fills at most one block, plus the partially filled blocks
+    //
+    FileBufferSize = sizeof(EVENT_TRACE_FILE_HEADER) + TEST_EVENT_TRACE_NUMBER_OF_RECORDS * sizeof(EVENT_TRACE_RECORD) +
+                     (TEST_EVENT_TRACE_NUMBER_OF_RECORDS / EVENT_TRACE_MAXIMUM_RECORDS_PER_BLOCK + TEST_EVENT_TRACE_NUMBER_OF_CORES + 1) *
+                         sizeof(EVENT_TRACE_BLOCK_HEADER);
+
+    FileBuffer = (UINT8 *)malloc(FileBufferSize);
+    Blocks     = (PEVENT_TRACE_BLOCK)malloc(TEST_EVENT_TRACE_NUMBER_OF_CORES * sizeof(EVENT_TRACE_BLOCK));
+
+    if (FileBuffer == NULL || Blocks == NULL)
+    {
+        free(FileBuffer);
+        free(Blocks);
+        return FALSE;
+    }
+
+    FileHeader = (PEVENT_TRACE_FILE_HEADER)FileBuffer;
+    EventTraceInitializeFileHeader(FileHeader);
+
+    for (UINT16 i = 0; i < TEST_EVENT_TRACE_NUMBER_OF_CORES; i++)
+    {
+        EventTraceInitializeBlock(&Blocks[i], i);
+    }
+
+    //
+    // Register names should be resolved case-insensitively
+    //
+    if (!EventTraceGetRegisterIdByName("R8", &RegisterId) || RegisterId != 8 ||
+        strcmp(EventTraceGetRegisterName(RegisterId), "r8") != 0 ||
+        EventTraceGetRegisterIdByName("rip", &RegisterId))
+    {
+        printf("[-] resolving the register names failed\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Generate the records, most of the events are frequent on all cores,
+    // some are bound to a single core and some only fire in short bursts
+    //
+    Records.reserve(TEST_EVENT_TRACE_NUMBER_OF_RECORDS);
+
+    for (UINT32 i = 0; i < TEST_EVENT_TRACE_NUMBER_OF_RECORDS; i++)
+    {
+        EVENT_TRACE_RECORD Record = {0};
+        UINT64             Random = TestEventTraceRandom(&RandomState);
+        UINT64             Tag;
+
+        Tsc += 1 + (Random & 0xff);
+
+        if ((i / 5000) % 8 == 3 && (Random & 0x3) == 0)
+        {
+            //
+            // Bursty events
+            //
+            Tag = DebuggerEventTagStartSeed + 10 + ((Random >> 8) & 0x1);
+        }
+        else
+        {
+            Tag = DebuggerEventTagStartSeed + ((Random >> 8) % 10);
+        }
+
+        Record.Tag       = Tag;
+        Record.Tsc       = Tsc;
+        Record.Rip       = 0xfffff80000000000 + ((Random >> 16) & 0xffffff);
+        Record.Context   = Random >> 32;
+        Record.Core      = (Tag == DebuggerEventTagStartSeed + 9) ? 5 : (UINT16)((Random >> 40) % TEST_EVENT_TRACE_NUMBER_OF_CORES);
+        Record.EventType = (UINT16)(Tag - DebuggerEventTagStartSeed);
+        Record.Stage     = VMM_CALLBACK_CALLING_STAGE_PRE_EVENT_EMULATION;
+
+        for (UINT8 j = 0; j < EVENT_TRACE_NUMBER_OF_REGISTERS; j++)
+        {
+            Record.RegisterIds[j] = j;
+            Record.Registers[j]   = TestEventTraceRandom(&RandomState);
+        }
+
+        Records.push_back(Record);
+
+        if (EventTraceAddRecordToBlock(&Blocks[Record.Core], &Record))
+        {
+            //
+            // The block is full, append it as it's received from the kernel
+            //
+            if (!EventTraceAppendBlock(FileBuffer,
+                                       FileBufferSize,
+                                       &Blocks[Record.Core],
+                                       EventTraceGetBlockLength(&Blocks[Record.Core].Header)))
+            {
+                OverallResult = FALSE;
+            }
+
+            EventTraceInitializeBlock(&Blocks[Record.Core], Record.Core);
+        }
+
+        if (i == TEST_EVENT_TRACE_NUMBER_OF_RECORDS / 2)
+        {
+            MiddleTsc = Tsc;
+        }
+    }
+
+    //
+    // Flush the partially filled blocks
+    //
+    for (UINT16 i = 0; i < TEST_EVENT_TRACE_NUMBER_OF_CORES; i++)
+    {
+        if (Blocks[i].Header.NumberOfRecords != 0 &&
+            !EventTraceAppendBlock(FileBuffer, FileBufferSize, &Blocks[i], EventTraceGetBlockLength(&Blocks[i].Header)))
+        {
+            OverallResult = FALSE;
+        }
+    }
+
+    FileSize = sizeof(EVENT_TRACE_FILE_HEADER) + FileHeader->DataSize;
+
+    printf("[*] %-28s : %7llu record(s), %5llu block(s), %llu byte(s)\n",
+           "recorded trace",
+           FileHeader->NumberOfRecords,
+           FileHeader->NumberOfBlocks,
+           FileSize);
+
+    if (!EventTraceValidateFileHeader(FileBuffer, FileSize) ||
+        FileHeader->NumberOfRecords != TEST_EVENT_TRACE_NUMBER_OF_RECORDS ||
+        FileHeader->NumberOfCores != TEST_EVENT_TRACE_NUMBER_OF_CORES ||
+        FileHeader->MinimumTsc != Records.front().Tsc ||
+        FileHeader->MaximumTsc != Records.back().Tsc)
+    {
+        printf("[-] the header of the trace file is not valid\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Build the index
+    //
+    if (!EventTraceBuildIndex(FileBuffer, FileSize, NULL, 0, &NumberOfEntries) ||
+        NumberOfEntries != FileHeader->NumberOfBlocks)
+    {
+        printf("[-] counting the blocks failed\n");
+        OverallResult = FALSE;
+    }
+
+    Index.resize(NumberOfEntries);
+
+    if (!EventTraceBuildIndex(FileBuffer, FileSize, Index.data(), Index.size(), &NumberOfEntries))
+    {
+        printf("[-] building the index failed\n");
+        OverallResult = FALSE;
+        Index.clear();
+    }
+
+    //
+    // Compare the queries with brute-force scans
+    //
+    RtlZeroMemory(&Query, sizeof(Query));
+    Query.MaximumTsc = MAXUINT64;
+
+    if (!TestEventTracePerformQuery("all records", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.FilterByTag = TRUE;
+    Query.Tag         = DebuggerEventTagStartSeed + 3;
+
+    if (!TestEventTracePerformQuery("frequent event", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.Tag = DebuggerEventTagStartSeed + 10;
+
+    if (!TestEventTracePerformQuery("bursty event", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.Tag = DebuggerEventTagStartSeed + 0x1234;
+
+    if (!TestEventTracePerformQuery("not existing event", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.Tag          = DebuggerEventTagStartSeed + 9;
+    Query.FilterByCore = TRUE;
+    Query.Core         = 5;
+
+    if (!TestEventTracePerformQuery("single-core event", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.FilterByTag = FALSE;
+    Query.Core        = 2;
+
+    if (!TestEventTracePerformQuery("single core", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.FilterByCore = FALSE;
+    Query.MinimumTsc   = MiddleTsc;
+    Query.MaximumTsc   = MiddleTsc + 0x4000;
+
+    if (!TestEventTracePerformQuery("tsc range", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    Query.FilterByTag  = TRUE;
+    Query.Tag          = DebuggerEventTagStartSeed + 1;
+    Query.FilterByCore = TRUE;
+    Query.Core         = 7;
+
+    if (!TestEventTracePerformQuery("tsc range + event + core", FileBuffer, Index, Records, &Query))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Truncated and corrupted files should be rejected
+    //
+    if (EventTraceBuildIndex(FileBuffer, FileSize - 1, NULL, 0, &NumberOfEntries))
+    {
+        printf("[-] the truncated file is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    if (!Index.empty())
+    {
+        ((PEVENT_TRACE_BLOCK_HEADER)(FileBuffer + Index.back().Offset))->NumberOfRecords = EVENT_TRACE_MAXIMUM_RECORDS_PER_BLOCK + 1;
+    }
+
+    if (EventTraceBuildIndex(FileBuffer, FileSize, NULL, 0, &NumberOfEntries))
+    {
+        printf("[-] the corrupted block is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    free(FileBuffer);
+    free(Blocks);
+
+    return OverallResult;
+}
@@ -0,0 +1,913 @@
+/**
+ * @file test-hook-batch.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the batches of EPT hooks
+ * @details The hidden breakpoints on the exports of a few drivers are
+ * installed and removed one by one (the same way as EptHookPerformHook and
+ * EptHookUnHookSingleAddress) and by batches (the same way as EptHookBatch
+ * and EptHookUnHookBatch) on simulated EPTs of the cores, then the pages,
+ * the fake pages and the entries of the cores are compared, at last the
+ * count of the VMCALLs, the broadcasts and the invalidations and the time
+ * of both of the methods are shown
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The simulated memory and hooks
+ *
+ */
+#define TEST_HOOK_BATCH_NUMBER_OF_HOOKS       10000
+#define TEST_HOOK_BATCH_NUMBER_OF_DRIVERS     4
+#define TEST_HOOK_BATCH_MAXIMUM_BREAKPOINTS   40            // MaximumHiddenBreakpointsOnPage
+#define TEST_HOOK_BATCH_ENTRIES               512
+#define TEST_HOOK_BATCH_DRIVERS_BASE          0xfffff80000000000ull
+#define TEST_HOOK_BATCH_DRIVER_SIZE           0x1000000ull  // Virtual size of each driver
+#define TEST_HOOK_BATCH_PHYSICAL_POOL_SIZE    0x4000000ull  // The physical pages of each driver are in a 64 MB pool
+#define TEST_HOOK_BATCH_FAKE_PAGES_BASE       0x7000000000ull
+#define TEST_HOOK_BATCH_ENTRY_READ_WRITE_EXEC 0x7ull
+#define TEST_HOOK_BATCH_ENTRY_EXEC            0x4ull
+#define TEST_HOOK_BATCH_ENTRY_WRITE_BACK      (6ull << 3)
+#define TEST_HOOK_BATCH_ENTRY_ADDRESS         0x000ffffffffff000ull
+
+/**
+ * @brief A simulated hooked page (EPT_HOOKED_PAGE_DETAIL)
+ *
+ */
+typedef struct _TEST_HOOK_BATCH_HOOKED_PAGE
+{
+    UINT64         PhysicalBaseAddress;
+    UINT64         OriginalEntry;
+    UINT64         ChangedEntry;
+    vector<UINT64> BreakpointAddresses;
+    vector<UINT8>  PreviousBytes;
+    vector<UINT8>  FakePageContents;
+
+} TEST_HOOK_BATCH_HOOKED_PAGE, *PTEST_HOOK_BATCH_HOOKED_PAGE;
+
+/**
+ * @brief The simulated hypervisor
+ *
+ */
+typedef struct _TEST_HOOK_BATCH_STATE
+{
+    UINT32                                NumberOfCores;
+    vector<map<UINT64, vector<UINT64>>>   SplitPages;  // The PML1 entries of the split 2 MB pages of each core
+    vector<PTEST_HOOK_BATCH_HOOKED_PAGE>  HookedPages; // The list of the hooked pages (the head is the last one)
+    UINT64                                FakePages;
+    UINT64                                Vmcalls;
+    UINT64                                Broadcasts;
+    UINT64                                Invalidations;
+
+} TEST_HOOK_BATCH_STATE, *PTEST_HOOK_BATCH_STATE;
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestHookBatchRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief The simulated contents of the physical memory
+ *
+ * @param PhysicalAddress
+ *
+ * @return UINT8
+ */
+static UINT8
+TestHookBatchReadPhysical(UINT64 PhysicalAddress)
+{
+    return (UINT8)((PhysicalAddress * 0x9e3779b97f4a7c15ull) >> 56);
+}
+
+/**
+ * @brief Initialize the simulated hypervisor
+ *
+ * @param State
+ * @param NumberOfCores
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchInitialize(PTEST_HOOK_BATCH_STATE State, UINT32 NumberOfCores)
+{
+    State->NumberOfCores = NumberOfCores;
+    State->SplitPages.assign(NumberOfCores, map<UINT64, vector<UINT64>>());
+    State->HookedPages.clear();
+    State->FakePages     = 0;
+    State->Vmcalls       = 0;
+    State->Broadcasts    = 0;
+    State->Invalidations = 0;
+}
+
+/**
+ * @brief Release the hooked pages of the simulated hypervisor
+ *
+ * @param State
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchUninitialize(PTEST_HOOK_BATCH_STATE State)
+{
+    for (auto HookedPage : State->HookedPages)
+    {
+        delete HookedPage;
+    }
+
+    State->HookedPages.clear();
+}
+
+/**
+ * @brief Broadcast a VMCALL to all of the cores (KeGenericCallDpc)
+ *
+ * @param State
+ * @param Invalidate Whether each core invalidates its EPT
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchBroadcast(PTEST_HOOK_BATCH_STATE State, BOOLEAN Invalidate)
+{
+    State->Broadcasts++;
+    State->Vmcalls += State->NumberOfCores;
+
+    if (Invalidate)
+    {
+        State->Invalidations += State->NumberOfCores;
+    }
+}
+
+/**
+ * @brief Split a 2 MB page of a core (EptSplitLargePage)
+ *
+ * @param State
+ * @param Core
+ * @param PhysicalAddress
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchSplit(PTEST_HOOK_BATCH_STATE State, UINT32 Core, UINT64 PhysicalAddress)
+{
+    UINT64 LargePage = PhysicalAddress & ~(HOOK_BATCH_LARGE_PAGE_SIZE - 1);
+
+    if (State->SplitPages[Core].count(LargePage))
+    {
+        return;
+    }
+
+    vector<UINT64> & Entries = State->SplitPages[Core][LargePage];
+
+    Entries.resize(TEST_HOOK_BATCH_ENTRIES);
+
+    for (UINT32 i = 0; i < TEST_HOOK_BATCH_ENTRIES; i++)
+    {
+        Entries[i] = (LargePage + i * HOOK_BATCH_PAGE_SIZE) | TEST_HOOK_BATCH_ENTRY_WRITE_BACK | TEST_HOOK_BATCH_ENTRY_READ_WRITE_EXEC;
+    }
+}
+
+/**
+ * @brief Get the PML1 entry of a split page of a core (EptGetPml1Entry)
+ *
+ * @param State
+ * @param Core
+ * @param PhysicalAddress
+ *
+ * @return UINT64 *
+ */
+static UINT64 *
+TestHookBatchGetPml1Entry(PTEST_HOOK_BATCH_STATE State, UINT32 Core, UINT64 PhysicalAddress)
+{
+    auto Iterator = State->SplitPages[Core].find(PhysicalAddress & ~(HOOK_BATCH_LARGE_PAGE_SIZE - 1));
+
+    if (Iterator == State->SplitPages[Core].end())
+    {
+        return NULL;
+    }
+
+    return &Iterator->second[(PhysicalAddress & (HOOK_BATCH_LARGE_PAGE_SIZE - 1)) / HOOK_BATCH_PAGE_SIZE];
+}
+
+/**
+ * @brief Find a hooked page by walking the list (EptHookFindByPhysAddress)
+ *
+ * @param State
+ * @param PhysicalBaseAddress
+ *
+ * @return PTEST_HOOK_BATCH_HOOKED_PAGE
+ */
+static PTEST_HOOK_BATCH_HOOKED_PAGE
+TestHookBatchFindByPhysAddress(PTEST_HOOK_BATCH_STATE State, UINT64 PhysicalBaseAddress)
+{
+    for (size_t i = State->HookedPages.size(); i-- > 0;)
+    {
+        if (State->HookedPages[i]->PhysicalBaseAddress == PhysicalBaseAddress)
+        {
+            return State->HookedPages[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Add a breakpoint to the fake page (EptHookUpdateHookPage)
+ *
+ * @param HookedPage
+ * @param VirtualAddress
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchAddBreakpoint(PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage, UINT64 VirtualAddress)
+{
+    UINT8 * Byte = &HookedPage->FakePageContents[VirtualAddress & (HOOK_BATCH_PAGE_SIZE - 1)];
+
+    HookedPage->BreakpointAddresses.push_back(VirtualAddress);
+    HookedPage->PreviousBytes.push_back(*Byte);
+
+    *Byte = 0xcc;
+}
+
+/**
+ * @brief Create a hooked page (its fake page is a copy of the page)
+ *
+ * @param State
+ * @param PhysicalBaseAddress
+ *
+ * @return PTEST_HOOK_BATCH_HOOKED_PAGE
+ */
+static PTEST_HOOK_BATCH_HOOKED_PAGE
+TestHookBatchNewHookedPage(PTEST_HOOK_BATCH_STATE State, UINT64 PhysicalBaseAddress)
+{
+    PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage = new TEST_HOOK_BATCH_HOOKED_PAGE;
+
+    HookedPage->PhysicalBaseAddress = PhysicalBaseAddress;
+    HookedPage->FakePageContents.resize(HOOK_BATCH_PAGE_SIZE);
+
+    for (UINT64 i = 0; i < HOOK_BATCH_PAGE_SIZE; i++)
+    {
+        HookedPage->FakePageContents[i] = TestHookBatchReadPhysical(PhysicalBaseAddress + i);
+    }
+
+    HookedPage->OriginalEntry = PhysicalBaseAddress | TEST_HOOK_BATCH_ENTRY_WRITE_BACK | TEST_HOOK_BATCH_ENTRY_READ_WRITE_EXEC;
+    HookedPage->ChangedEntry  = (TEST_HOOK_BATCH_FAKE_PAGES_BASE + State->FakePages++ * HOOK_BATCH_PAGE_SIZE) |
+                               TEST_HOOK_BATCH_ENTRY_WRITE_BACK | TEST_HOOK_BATCH_ENTRY_EXEC;
+
+    return HookedPage;
+}
+
+/**
+ * @brief Install a hidden breakpoint (EptHookPerformHook)
+ *
+ * @param State
+ * @param Target
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchInstallSingle(PTEST_HOOK_BATCH_STATE State, const HOOK_BATCH_TARGET * Target)
+{
+    PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage;
+    UINT64                       PhysicalBaseAddress = Target->PhysicalAddress & ~(HOOK_BATCH_PAGE_SIZE - 1);
+
+    //
+    // Enable the #BP vm-exits on all cores and the VMCALL of the hook
+    //
+    TestHookBatchBroadcast(State, FALSE);
+    State->Vmcalls++;
+
+    HookedPage = TestHookBatchFindByPhysAddress(State, PhysicalBaseAddress);
+
+    if (HookedPage != NULL)
+    {
+        if (HookedPage->BreakpointAddresses.size() >= TEST_HOOK_BATCH_MAXIMUM_BREAKPOINTS)
+        {
+            return FALSE;
+        }
+
+        TestHookBatchAddBreakpoint(HookedPage, Target->VirtualAddress);
+
+        return TRUE;
+    }
+
+    HookedPage = TestHookBatchNewHookedPage(State, PhysicalBaseAddress);
+
+    TestHookBatchAddBreakpoint(HookedPage, Target->VirtualAddress);
+
+    State->HookedPages.push_back(HookedPage);
+
+    for (UINT32 Core = 0; Core < State->NumberOfCores; Core++)
+    {
+        TestHookBatchSplit(State, Core, PhysicalBaseAddress);
+
+        *TestHookBatchGetPml1Entry(State, Core, PhysicalBaseAddress) = HookedPage->ChangedEntry;
+    }
+
+    //
+    // The current core is invalidated in the VMCALL and the others by a broadcast
+    //
+    State->Invalidations++;
+    TestHookBatchBroadcast(State, TRUE);
+
+    return TRUE;
+}
+
+/**
+ * @brief Install a batch of hidden breakpoints (EptHookBatch and
+ * EptHookPerformPageHookBatch)
+ *
+ * @param State
+ * @param Targets
+ * @param NumberOfTargets
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchInstallBatch(PTEST_HOOK_BATCH_STATE State, PHOOK_BATCH_TARGET Targets, UINT32 NumberOfTargets)
+{
+    vector<HOOK_BATCH_PAGE>              Pages(NumberOfTargets);
+    vector<UINT64>                       LargePages(NumberOfTargets);
+    vector<PTEST_HOOK_BATCH_HOOKED_PAGE> HookedPages;
+    vector<BOOLEAN>                      IsNewPage;
+    UINT32                               NumberOfPages;
+    UINT32                               NumberOfLargePages;
+    UINT32                               PageIndex;
+
+    NumberOfTargets    = HookBatchSortTargets(Targets, NumberOfTargets);
+    NumberOfPages      = HookBatchGroupByPage(Targets, NumberOfTargets, Pages.data());
+    NumberOfLargePages = HookBatchGetAlignedPages(Pages.data(), NumberOfPages, HOOK_BATCH_LARGE_PAGE_SIZE, LargePages.data());
+
+    TestHookBatchBroadcast(State, FALSE);
+    State->Vmcalls++;
+
+    //
+    // A single walk over the list
+    //
+    HookedPages.assign(NumberOfPages, NULL);
+    IsNewPage.assign(NumberOfPages, FALSE);
+
+    for (size_t i = State->HookedPages.size(); i-- > 0;)
+    {
+        PageIndex = HookBatchFindPage(Pages.data(), NumberOfPages, State->HookedPages[i]->PhysicalBaseAddress);
+
+        if (PageIndex != NumberOfPages && HookedPages[PageIndex] == NULL)
+        {
+            HookedPages[PageIndex] = State->HookedPages[i];
+        }
+    }
+
+    for (UINT32 i = 0; i < NumberOfPages; i++)
+    {
+        if ((HookedPages[i] != NULL ? HookedPages[i]->BreakpointAddresses.size() : 0) + Pages[i].NumberOfTargets > TEST_HOOK_BATCH_MAXIMUM_BREAKPOINTS)
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 Core = 0; Core < State->NumberOfCores; Core++)
+    {
+        for (UINT32 i = 0; i < NumberOfLargePages; i++)
+        {
+            TestHookBatchSplit(State, Core, LargePages[i]);
+        }
+    }
+
+    for (UINT32 i = 0; i < NumberOfPages; i++)
+    {
+        if (HookedPages[i] == NULL)
+        {
+            HookedPages[i] = TestHookBatchNewHookedPage(State, Pages[i].PhysicalBaseAddress);
+            IsNewPage[i]   = TRUE;
+        }
+
+        for (UINT32 Target = Pages[i].FirstTarget; Target < Pages[i].FirstTarget + Pages[i].NumberOfTargets; Target++)
+        {
+            TestHookBatchAddBreakpoint(HookedPages[i], Targets[Target].VirtualAddress);
+        }
+
+        if (IsNewPage[i])
+        {
+            State->HookedPages.push_back(HookedPages[i]);
+        }
+    }
+
+    for (UINT32 Core = 0; Core < State->NumberOfCores; Core++)
+    {
+        for (UINT32 i = 0; i < NumberOfPages; i++)
+        {
+            if (IsNewPage[i])
+            {
+                *TestHookBatchGetPml1Entry(State, Core, Pages[i].PhysicalBaseAddress) = HookedPages[i]->ChangedEntry;
+            }
+        }
+    }
+
+    State->Invalidations++;
+    TestHookBatchBroadcast(State, TRUE);
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove a breakpoint from a hooked page that has other breakpoints
+ * (EptHookUnHookSingleAddressHiddenBreakpoint)
+ *
+ * @param HookedPage
+ * @param Index
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchRemoveBreakpoint(PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage, size_t Index)
+{
+    UINT64 VirtualAddress = HookedPage->BreakpointAddresses[Index];
+
+    if (count(HookedPage->BreakpointAddresses.begin(), HookedPage->BreakpointAddresses.end(), VirtualAddress) == 1)
+    {
+        HookedPage->FakePageContents[VirtualAddress & (HOOK_BATCH_PAGE_SIZE - 1)] = HookedPage->PreviousBytes[Index];
+    }
+
+    HookedPage->BreakpointAddresses.erase(HookedPage->BreakpointAddresses.begin() + Index);
+    HookedPage->PreviousBytes.erase(HookedPage->PreviousBytes.begin() + Index);
+}
+
+/**
+ * @brief Remove a hooked page and restore its entries on all of the cores
+ *
+ * @param State
+ * @param HookedPage
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchRemovePage(PTEST_HOOK_BATCH_STATE State, PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage)
+{
+    for (UINT32 Core = 0; Core < State->NumberOfCores; Core++)
+    {
+        *TestHookBatchGetPml1Entry(State, Core, HookedPage->PhysicalBaseAddress) = HookedPage->OriginalEntry;
+    }
+
+    State->HookedPages.erase(find(State->HookedPages.begin(), State->HookedPages.end(), HookedPage));
+
+    delete HookedPage;
+}
+
+/**
+ * @brief Check whether there is any hidden breakpoint (EptHookGetCountOfEpthooks)
+ *
+ * @param State
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchHasHooks(PTEST_HOOK_BATCH_STATE State)
+{
+    return !State->HookedPages.empty();
+}
+
+/**
+ * @brief Remove a hidden breakpoint (EptHookUnHookSingleAddress)
+ *
+ * @param State
+ * @param VirtualAddress
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchUnHookSingle(PTEST_HOOK_BATCH_STATE State, UINT64 VirtualAddress)
+{
+    for (size_t i = State->HookedPages.size(); i-- > 0;)
+    {
+        PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage = State->HookedPages[i];
+
+        for (size_t j = 0; j < HookedPage->BreakpointAddresses.size(); j++)
+        {
+            if (HookedPage->BreakpointAddresses[j] != VirtualAddress)
+            {
+                continue;
+            }
+
+            if (HookedPage->BreakpointAddresses.size() != 1)
+            {
+                TestHookBatchRemoveBreakpoint(HookedPage, j);
+                return TRUE;
+            }
+
+            //
+            // A broadcast to restore the entry and invalidate each core
+            //
+            TestHookBatchBroadcast(State, TRUE);
+            TestHookBatchRemovePage(State, HookedPage);
+
+            if (!TestHookBatchHasHooks(State))
+            {
+                TestHookBatchBroadcast(State, FALSE);
+            }
+
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Remove a batch of hidden breakpoints (EptHookUnHookBatch)
+ *
+ * @param State
+ * @param VirtualAddresses
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchUnHookBatch(PTEST_HOOK_BATCH_STATE State, vector<UINT64> & VirtualAddresses)
+{
+    vector<HOOK_BATCH_TARGET>            Targets(VirtualAddresses.size());
+    vector<PTEST_HOOK_BATCH_HOOKED_PAGE> RemovedPages;
+    UINT32                               NumberOfTargets;
+    size_t                               CountOfMatches;
+    BOOLEAN                              AtLeastOneUnhooked = FALSE;
+
+    for (size_t i = 0; i < VirtualAddresses.size(); i++)
+    {
+        Targets[i].VirtualAddress  = VirtualAddresses[i];
+        Targets[i].PhysicalAddress = 0;
+    }
+
+    NumberOfTargets = HookBatchSortTargets(Targets.data(), (UINT32)Targets.size());
+
+    for (size_t i = State->HookedPages.size(); i-- > 0;)
+    {
+        PTEST_HOOK_BATCH_HOOKED_PAGE HookedPage = State->HookedPages[i];
+
+        CountOfMatches = 0;
+
+        for (auto Address : HookedPage->BreakpointAddresses)
+        {
+            if (HookBatchFindTarget(Targets.data(), NumberOfTargets, 0, Address))
+            {
+                CountOfMatches++;
+            }
+        }
+
+        if (CountOfMatches == 0)
+        {
+            continue;
+        }
+
+        AtLeastOneUnhooked = TRUE;
+
+        if (CountOfMatches == HookedPage->BreakpointAddresses.size())
+        {
+            RemovedPages.push_back(HookedPage);
+            continue;
+        }
+
+        for (size_t j = 0; j < HookedPage->BreakpointAddresses.size();)
+        {
+            if (HookBatchFindTarget(Targets.data(), NumberOfTargets, 0, HookedPage->BreakpointAddresses[j]))
+            {
+                TestHookBatchRemoveBreakpoint(HookedPage, j);
+            }
+            else
+            {
+                j++;
+            }
+        }
+    }
+
+    if (!RemovedPages.empty())
+    {
+        TestHookBatchBroadcast(State, TRUE);
+
+        for (auto HookedPage : RemovedPages)
+        {
+            TestHookBatchRemovePage(State, HookedPage);
+        }
+
+        if (!TestHookBatchHasHooks(State))
+        {
+            TestHookBatchBroadcast(State, FALSE);
+        }
+    }
+
+    return AtLeastOneUnhooked;
+}
+
+/**
+ * @brief Compare the hooked pages and the entries of the cores of two
+ * simulated hypervisors (the fake pages might be at different addresses)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchCompare(PTEST_HOOK_BATCH_STATE First, PTEST_HOOK_BATCH_STATE Second)
+{
+    map<UINT64, PTEST_HOOK_BATCH_HOOKED_PAGE> SecondPages;
+
+    if (First->HookedPages.size() != Second->HookedPages.size())
+    {
+        return FALSE;
+    }
+
+    for (auto HookedPage : Second->HookedPages)
+    {
+        SecondPages[HookedPage->PhysicalBaseAddress] = HookedPage;
+    }
+
+    for (auto HookedPage : First->HookedPages)
+    {
+        auto Iterator = SecondPages.find(HookedPage->PhysicalBaseAddress);
+
+        if (Iterator == SecondPages.end())
+        {
+            return FALSE;
+        }
+
+        PTEST_HOOK_BATCH_HOOKED_PAGE Other = Iterator->second;
+        multiset<UINT64>             Addresses(HookedPage->BreakpointAddresses.begin(), HookedPage->BreakpointAddresses.end());
+        multiset<UINT64>             OtherAddresses(Other->BreakpointAddresses.begin(), Other->BreakpointAddresses.end());
+
+        if (Addresses != OtherAddresses || HookedPage->FakePageContents != Other->FakePageContents ||
+            HookedPage->OriginalEntry != Other->OriginalEntry)
+        {
+            return FALSE;
+        }
+
+        for (UINT32 Core = 0; Core < First->NumberOfCores; Core++)
+        {
+            if (*TestHookBatchGetPml1Entry(First, Core, HookedPage->PhysicalBaseAddress) != HookedPage->ChangedEntry ||
+                *TestHookBatchGetPml1Entry(Second, Core, HookedPage->PhysicalBaseAddress) != Other->ChangedEntry)
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    //
+    // The entries of the pages that are not hooked are the identity map
+    //
+    for (auto State : {First, Second})
+    {
+        for (UINT32 Core = 0; Core < State->NumberOfCores; Core++)
+        {
+            for (auto & SplitPage : State->SplitPages[Core])
+            {
+                for (UINT32 i = 0; i < TEST_HOOK_BATCH_ENTRIES; i++)
+                {
+                    UINT64 PhysicalBaseAddress = SplitPage.first + i * HOOK_BATCH_PAGE_SIZE;
+
+                    if (SecondPages.count(PhysicalBaseAddress) == 0 &&
+                        SplitPage.second[i] != (PhysicalBaseAddress | TEST_HOOK_BATCH_ENTRY_WRITE_BACK | TEST_HOOK_BATCH_ENTRY_READ_WRITE_EXEC))
+                    {
+                        return FALSE;
+                    }
+                }
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Generate the hooks on the exports of the drivers (the physical
+ * pages of each driver are random pages of a pool)
+ *
+ * @param Targets
+ *
+ * @return VOID
+ */
+static VOID
+TestHookBatchGenerateTargets(vector<HOOK_BATCH_TARGET> & Targets)
+{
+    UINT64              Seed = 0x42415443;
+    map<UINT64, UINT64> Translations;
+
+    for (UINT32 i = 0; i < TEST_HOOK_BATCH_NUMBER_OF_HOOKS; i++)
+    {
+        HOOK_BATCH_TARGET Target;
+        UINT32            Driver  = i % TEST_HOOK_BATCH_NUMBER_OF_DRIVERS;
+        UINT64            Export  = i / TEST_HOOK_BATCH_NUMBER_OF_DRIVERS;
+        UINT64            Address = TEST_HOOK_BATCH_DRIVERS_BASE + Driver * TEST_HOOK_BATCH_DRIVER_SIZE + 0x1000 + Export * 0x2d0 + (TestHookBatchRandom(&Seed) % 0x40) * 0x4;
+        UINT64            Page    = Address & ~(HOOK_BATCH_PAGE_SIZE - 1);
+
+        if (Translations.count(Page) == 0)
+        {
+            Translations[Page] = 0x100000000ull * (Driver + 1) + (TestHookBatchRandom(&Seed) % (TEST_HOOK_BATCH_PHYSICAL_POOL_SIZE / HOOK_BATCH_PAGE_SIZE)) * HOOK_BATCH_PAGE_SIZE;
+        }
+
+        Target.VirtualAddress  = Address;
+        Target.PhysicalAddress = Translations[Page] + (Address & (HOOK_BATCH_PAGE_SIZE - 1));
+
+        Targets.push_back(Target);
+    }
+}
+
+/**
+ * @brief Compare the methods for a count of the cores
+ *
+ * @param NumberOfCores
+ * @param Targets
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestHookBatchCompareMethods(UINT32 NumberOfCores, vector<HOOK_BATCH_TARGET> & Targets)
+{
+    TEST_HOOK_BATCH_STATE     Single;
+    TEST_HOOK_BATCH_STATE     Batch;
+    vector<HOOK_BATCH_TARGET> BatchTargets;
+    vector<UINT64>            Addresses;
+    double                    SingleTime;
+    double                    BatchTime;
+    BOOLEAN                   Result = FALSE;
+
+    TestHookBatchInitialize(&Single, NumberOfCores);
+    TestHookBatchInitialize(&Batch, NumberOfCores);
+
+    //
+    // Install the hooks
+    //
+    auto Start = chrono::steady_clock::now();
+
+    for (auto & Target : Targets)
+    {
+        if (!TestHookBatchInstallSingle(&Single, &Target))
+        {
+            printf("[-] the hook of 0x%llx is not installed\n", Target.VirtualAddress);
+            goto Cleanup;
+        }
+    }
+
+    SingleTime = chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+
+    BatchTargets = Targets;
+    Start        = chrono::steady_clock::now();
+
+    if (!TestHookBatchInstallBatch(&Batch, BatchTargets.data(), (UINT32)BatchTargets.size()))
+    {
+        printf("[-] the batch is not installed\n");
+        goto Cleanup;
+    }
+
+    BatchTime = chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+
+    if (!TestHookBatchCompare(&Single, &Batch))
+    {
+        printf("[-] the hooks of the batch are not the same as the single hooks\n");
+        goto Cleanup;
+    }
+
+    printf("[*] %3u cores, install %5u hooks on %4u pages : one by one %6llu VMCALLs, %5llu broadcasts, %7llu INVEPTs in %7.2f ms; "
+           "batch %4llu VMCALLs, %llu broadcasts, %4llu INVEPTs in %5.2f ms\n",
+           NumberOfCores,
+           (UINT32)Targets.size(),
+           (UINT32)Batch.HookedPages.size(),
+           Single.Vmcalls,
+           Single.Broadcasts,
+           Single.Invalidations,
+           SingleTime,
+           Batch.Vmcalls,
+           Batch.Broadcasts,
+           Batch.Invalidations,
+           BatchTime);
+
+    //
+    // A batch that doesn't fit in a page changes nothing
+    //
+    {
+        vector<HOOK_BATCH_TARGET> Overflow(Targets.begin(), Targets.begin() + 100);
+        UINT64                    FakePages = Batch.FakePages;
+
+        for (UINT32 i = 0; i < TEST_HOOK_BATCH_MAXIMUM_BREAKPOINTS; i++)
+        {
+            Overflow.push_back({Targets[0].VirtualAddress + i + 1, Targets[0].PhysicalAddress + i + 1});
+        }
+
+        if (TestHookBatchInstallBatch(&Batch, Overflow.data(), (UINT32)Overflow.size()) || FakePages != Batch.FakePages ||
+            !TestHookBatchCompare(&Single, &Batch))
+        {
+            printf("[-] the failed batch changed the hooks\n");
+            goto Cleanup;
+        }
+    }
+
+    //
+    // Remove half of the hooks (the pages keep the other breakpoints or are removed)
+    //
+    for (size_t i = 0; i < Targets.size(); i += 2)
+    {
+        Addresses.push_back(Targets[i].VirtualAddress);
+    }
+
+    Single.Vmcalls = Single.Broadcasts = Single.Invalidations = 0;
+    Batch.Vmcalls = Batch.Broadcasts = Batch.Invalidations = 0;
+
+    Start = chrono::steady_clock::now();
+
+    for (auto Address : Addresses)
+    {
+        TestHookBatchUnHookSingle(&Single, Address);
+    }
+
+    SingleTime = chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+    Start      = chrono::steady_clock::now();
+
+    TestHookBatchUnHookBatch(&Batch, Addresses);
+
+    BatchTime = chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+
+    if (!TestHookBatchCompare(&Single, &Batch))
+    {
+        printf("[-] the hooks are not the same after removing the batch\n");
+        goto Cleanup;
+    }
+
+    printf("[*] %3u cores, remove  %5u hooks             : one by one %6llu VMCALLs, %5llu broadcasts, %7llu INVEPTs in %7.2f ms; "
+           "batch %4llu VMCALLs, %llu broadcasts, %4llu INVEPTs in %5.2f ms\n",
+           NumberOfCores,
+           (UINT32)Addresses.size(),
+           Single.Vmcalls,
+           Single.Broadcasts,
+           Single.Invalidations,
+           SingleTime,
+           Batch.Vmcalls,
+           Batch.Broadcasts,
+           Batch.Invalidations,
+           BatchTime);
+
+    //
+    // Remove the rest of the hooks, all of the entries are restored
+    //
+    Addresses.clear();
+
+    for (auto & Target : Targets)
+    {
+        Addresses.push_back(Target.VirtualAddress);
+    }
+
+    if (!TestHookBatchUnHookBatch(&Batch, Addresses) || !Batch.HookedPages.empty())
+    {
+        printf("[-] the hooks are not removed\n");
+        goto Cleanup;
+    }
+
+    TestHookBatchUninitialize(&Single);
+    TestHookBatchInitialize(&Single, NumberOfCores);
+
+    Result = TestHookBatchCompare(&Single, &Batch);
+
+    if (!Result)
+    {
+        printf("[-] the entries are not restored\n");
+    }
+
+Cleanup:
+    TestHookBatchUninitialize(&Single);
+    TestHookBatchUninitialize(&Batch);
+
+    return Result;
+}
+
+/**
+ * @brief Test the batches of EPT hooks
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestHookBatch()
+{
+    vector<HOOK_BATCH_TARGET> Targets;
+    UINT32                    CoreCounts[] = {4, 16, 64};
+
+    TestHookBatchGenerateTargets(Targets);
+
+    for (auto NumberOfCores : CoreCounts)
+    {
+        if (!TestHookBatchCompareMethods(NumberOfCores, Targets))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
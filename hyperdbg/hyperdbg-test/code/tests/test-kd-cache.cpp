@@ -0,0 +1,512 @@
+/**
+ * @file test-kd-cache.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the debugger-side cache of the halted debuggee
+ * @details A typical session is replayed against a simulated debuggee and
+ * the number of the serial round-trips is compared
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the times that the session is replayed (each replay
+ * is a separate pause of the debuggee)
+ *
+ */
+#define TEST_KD_CACHE_NUMBER_OF_PAUSES 50
+
+/**
+ * @brief The stack window of the pause prefetch in the test
+ *
+ */
+#define TEST_KD_CACHE_STACK_WINDOW 0x200
+
+/**
+ * @brief The code window of the pause prefetch in the test
+ *
+ */
+#define TEST_KD_CACHE_CODE_WINDOW 0x40
+
+/**
+ * @brief The simulated debuggee and the debugger that talks to it
+ *
+ */
+typedef struct _TEST_KD_CACHE_SESSION
+{
+    std::map<UINT64, BYTE> WrittenBytes; // The bytes that are changed by the debugger
+    GUEST_REGS             Regs;
+    GUEST_EXTRA_REGISTERS  ExtraRegs;
+    UINT32                 Generation; // Changed on each pause, so the memory and registers differ
+    UINT32                 RoundTrips;
+    BOOLEAN                IsPrefetchEnabled;
+    BOOLEAN                HasError;
+    KD_CACHE               Cache;
+
+} TEST_KD_CACHE_SESSION, *PTEST_KD_CACHE_SESSION;
+
+/**
+ * @brief A byte of the memory of the simulated debuggee
+ *
+ * @param Session
+ * @param Address
+ *
+ * @return BYTE
+ */
+static BYTE
+TestKdCacheDebuggeeByte(PTEST_KD_CACHE_SESSION Session, UINT64 Address)
+{
+    auto Written = Session->WrittenBytes.find(Address);
+
+    if (Written != Session->WrittenBytes.end())
+    {
+        return Written->second;
+    }
+
+    return (BYTE)((Address * 0x9e3779b1) >> 24) ^ (BYTE)Session->Generation;
+}
+
+/**
+ * @brief Read the memory of the simulated debuggee (a round-trip)
+ *
+ * @param Session
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return VOID
+ */
+static VOID
+TestKdCacheDebuggeeRead(PTEST_KD_CACHE_SESSION Session, UINT64 Address, BYTE * Buffer, UINT32 Size)
+{
+    Session->RoundTrips++;
+
+    for (UINT32 i = 0; i < Size; i++)
+    {
+        Buffer[i] = TestKdCacheDebuggeeByte(Session, Address + i);
+    }
+}
+
+/**
+ * @brief Send a request to the simulated debuggee, the cache is invalidated
+ * the same way as the debugger does before sending the request
+ *
+ * @param Session
+ * @param RequestedAction
+ *
+ * @return VOID
+ */
+static VOID
+TestKdCacheSendRequest(PTEST_KD_CACHE_SESSION Session, DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction)
+{
+    if (!KdCacheIsReadOnlyRequest(RequestedAction))
+    {
+        KdCacheInvalidate(&Session->Cache);
+    }
+
+    Session->RoundTrips++;
+}
+
+/**
+ * @brief Halt the simulated debuggee, the pause packet (and its prefetched
+ * state) is built the same way as the debuggee does
+ *
+ * @param Session
+ *
+ * @return VOID
+ */
+static VOID
+TestKdCacheDebuggeePause(PTEST_KD_CACHE_SESSION Session)
+{
+    std::vector<BYTE>             Packet(sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) + TEST_KD_CACHE_STACK_WINDOW + TEST_KD_CACHE_CODE_WINDOW);
+    PDEBUGGEE_KD_PAUSED_PREFETCH Prefetch = (PDEBUGGEE_KD_PAUSED_PREFETCH)Packet.data();
+
+    Session->Generation++;
+
+    Session->Regs.rax = 0x1122334455667788ull + Session->Generation;
+    Session->Regs.rsp = 0xfffff80012345f28ull - Session->Generation * 0x40;
+    Session->Regs.rbp = Session->Regs.rsp + 0x80;
+
+    Session->ExtraRegs.RIP    = 0xfffff80076540ff0ull + Session->Generation * 7;
+    Session->ExtraRegs.RFLAGS = 0x246;
+    Session->ExtraRegs.CS     = 0x10;
+    Session->ExtraRegs.SS     = 0x18;
+
+    KdCacheInvalidate(&Session->Cache);
+
+    if (!Session->IsPrefetchEnabled)
+    {
+        return;
+    }
+
+    Prefetch->HasRegisters    = TRUE;
+    Prefetch->Regs            = Session->Regs;
+    Prefetch->ExtraRegs       = Session->ExtraRegs;
+    Prefetch->StackAddress    = Session->Regs.rsp;
+    Prefetch->StackSize       = TEST_KD_CACHE_STACK_WINDOW;
+    Prefetch->CodeAddress     = Session->ExtraRegs.RIP;
+    Prefetch->CodeSize        = TEST_KD_CACHE_CODE_WINDOW;
+    Prefetch->CodeAddressMode = DEBUGGER_READ_ADDRESS_MODE_64_BIT;
+
+    for (UINT32 i = 0; i < TEST_KD_CACHE_STACK_WINDOW; i++)
+    {
+        Packet[sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) + i] = TestKdCacheDebuggeeByte(Session, Prefetch->StackAddress + i);
+    }
+
+    for (UINT32 i = 0; i < TEST_KD_CACHE_CODE_WINDOW; i++)
+    {
+        Packet[sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) + TEST_KD_CACHE_STACK_WINDOW + i] = TestKdCacheDebuggeeByte(Session, Prefetch->CodeAddress + i);
+    }
+
+    if (!KdCacheLoadPausePrefetch(&Session->Cache, Prefetch, (UINT32)Packet.size()))
+    {
+        printf("[-] the prefetched state of the pause is not loaded\n");
+        Session->HasError = TRUE;
+    }
+}
+
+/**
+ * @brief Read the memory of the halted debuggee through the cache (the
+ * same as reading memory in the debugger mode)
+ *
+ * @param Session
+ * @param Address
+ * @param Size
+ *
+ * @return VOID
+ */
+static VOID
+TestKdCacheReadMemory(PTEST_KD_CACHE_SESSION Session, UINT64 Address, UINT32 Size)
+{
+    std::vector<BYTE> Buffer(Size);
+    UINT64            FillAddress;
+    UINT32            FillSize;
+
+    if (!KdCacheReadMemory(&Session->Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, Address, Buffer.data(), Size))
+    {
+        if (Session->Cache.IsEnabled && KdCacheGetFillRange(Address, Size, &FillAddress, &FillSize))
+        {
+            std::vector<BYTE> FillBuffer(FillSize);
+
+            TestKdCacheDebuggeeRead(Session, FillAddress, FillBuffer.data(), FillSize);
+            KdCacheInsertMemory(&Session->Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, FillAddress, FillBuffer.data(), FillSize);
+        }
+
+        if (!KdCacheReadMemory(&Session->Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, Address, Buffer.data(), Size))
+        {
+            TestKdCacheDebuggeeRead(Session, Address, Buffer.data(), Size);
+            KdCacheInsertMemory(&Session->Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, Address, Buffer.data(), Size);
+        }
+    }
+
+    for (UINT32 i = 0; i < Size; i++)
+    {
+        if (Buffer[i] != TestKdCacheDebuggeeByte(Session, Address + i))
+        {
+            printf("[-] stale or wrong byte is read at %llx\n", Address + i);
+            Session->HasError = TRUE;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Read a register of the halted debuggee through the cache
+ *
+ * @param Session
+ * @param RegisterId
+ *
+ * @return UINT64
+ */
+static UINT64
+TestKdCacheReadRegister(PTEST_KD_CACHE_SESSION Session, UINT32 RegisterId)
+{
+    UINT64 Value = 0;
+
+    if (KdCacheGetRegister(&Session->Cache, RegisterId, &Value))
+    {
+        return Value;
+    }
+
+    //
+    // The debugger reads all of the registers, so they're cached
+    //
+    Session->RoundTrips++;
+    KdCacheSetRegisters(&Session->Cache, &Session->Regs, &Session->ExtraRegs);
+
+    switch (RegisterId)
+    {
+    case REGISTER_RAX:
+        return Session->Regs.rax;
+    case REGISTER_RSP:
+        return Session->Regs.rsp;
+    case REGISTER_RBP:
+        return Session->Regs.rbp;
+    case REGISTER_RIP:
+        return Session->ExtraRegs.RIP;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Replay a typical session of examining the halted debuggee
+ *
+ * @param Session
+ *
+ * @return VOID
+ */
+static VOID
+TestKdCacheReplaySession(PTEST_KD_CACHE_SESSION Session)
+{
+    UINT64 Rsp;
+    UINT64 Rip;
+
+    for (UINT32 i = 0; i < TEST_KD_CACHE_NUMBER_OF_PAUSES && !Session->HasError; i++)
+    {
+        TestKdCacheDebuggeePause(Session);
+
+        //
+        // r
+        //
+        TestKdCacheReadRegister(Session, REGISTER_RAX);
+        Rsp = TestKdCacheReadRegister(Session, REGISTER_RSP);
+        Rip = TestKdCacheReadRegister(Session, REGISTER_RIP);
+
+        if (Rsp != Session->Regs.rsp || Rip != Session->ExtraRegs.RIP)
+        {
+            printf("[-] wrong register is read from the cache\n");
+            Session->HasError = TRUE;
+        }
+
+        //
+        // k (the callstack is always computed on the debuggee)
+        //
+        TestKdCacheSendRequest(Session, DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_CALLSTACK);
+
+        //
+        // dq @rsp, dq @rsp+80, u @rip, u (the next instructions), db @rbp
+        //
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RSP), 0x80);
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RSP) + 0x80, 0x80);
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RIP), 0x20);
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RIP) + 0x20, 0x20);
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RBP), 0x40);
+
+        //
+        // eq @rsp (the write invalidates the cache and the next read
+        // should return the written bytes)
+        //
+        TestKdCacheSendRequest(Session, DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_EDIT_MEMORY);
+
+        for (UINT32 j = 0; j < 8; j++)
+        {
+            Session->WrittenBytes[Session->Regs.rsp + j] = (BYTE)(0xa0 + j + i);
+        }
+
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RSP), 0x80);
+
+        //
+        // dq @rsp (again)
+        //
+        TestKdCacheReadMemory(Session, TestKdCacheReadRegister(Session, REGISTER_RSP), 0x80);
+
+        //
+        // p (the debuggee continues and halts again)
+        //
+        TestKdCacheSendRequest(Session, DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_STEP);
+    }
+}
+
+/**
+ * @brief Test the corner cases of the cache
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestKdCacheCornerCases()
+{
+    static KD_CACHE                Cache  = {TRUE};
+    BYTE                           Buffer[NORMAL_PAGE_SIZE * 2] = {0};
+    BYTE                           Result[NORMAL_PAGE_SIZE * 2] = {0};
+    UINT64                         FillAddress;
+    UINT32                         FillSize;
+    UINT64                         Value;
+    GUEST_REGS                     Regs      = {0};
+    GUEST_EXTRA_REGISTERS          ExtraRegs = {0};
+    DEBUGGER_READ_MEMORY_ADDRESS_MODE AddressMode;
+    DEBUGGEE_KD_PAUSED_PREFETCH    Prefetch  = {0};
+    BOOLEAN                        OverallResult = TRUE;
+
+    for (UINT32 i = 0; i < sizeof(Buffer); i++)
+    {
+        Buffer[i] = (BYTE)(i * 7);
+    }
+
+    //
+    // The fill range is page-aligned and limited
+    //
+    if (!KdCacheGetFillRange(0x1ff8, 0x10, &FillAddress, &FillSize) || FillAddress != 0x1000 || FillSize != 0x2000 ||
+        KdCacheGetFillRange(0x1000, (KD_CACHE_MAXIMUM_FILL_PAGES * NORMAL_PAGE_SIZE) + 1, &FillAddress, &FillSize) ||
+        KdCacheGetFillRange(0xfffffffffffffff0ull, 0x20, &FillAddress, &FillSize) ||
+        KdCacheGetFillRange(0xfffffffffffff000ull, 0x10, &FillAddress, &FillSize))
+    {
+        printf("[-] wrong fill range\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Disjoint ranges of a page are not merged, the adjacent ones are
+    //
+    KdCacheInsertMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x5000, Buffer, 0x10);
+    KdCacheInsertMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x5100, Buffer + 0x100, 0x10);
+
+    if (KdCacheReadMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x5000, Result, 0x10) ||
+        KdCacheReadMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x5010, Result, 0x10))
+    {
+        printf("[-] bytes that are not read from the debuggee are served\n");
+        OverallResult = FALSE;
+    }
+
+    KdCacheInsertMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x5110, Buffer + 0x110, 0x10);
+
+    if (!KdCacheReadMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x5100, Result, 0x20) || memcmp(Result, Buffer + 0x100, 0x20))
+    {
+        printf("[-] adjacent ranges are not merged\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // A read that crosses the pages and the physical memory is cached separately
+    //
+    KdCacheInsertMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x7000, Buffer, sizeof(Buffer));
+
+    if (!KdCacheReadMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x7ff0, Result, 0x20) || memcmp(Result, Buffer + 0xff0, 0x20) ||
+        KdCacheReadMemory(&Cache, DEBUGGER_READ_PHYSICAL_ADDRESS, 0x7ff0, Result, 0x20))
+    {
+        printf("[-] wrong read across the pages\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Parts of the registers
+    //
+    Regs.rax         = 0x1122334455667788ull;
+    Regs.rsp         = 0xfffff80012345678ull;
+    ExtraRegs.RFLAGS = 0x10246;
+    ExtraRegs.RIP    = 0xfffff80087654321ull;
+
+    KdCacheSetRegisters(&Cache, &Regs, &ExtraRegs);
+
+    if (!KdCacheGetRegister(&Cache, REGISTER_AH, &Value) || Value != 0x77 ||
+        !KdCacheGetRegister(&Cache, REGISTER_AL, &Value) || Value != 0x88 ||
+        !KdCacheGetRegister(&Cache, REGISTER_EAX, &Value) || Value != 0x55667788 ||
+        !KdCacheGetRegister(&Cache, REGISTER_SPL, &Value) || Value != 0x78 ||
+        !KdCacheGetRegister(&Cache, REGISTER_FLAGS, &Value) || Value != 0x246 ||
+        !KdCacheGetRegister(&Cache, REGISTER_EIP, &Value) || Value != 0x87654321 ||
+        KdCacheGetRegister(&Cache, REGISTER_CR3, &Value))
+    {
+        printf("[-] wrong part of a register is read from the cache\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // The kernel addresses are always 64-bit, the user addresses are
+    // only known after the debuggee reports them
+    //
+    if (!KdCacheGetAddressMode(&Cache, 0xfffff80087654321ull, &AddressMode) || AddressMode != DEBUGGER_READ_ADDRESS_MODE_64_BIT ||
+        KdCacheGetAddressMode(&Cache, 0x401000, &AddressMode))
+    {
+        printf("[-] wrong address mode\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Nothing remains after the invalidation
+    //
+    KdCacheInvalidate(&Cache);
+
+    if (KdCacheReadMemory(&Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, 0x7000, Result, 0x10) ||
+        KdCacheGetRegister(&Cache, REGISTER_RAX, &Value))
+    {
+        printf("[-] the cache is not invalidated\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Malformed prefetched states are rejected
+    //
+    Prefetch.HasRegisters = TRUE;
+    Prefetch.StackSize    = 0x100;
+
+    if (KdCacheLoadPausePrefetch(&Cache, &Prefetch, sizeof(Prefetch) + 0x80) ||
+        KdCacheLoadPausePrefetch(&Cache, &Prefetch, sizeof(Prefetch) - 1))
+    {
+        printf("[-] a malformed prefetched state is loaded\n");
+        OverallResult = FALSE;
+    }
+
+    return OverallResult;
+}
+
+/**
+ * @brief Test the cache of the halted debuggee
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestKdCache()
+{
+    static TEST_KD_CACHE_SESSION Sessions[3] = {};
+    const CHAR *                 Names[3]    = {"no cache", "cache", "cache and pause prefetch"};
+    BOOLEAN                      OverallResult = TRUE;
+
+    if (!TestKdCacheCornerCases())
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // The same session without the cache, with the cache, and with the
+    // cache and the prefetched state of the pause
+    //
+    Sessions[0].Cache.IsEnabled = FALSE;
+    Sessions[1].Cache.IsEnabled = TRUE;
+    Sessions[2].Cache.IsEnabled = TRUE;
+    Sessions[2].IsPrefetchEnabled = TRUE;
+
+    for (UINT32 i = 0; i < 3; i++)
+    {
+        auto Start = std::chrono::high_resolution_clock::now();
+
+        TestKdCacheReplaySession(&Sessions[i]);
+
+        auto Duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - Start);
+
+        if (Sessions[i].HasError)
+        {
+            printf("[-] %s : the session is not replayed correctly\n", Names[i]);
+            OverallResult = FALSE;
+        }
+
+        printf("[*] %s : %u round-trips in %u pauses (%u per pause), hits: %llu, misses: %llu (%lld us)\n",
+               Names[i],
+               Sessions[i].RoundTrips,
+               TEST_KD_CACHE_NUMBER_OF_PAUSES,
+               Sessions[i].RoundTrips / TEST_KD_CACHE_NUMBER_OF_PAUSES,
+               Sessions[i].Cache.NumberOfHits,
+               Sessions[i].Cache.NumberOfMisses,
+               (long long)Duration.count());
+    }
+
+    if (Sessions[1].RoundTrips >= Sessions[0].RoundTrips || Sessions[2].RoundTrips >= Sessions[1].RoundTrips)
+    {
+        printf("[-] the cache doesn't reduce the round-trips\n");
+        OverallResult = FALSE;
+    }
+
+    return OverallResult;
+}
@@ -0,0 +1,330 @@
+/**
+ * @file test-lbr-decode.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the layouts and the formats of the Last Branch Records
+ * @details The dumps of the MSRs (TOS, FROM, TO, and INFO) of the different
+ * formats are decoded, the stacks are partially filled and wrapped around, and
+ * the flags are set in the top bits of the addresses (same as the processors
+ * set them)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief A filled entry of the dump of the MSRs (the other entries are zero)
+ *
+ */
+typedef struct _TEST_LBR_DECODE_ENTRY
+{
+    UINT32 Index;
+    UINT64 From;
+    UINT64 To;
+    UINT64 Info;
+
+} TEST_LBR_DECODE_ENTRY;
+
+/**
+ * @brief A dump of the MSRs and its expected records (the newest one first)
+ *
+ */
+typedef struct _TEST_LBR_DECODE_DUMP
+{
+    const char *          Name;
+    UINT32                Model;
+    UINT64                PerfCapabilities;
+    UINT64                Tos;
+    UINT32                NumberOfEntries;
+    TEST_LBR_DECODE_ENTRY Entries[8];
+    UINT32                NumberOfExpectedRecords;
+    LBR_DECODE_RECORD     ExpectedRecords[8];
+
+} TEST_LBR_DECODE_DUMP;
+
+/**
+ * @brief An expected layout
+ *
+ */
+typedef struct _TEST_LBR_DECODE_LAYOUT
+{
+    UINT32            Family;
+    UINT32            Model;
+    UINT64            PerfCapabilities;
+    BOOLEAN           IsKnown;
+    LBR_DECODE_LAYOUT Layout;
+
+} TEST_LBR_DECODE_LAYOUT;
+
+#define TEST_LBR_DECODE_KNOWN_FLAGS (LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN)
+#define TEST_LBR_DECODE_CYCLE_FLAGS (LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN | LBR_DECODE_RECORD_FLAG_CYCLES_VALID)
+
+/**
+ * @brief The dumps of the MSRs
+ *
+ */
+static const TEST_LBR_DECODE_DUMP TestLbrDecodeDumps[] = {
+    {
+        //
+        // The info MSRs hold the flags and the cycles
+        //
+        "skylake (format 5)",
+        0x5E,
+        0x33c5,
+        2,
+        5,
+        {
+            {0, 0xfffff8034a1b2c30, 0xfffff8034a1b2d00, 0x1000000000000011},
+            {1, 0xfffff8034a1b2d1a, 0xfffff8034a1c0040, 0x9000000000000123},
+            {2, 0x00007ff6123417e9, 0x00007ff612341000, 0x6000000000000000},
+            {30, 0xfffff8034a1b2a80, 0xfffff8034a1b2af0, 0x1000000000000002},
+            {31, 0xfffff8034a1b2b00, 0xfffff8034a1b2c20, 0x1000000000000005},
+        },
+        5,
+        {
+            {0x00007ff6123417e9, 0x00007ff612341000, 0, TEST_LBR_DECODE_KNOWN_FLAGS | LBR_DECODE_RECORD_FLAG_IN_TSX | LBR_DECODE_RECORD_FLAG_TSX_ABORT},
+            {0xfffff8034a1b2d1a, 0xfffff8034a1c0040, 0x123, TEST_LBR_DECODE_CYCLE_FLAGS | LBR_DECODE_RECORD_FLAG_MISPREDICTED},
+            {0xfffff8034a1b2c30, 0xfffff8034a1b2d00, 0x11, TEST_LBR_DECODE_CYCLE_FLAGS},
+            {0xfffff8034a1b2b00, 0xfffff8034a1b2c20, 5, TEST_LBR_DECODE_CYCLE_FLAGS},
+            {0xfffff8034a1b2a80, 0xfffff8034a1b2af0, 2, TEST_LBR_DECODE_CYCLE_FLAGS},
+        },
+    },
+    {
+        //
+        // The misprediction, in TSX, and TSX abort are the bits 63:61 of the sources
+        //
+        "haswell (format 4)",
+        0x3C,
+        0x31c4,
+        15,
+        4,
+        {
+            {0, 0xdffff8034a1b2000, 0xfffff8034a1b2100, 0},
+            {13, 0x00007ff6123417e9, 0x00007ff612341000, 0},
+            {14, 0x7ffff8034a1b2b10, 0xfffff8034a1b2c00, 0},
+            {15, 0x9ffff8034a1b2c30, 0xfffff8034a1b2d00, 0},
+        },
+        4,
+        {
+            {0xfffff8034a1b2c30, 0xfffff8034a1b2d00, 0, TEST_LBR_DECODE_KNOWN_FLAGS | LBR_DECODE_RECORD_FLAG_MISPREDICTED},
+            {0xfffff8034a1b2b10, 0xfffff8034a1b2c00, 0, TEST_LBR_DECODE_KNOWN_FLAGS | LBR_DECODE_RECORD_FLAG_IN_TSX | LBR_DECODE_RECORD_FLAG_TSX_ABORT},
+            {0x00007ff6123417e9, 0x00007ff612341000, 0, TEST_LBR_DECODE_KNOWN_FLAGS},
+            {0xfffff8034a1b2000, 0xfffff8034a1b2100, 0, TEST_LBR_DECODE_KNOWN_FLAGS | LBR_DECODE_RECORD_FLAG_MISPREDICTED | LBR_DECODE_RECORD_FLAG_IN_TSX},
+        },
+    },
+    {
+        //
+        // The misprediction is the bit 63 of the sources
+        //
+        "nehalem (format 3)",
+        0x1A,
+        0x1c3,
+        1,
+        4,
+        {
+            {0, 0x7ffff8034a1b2b10, 0xfffff8034a1b2c00, 0},
+            {1, 0xfffff8034a1b2c30, 0xfffff8034a1b2d00, 0},
+            {14, 0x80007ff612341200, 0x00007ff6123417c0, 0},
+            {15, 0x00007ff6123417e9, 0x00007ff612341000, 0},
+        },
+        4,
+        {
+            {0xfffff8034a1b2c30, 0xfffff8034a1b2d00, 0, TEST_LBR_DECODE_KNOWN_FLAGS | LBR_DECODE_RECORD_FLAG_MISPREDICTED},
+            {0xfffff8034a1b2b10, 0xfffff8034a1b2c00, 0, TEST_LBR_DECODE_KNOWN_FLAGS},
+            {0x00007ff6123417e9, 0x00007ff612341000, 0, TEST_LBR_DECODE_KNOWN_FLAGS},
+            {0x00007ff612341200, 0x00007ff6123417c0, 0, TEST_LBR_DECODE_KNOWN_FLAGS | LBR_DECODE_RECORD_FLAG_MISPREDICTED},
+        },
+    },
+    {
+        //
+        // The cycles are the bits 63:48 of the destinations
+        //
+        "goldmont plus (format 6)",
+        0x7A,
+        0x30c6,
+        0,
+        2,
+        {
+            {0, 0xfffff8034a1b2c30, 0x0042f8034a1b2d00, 0},
+            {31, 0x00007ff6123417e9, 0x00077ff612341000, 0},
+        },
+        2,
+        {
+            {0xfffff8034a1b2c30, 0xfffff8034a1b2d00, 0x42, TEST_LBR_DECODE_CYCLE_FLAGS | LBR_DECODE_RECORD_FLAG_MISPREDICTED},
+            {0x00007ff6123417e9, 0x00007ff612341000, 7, TEST_LBR_DECODE_CYCLE_FLAGS},
+        },
+    },
+    {
+        //
+        // Both of the addresses are in the FROM MSRs
+        //
+        "core 2 (format 0)",
+        0x17,
+        0,
+        3,
+        3,
+        {
+            {0, 0x0040100000402015, 0, 0},
+            {2, 0x77c1f0a077c1e123, 0, 0},
+            {3, 0x0040201000401005, 0, 0},
+        },
+        3,
+        {
+            {0x00401005, 0x00402010, 0, 0},
+            {0x77c1e123, 0x77c1f0a0, 0, 0},
+            {0x00402015, 0x00401000, 0, 0},
+        },
+    },
+};
+
+/**
+ * @brief The expected layouts
+ *
+ */
+static const TEST_LBR_DECODE_LAYOUT TestLbrDecodeLayouts[] = {
+    {6, 0x5E, 0x33c5, TRUE, {32, 0x680, 0x6c0, 0xdc0, 0x1c8, LBR_DECODE_FORMAT_INFO}},
+    {6, 0x3C, 0x31c4, TRUE, {16, 0x680, 0x6c0, 0, 0x1c8, LBR_DECODE_FORMAT_EIP_FLAGS2}},
+    {6, 0x57, 0x3, TRUE, {8, 0x680, 0x6c0, 0, 0x1c8, LBR_DECODE_FORMAT_EIP_FLAGS}},
+    {6, 0x37, 0x3, TRUE, {8, 0x40, 0x60, 0, 0x1c8, LBR_DECODE_FORMAT_EIP_FLAGS}},
+    {6, 0x1C, 0x0, TRUE, {8, 0x40, 0, 0, 0, LBR_DECODE_FORMAT_32}},
+    {6, 0x17, 0x0, TRUE, {4, 0x40, 0, 0, 0, LBR_DECODE_FORMAT_32}},
+    {6, 0x8F, 0x33c5, FALSE}, // The architectural LBRs
+    {6, 0x5E, 0x3f, FALSE},   // An unknown format
+    {15, 0x04, 0x0, FALSE},
+};
+
+/**
+ * @brief Compare the decoded records with the expected ones
+ *
+ * @param Dump
+ * @param Records
+ * @param NumberOfRecords
+ * @param NumberOfExpectedRecords
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestLbrDecodeCompare(const TEST_LBR_DECODE_DUMP * Dump,
+                     const LBR_DECODE_RECORD *    Records,
+                     UINT32                       NumberOfRecords,
+                     UINT32                       NumberOfExpectedRecords)
+{
+    if (NumberOfRecords != NumberOfExpectedRecords)
+    {
+        printf("[-] %s: %u records are decoded, %u records are expected\n", Dump->Name, NumberOfRecords, NumberOfExpectedRecords);
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < NumberOfRecords; i++)
+    {
+        const LBR_DECODE_RECORD * Expected = &Dump->ExpectedRecords[i];
+
+        if (Records[i].From != Expected->From ||
+            Records[i].To != Expected->To ||
+            Records[i].Cycles != Expected->Cycles ||
+            Records[i].Flags != Expected->Flags)
+        {
+            printf("[-] %s: record %u is %llx -> %llx (cycles: %x, flags: %x), expected %llx -> %llx (cycles: %x, flags: %x)\n",
+                   Dump->Name,
+                   i,
+                   Records[i].From,
+                   Records[i].To,
+                   Records[i].Cycles,
+                   Records[i].Flags,
+                   Expected->From,
+                   Expected->To,
+                   Expected->Cycles,
+                   Expected->Flags);
+
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the layouts and the formats of the Last Branch Records
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestLbrDecode()
+{
+    LBR_DECODE_LAYOUT Layout;
+    LBR_DECODE_RECORD Records[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT64            From[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT64            To[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT64            Info[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT32            NumberOfRecords;
+    BOOLEAN           IsKnown;
+
+    for (auto & Expected : TestLbrDecodeLayouts)
+    {
+        RtlZeroMemory(&Layout, sizeof(Layout));
+
+        IsKnown = LbrDecodeGetLayout(Expected.Family, Expected.Model, Expected.PerfCapabilities, &Layout);
+
+        if (IsKnown != Expected.IsKnown ||
+            (IsKnown && memcmp(&Layout, &Expected.Layout, sizeof(Layout)) != 0))
+        {
+            printf("[-] the layout of the family %x, model %x (capabilities: %llx) is not correct\n",
+                   Expected.Family,
+                   Expected.Model,
+                   Expected.PerfCapabilities);
+
+            return FALSE;
+        }
+    }
+
+    printf("[*] %llu layouts are checked\n", (UINT64)(sizeof(TestLbrDecodeLayouts) / sizeof(TestLbrDecodeLayouts[0])));
+
+    for (auto & Dump : TestLbrDecodeDumps)
+    {
+        if (!LbrDecodeGetLayout(6, Dump.Model, Dump.PerfCapabilities, &Layout))
+        {
+            printf("[-] %s: the model is not known\n", Dump.Name);
+            return FALSE;
+        }
+
+        //
+        // Fill the MSRs (the empty entries are zero)
+        //
+        RtlZeroMemory(From, sizeof(From));
+        RtlZeroMemory(To, sizeof(To));
+        RtlZeroMemory(Info, sizeof(Info));
+
+        for (UINT32 i = 0; i < Dump.NumberOfEntries; i++)
+        {
+            From[Dump.Entries[i].Index] = Dump.Entries[i].From;
+            To[Dump.Entries[i].Index]   = Dump.Entries[i].To;
+            Info[Dump.Entries[i].Index] = Dump.Entries[i].Info;
+        }
+
+        //
+        // All of the records
+        //
+        NumberOfRecords = LbrDecodeRecords(&Layout, Dump.Tos, From, To, Info, LBR_DECODE_MAXIMUM_ENTRIES, Records);
+
+        if (!TestLbrDecodeCompare(&Dump, Records, NumberOfRecords, Dump.NumberOfExpectedRecords))
+        {
+            return FALSE;
+        }
+
+        //
+        // Only the newest records (same as a snapshot of the last N branches)
+        //
+        NumberOfRecords = LbrDecodeRecords(&Layout, Dump.Tos, From, To, Info, 2, Records);
+
+        if (!TestLbrDecodeCompare(&Dump, Records, NumberOfRecords, 2))
+        {
+            return FALSE;
+        }
+
+        printf("[*] %s: %u records are decoded\n", Dump.Name, Dump.NumberOfExpectedRecords);
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,922 @@
+/**
+ * @file test-memory-access-emulator.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the decoder and emulator of the trapped memory accesses
+ * @details Random instructions of the supported forms are executed natively
+ * (by a thunk that loads the registers and the flags, executes the instruction
+ * and saves them) and emulated on a copy of the same memory, then the
+ * registers, the flags, the RIP and the memory of both are compared
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the random instructions
+ *
+ */
+#define TEST_MAE_NUMBER_OF_INSTRUCTIONS 50000
+
+/**
+ * @brief The thunk is in the first page and the data (that the memory
+ * operands point to) is in the second page of the allocation
+ *
+ */
+#define TEST_MAE_ALLOCATION_SIZE 0x2000
+#define TEST_MAE_DATA_OFFSET     0x1000
+#define TEST_MAE_DATA_SIZE       0x200
+#define TEST_MAE_DATA_MIDDLE     0x100
+
+/**
+ * @brief Kinds of the immediates of the templates
+ *
+ */
+#define TEST_MAE_IMMEDIATE_NONE 0
+#define TEST_MAE_IMMEDIATE_8    1
+#define TEST_MAE_IMMEDIATE_Z    2 // 16 or 32 bits based on the operand size
+
+/**
+ * @brief The registers and the flags that are loaded and saved by the thunk
+ *
+ */
+typedef struct _TEST_MAE_CONTEXT
+{
+    GUEST_REGS Regs;   // 0x00
+    UINT64     Rflags; // 0x80
+
+} TEST_MAE_CONTEXT, *PTEST_MAE_CONTEXT;
+
+/**
+ * @brief The native thunk (the context is passed in rcx)
+ *
+ */
+typedef VOID (*TEST_MAE_NATIVE_THUNK)(PTEST_MAE_CONTEXT Context);
+
+/**
+ * @brief The copy of the data that is accessed by the emulator
+ *
+ */
+typedef struct _TEST_MAE_MEMORY
+{
+    UINT64  NativeAddress; // The registers point to the native data
+    UINT8 * Buffer;
+    UINT32  Size;
+    UINT64  Limit;         // The accesses that reach this address fail
+
+} TEST_MAE_MEMORY, *PTEST_MAE_MEMORY;
+
+/**
+ * @brief A form of the supported instructions with a memory operand
+ *
+ */
+typedef struct _TEST_MAE_TEMPLATE
+{
+    const char * Name;
+    UINT8        Opcode[2];
+    UINT32       OpcodeLength;
+    INT32        Digit;         // ModRM.reg of the groups (or -1 for a register operand)
+    UINT32       ImmediateKind;
+    BOOLEAN      IsByte;        // The operand is always 8 bits
+    BOOLEAN      IsLockable;
+    BOOLEAN      IsLogical;     // The auxiliary carry flag is undefined
+    BOOLEAN      NeedsRexW;
+
+} TEST_MAE_TEMPLATE, *PTEST_MAE_TEMPLATE;
+
+/**
+ * @brief The forms of the instructions that are tested
+ *
+ */
+static const TEST_MAE_TEMPLATE TestMaeTemplates[] = {
+    {"mov r/m8, r8", {0x88}, 1, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, FALSE, FALSE, FALSE},
+    {"mov r/m, r", {0x89}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"mov r8, r/m8", {0x8a}, 1, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, FALSE, FALSE, FALSE},
+    {"mov r, r/m", {0x8b}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"mov r/m8, imm8", {0xc6}, 1, 0, TEST_MAE_IMMEDIATE_8, TRUE, FALSE, FALSE, FALSE},
+    {"mov r/m, imm", {0xc7}, 1, 0, TEST_MAE_IMMEDIATE_Z, FALSE, FALSE, FALSE, FALSE},
+    {"movzx r, r/m8", {0x0f, 0xb6}, 2, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"movzx r, r/m16", {0x0f, 0xb7}, 2, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"movsx r, r/m8", {0x0f, 0xbe}, 2, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"movsx r, r/m16", {0x0f, 0xbf}, 2, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"movsxd r64, r/m32", {0x63}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, TRUE},
+    {"add r/m8, r8", {0x00}, 1, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, TRUE, FALSE, FALSE},
+    {"add r/m, r", {0x01}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+    {"or r/m, r", {0x09}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, TRUE, FALSE},
+    {"and r/m8, r8", {0x20}, 1, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, TRUE, TRUE, FALSE},
+    {"sub r/m, r", {0x29}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+    {"xor r/m, r", {0x31}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, TRUE, FALSE},
+    {"cmp r/m8, r8", {0x38}, 1, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, FALSE, FALSE, FALSE},
+    {"cmp r/m, r", {0x39}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, FALSE, FALSE, FALSE},
+    {"add r/m8, imm8", {0x80}, 1, 0, TEST_MAE_IMMEDIATE_8, TRUE, TRUE, FALSE, FALSE},
+    {"or r/m, imm", {0x81}, 1, 1, TEST_MAE_IMMEDIATE_Z, FALSE, TRUE, TRUE, FALSE},
+    {"and r/m, imm8", {0x83}, 1, 4, TEST_MAE_IMMEDIATE_8, FALSE, TRUE, TRUE, FALSE},
+    {"sub r/m, imm", {0x81}, 1, 5, TEST_MAE_IMMEDIATE_Z, FALSE, TRUE, FALSE, FALSE},
+    {"xor r/m8, imm8", {0x80}, 1, 6, TEST_MAE_IMMEDIATE_8, TRUE, TRUE, TRUE, FALSE},
+    {"cmp r/m, imm8", {0x83}, 1, 7, TEST_MAE_IMMEDIATE_8, FALSE, FALSE, FALSE, FALSE},
+    {"inc r/m8", {0xfe}, 1, 0, TEST_MAE_IMMEDIATE_NONE, TRUE, TRUE, FALSE, FALSE},
+    {"inc r/m", {0xff}, 1, 0, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+    {"dec r/m", {0xff}, 1, 1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+    {"xchg r/m8, r8", {0x86}, 1, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, TRUE, FALSE, FALSE},
+    {"xchg r/m, r", {0x87}, 1, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+    {"xadd r/m, r", {0x0f, 0xc1}, 2, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+    {"cmpxchg r/m8, r8", {0x0f, 0xb0}, 2, -1, TEST_MAE_IMMEDIATE_NONE, TRUE, TRUE, FALSE, FALSE},
+    {"cmpxchg r/m, r", {0x0f, 0xb1}, 2, -1, TEST_MAE_IMMEDIATE_NONE, FALSE, TRUE, FALSE, FALSE},
+};
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestMaeRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief Check an access of the emulator and get its buffer
+ *
+ * @param Memory
+ * @param Address
+ * @param Size
+ *
+ * @return UINT8 *
+ */
+static UINT8 *
+TestMaeGetBuffer(PTEST_MAE_MEMORY Memory, UINT64 Address, UINT32 Size)
+{
+    if (Address < Memory->NativeAddress ||
+        Address + Size > Memory->NativeAddress + Memory->Size ||
+        Address + Size > Memory->Limit)
+    {
+        return NULL;
+    }
+
+    return Memory->Buffer + (Address - Memory->NativeAddress);
+}
+
+/**
+ * @brief Read callback of the emulator
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMaeRead(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context)
+{
+    UINT8 * Source = TestMaeGetBuffer((PTEST_MAE_MEMORY)Context, Address, Size);
+
+    if (Source == NULL)
+    {
+        return FALSE;
+    }
+
+    memcpy(Buffer, Source, Size);
+
+    return TRUE;
+}
+
+/**
+ * @brief Write callback of the emulator
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMaeWrite(UINT64 Address, const VOID * Buffer, UINT32 Size, PVOID Context)
+{
+    UINT8 * Destination = TestMaeGetBuffer((PTEST_MAE_MEMORY)Context, Address, Size);
+
+    if (Destination == NULL)
+    {
+        return FALSE;
+    }
+
+    memcpy(Destination, Buffer, Size);
+
+    return TRUE;
+}
+
+/**
+ * @brief Compare-exchange callback of the emulator (the test has only one
+ * thread, so it doesn't need to be atomic)
+ *
+ * @param Address
+ * @param Size
+ * @param Comparand
+ * @param NewValue
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMaeCompareExchange(UINT64 Address, UINT32 Size, UINT64 * Comparand, UINT64 NewValue, PVOID Context)
+{
+    UINT8 * Destination = TestMaeGetBuffer((PTEST_MAE_MEMORY)Context, Address, Size);
+    UINT64  Previous    = 0;
+
+    if (Destination == NULL)
+    {
+        return FALSE;
+    }
+
+    memcpy(&Previous, Destination, Size);
+
+    if (Previous == *Comparand)
+    {
+        memcpy(Destination, &NewValue, Size);
+    }
+
+    *Comparand = Previous;
+
+    return TRUE;
+}
+
+/**
+ * @brief Emit a mov between a register and its field in the context
+ * (the context is in rcx)
+ *
+ * @param Code
+ * @param Register
+ * @param Store Whether the register is saved or loaded
+ *
+ * @return VOID
+ */
+static VOID
+TestMaeEmitContextMove(vector<UINT8> & Code, UINT32 Register, BOOLEAN Store)
+{
+    Code.push_back(0x48 | (Register >= 8 ? 0x4 : 0));                     // REX.W (and REX.R)
+    Code.push_back(Store ? 0x89 : 0x8b);                                  // mov
+    Code.push_back((UINT8)(0x40 | ((Register & 7) << 3) | 1));            // [rcx + disp8]
+    Code.push_back((UINT8)(Register * sizeof(UINT64)));                   // Offset in the GUEST_REGS
+}
+
+/**
+ * @brief Build the thunk that executes an instruction natively
+ *
+ * @param Code The executable page
+ * @param Instruction
+ * @param Length
+ *
+ * @return UINT64 Address of the instruction in the thunk
+ */
+static UINT64
+TestMaeBuildThunk(UINT8 * Code, const UINT8 * Instruction, UINT32 Length)
+{
+    vector<UINT8> Thunk;
+    UINT64        InstructionOffset;
+
+    //
+    // push rbx, rbp, rdi, rsi, r12, r13, r14, r15 and the context
+    //
+    Thunk.insert(Thunk.end(), {0x53, 0x55, 0x57, 0x56, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x51});
+
+    //
+    // push qword ptr [rcx + 0x80] ; popfq
+    //
+    Thunk.insert(Thunk.end(), {0xff, 0xb1, 0x80, 0x00, 0x00, 0x00, 0x9d});
+
+    //
+    // Load the registers (except rsp), rcx is the last one
+    //
+    for (UINT32 Register = 0; Register < 16; Register++)
+    {
+        if (Register != 1 && Register != 4)
+        {
+            TestMaeEmitContextMove(Thunk, Register, FALSE);
+        }
+    }
+
+    TestMaeEmitContextMove(Thunk, 1, FALSE);
+
+    InstructionOffset = Thunk.size();
+    Thunk.insert(Thunk.end(), Instruction, Instruction + Length);
+
+    //
+    // push rcx ; mov rcx, [rsp + 8]
+    //
+    Thunk.insert(Thunk.end(), {0x51, 0x48, 0x8b, 0x4c, 0x24, 0x08});
+
+    for (UINT32 Register = 0; Register < 16; Register++)
+    {
+        if (Register != 1 && Register != 4)
+        {
+            TestMaeEmitContextMove(Thunk, Register, TRUE);
+        }
+    }
+
+    //
+    // pop rax ; mov [rcx + 8], rax ; pushfq ; pop rax ; mov [rcx + 0x80], rax ; cld
+    //
+    Thunk.insert(Thunk.end(), {0x58, 0x48, 0x89, 0x41, 0x08, 0x9c, 0x58, 0x48, 0x89, 0x81, 0x80, 0x00, 0x00, 0x00, 0xfc});
+
+    //
+    // pop the context, r15, r14, r13, r12, rsi, rdi, rbp, rbx ; ret
+    //
+    Thunk.insert(Thunk.end(), {0x59, 0x41, 0x5f, 0x41, 0x5e, 0x41, 0x5d, 0x41, 0x5c, 0x5e, 0x5f, 0x5d, 0x5b, 0xc3});
+
+    memcpy(Code, Thunk.data(), Thunk.size());
+
+    return (UINT64)Code + InstructionOffset;
+}
+
+/**
+ * @brief Generate a random instruction with a memory operand in the data
+ *
+ * @param Seed
+ * @param Template
+ * @param Regs The registers of the base and the index are set
+ * @param DataAddress
+ * @param Instruction The bytes of the instruction
+ * @param DisplacementOffset Offset of the disp32 of a RIP-relative operand (or 0)
+ * @param RipRelativeTarget The address of the RIP-relative operand
+ *
+ * @return UINT32 Length of the instruction
+ */
+static UINT32
+TestMaeGenerateInstruction(UINT64 *                  Seed,
+                           const TEST_MAE_TEMPLATE * Template,
+                           GUEST_REGS *              Regs,
+                           UINT64                    DataAddress,
+                           UINT8 *                   Instruction,
+                           UINT32 *                  DisplacementOffset,
+                           UINT64 *                  RipRelativeTarget)
+{
+    UINT64 * Registers    = (UINT64 *)Regs;
+    UINT32   Length       = 0;
+    UINT32   OperandSize  = 4;
+    UINT32   Register     = 0;
+    UINT32   Base         = 0;
+    UINT32   Index        = 4;
+    UINT32   Scale        = 0;
+    UINT8    Rex          = 0;
+    UINT32   Form         = (UINT32)(TestMaeRandom(Seed) % 8);
+    INT32    Displacement = (INT32)(TestMaeRandom(Seed) % 128) - 64;
+    BOOLEAN  UseSib       = FALSE;
+    UINT8    Mod;
+    UINT32   ImmediateSize = 0;
+
+    *DisplacementOffset = 0;
+
+    //
+    // Operand size
+    //
+    if (Template->NeedsRexW)
+    {
+        OperandSize = 8;
+    }
+    else if (!Template->IsByte)
+    {
+        OperandSize = 2u << (TestMaeRandom(Seed) % 3);
+    }
+
+    if (Template->IsLockable && (TestMaeRandom(Seed) & 1))
+    {
+        Instruction[Length++] = 0xf0;
+    }
+
+    if (OperandSize == 2)
+    {
+        Instruction[Length++] = 0x66;
+    }
+
+    if (OperandSize == 8)
+    {
+        Rex |= 0x48;
+    }
+
+    //
+    // The register operand (or the digit of the group), rsp is not used
+    // as it's not loaded by the thunk
+    //
+    if (Template->Digit >= 0)
+    {
+        Register = Template->Digit;
+    }
+    else
+    {
+        do
+        {
+            Register = (UINT32)(TestMaeRandom(Seed) % 16);
+        } while (Register == 4);
+    }
+
+    if (Template->Digit < 0 && Register >= 8)
+    {
+        Rex |= 0x44;
+    }
+
+    //
+    // The memory operand
+    //
+    if (Form == 0)
+    {
+        //
+        // RIP-relative
+        //
+        Mod = 0;
+    }
+    else
+    {
+        do
+        {
+            Base = (UINT32)(TestMaeRandom(Seed) % 16);
+        } while (Base == 4 || (Template->Digit < 0 && Base == Register));
+
+        UseSib = (Form >= 4) || (Base & 7) == 4;
+
+        if (UseSib && Form >= 5)
+        {
+            do
+            {
+                Index = (UINT32)(TestMaeRandom(Seed) % 16);
+            } while (Index == 4 || Index == Base || (Template->Digit < 0 && Index == Register));
+
+            Scale = (UINT32)(TestMaeRandom(Seed) % 4);
+        }
+
+        Mod = (Form == 1 && (Base & 7) != 5) ? 0 : (Form == 2 ? 2 : 1);
+
+        Registers[Base] = DataAddress + TEST_MAE_DATA_MIDDLE;
+
+        if (Index != 4)
+        {
+            Registers[Index] = TestMaeRandom(Seed) % 16;
+        }
+
+        if (Base >= 8)
+        {
+            Rex |= 0x41;
+        }
+
+        if (Index >= 8)
+        {
+            Rex |= 0x42;
+        }
+    }
+
+    //
+    // A REX prefix changes ah-bh to spl-dil, so it's added randomly for the
+    // byte operands
+    //
+    if (Template->IsByte && (TestMaeRandom(Seed) & 1))
+    {
+        Rex |= 0x40;
+    }
+
+    if (Rex != 0)
+    {
+        Instruction[Length++] = Rex;
+    }
+
+    for (UINT32 i = 0; i < Template->OpcodeLength; i++)
+    {
+        Instruction[Length++] = Template->Opcode[i];
+    }
+
+    if (Form == 0)
+    {
+        Instruction[Length++] = (UINT8)(((Register & 7) << 3) | 5);
+        *DisplacementOffset   = Length;
+        *RipRelativeTarget    = DataAddress + TEST_MAE_DATA_MIDDLE + Displacement;
+        Length += 4;
+    }
+    else
+    {
+        Instruction[Length++] = (UINT8)((Mod << 6) | ((Register & 7) << 3) | (UseSib ? 4 : (Base & 7)));
+
+        if (UseSib)
+        {
+            Instruction[Length++] = (UINT8)((Scale << 6) | ((Index & 7) << 3) | (Base & 7));
+        }
+
+        if (Mod == 1)
+        {
+            Instruction[Length++] = (UINT8)Displacement;
+        }
+        else if (Mod == 2)
+        {
+            memcpy(&Instruction[Length], &Displacement, sizeof(INT32));
+            Length += 4;
+        }
+    }
+
+    if (Template->ImmediateKind == TEST_MAE_IMMEDIATE_8)
+    {
+        ImmediateSize = 1;
+    }
+    else if (Template->ImmediateKind == TEST_MAE_IMMEDIATE_Z)
+    {
+        ImmediateSize = OperandSize == 2 ? 2 : 4;
+    }
+
+    for (UINT32 i = 0; i < ImmediateSize; i++)
+    {
+        Instruction[Length++] = (UINT8)TestMaeRandom(Seed);
+    }
+
+    return Length;
+}
+
+/**
+ * @brief Generate a random string instruction
+ *
+ * @param Seed
+ * @param Regs The pointers and the counter are set
+ * @param DataAddress
+ * @param Instruction The bytes of the instruction
+ *
+ * @return UINT32 Length of the instruction
+ */
+static UINT32
+TestMaeGenerateStringInstruction(UINT64 * Seed, GUEST_REGS * Regs, UINT64 DataAddress, UINT8 * Instruction)
+{
+    UINT32 Length = 0;
+    UINT32 Kind   = (UINT32)(TestMaeRandom(Seed) % 4);
+
+    if (TestMaeRandom(Seed) % 4 != 0)
+    {
+        Instruction[Length++] = 0xf3;
+    }
+
+    if (Kind == 1)
+    {
+        Instruction[Length++] = 0x66;
+    }
+    else if (Kind == 2)
+    {
+        Instruction[Length++] = 0x48;
+    }
+
+    Instruction[Length++] = (TestMaeRandom(Seed) & 1) ? (Kind == 0 ? 0xa4 : 0xa5) : (Kind == 0 ? 0xaa : 0xab);
+
+    Regs->rsi = DataAddress + TEST_MAE_DATA_MIDDLE - 0x40 + TestMaeRandom(Seed) % 0x40;
+    Regs->rdi = DataAddress + TEST_MAE_DATA_MIDDLE + TestMaeRandom(Seed) % 0x40;
+    Regs->rcx = TestMaeRandom(Seed) % 12;
+
+    return Length;
+}
+
+/**
+ * @brief Print the bytes of an instruction
+ *
+ * @param Instruction
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+TestMaePrintInstruction(const UINT8 * Instruction, UINT32 Length)
+{
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        printf("%02x ", Instruction[i]);
+    }
+
+    printf("\n");
+}
+
+/**
+ * @brief Execute random instructions natively and by the emulator and
+ * compare the results
+ *
+ * @param Allocation The executable allocation of the thunk and the data
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMaeCompareWithNative(UINT8 * Allocation)
+{
+    MEMORY_ACCESS_EMULATOR_STATE  State;
+    MEMORY_ACCESS_EMULATOR_STATUS Status;
+    TEST_MAE_CONTEXT              Native;
+    TEST_MAE_MEMORY               Memory;
+    GUEST_REGS                    EmulatedRegs;
+    UINT8                         Instruction[MEMORY_ACCESS_EMULATOR_MAXIMUM_INSTRUCTION_LENGTH + 1];
+    UINT8                         EmulatedData[TEST_MAE_DATA_SIZE];
+    UINT8 *                       Data           = Allocation + TEST_MAE_DATA_OFFSET;
+    UINT64                        Seed           = 0x1badb002;
+    UINT64                        FlagsMask      = 0;
+    UINT64                        InstructionRip = 0;
+    UINT64                        Target         = 0;
+    UINT32                        Length         = 0;
+    UINT32                        DisplacementOffset;
+    INT32                         RipDisplacement;
+    const TEST_MAE_TEMPLATE *     Template;
+    UINT32                        CountOfStrings = 0;
+
+    for (UINT32 Test = 0; Test < TEST_MAE_NUMBER_OF_INSTRUCTIONS; Test++)
+    {
+        //
+        // Random registers, flags and memory
+        //
+        for (UINT32 Register = 0; Register < 16; Register++)
+        {
+            ((UINT64 *)&Native.Regs)[Register] = TestMaeRandom(&Seed);
+        }
+
+        Native.Regs.rsp = 0;
+        Native.Rflags   = 0x202 | (TestMaeRandom(&Seed) & MEMORY_ACCESS_EMULATOR_ARITHMETIC_FLAGS);
+        FlagsMask       = MEMORY_ACCESS_EMULATOR_ARITHMETIC_FLAGS | MEMORY_ACCESS_EMULATOR_FLAG_DF;
+
+        for (UINT32 i = 0; i < TEST_MAE_DATA_SIZE; i++)
+        {
+            Data[i] = (UINT8)TestMaeRandom(&Seed);
+        }
+
+        if (Test % 8 == 0)
+        {
+            Template = NULL;
+            Length   = TestMaeGenerateStringInstruction(&Seed, &Native.Regs, (UINT64)Data, Instruction);
+
+            if (TestMaeRandom(&Seed) & 1)
+            {
+                Native.Rflags |= MEMORY_ACCESS_EMULATOR_FLAG_DF;
+            }
+
+            CountOfStrings++;
+        }
+        else
+        {
+            Template = &TestMaeTemplates[TestMaeRandom(&Seed) % RTL_NUMBER_OF(TestMaeTemplates)];
+            Length   = TestMaeGenerateInstruction(&Seed, Template, &Native.Regs, (UINT64)Data, Instruction, &DisplacementOffset, &Target);
+
+            if (Template->IsLogical)
+            {
+                FlagsMask &= ~(UINT64)MEMORY_ACCESS_EMULATOR_FLAG_AF;
+            }
+        }
+
+        InstructionRip = TestMaeBuildThunk(Allocation, Instruction, Length);
+
+        if (Template != NULL && DisplacementOffset != 0)
+        {
+            RipDisplacement = (INT32)(Target - (InstructionRip + Length));
+            memcpy(&Instruction[DisplacementOffset], &RipDisplacement, sizeof(INT32));
+            InstructionRip = TestMaeBuildThunk(Allocation, Instruction, Length);
+        }
+
+        //
+        // Emulate on a copy of the memory and registers
+        //
+        memcpy(EmulatedData, Data, TEST_MAE_DATA_SIZE);
+        memcpy(&EmulatedRegs, &Native.Regs, sizeof(GUEST_REGS));
+
+        Memory.NativeAddress = (UINT64)Data;
+        Memory.Buffer        = EmulatedData;
+        Memory.Size          = TEST_MAE_DATA_SIZE;
+        Memory.Limit         = MAXUINT64;
+
+        State.Regs            = &EmulatedRegs;
+        State.Rip             = InstructionRip;
+        State.Rflags          = Native.Rflags;
+        State.FsBase          = 0;
+        State.GsBase          = 0;
+        State.Read            = TestMaeRead;
+        State.Write           = TestMaeWrite;
+        State.CompareExchange = TestMaeCompareExchange;
+        State.Context         = &Memory;
+
+        Status = MemoryAccessEmulatorEmulate(Instruction, Length, &State);
+
+        //
+        // Execute natively
+        //
+        ((TEST_MAE_NATIVE_THUNK)Allocation)(&Native);
+
+        if (Status != MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED ||
+            State.Rip != InstructionRip + Length ||
+            memcmp(&EmulatedRegs, &Native.Regs, sizeof(GUEST_REGS)) != 0 ||
+            ((State.Rflags ^ Native.Rflags) & FlagsMask) != 0 ||
+            memcmp(EmulatedData, Data, TEST_MAE_DATA_SIZE) != 0)
+        {
+            printf("[-] %s: the emulation (status: %d) is not the same as the native execution of : ",
+                   Template ? Template->Name : "string instruction",
+                   Status);
+            TestMaePrintInstruction(Instruction, Length);
+
+            for (UINT32 Register = 0; Register < 16; Register++)
+            {
+                if (((UINT64 *)&EmulatedRegs)[Register] != ((UINT64 *)&Native.Regs)[Register])
+                {
+                    printf("    register %u : %llx (native: %llx)\n",
+                           Register,
+                           ((UINT64 *)&EmulatedRegs)[Register],
+                           ((UINT64 *)&Native.Regs)[Register]);
+                }
+            }
+
+            printf("    rflags : %llx (native: %llx)\n", State.Rflags, Native.Rflags);
+
+            return FALSE;
+        }
+    }
+
+    printf("[*] %u instructions (%u string instructions) are emulated the same as the native execution\n",
+           TEST_MAE_NUMBER_OF_INSTRUCTIONS,
+           CountOfStrings);
+
+    return TRUE;
+}
+
+/**
+ * @brief Check that the unsupported instructions are not changed
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMaeUnsupported()
+{
+    //
+    // Register operands, other instructions, invalid prefixes and truncated bytes
+    //
+    const vector<vector<UINT8>> Instructions = {
+        {0x89, 0xc8},             // mov eax, ecx
+        {0x11, 0x08},             // adc [rax], ecx
+        {0x80, 0x10, 0x01},       // adc byte [rax], 1
+        {0xff, 0x10},             // call [rax]
+        {0xff, 0x30},             // push [rax]
+        {0xf0, 0x89, 0x08},       // lock mov [rax], ecx
+        {0xf0, 0x39, 0x08},       // lock cmp [rax], ecx
+        {0xf2, 0xa4},             // repne movsb
+        {0x67, 0xaa},             // stosb with 32-bit pointers
+        {0xf3, 0x89, 0x08},       // xrelease mov [rax], ecx
+        {0x63, 0x08},             // movsxd without REX.W
+        {0xc7, 0x48, 0x10},       // truncated mov [rax + 0x10], imm32
+        {0x8b, 0x84, 0x24},       // truncated mov eax, [rsp + disp32]
+        {0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x89, 0x08},
+    };
+
+    MEMORY_ACCESS_EMULATOR_INSTRUCTION Decoded;
+
+    for (auto & Instruction : Instructions)
+    {
+        if (MemoryAccessEmulatorDecode(Instruction.data(), (UINT32)Instruction.size(), &Decoded))
+        {
+            printf("[-] unsupported instruction is decoded : ");
+            TestMaePrintInstruction(Instruction.data(), (UINT32)Instruction.size());
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check the segment overrides and the inaccessible memory (the
+ * emulator shouldn't change anything, or only complete the iterations of
+ * a rep-prefixed instruction that are accessible)
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMaeAccesses()
+{
+    MEMORY_ACCESS_EMULATOR_STATE       State   = {0};
+    MEMORY_ACCESS_EMULATOR_INSTRUCTION Decoded;
+    TEST_MAE_MEMORY                    Memory  = {0};
+    GUEST_REGS                         Regs    = {0};
+    GUEST_REGS                         Saved;
+    UINT8                              Data[0x100] = {0};
+    const UINT8                        MovFromGs[] = {0x65, 0x48, 0x8b, 0x04, 0x25, 0x30, 0x00, 0x00, 0x00}; // mov rax, gs:[0x30]
+    const UINT8                        AddToRbx[]  = {0x48, 0x01, 0x0b};                                     // add [rbx], rcx
+    const UINT8                        RepStosd[]  = {0xf3, 0xab};                                           // rep stosd
+
+    Memory.NativeAddress = 0x7ff612340000;
+    Memory.Buffer        = Data;
+    Memory.Size          = sizeof(Data);
+    Memory.Limit         = MAXUINT64;
+
+    State.Regs    = &Regs;
+    State.Rip     = 0x7ff600001000;
+    State.Rflags  = 0x202;
+    State.GsBase  = Memory.NativeAddress;
+    State.Read    = TestMaeRead;
+    State.Write   = TestMaeWrite;
+    State.Context = &Memory;
+
+    //
+    // The base of the segment is added to the address
+    //
+    Data[0x30] = 0x5a;
+
+    if (!MemoryAccessEmulatorDecode(MovFromGs, sizeof(MovFromGs), &Decoded) ||
+        MemoryAccessEmulatorGetEffectiveAddress(&Decoded, &State) != Memory.NativeAddress + 0x30 ||
+        MemoryAccessEmulatorExecute(&Decoded, &State) != MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED ||
+        Regs.rax != 0x5a || State.Rip != 0x7ff600001000 + sizeof(MovFromGs))
+    {
+        printf("[-] the segment override is not emulated\n");
+        return FALSE;
+    }
+
+    //
+    // Inaccessible memory
+    //
+    Regs.rbx = Memory.NativeAddress + sizeof(Data) - 4;
+    Regs.rcx = 1;
+    Saved    = Regs;
+
+    if (MemoryAccessEmulatorEmulate(AddToRbx, sizeof(AddToRbx), &State) != MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED ||
+        memcmp(&Regs, &Saved, sizeof(GUEST_REGS)) != 0 || State.Rip != 0x7ff600001000 + sizeof(MovFromGs))
+    {
+        printf("[-] the access to the inaccessible memory changes the state\n");
+        return FALSE;
+    }
+
+    //
+    // The iterations of the rep stos stop at the limit, the rest of them
+    // are performed after the limit is removed
+    //
+    State.Rip    = 0x7ff600002000;
+    Regs.rax     = 0x11223344;
+    Regs.rcx     = 0x20;
+    Regs.rdi     = Memory.NativeAddress;
+    Memory.Limit = Memory.NativeAddress + 0x10 * sizeof(UINT32);
+
+    if (MemoryAccessEmulatorEmulate(RepStosd, sizeof(RepStosd), &State) != MEMORY_ACCESS_EMULATOR_STATUS_PARTIAL ||
+        Regs.rcx != 0x10 || Regs.rdi != Memory.NativeAddress + 0x40 || State.Rip != 0x7ff600002000)
+    {
+        printf("[-] the partial rep stos is not emulated\n");
+        return FALSE;
+    }
+
+    Memory.Limit = MAXUINT64;
+
+    if (MemoryAccessEmulatorEmulate(RepStosd, sizeof(RepStosd), &State) != MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED ||
+        Regs.rcx != 0 || Regs.rdi != Memory.NativeAddress + 0x80 || State.Rip != 0x7ff600002000 + sizeof(RepStosd))
+    {
+        printf("[-] the rest of the rep stos is not emulated\n");
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < 0x80; i += sizeof(UINT32))
+    {
+        if (*(UINT32 *)&Data[i] != 0x11223344)
+        {
+            printf("[-] the rep stos doesn't write to offset %x\n", i);
+            return FALSE;
+        }
+    }
+
+    //
+    // The locked instructions need the compare-exchange callback
+    //
+    const UINT8 LockAdd[] = {0xf0, 0x48, 0x01, 0x0b}; // lock add [rbx], rcx
+
+    Regs.rbx = Memory.NativeAddress;
+
+    if (MemoryAccessEmulatorEmulate(LockAdd, sizeof(LockAdd), &State) != MEMORY_ACCESS_EMULATOR_STATUS_UNSUPPORTED)
+    {
+        printf("[-] the locked instruction is emulated without the compare-exchange\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the decoder and emulator of the trapped memory accesses
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestMemoryAccessEmulator()
+{
+    UINT8 * Allocation;
+    BOOLEAN Result;
+
+    if (!TestMaeUnsupported() || !TestMaeAccesses())
+    {
+        return FALSE;
+    }
+
+    Allocation = (UINT8 *)VirtualAlloc(NULL, TEST_MAE_ALLOCATION_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+
+    if (Allocation == NULL)
+    {
+        printf("[-] unable to allocate the executable memory\n");
+        return FALSE;
+    }
+
+    Result = TestMaeCompareWithNative(Allocation);
+
+    VirtualFree(Allocation, 0, MEM_RELEASE);
+
+    return Result;
+}
@@ -0,0 +1,460 @@
+/**
+ * @file test-mtrr-map.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the MTRR map and the 1GB pages of the EPT
+ * @details The memory types of the pages of the first 512 GB are computed
+ * by the previous method (checking all of the ranges for each page) and
+ * by the interval map (with the 1 GB and 2 MB pages of the uniform regions)
+ * and compared for different layouts of the MTRRs, at last the time of
+ * both of the methods and the count of the split pages are shown
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The simulated memory and layouts
+ *
+ */
+#define TEST_MTRR_MAP_PAGE_SIZE          0x1000ull
+#define TEST_MTRR_MAP_SIZE_2_MB          0x200000ull
+#define TEST_MTRR_MAP_SIZE_1_GB          0x40000000ull
+#define TEST_MTRR_MAP_SIZE_512_GB        0x8000000000ull
+#define TEST_MTRR_MAP_NUMBER_OF_LAYOUTS  32
+#define TEST_MTRR_MAP_NUMBER_OF_LOOKUPS  0x10000
+#define TEST_MTRR_MAP_MEMORY_TYPE_WC     1
+#define TEST_MTRR_MAP_MEMORY_TYPE_WP     5
+#define TEST_MTRR_MAP_MAXIMUM_VARIABLES  10
+
+/**
+ * @brief The result of a method for a layout
+ *
+ */
+typedef struct _TEST_MTRR_MAP_RESULT
+{
+    UINT64 SplitPages;    // 2 MB pages that are split to 4 KB pages
+    UINT64 LargePages;    // 1 GB pages
+    double ElapsedTime;   // In milliseconds
+
+} TEST_MTRR_MAP_RESULT, *PTEST_MTRR_MAP_RESULT;
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestMtrrMapRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief Get the memory type of a page by the previous method of the
+ * hypervisor (EptGetMemoryType)
+ *
+ * @param Ranges
+ * @param DefaultMemoryType
+ * @param AddressOfPage
+ *
+ * @return UINT8
+ */
+static UINT8
+TestMtrrMapLegacyGetMemoryType(vector<MTRR_MAP_RANGE> & Ranges, UINT8 DefaultMemoryType, UINT64 AddressOfPage)
+{
+    UINT8 TargetMemoryType = (UINT8)-1;
+
+    for (auto & CurrentMemoryRange : Ranges)
+    {
+        if (AddressOfPage >= CurrentMemoryRange.PhysicalBaseAddress &&
+            AddressOfPage < CurrentMemoryRange.PhysicalEndAddress)
+        {
+            if (CurrentMemoryRange.FixedRange)
+            {
+                TargetMemoryType = CurrentMemoryRange.MemoryType;
+                break;
+            }
+
+            if (TargetMemoryType == MTRR_MAP_MEMORY_TYPE_UNCACHEABLE)
+            {
+                TargetMemoryType = CurrentMemoryRange.MemoryType;
+                break;
+            }
+
+            if (TargetMemoryType == MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH || CurrentMemoryRange.MemoryType == MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH)
+            {
+                if (TargetMemoryType == MTRR_MAP_MEMORY_TYPE_WRITE_BACK)
+                {
+                    TargetMemoryType = MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH;
+                    continue;
+                }
+            }
+
+            TargetMemoryType = CurrentMemoryRange.MemoryType;
+        }
+    }
+
+    if (TargetMemoryType == (UINT8)-1)
+    {
+        TargetMemoryType = DefaultMemoryType;
+    }
+
+    return TargetMemoryType;
+}
+
+/**
+ * @brief Check if a 2 MB page can be mapped as a large page by the previous
+ * method of the hypervisor (EptIsValidForLargePage)
+ *
+ * @param Ranges
+ * @param StartAddressOfPage
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMtrrMapLegacyIsValidForLargePage(vector<MTRR_MAP_RANGE> & Ranges, UINT64 StartAddressOfPage)
+{
+    UINT64 EndAddressOfPage = StartAddressOfPage + (TEST_MTRR_MAP_SIZE_2_MB - 1);
+
+    for (auto & CurrentMemoryRange : Ranges)
+    {
+        if ((StartAddressOfPage <= CurrentMemoryRange.PhysicalEndAddress &&
+             EndAddressOfPage > CurrentMemoryRange.PhysicalEndAddress) ||
+            (StartAddressOfPage < CurrentMemoryRange.PhysicalBaseAddress &&
+             EndAddressOfPage >= CurrentMemoryRange.PhysicalBaseAddress))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Add the fixed ranges of the first 1 MB (the legacy video memory
+ * is uncacheable and the ROMs are write-protected)
+ *
+ * @param Ranges
+ *
+ * @return VOID
+ */
+static VOID
+TestMtrrMapAddFixedRanges(vector<MTRR_MAP_RANGE> & Ranges)
+{
+    struct
+    {
+        UINT64 Base;
+        UINT64 Size;
+        UINT32 Count;
+
+    } Groups[] = {{0x0, 0x10000, 8}, {0x80000, 0x4000, 16}, {0xc0000, 0x1000, 64}};
+
+    for (auto & Group : Groups)
+    {
+        for (UINT32 i = 0; i < Group.Count; i++)
+        {
+            MTRR_MAP_RANGE Range = {0};
+
+            Range.PhysicalBaseAddress = Group.Base + i * Group.Size;
+            Range.PhysicalEndAddress  = Range.PhysicalBaseAddress + Group.Size - 1;
+            Range.FixedRange          = TRUE;
+            Range.MemoryType          = Range.PhysicalBaseAddress < 0xa0000 ? MTRR_MAP_MEMORY_TYPE_WRITE_BACK : Range.PhysicalBaseAddress < 0xc0000 ? MTRR_MAP_MEMORY_TYPE_UNCACHEABLE
+                                                                                                                                                       : TEST_MTRR_MAP_MEMORY_TYPE_WP;
+
+            Ranges.push_back(Range);
+        }
+    }
+}
+
+/**
+ * @brief Add a variable range
+ *
+ * @param Ranges
+ * @param Base
+ * @param Size
+ * @param MemoryType
+ *
+ * @return VOID
+ */
+static VOID
+TestMtrrMapAddVariableRange(vector<MTRR_MAP_RANGE> & Ranges, UINT64 Base, UINT64 Size, UINT8 MemoryType)
+{
+    MTRR_MAP_RANGE Range = {0};
+
+    Range.PhysicalBaseAddress = Base;
+    Range.PhysicalEndAddress  = Base + Size - 1;
+    Range.MemoryType          = MemoryType;
+    Range.FixedRange          = FALSE;
+
+    Ranges.push_back(Range);
+}
+
+/**
+ * @brief Compute the memory types of the pages of the first 512 GB by the
+ * previous method (4 KB types of the split pages, 2 MB types of the others)
+ *
+ * @param Ranges
+ * @param DefaultMemoryType
+ * @param Types The memory type of each 4 KB page
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestMtrrMapLegacyMethod(vector<MTRR_MAP_RANGE> & Ranges,
+                        UINT8                    DefaultMemoryType,
+                        vector<UINT8> &          Types,
+                        PTEST_MTRR_MAP_RESULT    Result)
+{
+    auto Start = chrono::steady_clock::now();
+
+    for (UINT64 Address = 0; Address < TEST_MTRR_MAP_SIZE_512_GB; Address += TEST_MTRR_MAP_SIZE_2_MB)
+    {
+        UINT64 Page = Address / TEST_MTRR_MAP_PAGE_SIZE;
+
+        if (TestMtrrMapLegacyIsValidForLargePage(Ranges, Address))
+        {
+            memset(&Types[Page], TestMtrrMapLegacyGetMemoryType(Ranges, DefaultMemoryType, Address), TEST_MTRR_MAP_SIZE_2_MB / TEST_MTRR_MAP_PAGE_SIZE);
+            continue;
+        }
+
+        Result->SplitPages++;
+
+        for (UINT64 i = 0; i < TEST_MTRR_MAP_SIZE_2_MB / TEST_MTRR_MAP_PAGE_SIZE; i++)
+        {
+            Types[Page + i] = TestMtrrMapLegacyGetMemoryType(Ranges, DefaultMemoryType, Address + i * TEST_MTRR_MAP_PAGE_SIZE);
+        }
+    }
+
+    Result->ElapsedTime = chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+}
+
+/**
+ * @brief Compute the memory types of the pages of the first 512 GB by the
+ * interval map (1 GB and 2 MB pages of the uniform regions)
+ *
+ * @param Map
+ * @param Ranges
+ * @param DefaultMemoryType
+ * @param Types The memory type of each 4 KB page
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestMtrrMapMapMethod(PMTRR_MAP                Map,
+                     vector<MTRR_MAP_RANGE> & Ranges,
+                     UINT8                    DefaultMemoryType,
+                     vector<UINT8> &          Types,
+                     PTEST_MTRR_MAP_RESULT    Result)
+{
+    auto Start = chrono::steady_clock::now();
+
+    MtrrMapBuild(Map, Ranges.data(), (UINT32)Ranges.size(), DefaultMemoryType);
+
+    for (UINT64 Region = 0; Region < TEST_MTRR_MAP_SIZE_512_GB; Region += TEST_MTRR_MAP_SIZE_1_GB)
+    {
+        if (MtrrMapIsUniform(Map, Region, TEST_MTRR_MAP_SIZE_1_GB))
+        {
+            Result->LargePages++;
+            memset(&Types[Region / TEST_MTRR_MAP_PAGE_SIZE], MtrrMapGetMemoryType(Map, Region), TEST_MTRR_MAP_SIZE_1_GB / TEST_MTRR_MAP_PAGE_SIZE);
+            continue;
+        }
+
+        for (UINT64 Address = Region; Address < Region + TEST_MTRR_MAP_SIZE_1_GB; Address += TEST_MTRR_MAP_SIZE_2_MB)
+        {
+            UINT64 Page = Address / TEST_MTRR_MAP_PAGE_SIZE;
+
+            if (MtrrMapIsUniform(Map, Address, TEST_MTRR_MAP_SIZE_2_MB))
+            {
+                memset(&Types[Page], MtrrMapGetMemoryType(Map, Address), TEST_MTRR_MAP_SIZE_2_MB / TEST_MTRR_MAP_PAGE_SIZE);
+                continue;
+            }
+
+            Result->SplitPages++;
+
+            for (UINT64 i = 0; i < TEST_MTRR_MAP_SIZE_2_MB / TEST_MTRR_MAP_PAGE_SIZE; i++)
+            {
+                Types[Page + i] = MtrrMapGetMemoryType(Map, Address + i * TEST_MTRR_MAP_PAGE_SIZE);
+            }
+        }
+    }
+
+    Result->ElapsedTime = chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+}
+
+/**
+ * @brief Compare the methods for a layout of the MTRRs
+ *
+ * @param Name
+ * @param Ranges
+ * @param DefaultMemoryType
+ * @param Seed
+ * @param Show Whether to show the result
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMtrrMapCompareMethods(const char *             Name,
+                          vector<MTRR_MAP_RANGE> & Ranges,
+                          UINT8                    DefaultMemoryType,
+                          UINT64 *                 Seed,
+                          BOOLEAN                  Show)
+{
+    static MTRR_MAP      Map;
+    static vector<UINT8> LegacyTypes(TEST_MTRR_MAP_SIZE_512_GB / TEST_MTRR_MAP_PAGE_SIZE);
+    static vector<UINT8> MapTypes(TEST_MTRR_MAP_SIZE_512_GB / TEST_MTRR_MAP_PAGE_SIZE);
+    TEST_MTRR_MAP_RESULT LegacyResult = {0};
+    TEST_MTRR_MAP_RESULT MapResult    = {0};
+
+    TestMtrrMapLegacyMethod(Ranges, DefaultMemoryType, LegacyTypes, &LegacyResult);
+    TestMtrrMapMapMethod(&Map, Ranges, DefaultMemoryType, MapTypes, &MapResult);
+
+    for (UINT64 Page = 0; Page < LegacyTypes.size(); Page++)
+    {
+        if (LegacyTypes[Page] != MapTypes[Page])
+        {
+            printf("[-] %s: the memory type of 0x%llx is %u instead of %u\n",
+                   Name,
+                   Page * TEST_MTRR_MAP_PAGE_SIZE,
+                   MapTypes[Page],
+                   LegacyTypes[Page]);
+            return FALSE;
+        }
+    }
+
+    //
+    // The boundaries of the ranges (above the first 512 GB too) and random
+    // addresses
+    //
+    vector<UINT64> Addresses;
+
+    for (auto & Range : Ranges)
+    {
+        Addresses.push_back(Range.PhysicalBaseAddress);
+        Addresses.push_back(Range.PhysicalBaseAddress - TEST_MTRR_MAP_PAGE_SIZE);
+        Addresses.push_back(Range.PhysicalEndAddress + 1);
+        Addresses.push_back(Range.PhysicalEndAddress + 1 - TEST_MTRR_MAP_PAGE_SIZE);
+    }
+
+    for (UINT32 i = 0; i < TEST_MTRR_MAP_NUMBER_OF_LOOKUPS; i++)
+    {
+        Addresses.push_back((TestMtrrMapRandom(Seed) % (TEST_MTRR_MAP_SIZE_512_GB * 4)) & ~(TEST_MTRR_MAP_PAGE_SIZE - 1));
+    }
+
+    for (auto Address : Addresses)
+    {
+        if (MtrrMapGetMemoryType(&Map, Address) != TestMtrrMapLegacyGetMemoryType(Ranges, DefaultMemoryType, Address))
+        {
+            printf("[-] %s: the memory type of 0x%llx is not valid\n", Name, Address);
+            return FALSE;
+        }
+    }
+
+    if (Show)
+    {
+        printf("[*] %-10s: %3u ranges, %3u intervals, split 2MB pages %5llu -> %5llu, 1GB pages %3llu, %8.2f ms -> %6.2f ms\n",
+               Name,
+               (UINT32)Ranges.size(),
+               Map.NumberOfIntervals,
+               LegacyResult.SplitPages,
+               MapResult.SplitPages,
+               MapResult.LargePages,
+               LegacyResult.ElapsedTime,
+               MapResult.ElapsedTime);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the MTRR map and the 1GB pages of the EPT
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestMtrrMap()
+{
+    UINT64                 Seed    = 0x4d545252;
+    vector<MTRR_MAP_RANGE> Ranges;
+    UINT8                  Types[] = {MTRR_MAP_MEMORY_TYPE_UNCACHEABLE,
+                                      TEST_MTRR_MAP_MEMORY_TYPE_WC,
+                                      MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH,
+                                      TEST_MTRR_MAP_MEMORY_TYPE_WP,
+                                      MTRR_MAP_MEMORY_TYPE_WRITE_BACK};
+
+    //
+    // A typical layout: the memory is write-back, the PCI hole below 4 GB
+    // is uncacheable and the frame buffer is write-combining (the variable
+    // ranges of the firmware split the write-back memory)
+    //
+    TestMtrrMapAddFixedRanges(Ranges);
+    TestMtrrMapAddVariableRange(Ranges, 0x0, 0x80000000, MTRR_MAP_MEMORY_TYPE_WRITE_BACK);
+    TestMtrrMapAddVariableRange(Ranges, 0x80000000, 0x40000000, MTRR_MAP_MEMORY_TYPE_WRITE_BACK);
+    TestMtrrMapAddVariableRange(Ranges, 0x7fe80000, 0x80000, MTRR_MAP_MEMORY_TYPE_WRITE_BACK);
+    TestMtrrMapAddVariableRange(Ranges, 0xc0000000, 0x40000000, MTRR_MAP_MEMORY_TYPE_UNCACHEABLE);
+    TestMtrrMapAddVariableRange(Ranges, 0xd0000000, 0x10000000, TEST_MTRR_MAP_MEMORY_TYPE_WC);
+    TestMtrrMapAddVariableRange(Ranges, 0x100000000, 0x400000000, MTRR_MAP_MEMORY_TYPE_WRITE_BACK);
+    TestMtrrMapAddVariableRange(Ranges, 0x500000000, 0x100000000, MTRR_MAP_MEMORY_TYPE_WRITE_BACK);
+
+    if (!TestMtrrMapCompareMethods("typical", Ranges, MTRR_MAP_MEMORY_TYPE_UNCACHEABLE, &Seed, TRUE))
+    {
+        return FALSE;
+    }
+
+    //
+    // Overlapping ranges (write-through over write-back and uncacheable
+    // over both of them)
+    //
+    Ranges.clear();
+    TestMtrrMapAddVariableRange(Ranges, 0x0, 0x1000000000, MTRR_MAP_MEMORY_TYPE_WRITE_BACK);
+    TestMtrrMapAddVariableRange(Ranges, 0x40000000, 0x40000000, MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH);
+    TestMtrrMapAddVariableRange(Ranges, 0x60000000, 0x100000, MTRR_MAP_MEMORY_TYPE_UNCACHEABLE);
+    TestMtrrMapAddVariableRange(Ranges, 0x200000000, 0x200000000, MTRR_MAP_MEMORY_TYPE_UNCACHEABLE);
+    TestMtrrMapAddVariableRange(Ranges, 0x300000000, 0x1000, MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH);
+
+    if (!TestMtrrMapCompareMethods("overlapped", Ranges, MTRR_MAP_MEMORY_TYPE_WRITE_BACK, &Seed, TRUE))
+    {
+        return FALSE;
+    }
+
+    //
+    // Random aligned ranges (the variable ranges are aligned to their sizes)
+    //
+    for (UINT32 Layout = 0; Layout < TEST_MTRR_MAP_NUMBER_OF_LAYOUTS; Layout++)
+    {
+        Ranges.clear();
+
+        if (Layout % 2 == 0)
+        {
+            TestMtrrMapAddFixedRanges(Ranges);
+        }
+
+        for (UINT32 i = 0; i < TEST_MTRR_MAP_MAXIMUM_VARIABLES; i++)
+        {
+            UINT64 Size = TEST_MTRR_MAP_PAGE_SIZE << (TestMtrrMapRandom(&Seed) % 28);
+            UINT64 Base = (TestMtrrMapRandom(&Seed) % TEST_MTRR_MAP_SIZE_512_GB) & ~(Size - 1);
+
+            TestMtrrMapAddVariableRange(Ranges, Base, Size, Types[TestMtrrMapRandom(&Seed) % RTL_NUMBER_OF(Types)]);
+        }
+
+        if (!TestMtrrMapCompareMethods("random", Ranges, Types[Layout % RTL_NUMBER_OF(Types)], &Seed, Layout < 4))
+        {
+            return FALSE;
+        }
+    }
+
+    //
+    // No ranges (the MTRRs are disabled)
+    //
+    Ranges.clear();
+
+    return TestMtrrMapCompareMethods("disabled", Ranges, MTRR_MAP_MEMORY_TYPE_UNCACHEABLE, &Seed, TRUE);
+}
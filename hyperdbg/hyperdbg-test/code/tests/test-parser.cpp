@@ -378,3 +378,92 @@ TestCommandParser()
 
     return overallResult;
 }
+
+/**
+ * @brief Benchmark the command parser
+ * @details The tokens of all of the test cases are checked first, then the
+ * whole list of commands is parsed repeatedly
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestCommandParserBenchmark()
+{
+    CHAR   filePath[MAX_PATH]  = {0};
+    UINT32 failedTokenNum      = 0;
+    UINT32 failedTokenPosition = 0;
+    UINT64 parseTime           = 0;
+    UINT64 tokenizeTime        = 0;
+    UINT64 numberOfTokens      = 0;
+    UINT64 numberOfBytes       = 0;
+    UINT32 numberOfIterations  = 100;
+
+    std::vector<std::string> commands;
+
+    if (!hyperdbg_u_setup_path_for_filename(COMMAND_PARSER_TEST_CASES_FILE, filePath, MAX_PATH, TRUE))
+    {
+        //
+        // Error could not find the test case files
+        //
+        cout << "[-] Could not find the test case files" << endl;
+        return FALSE;
+    }
+
+    auto testCases = parseTestCases(filePath);
+
+    //
+    // The parsed tokens should be identical to the tokens of the test cases
+    //
+    for (const auto & testCase : testCases)
+    {
+        CHAR_PTR_PTR testCaseArray = createTestCaseArray(testCase.second);
+        BOOLEAN      isIdentical   = hyperdbg_u_test_command_parser((CHAR *)testCase.first.c_str(),
+                                                             (UINT32)testCase.second.size(),
+                                                             testCaseArray,
+                                                             &failedTokenNum,
+                                                             &failedTokenPosition);
+
+        freeTestCaseArray(testCaseArray, testCase.second.size());
+
+        if (!isIdentical)
+        {
+            cout << "[-] The tokens of the following command are not identical to the test case:" << endl;
+            ShowParsedCommandAndTokens(testCase, failedTokenNum, failedTokenPosition);
+            return FALSE;
+        }
+
+        commands.push_back(testCase.first);
+        numberOfBytes += testCase.first.length();
+    }
+
+    //
+    // Parse the list of commands repeatedly
+    //
+    std::vector<CHAR *> commandsList;
+
+    for (auto & command : commands)
+    {
+        commandsList.push_back((CHAR *)command.c_str());
+    }
+
+    if (!hyperdbg_u_test_command_parser_benchmark(commandsList.data(),
+                                                  (UINT32)commandsList.size(),
+                                                  numberOfIterations,
+                                                  &parseTime,
+                                                  &tokenizeTime,
+                                                  &numberOfTokens))
+    {
+        cout << "[-] The command tokens and the tokenizer views are not identical" << endl;
+        return FALSE;
+    }
+
+    cout << "Commands: " << commands.size() << " (" << numberOfBytes << " bytes, " << numberOfTokens << " tokens), iterations: " << numberOfIterations << endl;
+
+    cout << "Command tokens:  " << parseTime / numberOfIterations << " us per pass, "
+         << (parseTime ? (numberOfBytes * numberOfIterations) / parseTime : 0) << " MB/s" << endl;
+
+    cout << "Tokenizer views: " << tokenizeTime / numberOfIterations << " us per pass, "
+         << (tokenizeTime ? (numberOfBytes * numberOfIterations) / tokenizeTime : 0) << " MB/s" << endl;
+
+    return TRUE;
+}
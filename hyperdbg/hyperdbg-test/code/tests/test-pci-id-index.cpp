@@ -0,0 +1,527 @@
+/**
+ * @file test-pci-id-index.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the binary index of the PCI ID database
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of vendors of the generated database
+ *
+ */
+#define TEST_PCI_ID_INDEX_NUMBER_OF_VENDORS 2500
+
+/**
+ * @brief Number of IDs that are resolved in the benchmark
+ *
+ */
+#define TEST_PCI_ID_INDEX_NUMBER_OF_QUERIES 2048
+
+/**
+ * @brief A subsystem of the generated database
+ *
+ */
+typedef struct _TEST_PCI_ID_SUBSYSTEM
+{
+    UINT16      SubVendorId;
+    UINT16      SubDeviceId;
+    std::string Name;
+
+} TEST_PCI_ID_SUBSYSTEM;
+
+/**
+ * @brief A device of the generated database
+ *
+ */
+typedef struct _TEST_PCI_ID_DEVICE
+{
+    UINT16                             DeviceId;
+    std::string                        Name;
+    std::vector<TEST_PCI_ID_SUBSYSTEM> Subsystems;
+
+} TEST_PCI_ID_DEVICE;
+
+/**
+ * @brief A vendor of the generated database
+ *
+ */
+typedef struct _TEST_PCI_ID_VENDOR
+{
+    UINT16                          VendorId;
+    std::string                     Name;
+    std::vector<TEST_PCI_ID_DEVICE> Devices;
+
+} TEST_PCI_ID_VENDOR;
+
+/**
+ * @brief A resolved ID of the benchmark
+ *
+ */
+typedef struct _TEST_PCI_ID_QUERY
+{
+    UINT16      VendorId;
+    UINT16      DeviceId;
+    UINT16      SubVendorId;
+    UINT16      SubDeviceId;
+    std::string VendorName; // Empty if not found
+    std::string DeviceName;
+    std::string SubsystemName;
+
+} TEST_PCI_ID_QUERY;
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT32
+ */
+static UINT32
+TestPciIdIndexRandom(UINT64 * State)
+{
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return (UINT32)(*State >> 16);
+}
+
+/**
+ * @brief Generate a database in the format of the pci.ids
+ * @details The vendors are not sorted, the lines end with "\r\n", and the
+ * database has comments and a list of classes (which shouldn't be indexed)
+ *
+ * @param Vendors
+ * @param Text
+ *
+ * @return VOID
+ */
+static VOID
+TestPciIdIndexGenerate(std::vector<TEST_PCI_ID_VENDOR> & Vendors, std::string & Text)
+{
+    UINT64  State                = 0x9e3779b97f4a7c15ull;
+    BOOLEAN UsedVendors[0x10000] = {0};
+    CHAR    Line[512];
+
+    for (UINT32 i = 0; i < TEST_PCI_ID_INDEX_NUMBER_OF_VENDORS; i++)
+    {
+        TEST_PCI_ID_VENDOR Vendor;
+        BOOLEAN            UsedDevices[0x10000] = {0};
+        UINT32             NumberOfDevices      = TestPciIdIndexRandom(&State) % 10;
+
+        do
+        {
+            Vendor.VendorId = (UINT16)TestPciIdIndexRandom(&State);
+        } while (UsedVendors[Vendor.VendorId] || Vendor.VendorId == 0xffff);
+
+        UsedVendors[Vendor.VendorId] = TRUE;
+
+        snprintf(Line, sizeof(Line), "Vendor %04x Corporation", Vendor.VendorId);
+        Vendor.Name = Line;
+
+        for (UINT32 j = 0; j < NumberOfDevices; j++)
+        {
+            TEST_PCI_ID_DEVICE Device;
+            UINT32             NumberOfSubsystems = TestPciIdIndexRandom(&State) % 4;
+
+            do
+            {
+                Device.DeviceId = (UINT16)TestPciIdIndexRandom(&State);
+            } while (UsedDevices[Device.DeviceId]);
+
+            UsedDevices[Device.DeviceId] = TRUE;
+
+            snprintf(Line, sizeof(Line), "Device %04x [Model %u]", Device.DeviceId, TestPciIdIndexRandom(&State) % 1000);
+            Device.Name = Line;
+
+            for (UINT32 k = 0; k < NumberOfSubsystems; k++)
+            {
+                TEST_PCI_ID_SUBSYSTEM Subsystem;
+
+                Subsystem.SubVendorId = (UINT16)TestPciIdIndexRandom(&State);
+                Subsystem.SubDeviceId = (UINT16)(Device.DeviceId + k);
+
+                //
+                // The names of the subsystems are repeated (they're interned)
+                //
+                snprintf(Line, sizeof(Line), "Generic Subsystem %u", TestPciIdIndexRandom(&State) % 64);
+                Subsystem.Name = Line;
+
+                Device.Subsystems.push_back(Subsystem);
+            }
+
+            Vendor.Devices.push_back(Device);
+        }
+
+        Vendors.push_back(Vendor);
+    }
+
+    //
+    // A name that is longer than the maximum length is truncated
+    //
+    Vendors[0].Name = "Long " + std::string(300, 'x');
+
+    Text = "#\r\n#\tList of PCI ID's (generated for the tests)\r\n#\r\n\r\n";
+
+    for (const TEST_PCI_ID_VENDOR & Vendor : Vendors)
+    {
+        snprintf(Line, sizeof(Line), "%04x  ", Vendor.VendorId);
+        Text += Line + Vendor.Name + "\r\n";
+
+        for (const TEST_PCI_ID_DEVICE & Device : Vendor.Devices)
+        {
+            snprintf(Line, sizeof(Line), "\t%04x  ", Device.DeviceId);
+            Text += Line + Device.Name + "\r\n";
+
+            //
+            // Comments between the entries don't end the current device
+            //
+            Text += "#\tcomment of the device\r\n";
+
+            for (const TEST_PCI_ID_SUBSYSTEM & Subsystem : Device.Subsystems)
+            {
+                snprintf(Line, sizeof(Line), "\t\t%04x %04x  ", Subsystem.SubVendorId, Subsystem.SubDeviceId);
+                Text += Line + Subsystem.Name + "\r\n";
+            }
+        }
+    }
+
+    Text += "\r\n# List of known device classes, subclasses and programming interfaces\r\n\r\n"
+            "C 0c  Serial bus controller\r\n"
+            "\t03  USB controller\r\n"
+            "\t\t30  XHCI\r\n"
+            "\tffff  Not a device of the previous vendor\r\n";
+
+    Vendors[0].Name.resize(PCI_ID_INDEX_MAXIMUM_NAME_LENGTH);
+}
+
+/**
+ * @brief Resolve an ID by scanning the text (the previous way of the PCI ID database)
+ *
+ * @param Text
+ * @param Query
+ *
+ * @return VOID
+ */
+static VOID
+TestPciIdIndexScanText(const std::string & Text, TEST_PCI_ID_QUERY & Query)
+{
+    const CHAR * Current     = Text.c_str();
+    const CHAR * LineBreak   = NULL;
+    BOOLEAN      FoundVendor = FALSE;
+    UINT32       Id;
+    CHAR         Line[1024];
+    CHAR         Name[PCI_ID_INDEX_MAXIMUM_NAME_LENGTH + 1];
+
+    Query.VendorName.clear();
+    Query.DeviceName.clear();
+
+    while ((LineBreak = strchr(Current, '\n')) != NULL)
+    {
+        size_t Length = min((size_t)(LineBreak - Current), sizeof(Line) - 1);
+
+        memcpy(Line, Current, Length);
+        Line[Length] = '\0';
+        Current      = LineBreak + 1;
+
+        if (Length != 0 && Line[Length - 1] == '\r')
+        {
+            Line[Length - 1] = '\0';
+        }
+
+        if (Line[0] == '#' || Line[0] == '\0')
+        {
+            continue;
+        }
+
+        if (Line[0] != '\t')
+        {
+            if (FoundVendor)
+            {
+                break;
+            }
+
+            if (sscanf(Line, "%4x %254[^\n]", &Id, Name) == 2 && Id == Query.VendorId)
+            {
+                Query.VendorName = Name;
+                FoundVendor      = TRUE;
+            }
+        }
+        else if (FoundVendor && Line[1] != '\t')
+        {
+            if (sscanf(Line + 1, "%4x %254[^\n]", &Id, Name) == 2 && Id == Query.DeviceId)
+            {
+                Query.DeviceName = Name;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Resolve an ID with the index
+ *
+ * @param Index
+ * @param Query
+ *
+ * @return VOID
+ */
+static VOID
+TestPciIdIndexResolve(const PCI_ID_INDEX_HEADER * Index, TEST_PCI_ID_QUERY & Query)
+{
+    const PCI_ID_INDEX_VENDOR *    Vendor;
+    const PCI_ID_INDEX_DEVICE *    Device    = NULL;
+    const PCI_ID_INDEX_SUBSYSTEM * Subsystem = NULL;
+
+    Vendor = PciIdIndexFindVendor(Index, Query.VendorId);
+
+    if (Vendor != NULL)
+    {
+        Device = PciIdIndexFindDevice(Index, Vendor, Query.DeviceId);
+    }
+
+    if (Device != NULL)
+    {
+        Subsystem = PciIdIndexFindSubsystem(Index, Device, Query.SubVendorId, Query.SubDeviceId);
+    }
+
+    Query.VendorName    = Vendor != NULL ? PciIdIndexGetName(Index, Vendor->NameOffset) : "";
+    Query.DeviceName    = Device != NULL ? PciIdIndexGetName(Index, Device->NameOffset) : "";
+    Query.SubsystemName = Subsystem != NULL ? PciIdIndexGetName(Index, Subsystem->NameOffset) : "";
+}
+
+/**
+ * @brief Test the binary index of the PCI ID database
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestPciIdIndex()
+{
+    std::vector<TEST_PCI_ID_VENDOR> Vendors;
+    std::vector<TEST_PCI_ID_QUERY>  Queries;
+    std::vector<TEST_PCI_ID_QUERY>  Expected;
+    std::string                     Text;
+    std::vector<UINT8>              Cache;
+    PPCI_ID_INDEX_HEADER            Index;
+    PPCI_ID_INDEX_HEADER            CachedIndex;
+    UINT64                          State            = 0x2545f4914f6cdd1dull;
+    UINT64                          SourceTimestamp  = 0x01dc1234abcd0000ull;
+    UINT32                          NumberOfMismatch = 0;
+    BOOLEAN                         OverallResult    = TRUE;
+    double                          ScanTime;
+    double                          BuildTime;
+    double                          LoadTime;
+    double                          LookupTime;
+
+    TestPciIdIndexGenerate(Vendors, Text);
+
+    //
+    // The IDs to resolve (a quarter of them are unknown)
+    //
+    for (UINT32 i = 0; i < TEST_PCI_ID_INDEX_NUMBER_OF_QUERIES; i++)
+    {
+        TEST_PCI_ID_QUERY          Query  = {};
+        const TEST_PCI_ID_VENDOR & Vendor = Vendors[TestPciIdIndexRandom(&State) % Vendors.size()];
+
+        Query.VendorId    = Vendor.VendorId;
+        Query.DeviceId    = (UINT16)TestPciIdIndexRandom(&State);
+        Query.SubVendorId = (UINT16)TestPciIdIndexRandom(&State);
+        Query.SubDeviceId = (UINT16)TestPciIdIndexRandom(&State);
+
+        if (i % 4 == 0)
+        {
+            Query.VendorId = 0xffff;
+        }
+        else
+        {
+            Query.VendorName = Vendor.Name;
+
+            if (!Vendor.Devices.empty() && i % 4 != 1)
+            {
+                const TEST_PCI_ID_DEVICE & Device = Vendor.Devices[TestPciIdIndexRandom(&State) % Vendor.Devices.size()];
+
+                Query.DeviceId   = Device.DeviceId;
+                Query.DeviceName = Device.Name;
+
+                if (!Device.Subsystems.empty())
+                {
+                    const TEST_PCI_ID_SUBSYSTEM & Subsystem = Device.Subsystems[TestPciIdIndexRandom(&State) % Device.Subsystems.size()];
+
+                    Query.SubVendorId   = Subsystem.SubVendorId;
+                    Query.SubDeviceId   = Subsystem.SubDeviceId;
+                    Query.SubsystemName = Subsystem.Name;
+                }
+            }
+            else
+            {
+                for (const TEST_PCI_ID_DEVICE & Device : Vendor.Devices)
+                {
+                    if (Device.DeviceId == Query.DeviceId)
+                    {
+                        Query.DeviceName = Device.Name;
+                    }
+                }
+            }
+        }
+
+        Expected.push_back(Query);
+    }
+
+    printf("[*] generated database : %zu bytes, %u vendors, %u queries\n",
+           Text.size(),
+           TEST_PCI_ID_INDEX_NUMBER_OF_VENDORS,
+           TEST_PCI_ID_INDEX_NUMBER_OF_QUERIES);
+
+    //
+    // The previous way: scan the text for each of the IDs
+    //
+    Queries    = Expected;
+    auto Start = std::chrono::high_resolution_clock::now();
+
+    for (TEST_PCI_ID_QUERY & Query : Queries)
+    {
+        TestPciIdIndexScanText(Text, Query);
+    }
+
+    ScanTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+    for (UINT32 i = 0; i < Queries.size(); i++)
+    {
+        if (Queries[i].VendorName != Expected[i].VendorName || Queries[i].DeviceName != Expected[i].DeviceName)
+        {
+            NumberOfMismatch++;
+        }
+    }
+
+    if (NumberOfMismatch != 0)
+    {
+        printf("[-] the scan of the text doesn't match the database (%u IDs)\n", NumberOfMismatch);
+        OverallResult = FALSE;
+    }
+
+    //
+    // Build the index (once per change of the pci.ids)
+    //
+    Start = std::chrono::high_resolution_clock::now();
+    Index = PciIdIndexBuild(Text.c_str(), Text.size(), SourceTimestamp);
+
+    BuildTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+    if (Index == NULL)
+    {
+        printf("[-] unable to build the index\n");
+        return FALSE;
+    }
+
+    printf("[*] index : %u bytes, %u vendors, %u devices, %u subsystems, %u bytes of names\n",
+           Index->TotalSize,
+           Index->NumberOfVendors,
+           Index->NumberOfDevices,
+           Index->NumberOfSubsystems,
+           Index->NamePoolSize);
+
+    if (Index->NumberOfVendors != TEST_PCI_ID_INDEX_NUMBER_OF_VENDORS)
+    {
+        printf("[-] the classes are indexed as vendors or devices\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Load the index from the "disk"
+    //
+    Cache.assign((const UINT8 *)Index, (const UINT8 *)Index + Index->TotalSize);
+    free(Index);
+
+    Start = std::chrono::high_resolution_clock::now();
+
+    if (!PciIdIndexIsValid((PPCI_ID_INDEX_HEADER)Cache.data(), Cache.size(), Text.size(), SourceTimestamp))
+    {
+        printf("[-] the cached index is not valid\n");
+        return FALSE;
+    }
+
+    LoadTime    = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+    CachedIndex = (PPCI_ID_INDEX_HEADER)Cache.data();
+
+    //
+    // Resolve the IDs with the index
+    //
+    Queries          = Expected;
+    NumberOfMismatch = 0;
+    Start            = std::chrono::high_resolution_clock::now();
+
+    for (TEST_PCI_ID_QUERY & Query : Queries)
+    {
+        TestPciIdIndexResolve(CachedIndex, Query);
+    }
+
+    LookupTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+    for (UINT32 i = 0; i < Queries.size(); i++)
+    {
+        if (Queries[i].VendorName != Expected[i].VendorName ||
+            Queries[i].DeviceName != Expected[i].DeviceName ||
+            Queries[i].SubsystemName != Expected[i].SubsystemName)
+        {
+            NumberOfMismatch++;
+        }
+    }
+
+    if (NumberOfMismatch != 0)
+    {
+        printf("[-] the index doesn't match the database (%u IDs)\n", NumberOfMismatch);
+        OverallResult = FALSE;
+    }
+
+    printf("[*] scanning the text : %.2f ms\n", ScanTime);
+    printf("[*] building the index : %.2f ms, loading the cached index : %.3f ms, resolving : %.3f ms\n", BuildTime, LoadTime, LookupTime);
+    printf("[*] resolving with the index is %.0fx faster than scanning the text (%.0fx with building the index)\n",
+           LookupTime == 0 ? 0.0 : ScanTime / LookupTime,
+           ScanTime / (BuildTime + LookupTime));
+
+    //
+    // The stale or corrupted indexes are rejected
+    //
+    if (PciIdIndexIsValid(CachedIndex, Cache.size(), Text.size() + 1, SourceTimestamp) ||
+        PciIdIndexIsValid(CachedIndex, Cache.size(), Text.size(), SourceTimestamp + 1))
+    {
+        printf("[-] the stale index is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    if (PciIdIndexIsValid(CachedIndex, Cache.size() - 1, Text.size(), SourceTimestamp) ||
+        PciIdIndexIsValid(CachedIndex, sizeof(PCI_ID_INDEX_HEADER) - 1, Text.size(), SourceTimestamp))
+    {
+        printf("[-] the truncated index is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    ((PPCI_ID_INDEX_VENDOR)(CachedIndex + 1))[0].NumberOfDevices = MAXUINT32;
+
+    if (PciIdIndexIsValid(CachedIndex, Cache.size(), Text.size(), SourceTimestamp))
+    {
+        printf("[-] the corrupted index is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // An empty database
+    //
+    Index = PciIdIndexBuild("", 0, 0);
+
+    if (Index == NULL || !PciIdIndexIsValid(Index, Index->TotalSize, 0, 0) || PciIdIndexFindVendor(Index, 0x8086) != NULL)
+    {
+        printf("[-] the index of an empty database is not valid\n");
+        OverallResult = FALSE;
+    }
+
+    free(Index);
+
+    return OverallResult;
+}
@@ -0,0 +1,481 @@
+/**
+ * @file test-pci-walk.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the topology-aware enumeration of the PCI devices
+ * @details The walk is tested against a simulated configuration space
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of random topologies of the test
+ *
+ */
+#define TEST_PCI_WALK_NUMBER_OF_RANDOM_TOPOLOGIES 200
+
+/**
+ * @brief A function of the simulated configuration space (its first 64 bytes)
+ *
+ */
+typedef struct _TEST_PCI_WALK_FUNCTION
+{
+    UINT32 Header[16];
+
+} TEST_PCI_WALK_FUNCTION;
+
+/**
+ * @brief The simulated configuration space
+ *
+ */
+typedef struct _TEST_PCI_WALK_CONFIG_SPACE
+{
+    std::map<UINT32, TEST_PCI_WALK_FUNCTION> Functions; // Key is (Bus << 8) | (Device << 3) | Function
+    std::set<UINT32>                         AliasedDevices; // (Bus << 8) | (Device << 3) of the devices that answer on all functions
+    std::vector<UINT32>                      Found;
+    UINT32                                   MaximumFound;
+    UINT32                                   NextBus;
+    UINT64                                   State;
+
+} TEST_PCI_WALK_CONFIG_SPACE, *PTEST_PCI_WALK_CONFIG_SPACE;
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT32
+ */
+static UINT32
+TestPciWalkRandom(UINT64 * State)
+{
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return (UINT32)(*State >> 16);
+}
+
+/**
+ * @brief Add a function to the simulated configuration space
+ *
+ * @param ConfigSpace
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param ClassCode Class, subclass and programming interface
+ * @param HeaderType
+ *
+ * @return TEST_PCI_WALK_FUNCTION &
+ */
+static TEST_PCI_WALK_FUNCTION &
+TestPciWalkAddFunction(PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace, UINT32 Bus, UINT32 Device, UINT32 Function, UINT32 ClassCode, UINT8 HeaderType)
+{
+    TEST_PCI_WALK_FUNCTION & Entry = ConfigSpace->Functions[(Bus << 8) | (Device << 3) | Function];
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    Entry.Header[PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID / 4] = ((0x1000 + Bus * 0x100 + Device * 8 + Function) << 16) | 0x8086;
+    Entry.Header[PCI_WALK_OFFSET_CLASS_CODE_REVISION / 4] = (ClassCode << 8) | 0x01;
+    Entry.Header[PCI_WALK_OFFSET_HEADER_TYPE / 4]         = (UINT32)HeaderType << 16;
+
+    return Entry;
+}
+
+/**
+ * @brief Set the bus numbers of a simulated bridge
+ *
+ * @param Entry
+ * @param PrimaryBus
+ * @param SecondaryBus
+ * @param SubordinateBus
+ *
+ * @return VOID
+ */
+static VOID
+TestPciWalkSetBusNumbers(TEST_PCI_WALK_FUNCTION & Entry, UINT32 PrimaryBus, UINT32 SecondaryBus, UINT32 SubordinateBus)
+{
+    Entry.Header[PCI_WALK_OFFSET_BRIDGE_BUS_NUMBERS / 4] = PrimaryBus | (SecondaryBus << 8) | (SubordinateBus << 16);
+}
+
+/**
+ * @brief Read a DWORD of the simulated configuration space
+ *
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param Offset
+ * @param Context
+ *
+ * @return UINT32
+ */
+static UINT32
+TestPciWalkRead(UINT8 Bus, UINT8 Device, UINT8 Function, UINT8 Offset, PVOID Context)
+{
+    PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace = (PTEST_PCI_WALK_CONFIG_SPACE)Context;
+    UINT32                      Key         = ((UINT32)Bus << 8) | ((UINT32)Device << 3) | Function;
+
+    //
+    // Some of the single-function devices decode the function number
+    // partially and answer with function 0 on all functions
+    //
+    if (ConfigSpace->AliasedDevices.count(Key & ~7u))
+    {
+        Key &= ~7u;
+    }
+
+    auto Entry = ConfigSpace->Functions.find(Key);
+
+    if (Entry == ConfigSpace->Functions.end() || Offset >= sizeof(Entry->second.Header))
+    {
+        return 0xffffffff;
+    }
+
+    return Entry->second.Header[Offset / 4];
+}
+
+/**
+ * @brief Receive the functions that are found
+ *
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param DeviceIdVendorId
+ * @param ClassCodeRevision
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestPciWalkAddFound(UINT8 Bus, UINT8 Device, UINT8 Function, UINT32 DeviceIdVendorId, UINT32 ClassCodeRevision, PVOID Context)
+{
+    PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace = (PTEST_PCI_WALK_CONFIG_SPACE)Context;
+    UINT32                      Key         = ((UINT32)Bus << 8) | ((UINT32)Device << 3) | Function;
+
+    UNREFERENCED_PARAMETER(ClassCodeRevision);
+
+    if (ConfigSpace->Found.size() == ConfigSpace->MaximumFound)
+    {
+        return FALSE;
+    }
+
+    if (DeviceIdVendorId != TestPciWalkRead(Bus, Device, Function, PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID, Context))
+    {
+        return FALSE;
+    }
+
+    ConfigSpace->Found.push_back(Key);
+
+    return TRUE;
+}
+
+/**
+ * @brief Probe all of the bus, device and function numbers (the previous way of '!pcitree')
+ *
+ * @param ConfigSpace
+ * @param NumberOfReads
+ *
+ * @return VOID
+ */
+static VOID
+TestPciWalkBruteForce(PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace, UINT32 * NumberOfReads)
+{
+    *NumberOfReads = 0;
+
+    ConfigSpace->Found.clear();
+
+    for (UINT32 b = 0; b < BUS_MAX_NUM; b++)
+    {
+        for (UINT32 d = 0; d < DEVICE_MAX_NUM; d++)
+        {
+            for (UINT32 f = 0; f < FUNCTION_MAX_NUM; f++)
+            {
+                (*NumberOfReads)++;
+
+                if (TestPciWalkRead((UINT8)b, (UINT8)d, (UINT8)f, 0, ConfigSpace) != 0xffffffff)
+                {
+                    (*NumberOfReads)++;
+                    ConfigSpace->Found.push_back((b << 8) | (d << 3) | f);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Walk the simulated topology
+ *
+ * @param ConfigSpace
+ * @param MaximumFound
+ * @param Walk
+ *
+ * @return VOID
+ */
+static VOID
+TestPciWalkRun(PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace, UINT32 MaximumFound, PPCI_WALK Walk)
+{
+    memset(Walk, 0, sizeof(PCI_WALK));
+
+    ConfigSpace->Found.clear();
+    ConfigSpace->MaximumFound = MaximumFound;
+
+    Walk->Read     = TestPciWalkRead;
+    Walk->Function = TestPciWalkAddFound;
+    Walk->Context  = ConfigSpace;
+
+    PciWalkTopology(Walk);
+}
+
+/**
+ * @brief Get the functions of the simulated configuration space in order
+ *
+ * @param ConfigSpace
+ *
+ * @return std::vector<UINT32>
+ */
+static std::vector<UINT32>
+TestPciWalkGetExpected(PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace)
+{
+    std::vector<UINT32> Expected;
+
+    for (const auto & Entry : ConfigSpace->Functions)
+    {
+        Expected.push_back(Entry.first);
+    }
+
+    return Expected;
+}
+
+/**
+ * @brief Add a random bus (and the buses behind its bridges) the way the
+ * firmware numbers the buses (depth first)
+ *
+ * @param ConfigSpace
+ * @param Bus
+ * @param Depth
+ *
+ * @return VOID
+ */
+static VOID
+TestPciWalkAddRandomBus(PTEST_PCI_WALK_CONFIG_SPACE ConfigSpace, UINT32 Bus, UINT32 Depth)
+{
+    UINT32 NumberOfDevices = TestPciWalkRandom(&ConfigSpace->State) % 6;
+
+    for (UINT32 i = 0; i < NumberOfDevices; i++)
+    {
+        UINT32  Device          = TestPciWalkRandom(&ConfigSpace->State) % DEVICE_MAX_NUM;
+        BOOLEAN IsMultiFunction = TestPciWalkRandom(&ConfigSpace->State) % 3 == 0;
+        UINT32  Functions       = IsMultiFunction ? (TestPciWalkRandom(&ConfigSpace->State) & 0xfe) | 1 : 1;
+
+        if (ConfigSpace->Functions.count((Bus << 8) | (Device << 3)))
+        {
+            continue;
+        }
+
+        for (UINT32 f = 0; f < FUNCTION_MAX_NUM; f++)
+        {
+            BOOLEAN IsBridge = Depth < 4 && ConfigSpace->NextBus < BUS_MAX_NUM - 1 && TestPciWalkRandom(&ConfigSpace->State) % 3 == 0;
+            UINT8   HeaderType;
+
+            if (!(Functions & (1 << f)))
+            {
+                continue;
+            }
+
+            HeaderType = (IsBridge ? PCI_WALK_HEADER_TYPE_PCI_BRIDGE : 0) | (f == 0 && IsMultiFunction ? PCI_WALK_HEADER_TYPE_MULTI_FUNCTION : 0);
+
+            TEST_PCI_WALK_FUNCTION & Entry = TestPciWalkAddFunction(ConfigSpace, Bus, Device, f, IsBridge ? 0x060400 : 0x010802, HeaderType);
+
+            if (IsBridge)
+            {
+                UINT32 SecondaryBus = ++ConfigSpace->NextBus;
+
+                TestPciWalkAddRandomBus(ConfigSpace, SecondaryBus, Depth + 1);
+                TestPciWalkSetBusNumbers(Entry, Bus, SecondaryBus, ConfigSpace->NextBus);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compare the found functions with the expected functions
+ *
+ * @param Name
+ * @param Found
+ * @param Expected
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestPciWalkCheck(const CHAR * Name, const std::vector<UINT32> & Found, const std::vector<UINT32> & Expected)
+{
+    if (Found != Expected)
+    {
+        printf("[-] %s : %zu function(s) are found instead of %zu\n", Name, Found.size(), Expected.size());
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the topology-aware enumeration of the PCI devices
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestPciWalk()
+{
+    TEST_PCI_WALK_CONFIG_SPACE ConfigSpace = {};
+    PCI_WALK                   Walk;
+    std::vector<UINT32>        Expected;
+    UINT32                     BruteForceReads;
+    UINT64                     TotalBruteForceReads = 0;
+    UINT64                     TotalWalkReads       = 0;
+    BOOLEAN                    OverallResult        = TRUE;
+
+    //
+    // A typical machine: a host bridge, root ports (as functions of a
+    // multi-function device), a GPU, a switch with two NVMe drives behind it,
+    // an unconfigured bridge and a chipset with a few functions
+    //
+    TestPciWalkAddFunction(&ConfigSpace, 0, 0, 0, 0x060000, 0);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 0, 1, 0, 0x060400, PCI_WALK_HEADER_TYPE_MULTI_FUNCTION | PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 0, 1, 1);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 0, 1, 1, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 0, 2, 5);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 0, 0x1c, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 0, 0, 0);
+    TestPciWalkAddFunction(&ConfigSpace, 0, 0x1f, 0, 0x060100, PCI_WALK_HEADER_TYPE_MULTI_FUNCTION);
+    TestPciWalkAddFunction(&ConfigSpace, 0, 0x1f, 3, 0x040300, 0);
+    TestPciWalkAddFunction(&ConfigSpace, 0, 0x1f, 4, 0x0c0500, 0);
+    TestPciWalkAddFunction(&ConfigSpace, 1, 0, 0, 0x030000, PCI_WALK_HEADER_TYPE_MULTI_FUNCTION);
+    TestPciWalkAddFunction(&ConfigSpace, 1, 0, 1, 0x040300, 0);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 2, 0, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 2, 3, 5);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 3, 0, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 3, 4, 4);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 3, 1, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 3, 5, 5);
+    TestPciWalkAddFunction(&ConfigSpace, 4, 0, 0, 0x010802, 0);
+    TestPciWalkAddFunction(&ConfigSpace, 5, 0, 0, 0x010802, 0);
+
+    Expected = TestPciWalkGetExpected(&ConfigSpace);
+
+    TestPciWalkBruteForce(&ConfigSpace, &BruteForceReads);
+
+    if (!TestPciWalkCheck("brute force", ConfigSpace.Found, Expected))
+    {
+        OverallResult = FALSE;
+    }
+
+    TestPciWalkRun(&ConfigSpace, MAXUINT32, &Walk);
+
+    if (!TestPciWalkCheck("typical topology", ConfigSpace.Found, Expected) || Walk.NumberOfBuses != 6 || Walk.IsStopped)
+    {
+        OverallResult = FALSE;
+    }
+
+    printf("[*] typical topology : %zu functions on %u buses, %u reads instead of %u\n",
+           Expected.size(),
+           Walk.NumberOfBuses,
+           Walk.NumberOfReads,
+           BruteForceReads);
+
+    //
+    // The walk stops once the callback doesn't accept more functions
+    //
+    TestPciWalkRun(&ConfigSpace, 5, &Walk);
+
+    if (!Walk.IsStopped || ConfigSpace.Found.size() != 5 || !std::equal(ConfigSpace.Found.begin(), ConfigSpace.Found.end(), Expected.begin()))
+    {
+        printf("[-] the walk is not stopped by the callback\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // A single-function device that answers on all of its functions is
+    // reported once (probing all of the functions reports it eight times)
+    //
+    ConfigSpace.AliasedDevices.insert((5 << 8) | (0 << 3));
+
+    TestPciWalkRun(&ConfigSpace, MAXUINT32, &Walk);
+
+    if (!TestPciWalkCheck("aliased functions", ConfigSpace.Found, Expected))
+    {
+        OverallResult = FALSE;
+    }
+
+    ConfigSpace.AliasedDevices.clear();
+
+    //
+    // A multi-function host bridge, each of its functions is the host bridge
+    // of another root bus
+    //
+    ConfigSpace.Functions.clear();
+
+    TestPciWalkAddFunction(&ConfigSpace, 0, 0, 0, 0x060000, PCI_WALK_HEADER_TYPE_MULTI_FUNCTION);
+    TestPciWalkAddFunction(&ConfigSpace, 0, 0, 1, 0x060000, 0);
+    TestPciWalkAddFunction(&ConfigSpace, 0, 2, 0, 0x030000, 0);
+    TestPciWalkAddFunction(&ConfigSpace, 1, 3, 0, 0x020000, 0);
+
+    Expected = TestPciWalkGetExpected(&ConfigSpace);
+
+    TestPciWalkRun(&ConfigSpace, MAXUINT32, &Walk);
+
+    if (!TestPciWalkCheck("multiple host bridges", ConfigSpace.Found, Expected))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Bridges with invalid bus numbers (loops) are not followed
+    //
+    ConfigSpace.Functions.clear();
+
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 0, 0, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 0, 1, 1);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 1, 0, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 1, 0, 0xff);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 1, 1, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 1, 1, 1);
+    TestPciWalkSetBusNumbers(TestPciWalkAddFunction(&ConfigSpace, 1, 2, 0, 0x060400, PCI_WALK_HEADER_TYPE_PCI_BRIDGE), 1, 3, 2);
+
+    Expected = TestPciWalkGetExpected(&ConfigSpace);
+
+    TestPciWalkRun(&ConfigSpace, MAXUINT32, &Walk);
+
+    if (!TestPciWalkCheck("invalid bridges", ConfigSpace.Found, Expected) || Walk.NumberOfBuses != 2)
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Random topologies
+    //
+    ConfigSpace.State = 0x9e3779b97f4a7c15ull;
+
+    for (UINT32 i = 0; i < TEST_PCI_WALK_NUMBER_OF_RANDOM_TOPOLOGIES; i++)
+    {
+        ConfigSpace.Functions.clear();
+        ConfigSpace.NextBus = 0;
+
+        TestPciWalkAddFunction(&ConfigSpace, 0, 0, 0, 0x060000, 0);
+        TestPciWalkAddRandomBus(&ConfigSpace, 0, 0);
+
+        Expected = TestPciWalkGetExpected(&ConfigSpace);
+
+        TestPciWalkBruteForce(&ConfigSpace, &BruteForceReads);
+        TestPciWalkRun(&ConfigSpace, MAXUINT32, &Walk);
+
+        TotalBruteForceReads += BruteForceReads;
+        TotalWalkReads += Walk.NumberOfReads;
+
+        if (!TestPciWalkCheck("random topology", ConfigSpace.Found, Expected))
+        {
+            OverallResult = FALSE;
+            break;
+        }
+    }
+
+    printf("[*] %u random topologies : %llu reads on average instead of %llu\n",
+           TEST_PCI_WALK_NUMBER_OF_RANDOM_TOPOLOGIES,
+           TotalWalkReads / TEST_PCI_WALK_NUMBER_OF_RANDOM_TOPOLOGIES,
+           TotalBruteForceReads / TEST_PCI_WALK_NUMBER_OF_RANDOM_TOPOLOGIES);
+
+    return OverallResult;
+}
@@ -0,0 +1,1119 @@
+/**
+ * @file test-pt-decode.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the decoder of the Intel Processor Trace packets
+ * @details A synthetic program (user-mode and kernel-mode functions with
+ * the conditional, indirect and far branches) is executed, and its trace
+ * is recorded the same way as the processor records it (TNT, compressed
+ * returns and IPs, PSB+, interrupts, filtering by the privilege and
+ * overflows), then the decoded instructions are compared with the executed
+ * ones, also from the middle of the stream (a circular buffer)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The synthetic program and its trace
+ *
+ */
+#define TEST_PT_DECODE_USER_BASE           0x00007ff612340000ull
+#define TEST_PT_DECODE_KERNEL_BASE         0xfffff80012340000ull
+#define TEST_PT_DECODE_FUNCTION_SIZE       0x400
+#define TEST_PT_DECODE_USER_FUNCTIONS      48
+#define TEST_PT_DECODE_KERNEL_FUNCTIONS    24
+#define TEST_PT_DECODE_INSTRUCTIONS        2000000
+#define TEST_PT_DECODE_PSB_PERIOD          0x1000 // Bytes between the PSBs
+#define TEST_PT_DECODE_CR3                 0x1aa000
+#define TEST_PT_DECODE_MARKER              0xdead000000000000ull // Gaps of the flow (the status is the lowest byte)
+#define TEST_PT_DECODE_MAXIMUM_TAIL        256                   // Instructions that are walked after a truncated stream
+#define TEST_PT_DECODE_NUMBER_OF_ROTATIONS 64
+
+/**
+ * @brief Kinds of the instructions of the synthetic program
+ *
+ */
+typedef enum _TEST_PT_DECODE_KIND
+{
+    TEST_PT_DECODE_KIND_OTHER,
+    TEST_PT_DECODE_KIND_JCC,
+    TEST_PT_DECODE_KIND_JMP,
+    TEST_PT_DECODE_KIND_CALL,
+    TEST_PT_DECODE_KIND_JMP_INDIRECT,
+    TEST_PT_DECODE_KIND_CALL_INDIRECT,
+    TEST_PT_DECODE_KIND_RET,
+    TEST_PT_DECODE_KIND_SYSCALL,
+    TEST_PT_DECODE_KIND_SYSRET,
+    TEST_PT_DECODE_KIND_IRET,
+
+} TEST_PT_DECODE_KIND;
+
+/**
+ * @brief An instruction of the synthetic program
+ *
+ */
+typedef struct _TEST_PT_DECODE_CODE
+{
+    PT_DECODE_INSTRUCTION Instruction;
+    TEST_PT_DECODE_KIND   Kind;
+    std::vector<UINT64>   Targets; // Targets of the indirect branches
+
+} TEST_PT_DECODE_CODE;
+
+typedef std::unordered_map<UINT64, TEST_PT_DECODE_CODE> TEST_PT_DECODE_PROGRAM;
+
+/**
+ * @brief A PSB of the recorded trace
+ *
+ */
+typedef struct _TEST_PT_DECODE_PSB
+{
+    UINT64 Offset;
+    UINT64 ExpectedIndex; // The first expected entry after the PSB
+
+} TEST_PT_DECODE_PSB;
+
+/**
+ * @brief The recorded trace and the executed flow
+ *
+ */
+typedef struct _TEST_PT_DECODE_TRACE
+{
+    std::vector<UINT8>              Bytes;
+    std::vector<UINT64>             Expected; // The executed IPs and the gaps (TEST_PT_DECODE_MARKER)
+    std::vector<TEST_PT_DECODE_PSB> Psbs;
+
+} TEST_PT_DECODE_TRACE;
+
+/**
+ * @brief The state of the encoder (the processor)
+ *
+ */
+typedef struct _TEST_PT_DECODE_ENCODER
+{
+    TEST_PT_DECODE_TRACE * Trace;
+    UINT64                 LastIp;
+    UINT64                 TntBits;
+    UINT32                 TntCount;
+    UINT64                 ReturnStack[PT_DECODE_RETURN_STACK_SIZE];
+    UINT32                 ReturnStackTop;
+    UINT32                 ReturnStackCount;
+    UINT64                 LastPsbOffset;
+    UINT64                 Seed;
+
+} TEST_PT_DECODE_ENCODER;
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestPtDecodeRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief Generate the functions of a privilege level
+ * @details The functions only call the next functions (no recursion), the
+ * last instruction of the first functions is special (the loop of the
+ * program, SYSRET of the system call handler and IRET of the interrupt
+ * handler)
+ *
+ * @param Program
+ * @param Base
+ * @param NumberOfFunctions
+ * @param IsKernel
+ * @param Seed
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeGenerateFunctions(TEST_PT_DECODE_PROGRAM & Program,
+                              UINT64                   Base,
+                              UINT32                   NumberOfFunctions,
+                              BOOLEAN                  IsKernel,
+                              UINT64 *                 Seed)
+{
+    for (UINT32 Function = 0; Function < NumberOfFunctions; Function++)
+    {
+        std::vector<TEST_PT_DECODE_CODE> Body(8 + TestPtDecodeRandom(Seed) % 40);
+        UINT64                           Address = Base + (UINT64)Function * TEST_PT_DECODE_FUNCTION_SIZE;
+        UINT32                           Callees = IsKernel && Function < 2 ? 2 : Function + 1; // The handlers are not called
+        BOOLEAN                          IsLeaf  = Callees >= NumberOfFunctions;
+
+        for (size_t i = 0; i < Body.size(); i++)
+        {
+            UINT64 Random = TestPtDecodeRandom(Seed) % 100;
+
+            Body[i].Instruction.Ip     = Address;
+            Body[i].Instruction.Length = 1 + (UINT32)(TestPtDecodeRandom(Seed) % 15);
+            Body[i].Kind               = TEST_PT_DECODE_KIND_OTHER;
+
+            Address += Body[i].Instruction.Length;
+
+            if (i == 0 || i + 1 == Body.size())
+            {
+                continue;
+            }
+            else if (Random < 15)
+            {
+                Body[i].Kind = TEST_PT_DECODE_KIND_JCC;
+            }
+            else if (Random < 18)
+            {
+                Body[i].Kind = TEST_PT_DECODE_KIND_JMP;
+            }
+            else if (Random < 26 && !IsLeaf)
+            {
+                Body[i].Kind = TEST_PT_DECODE_KIND_CALL;
+            }
+            else if (Random < 29 && !IsLeaf)
+            {
+                Body[i].Kind = TEST_PT_DECODE_KIND_CALL_INDIRECT;
+            }
+            else if (Random < 31)
+            {
+                Body[i].Kind = TEST_PT_DECODE_KIND_JMP_INDIRECT;
+            }
+            else if (Random < 32 && !IsKernel)
+            {
+                Body[i].Kind = TEST_PT_DECODE_KIND_SYSCALL;
+            }
+        }
+
+        //
+        // The entry function always calls (so each iteration of its loop
+        // has packets)
+        //
+        if (Function == 0 && !IsKernel)
+        {
+            Body[1].Kind = TEST_PT_DECODE_KIND_CALL;
+        }
+
+        Body.back().Kind = TEST_PT_DECODE_KIND_RET;
+
+        if (Function == 0)
+        {
+            Body.back().Kind = IsKernel ? TEST_PT_DECODE_KIND_SYSRET : TEST_PT_DECODE_KIND_JMP;
+        }
+        else if (Function == 1 && IsKernel)
+        {
+            Body.back().Kind = TEST_PT_DECODE_KIND_IRET;
+        }
+
+        //
+        // The targets of the branches
+        //
+        for (size_t i = 0; i < Body.size(); i++)
+        {
+            UINT64 Callee = Callees + TestPtDecodeRandom(Seed) % (IsLeaf ? 1 : NumberOfFunctions - Callees);
+            size_t Next   = i + 1 + TestPtDecodeRandom(Seed) % (Body.size() - i);
+
+            Next = Next < Body.size() ? Next : Body.size() - 1;
+
+            switch (Body[i].Kind)
+            {
+            case TEST_PT_DECODE_KIND_JCC:
+
+                //
+                // The backward branches are the loops
+                //
+                Body[i].Instruction.Class  = PT_DECODE_INSTRUCTION_CLASS_CONDITIONAL_BRANCH;
+                Body[i].Instruction.Target = Body[TestPtDecodeRandom(Seed) % 3 == 0 ? TestPtDecodeRandom(Seed) % i : Next].Instruction.Ip;
+                break;
+
+            case TEST_PT_DECODE_KIND_JMP:
+                Body[i].Instruction.Class  = PT_DECODE_INSTRUCTION_CLASS_DIRECT_JUMP;
+                Body[i].Instruction.Target = i + 1 == Body.size() ? Body[0].Instruction.Ip : Body[Next].Instruction.Ip;
+                break;
+
+            case TEST_PT_DECODE_KIND_CALL:
+                Body[i].Instruction.Class  = PT_DECODE_INSTRUCTION_CLASS_DIRECT_CALL;
+                Body[i].Instruction.Target = Base + Callee * TEST_PT_DECODE_FUNCTION_SIZE;
+                break;
+
+            case TEST_PT_DECODE_KIND_CALL_INDIRECT:
+
+                Body[i].Instruction.Class = PT_DECODE_INSTRUCTION_CLASS_INDIRECT_CALL;
+
+                for (UINT32 j = 0; j < 3; j++)
+                {
+                    Callee = Callees + TestPtDecodeRandom(Seed) % (NumberOfFunctions - Callees);
+                    Body[i].Targets.push_back(Base + Callee * TEST_PT_DECODE_FUNCTION_SIZE);
+                }
+                break;
+
+            case TEST_PT_DECODE_KIND_JMP_INDIRECT:
+
+                Body[i].Instruction.Class = PT_DECODE_INSTRUCTION_CLASS_INDIRECT_JUMP;
+
+                for (UINT32 j = 0; j < 3; j++)
+                {
+                    Next = i + 1 + TestPtDecodeRandom(Seed) % (Body.size() - i - 1);
+                    Body[i].Targets.push_back(Body[Next].Instruction.Ip);
+                }
+                break;
+
+            case TEST_PT_DECODE_KIND_RET:
+                Body[i].Instruction.Class = PT_DECODE_INSTRUCTION_CLASS_RETURN;
+                break;
+
+            case TEST_PT_DECODE_KIND_SYSCALL:
+            case TEST_PT_DECODE_KIND_SYSRET:
+            case TEST_PT_DECODE_KIND_IRET:
+                Body[i].Instruction.Class = PT_DECODE_INSTRUCTION_CLASS_FAR_TRANSFER;
+                break;
+
+            default:
+                Body[i].Instruction.Class = PT_DECODE_INSTRUCTION_CLASS_OTHER;
+                break;
+            }
+
+            Program[Body[i].Instruction.Ip] = Body[i];
+        }
+    }
+}
+
+/**
+ * @brief Classify the instructions of the synthetic program (the callback
+ * of the decoder)
+ *
+ * @param Context
+ * @param Cr3
+ * @param Is64Bit
+ * @param Instruction
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestPtDecodeClassify(PVOID Context, UINT64 Cr3, BOOLEAN Is64Bit, PPT_DECODE_INSTRUCTION Instruction)
+{
+    TEST_PT_DECODE_PROGRAM * Program = (TEST_PT_DECODE_PROGRAM *)Context;
+    auto                     Code    = Program->find(Instruction->Ip);
+
+    UNREFERENCED_PARAMETER(Cr3);
+    UNREFERENCED_PARAMETER(Is64Bit);
+
+    if (Code == Program->end())
+    {
+        return FALSE;
+    }
+
+    *Instruction = Code->second.Instruction;
+
+    return TRUE;
+}
+
+/**
+ * @brief Append bytes to the trace
+ *
+ * @param Encoder
+ * @param Value
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeEmit(TEST_PT_DECODE_ENCODER * Encoder, UINT64 Value, UINT32 Count)
+{
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Encoder->Trace->Bytes.push_back((UINT8)(Value >> (i * 8)));
+    }
+}
+
+/**
+ * @brief Write the pending TNT bits (a short or a long TNT)
+ *
+ * @param Encoder
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeFlushTnt(TEST_PT_DECODE_ENCODER * Encoder)
+{
+    UINT64 Value;
+
+    if (Encoder->TntCount == 0)
+    {
+        return;
+    }
+
+    Value = (1ull << Encoder->TntCount) | Encoder->TntBits;
+
+    if (Encoder->TntCount <= 6 && TestPtDecodeRandom(&Encoder->Seed) % 2 == 0)
+    {
+        TestPtDecodeEmit(Encoder, Value << 1, 1);
+    }
+    else
+    {
+        TestPtDecodeEmit(Encoder, 0xa302, 2);
+        TestPtDecodeEmit(Encoder, Value, 6);
+    }
+
+    Encoder->TntBits  = 0;
+    Encoder->TntCount = 0;
+}
+
+/**
+ * @brief Record a TNT bit
+ *
+ * @param Encoder
+ * @param IsTaken
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeTnt(TEST_PT_DECODE_ENCODER * Encoder, BOOLEAN IsTaken)
+{
+    Encoder->TntBits = (Encoder->TntBits << 1) | (IsTaken ? 1 : 0);
+
+    if (++Encoder->TntCount == 47)
+    {
+        TestPtDecodeFlushTnt(Encoder);
+    }
+}
+
+/**
+ * @brief Write a packet with an IP (TIP, TIP.PGE, TIP.PGD or FUP) with the
+ * shortest IP compression
+ *
+ * @param Encoder
+ * @param Header The header without IPBytes
+ * @param Ip
+ * @param IsSuppressed
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeIp(TEST_PT_DECODE_ENCODER * Encoder, UINT8 Header, UINT64 Ip, BOOLEAN IsSuppressed)
+{
+    UINT64 SignExtended = (Ip & (1ull << 47)) != 0 ? (Ip | 0xffff000000000000ull) : (Ip & 0x0000ffffffffffffull);
+
+    TestPtDecodeFlushTnt(Encoder);
+
+    if (IsSuppressed)
+    {
+        TestPtDecodeEmit(Encoder, Header, 1);
+        return;
+    }
+
+    if ((Ip >> 16) == (Encoder->LastIp >> 16))
+    {
+        TestPtDecodeEmit(Encoder, Header | (1 << 5), 1);
+        TestPtDecodeEmit(Encoder, Ip, 2);
+    }
+    else if ((Ip >> 32) == (Encoder->LastIp >> 32))
+    {
+        TestPtDecodeEmit(Encoder, Header | (2 << 5), 1);
+        TestPtDecodeEmit(Encoder, Ip, 4);
+    }
+    else if ((Ip >> 48) == (Encoder->LastIp >> 48) && TestPtDecodeRandom(&Encoder->Seed) % 2 == 0)
+    {
+        TestPtDecodeEmit(Encoder, Header | (4 << 5), 1);
+        TestPtDecodeEmit(Encoder, Ip, 6);
+    }
+    else if (SignExtended == Ip)
+    {
+        TestPtDecodeEmit(Encoder, Header | (3 << 5), 1);
+        TestPtDecodeEmit(Encoder, Ip, 6);
+    }
+    else
+    {
+        TestPtDecodeEmit(Encoder, Header | (6 << 5), 1);
+        TestPtDecodeEmit(Encoder, Ip, 8);
+    }
+
+    Encoder->LastIp = Ip;
+}
+
+/**
+ * @brief Write PSB+ (the synchronization point)
+ *
+ * @param Encoder
+ * @param Ip
+ * @param IsTraced
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodePsb(TEST_PT_DECODE_ENCODER * Encoder, UINT64 Ip, BOOLEAN IsTraced)
+{
+    TestPtDecodeFlushTnt(Encoder);
+
+    Encoder->Trace->Psbs.push_back({Encoder->Trace->Bytes.size(), Encoder->Trace->Expected.size()});
+    Encoder->LastPsbOffset = Encoder->Trace->Bytes.size();
+
+    for (UINT32 i = 0; i < PT_DECODE_PSB_SIZE / 2; i++)
+    {
+        TestPtDecodeEmit(Encoder, 0x8202, 2);
+    }
+
+    Encoder->LastIp           = 0;
+    Encoder->ReturnStackCount = 0;
+
+    TestPtDecodeEmit(Encoder, 0x4302, 2); // PIP
+    TestPtDecodeEmit(Encoder, (TEST_PT_DECODE_CR3 >> 5) << 1, 6);
+    TestPtDecodeEmit(Encoder, 0x0199, 2); // MODE.Exec (64-bit)
+    TestPtDecodeEmit(Encoder, 0x19, 1);   // TSC
+    TestPtDecodeEmit(Encoder, Encoder->Trace->Bytes.size() * 1000, 7);
+    TestPtDecodeEmit(Encoder, 0x2803, 2); // CBR
+    TestPtDecodeEmit(Encoder, 0, 2);
+
+    if (IsTraced)
+    {
+        TestPtDecodeIp(Encoder, 0x1d, Ip, FALSE);
+    }
+
+    TestPtDecodeEmit(Encoder, 0x2302, 2); // PSBEND
+}
+
+/**
+ * @brief Write a packet that doesn't change the flow (timing, power, ...)
+ *
+ * @param Encoder
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeNoise(TEST_PT_DECODE_ENCODER * Encoder)
+{
+    switch (TestPtDecodeRandom(&Encoder->Seed) % 10)
+    {
+    case 0:
+        TestPtDecodeEmit(Encoder, 0x00, 1); // PAD
+        break;
+    case 1:
+        TestPtDecodeEmit(Encoder, 0x1259, 2); // MTC
+        break;
+    case 2:
+        TestPtDecodeEmit(Encoder, 0x13, 1); // CYC
+        break;
+    case 3:
+        TestPtDecodeEmit(Encoder, 0x020317, 3); // CYC (3 bytes)
+        break;
+    case 4:
+        TestPtDecodeEmit(Encoder, 0x19, 1); // TSC
+        TestPtDecodeEmit(Encoder, 0x123456789abcull, 7);
+        break;
+    case 5:
+        TestPtDecodeEmit(Encoder, 0x7302, 2); // TMA
+        TestPtDecodeEmit(Encoder, 0x1234567, 5);
+        break;
+    case 6:
+        TestPtDecodeEmit(Encoder, 0x2099, 2); // MODE.TSX
+        break;
+    case 7:
+        TestPtDecodeEmit(Encoder, 0x1202, 2); // PTW (4 bytes)
+        TestPtDecodeEmit(Encoder, 0xcafe, 4);
+        break;
+    case 8:
+        TestPtDecodeEmit(Encoder, 0x88c302, 3); // MNT
+        TestPtDecodeEmit(Encoder, 0x1122334455667788ull, 8);
+        break;
+    default:
+        TestPtDecodeEmit(Encoder, 0x2202, 2); // PWRE
+        TestPtDecodeEmit(Encoder, 0x0100, 2);
+        break;
+    }
+}
+
+/**
+ * @brief Execute the synthetic program and record its trace
+ *
+ * @param Program
+ * @param IsUserOnly Whether the kernel-mode is filtered out
+ * @param Seed
+ * @param Trace
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeRecord(TEST_PT_DECODE_PROGRAM & Program, BOOLEAN IsUserOnly, UINT64 Seed, TEST_PT_DECODE_TRACE * Trace)
+{
+    TEST_PT_DECODE_ENCODER Encoder = {0};
+    std::vector<UINT64>    CallStack;
+    UINT64                 Ip              = TEST_PT_DECODE_USER_BASE;
+    UINT64                 SyscallReturn   = 0;
+    UINT64                 InterruptReturn = 0;
+    UINT64                 DroppedSteps    = 0;
+    BOOLEAN                IsKernel        = FALSE;
+    BOOLEAN                IsTraced        = TRUE;
+    BOOLEAN                IsDropping      = FALSE;
+
+    Encoder.Trace = Trace;
+    Encoder.Seed  = Seed;
+
+    TestPtDecodePsb(&Encoder, Ip, TRUE);
+
+    for (UINT64 Step = 0; Step < TEST_PT_DECODE_INSTRUCTIONS || IsDropping || (IsUserOnly && IsKernel); Step++)
+    {
+        const TEST_PT_DECODE_CODE & Code      = Program[Ip];
+        UINT64                      NextIp    = Ip + Code.Instruction.Length;
+        BOOLEAN                     IsEmitted;
+        BOOLEAN                     IsTaken;
+
+        IsTraced = !IsUserOnly || !IsKernel;
+
+        //
+        // The lost packets end with OVF, and FUP if the tracing is enabled
+        //
+        if (IsDropping && --DroppedSteps == 0)
+        {
+            IsDropping               = FALSE;
+            Encoder.TntCount         = 0;
+            Encoder.ReturnStackCount = 0;
+
+            TestPtDecodeEmit(&Encoder, 0xf302, 2);
+
+            if (IsTraced)
+            {
+                TestPtDecodeIp(&Encoder, 0x1d, Ip, FALSE);
+            }
+        }
+
+        IsEmitted = IsTraced && !IsDropping;
+
+        if (IsEmitted && Trace->Bytes.size() - Encoder.LastPsbOffset >= TEST_PT_DECODE_PSB_PERIOD)
+        {
+            TestPtDecodePsb(&Encoder, Ip, TRUE);
+        }
+
+        if (IsEmitted && TestPtDecodeRandom(&Encoder.Seed) % 8 == 0)
+        {
+            TestPtDecodeNoise(&Encoder);
+        }
+
+        //
+        // An interrupt (in the user-mode), the instruction is executed after
+        // the handler
+        //
+        if (!IsKernel && TestPtDecodeRandom(&Encoder.Seed) % 700 == 0)
+        {
+            UINT64 Handler = TEST_PT_DECODE_KERNEL_BASE + TEST_PT_DECODE_FUNCTION_SIZE;
+
+            if (IsEmitted)
+            {
+                TestPtDecodeIp(&Encoder, 0x1d, Ip, FALSE);
+
+                if (IsUserOnly)
+                {
+                    TestPtDecodeIp(&Encoder, 0x01, 0, TRUE);
+                    Trace->Expected.push_back(TEST_PT_DECODE_MARKER | PT_DECODE_STATUS_TRACE_DISABLED);
+                }
+                else
+                {
+                    TestPtDecodeIp(&Encoder, 0x0d, Handler, FALSE);
+                }
+            }
+
+            InterruptReturn = Ip;
+            Ip              = Handler;
+            IsKernel        = TRUE;
+            continue;
+        }
+
+        //
+        // Lose the packets for a while (from a conditional branch)
+        //
+        if (IsEmitted && Code.Kind == TEST_PT_DECODE_KIND_JCC && TestPtDecodeRandom(&Encoder.Seed) % 5000 == 0)
+        {
+            TestPtDecodeFlushTnt(&Encoder);
+            Trace->Expected.push_back(TEST_PT_DECODE_MARKER | PT_DECODE_STATUS_OVERFLOW);
+
+            IsDropping   = TRUE;
+            IsEmitted    = FALSE;
+            DroppedSteps = 1 + TestPtDecodeRandom(&Encoder.Seed) % 3000;
+        }
+
+        if (IsEmitted)
+        {
+            Trace->Expected.push_back(Ip);
+        }
+
+        switch (Code.Kind)
+        {
+        case TEST_PT_DECODE_KIND_JCC:
+
+            IsTaken = TestPtDecodeRandom(&Encoder.Seed) % 100 < (Code.Instruction.Target < Ip ? 60u : 50u);
+            NextIp  = IsTaken ? Code.Instruction.Target : NextIp;
+
+            if (IsEmitted)
+            {
+                TestPtDecodeTnt(&Encoder, IsTaken);
+            }
+            break;
+
+        case TEST_PT_DECODE_KIND_JMP:
+            NextIp = Code.Instruction.Target;
+            break;
+
+        case TEST_PT_DECODE_KIND_CALL:
+        case TEST_PT_DECODE_KIND_CALL_INDIRECT:
+
+            CallStack.push_back(NextIp);
+
+            if (IsEmitted)
+            {
+                Encoder.ReturnStackTop                      = (Encoder.ReturnStackTop + 1) % PT_DECODE_RETURN_STACK_SIZE;
+                Encoder.ReturnStack[Encoder.ReturnStackTop] = NextIp;
+                Encoder.ReturnStackCount += Encoder.ReturnStackCount < PT_DECODE_RETURN_STACK_SIZE ? 1 : 0;
+            }
+
+            NextIp = Code.Kind == TEST_PT_DECODE_KIND_CALL ? Code.Instruction.Target : Code.Targets[TestPtDecodeRandom(&Encoder.Seed) % Code.Targets.size()];
+
+            if (IsEmitted && Code.Kind == TEST_PT_DECODE_KIND_CALL_INDIRECT)
+            {
+                TestPtDecodeIp(&Encoder, 0x0d, NextIp, FALSE);
+            }
+            break;
+
+        case TEST_PT_DECODE_KIND_JMP_INDIRECT:
+
+            NextIp = Code.Targets[TestPtDecodeRandom(&Encoder.Seed) % Code.Targets.size()];
+
+            if (IsEmitted)
+            {
+                TestPtDecodeIp(&Encoder, 0x0d, NextIp, FALSE);
+            }
+            break;
+
+        case TEST_PT_DECODE_KIND_RET:
+
+            NextIp = CallStack.back();
+            CallStack.pop_back();
+
+            if (IsEmitted)
+            {
+                //
+                // Compressed if the return address is the last call
+                //
+                if (Encoder.ReturnStackCount != 0 && Encoder.ReturnStack[Encoder.ReturnStackTop] == NextIp)
+                {
+                    Encoder.ReturnStackTop = (Encoder.ReturnStackTop + PT_DECODE_RETURN_STACK_SIZE - 1) % PT_DECODE_RETURN_STACK_SIZE;
+                    Encoder.ReturnStackCount--;
+
+                    TestPtDecodeTnt(&Encoder, TRUE);
+                }
+                else
+                {
+                    TestPtDecodeIp(&Encoder, 0x0d, NextIp, FALSE);
+                }
+            }
+            break;
+
+        case TEST_PT_DECODE_KIND_SYSCALL:
+
+            SyscallReturn = NextIp;
+            NextIp        = TEST_PT_DECODE_KERNEL_BASE;
+            IsKernel      = TRUE;
+
+            if (IsEmitted)
+            {
+                if (IsUserOnly)
+                {
+                    TestPtDecodeIp(&Encoder, 0x01, 0, TRUE);
+                    Trace->Expected.push_back(TEST_PT_DECODE_MARKER | PT_DECODE_STATUS_TRACE_DISABLED);
+                }
+                else
+                {
+                    TestPtDecodeIp(&Encoder, 0x0d, NextIp, FALSE);
+                }
+            }
+            break;
+
+        case TEST_PT_DECODE_KIND_SYSRET:
+        case TEST_PT_DECODE_KIND_IRET:
+
+            NextIp   = Code.Kind == TEST_PT_DECODE_KIND_SYSRET ? SyscallReturn : InterruptReturn;
+            IsKernel = FALSE;
+
+            //
+            // The tracing is enabled again by the user-mode filter
+            //
+            if (!IsDropping)
+            {
+                TestPtDecodeIp(&Encoder, IsUserOnly ? 0x11 : 0x0d, NextIp, FALSE);
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        Ip = NextIp;
+    }
+
+    //
+    // The tracing is disabled at the end (by clearing TraceEn)
+    //
+    TestPtDecodeIp(&Encoder, 0x1d, Ip, FALSE);
+    TestPtDecodeIp(&Encoder, 0x01, 0, TRUE);
+    Trace->Expected.push_back(TEST_PT_DECODE_MARKER | PT_DECODE_STATUS_TRACE_DISABLED);
+}
+
+/**
+ * @brief Decode the instructions and the gaps of the trace
+ *
+ * @param Program
+ * @param Bytes
+ * @param Size
+ * @param Decoded
+ * @param Decoder
+ *
+ * @return VOID
+ */
+static VOID
+TestPtDecodeFlow(TEST_PT_DECODE_PROGRAM & Program,
+                 const UINT8 *            Bytes,
+                 UINT64                   Size,
+                 std::vector<UINT64> &    Decoded,
+                 PPT_DECODER              Decoder)
+{
+    PT_DECODE_INSTRUCTION Instruction;
+    PT_DECODE_STATUS      Status;
+
+    PtDecodeInitialize(Decoder, Bytes, Size, TestPtDecodeClassify, &Program);
+
+    while ((Status = PtDecodeNextInstruction(Decoder, &Instruction)) != PT_DECODE_STATUS_END_OF_STREAM)
+    {
+        Decoded.push_back(Status == PT_DECODE_STATUS_SUCCESS ? Instruction.Ip : TEST_PT_DECODE_MARKER | Status);
+    }
+}
+
+/**
+ * @brief Compare the decoded flow with the executed one
+ * @details The instructions after the last packet of a truncated stream
+ * are walked, they might not be executed (e.g., an interrupt happened)
+ *
+ * @param Decoded
+ * @param Expected
+ * @param ExpectedStart
+ * @param ExpectedEnd The entries before it should be decoded
+ * @param IsTruncated
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestPtDecodeCompare(const std::vector<UINT64> & Decoded,
+                    const std::vector<UINT64> & Expected,
+                    UINT64                      ExpectedStart,
+                    UINT64                      ExpectedEnd,
+                    BOOLEAN                     IsTruncated)
+{
+    UINT64 Matched = 0;
+
+    while (Matched < Decoded.size() && ExpectedStart + Matched < Expected.size() && Decoded[Matched] == Expected[ExpectedStart + Matched])
+    {
+        Matched++;
+    }
+
+    if (ExpectedStart + Matched < ExpectedEnd)
+    {
+        printf("[-] the decoded entry %llu is %llx instead of %llx\n",
+               Matched,
+               Matched < Decoded.size() ? Decoded[Matched] : 0,
+               Expected[ExpectedStart + Matched]);
+        return FALSE;
+    }
+
+    if (!IsTruncated && Matched != Decoded.size())
+    {
+        printf("[-] %llu more entries are decoded\n", Decoded.size() - Matched);
+        return FALSE;
+    }
+
+    if (Decoded.size() - Matched > TEST_PT_DECODE_MAXIMUM_TAIL)
+    {
+        printf("[-] %llu entries are decoded after the end of the stream\n", Decoded.size() - Matched);
+        return FALSE;
+    }
+
+    for (UINT64 i = Matched; i < Decoded.size(); i++)
+    {
+        if ((Decoded[i] & ~0xffull) == TEST_PT_DECODE_MARKER)
+        {
+            printf("[-] a gap (%llx) is decoded after the end of the stream\n", Decoded[i]);
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the decoder with a few known packets
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestPtDecodePackets()
+{
+    PT_DECODER       Decoder;
+    PT_DECODE_PACKET Packet;
+    PT_DECODE_STATUS Status;
+
+    const UINT8 Stream[] = {
+        0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, // PSB
+        0x00,                                                                                           // PAD
+        0x0a,                                                                                           // TNT (01)
+        0xcd, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,                                           // TIP (full)
+        0x3d, 0x34, 0x12,                                                                               // FUP (2 bytes)
+        0x01,                                                                                           // TIP.PGD (suppressed)
+        0x71, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf8,                                                       // TIP.PGE (sign-extended)
+        0x02, 0x43, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x00,                                                 // PIP
+        0x99, 0x01,                                                                                     // MODE.Exec
+        0x19, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,                                                 // TSC
+        0x59, 0x42,                                                                                     // MTC
+        0x07, 0x03, 0x02,                                                                               // CYC
+        0x02, 0x03, 0x1f, 0x00,                                                                         // CBR
+        0x02, 0xa3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,                                                 // TNT (long, 01)
+        0x02, 0xc8, 0x01, 0x02, 0x03, 0x04, 0x05,                                                       // VMCS
+        0x02, 0xf3,                                                                                     // OVF
+        0x02, 0x83,                                                                                     // TraceStop
+        0x02, 0x32, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,                                     // PTW (8 bytes)
+        0x02, 0xc3, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                               // MNT
+        0x02, 0x62,                                                                                     // EXSTOP
+        0x02, 0x23,                                                                                     // PSBEND
+        0x2d, 0x11,                                                                                     // TIP (truncated)
+    };
+
+    const struct
+    {
+        PT_DECODE_PACKET_TYPE Type;
+        UINT32                Size;
+        UINT64                Payload;
+    } Packets[] = {
+        {PT_DECODE_PACKET_TYPE_PSB, 16, 0},
+        {PT_DECODE_PACKET_TYPE_PAD, 1, 0},
+        {PT_DECODE_PACKET_TYPE_TNT, 1, 0x1},
+        {PT_DECODE_PACKET_TYPE_TIP, 9, 0x1122334455667788ull},
+        {PT_DECODE_PACKET_TYPE_FUP, 3, 0x1122334455661234ull},
+        {PT_DECODE_PACKET_TYPE_TIP_PGD, 1, 0},
+        {PT_DECODE_PACKET_TYPE_TIP_PGE, 7, 0xfffff80000001000ull},
+        {PT_DECODE_PACKET_TYPE_PIP, 8, 0x1aa000},
+        {PT_DECODE_PACKET_TYPE_MODE_EXEC, 2, 1},
+        {PT_DECODE_PACKET_TYPE_TSC, 8, 0x07060504030201ull},
+        {PT_DECODE_PACKET_TYPE_MTC, 2, 0x42},
+        {PT_DECODE_PACKET_TYPE_CYC, 3, 0},
+        {PT_DECODE_PACKET_TYPE_CBR, 4, 0x1f},
+        {PT_DECODE_PACKET_TYPE_TNT, 8, 0x1},
+        {PT_DECODE_PACKET_TYPE_VMCS, 7, 0x0504030201000ull},
+        {PT_DECODE_PACKET_TYPE_OVF, 2, 0},
+        {PT_DECODE_PACKET_TYPE_TRACE_STOP, 2, 0},
+        {PT_DECODE_PACKET_TYPE_PTW, 10, 0x0807060504030201ull},
+        {PT_DECODE_PACKET_TYPE_MNT, 11, 1},
+        {PT_DECODE_PACKET_TYPE_EXSTOP, 2, 0},
+        {PT_DECODE_PACKET_TYPE_PSBEND, 2, 0},
+    };
+
+    const UINT8 Invalid[] = {0xd9, 0x00};
+
+    PtDecodeInitialize(&Decoder, Stream, sizeof(Stream), NULL, NULL);
+
+    for (UINT32 i = 0; i < RTL_NUMBER_OF(Packets); i++)
+    {
+        Status = PtDecodeNextPacket(&Decoder, &Packet);
+
+        if (Status != PT_DECODE_STATUS_SUCCESS || Packet.Type != Packets[i].Type || Packet.Size != Packets[i].Size ||
+            Packet.Payload != Packets[i].Payload)
+        {
+            printf("[-] packet %u is (%x, %x, %u, %llx) instead of (%x, %u, %llx)\n",
+                   i,
+                   Status,
+                   Packet.Type,
+                   Packet.Size,
+                   Packet.Payload,
+                   Packets[i].Type,
+                   Packets[i].Size,
+                   Packets[i].Payload);
+            return FALSE;
+        }
+    }
+
+    if (PtDecodeNextPacket(&Decoder, &Packet) != PT_DECODE_STATUS_END_OF_STREAM)
+    {
+        printf("[-] the truncated packet is decoded\n");
+        return FALSE;
+    }
+
+    PtDecodeInitialize(&Decoder, Invalid, sizeof(Invalid), NULL, NULL);
+
+    if (PtDecodeNextPacket(&Decoder, &Packet) != PT_DECODE_STATUS_INVALID_PACKET)
+    {
+        printf("[-] the invalid packet is decoded\n");
+        return FALSE;
+    }
+
+    //
+    // The synchronization skips the partial packets before the PSB
+    //
+    PtDecodeInitialize(&Decoder, &Stream[5], sizeof(Stream) - 5, NULL, NULL);
+
+    if (PtDecodeSynchronize(&Decoder) || Decoder.Offset != sizeof(Stream) - 5)
+    {
+        printf("[-] a partial PSB is synchronized\n");
+        return FALSE;
+    }
+
+    printf("[*] %u known packets are decoded\n", (UINT32)RTL_NUMBER_OF(Packets));
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the flow of a recorded trace
+ *
+ * @param Program
+ * @param IsUserOnly
+ * @param Seed
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestPtDecodeTrace(TEST_PT_DECODE_PROGRAM & Program, BOOLEAN IsUserOnly, UINT64 Seed)
+{
+    TEST_PT_DECODE_TRACE Trace;
+    PT_DECODER           Decoder;
+    PT_DECODE_PACKET     Packet;
+    std::vector<UINT64>  Decoded;
+    UINT64               NumberOfPackets = 0;
+    UINT64               NumberOfGaps    = 0;
+    double               PacketTime;
+    double               InstructionTime;
+
+    TestPtDecodeRecord(Program, IsUserOnly, Seed, &Trace);
+
+    for (UINT64 Entry : Trace.Expected)
+    {
+        NumberOfGaps += (Entry & ~0xffull) == TEST_PT_DECODE_MARKER ? 1 : 0;
+    }
+
+    //
+    // The packets
+    //
+    auto Start = std::chrono::steady_clock::now();
+
+    PtDecodeInitialize(&Decoder, Trace.Bytes.data(), Trace.Bytes.size(), NULL, NULL);
+
+    while (PtDecodeNextPacket(&Decoder, &Packet) == PT_DECODE_STATUS_SUCCESS)
+    {
+        NumberOfPackets++;
+    }
+
+    PacketTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+    if (Decoder.Offset != Trace.Bytes.size())
+    {
+        printf("[-] the packets are decoded until %llx (of %llx)\n", Decoder.Offset, (UINT64)Trace.Bytes.size());
+        return FALSE;
+    }
+
+    //
+    // The whole flow
+    //
+    Start = std::chrono::steady_clock::now();
+
+    TestPtDecodeFlow(Program, Trace.Bytes.data(), Trace.Bytes.size(), Decoded, &Decoder);
+
+    InstructionTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+
+    if (!TestPtDecodeCompare(Decoded, Trace.Expected, 0, Trace.Expected.size(), FALSE))
+    {
+        return FALSE;
+    }
+
+    printf("[*] %s trace : %llu bytes, %llu packets, %llu instructions, %llu gaps, %llu overflows\n",
+           IsUserOnly ? "user-mode" : "whole",
+           (UINT64)Trace.Bytes.size(),
+           NumberOfPackets,
+           Decoder.NumberOfInstructions,
+           NumberOfGaps,
+           Decoder.NumberOfOverflows);
+
+    printf("[*]   packets : %.1f MB/s, instructions : %.1f M/s\n",
+           Trace.Bytes.size() / PacketTime / 1000000,
+           Decoder.NumberOfInstructions / InstructionTime / 1000000);
+
+    //
+    // A circular buffer (from a random offset) and a truncated stream
+    //
+    for (UINT32 i = 0; i < TEST_PT_DECODE_NUMBER_OF_ROTATIONS; i++)
+    {
+        UINT64 Begin = TestPtDecodeRandom(&Seed) % (Trace.Bytes.size() / 2);
+        UINT64 End   = i % 2 == 0 ? Trace.Bytes.size() : Begin + TestPtDecodeRandom(&Seed) % (Trace.Bytes.size() - Begin);
+        size_t First = 0;
+        size_t Last  = 0;
+
+        while (First < Trace.Psbs.size() && Trace.Psbs[First].Offset < Begin)
+        {
+            First++;
+        }
+
+        while (Last < Trace.Psbs.size() && Trace.Psbs[Last].Offset < End)
+        {
+            Last++;
+        }
+
+        if (Last <= First)
+        {
+            continue;
+        }
+
+        Decoded.clear();
+
+        TestPtDecodeFlow(Program, &Trace.Bytes[Begin], End - Begin, Decoded, &Decoder);
+
+        if (!TestPtDecodeCompare(Decoded,
+                                 Trace.Expected,
+                                 Trace.Psbs[First].ExpectedIndex,
+                                 End == Trace.Bytes.size() ? Trace.Expected.size() : Trace.Psbs[Last - 1].ExpectedIndex,
+                                 End != Trace.Bytes.size()))
+        {
+            printf("[-] the stream from %llx to %llx is not decoded\n", Begin, End);
+            return FALSE;
+        }
+    }
+
+    printf("[*]   %u parts of the stream are decoded from the next PSB\n", TEST_PT_DECODE_NUMBER_OF_ROTATIONS);
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the decoder of the Intel Processor Trace packets
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestPtDecode()
+{
+    TEST_PT_DECODE_PROGRAM Program;
+    UINT64                 Seed = 0x9e3779b97f4a7c15ull;
+
+    if (!TestPtDecodePackets())
+    {
+        return FALSE;
+    }
+
+    TestPtDecodeGenerateFunctions(Program, TEST_PT_DECODE_USER_BASE, TEST_PT_DECODE_USER_FUNCTIONS, FALSE, &Seed);
+    TestPtDecodeGenerateFunctions(Program, TEST_PT_DECODE_KERNEL_BASE, TEST_PT_DECODE_KERNEL_FUNCTIONS, TRUE, &Seed);
+
+    printf("[*] the synthetic program has %llu instructions\n", (UINT64)Program.size());
+
+    if (!TestPtDecodeTrace(Program, FALSE, Seed))
+    {
+        return FALSE;
+    }
+
+    return TestPtDecodeTrace(Program, TRUE, Seed + 1);
+}
@@ -0,0 +1,425 @@
+/**
+ * @file test-sample-profile.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the histograms of the sampling profiler
+ * @details Synthetic sample streams (hot functions called from a few
+ * callers, in a few processes) are recorded in the histograms of the
+ * cores, the histograms are read in chunks (the same way as the user-mode
+ * reads them), merged and symbolized, then the self and total counts of
+ * the functions are compared with the counts of the recorded samples
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The synthetic program and its samples
+ *
+ */
+#define TEST_SAMPLE_PROFILE_FUNCTIONS_BASE   0xfffff80000000000ull
+#define TEST_SAMPLE_PROFILE_STACK_BASE       0xffffd00000000000ull
+#define TEST_SAMPLE_PROFILE_FUNCTIONS        2000
+#define TEST_SAMPLE_PROFILE_WORKING_SET      160 // The functions that the cold samples are in
+#define TEST_SAMPLE_PROFILE_PROCESSES        4
+#define TEST_SAMPLE_PROFILE_CORES            8
+#define TEST_SAMPLE_PROFILE_SAMPLES_PER_CORE 200000
+#define TEST_SAMPLE_PROFILE_NOISY_CORE       7 // This core runs many distinct addresses, so its histogram is filled
+#define TEST_SAMPLE_PROFILE_MERGED_CAPACITY  0x10000
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestSampleProfileRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief Make a sample of the synthetic program
+ * @details A few functions are hot, each function is called by the same
+ * callers, and the stack has the pointers to the stack and small values
+ * between the return addresses
+ *
+ * @param Symbols
+ * @param Seed
+ * @param IsNoisy
+ * @param StackDepth
+ * @param Sample
+ *
+ * @return VOID
+ */
+static VOID
+TestSampleProfileMakeSample(const SAMPLE_PROFILE_SYMBOL * Symbols,
+                            UINT64 *                      Seed,
+                            BOOLEAN                       IsNoisy,
+                            UINT32                        StackDepth,
+                            PPROFILER_SAMPLE              Sample)
+{
+    UINT64 StackWords[SAMPLE_PROFILE_STACK_SCAN_WORDS] = {0};
+    UINT64 StackPointer;
+    UINT64 Random   = TestSampleProfileRandom(Seed);
+    UINT32 Function = (UINT32)(Random % 16);
+    UINT32 Caller;
+    UINT32 Word = 0;
+
+    //
+    // Half of the samples are in 16 hot functions (the first ones are
+    // hotter), the rest are in the working set, the noisy core runs all of
+    // the instructions of all of the functions
+    //
+    if ((Random >> 32) % 2 == 0)
+    {
+        Function = Function % (1 + (UINT32)((Random >> 40) % 16));
+    }
+    else
+    {
+        Function = (UINT32)(TestSampleProfileRandom(Seed) % (IsNoisy ? TEST_SAMPLE_PROFILE_FUNCTIONS : TEST_SAMPLE_PROFILE_WORKING_SET));
+    }
+
+    Sample->Rip   = Symbols[Function].Address + (IsNoisy ? TestSampleProfileRandom(Seed) % Symbols[Function].Size : (Random >> 48) % 2 * 8);
+    Sample->Cr3   = 0x1aa000 + (TestSampleProfileRandom(Seed) % TEST_SAMPLE_PROFILE_PROCESSES) * 0x1000;
+    Sample->Count = 1;
+
+    //
+    // Some samples are in the addresses that are not in any function (with
+    // the same callers)
+    //
+    if (TestSampleProfileRandom(Seed) % 50 == 0)
+    {
+        Function    = TEST_SAMPLE_PROFILE_FUNCTIONS - 1;
+        Sample->Rip = TEST_SAMPLE_PROFILE_FUNCTIONS_BASE - 0x1000 - (TestSampleProfileRandom(Seed) % 0x10) * 0x10;
+    }
+
+    StackPointer = TEST_SAMPLE_PROFILE_STACK_BASE + (TestSampleProfileRandom(Seed) % 0x1000) * 8;
+
+    //
+    // The return addresses of the callers (the callers of a function are
+    // fixed, the callers of the hot functions are also hot)
+    //
+    Caller = Function;
+
+    while (Word + 2 < SAMPLE_PROFILE_STACK_SCAN_WORDS)
+    {
+        Caller = (Caller * 7 + 3) % TEST_SAMPLE_PROFILE_FUNCTIONS;
+
+        StackWords[Word]     = StackPointer + 0x40 + Word * 8; // A pointer to the stack
+        StackWords[Word + 1] = Word;                           // A small value
+        StackWords[Word + 2] = Symbols[Caller].Address + Symbols[Caller].Size / 2;
+
+        Word += 3;
+    }
+
+    Sample->StackDepth = SampleProfileFindReturnAddresses(Sample->Rip,
+                                                          StackPointer,
+                                                          StackWords,
+                                                          SAMPLE_PROFILE_STACK_SCAN_WORDS,
+                                                          Sample->Stack,
+                                                          StackDepth);
+}
+
+/**
+ * @brief Count the samples of each function without the histograms
+ *
+ * @param Starts The addresses of the functions
+ * @param Symbols
+ * @param Sample
+ * @param SelfCounts
+ * @param TotalCounts
+ *
+ * @return VOID
+ */
+static VOID
+TestSampleProfileCountReference(const std::vector<UINT64> &   Starts,
+                                const SAMPLE_PROFILE_SYMBOL * Symbols,
+                                const PROFILER_SAMPLE *       Sample,
+                                std::vector<UINT64> &         SelfCounts,
+                                std::vector<UINT64> &         TotalCounts)
+{
+    std::set<UINT32> Found;
+    UINT32           Index;
+
+    for (UINT32 i = 0; i <= Sample->StackDepth; i++)
+    {
+        UINT64 Address = i == 0 ? Sample->Rip : Sample->Stack[i - 1];
+        auto   It      = std::upper_bound(Starts.begin(), Starts.end(), Address);
+
+        Index = TEST_SAMPLE_PROFILE_FUNCTIONS;
+
+        if (It != Starts.begin() && Address < *(It - 1) + Symbols[It - 1 - Starts.begin()].Size)
+        {
+            Index = (UINT32)(It - 1 - Starts.begin());
+        }
+
+        if (i == 0)
+        {
+            SelfCounts[Index] += Sample->Count;
+        }
+        else if (Index == TEST_SAMPLE_PROFILE_FUNCTIONS)
+        {
+            continue;
+        }
+
+        if (Found.insert(Index).second)
+        {
+            TotalCounts[Index] += Sample->Count;
+        }
+    }
+}
+
+/**
+ * @brief Test the candidate return addresses of a stack
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSampleProfileReturnAddresses()
+{
+    UINT64 StackPointer = 0xffffd00000123450ull;
+    UINT64 Frames[PROFILER_MAXIMUM_STACK_DEPTH];
+    UINT64 StackWords[] = {
+        StackPointer + 0x80,    // A pointer to the stack
+        0x10,                   // A small value
+        0xfffff80000401234ull,  // A return address
+        0x00007ff600001000ull,  // A user-mode address (the RIP is in the kernel)
+        0x8000000000001000ull,  // Not canonical
+        0xfffff80000401234ull,  // The same return address again
+        0xfffff80000502000ull,  // A return address
+        StackPointer - 0x10000, // A pointer to the stack
+        0xfffff80000603000ull,  // A return address
+        0xfffff80000704000ull,  // A return address (more than the depth)
+    };
+    UINT64 Expected[] = {0xfffff80000401234ull, 0xfffff80000502000ull, 0xfffff80000603000ull};
+    UINT32 Count;
+
+    Count = SampleProfileFindReturnAddresses(0xfffff80000100000ull,
+                                             StackPointer,
+                                             StackWords,
+                                             RTL_NUMBER_OF(StackWords),
+                                             Frames,
+                                             3);
+
+    if (Count != RTL_NUMBER_OF(Expected))
+    {
+        printf("[-] %u return addresses are found instead of %u\n", Count, (UINT32)RTL_NUMBER_OF(Expected));
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        if (Frames[i] != Expected[i])
+        {
+            printf("[-] return address %u is %llx instead of %llx\n", i, Frames[i], Expected[i]);
+            return FALSE;
+        }
+    }
+
+    printf("[*] return addresses : %u of %u stack words are taken\n", Count, (UINT32)RTL_NUMBER_OF(StackWords));
+
+    return TRUE;
+}
+
+/**
+ * @brief Record, merge and symbolize the synthetic sample streams
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSampleProfileStreams()
+{
+    std::vector<SAMPLE_PROFILE_SYMBOL>   Symbols(TEST_SAMPLE_PROFILE_FUNCTIONS);
+    std::vector<UINT64>                  Starts(TEST_SAMPLE_PROFILE_FUNCTIONS);
+    std::vector<UINT64>                  SelfCounts(TEST_SAMPLE_PROFILE_FUNCTIONS + 1, 0);
+    std::vector<UINT64>                  TotalCounts(TEST_SAMPLE_PROFILE_FUNCTIONS + 1, 0);
+    std::vector<PROFILER_SAMPLE>         CoreSamples(TEST_SAMPLE_PROFILE_CORES * PROFILER_HISTOGRAM_CAPACITY);
+    std::vector<PROFILER_SAMPLE>         MergedSamples(TEST_SAMPLE_PROFILE_MERGED_CAPACITY);
+    std::vector<PROFILER_SAMPLE>         Chunk(PROFILER_MAXIMUM_SAMPLES_PER_READ);
+    std::vector<PROFILER_SAMPLE>         Distinct(TEST_SAMPLE_PROFILE_MERGED_CAPACITY);
+    std::vector<SAMPLE_PROFILE_FUNCTION> Functions(TEST_SAMPLE_PROFILE_FUNCTIONS + 1);
+    SAMPLE_PROFILE_HISTOGRAM             Histograms[TEST_SAMPLE_PROFILE_CORES];
+    SAMPLE_PROFILE_HISTOGRAM             Merged;
+    PROFILER_SAMPLE                      Sample;
+    UINT64                               Seed           = 0x50524f46;
+    UINT64                               Address        = TEST_SAMPLE_PROFILE_FUNCTIONS_BASE;
+    UINT64                               Recorded       = 0;
+    UINT64                               Dropped        = 0;
+    UINT64                               Reads          = 0;
+    UINT32                               NumberOfRead   = 0;
+    UINT32                               NextSample     = 0;
+    UINT32                               NumberOfSorted = 0;
+    double                               SymbolizeTime  = 0;
+
+    //
+    // The functions (with gaps between them)
+    //
+    for (UINT32 i = 0; i < TEST_SAMPLE_PROFILE_FUNCTIONS; i++)
+    {
+        Symbols[i].Address = Address;
+        Symbols[i].Size    = 0x20 + (TestSampleProfileRandom(&Seed) % 0x40) * 0x10;
+        Starts[i]          = Address;
+
+        Address += Symbols[i].Size + (TestSampleProfileRandom(&Seed) % 4) * 0x10;
+    }
+
+    //
+    // Record the streams of the cores
+    //
+    for (UINT32 Core = 0; Core < TEST_SAMPLE_PROFILE_CORES; Core++)
+    {
+        if (!SampleProfileInitialize(&Histograms[Core], &CoreSamples[Core * PROFILER_HISTOGRAM_CAPACITY], PROFILER_HISTOGRAM_CAPACITY))
+        {
+            printf("[-] unable to initialize the histogram of core %u\n", Core);
+            return FALSE;
+        }
+
+        for (UINT32 i = 0; i < TEST_SAMPLE_PROFILE_SAMPLES_PER_CORE; i++)
+        {
+            TestSampleProfileMakeSample(Symbols.data(), &Seed, Core == TEST_SAMPLE_PROFILE_NOISY_CORE, Core % (PROFILER_MAXIMUM_STACK_DEPTH + 1), &Sample);
+
+            if (SampleProfileAdd(&Histograms[Core], &Sample))
+            {
+                TestSampleProfileCountReference(Starts, Symbols.data(), &Sample, SelfCounts, TotalCounts);
+                Recorded++;
+            }
+            else
+            {
+                Dropped++;
+            }
+        }
+
+        if (Histograms[Core].NumberOfTakenSamples != TEST_SAMPLE_PROFILE_SAMPLES_PER_CORE)
+        {
+            printf("[-] core %u took %llu samples instead of %u\n", Core, Histograms[Core].NumberOfTakenSamples, TEST_SAMPLE_PROFILE_SAMPLES_PER_CORE);
+            return FALSE;
+        }
+
+        if (Core != TEST_SAMPLE_PROFILE_NOISY_CORE && Histograms[Core].NumberOfDroppedSamples != 0)
+        {
+            printf("[-] core %u dropped %llu samples of its working set\n", Core, Histograms[Core].NumberOfDroppedSamples);
+            return FALSE;
+        }
+    }
+
+    if (Histograms[TEST_SAMPLE_PROFILE_NOISY_CORE].NumberOfDroppedSamples == 0)
+    {
+        printf("[-] the histogram of the noisy core is not filled\n");
+        return FALSE;
+    }
+
+    printf("[*] recorded samples : %llu, dropped samples : %llu (the noisy core has %u distinct samples)\n",
+           Recorded,
+           Dropped,
+           Histograms[TEST_SAMPLE_PROFILE_NOISY_CORE].NumberOfDistinctSamples);
+
+    //
+    // Read the histograms in chunks and merge them
+    //
+    SampleProfileInitialize(&Merged, MergedSamples.data(), TEST_SAMPLE_PROFILE_MERGED_CAPACITY);
+
+    for (UINT32 Core = 0; Core < TEST_SAMPLE_PROFILE_CORES; Core++)
+    {
+        NextSample = 0;
+
+        while (NextSample < Histograms[Core].Capacity)
+        {
+            NumberOfRead = SampleProfileRead(&Histograms[Core], NextSample, Chunk.data(), PROFILER_MAXIMUM_SAMPLES_PER_READ, &NextSample);
+            Reads++;
+
+            for (UINT32 i = 0; i < NumberOfRead; i++)
+            {
+                if (!SampleProfileAdd(&Merged, &Chunk[i]))
+                {
+                    printf("[-] a sample is dropped while merging\n");
+                    return FALSE;
+                }
+            }
+        }
+    }
+
+    if (Merged.NumberOfTakenSamples != Recorded)
+    {
+        printf("[-] the merged histogram has %llu samples instead of %llu\n", Merged.NumberOfTakenSamples, Recorded);
+        return FALSE;
+    }
+
+    NumberOfRead = SampleProfileRead(&Merged, 0, Distinct.data(), TEST_SAMPLE_PROFILE_MERGED_CAPACITY, &NextSample);
+
+    printf("[*] merged histogram : %u distinct samples (%llu reads of the cores)\n", NumberOfRead, Reads);
+
+    //
+    // Symbolize the samples and compare the counts
+    //
+    auto Start = std::chrono::steady_clock::now();
+
+    SampleProfileSymbolize(Distinct.data(), NumberOfRead, Symbols.data(), TEST_SAMPLE_PROFILE_FUNCTIONS, Functions.data());
+
+    SymbolizeTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - Start).count();
+
+    for (UINT32 i = 0; i <= TEST_SAMPLE_PROFILE_FUNCTIONS; i++)
+    {
+        if (Functions[i].SelfCount != SelfCounts[i] || Functions[i].TotalCount != TotalCounts[i])
+        {
+            printf("[-] function %u has %llu/%llu samples instead of %llu/%llu\n",
+                   i,
+                   Functions[i].SelfCount,
+                   Functions[i].TotalCount,
+                   SelfCounts[i],
+                   TotalCounts[i]);
+            return FALSE;
+        }
+    }
+
+    NumberOfSorted = SampleProfileSortFunctions(Functions.data(), TEST_SAMPLE_PROFILE_FUNCTIONS + 1);
+
+    for (UINT32 i = 1; i < NumberOfSorted; i++)
+    {
+        if (Functions[i - 1].SelfCount < Functions[i].SelfCount)
+        {
+            printf("[-] the functions are not sorted\n");
+            return FALSE;
+        }
+    }
+
+    if (Functions[0].SymbolIndex != 0)
+    {
+        printf("[-] the hottest function is %u instead of 0\n", Functions[0].SymbolIndex);
+        return FALSE;
+    }
+
+    printf("[*] symbolized %u distinct samples in %.0f us, %u functions have samples\n", NumberOfRead, SymbolizeTime, NumberOfSorted);
+
+    for (UINT32 i = 0; i < 5 && i < NumberOfSorted; i++)
+    {
+        printf("[*]   function %u : self %.2f%%, total %.2f%%\n",
+               Functions[i].SymbolIndex,
+               100.0 * Functions[i].SelfCount / Recorded,
+               100.0 * Functions[i].TotalCount / Recorded);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the histograms of the sampling profiler
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestSampleProfile()
+{
+    if (!TestSampleProfileReturnAddresses())
+    {
+        return FALSE;
+    }
+
+    return TestSampleProfileStreams();
+}
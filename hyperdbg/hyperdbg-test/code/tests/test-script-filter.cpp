@@ -0,0 +1,199 @@
+/**
+ * @file test-script-filter.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the fast-path filters of the scripts
+ * @details The condition of each script is lowered to a filter and checked
+ * on random registers, the result of the filter should always be the same as
+ * running the script by the script engine (whether the body is run or not)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the random registers that each script is checked on
+ *
+ */
+#define TEST_SCRIPT_FILTER_NUMBER_OF_STATES 100000
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestScriptFilterRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State >> 11;
+}
+
+/**
+ * @brief Create a random value for a register, the values are biased toward
+ * the constants of the scripts so both sides of the comparisons are covered
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestScriptFilterRandomValue(UINT64 * State)
+{
+    UINT64 Random = TestScriptFilterRandom(State);
+
+    switch (Random % 6)
+    {
+    case 0:
+        return (Random >> 3) % 8;
+    case 1:
+        return 0x10;
+    case 2:
+        return (UINT64)(-(INT64)((Random >> 3) % 8));
+    case 3:
+        return (Random >> 3) & 0xffff;
+    case 4:
+        return ((Random >> 3) & 0xff) << 8 | 0x10;
+    default:
+        return Random * 0x9e3779b97f4a7c15ull;
+    }
+}
+
+/**
+ * @brief Check a script on the random registers
+ *
+ * @param Script
+ * @param States
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestScriptFilterCompare(const string & Script, vector<GUEST_REGS> & States)
+{
+    vector<BOOLEAN> FilterResults(States.size());
+    vector<BOOLEAN> InterpreterResults(States.size());
+    UINT64          FilterTime;
+    UINT64          InterpreterTime;
+    UINT64          NumberOfRuns = 0;
+
+    if (!hyperdbg_u_test_script_filter((CHAR *)Script.c_str(),
+                                       States.data(),
+                                       (UINT32)States.size(),
+                                       FilterResults.data(),
+                                       InterpreterResults.data(),
+                                       &FilterTime,
+                                       &InterpreterTime))
+    {
+        printf("[-] the condition of '%s' is not lowered to a filter\n", Script.c_str());
+        return FALSE;
+    }
+
+    for (size_t i = 0; i < States.size(); i++)
+    {
+        if (FilterResults[i] != InterpreterResults[i])
+        {
+            printf("[-] the filter of '%s' returns %s but the script %s run (state: %llu)\n",
+                   Script.c_str(),
+                   FilterResults[i] ? "true" : "false",
+                   InterpreterResults[i] ? "is" : "is not",
+                   (UINT64)i);
+            return FALSE;
+        }
+
+        NumberOfRuns += FilterResults[i];
+    }
+
+    printf("[*] %s : filter %.2f ns, script engine %.2f ns per check, %llu of %llu states are passed\n",
+           Script.c_str(),
+           (double)FilterTime / States.size(),
+           (double)InterpreterTime / States.size(),
+           NumberOfRuns,
+           (UINT64)States.size());
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the fast-path filters of the scripts
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestScriptFilter()
+{
+    vector<GUEST_REGS> States(TEST_SCRIPT_FILTER_NUMBER_OF_STATES);
+    UINT64             Seed = 0x5eed;
+    char               Buffer[0x100];
+
+    //
+    // Each body changes a register, so the script engine reports whether
+    // the body is run or not
+    //
+    vector<string> Scripts = {
+        "if (@rcx == 0x10) { @r15 = @r15 + 1; }",
+        "if (@rcx == 0x10 && @rdx != 3) { @r15 = @r15 + 1; }",
+        "if (@rcx > 5) { @r15 = @r15 + 1; }",
+        "if (@eax <= 0x10 && @ah != 3 && @spl >= @dil) { @r15 = @r15 + 1; }",
+        "if (@rcx) { @r15 = @r15 + 1; }",
+        "if (5 < @r8 && @r9w == @r10w) { @r15 = @r15 + 1; }",
+        "if (@rbx >= 0 && @rsi < 0x1000 && @r11d != 0 && @bp == 0x10 && @r12b <= 4 && @r13 > @r14) { @r15 = @r15 + 1; }",
+    };
+
+    //
+    // The pseudo-registers of the script engine are the ones of this thread
+    //
+    sprintf_s(Buffer, sizeof(Buffer), "if ($pid == 0x%x && @rcx == 0x10) { @r15 = @r15 + 1; }", GetCurrentProcessId());
+    Scripts.push_back(Buffer);
+
+    sprintf_s(Buffer, sizeof(Buffer), "if ($tid == 0x%x && $core >= 0 && @r8 < 0) { @r15 = @r15 + 1; }", GetCurrentThreadId());
+    Scripts.push_back(Buffer);
+
+    //
+    // Conditions that are not lowered to a filter
+    //
+    vector<string> UnsupportedScripts = {
+        "if (@rcx == 0x10 || @rdx == 3) { @r15 = @r15 + 1; }",
+        "if (@rcx == 0x10) { @r15 = @r15 + 1; } else { @r14 = 0; }",
+        "if (@rcx & 0xff) { @r15 = @r15 + 1; }",
+        "if (@rcx == 0x10) { @r15 = @r15 + 1; } @r14 = 0;",
+        "if (@rip == 0x10) { @r15 = @r15 + 1; }",
+        "@r15 = @r15 + 1;",
+    };
+
+    for (auto & State : States)
+    {
+        UINT64 * Registers = (UINT64 *)&State;
+
+        for (UINT32 i = 0; i < sizeof(GUEST_REGS) / sizeof(UINT64); i++)
+        {
+            Registers[i] = TestScriptFilterRandomValue(&Seed);
+        }
+    }
+
+    for (auto & Script : Scripts)
+    {
+        if (!TestScriptFilterCompare(Script, States))
+        {
+            return FALSE;
+        }
+    }
+
+    for (auto & Script : UnsupportedScripts)
+    {
+        vector<BOOLEAN> Results(1);
+        UINT64          Time;
+
+        if (hyperdbg_u_test_script_filter((CHAR *)Script.c_str(), States.data(), 1, Results.data(), Results.data(), &Time, &Time))
+        {
+            printf("[-] the condition of '%s' is lowered to a filter\n", Script.c_str());
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,923 @@
+/**
+ * @file test-shared-ept.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the shared EPT hierarchy and the private regions
+ * of the cores
+ * @details The identity tables of the cores (with the same layout and the
+ * same memory types as the hypervisor) are built once per core as before,
+ * and once as the shared hierarchy; the same hooks are installed on both of
+ * them and the tables are walked the same way as the processor to compare
+ * the translations, the reserved private tables should only grow for the
+ * regions that are still shared, at last the memory and the time of both
+ * of the methods are shown for different counts of the cores
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The simulated memory and hooks
+ *
+ */
+#define TEST_SHARED_EPT_NUMBER_OF_HOOKS   32
+#define TEST_SHARED_EPT_FAKE_PAGES_BASE   0x900000000000ull // Physical address of the fake pages of the hooks
+#define TEST_SHARED_EPT_MEMORY_TYPE_UC    0ull
+#define TEST_SHARED_EPT_MEMORY_TYPE_WC    1ull
+#define TEST_SHARED_EPT_MEMORY_TYPE_WB    6ull
+#define TEST_SHARED_EPT_SIZE_2_MB         0x200000ull
+#define TEST_SHARED_EPT_SIZE_1_GB         0x40000000ull
+#define TEST_SHARED_EPT_SIZE_512_GB       0x8000000000ull
+#define TEST_SHARED_EPT_MEMORY_TYPE_SHIFT 3
+
+/**
+ * @brief A simulated MTRR range
+ *
+ */
+typedef struct _TEST_SHARED_EPT_RANGE
+{
+    UINT64 BaseAddress;
+    UINT64 EndAddress; // Inclusive
+    UINT64 MemoryType;
+
+} TEST_SHARED_EPT_RANGE, *PTEST_SHARED_EPT_RANGE;
+
+/**
+ * @brief The ranges of the MTRRs (the rest of the memory is write-back),
+ * the first 2 MB and the end of the 2nd GB are not valid for the large pages
+ *
+ */
+static const TEST_SHARED_EPT_RANGE TestSharedEptRanges[] = {
+    {0xa0000, 0xbffff, TEST_SHARED_EPT_MEMORY_TYPE_UC},
+    {0x7fe80000, 0x7fffffff, TEST_SHARED_EPT_MEMORY_TYPE_WC},
+    {0xc0000000, 0xffffffff, TEST_SHARED_EPT_MEMORY_TYPE_UC},
+};
+
+/**
+ * @brief The simulated physical memory of the tables
+ *
+ */
+typedef struct _TEST_SHARED_EPT_MEMORY
+{
+    vector<vector<UINT64>> Tables; // The physical address of the table i is (i + 1) * SHARED_EPT_PAGE_SIZE
+    UINT64                 Limit;  // Maximum allocated tables
+    UINT64                 FreedTables;
+
+} TEST_SHARED_EPT_MEMORY, *PTEST_SHARED_EPT_MEMORY;
+
+/**
+ * @brief The shared tables of the identity map
+ *
+ */
+typedef struct _TEST_SHARED_EPT_SHARED_TABLES
+{
+    UINT64 Pml3ReservedPhysicalAddresses[SHARED_EPT_TABLE_ENTRIES - 1];
+    UINT64 Pml2PhysicalAddresses[SHARED_EPT_TABLE_ENTRIES];
+
+} TEST_SHARED_EPT_SHARED_TABLES, *PTEST_SHARED_EPT_SHARED_TABLES;
+
+/**
+ * @brief Convert the physical address of a table to its virtual address
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+static PVOID
+TestSharedEptPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context)
+{
+    PTEST_SHARED_EPT_MEMORY Memory = (PTEST_SHARED_EPT_MEMORY)Context;
+    UINT64                  Index  = PhysicalAddress / SHARED_EPT_PAGE_SIZE;
+
+    if (Index == 0 || Index > Memory->Tables.size())
+    {
+        return NULL;
+    }
+
+    return Memory->Tables[Index - 1].data();
+}
+
+/**
+ * @brief Allocate a table of the simulated memory
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+static PVOID
+TestSharedEptAllocateTable(UINT64 * PhysicalAddress, PVOID Context)
+{
+    PTEST_SHARED_EPT_MEMORY Memory = (PTEST_SHARED_EPT_MEMORY)Context;
+
+    if (Memory->Tables.size() >= Memory->Limit)
+    {
+        return NULL;
+    }
+
+    Memory->Tables.emplace_back(SHARED_EPT_TABLE_ENTRIES, 0);
+
+    *PhysicalAddress = Memory->Tables.size() * SHARED_EPT_PAGE_SIZE;
+
+    return Memory->Tables.back().data();
+}
+
+/**
+ * @brief Free a table of the simulated memory
+ *
+ * @param Table
+ * @param Context
+ *
+ * @return VOID
+ */
+static VOID
+TestSharedEptFreeTable(PVOID Table, PVOID Context)
+{
+    PTEST_SHARED_EPT_MEMORY Memory = (PTEST_SHARED_EPT_MEMORY)Context;
+
+    if (Table != NULL)
+    {
+        Memory->FreedTables++;
+    }
+}
+
+/**
+ * @brief Get the table of a physical address
+ *
+ * @param Memory
+ * @param PhysicalAddress
+ *
+ * @return UINT64 *
+ */
+static UINT64 *
+TestSharedEptTable(PTEST_SHARED_EPT_MEMORY Memory, UINT64 PhysicalAddress)
+{
+    return (UINT64 *)TestSharedEptPhysicalToVirtual(PhysicalAddress & SHARED_EPT_ENTRY_ADDRESS, Memory);
+}
+
+/**
+ * @brief Allocate a table (the simulated memory is large enough)
+ *
+ * @param Memory
+ *
+ * @return UINT64 The physical address of the table
+ */
+static UINT64
+TestSharedEptNewTable(PTEST_SHARED_EPT_MEMORY Memory)
+{
+    UINT64 PhysicalAddress = 0;
+
+    TestSharedEptAllocateTable(&PhysicalAddress, Memory);
+
+    return PhysicalAddress;
+}
+
+/**
+ * @brief Get the memory type of a 4 KB page from the MTRRs
+ *
+ * @param PhysicalAddress
+ *
+ * @return UINT64
+ */
+static UINT64
+TestSharedEptGetMemoryType(UINT64 PhysicalAddress)
+{
+    for (auto & Range : TestSharedEptRanges)
+    {
+        if (PhysicalAddress >= Range.BaseAddress && PhysicalAddress <= Range.EndAddress)
+        {
+            return Range.MemoryType;
+        }
+    }
+
+    return TEST_SHARED_EPT_MEMORY_TYPE_WB;
+}
+
+/**
+ * @brief Check if a 2 MB page doesn't land on two or more memory types
+ *
+ * @param PhysicalAddress
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSharedEptIsValidForLargePage(UINT64 PhysicalAddress)
+{
+    UINT64 EndAddress = PhysicalAddress + TEST_SHARED_EPT_SIZE_2_MB - 1;
+
+    for (auto & Range : TestSharedEptRanges)
+    {
+        if ((PhysicalAddress <= Range.EndAddress && EndAddress > Range.EndAddress) ||
+            (PhysicalAddress < Range.BaseAddress && EndAddress >= Range.BaseAddress))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Split a 2 MB entry to the 4 KB entries
+ *
+ * @param Memory
+ * @param Pml2Entry
+ *
+ * @return VOID
+ */
+static VOID
+TestSharedEptSplit(PTEST_SHARED_EPT_MEMORY Memory, UINT64 * Pml2Entry)
+{
+    UINT64   BaseAddress         = *Pml2Entry & SHARED_EPT_ENTRY_ADDRESS;
+    UINT64   Pml1PhysicalAddress = TestSharedEptNewTable(Memory);
+    UINT64 * Pml1                = TestSharedEptTable(Memory, Pml1PhysicalAddress);
+
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        UINT64 Address = BaseAddress + i * SHARED_EPT_PAGE_SIZE;
+
+        Pml1[i] = Address | SHARED_EPT_ENTRY_PRESENT | (TestSharedEptGetMemoryType(Address) << TEST_SHARED_EPT_MEMORY_TYPE_SHIFT);
+    }
+
+    *Pml2Entry = Pml1PhysicalAddress | SHARED_EPT_ENTRY_PRESENT;
+}
+
+/**
+ * @brief Fill the reserved PML3 tables and the PML2 tables of the identity
+ * map, the same as the hypervisor
+ *
+ * @param Memory
+ * @param Pml3ReservedPhysicalAddresses
+ * @param Pml2PhysicalAddresses
+ *
+ * @return VOID
+ */
+static VOID
+TestSharedEptFillIdentityTables(PTEST_SHARED_EPT_MEMORY Memory,
+                                UINT64 *                Pml3ReservedPhysicalAddresses,
+                                UINT64 *                Pml2PhysicalAddresses)
+{
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES - 1; i++)
+    {
+        UINT64 * Pml3 = TestSharedEptTable(Memory, Pml3ReservedPhysicalAddresses[i]);
+
+        for (UINT64 j = 0; j < SHARED_EPT_TABLE_ENTRIES; j++)
+        {
+            Pml3[j] = (TEST_SHARED_EPT_SIZE_512_GB + i * TEST_SHARED_EPT_SIZE_512_GB + j * TEST_SHARED_EPT_SIZE_1_GB) |
+                      SHARED_EPT_ENTRY_PRESENT | SHARED_EPT_ENTRY_LARGE_PAGE | (TEST_SHARED_EPT_MEMORY_TYPE_UC << TEST_SHARED_EPT_MEMORY_TYPE_SHIFT);
+        }
+    }
+
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        for (UINT64 j = 0; j < SHARED_EPT_TABLE_ENTRIES; j++)
+        {
+            UINT64   Address   = (i * SHARED_EPT_TABLE_ENTRIES + j) * TEST_SHARED_EPT_SIZE_2_MB;
+            UINT64 * Pml2Entry = &TestSharedEptTable(Memory, Pml2PhysicalAddresses[i])[j];
+
+            *Pml2Entry = Address | SHARED_EPT_ENTRY_PRESENT | SHARED_EPT_ENTRY_LARGE_PAGE |
+                         (TestSharedEptGetMemoryType(Address) << TEST_SHARED_EPT_MEMORY_TYPE_SHIFT);
+
+            if (!TestSharedEptIsValidForLargePage(Address))
+            {
+                TestSharedEptSplit(Memory, Pml2Entry);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Build the root (PML4) and the PML3 table of a core
+ *
+ * @param Memory
+ * @param Pml3ReservedPhysicalAddresses
+ * @param Pml2PhysicalAddresses
+ *
+ * @return UINT64 The physical address of the root
+ */
+static UINT64
+TestSharedEptBuildCoreTables(PTEST_SHARED_EPT_MEMORY Memory,
+                             UINT64 *                Pml3ReservedPhysicalAddresses,
+                             UINT64 *                Pml2PhysicalAddresses)
+{
+    UINT64   RootPhysicalAddress = TestSharedEptNewTable(Memory);
+    UINT64   Pml3PhysicalAddress = TestSharedEptNewTable(Memory);
+    UINT64 * Root                = TestSharedEptTable(Memory, RootPhysicalAddress);
+    UINT64 * Pml3                = TestSharedEptTable(Memory, Pml3PhysicalAddress);
+
+    Root[0] = Pml3PhysicalAddress | SHARED_EPT_ENTRY_PRESENT;
+
+    for (UINT64 i = 1; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        Root[i] = Pml3ReservedPhysicalAddresses[i - 1] | SHARED_EPT_ENTRY_PRESENT;
+    }
+
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        Pml3[i] = Pml2PhysicalAddresses[i] | SHARED_EPT_ENTRY_PRESENT;
+    }
+
+    return RootPhysicalAddress;
+}
+
+/**
+ * @brief Build the full identity tables of a core (the previous method)
+ *
+ * @param Memory
+ *
+ * @return UINT64 The physical address of the root
+ */
+static UINT64
+TestSharedEptBuildPerCoreTables(PTEST_SHARED_EPT_MEMORY Memory)
+{
+    TEST_SHARED_EPT_SHARED_TABLES Tables;
+
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES - 1; i++)
+    {
+        Tables.Pml3ReservedPhysicalAddresses[i] = TestSharedEptNewTable(Memory);
+    }
+
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        Tables.Pml2PhysicalAddresses[i] = TestSharedEptNewTable(Memory);
+    }
+
+    TestSharedEptFillIdentityTables(Memory, Tables.Pml3ReservedPhysicalAddresses, Tables.Pml2PhysicalAddresses);
+
+    return TestSharedEptBuildCoreTables(Memory, Tables.Pml3ReservedPhysicalAddresses, Tables.Pml2PhysicalAddresses);
+}
+
+/**
+ * @brief Build the shared tables of the identity map
+ *
+ * @param Memory
+ * @param Tables
+ *
+ * @return VOID
+ */
+static VOID
+TestSharedEptBuildSharedTables(PTEST_SHARED_EPT_MEMORY Memory, PTEST_SHARED_EPT_SHARED_TABLES Tables)
+{
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES - 1; i++)
+    {
+        Tables->Pml3ReservedPhysicalAddresses[i] = TestSharedEptNewTable(Memory);
+    }
+
+    for (UINT64 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        Tables->Pml2PhysicalAddresses[i] = TestSharedEptNewTable(Memory);
+    }
+
+    TestSharedEptFillIdentityTables(Memory, Tables->Pml3ReservedPhysicalAddresses, Tables->Pml2PhysicalAddresses);
+}
+
+/**
+ * @brief Get the PML2 entry of an address on a core, the region is
+ * privatized if the shared tables are used, the same as the hypervisor
+ *
+ * @param Memory
+ * @param Tables The shared tables or NULL if the core has its own tables
+ * @param RootPhysicalAddress
+ * @param PhysicalAddress
+ *
+ * @return UINT64 * The entry or NULL if the tables are not allocated
+ */
+static UINT64 *
+TestSharedEptGetPml2Entry(PTEST_SHARED_EPT_MEMORY        Memory,
+                          PTEST_SHARED_EPT_SHARED_TABLES Tables,
+                          UINT64                         RootPhysicalAddress,
+                          UINT64                         PhysicalAddress)
+{
+    SHARED_EPT_CALLBACKS Callbacks = {TestSharedEptAllocateTable, TestSharedEptFreeTable, TestSharedEptPhysicalToVirtual, Memory};
+    UINT64               Gb        = (PhysicalAddress >> 30) & (SHARED_EPT_TABLE_ENTRIES - 1);
+    UINT64 *             Pml3      = TestSharedEptTable(Memory, TestSharedEptTable(Memory, RootPhysicalAddress)[0]);
+    UINT64 *             Pml2;
+
+    if (Tables != NULL && (Pml3[Gb] & SHARED_EPT_ENTRY_ADDRESS) == Tables->Pml2PhysicalAddresses[Gb])
+    {
+        //
+        // The shared table can't be changed by a core
+        //
+        if (SharedEptPrivatizeRegion(TestSharedEptTable(Memory, Tables->Pml2PhysicalAddresses[Gb]), &Pml3[Gb], &Callbacks) == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    Pml2 = TestSharedEptTable(Memory, Pml3[Gb]);
+
+    return &Pml2[(PhysicalAddress >> 21) & (SHARED_EPT_TABLE_ENTRIES - 1)];
+}
+
+/**
+ * @brief Hook a page on a core the same as the hidden hooks (split the 2 MB
+ * page and make the page execute-only on the fake page)
+ *
+ * @param Memory
+ * @param Tables The shared tables or NULL if the core has its own tables
+ * @param RootPhysicalAddress
+ * @param PhysicalAddress
+ * @param FakePage
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSharedEptHookPage(PTEST_SHARED_EPT_MEMORY        Memory,
+                      PTEST_SHARED_EPT_SHARED_TABLES Tables,
+                      UINT64                         RootPhysicalAddress,
+                      UINT64                         PhysicalAddress,
+                      UINT64                         FakePage)
+{
+    UINT64 * Pml2Entry = TestSharedEptGetPml2Entry(Memory, Tables, RootPhysicalAddress, PhysicalAddress);
+    UINT64 * Pml1;
+
+    if (Pml2Entry == NULL)
+    {
+        return FALSE;
+    }
+
+    if (*Pml2Entry & SHARED_EPT_ENTRY_LARGE_PAGE)
+    {
+        TestSharedEptSplit(Memory, Pml2Entry);
+    }
+
+    Pml1 = TestSharedEptTable(Memory, *Pml2Entry);
+
+    Pml1[(PhysicalAddress >> 12) & (SHARED_EPT_TABLE_ENTRIES - 1)] =
+        FakePage | EPTP_VIEW_ENTRY_EXECUTE | (TEST_SHARED_EPT_MEMORY_TYPE_WB << TEST_SHARED_EPT_MEMORY_TYPE_SHIFT);
+
+    return TRUE;
+}
+
+/**
+ * @brief Compare the translations of two roots
+ *
+ * @param FirstMemory
+ * @param FirstRoot
+ * @param SecondMemory
+ * @param SecondRoot
+ * @param Hooks
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSharedEptCompare(PTEST_SHARED_EPT_MEMORY FirstMemory,
+                     UINT64                  FirstRoot,
+                     PTEST_SHARED_EPT_MEMORY SecondMemory,
+                     UINT64                  SecondRoot,
+                     vector<UINT64> &        Hooks)
+{
+    vector<UINT64> Addresses;
+
+    //
+    // Each 2 MB page of the first 512 GB, the 4 KB pages of the split and
+    // hooked 2 MB pages and a few of the 1 GB pages above 512 GB
+    //
+    for (UINT64 Address = 0; Address < TEST_SHARED_EPT_SIZE_512_GB; Address += TEST_SHARED_EPT_SIZE_2_MB)
+    {
+        Addresses.push_back(Address + 0x3000);
+    }
+
+    for (UINT64 Address = 0; Address < TEST_SHARED_EPT_SIZE_2_MB; Address += SHARED_EPT_PAGE_SIZE)
+    {
+        Addresses.push_back(Address);
+        Addresses.push_back(0x7fe00000 + Address);
+
+        for (auto Hook : Hooks)
+        {
+            Addresses.push_back((Hook & ~(TEST_SHARED_EPT_SIZE_2_MB - 1)) + Address);
+        }
+    }
+
+    for (UINT64 i = 1; i < SHARED_EPT_TABLE_ENTRIES; i += 97)
+    {
+        Addresses.push_back(i * TEST_SHARED_EPT_SIZE_512_GB + 5 * TEST_SHARED_EPT_SIZE_1_GB);
+    }
+
+    for (auto Address : Addresses)
+    {
+        UINT64 FirstEntry  = EptpViewTranslate(FirstRoot, Address, TestSharedEptPhysicalToVirtual, FirstMemory);
+        UINT64 SecondEntry = EptpViewTranslate(SecondRoot, Address, TestSharedEptPhysicalToVirtual, SecondMemory);
+
+        if (FirstEntry != SecondEntry || FirstEntry == 0)
+        {
+            printf("[-] the translations of %llx are %llx and %llx\n", Address, FirstEntry, SecondEntry);
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the cost and the failures of the privatization
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSharedEptPrivatization()
+{
+    TEST_SHARED_EPT_MEMORY        Memory    = {{}, MAXUINT64, 0};
+    TEST_SHARED_EPT_MEMORY        Reference = {{}, MAXUINT64, 0};
+    TEST_SHARED_EPT_SHARED_TABLES Tables;
+    SHARED_EPT_CALLBACKS          Callbacks = {TestSharedEptAllocateTable, TestSharedEptFreeTable, TestSharedEptPhysicalToVirtual, &Memory};
+    UINT64                        FirstCore;
+    UINT64                        SecondCore;
+    UINT64                        Pml3Entry;
+    UINT64 *                      Pml2Entry;
+    UINT64 *                      Pml3;
+    UINT64 *                      Result;
+    size_t                        Allocated;
+    vector<vector<UINT64>>        SharedTables;
+    vector<UINT64>                NoHooks;
+
+    TestSharedEptBuildSharedTables(&Memory, &Tables);
+
+    FirstCore  = TestSharedEptBuildCoreTables(&Memory, Tables.Pml3ReservedPhysicalAddresses, Tables.Pml2PhysicalAddresses);
+    SecondCore = TestSharedEptBuildCoreTables(&Memory, Tables.Pml3ReservedPhysicalAddresses, Tables.Pml2PhysicalAddresses);
+
+    //
+    // The first 2 MB and the end of the 2nd GB are split by the MTRRs
+    //
+    if (SharedEptGetRegionCost(TestSharedEptTable(&Memory, Tables.Pml2PhysicalAddresses[0])) != 2 ||
+        SharedEptGetRegionCost(TestSharedEptTable(&Memory, Tables.Pml2PhysicalAddresses[1])) != 2 ||
+        SharedEptGetRegionCost(TestSharedEptTable(&Memory, Tables.Pml2PhysicalAddresses[2])) != 1)
+    {
+        printf("[-] the costs of the regions are not valid\n");
+        return FALSE;
+    }
+
+    //
+    // The privatization of a region with a split needs two tables, nothing
+    // is changed if the second table is not allocated
+    //
+    SharedTables = Memory.Tables;
+    Pml3Entry    = Tables.Pml2PhysicalAddresses[0] | SHARED_EPT_ENTRY_PRESENT;
+    Memory.Limit = Memory.Tables.size() + 1;
+    Result       = SharedEptPrivatizeRegion(TestSharedEptTable(&Memory, Tables.Pml2PhysicalAddresses[0]), &Pml3Entry, &Callbacks);
+
+    if (Result != NULL || Pml3Entry != (Tables.Pml2PhysicalAddresses[0] | SHARED_EPT_ENTRY_PRESENT) || Memory.FreedTables != 1)
+    {
+        printf("[-] the failed privatization changed the entry or leaked the tables\n");
+        return FALSE;
+    }
+
+    Memory.Tables.resize(SharedTables.size());
+    Memory.FreedTables = 0;
+    Memory.Limit       = MAXUINT64;
+
+    if (Memory.Tables != SharedTables)
+    {
+        printf("[-] the failed privatization changed the tables\n");
+        return FALSE;
+    }
+
+    //
+    // A change of a core (e.g., an execution monitor of a 2 MB page on a
+    // single core) is only visible to that core, the split pages of the
+    // region are copied too
+    //
+    Pml2Entry = TestSharedEptGetPml2Entry(&Memory, &Tables, SecondCore, 0x7fc00000);
+
+    if (Pml2Entry == NULL || Memory.Tables.size() != SharedTables.size() + 2)
+    {
+        printf("[-] the region is not privatized\n");
+        return FALSE;
+    }
+
+    *Pml2Entry &= ~EPTP_VIEW_ENTRY_EXECUTE;
+
+    Pml3 = TestSharedEptTable(&Memory, TestSharedEptTable(&Memory, SecondCore)[0]);
+
+    TestSharedEptTable(&Memory, TestSharedEptTable(&Memory, Pml3[1])[511])[0x80] = 0;
+
+    if (EptpViewTranslate(SecondCore, 0x7fc00000, TestSharedEptPhysicalToVirtual, &Memory) & EPTP_VIEW_ENTRY_EXECUTE ||
+        EptpViewTranslate(SecondCore, 0x7fe80000, TestSharedEptPhysicalToVirtual, &Memory) != 0)
+    {
+        printf("[-] the private entries of the core are not used\n");
+        return FALSE;
+    }
+
+    if (!TestSharedEptCompare(&Reference, TestSharedEptBuildPerCoreTables(&Reference), &Memory, FirstCore, NoHooks))
+    {
+        printf("[-] the change of the core is visible to the other cores\n");
+        return FALSE;
+    }
+
+    //
+    // Only the PML3 table of the core is changed
+    //
+    for (size_t i = 0; i < SharedTables.size(); i++)
+    {
+        if (Memory.Tables[i] != SharedTables[i] && i != SecondCore / SHARED_EPT_PAGE_SIZE)
+        {
+            printf("[-] the shared table %llu is changed\n", (UINT64)i);
+            return FALSE;
+        }
+    }
+
+    //
+    // The private region is used for the next changes
+    //
+    Allocated = Memory.Tables.size();
+
+    if (TestSharedEptGetPml2Entry(&Memory, &Tables, SecondCore, 0x40000000) == NULL || Memory.Tables.size() != Allocated)
+    {
+        printf("[-] the private region is privatized again\n");
+        return FALSE;
+    }
+
+    //
+    // Only the copies are freed once the core is terminated, the pages that
+    // are split after the privatization are freed by their owners
+    //
+    TestSharedEptSplit(&Memory, TestSharedEptGetPml2Entry(&Memory, &Tables, SecondCore, 0x40000000));
+
+    SharedEptReleaseRegion(TestSharedEptTable(&Memory, Tables.Pml2PhysicalAddresses[1]), TestSharedEptTable(&Memory, Pml3[1]), &Callbacks);
+
+    if (Memory.FreedTables != 2)
+    {
+        printf("[-] the private copies of the region are not freed\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Hook a page of a region on all of the cores, the region is only
+ * privatized on the cores that still share it, the same as the hypervisor
+ *
+ * @param Reservation
+ * @param PrivateRegions The private regions of each core
+ * @param Region
+ * @param RegionCost
+ *
+ * @return UINT64 Count of the tables that are allocated to top up the pool
+ */
+static UINT64
+TestSharedEptReservationHook(PSHARED_EPT_RESERVATION Reservation, vector<vector<BOOLEAN>> & PrivateRegions, UINT32 Region, UINT32 RegionCost)
+{
+    UINT64 NumberOfTables = 0;
+
+    for (auto & Regions : PrivateRegions)
+    {
+        if (!Regions[Region])
+        {
+            Regions[Region] = TRUE;
+            NumberOfTables += SharedEptRegionPrivatized(Reservation, Region, RegionCost, TRUE);
+        }
+    }
+
+    return NumberOfTables;
+}
+
+/**
+ * @brief Test the reservation of the private tables, the pool only grows
+ * for the regions that are still shared
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSharedEptReservation()
+{
+    SHARED_EPT_RESERVATION  Reservation;
+    vector<vector<BOOLEAN>> PrivateRegions(4, vector<BOOLEAN>(SHARED_EPT_TABLE_ENTRIES, FALSE));
+    UINT64                  PoolSize;
+
+    //
+    // Two hooks are reserved on 4 cores (the maximum cost of a region is 2)
+    //
+    SharedEptInitializeReservation(&Reservation, 4, 2);
+
+    PoolSize = SharedEptReserveRegions(&Reservation, 2);
+
+    if (PoolSize != 2 * 4 * 2)
+    {
+        printf("[-] the tables of the reserved regions are not valid\n");
+        return FALSE;
+    }
+
+    //
+    // The first hook privatizes its region on all of the cores, the used
+    // tables are topped up as other regions are still shared
+    //
+    PoolSize += TestSharedEptReservationHook(&Reservation, PrivateRegions, 1, 2);
+
+    if (PoolSize != 3 * 4 * 2 || Reservation.NumberOfReservedTables != 2 * 4 * 2)
+    {
+        printf("[-] the pool is not topped up after the privatization\n");
+        return FALSE;
+    }
+
+    //
+    // The second hook is in the same (already private) region, neither the
+    // hook nor a batch of the region grow the pool
+    //
+    PoolSize += TestSharedEptReservationHook(&Reservation, PrivateRegions, 1, 2);
+    PoolSize += SharedEptReserveRegion(&Reservation, 1, 2);
+
+    if (PoolSize != 3 * 4 * 2 || Reservation.NumberOfReservedTables != 2 * 4 * 2)
+    {
+        printf("[-] the pool grows for a hook in an already private region\n");
+        return FALSE;
+    }
+
+    //
+    // A batch in a region that is private on half of the cores only
+    // reserves the tables of the other cores
+    //
+    PrivateRegions[0][7] = TRUE;
+    PrivateRegions[1][7] = TRUE;
+    PoolSize += SharedEptRegionPrivatized(&Reservation, 7, 1, FALSE);
+    PoolSize += SharedEptRegionPrivatized(&Reservation, 7, 1, FALSE);
+
+    if (SharedEptReserveRegion(&Reservation, 7, 1) != 2)
+    {
+        printf("[-] the batch reserves the tables of the private cores\n");
+        return FALSE;
+    }
+
+    PoolSize += 2;
+    PoolSize += TestSharedEptReservationHook(&Reservation, PrivateRegions, 7, 1);
+
+    if (PoolSize != 3 * 4 * 2 + 2 || Reservation.NumberOfReservedTables != 2 * 4 * 2)
+    {
+        printf("[-] the tables of the batch are not used\n");
+        return FALSE;
+    }
+
+    //
+    // The reservation never covers more than the regions that are still
+    // shared, even if more hooks are reserved
+    //
+    for (UINT32 Region = 0; Region < SHARED_EPT_TABLE_ENTRIES - 1; Region++)
+    {
+        if (Region != 1 && Region != 7)
+        {
+            TestSharedEptReservationHook(&Reservation, PrivateRegions, Region, 2);
+        }
+    }
+
+    if (Reservation.NumberOfSharedRegions != 1 || SharedEptReserveRegions(&Reservation, 100) != 0)
+    {
+        printf("[-] the reservation covers the private regions\n");
+        return FALSE;
+    }
+
+    if (TestSharedEptReservationHook(&Reservation, PrivateRegions, SHARED_EPT_TABLE_ENTRIES - 1, 2) != 0 ||
+        Reservation.NumberOfSharedRegions != 0 || SharedEptReserveRegions(&Reservation, 100) != 0)
+    {
+        printf("[-] the pool is topped up while all of the regions are private\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Build the tables of the cores and install the hooks with both of
+ * the methods
+ *
+ * @param NumberOfCores
+ * @param Hooks
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSharedEptCompareMethods(UINT32 NumberOfCores, vector<UINT64> & Hooks)
+{
+    TEST_SHARED_EPT_MEMORY        SharedMemory = {{}, MAXUINT64, 0};
+    TEST_SHARED_EPT_SHARED_TABLES Tables;
+    vector<UINT64>                Roots;
+    UINT64                        PerCorePages = 0;
+    UINT64                        SharedPages;
+    double                        PerCoreBuild   = 0;
+    double                        PerCoreInstall = 0;
+    double                        SharedBuild;
+    double                        SharedInstall;
+
+    //
+    // The shared method
+    //
+    auto Start = chrono::steady_clock::now();
+
+    TestSharedEptBuildSharedTables(&SharedMemory, &Tables);
+
+    for (UINT32 Core = 0; Core < NumberOfCores; Core++)
+    {
+        Roots.push_back(TestSharedEptBuildCoreTables(&SharedMemory, Tables.Pml3ReservedPhysicalAddresses, Tables.Pml2PhysicalAddresses));
+    }
+
+    auto Built = chrono::steady_clock::now();
+
+    for (UINT32 Core = 0; Core < NumberOfCores; Core++)
+    {
+        for (size_t i = 0; i < Hooks.size(); i++)
+        {
+            if (!TestSharedEptHookPage(&SharedMemory, &Tables, Roots[Core], Hooks[i], TEST_SHARED_EPT_FAKE_PAGES_BASE + i * SHARED_EPT_PAGE_SIZE))
+            {
+                printf("[-] the hook is not installed on the shared tables\n");
+                return FALSE;
+            }
+        }
+    }
+
+    auto Installed = chrono::steady_clock::now();
+
+    SharedBuild   = chrono::duration<double, milli>(Built - Start).count();
+    SharedInstall = chrono::duration<double, milli>(Installed - Built).count();
+    SharedPages   = SharedMemory.Tables.size();
+
+    //
+    // The previous method, the tables of each core are built and compared
+    // then released (only the first and the last cores are compared)
+    //
+    for (UINT32 Core = 0; Core < NumberOfCores; Core++)
+    {
+        TEST_SHARED_EPT_MEMORY Memory = {{}, MAXUINT64, 0};
+
+        Memory.Tables.reserve(1100);
+
+        Start = chrono::steady_clock::now();
+
+        UINT64 Root = TestSharedEptBuildPerCoreTables(&Memory);
+
+        Built = chrono::steady_clock::now();
+
+        for (size_t i = 0; i < Hooks.size(); i++)
+        {
+            TestSharedEptHookPage(&Memory, NULL, Root, Hooks[i], TEST_SHARED_EPT_FAKE_PAGES_BASE + i * SHARED_EPT_PAGE_SIZE);
+        }
+
+        Installed = chrono::steady_clock::now();
+
+        PerCoreBuild += chrono::duration<double, milli>(Built - Start).count();
+        PerCoreInstall += chrono::duration<double, milli>(Installed - Built).count();
+        PerCorePages += Memory.Tables.size();
+
+        if ((Core == 0 || Core == NumberOfCores - 1) && !TestSharedEptCompare(&Memory, Root, &SharedMemory, Roots[Core], Hooks))
+        {
+            printf("[-] the shared tables of the core %u are not the same as its own tables\n", Core);
+            return FALSE;
+        }
+    }
+
+    printf("[*] %3u cores : %7.2f MB in %8.2f ms (+ %6.2f ms hooks) per core, %6.2f MB in %7.2f ms (+ %6.2f ms hooks) shared\n",
+           NumberOfCores,
+           PerCorePages * SHARED_EPT_PAGE_SIZE / (1024.0 * 1024.0),
+           PerCoreBuild,
+           PerCoreInstall,
+           SharedPages * SHARED_EPT_PAGE_SIZE / (1024.0 * 1024.0),
+           SharedBuild,
+           SharedInstall);
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the shared EPT hierarchy and the private regions of the cores
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestSharedEpt()
+{
+    vector<UINT64> Hooks;
+    UINT32         CoreCounts[] = {1, 8, 32, 128, 256};
+
+    if (!TestSharedEptPrivatization())
+    {
+        return FALSE;
+    }
+
+    if (!TestSharedEptReservation())
+    {
+        return FALSE;
+    }
+
+    //
+    // The hooks are on the pages of a few kernel modules (two of them are
+    // in the regions that have the pages that are split by the MTRRs)
+    //
+    for (UINT32 i = 0; i < TEST_SHARED_EPT_NUMBER_OF_HOOKS; i++)
+    {
+        UINT64 Module = (i % 4 == 0) ? 0x7fd00000 : (i % 4 == 1) ? 0x00001000
+                                                                    : (1 + i % 3) * 0x12a400000ull;
+
+        Hooks.push_back(Module + (i / 4) * 0x5000);
+    }
+
+    for (auto NumberOfCores : CoreCounts)
+    {
+        if (!TestSharedEptCompareMethods(NumberOfCores, Hooks))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
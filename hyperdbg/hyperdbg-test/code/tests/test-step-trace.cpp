@@ -0,0 +1,408 @@
+/**
+ * @file test-step-trace.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the delta encoder and decoder of the step traces
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of simulated steps
+ *
+ */
+#define TEST_STEP_TRACE_NUMBER_OF_STEPS 1000000
+
+/**
+ * @brief A simulated step (RIP and the traced registers after the step)
+ *
+ */
+typedef struct _TEST_STEP_TRACE_STEP
+{
+    UINT64 Rip;
+    UINT64 Registers[STEP_TRACE_NUMBER_OF_REGISTERS];
+
+} TEST_STEP_TRACE_STEP, *PTEST_STEP_TRACE_STEP;
+
+/**
+ * @brief Context of the decode callback that compares the decoded steps
+ *
+ */
+typedef struct _TEST_STEP_TRACE_DECODE_CONTEXT
+{
+    const TEST_STEP_TRACE_STEP * Steps;
+    UINT64                       FirstStep;
+    UINT8                        NumberOfRegisters;
+    UINT64                       NumberOfMismatches;
+    UINT64                       Checksum;
+
+} TEST_STEP_TRACE_DECODE_CONTEXT, *PTEST_STEP_TRACE_DECODE_CONTEXT;
+
+/**
+ * @brief Generate a pseudo-random number (xorshift64)
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestStepTraceRandom(UINT64 * State)
+{
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return *State;
+}
+
+/**
+ * @brief Simulate the execution of a program
+ * @details The program is a set of loops (with short instructions and a loop
+ * counter in rcx), calls to far functions (which push on the stack)
+ * and rare transitions to the kernel
+ *
+ * @param Steps
+ *
+ * @return VOID
+ */
+static VOID
+TestStepTraceSimulateExecution(std::vector<TEST_STEP_TRACE_STEP> & Steps)
+{
+    UINT64               RandomState = 0x9E3779B97F4A7C15ull;
+    UINT64               LoopStart   = 0x00007ff712341000;
+    UINT64               Rsp         = 0x000000c0ffeef000;
+    UINT64               Rax         = 0;
+    UINT64               Rcx         = 0;
+    UINT64               Rdx         = 0;
+    UINT32               LoopLength  = 0;
+    UINT32               Position    = 0;
+    UINT8                Lengths[32] = {0};
+    TEST_STEP_TRACE_STEP Step        = {0};
+
+    Steps.reserve(TEST_STEP_TRACE_NUMBER_OF_STEPS);
+
+    while (Steps.size() < TEST_STEP_TRACE_NUMBER_OF_STEPS)
+    {
+        if (Rcx == 0)
+        {
+            UINT64 Random = TestStepTraceRandom(&RandomState);
+
+            //
+            // Start a new loop, it's either near the previous one, in a far
+            // function, or in the kernel
+            //
+            if ((Random & 0x3f) == 0)
+            {
+                LoopStart = 0xfffff80412000000 + ((Random >> 8) & 0xfffff0);
+            }
+            else if ((Random & 0x7) == 0)
+            {
+                LoopStart = 0x00007ffa00000000 + ((Random >> 8) & 0xffffff0);
+                Rsp -= 8;
+            }
+            else
+            {
+                LoopStart += (Random >> 8) & 0x3ff;
+            }
+
+            LoopLength = 4 + (UINT32)((Random >> 40) % 24);
+            Rcx        = 1 + ((Random >> 48) & 0xff);
+            Position   = 0;
+
+            for (UINT32 i = 0; i < LoopLength; i++)
+            {
+                Lengths[i] = (UINT8)(1 + (TestStepTraceRandom(&RandomState) % 7));
+            }
+
+            Step.Rip = LoopStart;
+        }
+
+        //
+        // Execute an instruction of the loop
+        //
+        if (Position == LoopLength - 1)
+        {
+            //
+            // The backward jump of the loop
+            //
+            Rcx--;
+            Position = 0;
+            Step.Rip = LoopStart;
+        }
+        else
+        {
+            Step.Rip += Lengths[Position];
+            Position++;
+
+            if (Position % 3 == 0)
+            {
+                Rax += Position;
+            }
+
+            if (Position == 5)
+            {
+                Rdx = TestStepTraceRandom(&RandomState);
+            }
+        }
+
+        Step.Registers[0] = Rax;
+        Step.Registers[1] = Rcx;
+        Step.Registers[2] = Rdx;
+        Step.Registers[3] = Rsp;
+
+        Steps.push_back(Step);
+    }
+}
+
+/**
+ * @brief Callback of decoding the steps
+ *
+ * @param StepIndex
+ * @param Rip
+ * @param Registers
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestStepTraceDecodeCallback(UINT32 StepIndex, UINT64 Rip, const UINT64 * Registers, PVOID Context)
+{
+    PTEST_STEP_TRACE_DECODE_CONTEXT DecodeContext = (PTEST_STEP_TRACE_DECODE_CONTEXT)Context;
+    const TEST_STEP_TRACE_STEP *    Step          = &DecodeContext->Steps[DecodeContext->FirstStep + StepIndex];
+
+    if (Rip != Step->Rip ||
+        memcmp(Registers, Step->Registers, DecodeContext->NumberOfRegisters * sizeof(UINT64)) != 0)
+    {
+        DecodeContext->NumberOfMismatches++;
+    }
+
+    DecodeContext->Checksum += Rip ^ Registers[0];
+
+    return TRUE;
+}
+
+/**
+ * @brief Encode the simulated steps the way that the debuggee records them,
+ * and decode them the way that the debugger shows them
+ * @details Each time that the buffer is full, it's sent to the debugger
+ * and the trace continues with a new buffer
+ *
+ * @param Steps
+ * @param NumberOfRegisters
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestStepTraceRoundTrip(const std::vector<TEST_STEP_TRACE_STEP> & Steps, UINT8 NumberOfRegisters)
+{
+    BOOLEAN                        Result                                      = TRUE;
+    UINT8                          RegisterIds[STEP_TRACE_NUMBER_OF_REGISTERS] = {0, 1, 2, 4}; // rax, rcx, rdx, rsp
+    UINT64                         InitialRip                                  = Steps[0].Rip - 4;
+    UINT64                         InitialRegisters[STEP_TRACE_NUMBER_OF_REGISTERS];
+    UINT64                         NumberOfBuffers = 0;
+    UINT64                         NumberOfChunks  = 0;
+    UINT64                         EncodedSize     = 0;
+    UINT64                         Position        = 0;
+    long long                      EncodeTime      = 0;
+    long long                      DecodeTime      = 0;
+    TEST_STEP_TRACE_DECODE_CONTEXT DecodeContext   = {0};
+    PSTEP_TRACE_BUFFER             Buffer;
+    UINT64                         RawSize;
+    UINT64                         StepByStepSize;
+    UINT64                         TracedSize;
+
+    Buffer = (PSTEP_TRACE_BUFFER)malloc(sizeof(STEP_TRACE_BUFFER));
+
+    if (Buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    memcpy(InitialRegisters, Steps[0].Registers, sizeof(InitialRegisters));
+
+    DecodeContext.Steps             = Steps.data();
+    DecodeContext.NumberOfRegisters = NumberOfRegisters;
+
+    while (Position < Steps.size())
+    {
+        //
+        // Record the steps until the buffer is full (debuggee)
+        //
+        auto EncodeStart = std::chrono::high_resolution_clock::now();
+
+        if (!StepTraceInitializeBuffer(Buffer, 0, NumberOfRegisters, RegisterIds, InitialRip, InitialRegisters))
+        {
+            printf("[-] initializing the step trace buffer failed\n");
+            Result = FALSE;
+            break;
+        }
+
+        while (Position < Steps.size() && !StepTraceIsBufferFull(Buffer))
+        {
+            if (!StepTraceAddStep(Buffer, Steps[Position].Rip, Steps[Position].Registers))
+            {
+                printf("[-] adding a step to the step trace buffer failed\n");
+                Result = FALSE;
+                break;
+            }
+
+            Position++;
+        }
+
+        auto EncodeEnd = std::chrono::high_resolution_clock::now();
+
+        //
+        // Decode the steps (debugger)
+        //
+        DecodeContext.FirstStep = Position - Buffer->Header.NumberOfSteps;
+
+        if (!StepTraceDecode(&Buffer->Header, Buffer->Data, Buffer->Header.DataSize, TestStepTraceDecodeCallback, &DecodeContext))
+        {
+            printf("[-] decoding the step trace buffer failed\n");
+            Result = FALSE;
+        }
+
+        auto DecodeEnd = std::chrono::high_resolution_clock::now();
+
+        EncodeTime += (long long)std::chrono::duration_cast<std::chrono::microseconds>(EncodeEnd - EncodeStart).count();
+        DecodeTime += (long long)std::chrono::duration_cast<std::chrono::microseconds>(DecodeEnd - EncodeEnd).count();
+
+        NumberOfBuffers++;
+        NumberOfChunks += (Buffer->Header.DataSize + STEP_TRACE_MAXIMUM_CHUNK_SIZE - 1) / STEP_TRACE_MAXIMUM_CHUNK_SIZE;
+        EncodedSize += sizeof(STEP_TRACE_HEADER) + Buffer->Header.DataSize;
+
+        //
+        // The next trace starts from the last step
+        //
+        InitialRip = Buffer->Header.LastRip;
+        memcpy(InitialRegisters, Buffer->Header.LastRegisters, sizeof(InitialRegisters));
+
+        if (!Result)
+        {
+            break;
+        }
+    }
+
+    if (DecodeContext.NumberOfMismatches != 0)
+    {
+        printf("[-] %llu decoded step(s) are not matched\n", DecodeContext.NumberOfMismatches);
+        Result = FALSE;
+    }
+
+    //
+    // Compare with the raw steps and with sending a step packet and
+    // receiving a pause packet for each of the steps
+    //
+    RawSize        = Steps.size() * (sizeof(UINT64) + NumberOfRegisters * sizeof(UINT64));
+    StepByStepSize = Steps.size() * (sizeof(DEBUGGER_REMOTE_PACKET) * 2 + sizeof(DEBUGGEE_STEP_PACKET) + sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+    TracedSize     = EncodedSize +
+                 NumberOfBuffers * (sizeof(DEBUGGER_REMOTE_PACKET) * 2 + sizeof(DEBUGGEE_STEP_PACKET) + sizeof(DEBUGGEE_KD_PAUSED_PACKET)) +
+                 NumberOfChunks * (sizeof(DEBUGGER_REMOTE_PACKET) * 2 + SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET * 2);
+
+    printf("[*] %d register(s) : %llu step(s), %llu buffer(s), %.2f byte(s) per step, %.1fx smaller than raw, "
+           "%.1fx smaller than stepping one by one (%llu round-trips instead of %llu)\n",
+           NumberOfRegisters,
+           (UINT64)Steps.size(),
+           NumberOfBuffers,
+           (double)EncodedSize / Steps.size(),
+           (double)RawSize / EncodedSize,
+           (double)StepByStepSize / TracedSize,
+           NumberOfBuffers + NumberOfChunks,
+           (UINT64)Steps.size());
+
+    printf("[*] %d register(s) : encoding %.1f million step(s)/s, decoding %.1f million step(s)/s (checksum: %llx)\n",
+           NumberOfRegisters,
+           EncodeTime == 0 ? 0.0 : (double)Steps.size() / EncodeTime,
+           DecodeTime == 0 ? 0.0 : (double)Steps.size() / DecodeTime,
+           DecodeContext.Checksum);
+
+    free(Buffer);
+
+    return Result;
+}
+
+/**
+ * @brief Test the delta encoder and decoder of the step traces
+ * @details Round-trips a simulated execution with different numbers of
+ * traced registers, measures the compression and throughput, and checks
+ * that the malformed traces are rejected
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestStepTrace()
+{
+    BOOLEAN                           OverallResult = TRUE;
+    UINT8                             InvalidIds[2] = {0, EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS};
+    UINT64                            Registers[2]  = {0};
+    PSTEP_TRACE_BUFFER                Buffer;
+    std::vector<TEST_STEP_TRACE_STEP> Steps;
+
+    TestStepTraceSimulateExecution(Steps);
+
+    for (UINT8 NumberOfRegisters = 0; NumberOfRegisters <= STEP_TRACE_NUMBER_OF_REGISTERS; NumberOfRegisters += 2)
+    {
+        if (!TestStepTraceRoundTrip(Steps, NumberOfRegisters))
+        {
+            OverallResult = FALSE;
+        }
+    }
+
+    Buffer = (PSTEP_TRACE_BUFFER)malloc(sizeof(STEP_TRACE_BUFFER));
+
+    if (Buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Invalid registers should be rejected
+    //
+    if (StepTraceInitializeBuffer(Buffer, 0, 2, InvalidIds, 0, Registers) ||
+        StepTraceInitializeBuffer(Buffer, 0, STEP_TRACE_NUMBER_OF_REGISTERS + 1, InvalidIds, 0, Registers))
+    {
+        printf("[-] the invalid registers are not detected\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Large differences (e.g., user-mode to kernel-mode) should be kept
+    //
+    StepTraceInitializeBuffer(Buffer, 0, 1, InvalidIds, 0x00007ff700001000, Registers);
+
+    Registers[0] = MAXUINT64;
+
+    if (!StepTraceAddStep(Buffer, 0xfffff80412345678, Registers) ||
+        !StepTraceAddStep(Buffer, 0x0000000000000000, Registers) ||
+        !StepTraceDecode(&Buffer->Header, Buffer->Data, Buffer->Header.DataSize, NULL, NULL) ||
+        Buffer->Header.LastRip != 0 || Buffer->Header.LastRegisters[0] != MAXUINT64)
+    {
+        printf("[-] encoding the large differences failed\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Truncated and corrupted traces should be rejected
+    //
+    if (StepTraceDecode(&Buffer->Header, Buffer->Data, Buffer->Header.DataSize - 1, NULL, NULL))
+    {
+        printf("[-] the truncated trace is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    Buffer->Header.DataSize--;
+
+    if (StepTraceDecode(&Buffer->Header, Buffer->Data, Buffer->Header.DataSize, NULL, NULL))
+    {
+        printf("[-] the corrupted trace is not detected\n");
+        OverallResult = FALSE;
+    }
+
+    free(Buffer);
+
+    return OverallResult;
+}
@@ -0,0 +1,432 @@
+/**
+ * @file test-sub-page-permission.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the tables of the sub-page write permissions (SPP)
+ * @details The masks of the monitored ranges and the tables are checked, then
+ * traces of the writes to the monitored pages are replayed on the tables the
+ * same way that the processor checks them, to count the EPT violations that
+ * are avoided and to make sure that no write to a monitored range is missed
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the writes of each trace
+ *
+ */
+#define TEST_SPP_NUMBER_OF_WRITES 200000
+
+/**
+ * @brief The memory of the tables (the physical address of the table i
+ * is (i + 1) * SPP_PAGE_SIZE)
+ *
+ */
+typedef struct _TEST_SPP_MEMORY
+{
+    vector<vector<UINT64>> Tables;
+    UINT32                 MaximumTables;
+
+} TEST_SPP_MEMORY, *PTEST_SPP_MEMORY;
+
+/**
+ * @brief A monitored range and the writes to its page
+ *
+ */
+typedef struct _TEST_SPP_TRACE
+{
+    const char * Name;
+    UINT64       StartAddress;
+    UINT64       EndAddress; // Inclusive
+    UINT32       ObjectSize; // The page is an array of the objects of this size
+    UINT32       HotFields[8]; // Offsets (in the objects) of the fields that are written
+    UINT32       HotFieldsSize[8];
+
+} TEST_SPP_TRACE, *PTEST_SPP_TRACE;
+
+/**
+ * @brief Allocate a table
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+static PVOID
+TestSppAllocate(UINT64 * PhysicalAddress, PVOID Context)
+{
+    PTEST_SPP_MEMORY Memory = (PTEST_SPP_MEMORY)Context;
+
+    if (Memory->Tables.size() >= Memory->MaximumTables)
+    {
+        return NULL;
+    }
+
+    Memory->Tables.emplace_back(SPP_TABLE_ENTRIES, 0);
+
+    *PhysicalAddress = Memory->Tables.size() * SPP_PAGE_SIZE;
+
+    return Memory->Tables.back().data();
+}
+
+/**
+ * @brief Convert the physical address of a table to its virtual address
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+static PVOID
+TestSppPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context)
+{
+    PTEST_SPP_MEMORY Memory = (PTEST_SPP_MEMORY)Context;
+    UINT64           Index  = PhysicalAddress / SPP_PAGE_SIZE;
+
+    if (Index == 0 || Index > Memory->Tables.size())
+    {
+        return NULL;
+    }
+
+    return Memory->Tables[Index - 1].data();
+}
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT32
+ */
+static UINT32
+TestSppRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return (UINT32)(*State >> 33);
+}
+
+/**
+ * @brief Test the masks of the ranges and the vectors
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSppMasks()
+{
+    UINT64 Seed = 0x5bb;
+
+    struct
+    {
+        UINT64 StartAddress;
+        UINT64 EndAddress;
+        UINT32 SubPages;
+    } Ranges[] = {
+        {0x1000, 0x1000, 0x00000001},
+        {0x107f, 0x1080, 0x00000003},
+        {0x1080, 0x10ff, 0x00000002},
+        {0x1348, 0x1357, 0x00000040},
+        {0x1f80, 0x1fff, 0x80000000},
+        {0x1000, 0x1fff, SPP_ALL_SUB_PAGES},
+        {0x1100, 0x13ff, 0x000000fc},
+        {0x1ff0, 0x200f, 0}, // Not in a single page
+        {0x1200, 0x11ff, 0}, // Empty
+    };
+
+    for (auto & Range : Ranges)
+    {
+        UINT32 SubPages = SppGetSubPagesOfRange(Range.StartAddress, Range.EndAddress);
+
+        if (SubPages != Range.SubPages)
+        {
+            printf("[-] the sub-pages of %llx-%llx are %x, expected %x\n",
+                   Range.StartAddress,
+                   Range.EndAddress,
+                   SubPages,
+                   Range.SubPages);
+            return FALSE;
+        }
+    }
+
+    if (SppGetWriteVector(0) != SPP_WRITE_VECTOR_ALL_WRITABLE || SppGetWriteVector(SPP_ALL_SUB_PAGES) != 0)
+    {
+        printf("[-] the vectors of the empty and the full masks are not valid\n");
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < 10000; i++)
+    {
+        UINT32 SubPages = TestSppRandom(&Seed) ^ (TestSppRandom(&Seed) << 16);
+        UINT64 Vector   = SppGetWriteVector(SubPages);
+        UINT64 Expected = 0;
+
+        for (UINT32 j = 0; j < SPP_SUB_PAGES_IN_A_PAGE; j++)
+        {
+            if (!(SubPages & (1u << j)))
+            {
+                Expected |= 1ull << (2 * j);
+            }
+        }
+
+        if (Vector != Expected)
+        {
+            printf("[-] the vector of %x is %llx, expected %llx\n", SubPages, Vector, Expected);
+            return FALSE;
+        }
+    }
+
+    //
+    // The writes are allowed only if all of their sub-pages are writable
+    //
+    UINT64 Vector = SppGetWriteVector(0x00000040); // 0x300-0x37f is protected
+
+    if (!SppIsWriteAllowedByVector(Vector, 0x12f8, 8) ||
+        SppIsWriteAllowedByVector(Vector, 0x12fc, 8) ||
+        SppIsWriteAllowedByVector(Vector, 0x1350, 1) ||
+        !SppIsWriteAllowedByVector(Vector, 0x1380, 16) ||
+        !SppIsWriteAllowedByVector(Vector, 0x1ffc, 8))
+    {
+        printf("[-] the writes across the sub-pages are not checked correctly\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test building the tables
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSppTables()
+{
+    SPP_TABLE       Table;
+    TEST_SPP_MEMORY Memory;
+
+    Memory.MaximumTables = 32;
+
+    if (!SppTableInitialize(&Table, TestSppAllocate, TestSppPhysicalToVirtual, &Memory))
+    {
+        printf("[-] the root table is not allocated\n");
+        return FALSE;
+    }
+
+    //
+    // Pages that share the tables of the lower levels and pages that need the
+    // new tables (the expected count includes the root)
+    //
+    struct
+    {
+        UINT64 PhysicalAddress;
+        UINT32 NumberOfTables;
+    } Pages[] = {
+        {0x1000, 4},
+        {0x2000, 4},
+        {0x1ff000, 4},
+        {0x200000, 5},
+        {0x40000000, 7},
+        {0x8000000000, 10},
+        {0x8000001000, 10},
+    };
+
+    for (auto & Page : Pages)
+    {
+        UINT64 Vector = SppGetWriteVector(SppGetSubPagesOfRange(Page.PhysicalAddress + 0x100, Page.PhysicalAddress + 0x10f));
+
+        if (!SppTableSetWriteVector(&Table, Page.PhysicalAddress, Vector) || Table.NumberOfTables != Page.NumberOfTables)
+        {
+            printf("[-] the vector of %llx is not set (%u tables, expected %u)\n",
+                   Page.PhysicalAddress,
+                   Table.NumberOfTables,
+                   Page.NumberOfTables);
+            return FALSE;
+        }
+    }
+
+    for (auto & Page : Pages)
+    {
+        UINT64 * Vector = SppTableGetWriteVector(&Table, Page.PhysicalAddress);
+
+        if (Vector == NULL ||
+            *Vector != SppGetWriteVector(0x00000004) ||
+            SppTableIsWriteAllowed(&Table, Page.PhysicalAddress + 0x104, 4) ||
+            !SppTableIsWriteAllowed(&Table, Page.PhysicalAddress + 0x180, 8))
+        {
+            printf("[-] the vector of %llx is not valid\n", Page.PhysicalAddress);
+            return FALSE;
+        }
+    }
+
+    //
+    // A page without the tables is the same as an SPPT miss
+    //
+    if (SppTableGetWriteVector(&Table, 0x3000000) != NULL || SppTableIsWriteAllowed(&Table, 0x3000000, 1))
+    {
+        printf("[-] a page without the tables is mapped\n");
+        return FALSE;
+    }
+
+    //
+    // The reserved bits are never set
+    //
+    SppTableSetWriteVector(&Table, 0x3000, ~0ull);
+
+    if (*SppTableGetWriteVector(&Table, 0x3000) != SPP_WRITE_VECTOR_ALL_WRITABLE)
+    {
+        printf("[-] the reserved bits of the vector are set\n");
+        return FALSE;
+    }
+
+    //
+    // Not enough tables in the pools
+    //
+    Memory.MaximumTables = Table.NumberOfTables + 1;
+
+    if (SppTableSetWriteVector(&Table, 0x10000000000, 0))
+    {
+        printf("[-] a vector is set without the tables\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Replay the writes of a trace on a monitored page
+ *
+ * @param Trace
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSppReplayTrace(PTEST_SPP_TRACE Trace)
+{
+    SPP_TABLE       Table;
+    TEST_SPP_MEMORY Memory;
+    UINT64          Seed              = 0x5bbb;
+    UINT64          PageAddress       = Trace->StartAddress & ~((UINT64)SPP_PAGE_SIZE - 1);
+    UINT64          ExitsOfPage       = 0;
+    UINT64          ExitsOfSubPages   = 0;
+    UINT64          WritesToRange     = 0;
+    UINT32          ProtectedSubPages = SppGetSubPagesOfRange(Trace->StartAddress, Trace->EndAddress);
+    BOOLEAN         IsSppUsed;
+    UINT32          NumberOfHotFields = 0;
+
+    Memory.MaximumTables = 16;
+    SppTableInitialize(&Table, TestSppAllocate, TestSppPhysicalToVirtual, &Memory);
+
+    //
+    // The same as the write monitors, the pages that all of their sub-pages
+    // are monitored use the page granularity
+    //
+    IsSppUsed = ProtectedSubPages != SPP_ALL_SUB_PAGES &&
+                SppTableSetWriteVector(&Table, PageAddress, SppGetWriteVector(ProtectedSubPages));
+
+    while (NumberOfHotFields < 8 && Trace->HotFieldsSize[NumberOfHotFields] != 0)
+    {
+        NumberOfHotFields++;
+    }
+
+    for (UINT32 i = 0; i < TEST_SPP_NUMBER_OF_WRITES; i++)
+    {
+        UINT32  Object  = TestSppRandom(&Seed) % (SPP_PAGE_SIZE / Trace->ObjectSize);
+        UINT32  Field   = TestSppRandom(&Seed) % NumberOfHotFields;
+        UINT32  Size    = Trace->HotFieldsSize[Field];
+        UINT64  Address = PageAddress + Object * Trace->ObjectSize + Trace->HotFields[Field];
+        BOOLEAN IsInRange;
+        BOOLEAN IsProtected = FALSE;
+        BOOLEAN IsExit;
+
+        if (Address + Size > PageAddress + SPP_PAGE_SIZE)
+        {
+            continue;
+        }
+
+        //
+        // The write triggers the monitor if any of its bytes is in the range
+        //
+        IsInRange = Address <= Trace->EndAddress && Address + Size - 1 >= Trace->StartAddress;
+
+        for (UINT64 Byte = Address; Byte < Address + Size; Byte++)
+        {
+            if (ProtectedSubPages & (1u << ((Byte & (SPP_PAGE_SIZE - 1)) >> SPP_SUB_PAGE_SHIFT)))
+            {
+                IsProtected = TRUE;
+            }
+        }
+
+        //
+        // Without the SPP, each write to the page causes an EPT violation
+        //
+        ExitsOfPage++;
+        IsExit = IsSppUsed ? !SppTableIsWriteAllowed(&Table, Address, Size) : TRUE;
+
+        if (IsExit)
+        {
+            ExitsOfSubPages++;
+        }
+
+        if (IsInRange)
+        {
+            WritesToRange++;
+        }
+
+        if ((IsInRange && !IsExit) || (IsSppUsed && IsExit != IsProtected))
+        {
+            printf("[-] %s: the write to %llx (size: %u) %s\n",
+                   Trace->Name,
+                   Address,
+                   Size,
+                   IsExit ? "causes an unexpected exit" : "to the monitored range is missed");
+            return FALSE;
+        }
+    }
+
+    printf("[*] %s : %llu writes to the range, %llu exits of the page, %llu exits with SPP (%.1f%% avoided)\n",
+           Trace->Name,
+           WritesToRange,
+           ExitsOfPage,
+           ExitsOfSubPages,
+           ExitsOfPage ? 100.0 * (ExitsOfPage - ExitsOfSubPages) / ExitsOfPage : 0.0);
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the tables of the sub-page write permissions
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestSubPagePermission()
+{
+    //
+    // Writes to the objects of busy kernel pages (e.g., locks, reference
+    // counts and list entries of the objects of a pool page)
+    //
+    TEST_SPP_TRACE Traces[] = {
+        {"16-byte field of an object", 0x12c2d1348, 0x12c2d1357, 0x400, {0x0, 0x8, 0x30, 0x348, 0x350, 0x2e0, 0x1f8}, {8, 8, 4, 8, 8, 1, 16}},
+        {"field across the sub-pages", 0x12c2d107c, 0x12c2d1083, 0x100, {0x0, 0x18, 0x7c, 0x80, 0xc8, 0x7a}, {8, 8, 4, 4, 8, 8}},
+        {"a list of small objects", 0x12c2d1000, 0x12c2d17ff, 0x40, {0x0, 0x8, 0x20, 0x38}, {8, 8, 4, 2}},
+        {"whole page", 0x12c2d1000, 0x12c2d1fff, 0x200, {0x0, 0x10, 0x48}, {8, 4, 8}},
+    };
+
+    if (!TestSppMasks() || !TestSppTables())
+    {
+        return FALSE;
+    }
+
+    for (auto & Trace : Traces)
+    {
+        if (!TestSppReplayTrace(&Trace))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,362 @@
+/**
+ * @file test-symbol-sync.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the incremental symbol table synchronization
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief State of the simulated debugger that receives the batches
+ *
+ */
+typedef struct _TEST_SYMBOL_SYNC_DEBUGGER
+{
+    MODULE_SYMBOL_DETAIL * SymbolTable;
+    UINT32                 NumberOfModules;
+    UINT32                 NumberOfPackets;
+    UINT64                 NumberOfBytes;
+    BOOLEAN                IsApplyingFailed;
+
+} TEST_SYMBOL_SYNC_DEBUGGER, *PTEST_SYMBOL_SYNC_DEBUGGER;
+
+/**
+ * @brief Fill a simulated module
+ *
+ * @param Module
+ * @param BaseAddress
+ * @param Id Identifier of the module (used to generate the names and the GUID)
+ * @param Age Age of the PDB (changing it simulates a rebuilt module)
+ * @param IsUserMode
+ *
+ * @return VOID
+ */
+static VOID
+TestSymbolSyncFillModule(PMODULE_SYMBOL_DETAIL Module, UINT64 BaseAddress, UINT32 Id, UINT32 Age, BOOLEAN IsUserMode)
+{
+    RtlZeroMemory(Module, sizeof(MODULE_SYMBOL_DETAIL));
+
+    Module->BaseAddress = BaseAddress;
+    Module->IsUserMode  = IsUserMode;
+
+    if (IsUserMode)
+    {
+        sprintf_s(Module->FilePath, MAX_PATH, "c:\\windows\\system32\\usermodule%u.dll", Id);
+    }
+    else
+    {
+        sprintf_s(Module->FilePath, MAX_PATH, "c:\\windows\\system32\\drivers\\kernelmodule%u.sys", Id);
+    }
+
+    //
+    // Every 10th module does not have symbol details (keyed on its path)
+    //
+    if (Id % 10 != 0)
+    {
+        Module->IsSymbolDetailsFound = TRUE;
+        sprintf_s(Module->ModuleSymbolPath, MAX_PATH, "module%u.pdb", Id);
+        sprintf_s(Module->ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE, "%08X1A2B3C4D5E6F7A8B9C0D1E2F%x", Id * 0x9e3779b1, Age);
+    }
+}
+
+/**
+ * @brief Callback of the synchronization that simulates sending the batch
+ * over serial and applying it on the debugger
+ *
+ * @param Batch
+ * @param BatchLength
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSymbolSyncSendBatch(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch, UINT32 BatchLength, PVOID Context)
+{
+    PTEST_SYMBOL_SYNC_DEBUGGER Debugger = (PTEST_SYMBOL_SYNC_DEBUGGER)Context;
+
+    if (BatchLength > SYMBOL_SYNC_MAXIMUM_BATCH_SIZE)
+    {
+        Debugger->IsApplyingFailed = TRUE;
+        return FALSE;
+    }
+
+    Debugger->NumberOfPackets++;
+    Debugger->NumberOfBytes += sizeof(DEBUGGER_REMOTE_PACKET) + BatchLength;
+
+    if (!SymbolSyncApplyBatch(Batch,
+                              BatchLength,
+                              Debugger->SymbolTable,
+                              &Debugger->NumberOfModules,
+                              MAXIMUM_SUPPORTED_SYMBOLS))
+    {
+        Debugger->IsApplyingFailed = TRUE;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether the debugger's table has exactly the same modules
+ *
+ * @param Debugger
+ * @param SymbolTable
+ * @param NumberOfModules
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSymbolSyncCompareTables(PTEST_SYMBOL_SYNC_DEBUGGER Debugger, PMODULE_SYMBOL_DETAIL SymbolTable, UINT32 NumberOfModules)
+{
+    if (Debugger->IsApplyingFailed || Debugger->NumberOfModules != NumberOfModules)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < NumberOfModules; i++)
+    {
+        BOOLEAN IsFound = FALSE;
+
+        for (UINT32 j = 0; j < Debugger->NumberOfModules; j++)
+        {
+            PMODULE_SYMBOL_DETAIL Module = &Debugger->SymbolTable[j];
+
+            if (SymbolSyncIsSameModule(Module, &SymbolTable[i]) &&
+                Module->IsSymbolDetailsFound == SymbolTable[i].IsSymbolDetailsFound &&
+                Module->IsUserMode == SymbolTable[i].IsUserMode &&
+                !strcmp(Module->FilePath, SymbolTable[i].FilePath) &&
+                !strcmp(Module->ModuleSymbolPath, SymbolTable[i].ModuleSymbolPath))
+            {
+                IsFound = TRUE;
+                break;
+            }
+        }
+
+        if (!IsFound)
+        {
+            return FALSE;
+        }
+    }
+
+    return SymbolSyncComputeDigest(Debugger->SymbolTable, Debugger->NumberOfModules) ==
+           SymbolSyncComputeDigest(SymbolTable, NumberOfModules);
+}
+
+/**
+ * @brief Synchronize the debugger with the current table and show the cost
+ *
+ * @param Name
+ * @param Debugger
+ * @param PreviousTable
+ * @param PreviousNumberOfModules
+ * @param CurrentTable
+ * @param CurrentNumberOfModules
+ * @param DebuggerSymbolTableDigest
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSymbolSyncPerformSync(const char *               Name,
+                          PTEST_SYMBOL_SYNC_DEBUGGER Debugger,
+                          PMODULE_SYMBOL_DETAIL      PreviousTable,
+                          UINT32                     PreviousNumberOfModules,
+                          PMODULE_SYMBOL_DETAIL      CurrentTable,
+                          UINT32                     CurrentNumberOfModules,
+                          UINT64                     DebuggerSymbolTableDigest)
+{
+    BOOLEAN Result;
+
+    Debugger->NumberOfPackets = 0;
+    Debugger->NumberOfBytes   = 0;
+
+    Result = SymbolSyncSendDifference(PreviousTable,
+                                      PreviousNumberOfModules,
+                                      CurrentTable,
+                                      CurrentNumberOfModules,
+                                      DebuggerSymbolTableDigest,
+                                      TestSymbolSyncSendBatch,
+                                      Debugger) &&
+             TestSymbolSyncCompareTables(Debugger, CurrentTable, CurrentNumberOfModules);
+
+    printf("[%c] %-36s : %4u packet(s), %8llu byte(s)\n",
+           Result ? '+' : '-',
+           Name,
+           Debugger->NumberOfPackets,
+           Debugger->NumberOfBytes);
+
+    return Result;
+}
+
+/**
+ * @brief Test the incremental symbol table synchronization by simulating
+ * a change in the list of the modules and counting the packets and bytes
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestSymbolSynchronization()
+{
+    const UINT32              KernelModules  = 200;
+    const UINT32              UserModules    = 150;
+    const UINT32              TotalModules   = KernelModules + UserModules;
+    BOOLEAN                   OverallResult  = TRUE;
+    UINT32                    CurrentModules = 0;
+    UINT32                    LegacyPackets;
+    TEST_SYMBOL_SYNC_DEBUGGER Debugger       = {0};
+    PMODULE_SYMBOL_DETAIL     PreviousTable  = NULL;
+    PMODULE_SYMBOL_DETAIL     CurrentTable   = NULL;
+
+    PreviousTable        = (PMODULE_SYMBOL_DETAIL)malloc(TotalModules * sizeof(MODULE_SYMBOL_DETAIL));
+    CurrentTable         = (PMODULE_SYMBOL_DETAIL)malloc(MAXIMUM_SUPPORTED_SYMBOLS * sizeof(MODULE_SYMBOL_DETAIL));
+    Debugger.SymbolTable = (MODULE_SYMBOL_DETAIL *)malloc(MAXIMUM_SUPPORTED_SYMBOLS * sizeof(MODULE_SYMBOL_DETAIL));
+
+    if (PreviousTable == NULL || CurrentTable == NULL || Debugger.SymbolTable == NULL)
+    {
+        free(PreviousTable);
+        free(CurrentTable);
+        free(Debugger.SymbolTable);
+        return FALSE;
+    }
+
+    //
+    // Previous module list (user-mode modules first, like the real table)
+    //
+    for (UINT32 i = 0; i < UserModules; i++)
+    {
+        TestSymbolSyncFillModule(&PreviousTable[i], 0x7ff800000000 + (i * 0x100000), i, 1, TRUE);
+    }
+
+    for (UINT32 i = 0; i < KernelModules; i++)
+    {
+        TestSymbolSyncFillModule(&PreviousTable[UserModules + i], 0xfffff80000000000 + (i * 0x200000), 1000 + i, 1, FALSE);
+    }
+
+    //
+    // Current module list: 6 user-mode modules are unloaded, 9 new modules are
+    // loaded, one module is rebased and one driver is replaced by a rebuilt one
+    // (same base address, new PDB age)
+    //
+    for (UINT32 i = 0; i < TotalModules; i++)
+    {
+        if (i >= 20 && i < 26)
+        {
+            continue;
+        }
+
+        memcpy(&CurrentTable[CurrentModules], &PreviousTable[i], sizeof(MODULE_SYMBOL_DETAIL));
+
+        if (i == 40)
+        {
+            CurrentTable[CurrentModules].BaseAddress += 0x10000000;
+        }
+        else if (i == UserModules + 7)
+        {
+            TestSymbolSyncFillModule(&CurrentTable[CurrentModules], PreviousTable[i].BaseAddress, 1007, 2, FALSE);
+        }
+
+        CurrentModules++;
+    }
+
+    for (UINT32 i = 0; i < 9; i++)
+    {
+        TestSymbolSyncFillModule(&CurrentTable[CurrentModules++], 0x7ffa00000000 + (i * 0x100000), 500 + i, 1, TRUE);
+    }
+
+    //
+    // The previous mechanism sends one packet per module on each reload
+    //
+    LegacyPackets = CurrentModules;
+
+    printf("[*] %-36s : %4u packet(s), %8llu byte(s)\n",
+           "legacy (one packet per module)",
+           LegacyPackets,
+           (UINT64)LegacyPackets * (sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE)));
+
+    //
+    // Initial connection (the debugger does not have a table)
+    //
+    if (!TestSymbolSyncPerformSync("initial full synchronization",
+                                   &Debugger,
+                                   NULL,
+                                   0,
+                                   PreviousTable,
+                                   TotalModules,
+                                   SYMBOL_SYNC_DIGEST_UNKNOWN))
+    {
+        OverallResult = FALSE;
+    }
+
+    if (Debugger.NumberOfPackets >= TotalModules)
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Reload after the module list is changed
+    //
+    if (!TestSymbolSyncPerformSync("incremental synchronization",
+                                   &Debugger,
+                                   PreviousTable,
+                                   TotalModules,
+                                   CurrentTable,
+                                   CurrentModules,
+                                   SymbolSyncComputeDigest(Debugger.SymbolTable, Debugger.NumberOfModules)))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // 6 unloaded + 9 loaded + 2 changed (removed and added) modules fit in one batch
+    //
+    if (Debugger.NumberOfPackets != 1)
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Reload without any change should not send anything
+    //
+    if (!TestSymbolSyncPerformSync("unchanged synchronization",
+                                   &Debugger,
+                                   CurrentTable,
+                                   CurrentModules,
+                                   CurrentTable,
+                                   CurrentModules,
+                                   SymbolSyncComputeDigest(Debugger.SymbolTable, Debugger.NumberOfModules)))
+    {
+        OverallResult = FALSE;
+    }
+
+    if (Debugger.NumberOfPackets != 0)
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // The debugger's table is out of sync (e.g., the debugger is restarted),
+    // the digest does not match so a full synchronization should be performed
+    //
+    Debugger.NumberOfModules = 3;
+
+    if (!TestSymbolSyncPerformSync("mismatched digest (full resync)",
+                                   &Debugger,
+                                   PreviousTable,
+                                   TotalModules,
+                                   CurrentTable,
+                                   CurrentModules,
+                                   SymbolSyncComputeDigest(Debugger.SymbolTable, Debugger.NumberOfModules)))
+    {
+        OverallResult = FALSE;
+    }
+
+    free(PreviousTable);
+    free(CurrentTable);
+    free(Debugger.SymbolTable);
+
+    return OverallResult;
+}
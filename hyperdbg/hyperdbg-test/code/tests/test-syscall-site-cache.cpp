@@ -0,0 +1,491 @@
+/**
+ * @file test-syscall-site-cache.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the cache of the SYSCALL and SYSRET sites
+ * @details Traces of the #UDs (CR3 and RIP) of the EFER syscall hook are
+ * replayed on the cache the same way that the #UD handler uses it. Only the
+ * hits of the sites of the kernel image skip reading the memory of the guest
+ * (the emulated instruction is compared with the actual instruction at the
+ * site), the instruction of other sites is read again on each hit (only the
+ * walk of the page-table is skipped)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Layout of the guest
+ *
+ */
+#define TEST_SYSCALL_SITE_CACHE_NTDLL_BASE        0x00007ffb8c5d0000ull
+#define TEST_SYSCALL_SITE_CACHE_NTDLL_STUBS       0x1000  // Offset of NtAccessCheck
+#define TEST_SYSCALL_SITE_CACHE_STUB_SIZE         0x20
+#define TEST_SYSCALL_SITE_CACHE_STUB_SYSCALL      0x12    // Offset of the SYSCALL in a stub
+#define TEST_SYSCALL_SITE_CACHE_NUMBER_OF_STUBS   470
+#define TEST_SYSCALL_SITE_CACHE_SYSRET            0xfffff80441c2a1c0ull // SYSRET of KiSystemCall64
+#define TEST_SYSCALL_SITE_CACHE_SYSRET_SHADOW     0xfffff80441e1b2f7ull // SYSRET of KiKernelSysretExit
+#define TEST_SYSCALL_SITE_CACHE_KERNEL_IMAGE_BASE 0xfffff80441a00000ull
+#define TEST_SYSCALL_SITE_CACHE_KERNEL_IMAGE_END  0xfffff80442a47000ull
+#define TEST_SYSCALL_SITE_CACHE_KERNEL_PATCH_BASE 0xfffff80442300000ull // Code of the kernel image that is modified by the debugger
+#define TEST_SYSCALL_SITE_CACHE_JIT_BASE          0x000001f3a7c40000ull
+#define TEST_SYSCALL_SITE_CACHE_CR3_BASE          0x1ad000ull
+#define TEST_SYSCALL_SITE_CACHE_SWITCH_PERIOD     40 // Average system-calls between the context switches
+#define TEST_SYSCALL_SITE_CACHE_NUMBER_OF_SYSCALL 200000
+
+/**
+ * @brief A #UD of the trace or a modification of the code
+ *
+ */
+typedef struct _TEST_SYSCALL_SITE_CACHE_RECORD
+{
+    UINT64                  Cr3;
+    UINT64                  Rip;
+    BOOLEAN                 IsWrite;   // The code at the site is changed to the kind
+    SYSCALL_SITE_CACHE_KIND Kind;
+
+} TEST_SYSCALL_SITE_CACHE_RECORD, *PTEST_SYSCALL_SITE_CACHE_RECORD;
+
+/**
+ * @brief Model of the memory of the guest (the instructions at the sites)
+ *
+ */
+typedef struct _TEST_SYSCALL_SITE_CACHE_GUEST
+{
+    std::map<std::pair<UINT64, UINT64>, SYSCALL_SITE_CACHE_KIND> Sites;
+    UINT32                                                       Generation; // g_SyscallSiteCacheGeneration
+    BOOLEAN                                                      IsInvalidatingOnWrite;
+
+} TEST_SYSCALL_SITE_CACHE_GUEST, *PTEST_SYSCALL_SITE_CACHE_GUEST;
+
+/**
+ * @brief Result of replaying a trace
+ *
+ */
+typedef struct _TEST_SYSCALL_SITE_CACHE_RESULT
+{
+    UINT64 NumberOfUds;
+    UINT64 NumberOfHits;
+    UINT64 NumberOfSkippedReads; // Hits of the sites of the kernel image
+    UINT64 NumberOfMemoryReads;  // Each read needs switching to the CR3 of the guest
+    UINT64 NumberOfWrongEmulations;
+
+} TEST_SYSCALL_SITE_CACHE_RESULT, *PTEST_SYSCALL_SITE_CACHE_RESULT;
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT32
+ */
+static UINT32
+TestSyscallSiteCacheRandom(UINT64 * State)
+{
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return (UINT32)(*State >> 16);
+}
+
+/**
+ * @brief Read the instruction at a site from the memory of the guest
+ *
+ * @param Guest
+ * @param Cr3
+ * @param Rip
+ *
+ * @return SYSCALL_SITE_CACHE_KIND
+ */
+static SYSCALL_SITE_CACHE_KIND
+TestSyscallSiteCacheReadSite(PTEST_SYSCALL_SITE_CACHE_GUEST Guest, UINT64 Cr3, UINT64 Rip)
+{
+    auto Site = Guest->Sites.find({Rip & SYSCALL_SITE_CACHE_KERNEL_ADDRESS_MASK ? 0 : Cr3, Rip});
+
+    return Site == Guest->Sites.end() ? SYSCALL_SITE_CACHE_KIND_NONE : Site->second;
+}
+
+/**
+ * @brief Change the instruction at a site in the memory of the guest
+ *
+ * @param Guest
+ * @param Cr3
+ * @param Rip
+ * @param Kind
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallSiteCacheWriteSite(PTEST_SYSCALL_SITE_CACHE_GUEST Guest, UINT64 Cr3, UINT64 Rip, SYSCALL_SITE_CACHE_KIND Kind)
+{
+    Guest->Sites[{Rip & SYSCALL_SITE_CACHE_KERNEL_ADDRESS_MASK ? 0 : Cr3, Rip}] = Kind;
+}
+
+/**
+ * @brief Map ntdll (and the SYSRET of the kernel) in a process
+ *
+ * @param Guest
+ * @param Cr3
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallSiteCacheMapProcess(PTEST_SYSCALL_SITE_CACHE_GUEST Guest, UINT64 Cr3)
+{
+    for (UINT32 i = 0; i < TEST_SYSCALL_SITE_CACHE_NUMBER_OF_STUBS; i++)
+    {
+        Guest->Sites[{Cr3,
+                      TEST_SYSCALL_SITE_CACHE_NTDLL_BASE + TEST_SYSCALL_SITE_CACHE_NTDLL_STUBS +
+                          i * TEST_SYSCALL_SITE_CACHE_STUB_SIZE + TEST_SYSCALL_SITE_CACHE_STUB_SYSCALL}] = SYSCALL_SITE_CACHE_KIND_SYSCALL;
+    }
+
+    Guest->Sites[{0, TEST_SYSCALL_SITE_CACHE_SYSRET}]        = SYSCALL_SITE_CACHE_KIND_SYSRET;
+    Guest->Sites[{0, TEST_SYSCALL_SITE_CACHE_SYSRET_SHADOW}] = SYSCALL_SITE_CACHE_KIND_SYSRET;
+}
+
+/**
+ * @brief Replay a trace on the cache of a core
+ * @details The same steps as SyscallHookHandleUD are taken for each #UD
+ *
+ * @param Cache
+ * @param Guest
+ * @param Trace
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallSiteCacheReplay(PSYSCALL_SITE_CACHE                                 Cache,
+                           PTEST_SYSCALL_SITE_CACHE_GUEST                      Guest,
+                           const std::vector<TEST_SYSCALL_SITE_CACHE_RECORD> & Trace,
+                           PTEST_SYSCALL_SITE_CACHE_RESULT                     Result)
+{
+    SYSCALL_SITE_CACHE_KIND Kind;
+    SYSCALL_SITE_CACHE_KIND ActualKind;
+
+    memset(Result, 0, sizeof(TEST_SYSCALL_SITE_CACHE_RESULT));
+
+    for (auto & Record : Trace)
+    {
+        if (Record.IsWrite)
+        {
+            //
+            // The code is modified by the debugger (MemoryMapperWriteMemorySafeWrapper
+            // changes the generation) or by the guest itself
+            //
+            TestSyscallSiteCacheWriteSite(Guest, Record.Cr3, Record.Rip, Record.Kind);
+
+            if (Guest->IsInvalidatingOnWrite)
+            {
+                Guest->Generation++;
+            }
+
+            continue;
+        }
+
+        Result->NumberOfUds++;
+
+        Kind = SyscallSiteCacheLookup(Cache, Record.Cr3, Record.Rip, Guest->Generation);
+
+        if (Kind != SYSCALL_SITE_CACHE_KIND_NONE)
+        {
+            Result->NumberOfHits++;
+        }
+
+        if (Kind != SYSCALL_SITE_CACHE_KIND_NONE &&
+            Record.Rip >= TEST_SYSCALL_SITE_CACHE_KERNEL_IMAGE_BASE &&
+            Record.Rip < TEST_SYSCALL_SITE_CACHE_KERNEL_IMAGE_END)
+        {
+            Result->NumberOfSkippedReads++;
+
+            if (Kind != TestSyscallSiteCacheReadSite(Guest, Record.Cr3, Record.Rip))
+            {
+                Result->NumberOfWrongEmulations++;
+            }
+
+            continue;
+        }
+
+        Result->NumberOfMemoryReads++;
+        ActualKind = TestSyscallSiteCacheReadSite(Guest, Record.Cr3, Record.Rip);
+
+        if (ActualKind != SYSCALL_SITE_CACHE_KIND_NONE && ActualKind != Kind)
+        {
+            SyscallSiteCacheInsert(Cache, Record.Cr3, Record.Rip, ActualKind, Guest->Generation);
+        }
+        else if (ActualKind == SYSCALL_SITE_CACHE_KIND_NONE && Kind != SYSCALL_SITE_CACHE_KIND_NONE)
+        {
+            SyscallSiteCacheFlush(Cache, Guest->Generation);
+        }
+    }
+}
+
+/**
+ * @brief Build a trace of the system-calls of the processes
+ * @details The popularity of the system-calls is skewed (a few of them
+ * like NtWaitForSingleObject, NtReadFile, etc. are most of the calls) and
+ * the core switches between the processes
+ *
+ * @param Guest
+ * @param Trace
+ * @param NumberOfProcesses
+ * @param Seed
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallSiteCacheBuildTrace(PTEST_SYSCALL_SITE_CACHE_GUEST              Guest,
+                               std::vector<TEST_SYSCALL_SITE_CACHE_RECORD> & Trace,
+                               UINT32                                        NumberOfProcesses,
+                               UINT64                                        Seed)
+{
+    UINT64 State = Seed;
+    UINT64 Cr3   = TEST_SYSCALL_SITE_CACHE_CR3_BASE;
+    UINT32 Stub;
+
+    Trace.clear();
+
+    for (UINT32 i = 0; i < NumberOfProcesses; i++)
+    {
+        TestSyscallSiteCacheMapProcess(Guest, TEST_SYSCALL_SITE_CACHE_CR3_BASE + i * 0x5000);
+    }
+
+    for (UINT32 i = 0; i < TEST_SYSCALL_SITE_CACHE_NUMBER_OF_SYSCALL; i++)
+    {
+        if (TestSyscallSiteCacheRandom(&State) % TEST_SYSCALL_SITE_CACHE_SWITCH_PERIOD == 0)
+        {
+            Cr3 = TEST_SYSCALL_SITE_CACHE_CR3_BASE + (TestSyscallSiteCacheRandom(&State) % NumberOfProcesses) * 0x5000;
+        }
+
+        //
+        // The next group of the stubs is twice as large and a third as popular
+        //
+        Stub = TestSyscallSiteCacheRandom(&State) % 4;
+
+        while (Stub < TEST_SYSCALL_SITE_CACHE_NUMBER_OF_STUBS / 2 && TestSyscallSiteCacheRandom(&State) % 3 == 0)
+        {
+            Stub = Stub * 2 + 4 + TestSyscallSiteCacheRandom(&State) % 2;
+        }
+
+        Trace.push_back({Cr3,
+                         TEST_SYSCALL_SITE_CACHE_NTDLL_BASE + TEST_SYSCALL_SITE_CACHE_NTDLL_STUBS +
+                             (Stub % TEST_SYSCALL_SITE_CACHE_NUMBER_OF_STUBS) * TEST_SYSCALL_SITE_CACHE_STUB_SIZE + TEST_SYSCALL_SITE_CACHE_STUB_SYSCALL,
+                         FALSE,
+                         SYSCALL_SITE_CACHE_KIND_NONE});
+
+        Trace.push_back({Cr3,
+                         TestSyscallSiteCacheRandom(&State) % 8 ? TEST_SYSCALL_SITE_CACHE_SYSRET : TEST_SYSCALL_SITE_CACHE_SYSRET_SHADOW,
+                         FALSE,
+                         SYSCALL_SITE_CACHE_KIND_NONE});
+    }
+}
+
+/**
+ * @brief Replay the system-calls of the processes and show the hit rate
+ * @details Half of the #UDs are the SYSRETs of the kernel image, so they
+ * are the only reads that might be skipped
+ *
+ * @param NumberOfProcesses
+ * @param MinimumSkipRate Minimum percent of the #UDs that skip the read
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSyscallSiteCacheProcesses(UINT32 NumberOfProcesses, UINT32 MinimumSkipRate)
+{
+    TEST_SYSCALL_SITE_CACHE_GUEST               Guest;
+    TEST_SYSCALL_SITE_CACHE_RESULT              Result;
+    std::vector<TEST_SYSCALL_SITE_CACHE_RECORD> Trace;
+    static SYSCALL_SITE_CACHE                   Cache;
+    UINT64                                      HitRate;
+    UINT64                                      SkipRate;
+
+    Guest.Generation            = 0;
+    Guest.IsInvalidatingOnWrite = TRUE;
+
+    memset(&Cache, 0, sizeof(SYSCALL_SITE_CACHE));
+
+    TestSyscallSiteCacheBuildTrace(&Guest, Trace, NumberOfProcesses, 0x9e3779b97f4a7c15ull * NumberOfProcesses);
+    TestSyscallSiteCacheReplay(&Cache, &Guest, Trace, &Result);
+
+    HitRate  = Result.NumberOfHits * 1000 / Result.NumberOfUds;
+    SkipRate = Result.NumberOfSkippedReads * 1000 / Result.NumberOfUds;
+
+    printf("[*] %u processes : %llu #UDs, hit rate %llu.%llu%%, skipped reads %llu.%llu%%, %llu memory reads, %llu evictions\n",
+           NumberOfProcesses,
+           Result.NumberOfUds,
+           HitRate / 10,
+           HitRate % 10,
+           SkipRate / 10,
+           SkipRate % 10,
+           Result.NumberOfMemoryReads,
+           Cache.NumberOfEvictions);
+
+    if (Result.NumberOfWrongEmulations != 0)
+    {
+        printf("[-] %llu #UDs are emulated as a wrong instruction\n", Result.NumberOfWrongEmulations);
+        return FALSE;
+    }
+
+    if (SkipRate < MinimumSkipRate * 10)
+    {
+        printf("[-] the skipped reads are less than %u%%\n", MinimumSkipRate);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Replay the system-calls of a code that is modified
+ *
+ * @param BaseAddress The code of the sites (a JIT code or the kernel image)
+ * @param IsInvalidatingOnWrite Whether the code is modified by the debugger
+ * (the generation is changed) or by the guest itself
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallSiteCacheModifiedCode(UINT64 BaseAddress, BOOLEAN IsInvalidatingOnWrite, PTEST_SYSCALL_SITE_CACHE_RESULT Result)
+{
+    TEST_SYSCALL_SITE_CACHE_GUEST               Guest;
+    std::vector<TEST_SYSCALL_SITE_CACHE_RECORD> Trace;
+    SYSCALL_SITE_CACHE                          Cache = {0};
+    UINT64                                      Cr3   = TEST_SYSCALL_SITE_CACHE_CR3_BASE;
+    UINT64                                      Rip;
+
+    Guest.Generation            = 0;
+    Guest.IsInvalidatingOnWrite = IsInvalidatingOnWrite;
+
+    TestSyscallSiteCacheMapProcess(&Guest, Cr3);
+
+    for (UINT32 Round = 0; Round < 64; Round++)
+    {
+        Rip = BaseAddress + Round * 0x40;
+
+        //
+        // The code makes a few system-calls and then the SYSCALL is replaced
+        // with an ud2 (e.g., by 'eb' or by the JIT compiler) which should cause #UD
+        //
+        Trace.push_back({Cr3, Rip, TRUE, SYSCALL_SITE_CACHE_KIND_SYSCALL});
+
+        for (UINT32 i = 0; i < 4; i++)
+        {
+            Trace.push_back({Cr3, Rip, FALSE, SYSCALL_SITE_CACHE_KIND_NONE});
+            Trace.push_back({Cr3, TEST_SYSCALL_SITE_CACHE_SYSRET, FALSE, SYSCALL_SITE_CACHE_KIND_NONE});
+        }
+
+        Trace.push_back({Cr3, Rip, TRUE, SYSCALL_SITE_CACHE_KIND_NONE});
+        Trace.push_back({Cr3, Rip, FALSE, SYSCALL_SITE_CACHE_KIND_NONE});
+    }
+
+    TestSyscallSiteCacheReplay(&Cache, &Guest, Trace, Result);
+}
+
+/**
+ * @brief Test the cache of the SYSCALL and SYSRET sites
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestSyscallSiteCache()
+{
+    TEST_SYSCALL_SITE_CACHE_RESULT Result;
+    SYSCALL_SITE_CACHE             Cache         = {0};
+    BOOLEAN                        OverallResult = TRUE;
+
+    //
+    // A few processes, the hot stubs fit in the cache
+    //
+    if (!TestSyscallSiteCacheProcesses(1, 45) || !TestSyscallSiteCacheProcesses(8, 45))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // Many processes, the cache is thrashed but it's still correct
+    //
+    if (!TestSyscallSiteCacheProcesses(64, 0))
+    {
+        OverallResult = FALSE;
+    }
+
+    //
+    // The code of the kernel image that is modified by the debugger is not
+    // emulated from the cache
+    //
+    TestSyscallSiteCacheModifiedCode(TEST_SYSCALL_SITE_CACHE_KERNEL_PATCH_BASE, TRUE, &Result);
+
+    printf("[*] modified kernel code : %llu #UDs, %llu skipped reads, %llu wrong emulations\n",
+           Result.NumberOfUds,
+           Result.NumberOfSkippedReads,
+           Result.NumberOfWrongEmulations);
+
+    if (Result.NumberOfWrongEmulations != 0 || Result.NumberOfSkippedReads == 0)
+    {
+        printf("[-] the modified code is not invalidated\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Make sure that the trace really needs the invalidation
+    //
+    TestSyscallSiteCacheModifiedCode(TEST_SYSCALL_SITE_CACHE_KERNEL_PATCH_BASE, FALSE, &Result);
+
+    if (Result.NumberOfWrongEmulations == 0)
+    {
+        printf("[-] the modified code is not detected without the invalidation\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // The user-mode code that is modified by the guest itself (without any
+    // invalidation) is read again on each hit, so it's never emulated wrongly
+    //
+    TestSyscallSiteCacheModifiedCode(TEST_SYSCALL_SITE_CACHE_JIT_BASE, FALSE, &Result);
+
+    printf("[*] modified user code : %llu #UDs, %llu hits, %llu memory reads, %llu wrong emulations\n",
+           Result.NumberOfUds,
+           Result.NumberOfHits,
+           Result.NumberOfMemoryReads,
+           Result.NumberOfWrongEmulations);
+
+    if (Result.NumberOfWrongEmulations != 0)
+    {
+        printf("[-] the user-mode code that is modified by the guest is emulated from the cache\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // The key of the user-mode sites is the CR3 without the PCID and the
+    // key of the kernel sites is only the address
+    //
+    SyscallSiteCacheInsert(&Cache, 0x1ad001, TEST_SYSCALL_SITE_CACHE_NTDLL_BASE, SYSCALL_SITE_CACHE_KIND_SYSCALL, 0);
+    SyscallSiteCacheInsert(&Cache, 0x1ad000, TEST_SYSCALL_SITE_CACHE_SYSRET, SYSCALL_SITE_CACHE_KIND_SYSRET, 0);
+
+    if (SyscallSiteCacheLookup(&Cache, 0x1ad002, TEST_SYSCALL_SITE_CACHE_NTDLL_BASE, 0) != SYSCALL_SITE_CACHE_KIND_SYSCALL ||
+        SyscallSiteCacheLookup(&Cache, 0x1b2000, TEST_SYSCALL_SITE_CACHE_NTDLL_BASE, 0) != SYSCALL_SITE_CACHE_KIND_NONE ||
+        SyscallSiteCacheLookup(&Cache, 0x1b2000, TEST_SYSCALL_SITE_CACHE_SYSRET, 0) != SYSCALL_SITE_CACHE_KIND_SYSRET)
+    {
+        printf("[-] wrong key of the sites\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // A site that is read before the generation is changed is not cached
+    //
+    SyscallSiteCacheInsert(&Cache, 0x1ad000, TEST_SYSCALL_SITE_CACHE_JIT_BASE, SYSCALL_SITE_CACHE_KIND_SYSCALL, 1);
+
+    if (SyscallSiteCacheLookup(&Cache, 0x1ad000, TEST_SYSCALL_SITE_CACHE_JIT_BASE, 1) != SYSCALL_SITE_CACHE_KIND_NONE ||
+        SyscallSiteCacheLookup(&Cache, 0x1b2000, TEST_SYSCALL_SITE_CACHE_SYSRET, 1) != SYSCALL_SITE_CACHE_KIND_NONE)
+    {
+        printf("[-] a site is cached from a previous generation\n");
+        OverallResult = FALSE;
+    }
+
+    return OverallResult;
+}
@@ -0,0 +1,351 @@
+/**
+ * @file test-syscall-table.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on resolving the targets of the system-calls from the service table
+ * @details The resolver is tested against dumps of the kernel memory (the
+ * system-call entries, the service descriptor table and the service table)
+ * that are built with the layout of the x64 kernel
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Layout of the dumped kernel image
+ *
+ */
+#define TEST_SYSCALL_TABLE_IMAGE_BASE                 0xfffff80441a00000ull
+#define TEST_SYSCALL_TABLE_IMAGE_SIZE                 0x20000
+#define TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64           0x1000
+#define TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_USER     0x11a0
+#define TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT   0x127a // the lea instructions cross a chunk of the scan
+#define TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW    0x4000
+#define TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR      0x8000
+#define TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR_SHDW 0x8040
+#define TEST_SYSCALL_TABLE_KI_SERVICE_TABLE           0xc000
+#define TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES         0x1d7
+
+/**
+ * @brief The dumped memory of the kernel
+ *
+ */
+typedef struct _TEST_SYSCALL_TABLE_DUMP
+{
+    UINT64               Base;
+    std::vector<BYTE>    Image;
+    std::vector<UINT64>  Targets;   // Expected targets of the services
+    std::vector<UINT32>  Arguments; // Expected number of the stack arguments
+    UINT64               State;
+
+} TEST_SYSCALL_TABLE_DUMP, *PTEST_SYSCALL_TABLE_DUMP;
+
+/**
+ * @brief Deterministic random numbers of the test
+ *
+ * @param State
+ *
+ * @return UINT32
+ */
+static UINT32
+TestSyscallTableRandom(UINT64 * State)
+{
+    *State ^= *State << 13;
+    *State ^= *State >> 7;
+    *State ^= *State << 17;
+
+    return (UINT32)(*State >> 16);
+}
+
+/**
+ * @brief Read callback of the resolver, reads from the dump
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSyscallTableRead(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context)
+{
+    PTEST_SYSCALL_TABLE_DUMP Dump = (PTEST_SYSCALL_TABLE_DUMP)Context;
+
+    if (Address < Dump->Base || Address + Size > Dump->Base + Dump->Image.size())
+    {
+        return FALSE;
+    }
+
+    memcpy(Buffer, &Dump->Image[Address - Dump->Base], Size);
+
+    return TRUE;
+}
+
+/**
+ * @brief Write bytes to the dump
+ *
+ * @param Dump
+ * @param Offset
+ * @param Bytes
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallTableWrite(PTEST_SYSCALL_TABLE_DUMP Dump, UINT32 Offset, std::initializer_list<BYTE> Bytes)
+{
+    std::copy(Bytes.begin(), Bytes.end(), Dump->Image.begin() + Offset);
+}
+
+/**
+ * @brief Write a rel32 displacement to the dump
+ *
+ * @param Dump
+ * @param Offset Offset of the displacement
+ * @param NextInstruction Offset of the next instruction
+ * @param Target Offset of the target
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallTableWriteRel32(PTEST_SYSCALL_TABLE_DUMP Dump, UINT32 Offset, UINT32 NextInstruction, UINT32 Target)
+{
+    INT32 Displacement = (INT32)Target - (INT32)NextInstruction;
+
+    memcpy(&Dump->Image[Offset], &Displacement, sizeof(INT32));
+}
+
+/**
+ * @brief Build the dump of the kernel
+ *
+ * @param Dump
+ * @param Seed
+ * @param NumberOfServices
+ *
+ * @return VOID
+ */
+static VOID
+TestSyscallTableBuildDump(PTEST_SYSCALL_TABLE_DUMP Dump, UINT64 Seed, UINT64 NumberOfServices)
+{
+    SYSCALL_TABLE_DESCRIPTOR Descriptor = {0};
+
+    Dump->Base  = TEST_SYSCALL_TABLE_IMAGE_BASE;
+    Dump->State = Seed;
+    Dump->Image.assign(TEST_SYSCALL_TABLE_IMAGE_SIZE, 0xcc);
+    Dump->Targets.clear();
+    Dump->Arguments.clear();
+
+    //
+    // Code bytes (random, but without the byte of the 'jmp rel32')
+    //
+    for (UINT32 i = 0; i < TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR; i++)
+    {
+        BYTE Value = (BYTE)TestSyscallTableRandom(&Dump->State);
+
+        Dump->Image[i] = Value == 0xe9 ? 0x90 : Value;
+    }
+
+    //
+    // KiSystemCall64 : swapgs; mov gs:[10h], rsp; mov rsp, gs:[1a8h]
+    //
+    TestSyscallTableWrite(Dump, TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64, {0x0f, 0x01, 0xf8, 0x65, 0x48, 0x89, 0x24, 0x25, 0x10, 0x00, 0x00, 0x00, 0x65, 0x48, 0x8b, 0x24, 0x25, 0xa8, 0x01, 0x00, 0x00});
+
+    //
+    // KiSystemServiceRepeat : lea r10, [KeServiceDescriptorTable]; lea r11, [KeServiceDescriptorTableShadow]
+    //
+    TestSyscallTableWrite(Dump, TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT, {0x4c, 0x8d, 0x15});
+    TestSyscallTableWriteRel32(Dump,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT + 3,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT + 7,
+                               TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR);
+    TestSyscallTableWrite(Dump, TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT + 7, {0x4c, 0x8d, 0x1d});
+    TestSyscallTableWriteRel32(Dump,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT + 10,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_REPEAT + 14,
+                               TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR_SHDW);
+
+    //
+    // KiSystemCall64Shadow : swapgs; mov eax, 0e9h (not a jump); ...; jmp KiSystemServiceUser,
+    // the jump to outside of the dump is not readable
+    //
+    TestSyscallTableWrite(Dump, TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW, {0x0f, 0x01, 0xf8, 0xb8, 0xe9, 0x00, 0x00, 0x00});
+    TestSyscallTableWrite(Dump, TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW + 0x40, {0xe9});
+    TestSyscallTableWriteRel32(Dump,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW + 0x41,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW + 0x45,
+                               TEST_SYSCALL_TABLE_IMAGE_SIZE + 0x1000);
+    TestSyscallTableWrite(Dump, TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW + 0x1b0, {0xe9});
+    TestSyscallTableWriteRel32(Dump,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW + 0x1b1,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW + 0x1b5,
+                               TEST_SYSCALL_TABLE_KI_SYSTEM_SERVICE_USER);
+
+    //
+    // KeServiceDescriptorTable
+    //
+    Descriptor.ServiceTableBase = TEST_SYSCALL_TABLE_IMAGE_BASE + TEST_SYSCALL_TABLE_KI_SERVICE_TABLE;
+    Descriptor.NumberOfServices = NumberOfServices;
+    memcpy(&Dump->Image[TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR], &Descriptor, sizeof(Descriptor));
+
+    //
+    // KiServiceTable, the targets are both before and after the table
+    //
+    for (UINT32 i = 0; i < TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES; i++)
+    {
+        INT32  Offset    = (INT32)(TestSyscallTableRandom(&Dump->State) % 0x100000) - 0x80000;
+        UINT32 Arguments = i < 4 ? 0 : TestSyscallTableRandom(&Dump->State) % 14;
+        INT32  Entry     = (INT32)(((UINT32)Offset << 4) | Arguments);
+
+        memcpy(&Dump->Image[TEST_SYSCALL_TABLE_KI_SERVICE_TABLE + i * sizeof(INT32)], &Entry, sizeof(INT32));
+
+        Dump->Targets.push_back(Descriptor.ServiceTableBase + (INT64)Offset);
+        Dump->Arguments.push_back(Arguments);
+    }
+}
+
+/**
+ * @brief Locate the table and resolve all the services of the dump
+ *
+ * @param Dump
+ * @param SyscallEntry
+ * @param Name
+ * @param NumberOfReads
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestSyscallTableResolveAll(PTEST_SYSCALL_TABLE_DUMP Dump, UINT64 SyscallEntry, const char * Name, UINT32 * NumberOfReads)
+{
+    SYSCALL_TABLE Table = {0};
+    UINT64        Target;
+    UINT32        Arguments;
+
+    Table.Read    = TestSyscallTableRead;
+    Table.Context = Dump;
+
+    if (!SyscallTableLocate(&Table, SyscallEntry))
+    {
+        printf("[-] %s : the service table is not located\n", Name);
+        return FALSE;
+    }
+
+    *NumberOfReads = Table.NumberOfReads;
+
+    if (Table.ServiceDescriptorTable != Dump->Base + TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR ||
+        Table.ServiceDescriptorTableShadow != Dump->Base + TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR_SHDW ||
+        Table.ServiceTableBase != Dump->Base + TEST_SYSCALL_TABLE_KI_SERVICE_TABLE ||
+        Table.NumberOfServices != TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES)
+    {
+        printf("[-] %s : wrong service descriptor table (%llx)\n", Name, Table.ServiceDescriptorTable);
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES; i++)
+    {
+        if (!SyscallTableResolveService(&Table, i, &Target, &Arguments) ||
+            Target != Dump->Targets[i] ||
+            Arguments != Dump->Arguments[i])
+        {
+            printf("[-] %s : service %x is resolved to %llx instead of %llx\n", Name, i, Target, Dump->Targets[i]);
+            return FALSE;
+        }
+    }
+
+    //
+    // The win32k services and the numbers after the end of the table
+    // are not resolved
+    //
+    if (SyscallTableResolveService(&Table, TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES, &Target, NULL) ||
+        SyscallTableResolveService(&Table, 0x1000, &Target, NULL) ||
+        SyscallTableResolveService(&Table, 0x1001, &Target, NULL) ||
+        SyscallTableResolveService(&Table, DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS, &Target, NULL))
+    {
+        printf("[-] %s : a service that is not in the table is resolved\n", Name);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test resolving the targets of the system-calls
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestSyscallTable()
+{
+    TEST_SYSCALL_TABLE_DUMP Dump;
+    SYSCALL_TABLE           Table         = {0};
+    BOOLEAN                 OverallResult = TRUE;
+    UINT32                  NumberOfReads = 0;
+    UINT64                  Target;
+
+    for (UINT64 Seed = 1; Seed <= 20; Seed++)
+    {
+        TestSyscallTableBuildDump(&Dump, Seed * 0x9e3779b97f4a7c15ull, TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES);
+
+        //
+        // Without KVA shadowing, IA32_LSTAR is KiSystemCall64
+        //
+        if (!TestSyscallTableResolveAll(&Dump, Dump.Base + TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64, "KiSystemCall64", &NumberOfReads))
+        {
+            OverallResult = FALSE;
+            break;
+        }
+
+        if (Seed == 1)
+        {
+            printf("[*] KiSystemCall64 : %x services are resolved, %u reads to locate the table\n",
+                   TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES,
+                   NumberOfReads);
+        }
+
+        //
+        // With KVA shadowing, IA32_LSTAR is KiSystemCall64Shadow
+        //
+        if (!TestSyscallTableResolveAll(&Dump, Dump.Base + TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64_SHADOW, "KiSystemCall64Shadow", &NumberOfReads))
+        {
+            OverallResult = FALSE;
+            break;
+        }
+
+        if (Seed == 1)
+        {
+            printf("[*] KiSystemCall64Shadow : %x services are resolved, %u reads to locate the table\n",
+                   TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES,
+                   NumberOfReads);
+        }
+    }
+
+    //
+    // A corrupted descriptor is not accepted
+    //
+    TestSyscallTableBuildDump(&Dump, 0x1234, 0x100000);
+
+    Table.Read    = TestSyscallTableRead;
+    Table.Context = &Dump;
+
+    if (SyscallTableLocate(&Table, Dump.Base + TEST_SYSCALL_TABLE_KI_SYSTEM_CALL64) ||
+        SyscallTableResolveService(&Table, 0, &Target, NULL))
+    {
+        printf("[-] a corrupted service descriptor table is accepted\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // An entry that doesn't load the tables is not accepted
+    //
+    TestSyscallTableBuildDump(&Dump, 0x5678, TEST_SYSCALL_TABLE_NUMBER_OF_SERVICES);
+
+    if (SyscallTableLocate(&Table, Dump.Base + TEST_SYSCALL_TABLE_KE_SERVICE_DESCRIPTOR + 0x100) ||
+        SyscallTableLocate(&Table, Dump.Base + TEST_SYSCALL_TABLE_IMAGE_SIZE))
+    {
+        printf("[-] the service table is located from a wrong entry\n");
+        OverallResult = FALSE;
+    }
+
+    return OverallResult;
+}
@@ -0,0 +1,497 @@
+/**
+ * @file test-tsc-offset.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the accounting of the TSC offset
+ * @details Timelines of vm-exits are replayed on simulated cores and the TSC
+ * that the guest sees is checked (hiding the time spent in vmx-root, being
+ * monotonic on each core and across the cores, the skew between the cores,
+ * and the sampled rdtsc/p exits)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The cost of a vm-exit (before the handler reads the TSC)
+ *
+ */
+#define TEST_TSC_OFFSET_VMEXIT_LATENCY 450
+
+/**
+ * @brief The cost of a vm-entry (after the handler reads the TSC)
+ *
+ */
+#define TEST_TSC_OFFSET_VMENTRY_LATENCY 350
+
+/**
+ * @brief The overhead that is configured for the test (under-estimated)
+ *
+ */
+#define TEST_TSC_OFFSET_TRANSITION_OVERHEAD 700
+
+/**
+ * @brief The minimum latency of moving a thread to another core (a context
+ * switch on both of the cores, about 7 microseconds on a 3 GHz processor)
+ *
+ */
+#define TEST_TSC_OFFSET_MIGRATION_LATENCY 20000
+
+/**
+ * @brief The cost of the cpuid handler in vmx-root
+ *
+ */
+#define TEST_TSC_OFFSET_CPUID_HANDLER 1800
+
+/**
+ * @brief The cost of cpuid without the hypervisor
+ *
+ */
+#define TEST_TSC_OFFSET_CPUID_NATIVE 120
+
+/**
+ * @brief A simulated core
+ *
+ */
+typedef struct _TEST_TSC_OFFSET_CORE
+{
+    TSC_OFFSET_STATE State;
+    BOOLEAN          IsOffsettingEnabled;
+    BOOLEAN          IsRdtscExitingSet;
+    UINT64           Offset;
+    UINT64           LastGuestTsc;
+    UINT64           NumberOfRdtscExits;
+    BOOLEAN          HasWentBackward;
+
+} TEST_TSC_OFFSET_CORE, *PTEST_TSC_OFFSET_CORE;
+
+/**
+ * @brief Check that the guest never sees the TSC go backward
+ *
+ * @param Core
+ * @param GuestTsc
+ *
+ * @return UINT64
+ */
+static UINT64
+TestTscOffsetObserve(PTEST_TSC_OFFSET_CORE Core, UINT64 GuestTsc)
+{
+    if (GuestTsc < Core->LastGuestTsc)
+    {
+        Core->HasWentBackward = TRUE;
+    }
+
+    Core->LastGuestTsc = GuestTsc;
+
+    return GuestTsc;
+}
+
+/**
+ * @brief Replay a vm-exit the same way as the vm-exit handler does
+ *
+ * @param Core
+ * @param RealTsc The real TSC (advanced by the vm-exit)
+ * @param HandlerCycles The cycles spent in the handler
+ * @param IsRdtsc Whether the vm-exit is caused by rdtsc
+ *
+ * @return UINT64 The emulated TSC if it's caused by rdtsc
+ */
+static UINT64
+TestTscOffsetVmexit(PTEST_TSC_OFFSET_CORE Core, UINT64 * RealTsc, UINT64 HandlerCycles, BOOLEAN IsRdtsc)
+{
+    UINT64 EmulatedTsc = 0;
+
+    *RealTsc += TEST_TSC_OFFSET_VMEXIT_LATENCY;
+
+    if (Core->IsOffsettingEnabled)
+    {
+        TscOffsetHandleVmexit(&Core->State, *RealTsc);
+    }
+
+    if (IsRdtsc)
+    {
+        Core->NumberOfRdtscExits++;
+
+        if (Core->IsOffsettingEnabled)
+        {
+            TscOffsetHandleRdtscVmexit(&Core->State);
+            EmulatedTsc = TscOffsetGetGuestTsc(&Core->State);
+        }
+        else
+        {
+            EmulatedTsc = *RealTsc;
+        }
+    }
+
+    *RealTsc += HandlerCycles;
+
+    if (Core->IsOffsettingEnabled)
+    {
+        Core->IsRdtscExitingSet = TscOffsetIsRdtscExitingNeeded(&Core->State, *RealTsc);
+        Core->Offset            = TscOffsetHandleVmresume(&Core->State, *RealTsc);
+    }
+
+    *RealTsc += TEST_TSC_OFFSET_VMENTRY_LATENCY;
+
+    return EmulatedTsc;
+}
+
+/**
+ * @brief Execute rdtsc in the guest
+ *
+ * @param Core
+ * @param RealTsc
+ *
+ * @return UINT64
+ */
+static UINT64
+TestTscOffsetGuestRdtsc(PTEST_TSC_OFFSET_CORE Core, UINT64 * RealTsc)
+{
+    if (Core->IsRdtscExitingSet)
+    {
+        return TestTscOffsetObserve(Core, TestTscOffsetVmexit(Core, RealTsc, 200, TRUE));
+    }
+
+    *RealTsc += 25;
+
+    return TestTscOffsetObserve(Core, *RealTsc + Core->Offset);
+}
+
+/**
+ * @brief Initialize a simulated core
+ *
+ * @param Core
+ * @param IsOffsettingEnabled
+ * @param IsRdtscExitingRequested
+ * @param MaximumDeficit
+ * @param SamplingPeriod
+ * @param RealTsc
+ *
+ * @return VOID
+ */
+static VOID
+TestTscOffsetInitializeCore(PTEST_TSC_OFFSET_CORE Core,
+                            BOOLEAN               IsOffsettingEnabled,
+                            BOOLEAN               IsRdtscExitingRequested,
+                            UINT64                MaximumDeficit,
+                            UINT64                SamplingPeriod,
+                            UINT64                RealTsc)
+{
+    memset(Core, 0, sizeof(TEST_TSC_OFFSET_CORE));
+
+    Core->IsOffsettingEnabled = IsOffsettingEnabled;
+    Core->IsRdtscExitingSet   = IsRdtscExitingRequested;
+
+    if (IsOffsettingEnabled)
+    {
+        Core->State.IsRdtscExitingRequested = IsRdtscExitingRequested;
+
+        TscOffsetInitialize(&Core->State,
+                            TEST_TSC_OFFSET_TRANSITION_OVERHEAD,
+                            MaximumDeficit,
+                            SamplingPeriod,
+                            RealTsc);
+    }
+}
+
+/**
+ * @brief Measure 'rdtsc; cpuid; rdtsc' in the guest (the common timing check
+ * against hypervisors)
+ *
+ * @param IsOffsettingEnabled
+ * @param Count Count of the measurements
+ * @param MaximumDelta
+ * @param HasWentBackward
+ *
+ * @return UINT64 The average delta
+ */
+static UINT64
+TestTscOffsetMeasureCpuid(BOOLEAN IsOffsettingEnabled, UINT32 Count, UINT64 * MaximumDelta, BOOLEAN * HasWentBackward)
+{
+    TEST_TSC_OFFSET_CORE Core;
+    UINT64               RealTsc = 0x100000000ull;
+    UINT64               Sum     = 0;
+
+    TestTscOffsetInitializeCore(&Core, IsOffsettingEnabled, FALSE, TSC_OFFSETTING_DEFAULT_MAXIMUM_DEFICIT, 0, RealTsc);
+
+    *MaximumDelta = 0;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        UINT64 Start, End;
+
+        //
+        // Some guest work and unrelated vm-exits between the measurements
+        //
+        RealTsc += 20000 + (i * 7919) % 100000;
+
+        if (i % 3 == 2)
+        {
+            TestTscOffsetVmexit(&Core, &RealTsc, 3000 + (i % 11) * 500, FALSE);
+        }
+
+        Start = TestTscOffsetGuestRdtsc(&Core, &RealTsc);
+        TestTscOffsetVmexit(&Core, &RealTsc, TEST_TSC_OFFSET_CPUID_HANDLER, FALSE);
+        End = TestTscOffsetGuestRdtsc(&Core, &RealTsc);
+
+        Sum += End - Start;
+
+        if (End - Start > *MaximumDelta)
+        {
+            *MaximumDelta = End - Start;
+        }
+    }
+
+    *HasWentBackward = Core.HasWentBackward;
+
+    return Sum / Count;
+}
+
+/**
+ * @brief Replay a timeline on two cores and measure the skew between them
+ * @details One of the cores is mostly idle and the other one has long halts
+ * (e.g., the debuggee is paused), a thread of the guest reads the TSC and is
+ * moved to the other core after each step
+ *
+ * @param MaximumDeficit
+ * @param MaximumSkew
+ * @param HasWentBackward
+ * @param HasWentBackwardAcrossCores
+ *
+ * @return VOID
+ */
+static VOID
+TestTscOffsetReplayTwoCores(UINT64    MaximumDeficit,
+                            UINT64 *  MaximumSkew,
+                            BOOLEAN * HasWentBackward,
+                            BOOLEAN * HasWentBackwardAcrossCores)
+{
+    TEST_TSC_OFFSET_CORE Cores[2];
+    UINT64               RealTsc = 0x200000000ull;
+    UINT64               Seed    = 0x12345678;
+
+    TestTscOffsetInitializeCore(&Cores[0], TRUE, FALSE, MaximumDeficit, 0, RealTsc);
+    TestTscOffsetInitializeCore(&Cores[1], TRUE, FALSE, MaximumDeficit, 0, RealTsc);
+
+    *MaximumSkew                = 0;
+    *HasWentBackwardAcrossCores = FALSE;
+
+    for (UINT32 i = 0; i < 200000; i++)
+    {
+        PTEST_TSC_OFFSET_CORE Core = &Cores[i % 64 == 0 ? 0 : 1];
+        UINT64                HandlerCycles;
+        UINT64                Tsc0, Tsc1;
+
+        Seed = Seed * 6364136223846793005ull + 1442695040888963407ull;
+
+        HandlerCycles = 500 + (Seed >> 33) % 4000;
+
+        if (Core == &Cores[1] && (Seed >> 20) % 1000 == 0)
+        {
+            //
+            // A long halt in vmx-root
+            //
+            HandlerCycles = 50000000;
+        }
+
+        RealTsc += (Seed >> 40) % 30000;
+
+        TestTscOffsetVmexit(Core, &RealTsc, HandlerCycles, FALSE);
+
+        //
+        // Both cores are in the guest here
+        //
+        Tsc0 = TestTscOffsetObserve(&Cores[0], RealTsc + Cores[0].Offset);
+        Tsc1 = TestTscOffsetObserve(&Cores[1], RealTsc + Cores[1].Offset);
+
+        if ((Tsc0 > Tsc1 ? Tsc0 - Tsc1 : Tsc1 - Tsc0) > *MaximumSkew)
+        {
+            *MaximumSkew = Tsc0 > Tsc1 ? Tsc0 - Tsc1 : Tsc1 - Tsc0;
+        }
+
+        //
+        // The thread reads the TSC on one of the cores and then on the other
+        // core (both of the cores stay in the guest during the migration)
+        //
+        if (Tsc1 + TEST_TSC_OFFSET_MIGRATION_LATENCY < Tsc0 || Tsc0 + TEST_TSC_OFFSET_MIGRATION_LATENCY < Tsc1)
+        {
+            *HasWentBackwardAcrossCores = TRUE;
+        }
+    }
+
+    *HasWentBackward = Cores[0].HasWentBackward || Cores[1].HasWentBackward;
+}
+
+/**
+ * @brief Count the rdtsc/p exits of a guest that reads the TSC frequently
+ * while the !tsc events are enabled
+ *
+ * @param SamplingPeriod
+ * @param Duration The cycles that the guest runs
+ * @param HasWentBackward
+ *
+ * @return UINT64
+ */
+static UINT64
+TestTscOffsetCountRdtscExits(UINT64 SamplingPeriod, UINT64 Duration, BOOLEAN * HasWentBackward)
+{
+    TEST_TSC_OFFSET_CORE Core;
+    UINT64               RealTsc = 0x300000000ull;
+    UINT64               End     = RealTsc + Duration;
+    UINT64               NextTimer;
+
+    TestTscOffsetInitializeCore(&Core, TRUE, TRUE, TSC_OFFSETTING_DEFAULT_MAXIMUM_DEFICIT, SamplingPeriod, RealTsc);
+
+    NextTimer = RealTsc + 250000;
+
+    while (RealTsc < End)
+    {
+        RealTsc += 1000;
+
+        TestTscOffsetGuestRdtsc(&Core, &RealTsc);
+
+        //
+        // External interrupts (the rdtsc/p exiting is re-armed on vm-exits)
+        //
+        if (RealTsc >= NextTimer)
+        {
+            TestTscOffsetVmexit(&Core, &RealTsc, 2000, FALSE);
+            NextTimer += 250000;
+        }
+    }
+
+    *HasWentBackward = Core.HasWentBackward;
+
+    return Core.NumberOfRdtscExits;
+}
+
+/**
+ * @brief Test the accounting of the TSC offset
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestTscOffset()
+{
+    BOOLEAN OverallResult = TRUE;
+    BOOLEAN HasWentBackward;
+    BOOLEAN HasWentBackwardAcrossCores;
+    UINT64  Average, Maximum, MaximumSkew, Exits, SampledExits;
+
+    auto Start = std::chrono::high_resolution_clock::now();
+
+    //
+    // The time of cpuid in vmx-root is visible without TSC offsetting
+    //
+    Average = TestTscOffsetMeasureCpuid(FALSE, 20000, &Maximum, &HasWentBackward);
+
+    printf("[*] rdtsc; cpuid; rdtsc without TSC offsetting : average %llu, maximum %llu cycles\n", Average, Maximum);
+
+    if (Average < TEST_TSC_OFFSET_CPUID_HANDLER)
+    {
+        printf("[-] the vm-exit of cpuid is not visible in the baseline\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // With TSC offsetting only the under-estimated part of the transitions
+    // remains (plus the rdtsc itself), as long as the vm-exits fit in the
+    // maximum deficit (a burst of a few checks)
+    //
+    Average = TestTscOffsetMeasureCpuid(TRUE, 4, &Maximum, &HasWentBackward);
+
+    printf("[*] rdtsc; cpuid; rdtsc with TSC offsetting    : average %llu, maximum %llu cycles (native cpuid: %u)\n",
+           Average,
+           Maximum,
+           TEST_TSC_OFFSET_CPUID_NATIVE);
+
+    if (Maximum > 3 * TEST_TSC_OFFSET_CPUID_NATIVE || Average > 2 * TEST_TSC_OFFSET_CPUID_NATIVE)
+    {
+        printf("[-] the time spent in vmx-root is not hidden\n");
+        OverallResult = FALSE;
+    }
+
+    if (HasWentBackward)
+    {
+        printf("[-] the TSC went backward while measuring cpuid\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // Once the maximum deficit is reached, the time of the vm-exits is leaked
+    // but the TSC still doesn't go backward
+    //
+    Average = TestTscOffsetMeasureCpuid(TRUE, 20000, &Maximum, &HasWentBackward);
+
+    printf("[*] rdtsc; cpuid; rdtsc after the maximum deficit : average %llu, maximum %llu cycles\n", Average, Maximum);
+
+    if (HasWentBackward)
+    {
+        printf("[-] the TSC went backward after the maximum deficit is reached\n");
+        OverallResult = FALSE;
+    }
+
+    //
+    // The skew between the cores is bounded by the maximum deficit (even if a
+    // larger one is requested), so a thread that is moved to another core
+    // never sees the TSC go backward
+    //
+    UINT64 MaximumDeficits[] = {TSC_OFFSETTING_DEFAULT_MAXIMUM_DEFICIT, 0x10000000};
+
+    for (auto MaximumDeficit : MaximumDeficits)
+    {
+        TestTscOffsetReplayTwoCores(MaximumDeficit, &MaximumSkew, &HasWentBackward, &HasWentBackwardAcrossCores);
+
+        printf("[*] two cores with long halts : maximum skew %llu cycles (requested maximum deficit: %llx)\n",
+               MaximumSkew,
+               MaximumDeficit);
+
+        if (MaximumSkew > TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT)
+        {
+            printf("[-] the skew between the cores is more than the limit of the maximum deficit\n");
+            OverallResult = FALSE;
+        }
+
+        if (HasWentBackward)
+        {
+            printf("[-] the TSC went backward on one of the cores\n");
+            OverallResult = FALSE;
+        }
+
+        if (HasWentBackwardAcrossCores)
+        {
+            printf("[-] the TSC went backward for a thread that is moved to another core\n");
+            OverallResult = FALSE;
+        }
+    }
+
+    //
+    // Sampling bounds the rdtsc/p exits of the !tsc events
+    //
+    Exits        = TestTscOffsetCountRdtscExits(0, 100000000, &HasWentBackward);
+    SampledExits = TestTscOffsetCountRdtscExits(1000000, 100000000, &HasWentBackward);
+
+    printf("[*] rdtsc every 1000 cycles for 100M cycles : %llu rdtsc exits, %llu with sampling (period: 1M cycles)\n",
+           Exits,
+           SampledExits);
+
+    if (SampledExits > 100000000 / 1000000 + 1 || SampledExits == 0)
+    {
+        printf("[-] the sampled rdtsc exits are not bounded by the sampling period\n");
+        OverallResult = FALSE;
+    }
+
+    if (HasWentBackward)
+    {
+        printf("[-] the TSC went backward while sampling rdtsc exits\n");
+        OverallResult = FALSE;
+    }
+
+    auto Duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - Start);
+
+    printf("[*] the timelines are replayed in %lld ms\n", (long long)Duration.count());
+
+    return OverallResult;
+}
@@ -0,0 +1,544 @@
+/**
+ * @file test-type-layout.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Perform test on the precompiled layouts of the structures
+ * @details A database of a few kernel-like structures is built and the
+ * chained lookups of the members (the same as nt!_EPROCESS.Pcb.X in the
+ * scripts), the missed lookups and the validation of corrupted images are
+ * checked, then the time of the lookups in a large database is compared
+ * with scanning the fields of the structures
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The large database which is used for measuring the lookups
+ *
+ */
+#define TEST_TYPE_LAYOUT_LARGE_TYPES  20000
+#define TEST_TYPE_LAYOUT_LARGE_FIELDS 32
+#define TEST_TYPE_LAYOUT_HASH_LOOKUPS 2000000
+#define TEST_TYPE_LAYOUT_SCAN_LOOKUPS 2000
+
+/**
+ * @brief The fields of the structures of the small database
+ *
+ */
+static const TYPE_LAYOUT_BUILD_FIELD g_TestTypeLayoutListEntryFields[] = {
+    {"Flink", "_LIST_ENTRY", 0x0, 8, 0, 0, TYPE_LAYOUT_FIELD_FLAG_POINTER},
+    {"Blink", "_LIST_ENTRY", 0x8, 8, 0, 0, TYPE_LAYOUT_FIELD_FLAG_POINTER},
+};
+
+static const TYPE_LAYOUT_BUILD_FIELD g_TestTypeLayoutKprocessFields[] = {
+    {"Header", "_DISPATCHER_HEADER", 0x0, 0x18, 0, 0, 0},
+    {"ProfileListHead", "_LIST_ENTRY", 0x18, 0x10, 0, 0, 0},
+    {"DirectoryTableBase", "unsigned __int64", 0x28, 8, 0, 0, 0},
+    {"AutoAlignment", "unsigned long", 0x30, 4, 0, 1, TYPE_LAYOUT_FIELD_FLAG_BITFIELD},
+    {"ActiveGroupsMask", "unsigned long", 0x30, 4, 2, 3, TYPE_LAYOUT_FIELD_FLAG_BITFIELD},
+};
+
+static const TYPE_LAYOUT_BUILD_FIELD g_TestTypeLayoutEprocessFields[] = {
+    {"Pcb", "_KPROCESS", 0x0, 0x438, 0, 0, 0},
+    {"UniqueProcessId", "void", 0x440, 8, 0, 0, TYPE_LAYOUT_FIELD_FLAG_POINTER},
+    {"ActiveProcessLinks", "_LIST_ENTRY", 0x448, 0x10, 0, 0, 0},
+    {"ImageFileName", "unsigned char", 0x5a8, 15, 0, 0, TYPE_LAYOUT_FIELD_FLAG_ARRAY},
+
+    //
+    // Members of the unnamed unions might have the same names
+    //
+    {"Flags", "unsigned long", 0x464, 4, 0, 0, 0},
+    {"Flags", "unsigned long", 0x468, 4, 0, 0, 0},
+};
+
+static const TYPE_LAYOUT_BUILD_FIELD g_TestTypeLayoutDuplicateFields[] = {
+    {"Pcb", "_KPROCESS", 0x10, 0x438, 0, 0, 0},
+};
+
+/**
+ * @brief The structures of the small database, PDBs contain duplicated
+ * structures (one per compiland)
+ *
+ */
+static const TYPE_LAYOUT_BUILD_TYPE g_TestTypeLayoutTypes[] = {
+    {"_LIST_ENTRY", 0x10, g_TestTypeLayoutListEntryFields, RTL_NUMBER_OF(g_TestTypeLayoutListEntryFields)},
+    {"_KPROCESS", 0x438, g_TestTypeLayoutKprocessFields, RTL_NUMBER_OF(g_TestTypeLayoutKprocessFields)},
+    {"_EPROCESS", 0xa40, g_TestTypeLayoutEprocessFields, RTL_NUMBER_OF(g_TestTypeLayoutEprocessFields)},
+    {"_eprocess", 0x20, g_TestTypeLayoutDuplicateFields, RTL_NUMBER_OF(g_TestTypeLayoutDuplicateFields)},
+    {"_LIST_ENTRY", 0x10, g_TestTypeLayoutListEntryFields, RTL_NUMBER_OF(g_TestTypeLayoutListEntryFields)},
+};
+
+/**
+ * @brief Generate a random number
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+static UINT64
+TestTypeLayoutRandom(UINT64 * State)
+{
+    *State = *State * 6364136223846793005ull + 1442695040888963407ull;
+
+    return *State ^ (*State >> 29);
+}
+
+/**
+ * @brief Find the offset of a chain of members (e.g., _EPROCESS.Pcb.DirectoryTableBase)
+ * @details The same as the scripts, the type of each member is used for
+ * finding the next member and the chain stops at the pointers
+ *
+ * @param Database
+ * @param Chain
+ * @param Offset
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestTypeLayoutLookupChain(PTYPE_LAYOUT_DATABASE Database, const CHAR * Chain, UINT32 * Offset)
+{
+    string                   Names(Chain);
+    size_t                   Start = Names.find('.');
+    PTYPE_LAYOUT_TYPE_ENTRY  Type  = TypeLayoutLookupType(Database, Names.substr(0, Start).c_str());
+    PTYPE_LAYOUT_FIELD_ENTRY Field = NULL;
+
+    *Offset = 0;
+
+    while (Start != string::npos)
+    {
+        size_t End = Names.find('.', Start + 1);
+
+        if (Type == NULL || (Field != NULL && (Field->Flags & TYPE_LAYOUT_FIELD_FLAG_POINTER)))
+        {
+            return FALSE;
+        }
+
+        Field = TypeLayoutLookupField(Database, Type, Names.substr(Start + 1, End - Start - 1).c_str());
+
+        if (Field == NULL)
+        {
+            return FALSE;
+        }
+
+        *Offset += Field->Offset;
+        Type  = TypeLayoutLookupType(Database, &Database->StringPool[Field->TypeNameOffset]);
+        Start = End;
+    }
+
+    return Field != NULL;
+}
+
+/**
+ * @brief Test the lookups of the small database
+ *
+ * @param Database
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestTypeLayoutLookups(PTYPE_LAYOUT_DATABASE Database)
+{
+    PTYPE_LAYOUT_TYPE_ENTRY  Type;
+    PTYPE_LAYOUT_FIELD_ENTRY Field;
+    UINT32                   Offset;
+
+    static const struct
+    {
+        const CHAR * Chain;
+        BOOLEAN      Found;
+        UINT32       Offset;
+    } Chains[] = {
+        {"_EPROCESS.Pcb.DirectoryTableBase", TRUE, 0x28},
+        {"_EPROCESS.Pcb.ProfileListHead.Blink", TRUE, 0x20},
+        {"_EPROCESS.ActiveProcessLinks.Blink", TRUE, 0x450},
+        {"_eprocess.pcb.directorytablebase", TRUE, 0x28},
+        {"_EPROCESS.ActiveProcessLinks.Flink.Blink", FALSE, 0},
+        {"_EPROCESS.UniqueProcessId.Pcb", FALSE, 0},
+        {"_EPROCESS.Pcb.Header.Type", FALSE, 0},
+        {"_EPROCESS.Pcb.Flink", FALSE, 0},
+        {"_EPROCESS.Unknown", FALSE, 0},
+        {"_NOT_A_TYPE.Pcb", FALSE, 0},
+        {"_EPROCES.Pcb", FALSE, 0},
+        {"_EPROCESS.Pc", FALSE, 0},
+    };
+
+    if (Database->Header->NumberOfTypes != 3 || Database->Header->NumberOfFields != 13)
+    {
+        printf("[-] the duplicated types are not removed (%u types, %u fields)\n",
+               Database->Header->NumberOfTypes,
+               Database->Header->NumberOfFields);
+        return FALSE;
+    }
+
+    //
+    // The first definition of the duplicated types is kept
+    //
+    Type  = TypeLayoutLookupType(Database, "_EPROCESS");
+    Field = Type != NULL ? TypeLayoutLookupField(Database, Type, "Pcb") : NULL;
+
+    if (Type == NULL || Type->Size != 0xa40 || Field == NULL || Field->Offset != 0)
+    {
+        printf("[-] the first definition of _EPROCESS is not found\n");
+        return FALSE;
+    }
+
+    for (auto & Entry : Chains)
+    {
+        if (TestTypeLayoutLookupChain(Database, Entry.Chain, &Offset) != Entry.Found ||
+            (Entry.Found && Offset != Entry.Offset))
+        {
+            printf("[-] the lookup of %s is not valid (offset: 0x%x)\n", Entry.Chain, Offset);
+            return FALSE;
+        }
+    }
+
+    //
+    // The fields of other structures are not found
+    //
+    if (TypeLayoutLookupField(Database, TypeLayoutLookupType(Database, "_KPROCESS"), "Pcb") != NULL ||
+        TypeLayoutLookupField(Database, TypeLayoutLookupType(Database, "_LIST_ENTRY"), "DirectoryTableBase") != NULL ||
+        TypeLayoutLookupType(Database, "") != NULL ||
+        TypeLayoutLookupType(Database, "unsigned __int64") != NULL)
+    {
+        printf("[-] a missing field is found\n");
+        return FALSE;
+    }
+
+    //
+    // The first one of the duplicated fields is found
+    //
+    Field = TypeLayoutLookupField(Database, Type, "FLAGS");
+
+    if (Field == NULL || Field->Offset != 0x464)
+    {
+        printf("[-] the first one of the duplicated fields is not found\n");
+        return FALSE;
+    }
+
+    //
+    // Bit-fields, pointers and arrays
+    //
+    Type  = TypeLayoutLookupType(Database, "_KPROCESS");
+    Field = TypeLayoutLookupField(Database, Type, "ActiveGroupsMask");
+
+    if (Field == NULL || !(Field->Flags & TYPE_LAYOUT_FIELD_FLAG_BITFIELD) || Field->BitPosition != 2 ||
+        Field->BitLength != 3 || Field->Offset != 0x30)
+    {
+        printf("[-] the bit-field is not valid\n");
+        return FALSE;
+    }
+
+    Type  = TypeLayoutLookupType(Database, "_EPROCESS");
+    Field = TypeLayoutLookupField(Database, Type, "ImageFileName");
+
+    if (Field == NULL || Field->Flags != TYPE_LAYOUT_FIELD_FLAG_ARRAY || Field->Size != 15 ||
+        strcmp(&Database->StringPool[Field->TypeNameOffset], "unsigned char") != 0)
+    {
+        printf("[-] the array is not valid\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the validation of the images
+ *
+ * @param Database
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestTypeLayoutCorruptedImages(PTYPE_LAYOUT_DATABASE Database)
+{
+    vector<BYTE>                 Image(Database->Image, Database->Image + Database->ImageSize);
+    PTYPE_LAYOUT_DATABASE        Mapped;
+    PTYPE_LAYOUT_DATABASE_HEADER Header = (PTYPE_LAYOUT_DATABASE_HEADER)Image.data();
+    UINT32                       Offset;
+
+    //
+    // The copy of a valid image is used without building it again (the
+    // same as loading it from the cache)
+    //
+    Mapped = TypeLayoutMapImage(Image.data(), (UINT32)Image.size());
+
+    if (Mapped == NULL || !TestTypeLayoutLookupChain(Mapped, "_EPROCESS.Pcb.DirectoryTableBase", &Offset) ||
+        Offset != 0x28)
+    {
+        printf("[-] the copy of the image is not valid\n");
+        free(Mapped);
+        return FALSE;
+    }
+
+    //
+    // The images are owned by the vectors, so only the databases are freed
+    //
+    free(Mapped);
+
+    struct
+    {
+        const CHAR * Name;
+        size_t       Position;
+        UINT32       Value;
+        UINT32       Size;
+    } Corruptions[] = {
+        {"magic", FIELD_OFFSET(TYPE_LAYOUT_DATABASE_HEADER, Magic), 0x12345678, (UINT32)Image.size()},
+        {"version", FIELD_OFFSET(TYPE_LAYOUT_DATABASE_HEADER, Version), TYPE_LAYOUT_DATABASE_VERSION + 1, (UINT32)Image.size()},
+        {"number of types", FIELD_OFFSET(TYPE_LAYOUT_DATABASE_HEADER, NumberOfTypes), 4, (UINT32)Image.size()},
+        {"number of buckets", FIELD_OFFSET(TYPE_LAYOUT_DATABASE_HEADER, NumberOfTypeBuckets), 15, (UINT32)Image.size()},
+        {"size", 0, 0, (UINT32)Image.size() - 1},
+        {"header", 0, 0, sizeof(TYPE_LAYOUT_DATABASE_HEADER) - 1},
+        {"type", (size_t)((BYTE *)&Database->Types[1].FirstField - Database->Image), 12, (UINT32)Image.size()},
+        {"field", (size_t)((BYTE *)&Database->Fields[2].NameOffset - Database->Image), Header->StringPoolSize, (UINT32)Image.size()},
+        {"owner", (size_t)((BYTE *)&Database->Fields[2].OwnerType - Database->Image), 3, (UINT32)Image.size()},
+        {"bucket", (size_t)((BYTE *)&Database->FieldBuckets[0] - Database->Image), 14, (UINT32)Image.size()},
+        {"string pool", Image.size() - sizeof(UINT32), 0x41414141, (UINT32)Image.size()},
+    };
+
+    for (auto & Corruption : Corruptions)
+    {
+        vector<BYTE> Corrupted(Image);
+
+        if (Corruption.Size == Image.size())
+        {
+            memcpy(&Corrupted[Corruption.Position], &Corruption.Value, sizeof(UINT32));
+        }
+
+        Mapped = TypeLayoutMapImage(Corrupted.data(), Corruption.Size);
+
+        if (Mapped != NULL)
+        {
+            printf("[-] the image with an invalid %s is accepted\n", Corruption.Name);
+            free(Mapped);
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a field by scanning the types and their fields
+ *
+ * @param Types
+ * @param NumberOfTypes
+ * @param TypeName
+ * @param FieldName
+ *
+ * @return const TYPE_LAYOUT_BUILD_FIELD *
+ */
+static const TYPE_LAYOUT_BUILD_FIELD *
+TestTypeLayoutScan(const TYPE_LAYOUT_BUILD_TYPE * Types, UINT32 NumberOfTypes, const CHAR * TypeName, const CHAR * FieldName)
+{
+    for (UINT32 i = 0; i < NumberOfTypes; i++)
+    {
+        if (_stricmp(Types[i].Name, TypeName) != 0)
+        {
+            continue;
+        }
+
+        for (UINT32 j = 0; j < Types[i].NumberOfFields; j++)
+        {
+            if (_stricmp(Types[i].Fields[j].Name, FieldName) == 0)
+            {
+                return &Types[i].Fields[j];
+            }
+        }
+
+        return NULL;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Measure the lookups of a large database
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestTypeLayoutMeasure()
+{
+    vector<string>                   Names;
+    vector<TYPE_LAYOUT_BUILD_FIELD>  Fields;
+    vector<TYPE_LAYOUT_BUILD_TYPE>   Types;
+    PTYPE_LAYOUT_DATABASE            Database;
+    chrono::steady_clock::time_point Start;
+    double                           ScanTime;
+    double                           HashTime;
+    UINT64                           Seed     = 0x544c44;
+    UINT64                           Checksum = 0;
+    UINT64                           Other    = 0;
+    CHAR                             Name[64];
+
+    //
+    // Names of the types, then the names of the fields
+    //
+    Names.reserve(TEST_TYPE_LAYOUT_LARGE_TYPES + TEST_TYPE_LAYOUT_LARGE_FIELDS);
+
+    for (UINT32 i = 0; i < TEST_TYPE_LAYOUT_LARGE_TYPES; i++)
+    {
+        snprintf(Name, sizeof(Name), "_TEST_STRUCTURE_%u", i);
+        Names.push_back(Name);
+    }
+
+    for (UINT32 i = 0; i < TEST_TYPE_LAYOUT_LARGE_FIELDS; i++)
+    {
+        snprintf(Name, sizeof(Name), "Member%u", i);
+        Names.push_back(Name);
+    }
+
+    Fields.reserve(TEST_TYPE_LAYOUT_LARGE_TYPES * TEST_TYPE_LAYOUT_LARGE_FIELDS);
+
+    for (UINT32 i = 0; i < TEST_TYPE_LAYOUT_LARGE_TYPES; i++)
+    {
+        for (UINT32 j = 0; j < TEST_TYPE_LAYOUT_LARGE_FIELDS; j++)
+        {
+            TYPE_LAYOUT_BUILD_FIELD Field = {0};
+
+            Field.Name     = Names[TEST_TYPE_LAYOUT_LARGE_TYPES + j].c_str();
+            Field.TypeName = Names[(i + j + 1) % TEST_TYPE_LAYOUT_LARGE_TYPES].c_str();
+            Field.Offset   = i + j * 8;
+            Field.Size     = 8;
+
+            Fields.push_back(Field);
+        }
+
+        Types.push_back({Names[i].c_str(), TEST_TYPE_LAYOUT_LARGE_FIELDS * 8, &Fields[i * TEST_TYPE_LAYOUT_LARGE_FIELDS], TEST_TYPE_LAYOUT_LARGE_FIELDS});
+    }
+
+    Database = TypeLayoutBuildDatabase(Types.data(), (UINT32)Types.size(), 0, 0);
+
+    if (Database == NULL || Database->Header->NumberOfFields != Fields.size())
+    {
+        printf("[-] the large database is not built\n");
+        TypeLayoutFreeDatabase(Database);
+        return FALSE;
+    }
+
+    //
+    // Both methods should find the same fields
+    //
+    for (UINT32 i = 0; i < TEST_TYPE_LAYOUT_SCAN_LOOKUPS; i++)
+    {
+        UINT32                   TypeIndex  = (UINT32)(TestTypeLayoutRandom(&Seed) % TEST_TYPE_LAYOUT_LARGE_TYPES);
+        UINT32                   FieldIndex = (UINT32)(TestTypeLayoutRandom(&Seed) % TEST_TYPE_LAYOUT_LARGE_FIELDS);
+        PTYPE_LAYOUT_TYPE_ENTRY  Type       = TypeLayoutLookupType(Database, Names[TypeIndex].c_str());
+        PTYPE_LAYOUT_FIELD_ENTRY Field      = Type != NULL ? TypeLayoutLookupField(Database, Type, Names[TEST_TYPE_LAYOUT_LARGE_TYPES + FieldIndex].c_str()) : NULL;
+        const TYPE_LAYOUT_BUILD_FIELD * Expected =
+            TestTypeLayoutScan(Types.data(), (UINT32)Types.size(), Names[TypeIndex].c_str(), Names[TEST_TYPE_LAYOUT_LARGE_TYPES + FieldIndex].c_str());
+
+        if (Field == NULL || Expected == NULL || Field->Offset != Expected->Offset ||
+            strcmp(&Database->StringPool[Field->TypeNameOffset], Expected->TypeName) != 0)
+        {
+            printf("[-] the field %u of the type %u is not valid\n", FieldIndex, TypeIndex);
+            TypeLayoutFreeDatabase(Database);
+            return FALSE;
+        }
+    }
+
+    //
+    // Measure the lookups of the members of random types
+    //
+    Start = chrono::steady_clock::now();
+
+    for (UINT32 i = 0; i < TEST_TYPE_LAYOUT_SCAN_LOOKUPS; i++)
+    {
+        const TYPE_LAYOUT_BUILD_FIELD * Field = TestTypeLayoutScan(Types.data(),
+                                                                   (UINT32)Types.size(),
+                                                                   Names[TestTypeLayoutRandom(&Seed) % TEST_TYPE_LAYOUT_LARGE_TYPES].c_str(),
+                                                                   Names[TEST_TYPE_LAYOUT_LARGE_TYPES + TestTypeLayoutRandom(&Seed) % TEST_TYPE_LAYOUT_LARGE_FIELDS].c_str());
+        Checksum += Field->Offset;
+    }
+
+    ScanTime = chrono::duration<double, nano>(chrono::steady_clock::now() - Start).count() / TEST_TYPE_LAYOUT_SCAN_LOOKUPS;
+
+    Start = chrono::steady_clock::now();
+
+    for (UINT32 i = 0; i < TEST_TYPE_LAYOUT_HASH_LOOKUPS; i++)
+    {
+        PTYPE_LAYOUT_TYPE_ENTRY Type = TypeLayoutLookupType(Database, Names[TestTypeLayoutRandom(&Seed) % TEST_TYPE_LAYOUT_LARGE_TYPES].c_str());
+
+        Other += TypeLayoutLookupField(Database, Type, Names[TEST_TYPE_LAYOUT_LARGE_TYPES + TestTypeLayoutRandom(&Seed) % TEST_TYPE_LAYOUT_LARGE_FIELDS].c_str())->Offset;
+    }
+
+    HashTime = chrono::duration<double, nano>(chrono::steady_clock::now() - Start).count() / TEST_TYPE_LAYOUT_HASH_LOOKUPS;
+
+    printf("[*] %u types, %u fields (image 0x%x bytes) : scan %10.1f ns per member, database %5.1f ns per member (checksum 0x%llx)\n",
+           Database->Header->NumberOfTypes,
+           Database->Header->NumberOfFields,
+           Database->ImageSize,
+           ScanTime,
+           HashTime,
+           Checksum ^ Other);
+
+    TypeLayoutFreeDatabase(Database);
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the precompiled layouts of the structures
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestTypeLayout()
+{
+    PTYPE_LAYOUT_DATABASE Database;
+    BOOLEAN               Result;
+
+    printf("[*] testing the lookups of the members\n");
+
+    Database = TypeLayoutBuildDatabase(g_TestTypeLayoutTypes, RTL_NUMBER_OF(g_TestTypeLayoutTypes), 0x1000, 0x2000);
+
+    if (Database == NULL)
+    {
+        printf("[-] the database is not built\n");
+        return FALSE;
+    }
+
+    if (Database->Header->PdbFileSize != 0x1000 || Database->Header->PdbLastWriteTime != 0x2000)
+    {
+        printf("[-] the stamp of the PDB file is not saved\n");
+        TypeLayoutFreeDatabase(Database);
+        return FALSE;
+    }
+
+    Result = TestTypeLayoutLookups(Database);
+
+    if (Result)
+    {
+        printf("[*] testing the validation of the images\n");
+
+        Result = TestTypeLayoutCorruptedImages(Database);
+    }
+
+    TypeLayoutFreeDatabase(Database);
+
+    if (!Result)
+    {
+        return FALSE;
+    }
+
+    //
+    // An empty module (no structures) has a valid database too
+    //
+    Database = TypeLayoutBuildDatabase(NULL, 0, 0, 0);
+
+    if (Database == NULL || TypeLayoutLookupType(Database, "_EPROCESS") != NULL)
+    {
+        printf("[-] the empty database is not valid\n");
+        TypeLayoutFreeDatabase(Database);
+        return FALSE;
+    }
+
+    TypeLayoutFreeDatabase(Database);
+
+    printf("[*] measuring the lookups of the members\n");
+
+    return TestTypeLayoutMeasure();
+}
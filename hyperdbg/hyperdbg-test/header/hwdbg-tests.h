@@ -17,3 +17,6 @@
 
 BOOLEAN
 HwdbgTestCreateTestCases();
+
+BOOLEAN
+HwdbgTestBitPackedScriptBuffer();
@@ -18,5 +18,77 @@
 BOOLEAN
 TestCommandParser();
 
+BOOLEAN
+TestCommandParserBenchmark();
+
 BOOLEAN
 TestSemanticScripts();
+
+BOOLEAN
+TestSymbolSynchronization();
+
+BOOLEAN
+TestEventTrace();
+
+BOOLEAN
+TestStepTrace();
+
+BOOLEAN
+TestBulkRead();
+
+BOOLEAN
+TestPciIdIndex();
+
+BOOLEAN
+TestPciWalk();
+
+BOOLEAN
+TestKdCache();
+
+BOOLEAN
+TestTscOffset();
+
+BOOLEAN
+TestSyscallTable();
+
+BOOLEAN
+TestSyscallSiteCache();
+
+BOOLEAN
+TestEventSampling();
+
+BOOLEAN
+TestScriptFilter();
+
+BOOLEAN
+TestSubPagePermission();
+
+BOOLEAN
+TestMemoryAccessEmulator();
+
+BOOLEAN
+TestEptpView();
+
+BOOLEAN
+TestSharedEpt();
+
+BOOLEAN
+TestMtrrMap();
+
+BOOLEAN
+TestHookBatch();
+
+BOOLEAN
+TestDetourHash();
+
+BOOLEAN
+TestSampleProfile();
+
+BOOLEAN
+TestPtDecode();
+
+BOOLEAN
+TestLbrDecode();
+
+BOOLEAN
+TestTypeLayout();
@@ -34,6 +34,12 @@ using namespace std;
 #include <iomanip>
 #include <fstream>
 #include <filesystem>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <map>
+#include <unordered_map>
+#include <set>
 
 //
 // Program Defined Headers
@@ -44,6 +50,46 @@ using namespace std;
 #include "../hyperdbg-test/header/routines.h"
 #include "../hyperdbg-test/header/testcases.h"
 
+//
+// Components
+//
+#include "components/symbol-sync/header/SymbolSync.h"
+#include "components/hwdbg-script-packing/header/HwdbgScriptPacking.h"
+#include "components/event-trace/header/EventTraceRecorder.h"
+#include "components/step-trace/header/StepTraceEncoder.h"
+#include "components/bulk-read/header/BulkRead.h"
+#include "components/pci-id-index/header/PciIdIndex.h"
+#include "components/pci-walk/header/PciWalk.h"
+#include "components/kd-cache/header/KdCache.h"
+#include "components/tsc-offset/header/TscOffset.h"
+#include "components/syscall-table/header/SyscallTable.h"
+#include "components/syscall-site-cache/header/SyscallSiteCache.h"
+#include "components/event-sampling/header/EventSampling.h"
+#include "components/sub-page-permission/header/SubPagePermission.h"
+#include "components/memory-access-emulator/header/MemoryAccessEmulator.h"
+#include "components/eptp-view/header/EptpView.h"
+#include "components/shared-ept/header/SharedEpt.h"
+#include "components/mtrr-map/header/MtrrMap.h"
+#include "components/hook-batch/header/HookBatch.h"
+#include "components/detour-hash/header/DetourHash.h"
+#include "components/sample-profile/header/SampleProfile.h"
+#include "components/script-filter/header/ScriptFilter.h"
+
+//
+// Decoder of the packets of Intel Processor Trace
+//
+#include "components/pt-decode/header/PtDecode.h"
+
+//
+// Layouts and formats of the Last Branch Records
+//
+#include "components/lbr-decode/header/LbrDecode.h"
+
+//
+// Precompiled layouts of the structures (used by the symbol parser)
+//
+#include "components/type-layout/header/TypeLayout.h"
+
 //
 // Hardware Debugger Headers
 //
@@ -536,3 +536,122 @@ BroadcastDisablePmlOnAllProcessors()
 {
     KeGenericCallDpc(DpcRoutineDisablePml, 0x0);
 }
+
+/**
+ * @brief routines for enabling TSC offsetting on all cores
+ *
+ * @param TscOffsettingRequest
+ *
+ * @return VOID
+ */
+VOID
+BroadcastEnableTscOffsettingAllCores(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest)
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineEnableTscOffsettingAllCores, (PVOID)TscOffsettingRequest);
+}
+
+/**
+ * @brief routines for disabling TSC offsetting on all cores
+ *
+ * @return VOID
+ */
+VOID
+BroadcastDisableTscOffsettingAllCores()
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineDisableTscOffsettingAllCores, NULL);
+}
+
+/**
+ * @brief routines for enabling the sampling profiler on all cores
+ * @details Only the cores that have a histogram are sampled
+ *
+ * @param ProfilerRequest
+ *
+ * @return VOID
+ */
+VOID
+BroadcastEnableProfilerAllCores(PPROFILER_OPERATION_PACKETS ProfilerRequest)
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineEnableProfilerAllCores, (PVOID)ProfilerRequest);
+}
+
+/**
+ * @brief routines for disabling the sampling profiler on all cores
+ *
+ * @return VOID
+ */
+VOID
+BroadcastDisableProfilerAllCores()
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineDisableProfilerAllCores, NULL);
+}
+
+/**
+ * @brief routines for enabling Intel Processor Trace on all cores
+ * @details Only the cores that have an output buffer are traced
+ *
+ * @return VOID
+ */
+VOID
+BroadcastEnableProcessorTraceAllCores()
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineEnableProcessorTraceAllCores, NULL);
+}
+
+/**
+ * @brief routines for disabling Intel Processor Trace on all cores
+ *
+ * @return VOID
+ */
+VOID
+BroadcastDisableProcessorTraceAllCores()
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineDisableProcessorTraceAllCores, NULL);
+}
+
+/**
+ * @brief routines for enabling the Last Branch Records on all cores
+ * @details Only the configured cores record the branches
+ *
+ * @return VOID
+ */
+VOID
+BroadcastEnableLbrAllCores()
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineEnableLbrAllCores, NULL);
+}
+
+/**
+ * @brief routines for disabling the Last Branch Records on all cores
+ *
+ * @return VOID
+ */
+VOID
+BroadcastDisableLbrAllCores()
+{
+    //
+    // Broadcast to all cores
+    //
+    KeGenericCallDpc(DpcRoutineDisableLbrAllCores, NULL);
+}
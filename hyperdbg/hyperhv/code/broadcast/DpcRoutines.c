@@ -1658,6 +1658,36 @@ DpcRoutineRemoveHookAndInvalidateSingleEntryOnAllCores(KDPC * Dpc, PVOID Deferre
     KeSignalCallDpcDone(SystemArgument1);
 }
 
+/**
+ * @brief Remove the hooked pages of a batch and invalidate TLB once on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext The details of the removed pages
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineRemoveHooksBatchAndInvalidateOnAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+
+    //
+    // Execute the VMCALL to remove the hooks and invalidate
+    //
+    AsmVmxVmcall(VMCALL_UNHOOK_PAGES_BATCH, (UINT64)DeferredContext, NULL64_ZERO, NULL64_ZERO);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
 /**
  * @brief The broadcast function which invalidate EPT using Vmcall
  *
@@ -1765,3 +1795,259 @@ DpcRoutineTerminateGuest(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument
     //
     KeSignalCallDpcDone(SystemArgument1);
 }
+
+/**
+ * @brief Enables TSC offsetting on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext The options of TSC offsetting (TSC_OFFSETTING_OPERATION_PACKETS)
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineEnableTscOffsettingAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest = (PTSC_OFFSETTING_OPERATION_PACKETS)DeferredContext;
+
+    UNREFERENCED_PARAMETER(Dpc);
+
+    //
+    // Enables TSC offsetting on the current core
+    //
+    AsmVmxVmcall(VMCALL_SET_TSC_OFFSETTING,
+                 TscOffsettingRequest->TransitionOverhead,
+                 TscOffsettingRequest->MaximumDeficit,
+                 TscOffsettingRequest->SamplingPeriod);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Disables TSC offsetting on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineDisableTscOffsettingAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+
+    //
+    // Disables TSC offsetting on the current core
+    //
+    AsmVmxVmcall(VMCALL_UNSET_TSC_OFFSETTING, 0, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Enables the sampling profiler on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext The options of the profiler (PROFILER_OPERATION_PACKETS)
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineEnableProfilerAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    PPROFILER_OPERATION_PACKETS ProfilerRequest = (PPROFILER_OPERATION_PACKETS)DeferredContext;
+
+    UNREFERENCED_PARAMETER(Dpc);
+
+    //
+    // Enables the profiler on the current core (if it has a histogram)
+    //
+    AsmVmxVmcall(VMCALL_ENABLE_PROFILER,
+                 ProfilerRequest->Period,
+                 ProfilerRequest->StackDepth,
+                 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Disables the sampling profiler on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineDisableProfilerAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+
+    //
+    // Disables the profiler on the current core
+    //
+    AsmVmxVmcall(VMCALL_DISABLE_PROFILER, 0, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Enables Intel Processor Trace on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineEnableProcessorTraceAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+
+    //
+    // Enables the tracing on the current core (if it has an output buffer)
+    //
+    AsmVmxVmcall(VMCALL_ENABLE_PROCESSOR_TRACE, 0, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Disables Intel Processor Trace on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineDisableProcessorTraceAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+
+    //
+    // Disables the tracing on the current core
+    //
+    AsmVmxVmcall(VMCALL_DISABLE_PROCESSOR_TRACE, 0, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Enables the Last Branch Records on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineEnableLbrAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+
+    //
+    // Enables the recording on the current core (if it's configured)
+    //
+    AsmVmxVmcall(VMCALL_ENABLE_LBR, 0, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
+
+/**
+ * @brief Disables the Last Branch Records on all cores
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ * @return VOID
+ */
+VOID
+DpcRoutineDisableLbrAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+
+    //
+    // Disables the recording on the current core
+    //
+    AsmVmxVmcall(VMCALL_DISABLE_LBR, 0, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
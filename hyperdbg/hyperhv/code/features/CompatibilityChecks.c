@@ -174,6 +174,237 @@ CompatibilityCheckPml()
     }
 }
 
+/**
+ * @brief Check for sub-page write permissions (SPP) support
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompatibilityCheckSpp()
+{
+    //
+    // The SPP table pointer field exists only on processors that support the 1-setting of
+    // the "sub-page write permissions for EPT" VM-execution control
+    //
+    UINT32 SecondaryProcBasedVmExecControls = HvAdjustControls(SPP_PROCBASED_CTLS2_FLAG, IA32_VMX_PROCBASED_CTLS2);
+
+    if (SecondaryProcBasedVmExecControls & SPP_PROCBASED_CTLS2_FLAG)
+    {
+        //
+        // The processor support SPP
+        //
+        return TRUE;
+    }
+    else
+    {
+        //
+        // Not supported
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Check for EPTP switching (VMFUNC 0) support
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompatibilityCheckEptpSwitching()
+{
+    //
+    // The IA32_VMX_VMFUNC MSR exists only on processors that support the 1-setting of
+    // the "enable VM functions" VM-execution control
+    //
+    UINT32 SecondaryProcBasedVmExecControls = HvAdjustControls(EPTP_SWITCHING_PROCBASED_CTLS2_FLAG, IA32_VMX_PROCBASED_CTLS2);
+
+    if ((SecondaryProcBasedVmExecControls & EPTP_SWITCHING_PROCBASED_CTLS2_FLAG) &&
+        (__readmsr(EPTP_SWITCHING_MSR_IA32_VMX_VMFUNC) & 1))
+    {
+        //
+        // The processor support EPTP switching
+        //
+        return TRUE;
+    }
+    else
+    {
+        //
+        // Not supported
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Check for the VMX-preemption timer support
+ * @details The timer should also be saved on vm-exits, otherwise it starts
+ * again from its full value after each vm-exit
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompatibilityCheckVmxPreemptionTimer()
+{
+    IA32_VMX_BASIC_REGISTER VmxBasicMsr = {0};
+    UINT32                  PinBasedControls;
+    UINT32                  VmExitControls;
+
+    VmxBasicMsr.AsUInt = __readmsr(IA32_VMX_BASIC);
+
+    PinBasedControls = HvAdjustControls(IA32_VMX_PINBASED_CTLS_ACTIVATE_VMX_PREEMPTION_TIMER_FLAG,
+                                        VmxBasicMsr.VmxControls ? IA32_VMX_TRUE_PINBASED_CTLS : IA32_VMX_PINBASED_CTLS);
+
+    VmExitControls = HvAdjustControls(IA32_VMX_EXIT_CTLS_SAVE_VMX_PREEMPTION_TIMER_VALUE_FLAG,
+                                      VmxBasicMsr.VmxControls ? IA32_VMX_TRUE_EXIT_CTLS : IA32_VMX_EXIT_CTLS);
+
+    if ((PinBasedControls & IA32_VMX_PINBASED_CTLS_ACTIVATE_VMX_PREEMPTION_TIMER_FLAG) &&
+        (VmExitControls & IA32_VMX_EXIT_CTLS_SAVE_VMX_PREEMPTION_TIMER_VALUE_FLAG))
+    {
+        //
+        // The processor support the VMX-preemption timer
+        //
+        return TRUE;
+    }
+    else
+    {
+        //
+        // Not supported
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Check for Intel Processor Trace support
+ * @details The output should be ToPA, the tracing should be allowed in VMX
+ * operation, and IA32_RTIT_CTL should be loaded and cleared by the VMCS (so
+ * the vmx-root is not traced)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompatibilityCheckProcessorTrace()
+{
+    IA32_VMX_BASIC_REGISTER VmxBasicMsr = {0};
+    INT32                   Regs[4];
+    UINT32                  VmentryControls;
+    UINT32                  VmExitControls;
+
+    CommonCpuidInstruction(7, 0, Regs);
+
+    if ((Regs[1] & (1 << 25)) == 0) // CpuInfo[1] is EBX
+    {
+        return FALSE;
+    }
+
+    CommonCpuidInstruction(PROCESSOR_TRACE_CPUID_LEAF, 0, Regs);
+
+    if ((Regs[2] & 1) == 0 || (__readmsr(IA32_VMX_MISC) & PROCESSOR_TRACE_VMX_MISC_USE_IN_VMX_OPERATION) == 0)
+    {
+        return FALSE;
+    }
+
+    VmxBasicMsr.AsUInt = __readmsr(IA32_VMX_BASIC);
+
+    VmentryControls = HvAdjustControls(PROCESSOR_TRACE_ENTRY_CTLS_LOAD_RTIT_CTL_FLAG,
+                                       VmxBasicMsr.VmxControls ? IA32_VMX_TRUE_ENTRY_CTLS : IA32_VMX_ENTRY_CTLS);
+
+    VmExitControls = HvAdjustControls(PROCESSOR_TRACE_EXIT_CTLS_CLEAR_RTIT_CTL_FLAG,
+                                      VmxBasicMsr.VmxControls ? IA32_VMX_TRUE_EXIT_CTLS : IA32_VMX_EXIT_CTLS);
+
+    if ((VmentryControls & PROCESSOR_TRACE_ENTRY_CTLS_LOAD_RTIT_CTL_FLAG) &&
+        (VmExitControls & PROCESSOR_TRACE_EXIT_CTLS_CLEAR_RTIT_CTL_FLAG))
+    {
+        //
+        // The processor support Intel Processor Trace in VMX operation
+        //
+        return TRUE;
+    }
+    else
+    {
+        //
+        // Not supported
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Check for the Last Branch Records support
+ * @details The model should be known (the MSRs of the legacy LBRs are
+ * model-specific), and IA32_DEBUGCTL should be loaded and saved by the VMCS
+ *
+ * @param Layout The MSRs and the format of the records
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CompatibilityCheckLbr(PLBR_DECODE_LAYOUT Layout)
+{
+    IA32_VMX_BASIC_REGISTER VmxBasicMsr = {0};
+    INT32                   Regs[4];
+    UINT32                  Family;
+    UINT32                  Model;
+    UINT64                  PerfCapabilities = 0;
+    UINT32                  VmentryControls;
+    UINT32                  VmExitControls;
+
+    CommonCpuidInstruction(1, 0, Regs);
+
+    //
+    // The display family and model (CpuInfo[0] is EAX)
+    //
+    Family = (Regs[0] >> 8) & 0xf;
+    Model  = (Regs[0] >> 4) & 0xf;
+
+    if (Family == 0x6 || Family == 0xf)
+    {
+        Model |= ((Regs[0] >> 16) & 0xf) << 4;
+    }
+
+    if (Family == 0xf)
+    {
+        Family += (Regs[0] >> 20) & 0xff;
+    }
+
+    //
+    // IA32_PERF_CAPABILITIES is available if PDCM is set (CpuInfo[2] is ECX)
+    //
+    if (Regs[2] & (1 << 15))
+    {
+        PerfCapabilities = __readmsr(LBR_DECODE_MSR_IA32_PERF_CAPABILITIES);
+    }
+
+    if (!LbrDecodeGetLayout(Family, Model, PerfCapabilities, Layout))
+    {
+        return FALSE;
+    }
+
+    VmxBasicMsr.AsUInt = __readmsr(IA32_VMX_BASIC);
+
+    VmentryControls = HvAdjustControls(IA32_VMX_ENTRY_CTLS_LOAD_DEBUG_CONTROLS_FLAG,
+                                       VmxBasicMsr.VmxControls ? IA32_VMX_TRUE_ENTRY_CTLS : IA32_VMX_ENTRY_CTLS);
+
+    VmExitControls = HvAdjustControls(IA32_VMX_EXIT_CTLS_SAVE_DEBUG_CONTROLS_FLAG,
+                                      VmxBasicMsr.VmxControls ? IA32_VMX_TRUE_EXIT_CTLS : IA32_VMX_EXIT_CTLS);
+
+    if ((VmentryControls & IA32_VMX_ENTRY_CTLS_LOAD_DEBUG_CONTROLS_FLAG) &&
+        (VmExitControls & IA32_VMX_EXIT_CTLS_SAVE_DEBUG_CONTROLS_FLAG))
+    {
+        //
+        // The processor support the Last Branch Records
+        //
+        return TRUE;
+    }
+    else
+    {
+        //
+        // Not supported
+        //
+        return FALSE;
+    }
+}
+
 /**
  * @brief Checks for the compatibility features based on current processor
  * @detail NOTE: NOT ALL OF THE CHECKS ARE PERFORMED HERE
@@ -217,10 +448,37 @@ CompatibilityCheckPerformChecks()
     //
     g_CompatibilityCheck.PmlSupport = CompatibilityCheckPml();
 
+    //
+    // Check SPP support
+    //
+    g_CompatibilityCheck.SppSupport = CompatibilityCheckSpp();
+
+    //
+    // Check EPTP switching support
+    //
+    g_CompatibilityCheck.EptpSwitchingSupport = CompatibilityCheckEptpSwitching();
+
+    //
+    // Check VMX-preemption timer support
+    //
+    g_CompatibilityCheck.VmxPreemptionTimerSupport = CompatibilityCheckVmxPreemptionTimer();
+
+    //
+    // Check Intel Processor Trace support
+    //
+    g_CompatibilityCheck.ProcessorTraceSupport = CompatibilityCheckProcessorTrace();
+
+    //
+    // Check the Last Branch Records support
+    //
+    g_CompatibilityCheck.LbrSupport = CompatibilityCheckLbr(&g_LbrLayout);
+
     //
     // Log for testing
     //
-    LogDebugInfo("Mode based execution: %s | PML: %s",
+    LogDebugInfo("Mode based execution: %s | PML: %s | SPP: %s | EPTP switching: %s",
                  g_CompatibilityCheck.ModeBasedExecutionSupport ? "true" : "false",
-                 g_CompatibilityCheck.PmlSupport ? "true" : "false");
+                 g_CompatibilityCheck.PmlSupport ? "true" : "false",
+                 g_CompatibilityCheck.SppSupport ? "true" : "false",
+                 g_CompatibilityCheck.EptpSwitchingSupport ? "true" : "false");
 }
@@ -260,7 +260,10 @@ DirtyLoggingFlushPmlBuffer(VIRTUAL_MACHINE_STATE * VCpu)
 
         AccessedPhysAddr = PmlBuf[PmlIdx];
 
-        PmlEntry = EptGetPml1OrPml2Entry(VCpu->EptPageTable, AccessedPhysAddr, &IsLargePage);
+        //
+        // The dirty flag is cleared on the entry that is used by the core (it might be shared)
+        //
+        PmlEntry = EptGetPml1OrPml2EntryWithoutPrivatizing(VCpu->EptPageTable, AccessedPhysAddr, &IsLargePage);
 
         if (PmlEntry == NULL)
         {
@@ -0,0 +1,339 @@
+/**
+ * @file EptpSwitching.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Switching the EPTP views of the hidden hooks
+ * @details The hooked pages of the hidden hooks are execute-only, so each
+ * read of a hooked page (e.g., by an integrity check) restores the original
+ * entry, invalidates the EPT and steps the instruction with MTF. If the views
+ * are used, the read of a hooked page switches the EPTP of the core to the
+ * read view (where the hooked pages are readable but not executable), and
+ * the core stays on the read view until it executes a hooked page again
+ *
+ * The views are switched by the hypervisor in the vm-exit of the EPT
+ * violation, the EPTP list is also configured (if the processor supports
+ * the EPTP switching of VMFUNC) so the guest can switch the views by VMFUNC
+ * without any vm-exit
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate the EPTP list and the tables of the read view of the cores
+ * @details should be called after the EPT of the cores are initialized and
+ * before the VMCS of the cores are configured
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptpSwitchingInitialize()
+{
+#if UseEptpViewsForHiddenHooks == TRUE
+
+    ULONG                   ProcessorsCount;
+    VIRTUAL_MACHINE_STATE * VCpu;
+    UINT8 *                 Pages;
+    UINT64                  PhysicalAddress;
+
+    ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        VCpu = &g_GuestState[i];
+
+        //
+        // The first page is the EPTP list and the rest of the pages are the
+        // tables of the read view
+        //
+        Pages = (UINT8 *)PlatformMemAllocateContiguousZeroedMemory((1 + EPTP_SWITCHING_MAXIMUM_TABLES) * PAGE_SIZE);
+
+        if (Pages == NULL)
+        {
+            //
+            // The hidden hooks will use the MTF
+            //
+            LogWarning("Warning, the views of the hidden hooks are not initialized");
+            EptpSwitchingUninitialize();
+
+            return FALSE;
+        }
+
+        PhysicalAddress = VirtualAddressToPhysicalAddress(Pages);
+
+        EptpViewListInitialize(&VCpu->EptpViewList, (UINT64 *)Pages, PhysicalAddress);
+
+        //
+        // The unused indexes of the list switch to the execute view instead
+        // of causing vm-exits, the read view is added once it's built
+        //
+        for (UINT32 j = 0; j < EPTP_VIEW_LIST_ENTRIES; j++)
+        {
+            EptpViewListSet(&VCpu->EptpViewList, j, VCpu->EptPointer.AsUInt);
+        }
+
+        EptpViewOverlayInitialize(&VCpu->EptpReadView,
+                                  (UINT64 *)(Pages + PAGE_SIZE),
+                                  PhysicalAddress + PAGE_SIZE,
+                                  EPTP_SWITCHING_MAXIMUM_TABLES,
+                                  EptpSwitchingPhysicalToVirtual,
+                                  NULL);
+
+        VCpu->EptpReadViewIsValid = FALSE;
+    }
+
+    return TRUE;
+
+#else
+
+    //
+    // The EPTP list is not needed
+    //
+    g_CompatibilityCheck.EptpSwitchingSupport = FALSE;
+
+    return FALSE;
+
+#endif // UseEptpViewsForHiddenHooks == TRUE
+}
+
+/**
+ * @brief Free the EPTP list and the tables of the read view of the cores
+ *
+ * @return VOID
+ */
+VOID
+EptpSwitchingUninitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        if (g_GuestState[i].EptpViewList.Entries != NULL)
+        {
+            MmFreeContiguousMemory(g_GuestState[i].EptpViewList.Entries);
+        }
+
+        g_GuestState[i].EptpViewList.Entries = NULL;
+        g_GuestState[i].EptpReadViewIsValid  = FALSE;
+    }
+}
+
+/**
+ * @brief Convert the physical address of a table of the EPT to its virtual
+ * address
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+PVOID
+EptpSwitchingPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    return (PVOID)PhysicalAddressToVirtualAddress(PhysicalAddress);
+}
+
+/**
+ * @brief Configure the EPTP list of the core in its VMCS
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+EptpSwitchingSetupVmcs(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    if (VCpu->EptpViewList.Entries == NULL || !g_CompatibilityCheck.EptpSwitchingSupport)
+    {
+        return;
+    }
+
+    //
+    // Only the EPTP switching (function 0) is enabled
+    //
+    VmxVmwrite64(EPTP_SWITCHING_VMCS_CTRL_VMFUNC_CONTROLS, 1);
+    VmxVmwrite64(EPTP_SWITCHING_VMCS_CTRL_LIST_ADDRESS, VCpu->EptpViewList.PhysicalAddress);
+}
+
+/**
+ * @brief Get the EPTP of the read view of the core
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return UINT64
+ */
+static UINT64
+EptpSwitchingGetReadViewEptp(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    return EptpViewGetEptp(VCpu->EptPointer.AsUInt, VCpu->EptpReadView.TablesPhysicalAddress);
+}
+
+/**
+ * @brief Build the read view from the current EPT of the core
+ * @details should be called in vmx-root mode
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EptpSwitchingBuildReadView(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    UINT64 ReadViewEptp = EptpSwitchingGetReadViewEptp(VCpu);
+
+    if (!EptpViewOverlayReset(&VCpu->EptpReadView, VCpu->EptPointer.PageFrameNumber * PAGE_SIZE))
+    {
+        return FALSE;
+    }
+
+    //
+    // The hooked pages of the hidden hooks are readable (with their original
+    // contents) but not executable
+    //
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, HookedEntry)
+    {
+        if (HookedEntry->IsExecutionHook &&
+            !EptpViewOverlaySetEntry(&VCpu->EptpReadView,
+                                     HookedEntry->PhysicalBaseAddress,
+                                     EptpViewGetReadViewEntry(HookedEntry->OriginalEntry.AsUInt)))
+        {
+            //
+            // There is no free table, the hooks will use the MTF
+            //
+            return FALSE;
+        }
+    }
+
+    EptInveptSingleContext(ReadViewEptp);
+
+    EptpViewListSet(&VCpu->EptpViewList, EPTP_VIEW_READ, ReadViewEptp);
+
+    VCpu->EptpReadViewIsValid = TRUE;
+
+    return TRUE;
+}
+
+/**
+ * @brief Handle the EPT violation of a hidden hook by switching the view
+ * @details should be called in vmx-root mode, if it returns TRUE, the
+ * instruction should be redone on the new view
+ *
+ * @param VCpu The virtual processor's state
+ * @param ViolationQualification
+ *
+ * @return BOOLEAN Whether the violation is handled or not
+ */
+BOOLEAN
+EptpSwitchingHandleHookViolation(VIRTUAL_MACHINE_STATE *              VCpu,
+                                 VMX_EXIT_QUALIFICATION_EPT_VIOLATION ViolationQualification)
+{
+    UINT64 CurrentEptp = NULL64_ZERO;
+    UINT32 TargetView;
+
+    if (VCpu->EptpViewList.Entries == NULL || VCpu->NotNormalEptp)
+    {
+        return FALSE;
+    }
+
+    //
+    // The guest might switch the view by VMFUNC
+    //
+    VmxVmread64P(VMCS_CTRL_EPT_POINTER, &CurrentEptp);
+
+    TargetView = EptpViewGetTargetView(EptpViewListFind(&VCpu->EptpViewList, CurrentEptp),
+                                       (BOOLEAN)ViolationQualification.ReadAccess,
+                                       (BOOLEAN)ViolationQualification.WriteAccess,
+                                       (BOOLEAN)ViolationQualification.ExecuteAccess);
+
+    if (TargetView == EPTP_VIEW_READ)
+    {
+        if (!VCpu->EptpReadViewIsValid && !EptpSwitchingBuildReadView(VCpu))
+        {
+            return FALSE;
+        }
+
+        VCpu->EptpReadViewSwitchRip = VCpu->LastVmexitRip;
+
+        VmxVmwrite64(VMCS_CTRL_EPT_POINTER, EptpSwitchingGetReadViewEptp(VCpu));
+
+        return TRUE;
+    }
+    else if (TargetView == EPTP_VIEW_EXECUTE)
+    {
+        EptpSwitchingRestoreExecuteView(VCpu);
+
+        //
+        // If the same instruction switched to the read view, it both executes
+        // and reads the hooked pages, so it's stepped by the MTF
+        //
+        return VCpu->LastVmexitRip != VCpu->EptpReadViewSwitchRip;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Switch the core back to the execute view
+ * @details should be called in vmx-root mode
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+EptpSwitchingRestoreExecuteView(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    UINT64 CurrentEptp = NULL64_ZERO;
+
+    if (VCpu->EptpViewList.Entries == NULL)
+    {
+        return;
+    }
+
+    VmxVmread64P(VMCS_CTRL_EPT_POINTER, &CurrentEptp);
+
+    if (CurrentEptp == EptpSwitchingGetReadViewEptp(VCpu))
+    {
+        VmxVmwrite64(VMCS_CTRL_EPT_POINTER, VCpu->EptPointer.AsUInt);
+    }
+}
+
+/**
+ * @brief Invalidate the read view of the current core once its EPT is
+ * changed
+ * @details called by the invalidations of the EPT (in vmx-root mode), the
+ * read view is rebuilt on the next read of a hooked page
+ *
+ * @param EptPointer The invalidated EPTP or zero for all of the contexts
+ *
+ * @return VOID
+ */
+VOID
+EptpSwitchingInvalidateReadView(UINT64 EptPointer)
+{
+    VIRTUAL_MACHINE_STATE * VCpu = &g_GuestState[KeGetCurrentProcessorNumberEx(NULL)];
+
+    if (VCpu->EptpViewList.Entries == NULL || !VCpu->EptpReadViewIsValid)
+    {
+        return;
+    }
+
+    if (EptPointer != NULL64_ZERO && EptPointer != VCpu->EptPointer.AsUInt)
+    {
+        return;
+    }
+
+    VCpu->EptpReadViewIsValid = FALSE;
+
+    //
+    // The guest can't switch to the old read view by VMFUNC
+    //
+    EptpViewListSet(&VCpu->EptpViewList, EPTP_VIEW_READ, VCpu->EptPointer.AsUInt);
+
+    EptpSwitchingRestoreExecuteView(VCpu);
+}
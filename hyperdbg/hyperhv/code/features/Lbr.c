@@ -0,0 +1,282 @@
+/**
+ * @file Lbr.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the Last Branch Records
+ * @details IA32_DEBUGCTL.LBR of the guest is set in the VMCS (it's loaded on
+ * vm-entries and saved on vm-exits), and the vm-exits clear IA32_DEBUGCTL, so
+ * the stack is frozen in vmx-root and holds the last branches of the guest
+ * when an event is triggered
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Enable the Last Branch Records on the current core
+ * @details Should be called in vmx-root, the cores that are not configured
+ * are not recorded
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+LbrEnable(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    PLBR_CORE_STATE State = &VCpu->LbrState;
+
+    if (!State->IsConfigured || State->IsEnabled)
+    {
+        return;
+    }
+
+    //
+    // MSR_LBR_SELECT is not switched by the vm-exits, so it's written here
+    //
+    if (g_LbrLayout.SelectMsr != 0)
+    {
+        __writemsr(g_LbrLayout.SelectMsr, State->Select);
+    }
+
+    //
+    // The guest's IA32_DEBUGCTL is kept in the VMCS (the controls are also
+    // toggled by the thread interception, both of them are kept set here)
+    //
+    HvSetLoadDebugControls(TRUE);
+    HvSetSaveDebugControls(TRUE);
+    HvSetDebugctl(HvGetDebugctl() | LBR_DECODE_DEBUGCTL_LBR);
+
+    State->IsEnabled = TRUE;
+}
+
+/**
+ * @brief Disable the Last Branch Records on the current core
+ * @details Should be called in vmx-root, the records are kept
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+LbrDisable(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    PLBR_CORE_STATE State = &VCpu->LbrState;
+
+    if (!State->IsEnabled)
+    {
+        return;
+    }
+
+    HvSetDebugctl(HvGetDebugctl() & ~LBR_DECODE_DEBUGCTL_LBR);
+
+    State->IsEnabled = FALSE;
+}
+
+/**
+ * @brief Configure the chosen cores and enable the Last Branch Records
+ *
+ * @param LbrRequest
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+LbrStart(PLBR_OPERATION_PACKETS LbrRequest)
+{
+    ULONG           ProcessorsCount     = KeQueryActiveProcessorCount(0);
+    UINT32          NumberOfChosenCores = 0;
+    PLBR_CORE_STATE State;
+    BOOLEAN         IsChosen;
+
+    if (!g_CompatibilityCheck.LbrSupport)
+    {
+        LbrRequest->KernelStatus = DEBUGGER_ERROR_LBR_IS_NOT_SUPPORTED;
+        return FALSE;
+    }
+
+    //
+    // The filtering is not available on the oldest processors
+    //
+    if ((LbrRequest->Select & ~LBR_SELECT_MASK) != 0 ||
+        (LbrRequest->Select != 0 && g_LbrLayout.SelectMsr == 0))
+    {
+        LbrRequest->KernelStatus = DEBUGGER_ERROR_INVALID_LBR_PARAMETERS;
+        return FALSE;
+    }
+
+    //
+    // The previous recording is stopped, so the new filter is written by
+    // the next enabling
+    //
+    BroadcastDisableLbrAllCores();
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        State = &g_GuestState[i].LbrState;
+
+        //
+        // The cores above 63 are only chosen when all of the cores are chosen
+        //
+        IsChosen = LbrRequest->CoreMask == 0 || (i < 64 && (LbrRequest->CoreMask & (1ull << i)) != 0);
+
+        State->IsConfigured = IsChosen;
+        State->Select       = LbrRequest->Select;
+
+        if (IsChosen)
+        {
+            NumberOfChosenCores++;
+        }
+    }
+
+    if (NumberOfChosenCores == 0)
+    {
+        LbrRequest->KernelStatus = DEBUGGER_ERROR_INVALID_LBR_PARAMETERS;
+        return FALSE;
+    }
+
+    BroadcastEnableLbrAllCores();
+
+    return TRUE;
+}
+
+/**
+ * @brief Query the statistics of the Last Branch Records of all cores
+ *
+ * @param LbrRequest
+ *
+ * @return VOID
+ */
+static VOID
+LbrQuery(PLBR_OPERATION_PACKETS LbrRequest)
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    LbrRequest->NumberOfEntries      = g_LbrLayout.NumberOfEntries;
+    LbrRequest->Format               = g_LbrLayout.Format;
+    LbrRequest->IsSelectSupported    = g_LbrLayout.SelectMsr != 0;
+    LbrRequest->NumberOfEnabledCores = 0;
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        if (g_GuestState[i].LbrState.IsEnabled)
+        {
+            LbrRequest->NumberOfEnabledCores++;
+            LbrRequest->Select = g_GuestState[i].LbrState.Select;
+        }
+    }
+}
+
+/**
+ * @brief Perform actions related to the Last Branch Records
+ * @details Should be called in vmx non-root
+ *
+ * @param LbrRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+LbrPerformOperation(PLBR_OPERATION_PACKETS LbrRequest)
+{
+    BOOLEAN Status = FALSE;
+
+    if (!g_CompatibilityCheck.LbrSupport)
+    {
+        LbrRequest->KernelStatus = DEBUGGER_ERROR_LBR_IS_NOT_SUPPORTED;
+        return FALSE;
+    }
+
+    switch (LbrRequest->LbrOperationType)
+    {
+    case LBR_OPERATION_TYPE_QUERY:
+
+        //
+        // Only the statistics are queried
+        //
+        Status = TRUE;
+        break;
+
+    case LBR_OPERATION_TYPE_ENABLE:
+
+        Status = LbrStart(LbrRequest);
+        break;
+
+    case LBR_OPERATION_TYPE_DISABLE:
+
+        BroadcastDisableLbrAllCores();
+
+        Status = TRUE;
+        break;
+
+    default:
+
+        LbrRequest->KernelStatus = DEBUGGER_ERROR_INVALID_LBR_PARAMETERS;
+        break;
+    }
+
+    if (Status)
+    {
+        //
+        // Fill the statistics (after the operation)
+        //
+        LbrQuery(LbrRequest);
+
+        LbrRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief Capture the last branches of the current core
+ * @details Used by the events and the scripts, can be called both in vmx-root
+ * and vmx non-root (the recording is paused while the MSRs are read, in vmx
+ * non-root the newest records are the branches of the debugger)
+ *
+ * @param Records The records, the newest one first
+ * @param MaximumRecords
+ *
+ * @return UINT32 Number of the records
+ */
+UINT32
+LbrCaptureSnapshot(PLBR_DECODE_RECORD Records, UINT32 MaximumRecords)
+{
+    UINT64 From[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT64 To[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT64 Info[LBR_DECODE_MAXIMUM_ENTRIES];
+    UINT64 Debugctl;
+    UINT64 Tos;
+
+    if (!g_CompatibilityCheck.LbrSupport)
+    {
+        return 0;
+    }
+
+    //
+    // The vm-exits clear IA32_DEBUGCTL, so it's only set in vmx non-root
+    //
+    Debugctl = __readmsr(LBR_DECODE_MSR_IA32_DEBUGCTL);
+
+    if (Debugctl & LBR_DECODE_DEBUGCTL_LBR)
+    {
+        __writemsr(LBR_DECODE_MSR_IA32_DEBUGCTL, Debugctl & ~LBR_DECODE_DEBUGCTL_LBR);
+    }
+
+    Tos = __readmsr(LBR_DECODE_MSR_LBR_TOS);
+
+    for (UINT32 i = 0; i < g_LbrLayout.NumberOfEntries; i++)
+    {
+        From[i] = __readmsr(g_LbrLayout.FromMsr + i);
+        To[i]   = g_LbrLayout.ToMsr != 0 ? __readmsr(g_LbrLayout.ToMsr + i) : 0;
+        Info[i] = g_LbrLayout.InfoMsr != 0 ? __readmsr(g_LbrLayout.InfoMsr + i) : 0;
+    }
+
+    if (Debugctl & LBR_DECODE_DEBUGCTL_LBR)
+    {
+        __writemsr(LBR_DECODE_MSR_IA32_DEBUGCTL, Debugctl);
+    }
+
+    return LbrDecodeRecords(&g_LbrLayout, Tos, From, To, g_LbrLayout.InfoMsr != 0 ? Info : NULL, MaximumRecords, Records);
+}
@@ -0,0 +1,542 @@
+/**
+ * @file ProcessorTrace.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of Intel Processor Trace
+ * @details Each chosen core writes its packets to a contiguous buffer that
+ * is described by a single-entry table of ToPA (the last entry points back
+ * to the table, so the buffer is a ring). IA32_RTIT_CTL of the guest is
+ * loaded on vm-entries and cleared on vm-exits, thus the packets of the
+ * vmx-root are never recorded. The buffers are decoded in the user-mode
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Enable Intel Processor Trace on the current core
+ * @details Should be called in vmx-root, the cores without a buffer are
+ * not traced
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+ProcessorTraceEnable(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    PPROCESSOR_TRACE_CORE_STATE State = &VCpu->ProcessorTraceState;
+
+    if (State->Buffer == NULL || State->IsEnabled)
+    {
+        return;
+    }
+
+    //
+    // The guest traces itself, the output MSRs are not touched
+    //
+    if ((__readmsr(PROCESSOR_TRACE_MSR_IA32_RTIT_CTL) & PROCESSOR_TRACE_CTL_TRACE_EN) != 0)
+    {
+        return;
+    }
+
+    //
+    // The tracing continues from the last position of the ring (the bits
+    // 6:0 of the mask are forced to one in the ToPA mode)
+    //
+    __writemsr(PROCESSOR_TRACE_MSR_IA32_RTIT_OUTPUT_BASE, VirtualAddressToPhysicalAddress(State->Topa));
+    __writemsr(PROCESSOR_TRACE_MSR_IA32_RTIT_OUTPUT_MASK_PTRS, ((UINT64)State->WriteOffset << 32) | 0x7f);
+    __writemsr(PROCESSOR_TRACE_MSR_IA32_RTIT_STATUS, 0);
+
+    //
+    // The filter MSRs cause #GP if they're not supported, so they're only
+    // written when they're used
+    //
+    if (State->Control & PROCESSOR_TRACE_CTL_CR3_FILTER)
+    {
+        __writemsr(PROCESSOR_TRACE_MSR_IA32_RTIT_CR3_MATCH, State->Cr3Match);
+    }
+
+    if (State->Control & PROCESSOR_TRACE_CTL_ADDR0_CFG_FILTER)
+    {
+        __writemsr(PROCESSOR_TRACE_MSR_IA32_RTIT_ADDR0_A, State->AddressA);
+        __writemsr(PROCESSOR_TRACE_MSR_IA32_RTIT_ADDR0_B, State->AddressB);
+    }
+
+    VmxVmwrite64(PROCESSOR_TRACE_VMCS_GUEST_RTIT_CTL, State->Control | PROCESSOR_TRACE_CTL_TRACE_EN);
+    HvSetProcessorTraceControls(TRUE);
+
+    State->IsEnabled = TRUE;
+}
+
+/**
+ * @brief Disable Intel Processor Trace on the current core
+ * @details Should be called in vmx-root, the buffer is kept for reading
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+ProcessorTraceDisable(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    PPROCESSOR_TRACE_CORE_STATE State = &VCpu->ProcessorTraceState;
+
+    if (!State->IsEnabled)
+    {
+        return;
+    }
+
+    VmxVmwrite64(PROCESSOR_TRACE_VMCS_GUEST_RTIT_CTL, 0);
+    HvSetProcessorTraceControls(FALSE);
+
+    //
+    // IA32_RTIT_CTL is cleared by the vm-exit, so the packets are flushed
+    // to the buffer and the output MSRs can be read
+    //
+    State->WriteOffset = (UINT32)(__readmsr(PROCESSOR_TRACE_MSR_IA32_RTIT_OUTPUT_MASK_PTRS) >> 32) & (State->BufferSize - 1);
+    State->Status |= (UINT32)__readmsr(PROCESSOR_TRACE_MSR_IA32_RTIT_STATUS);
+    State->IsEnabled = FALSE;
+}
+
+/**
+ * @brief Enable or disable Intel Processor Trace on the current core
+ * @details Used by the events and the scripts, can be called both in vmx-root
+ * and vmx non-root
+ *
+ * @param Enable
+ *
+ * @return VOID
+ */
+VOID
+ProcessorTraceControlCurrentCore(BOOLEAN Enable)
+{
+    VIRTUAL_MACHINE_STATE * VCpu;
+
+    if (VmxGetCurrentExecutionMode() == TRUE)
+    {
+        VCpu = &g_GuestState[KeGetCurrentProcessorNumberEx(NULL)];
+
+        if (Enable)
+        {
+            ProcessorTraceEnable(VCpu);
+        }
+        else
+        {
+            ProcessorTraceDisable(VCpu);
+        }
+    }
+    else
+    {
+        AsmVmxVmcall(Enable ? VMCALL_ENABLE_PROCESSOR_TRACE : VMCALL_DISABLE_PROCESSOR_TRACE, 0, 0, 0);
+    }
+}
+
+/**
+ * @brief Free the buffers of a core
+ *
+ * @param State
+ *
+ * @return VOID
+ */
+static VOID
+ProcessorTraceFreeBuffers(PPROCESSOR_TRACE_CORE_STATE State)
+{
+    if (State->Buffer != NULL)
+    {
+        MmFreeContiguousMemory(State->Buffer);
+    }
+
+    if (State->Topa != NULL)
+    {
+        MmFreeContiguousMemory(State->Topa);
+    }
+
+    State->Buffer     = NULL;
+    State->Topa       = NULL;
+    State->BufferSize = 0;
+}
+
+/**
+ * @brief Allocate the buffer and the table of ToPA of a core
+ * @details The region of a ToPA entry should be aligned to its size, thus
+ * the buffer is not allowed to cross a boundary of its size
+ *
+ * @param State
+ * @param BufferSize
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProcessorTraceAllocateBuffers(PPROCESSOR_TRACE_CORE_STATE State, UINT32 BufferSize)
+{
+    PHYSICAL_ADDRESS LowestAddress  = {.QuadPart = 0};
+    PHYSICAL_ADDRESS HighestAddress = {.QuadPart = MAXULONG64};
+    PHYSICAL_ADDRESS Boundary       = {.QuadPart = BufferSize};
+    UINT32           SizeEncoding   = 0;
+
+    if (State->Buffer != NULL && State->BufferSize == BufferSize)
+    {
+        RtlZeroMemory(State->Buffer, BufferSize);
+        return TRUE;
+    }
+
+    ProcessorTraceFreeBuffers(State);
+
+    State->Buffer = MmAllocateContiguousMemorySpecifyCache(BufferSize, LowestAddress, HighestAddress, Boundary, MmCached);
+    State->Topa   = PlatformMemAllocateContiguousZeroedMemory(PAGE_SIZE);
+
+    if (State->Buffer == NULL || State->Topa == NULL)
+    {
+        ProcessorTraceFreeBuffers(State);
+        return FALSE;
+    }
+
+    RtlZeroMemory(State->Buffer, BufferSize);
+
+    while ((PAGE_SIZE << SizeEncoding) < BufferSize)
+    {
+        SizeEncoding++;
+    }
+
+    State->Topa[0]    = VirtualAddressToPhysicalAddress(State->Buffer) | ((UINT64)SizeEncoding << PROCESSOR_TRACE_TOPA_SIZE_SHIFT);
+    State->Topa[1]    = VirtualAddressToPhysicalAddress(State->Topa) | PROCESSOR_TRACE_TOPA_END;
+    State->BufferSize = BufferSize;
+
+    return TRUE;
+}
+
+/**
+ * @brief Allocate the buffers of the chosen cores and start tracing
+ *
+ * @param ProcessorTraceRequest
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProcessorTraceStart(PPROCESSOR_TRACE_OPERATION_PACKETS ProcessorTraceRequest)
+{
+    ULONG                       ProcessorsCount = KeQueryActiveProcessorCount(0);
+    PPROCESSOR_TRACE_CORE_STATE State;
+    BOOLEAN                     IsChosen;
+    UINT32                      NumberOfChosenCores = 0;
+    UINT64                      Control;
+    UINT64                      Cr3;
+    INT32                       Regs[4];
+
+    if (!g_CompatibilityCheck.ProcessorTraceSupport)
+    {
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_PROCESSOR_TRACE_IS_NOT_SUPPORTED;
+        return FALSE;
+    }
+
+    if (ProcessorTraceRequest->BufferSize < PROCESSOR_TRACE_MINIMUM_BUFFER_SIZE ||
+        ProcessorTraceRequest->BufferSize > PROCESSOR_TRACE_MAXIMUM_BUFFER_SIZE ||
+        (ProcessorTraceRequest->BufferSize & (ProcessorTraceRequest->BufferSize - 1)) != 0 ||
+        ProcessorTraceRequest->PrivilegeFilter == 0 ||
+        (ProcessorTraceRequest->PrivilegeFilter & ~(PROCESSOR_TRACE_FILTER_USER_MODE | PROCESSOR_TRACE_FILTER_KERNEL_MODE)) != 0 ||
+        ProcessorTraceRequest->IpFilterStart > ProcessorTraceRequest->IpFilterEnd)
+    {
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS;
+        return FALSE;
+    }
+
+    //
+    // The process is converted to its directory table base (the PCID bits
+    // are also compared by the processor, so they're removed)
+    //
+    Cr3 = ProcessorTraceRequest->Cr3;
+
+    if (ProcessorTraceRequest->ProcessId != 0)
+    {
+        Cr3 = LayoutGetCr3ByProcessId(ProcessorTraceRequest->ProcessId).Flags;
+
+        if (Cr3 == NULL64_ZERO)
+        {
+            ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS;
+            return FALSE;
+        }
+    }
+
+    Cr3 &= ~0xfffull;
+
+    Control = PROCESSOR_TRACE_CTL_BRANCH_EN | PROCESSOR_TRACE_CTL_TOPA | PROCESSOR_TRACE_CTL_TSC_EN;
+
+    if (ProcessorTraceRequest->PrivilegeFilter & PROCESSOR_TRACE_FILTER_USER_MODE)
+    {
+        Control |= PROCESSOR_TRACE_CTL_USER;
+    }
+
+    if (ProcessorTraceRequest->PrivilegeFilter & PROCESSOR_TRACE_FILTER_KERNEL_MODE)
+    {
+        Control |= PROCESSOR_TRACE_CTL_OS;
+    }
+
+    //
+    // The filters are checked against the sub-leaf 0 of the CPUID leaf of
+    // Intel Processor Trace
+    //
+    CommonCpuidInstruction(PROCESSOR_TRACE_CPUID_LEAF, 0, Regs);
+
+    if (Cr3 != NULL64_ZERO)
+    {
+        if ((Regs[1] & (1 << 0)) == 0)
+        {
+            ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_PROCESSOR_TRACE_IS_NOT_SUPPORTED;
+            return FALSE;
+        }
+
+        Control |= PROCESSOR_TRACE_CTL_CR3_FILTER;
+    }
+
+    if (ProcessorTraceRequest->IpFilterEnd != NULL64_ZERO)
+    {
+        if ((Regs[1] & (1 << 2)) == 0)
+        {
+            ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_PROCESSOR_TRACE_IS_NOT_SUPPORTED;
+            return FALSE;
+        }
+
+        Control |= PROCESSOR_TRACE_CTL_ADDR0_CFG_FILTER;
+    }
+
+    //
+    // The previous tracing is stopped, so no core writes to the buffers
+    //
+    BroadcastDisableProcessorTraceAllCores();
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        State = &g_GuestState[i].ProcessorTraceState;
+
+        //
+        // The cores above 63 are only chosen when all of the cores are chosen
+        //
+        IsChosen = ProcessorTraceRequest->CoreMask == 0 || (i < 64 && (ProcessorTraceRequest->CoreMask & (1ull << i)) != 0);
+
+        if (!IsChosen)
+        {
+            ProcessorTraceFreeBuffers(State);
+            continue;
+        }
+
+        if (!ProcessorTraceAllocateBuffers(State, ProcessorTraceRequest->BufferSize))
+        {
+            ProcessorTraceUninitialize();
+            ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_UNABLE_TO_ALLOCATE_PROCESSOR_TRACE_BUFFERS;
+            return FALSE;
+        }
+
+        State->Control     = Control;
+        State->Cr3Match    = Cr3;
+        State->AddressA    = ProcessorTraceRequest->IpFilterStart;
+        State->AddressB    = ProcessorTraceRequest->IpFilterEnd;
+        State->WriteOffset = 0;
+        State->Status      = 0;
+
+        NumberOfChosenCores++;
+    }
+
+    if (NumberOfChosenCores == 0)
+    {
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS;
+        return FALSE;
+    }
+
+    //
+    // The paused tracing is started by the events (scripts)
+    //
+    if (!ProcessorTraceRequest->IsPaused)
+    {
+        BroadcastEnableProcessorTraceAllCores();
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the buffer of a core
+ * @details The offsets are relative to the oldest byte of the ring, the
+ * bytes that are not written yet are zero (PAD packets)
+ *
+ * @param ProcessorTraceRequest
+ * @param Buffer
+ * @param MaximumBytes
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProcessorTraceReadBuffer(PPROCESSOR_TRACE_OPERATION_PACKETS ProcessorTraceRequest, UINT8 * Buffer, UINT32 MaximumBytes)
+{
+    PPROCESSOR_TRACE_CORE_STATE State;
+    UINT32                      Start;
+    UINT32                      FirstPart;
+
+    if (ProcessorTraceRequest->CoreId >= KeQueryActiveProcessorCount(0) ||
+        g_GuestState[ProcessorTraceRequest->CoreId].ProcessorTraceState.Buffer == NULL ||
+        ProcessorTraceRequest->Offset >= g_GuestState[ProcessorTraceRequest->CoreId].ProcessorTraceState.BufferSize)
+    {
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS;
+        return FALSE;
+    }
+
+    State = &g_GuestState[ProcessorTraceRequest->CoreId].ProcessorTraceState;
+
+    //
+    // The write pointer is only known after the tracing is disabled
+    //
+    if (State->IsEnabled)
+    {
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_PROCESSOR_TRACE_IS_RUNNING;
+        return FALSE;
+    }
+
+    if (MaximumBytes > PROCESSOR_TRACE_MAXIMUM_READ_SIZE)
+    {
+        MaximumBytes = PROCESSOR_TRACE_MAXIMUM_READ_SIZE;
+    }
+
+    if (MaximumBytes > State->BufferSize - ProcessorTraceRequest->Offset)
+    {
+        MaximumBytes = State->BufferSize - ProcessorTraceRequest->Offset;
+    }
+
+    Start     = (State->WriteOffset + ProcessorTraceRequest->Offset) & (State->BufferSize - 1);
+    FirstPart = State->BufferSize - Start;
+
+    if (FirstPart >= MaximumBytes)
+    {
+        RtlCopyMemory(Buffer, State->Buffer + Start, MaximumBytes);
+    }
+    else
+    {
+        RtlCopyMemory(Buffer, State->Buffer + Start, FirstPart);
+        RtlCopyMemory(Buffer + FirstPart, State->Buffer, MaximumBytes - FirstPart);
+    }
+
+    ProcessorTraceRequest->NumberOfBytes = MaximumBytes;
+
+    return TRUE;
+}
+
+/**
+ * @brief Query the statistics of Intel Processor Trace of all cores
+ *
+ * @param ProcessorTraceRequest
+ *
+ * @return VOID
+ */
+static VOID
+ProcessorTraceQuery(PPROCESSOR_TRACE_OPERATION_PACKETS ProcessorTraceRequest)
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    ProcessorTraceRequest->NumberOfConfiguredCores = 0;
+    ProcessorTraceRequest->NumberOfTracingCores    = 0;
+    ProcessorTraceRequest->ConfiguredBufferSize    = 0;
+    ProcessorTraceRequest->TraceStatus             = 0;
+    ProcessorTraceRequest->ConfiguredCr3           = 0;
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        PPROCESSOR_TRACE_CORE_STATE State = &g_GuestState[i].ProcessorTraceState;
+
+        if (State->Buffer == NULL)
+        {
+            continue;
+        }
+
+        if (State->IsEnabled)
+        {
+            ProcessorTraceRequest->NumberOfTracingCores++;
+        }
+
+        ProcessorTraceRequest->NumberOfConfiguredCores++;
+        ProcessorTraceRequest->ConfiguredBufferSize = State->BufferSize;
+        ProcessorTraceRequest->ConfiguredCr3        = State->Cr3Match;
+        ProcessorTraceRequest->TraceStatus |= State->Status & (PROCESSOR_TRACE_STATUS_ERROR | PROCESSOR_TRACE_STATUS_STOPPED);
+    }
+}
+
+/**
+ * @brief Perform actions related to Intel Processor Trace
+ * @details Should be called in vmx non-root
+ *
+ * @param ProcessorTraceRequest
+ * @param Buffer The buffer of the reading requests
+ * @param MaximumBytes
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ProcessorTracePerformOperation(PPROCESSOR_TRACE_OPERATION_PACKETS ProcessorTraceRequest, UINT8 * Buffer, UINT32 MaximumBytes)
+{
+    BOOLEAN Status = FALSE;
+
+    ProcessorTraceRequest->NumberOfBytes = 0;
+
+    switch (ProcessorTraceRequest->ProcessorTraceOperationType)
+    {
+    case PROCESSOR_TRACE_OPERATION_TYPE_QUERY:
+
+        //
+        // Only the statistics are queried
+        //
+        Status = TRUE;
+        break;
+
+    case PROCESSOR_TRACE_OPERATION_TYPE_START:
+
+        Status = ProcessorTraceStart(ProcessorTraceRequest);
+        break;
+
+    case PROCESSOR_TRACE_OPERATION_TYPE_STOP:
+
+        BroadcastDisableProcessorTraceAllCores();
+
+        Status = TRUE;
+        break;
+
+    case PROCESSOR_TRACE_OPERATION_TYPE_READ_BUFFER:
+
+        Status = ProcessorTraceReadBuffer(ProcessorTraceRequest, Buffer, MaximumBytes);
+        break;
+
+    default:
+
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS;
+        break;
+    }
+
+    if (Status)
+    {
+        //
+        // Fill the statistics (after the operation)
+        //
+        ProcessorTraceQuery(ProcessorTraceRequest);
+
+        ProcessorTraceRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief Free the buffers of the cores
+ * @details The tracing should be disabled on all cores
+ *
+ * @return VOID
+ */
+VOID
+ProcessorTraceUninitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        ProcessorTraceFreeBuffers(&g_GuestState[i].ProcessorTraceState);
+    }
+}
@@ -0,0 +1,394 @@
+/**
+ * @file Profiler.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the sampling profiler
+ * @details The VMX-preemption timer of the chosen cores causes a vm-exit
+ * after each period, the RIP, the CR3 and the candidate return addresses
+ * of the guest are recorded in the histogram of the core, and the timer is
+ * armed again. The histograms are read and symbolized by the user-mode
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Convert a period (TSC cycles) to the ticks of the VMX-preemption timer
+ * @details The timer counts down each time that the bit X of the TSC
+ * changes, X is reported by IA32_VMX_MISC
+ *
+ * @param Period
+ *
+ * @return UINT32
+ */
+static UINT32
+ProfilerConvertPeriodToTimerValue(UINT64 Period)
+{
+    IA32_VMX_MISC_REGISTER VmxMisc = {0};
+    UINT64                 TimerValue;
+
+    VmxMisc.AsUInt = __readmsr(IA32_VMX_MISC);
+
+    TimerValue = Period >> VmxMisc.PreemptionTimerTscRelationship;
+
+    if (TimerValue == 0)
+    {
+        return 1;
+    }
+
+    if (TimerValue > MAXULONG)
+    {
+        return MAXULONG;
+    }
+
+    return (UINT32)TimerValue;
+}
+
+/**
+ * @brief Enable the sampling profiler on the current core
+ * @details Should be called in vmx-root, the cores without a histogram
+ * are not sampled
+ *
+ * @param VCpu The virtual processor's state
+ * @param Period The TSC cycles between two samples
+ * @param StackDepth Count of the return addresses that are recorded
+ *
+ * @return VOID
+ */
+VOID
+ProfilerEnable(VIRTUAL_MACHINE_STATE * VCpu, UINT64 Period, UINT32 StackDepth)
+{
+    PPROFILER_CORE_STATE State = &VCpu->ProfilerState;
+
+    if (State->Histogram.Samples == NULL)
+    {
+        return;
+    }
+
+    State->TimerValue = ProfilerConvertPeriodToTimerValue(Period);
+    State->StackDepth = StackDepth;
+    State->IsEnabled  = TRUE;
+
+    //
+    // The value of the timer is saved on the other vm-exits, so the
+    // frequent vm-exits don't postpone the samples
+    //
+    HvSetVmxPreemptionTimerExiting(TRUE);
+    HvSetSaveVmxPreemptionTimerValue(TRUE);
+    CounterSetPreemptionTimer(State->TimerValue);
+}
+
+/**
+ * @brief Disable the sampling profiler on the current core
+ * @details Should be called in vmx-root, the histogram is kept for reading
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+ProfilerDisable(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    if (!VCpu->ProfilerState.IsEnabled)
+    {
+        return;
+    }
+
+    VCpu->ProfilerState.IsEnabled = FALSE;
+
+    HvSetVmxPreemptionTimerExiting(FALSE);
+    HvSetSaveVmxPreemptionTimerValue(FALSE);
+    CounterClearPreemptionTimer();
+}
+
+/**
+ * @brief Record a sample of the guest and arm the timer again
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+ProfilerHandleVmxPreemptionTimerVmexit(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    PPROFILER_CORE_STATE State = &VCpu->ProfilerState;
+    PROFILER_SAMPLE      Sample;
+    UINT64               StackWords[SAMPLE_PROFILE_STACK_SCAN_WORDS];
+
+    Sample.Rip        = VCpu->LastVmexitRip;
+    Sample.Cr3        = LayoutGetCurrentProcessCr3().Flags;
+    Sample.StackDepth = 0;
+    Sample.Count      = 1;
+
+    //
+    // The stack might not be present, the sample is recorded without the
+    // return addresses in that case
+    //
+    if (State->StackDepth != 0 &&
+        MemoryMapperReadMemorySafeOnTargetProcess(VCpu->Regs->rsp, StackWords, sizeof(StackWords)))
+    {
+        Sample.StackDepth = SampleProfileFindReturnAddresses(Sample.Rip,
+                                                             VCpu->Regs->rsp,
+                                                             StackWords,
+                                                             SAMPLE_PROFILE_STACK_SCAN_WORDS,
+                                                             Sample.Stack,
+                                                             State->StackDepth);
+    }
+
+    SampleProfileAdd(&State->Histogram, &Sample);
+
+    //
+    // The saved value of the timer is zero, arm it for the next sample
+    //
+    CounterSetPreemptionTimer(State->TimerValue);
+}
+
+/**
+ * @brief Allocate the histograms of the chosen cores and start sampling
+ *
+ * @param ProfilerRequest
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProfilerStart(PPROFILER_OPERATION_PACKETS ProfilerRequest)
+{
+    ULONG                ProcessorsCount = KeQueryActiveProcessorCount(0);
+    PPROFILER_CORE_STATE State;
+    PPROFILER_SAMPLE     Samples;
+    BOOLEAN              IsChosen;
+    UINT32               NumberOfChosenCores = 0;
+
+    if (!g_CompatibilityCheck.VmxPreemptionTimerSupport)
+    {
+        ProfilerRequest->KernelStatus = DEBUGGER_ERROR_PROFILER_IS_NOT_SUPPORTED;
+        return FALSE;
+    }
+
+    if (ProfilerRequest->Period < PROFILER_MINIMUM_PERIOD ||
+        ProfilerRequest->StackDepth > PROFILER_MAXIMUM_STACK_DEPTH)
+    {
+        ProfilerRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS;
+        return FALSE;
+    }
+
+    //
+    // The previous profiling is stopped, so no core uses the histograms
+    //
+    BroadcastDisableProfilerAllCores();
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        State = &g_GuestState[i].ProfilerState;
+
+        //
+        // The cores above 63 are only chosen when all of the cores are chosen
+        //
+        IsChosen = ProfilerRequest->CoreMask == 0 || (i < 64 && (ProfilerRequest->CoreMask & (1ull << i)) != 0);
+
+        if (!IsChosen)
+        {
+            //
+            // The samples of the previous profiling are not mixed with the new ones
+            //
+            if (State->Histogram.Samples != NULL)
+            {
+                PlatformMemFreePool(State->Histogram.Samples);
+                State->Histogram.Samples = NULL;
+            }
+
+            continue;
+        }
+
+        Samples = State->Histogram.Samples;
+
+        if (Samples == NULL)
+        {
+            Samples = PlatformMemAllocateNonPagedPool(PROFILER_HISTOGRAM_CAPACITY * sizeof(PROFILER_SAMPLE));
+
+            if (Samples == NULL)
+            {
+                ProfilerUninitialize();
+                ProfilerRequest->KernelStatus = DEBUGGER_ERROR_UNABLE_TO_ALLOCATE_PROFILER_HISTOGRAMS;
+                return FALSE;
+            }
+        }
+
+        SampleProfileInitialize(&State->Histogram, Samples, PROFILER_HISTOGRAM_CAPACITY);
+        NumberOfChosenCores++;
+    }
+
+    if (NumberOfChosenCores == 0)
+    {
+        ProfilerRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS;
+        return FALSE;
+    }
+
+    BroadcastEnableProfilerAllCores(ProfilerRequest);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the samples of a core
+ * @details The samples can be read while the core is sampled, the entries
+ * that are being filled are skipped
+ *
+ * @param ProfilerRequest
+ * @param Samples
+ * @param MaximumSamples
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProfilerReadSamples(PPROFILER_OPERATION_PACKETS ProfilerRequest, PPROFILER_SAMPLE Samples, UINT32 MaximumSamples)
+{
+    PPROFILER_CORE_STATE State;
+
+    if (ProfilerRequest->CoreId >= KeQueryActiveProcessorCount(0) ||
+        g_GuestState[ProfilerRequest->CoreId].ProfilerState.Histogram.Samples == NULL)
+    {
+        ProfilerRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS;
+        return FALSE;
+    }
+
+    State = &g_GuestState[ProfilerRequest->CoreId].ProfilerState;
+
+    if (MaximumSamples > PROFILER_MAXIMUM_SAMPLES_PER_READ)
+    {
+        MaximumSamples = PROFILER_MAXIMUM_SAMPLES_PER_READ;
+    }
+
+    ProfilerRequest->NumberOfSamples = SampleProfileRead(&State->Histogram,
+                                                         ProfilerRequest->FirstSample,
+                                                         Samples,
+                                                         MaximumSamples,
+                                                         &ProfilerRequest->NextSample);
+
+    return TRUE;
+}
+
+/**
+ * @brief Query the statistics of the sampling profiler of all cores
+ *
+ * @param ProfilerRequest
+ *
+ * @return VOID
+ */
+static VOID
+ProfilerQuery(PPROFILER_OPERATION_PACKETS ProfilerRequest)
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    ProfilerRequest->NumberOfProfiledCores   = 0;
+    ProfilerRequest->NumberOfDistinctSamples = 0;
+    ProfilerRequest->NumberOfTakenSamples    = 0;
+    ProfilerRequest->NumberOfDroppedSamples  = 0;
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        PPROFILER_CORE_STATE State = &g_GuestState[i].ProfilerState;
+
+        if (State->Histogram.Samples == NULL)
+        {
+            continue;
+        }
+
+        if (State->IsEnabled)
+        {
+            ProfilerRequest->NumberOfProfiledCores++;
+        }
+
+        ProfilerRequest->NumberOfDistinctSamples += State->Histogram.NumberOfDistinctSamples;
+        ProfilerRequest->NumberOfTakenSamples += State->Histogram.NumberOfTakenSamples;
+        ProfilerRequest->NumberOfDroppedSamples += State->Histogram.NumberOfDroppedSamples;
+    }
+}
+
+/**
+ * @brief Perform actions related to the sampling profiler
+ * @details Should be called in vmx non-root
+ *
+ * @param ProfilerRequest
+ * @param Samples The buffer of the samples of the reading requests
+ * @param MaximumSamples
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ProfilerPerformOperation(PPROFILER_OPERATION_PACKETS ProfilerRequest, PPROFILER_SAMPLE Samples, UINT32 MaximumSamples)
+{
+    BOOLEAN Status = FALSE;
+
+    ProfilerRequest->NumberOfSamples = 0;
+
+    switch (ProfilerRequest->ProfilerOperationType)
+    {
+    case PROFILER_OPERATION_TYPE_QUERY:
+
+        //
+        // Only the statistics are queried
+        //
+        Status = TRUE;
+        break;
+
+    case PROFILER_OPERATION_TYPE_START:
+
+        Status = ProfilerStart(ProfilerRequest);
+        break;
+
+    case PROFILER_OPERATION_TYPE_STOP:
+
+        BroadcastDisableProfilerAllCores();
+
+        Status = TRUE;
+        break;
+
+    case PROFILER_OPERATION_TYPE_READ_SAMPLES:
+
+        Status = ProfilerReadSamples(ProfilerRequest, Samples, MaximumSamples);
+        break;
+
+    default:
+
+        ProfilerRequest->KernelStatus = DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS;
+        break;
+    }
+
+    if (Status)
+    {
+        //
+        // Fill the statistics (after the operation)
+        //
+        ProfilerQuery(ProfilerRequest);
+
+        ProfilerRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+    }
+
+    return Status;
+}
+
+/**
+ * @brief Free the histograms of the cores
+ * @details The profiler should be disabled on all cores
+ *
+ * @return VOID
+ */
+VOID
+ProfilerUninitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        if (g_GuestState[i].ProfilerState.Histogram.Samples != NULL)
+        {
+            PlatformMemFreePool(g_GuestState[i].ProfilerState.Histogram.Samples);
+        }
+
+        g_GuestState[i].ProfilerState.Histogram.Samples = NULL;
+    }
+}
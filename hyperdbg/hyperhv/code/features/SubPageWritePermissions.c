@@ -0,0 +1,216 @@
+/**
+ * @file SubPageWritePermissions.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Sub-page write permissions (SPP) of the monitor hooks
+ * @details The write monitors remove the write access of the whole page, so
+ * each write to the page (even far from the monitored range) causes an EPT
+ * violation, a range check and an MTF to restore the hook. If the processor
+ * supports SPP, the sub-pages (128 bytes) that are out of the monitored range
+ * are kept writable and the writes to them don't cause any vm-exit
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Initialize the tables of the sub-page write permissions
+ * @details should be called before the VMCS of the cores are configured
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SubPageWritePermissionsInitialize()
+{
+    if (!g_CompatibilityCheck.SppSupport)
+    {
+        return FALSE;
+    }
+
+    //
+    // Allocate the root table (SPPTP), the other tables are allocated from
+    // the pre-allocated pools once the hooks are applied in vmx-root mode
+    //
+    PoolManagerRequestAllocation(PAGE_SIZE, 1, SUB_PAGE_PERMISSION_TABLE);
+
+    if (!PoolManagerCheckAndPerformAllocationAndDeallocation() ||
+        !SppTableInitialize(&g_EptState->SppTable,
+                            SubPageWritePermissionsAllocateTable,
+                            SubPageWritePermissionsPhysicalToVirtual,
+                            NULL))
+    {
+        //
+        // The monitor hooks will use the page granularity
+        //
+        LogWarning("Warning, sub-page write permissions are not initialized");
+        g_CompatibilityCheck.SppSupport = FALSE;
+
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Allocate a table of the SPP from the pre-allocated pools
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+PVOID
+SubPageWritePermissionsAllocateTable(UINT64 * PhysicalAddress, PVOID Context)
+{
+    PVOID Table;
+
+    UNREFERENCED_PARAMETER(Context);
+
+    Table = (PVOID)PoolManagerRequestPool(SUB_PAGE_PERMISSION_TABLE, TRUE, PAGE_SIZE);
+
+    if (Table == NULL)
+    {
+        return NULL;
+    }
+
+    RtlZeroMemory(Table, PAGE_SIZE);
+
+    *PhysicalAddress = VirtualAddressToPhysicalAddress(Table);
+
+    return Table;
+}
+
+/**
+ * @brief Convert the physical address of a table of the SPP to its
+ * virtual address
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+PVOID
+SubPageWritePermissionsPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    return (PVOID)PhysicalAddressToVirtualAddress(PhysicalAddress);
+}
+
+/**
+ * @brief Reserve the tables of the SPP that the hooks might need
+ *
+ * @param Count Count of the hooked pages
+ *
+ * @return VOID
+ */
+VOID
+SubPageWritePermissionsReservePools(UINT32 Count)
+{
+    if (!g_CompatibilityCheck.SppSupport)
+    {
+        return;
+    }
+
+    //
+    // Each page needs at most three new tables (the root is already allocated)
+    //
+    PoolManagerRequestAllocation(PAGE_SIZE, Count * SPP_TABLE_MAXIMUM_NEW_PAGE, SUB_PAGE_PERMISSION_TABLE);
+}
+
+/**
+ * @brief Keep the sub-pages of a page that are out of the monitored range writable
+ * @details should be called in vmx-root mode and before the EPT entries are
+ * changed, if it returns TRUE, the caller should set the SPP flag of the EPT
+ * entries of the page (while the write access of the entries is 0)
+ *
+ * @param PhysicalBaseAddress The physical address of the page
+ * @param StartOfTargetPhysicalAddress Start of the monitored range
+ * @param EndOfTargetPhysicalAddress End of the monitored range (inclusive)
+ *
+ * @return BOOLEAN Whether the page uses the SPP or not
+ */
+BOOLEAN
+SubPageWritePermissionsProtectRange(SIZE_T PhysicalBaseAddress,
+                                    SIZE_T StartOfTargetPhysicalAddress,
+                                    SIZE_T EndOfTargetPhysicalAddress)
+{
+    UINT32 ProtectedSubPages;
+
+    if (!g_CompatibilityCheck.SppSupport)
+    {
+        return FALSE;
+    }
+
+    ProtectedSubPages = SppGetSubPagesOfRange(StartOfTargetPhysicalAddress, EndOfTargetPhysicalAddress);
+
+    if (ProtectedSubPages == 0 || ProtectedSubPages == SPP_ALL_SUB_PAGES)
+    {
+        //
+        // All of the writes to the page should cause vm-exits anyway
+        //
+        return FALSE;
+    }
+
+    //
+    // The vector is visible to the processor before the EPT entry is
+    // changed, if there is no table in the pools, the hook uses the page
+    // granularity
+    //
+    return SppTableSetWriteVector(&g_EptState->SppTable,
+                                  PhysicalBaseAddress,
+                                  SppGetWriteVector(ProtectedSubPages));
+}
+
+/**
+ * @brief Handle the SPP-related vm-exits
+ * @details The vectors are set before the EPT entries use them, so the
+ * misses and misconfigurations are not expected, the page falls back to the
+ * page granularity and the instruction is executed again
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+SubPageWritePermissionsHandleVmexit(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    UINT64          GuestPhysicalAddr;
+    PEPT_PML1_ENTRY TargetPage;
+    EPT_PML1_ENTRY  ChangedEntry;
+
+    __vmx_vmread(VMCS_GUEST_PHYSICAL_ADDRESS, &GuestPhysicalAddr);
+
+    LogError("Err, unexpected SPP %s, faulting guest address : 0x%llx",
+             (VCpu->ExitQualification & SPP_EXIT_QUALIFICATION_MISCONFIGURATION) ? "misconfiguration" : "miss",
+             GuestPhysicalAddr);
+
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, HookedEntry)
+    {
+        if (HookedEntry->PhysicalBaseAddress == (SIZE_T)PAGE_ALIGN(GuestPhysicalAddr))
+        {
+            //
+            // The entry is restored on the MTF of the hooks
+            //
+            HookedEntry->ChangedEntry.AsUInt &= ~SPP_EPT_ENTRY_FLAG;
+            break;
+        }
+    }
+
+    TargetPage = EptGetPml1Entry(VCpu->EptPageTable, (SIZE_T)GuestPhysicalAddr);
+
+    if (TargetPage != NULL)
+    {
+        ChangedEntry.AsUInt = TargetPage->AsUInt & ~SPP_EPT_ENTRY_FLAG;
+
+        EptSetPML1AndInvalidateTLB(VCpu, TargetPage, ChangedEntry, InveptSingleContext);
+    }
+
+    //
+    // Redo the instruction
+    //
+    HvSuppressRipIncrement(VCpu);
+}
@@ -96,6 +96,16 @@ EptHookReservePreallocatedPoolsForEptHooks(UINT32 Count)
     // Request pages to be allocated for detour hooked pages details
     //
     PoolManagerRequestAllocation(sizeof(HIDDEN_HOOKS_DETOUR_DETAILS), Count, DETOUR_HOOK_DETAILS);
+
+    //
+    // Request pages to be allocated for the tables of the sub-page write permissions
+    //
+    SubPageWritePermissionsReservePools(Count);
+
+    //
+    // Request pages to be allocated for the private EPT tables of the cores
+    //
+    EptReservePrivatePageTables(Count);
 }
 
 /**
@@ -130,6 +140,16 @@ EptHookAllocateExtraHookingPagesForMemoryMonitorsAndExecEptHooks(UINT32 Count)
     PoolManagerRequestAllocation(sizeof(EPT_HOOKED_PAGE_DETAIL),
                                  Count,
                                  TRACKING_HOOKED_PAGES);
+
+    //
+    // Request pages to be allocated for the tables of the sub-page write permissions
+    //
+    SubPageWritePermissionsReservePools(Count);
+
+    //
+    // Request pages to be allocated for the private EPT tables of the cores
+    //
+    EptReservePrivatePageTables(Count);
 }
 
 /**
@@ -656,6 +676,354 @@ EptHookFromVmxRoot(PVOID TargetAddress)
     return EptHookPerformHook(TargetAddress, NULL_ZERO, TRUE);
 }
 
+/**
+ * @brief Hook a batch of addresses with hidden breakpoints
+ * @details The batch is applied as a whole or not at all, everything that might
+ * fail (the capacity of the pages, splitting the large pages and allocating the
+ * hooked pages) is checked before the first breakpoint is set. The entries of all
+ * of the cores are changed here and only the current core is invalidated, the caller
+ * should broadcast to the other cores to invalidate their EPTs (once for the batch)
+ * This function should be called from VMX root-mode
+ *
+ * @param VCpu The virtual processor's state
+ * @param Request The sorted targets of the batch and their pages
+ *
+ * @return BOOLEAN Returns true if the hooks were applied or false if nothing is changed
+ */
+BOOLEAN
+EptHookPerformPageHookBatch(VIRTUAL_MACHINE_STATE * VCpu, PEPT_HOOK_BATCH_REQUEST Request)
+{
+    ULONG                      ProcessorsCount;
+    UINT32                     PageIndex;
+    UINT32                     i;
+    PHOOK_BATCH_PAGE           Page;
+    PEPT_HOOK_BATCH_PAGE_STATE PageState;
+    PEPT_HOOKED_PAGE_DETAIL    HookedPage;
+    PEPT_PML1_ENTRY            TargetPage;
+    CR3_TYPE                   Cr3OfCurrentProcess;
+
+    //
+    // Get number of processors
+    //
+    ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    //
+    // Find the hooked pages of the batch by a single walk over the list (the same
+    // page as EptHookFindByPhysAddress, the first one in the list)
+    //
+    for (i = 0; i < Request->NumberOfPages; i++)
+    {
+        Request->PageStates[i].HookedPage = NULL;
+        Request->PageStates[i].IsNewPage  = FALSE;
+    }
+
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, CurrEntity)
+    {
+        PageIndex = HookBatchFindPage(Request->Pages, Request->NumberOfPages, CurrEntity->PhysicalBaseAddress);
+
+        if (PageIndex != Request->NumberOfPages && Request->PageStates[PageIndex].HookedPage == NULL)
+        {
+            Request->PageStates[PageIndex].HookedPage = CurrEntity;
+        }
+    }
+
+    //
+    // Check whether the breakpoints fit in their pages
+    //
+    for (i = 0; i < Request->NumberOfPages; i++)
+    {
+        HookedPage = Request->PageStates[i].HookedPage;
+
+        if ((HookedPage != NULL ? HookedPage->CountOfBreakpoints : 0) + Request->Pages[i].NumberOfTargets > MaximumHiddenBreakpointsOnPage)
+        {
+            VmmCallbackSetLastError(DEBUGGER_ERROR_MAXIMUM_BREAKPOINT_FOR_A_SINGLE_PAGE_IS_HIT);
+            return FALSE;
+        }
+    }
+
+    //
+    // Split the large pages of the batch on all of the cores in a single pass (the
+    // split pages map the same memory, so they are not restored if the batch fails)
+    //
+    for (size_t Core = 0; Core < ProcessorsCount; Core++)
+    {
+        for (i = 0; i < Request->NumberOfLargePages; i++)
+        {
+            if (!EptSplitLargePage(g_GuestState[Core].EptPageTable, TRUE, Request->LargePages[i]))
+            {
+                LogDebugInfo("Err, could not split page for the address : 0x%llx", Request->LargePages[i]);
+                VmmCallbackSetLastError(DEBUGGER_ERROR_EPT_COULD_NOT_SPLIT_THE_LARGE_PAGE_TO_4KB_PAGES);
+                return FALSE;
+            }
+        }
+
+        for (i = 0; i < Request->NumberOfPages; i++)
+        {
+            if (Request->PageStates[i].HookedPage == NULL &&
+                EptGetPml1Entry(g_GuestState[Core].EptPageTable, Request->Pages[i].PhysicalBaseAddress) == NULL)
+            {
+                VmmCallbackSetLastError(DEBUGGER_ERROR_EPT_FAILED_TO_GET_PML1_ENTRY_OF_TARGET_ADDRESS);
+                return FALSE;
+            }
+        }
+    }
+
+    //
+    // Allocate the new hooked pages
+    //
+    for (i = 0; i < Request->NumberOfPages; i++)
+    {
+        PageState = &Request->PageStates[i];
+
+        if (PageState->HookedPage != NULL)
+        {
+            continue;
+        }
+
+        PageState->HookedPage = (EPT_HOOKED_PAGE_DETAIL *)PoolManagerRequestPool(TRACKING_HOOKED_PAGES, TRUE, sizeof(EPT_HOOKED_PAGE_DETAIL));
+
+        if (PageState->HookedPage == NULL)
+        {
+            //
+            // Free the pages that are allocated by this batch
+            //
+            while (i-- > 0)
+            {
+                if (Request->PageStates[i].IsNewPage)
+                {
+                    PoolManagerFreePool((UINT64)Request->PageStates[i].HookedPage);
+                }
+            }
+
+            VmmCallbackSetLastError(DEBUGGER_ERROR_PRE_ALLOCATED_BUFFER_IS_EMPTY);
+            return FALSE;
+        }
+
+        PageState->IsNewPage = TRUE;
+    }
+
+    //
+    // Nothing fails from here, copy the contents of the new pages (the memory layout
+    // of the target process is switched once for the batch)
+    //
+    Cr3OfCurrentProcess = SwitchToProcessMemoryLayoutByCr3(Request->ProcessCr3);
+
+    for (i = 0; i < Request->NumberOfPages; i++)
+    {
+        Page       = &Request->Pages[i];
+        HookedPage = Request->PageStates[i].HookedPage;
+
+        if (!Request->PageStates[i].IsNewPage)
+        {
+            continue;
+        }
+
+        HookedPage->IsHiddenBreakpoint                    = TRUE;
+        HookedPage->IsExecutionHook                       = TRUE;
+        HookedPage->VirtualAddress                        = Request->Targets[Page->FirstTarget].VirtualAddress;
+        HookedPage->PhysicalBaseAddress                   = Page->PhysicalBaseAddress;
+        HookedPage->PhysicalBaseAddressOfFakePageContents = (SIZE_T)VirtualAddressToPhysicalAddress(&HookedPage->FakePageContents[0]) / PAGE_SIZE;
+        HookedPage->CountOfBreakpoints                    = 0;
+
+        MemoryMapperReadMemorySafe((UINT64)PAGE_ALIGN(HookedPage->VirtualAddress), &HookedPage->FakePageContents, PAGE_SIZE);
+    }
+
+    SwitchToPreviousProcess(Cr3OfCurrentProcess);
+
+    //
+    // Set the breakpoints on the fake pages and add the new pages to the list, the new
+    // pages are not used by the EPT yet
+    //
+    for (i = 0; i < Request->NumberOfPages; i++)
+    {
+        Page       = &Request->Pages[i];
+        HookedPage = Request->PageStates[i].HookedPage;
+
+        for (UINT32 Target = Page->FirstTarget; Target < Page->FirstTarget + Page->NumberOfTargets; Target++)
+        {
+            EptHookUpdateHookPage((PVOID)Request->Targets[Target].VirtualAddress, HookedPage);
+        }
+
+        if (!Request->PageStates[i].IsNewPage)
+        {
+            continue;
+        }
+
+        //
+        // The entries of the new pages are already checked on all of the cores (above),
+        // so their regions are private and the entries are not allocated here
+        //
+        TargetPage = EptGetPml1Entry(g_GuestState[0].EptPageTable, Page->PhysicalBaseAddress);
+
+        //
+        // In execution hook, we have to make sure to unset read, write because
+        // an EPT violation should occur for these cases and we can swap the original page
+        //
+        HookedPage->OriginalEntry                = *TargetPage;
+        HookedPage->ChangedEntry                 = *TargetPage;
+        HookedPage->ChangedEntry.ReadAccess      = 0;
+        HookedPage->ChangedEntry.WriteAccess     = 0;
+        HookedPage->ChangedEntry.ExecuteAccess   = 1;
+        HookedPage->ChangedEntry.PageFrameNumber = HookedPage->PhysicalBaseAddressOfFakePageContents;
+
+        InsertHeadList(&g_EptState->HookedPagesList, &(HookedPage->PageHookList));
+    }
+
+    //
+    // Apply the entries of the new pages on each core
+    //
+    for (size_t Core = 0; Core < ProcessorsCount; Core++)
+    {
+        for (i = 0; i < Request->NumberOfPages; i++)
+        {
+            if (Request->PageStates[i].IsNewPage)
+            {
+                TargetPage         = EptGetPml1Entry(g_GuestState[Core].EptPageTable, Request->Pages[i].PhysicalBaseAddress);
+                TargetPage->AsUInt = Request->PageStates[i].HookedPage->ChangedEntry.AsUInt;
+            }
+        }
+    }
+
+    //
+    // Invalidate the EPT of the current core once for the batch
+    //
+    EptInveptSingleContext(VCpu->EptPointer.AsUInt);
+
+    return TRUE;
+}
+
+/**
+ * @brief Hook a batch of addresses with hidden breakpoints
+ * @details The targets are translated and grouped by their pages here, the exact
+ * pools of the batch are reserved, and the hooks of all of the pages are applied by
+ * a single VMCALL and a single broadcast to invalidate the EPTs (instead of a VMCALL
+ * and two broadcasts for each address). The batch is applied as a whole or not at all
+ * This function should be called from VMX non-root
+ *
+ * @param TargetAddresses The addresses of the functions or memory to be hooked
+ * @param NumberOfTargets
+ * @param ProcessId The process id to translate based on that process's cr3
+ *
+ * @return BOOLEAN Returns true if the hooks were applied or false if there was an error
+ */
+BOOLEAN
+EptHookBatch(PVOID * TargetAddresses, UINT32 NumberOfTargets, UINT32 ProcessId)
+{
+    EPT_HOOK_BATCH_REQUEST Request = {0};
+    ULONG                  ProcessorsCount;
+    UINT32                 NumberOfRegions;
+    UINT64                 PhysicalAddress;
+    PVOID                  Buffer;
+    BOOLEAN                Result = FALSE;
+
+    //
+    // Should be called from vmx non-root
+    //
+    if (VmxGetCurrentExecutionMode() == TRUE || NumberOfTargets == 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // Get number of processors
+    //
+    ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    //
+    // The targets, the pages and the large pages of the batch
+    //
+    Buffer = PlatformMemAllocateZeroedNonPagedPool(NumberOfTargets * (sizeof(HOOK_BATCH_TARGET) + sizeof(HOOK_BATCH_PAGE) + sizeof(EPT_HOOK_BATCH_PAGE_STATE) + sizeof(UINT64)));
+
+    if (Buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    Request.Targets    = (PHOOK_BATCH_TARGET)Buffer;
+    Request.Pages      = (PHOOK_BATCH_PAGE)(Request.Targets + NumberOfTargets);
+    Request.PageStates = (PEPT_HOOK_BATCH_PAGE_STATE)(Request.Pages + NumberOfTargets);
+    Request.LargePages = (UINT64 *)(Request.PageStates + NumberOfTargets);
+    Request.ProcessCr3 = LayoutGetCr3ByProcessId(ProcessId);
+
+    for (UINT32 i = 0; i < NumberOfTargets; i++)
+    {
+        PhysicalAddress = VirtualAddressToPhysicalAddressByProcessId(TargetAddresses[i], ProcessId);
+
+        if (!PhysicalAddress)
+        {
+            VmmCallbackSetLastError(DEBUGGER_ERROR_INVALID_ADDRESS);
+            goto Cleanup;
+        }
+
+        if (PhysicalAddress >= SIZE_512_GB)
+        {
+            VmmCallbackSetLastError(DEBUGGER_ERROR_CANNOT_PUT_EPT_HOOKS_ON_PHYSICAL_ADDRESS_ABOVE_512_GB);
+            goto Cleanup;
+        }
+
+        Request.Targets[i].VirtualAddress  = (UINT64)TargetAddresses[i];
+        Request.Targets[i].PhysicalAddress = PhysicalAddress;
+    }
+
+    Request.NumberOfTargets = HookBatchSortTargets(Request.Targets, NumberOfTargets);
+    Request.NumberOfPages   = HookBatchGroupByPage(Request.Targets, Request.NumberOfTargets, Request.Pages);
+
+    //
+    // Reserve the private tables of the 1GB regions of the batch, only the regions that are
+    // not private yet need them (the buffer of the large pages is reused)
+    //
+    NumberOfRegions = HookBatchGetAlignedPages(Request.Pages, Request.NumberOfPages, HOOK_BATCH_REGION_SIZE, Request.LargePages);
+
+    for (UINT32 i = 0; i < NumberOfRegions; i++)
+    {
+        EptReservePrivatePageTablesOfRegion(Request.LargePages[i]);
+    }
+
+    Request.NumberOfLargePages = HookBatchGetAlignedPages(Request.Pages, Request.NumberOfPages, HOOK_BATCH_LARGE_PAGE_SIZE, Request.LargePages);
+
+    //
+    // Reserve the pools of the batch (the hooked pages and the split pages of each core)
+    // and allocate them now
+    //
+    PoolManagerRequestAllocation(sizeof(EPT_HOOKED_PAGE_DETAIL), Request.NumberOfPages, TRACKING_HOOKED_PAGES);
+    PoolManagerRequestAllocation(sizeof(VMM_EPT_DYNAMIC_SPLIT), Request.NumberOfLargePages * ProcessorsCount, SPLIT_2MB_PAGING_TO_4KB_PAGE);
+
+    if (!PoolManagerCheckAndPerformAllocationAndDeallocation())
+    {
+        VmmCallbackSetLastError(DEBUGGER_ERROR_PRE_ALLOCATED_BUFFER_IS_EMPTY);
+        goto Cleanup;
+    }
+
+    //
+    // Broadcast to all cores to enable vm-exit for breakpoints (exception bitmaps)
+    //
+    BroadcastEnableBreakpointExitingOnExceptionBitmapAllCores();
+
+    if (AsmVmxVmcall(VMCALL_SET_HIDDEN_CC_BREAKPOINTS_BATCH, (UINT64)&Request, NULL64_ZERO, NULL64_ZERO) == STATUS_SUCCESS)
+    {
+        LogDebugInfo("Hidden breakpoint hooks of the batch applied from VMX Root Mode");
+
+        //
+        // Now we have to notify all the core to invalidate their EPT (once for the batch)
+        //
+        BroadcastNotifyAllToInvalidateEptAllCores();
+
+        Result = TRUE;
+    }
+    else if (EptHookGetCountOfEpthooks(FALSE) == 0)
+    {
+        //
+        // Nothing is applied, the breakpoints vm-exits are not needed
+        //
+        BroadcastDisableBreakpointExitingOnExceptionBitmapAllCores();
+    }
+
+Cleanup:
+    PlatformMemFreePool(Buffer);
+
+    return Result;
+}
+
 /**
  * @brief Remove and Invalidate Hook in TLB (Hidden Detours and if counter of hidden breakpoint is zero)
  * @warning This function won't remove entries from LIST_ENTRY,
@@ -738,7 +1106,54 @@ EptHookRestoreAllHooksToOriginalEntry(VIRTUAL_MACHINE_STATE * VCpu)
         //
         // Apply the hook to EPT
         //
-        TargetPage->AsUInt = HookedEntry->OriginalEntry.AsUInt;
+        if (TargetPage != NULL)
+        {
+            TargetPage->AsUInt = HookedEntry->OriginalEntry.AsUInt;
+        }
+    }
+
+    //
+    // Invalidate EPT Cache
+    //
+    EptInveptSingleContext(VCpu->EptPointer.AsUInt);
+}
+
+/**
+ * @brief Restore the entries of the hooked pages of a batch and invalidate TLB once
+ * @warning This function won't remove entries from LIST_ENTRY, use EptHookUnHookBatch instead
+ *
+ * @param VCpu The virtual processor's state
+ * @param UnhookingDetails The removed pages of the batch
+ *
+ * @return VOID
+ */
+VOID
+EptHookRestoreBatchToOriginalEntries(VIRTUAL_MACHINE_STATE * VCpu, PEPT_HOOK_BATCH_UNHOOKING_DETAILS UnhookingDetails)
+{
+    PEPT_PML1_ENTRY         TargetPage;
+    PEPT_HOOKED_PAGE_DETAIL HookedPage;
+
+    //
+    // Should be called from vmx-root, for calling from vmx non-root use the corresponding VMCALL
+    //
+    if (VmxGetCurrentExecutionMode() == FALSE)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < UnhookingDetails->NumberOfHookedPages; i++)
+    {
+        HookedPage = UnhookingDetails->HookedPages[i];
+
+        //
+        // Pointer to the page entry in the page table
+        //
+        TargetPage = EptGetPml1Entry(VCpu->EptPageTable, HookedPage->PhysicalBaseAddress);
+
+        if (TargetPage != NULL)
+        {
+            TargetPage->AsUInt = HookedPage->OriginalEntry.AsUInt;
+        }
     }
 
     //
@@ -853,6 +1268,7 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
                          PVOID                   HookFunction)
 {
     PHIDDEN_HOOKS_DETOUR_DETAILS DetourHookDetails;
+    DETOUR_HASH_RECORD           DetourRecord;
     SIZE_T                       SizeOfHookedInstructions;
     SIZE_T                       OffsetIntoPage;
     CR3_TYPE                     Cr3OfCurrentProcess;
@@ -971,6 +1387,17 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
     //
     InsertHeadList(&g_EptHook2sDetourListHead, &(DetourHookDetails->OtherHooksList));
 
+    //
+    // Precompute the details that the handler of the detours needs, so it finds them
+    // by the hash instead of translating the address and walking the list (if the
+    // hash is full, the handler still finds the return address in the list)
+    //
+    DetourRecord.PhysicalAddress = Hook->PhysicalBaseAddress + OffsetIntoPage;
+    DetourRecord.ReturnAddress   = (UINT64)Hook->Trampoline;
+    DetourRecord.HookingTag      = Hook->HookingTag;
+
+    DetourHashInsert(&g_EptState->EptHook2sDetourHash, (UINT64)TargetFunction, &DetourRecord);
+
     //
     // Write the absolute jump to our shadow page memory to jump to our hook
     //
@@ -1013,6 +1440,7 @@ EptHookPerformPageHookMonitorAndInlineHook(VIRTUAL_MACHINE_STATE * VCpu,
     BOOLEAN                 UnsetRead     = FALSE;
     BOOLEAN                 UnsetWrite    = FALSE;
     BOOLEAN                 EptHiddenHook = FALSE;
+    BOOLEAN                 SubPageWrites = FALSE;
 
     UnsetRead     = (PageHookMask & PAGE_ATTRIB_READ) ? TRUE : FALSE;
     UnsetWrite    = (PageHookMask & PAGE_ATTRIB_WRITE) ? TRUE : FALSE;
@@ -1250,6 +1678,16 @@ EptHookPerformPageHookMonitorAndInlineHook(VIRTUAL_MACHINE_STATE * VCpu,
             return FALSE;
         }
     }
+    else if (UnsetWrite && !UnsetRead)
+    {
+        //
+        // For the write monitors, the writes to the sub-pages (128 bytes) that are out of
+        // the monitored range won't cause EPT violations (if the processor supports SPP)
+        //
+        SubPageWrites = SubPageWritePermissionsProtectRange(PhysicalBaseAddress,
+                                                            HookedPage->StartOfTargetPhysicalAddress,
+                                                            HookedPage->EndOfTargetPhysicalAddress);
+    }
 
     for (size_t i = 0; i < ProcessorsCount; i++)
     {
@@ -1317,6 +1755,12 @@ EptHookPerformPageHookMonitorAndInlineHook(VIRTUAL_MACHINE_STATE * VCpu,
         else
             ChangedEntry.ExecuteAccess = 1;
 
+        //
+        // The processor checks the SPP vector of the page as the write access is 0
+        //
+        if (SubPageWrites)
+            ChangedEntry.AsUInt |= SPP_EPT_ENTRY_FLAG;
+
         //
         // If it's Execution hook then we have to set extra fields
         //
@@ -1853,6 +2297,11 @@ EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(UINT64 Address)
     {
         if (CurrentHookedDetails->HookedFunctionAddress == (PVOID)Address)
         {
+            //
+            // Remove its precomputed details from the hash of the detours
+            //
+            DetourHashRemove(&g_EptState->EptHook2sDetourHash, Address);
+
             //
             // We found the address, we should remove it and add it for
             // future deallocation
@@ -1984,7 +2433,8 @@ EptHookHandleMonitorTrapFlag(VIRTUAL_MACHINE_STATE * VCpu)
 {
     PVOID TargetPage;
     //
-    // Pointer to the page entry in the page table
+    // Pointer to the page entry in the page table (the region of a hooked page
+    // is already private, so the entry is not allocated)
     //
     TargetPage = EptGetPml1Entry(VCpu->EptPageTable, VCpu->MtfEptHookRestorePoint->PhysicalBaseAddress);
 
@@ -1996,43 +2446,310 @@ EptHookHandleMonitorTrapFlag(VIRTUAL_MACHINE_STATE * VCpu)
                                VCpu->MtfEptHookRestorePoint->ChangedEntry,
                                InveptSingleContext);
 
+    //
+    // Check to trigger the post event
+    //
+    EptHookDispatchPostEvent(VCpu, VCpu->MtfEptHookRestorePoint);
+
+    //
+    // Check for user-mode attaching mechanisms and callback
+    // (we call it here, because this callback might change the EPTP entries and invalidate EPTP)
+    //
+    VmmCallbackRestoreEptState(VCpu->CoreId);
+}
+
+/**
+ * @brief Trigger the post events of a hooked page after the access is performed
+ *
+ * @param VCpu The virtual processor's state
+ * @param HookedEntry The entry of the hooked page
+ * @return VOID
+ */
+VOID
+EptHookDispatchPostEvent(VIRTUAL_MACHINE_STATE * VCpu, EPT_HOOKED_PAGE_DETAIL * HookedEntry)
+{
     //
     // Check to trigger the post event (for events relating the !monitor command
     // and the emulation hardware debug registers)
     //
-    if (VCpu->MtfEptHookRestorePoint->IsPostEventTriggerAllowed)
+    if (HookedEntry->IsPostEventTriggerAllowed)
     {
-        if (VCpu->MtfEptHookRestorePoint->LastViolation == EPT_HOOKED_LAST_VIOLATION_READ)
+        if (HookedEntry->LastViolation == EPT_HOOKED_LAST_VIOLATION_READ)
         {
             //
             // This is a "read" hook
             //
             DispatchEventHiddenHookPageReadWriteExecReadPostEvent(VCpu,
-                                                                  &VCpu->MtfEptHookRestorePoint->LastContextState);
+                                                                  &HookedEntry->LastContextState);
         }
-        else if (VCpu->MtfEptHookRestorePoint->LastViolation == EPT_HOOKED_LAST_VIOLATION_WRITE)
+        else if (HookedEntry->LastViolation == EPT_HOOKED_LAST_VIOLATION_WRITE)
         {
             //
             // This is a "write" hook
             //
             DispatchEventHiddenHookPageReadWriteExecWritePostEvent(VCpu,
-                                                                   &VCpu->MtfEptHookRestorePoint->LastContextState);
+                                                                   &HookedEntry->LastContextState);
         }
-        else if (VCpu->MtfEptHookRestorePoint->LastViolation == EPT_HOOKED_LAST_VIOLATION_EXEC)
+        else if (HookedEntry->LastViolation == EPT_HOOKED_LAST_VIOLATION_EXEC)
         {
             //
             // This is a "execute" hook
             //
             DispatchEventHiddenHookPageReadWriteExecExecutePostEvent(VCpu,
-                                                                     &VCpu->MtfEptHookRestorePoint->LastContextState);
+                                                                     &HookedEntry->LastContextState);
         }
     }
+}
+
+/**
+ * @brief Get the physical address of an access of the emulator
+ * @details The emulator is only allowed to access the page of the trapped
+ * access, the other pages might be hooked too or might not be mapped
+ *
+ * @param Context The page of the trapped access
+ * @param Address The linear address of the access
+ * @param Size The size of the access
+ * @param PhysicalAddress The physical address of the access
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EptHookEmulatorGetPhysicalAddress(PEPT_HOOK_EMULATION_CONTEXT Context,
+                                  UINT64                      Address,
+                                  UINT32                      Size,
+                                  UINT64 *                    PhysicalAddress)
+{
+    if (Size == 0 ||
+        (UINT64)PAGE_ALIGN((PVOID)Address) != Context->GuestLinearPage ||
+        (UINT64)PAGE_ALIGN((PVOID)(Address + Size - 1)) != Context->GuestLinearPage)
+    {
+        return FALSE;
+    }
+
+    *PhysicalAddress = Context->GuestPhysicalPage + (Address - Context->GuestLinearPage);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read callback of the emulator
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookEmulatorReadMemory(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context)
+{
+    UINT64 PhysicalAddress;
+
+    if (!EptHookEmulatorGetPhysicalAddress((PEPT_HOOK_EMULATION_CONTEXT)Context, Address, Size, &PhysicalAddress))
+    {
+        return FALSE;
+    }
+
+    return MemoryMapperReadMemorySafeByPhysicalAddress(PhysicalAddress, (UINT64)Buffer, Size);
+}
+
+/**
+ * @brief Write callback of the emulator
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookEmulatorWriteMemory(UINT64 Address, const VOID * Buffer, UINT32 Size, PVOID Context)
+{
+    UINT64 PhysicalAddress;
+
+    if (!EptHookEmulatorGetPhysicalAddress((PEPT_HOOK_EMULATION_CONTEXT)Context, Address, Size, &PhysicalAddress))
+    {
+        return FALSE;
+    }
+
+    return MemoryMapperWriteMemorySafeByPhysicalAddress(PhysicalAddress, (UINT64)Buffer, Size);
+}
+
+/**
+ * @brief Compare-exchange callback of the emulator (for the locked instructions)
+ *
+ * @param Address
+ * @param Size
+ * @param Comparand
+ * @param NewValue
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookEmulatorCompareExchangeMemory(UINT64 Address, UINT32 Size, UINT64 * Comparand, UINT64 NewValue, PVOID Context)
+{
+    UINT64 PhysicalAddress;
+
+    if (!EptHookEmulatorGetPhysicalAddress((PEPT_HOOK_EMULATION_CONTEXT)Context, Address, Size, &PhysicalAddress))
+    {
+        return FALSE;
+    }
+
+    return MemoryMapperCompareExchangeSafeByPhysicalAddress(PhysicalAddress, Size, Comparand, NewValue);
+}
+
+/**
+ * @brief Emulate the trapped memory access instead of stepping it with MTF
+ * @details The common data accesses of the monitor hooks are emulated in
+ * vmx-root mode, so the hooked entry is not restored, and there is no need
+ * to the MTF vm-exit of the next instruction; the instructions that are not
+ * supported by the emulator (and the accesses that touch the other pages)
+ * return FALSE and they are stepped by the MTF as before
+ *
+ * @param VCpu The virtual processor's state
+ * @param HookedEntry The entry of the hooked page
+ * @param ViolationQualification The exit qualification of the EPT violation
+ * @param GuestPhysicalAddr The guest physical address of the access
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookEmulateMemoryAccess(VIRTUAL_MACHINE_STATE *              VCpu,
+                           EPT_HOOKED_PAGE_DETAIL *             HookedEntry,
+                           VMX_EXIT_QUALIFICATION_EPT_VIOLATION ViolationQualification,
+                           UINT64                               GuestPhysicalAddr)
+{
+    MEMORY_ACCESS_EMULATOR_INSTRUCTION Instruction;
+    MEMORY_ACCESS_EMULATOR_STATE       State;
+    MEMORY_ACCESS_EMULATOR_STATUS      Status;
+    EPT_HOOK_EMULATION_CONTEXT         EmulationContext;
+    UINT32                             ProcBasedVmExecControls = 0;
+    UINT64                             GuestLinearAddress      = 0;
+    UINT64                             SizeOfSafeBufferToRead  = 0;
+    UINT64                             PreviousRsp;
+    RFLAGS                             Rflags                                = {0};
+    BYTE                               InstructionBuffer[MAXIMUM_INSTR_SIZE] = {0};
+
+    //
+    // Only the data accesses are emulated, the execution hooks and the hidden
+    // breakpoints have their own fake pages, and the shadowed MMIO pages are
+    // not in the memory
+    //
+    if (ViolationQualification.ExecuteAccess ||
+        !ViolationQualification.ValidGuestLinearAddress ||
+        !ViolationQualification.CausedByTranslation ||
+        HookedEntry->IsExecutionHook ||
+        HookedEntry->IsHiddenBreakpoint ||
+        HookedEntry->IsMmioShadowing)
+    {
+        return FALSE;
+    }
+
+    //
+    // The stepping of the instruction (the trap flag or the instrumentation
+    // step-in) needs the MTF, and the emulator only decodes 64-bit code
+    //
+    Rflags.AsUInt = HvGetRflags();
+    VmxVmread32P(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &ProcBasedVmExecControls);
+
+    if (Rflags.TrapFlag ||
+        (ProcBasedVmExecControls & IA32_VMX_PROCBASED_CTLS_MONITOR_TRAP_FLAG_FLAG) ||
+        VCpu->RegisterBreakOnMtf ||
+        CommonIsGuestOnUsermode32Bit())
+    {
+        return FALSE;
+    }
+
+    //
+    // The pre-events might change the RIP (or skip the instruction)
+    //
+    if (HvGetRip() != VCpu->LastVmexitRip)
+    {
+        return FALSE;
+    }
+
+    //
+    // Read and decode the instruction
+    //
+    SizeOfSafeBufferToRead = CheckAddressMaximumInstructionLength((PVOID)VCpu->LastVmexitRip);
+
+    if (SizeOfSafeBufferToRead == 0 ||
+        !MemoryMapperReadMemorySafeOnTargetProcess(VCpu->LastVmexitRip, InstructionBuffer, SizeOfSafeBufferToRead) ||
+        !MemoryAccessEmulatorDecode(InstructionBuffer, (UINT32)SizeOfSafeBufferToRead, &Instruction))
+    {
+        return FALSE;
+    }
+
+    //
+    // The writes are only emulated if the processor reported a write, so the
+    // write permission of the guest paging is already checked
+    //
+    if (MemoryAccessEmulatorIsWriting(&Instruction) && !ViolationQualification.WriteAccess)
+    {
+        return FALSE;
+    }
+
+    __vmx_vmread(VMCS_EXIT_GUEST_LINEAR_ADDRESS, &GuestLinearAddress);
+
+    EmulationContext.GuestLinearPage   = (UINT64)PAGE_ALIGN((PVOID)GuestLinearAddress);
+    EmulationContext.GuestPhysicalPage = (UINT64)PAGE_ALIGN((PVOID)GuestPhysicalAddr);
+
+    PreviousRsp = VCpu->Regs->rsp;
+
+    State.Regs            = VCpu->Regs;
+    State.Rip             = VCpu->LastVmexitRip;
+    State.Rflags          = Rflags.AsUInt;
+    State.Read            = EptHookEmulatorReadMemory;
+    State.Write           = EptHookEmulatorWriteMemory;
+    State.CompareExchange = EptHookEmulatorCompareExchangeMemory;
+    State.Context         = &EmulationContext;
+
+    __vmx_vmread(VMCS_GUEST_FS_BASE, &State.FsBase);
+    __vmx_vmread(VMCS_GUEST_GS_BASE, &State.GsBase);
+
+    Status = MemoryAccessEmulatorExecute(&Instruction, &State);
+
+    if (Status != MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED && Status != MEMORY_ACCESS_EMULATOR_STATUS_PARTIAL)
+    {
+        //
+        // Nothing is changed, the MTF steps the instruction
+        //
+        return FALSE;
+    }
+
+    //
+    // Apply the state of the guest, the RSP is not restored from the
+    // registers of the guest on vm-entry
+    //
+    HvSetRip(State.Rip);
+    HvSetRflags(State.Rflags);
+
+    if (VCpu->Regs->rsp != PreviousRsp)
+    {
+        SetGuestRSP(VCpu->Regs->rsp);
+    }
+
+    if (Status == MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED)
+    {
+        //
+        // The blocking by STI and MOV SS ends after the instruction
+        //
+        HvSetInterruptibilityState(HvClearSteppingBits(HvGetInterruptibilityState()));
+    }
+
+    //
+    // The access is performed, trigger the post event
+    //
+    EptHookDispatchPostEvent(VCpu, HookedEntry);
 
     //
     // Check for user-mode attaching mechanisms and callback
-    // (we call it here, because this callback might change the EPTP entries and invalidate EPTP)
     //
     VmmCallbackRestoreEptState(VCpu->CoreId);
+
+    return TRUE;
 }
 
 /**
@@ -2492,6 +3209,145 @@ EptHookUnHookAll()
     }
 }
 
+/**
+ * @brief Remove a batch of hidden breakpoints
+ * @details The list of the hooked pages is walked once (the addresses of the batch are
+ * sorted), the breakpoints are removed from the pages that keep other breakpoints, and
+ * the entries of the pages without breakpoints are restored on all of the cores by a
+ * single broadcast (instead of a broadcast for each page)
+ * Should be called from Vmx Non-root
+ *
+ * @param VirtualAddresses The addresses of the hidden breakpoints
+ * @param NumberOfAddresses
+ *
+ * @return BOOLEAN If at least one breakpoint is removed it returns true, otherwise false
+ */
+BOOLEAN
+EptHookUnHookBatch(UINT64 * VirtualAddresses, UINT32 NumberOfAddresses)
+{
+    EPT_HOOK_BATCH_UNHOOKING_DETAILS  UnhookingDetails = {0};
+    EPT_SINGLE_HOOK_UNHOOKING_DETAILS TargetUnhookingDetails; // not used
+    PHOOK_BATCH_TARGET                Targets;
+    UINT32                            NumberOfTargets;
+    UINT32                            CountOfMatches;
+    BOOLEAN                           AtLeastOneUnhooked = FALSE;
+
+    //
+    // Should be called from vmx non-root
+    //
+    if (VmxGetCurrentExecutionMode() == TRUE || NumberOfAddresses == 0)
+    {
+        return FALSE;
+    }
+
+    Targets = (PHOOK_BATCH_TARGET)PlatformMemAllocateZeroedNonPagedPool(NumberOfAddresses * (sizeof(HOOK_BATCH_TARGET) + sizeof(PEPT_HOOKED_PAGE_DETAIL)));
+
+    if (Targets == NULL)
+    {
+        return FALSE;
+    }
+
+    UnhookingDetails.HookedPages = (EPT_HOOKED_PAGE_DETAIL **)(Targets + NumberOfAddresses);
+
+    //
+    // The hidden breakpoints are found by their virtual addresses
+    //
+    for (UINT32 i = 0; i < NumberOfAddresses; i++)
+    {
+        Targets[i].VirtualAddress = VirtualAddresses[i];
+    }
+
+    NumberOfTargets = HookBatchSortTargets(Targets, NumberOfAddresses);
+
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, CurrEntity)
+    {
+        if (!CurrEntity->IsHiddenBreakpoint)
+        {
+            continue;
+        }
+
+        CountOfMatches = 0;
+
+        for (size_t i = 0; i < CurrEntity->CountOfBreakpoints; i++)
+        {
+            if (HookBatchFindTarget(Targets, NumberOfTargets, NULL64_ZERO, CurrEntity->BreakpointAddresses[i]))
+            {
+                CountOfMatches++;
+            }
+        }
+
+        if (CountOfMatches == 0)
+        {
+            continue;
+        }
+
+        AtLeastOneUnhooked = TRUE;
+
+        if (CountOfMatches == CurrEntity->CountOfBreakpoints)
+        {
+            //
+            // The page is removed once its entries are restored on all of the cores
+            //
+            UnhookingDetails.HookedPages[UnhookingDetails.NumberOfHookedPages++] = CurrEntity;
+            continue;
+        }
+
+        //
+        // The page keeps other breakpoints, so the breakpoints are removed from the fake
+        // page (the previous breakpoints are not matched, so the first match is at i)
+        //
+        for (size_t i = 0; i < CurrEntity->CountOfBreakpoints;)
+        {
+            if (HookBatchFindTarget(Targets, NumberOfTargets, NULL64_ZERO, CurrEntity->BreakpointAddresses[i]))
+            {
+                EptHookUnHookSingleAddressHiddenBreakpoint(CurrEntity, CurrEntity->BreakpointAddresses[i], FALSE, &TargetUnhookingDetails);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    if (UnhookingDetails.NumberOfHookedPages != 0)
+    {
+        //
+        // Remove the hooks entirely on all cores (a single broadcast)
+        //
+        KeGenericCallDpc(DpcRoutineRemoveHooksBatchAndInvalidateOnAllCores, &UnhookingDetails);
+
+        for (UINT32 i = 0; i < UnhookingDetails.NumberOfHookedPages; i++)
+        {
+            //
+            // remove the entry from the list
+            //
+            RemoveEntryList(&UnhookingDetails.HookedPages[i]->PageHookList);
+
+            //
+            // we add the hooked entry to the list
+            // of pools that will be deallocated on next IOCTL
+            //
+            if (!PoolManagerFreePool((UINT64)UnhookingDetails.HookedPages[i]))
+            {
+                LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
+            }
+        }
+
+        //
+        // Did not find any entry, let's disable the breakpoints vm-exits
+        // on exception bitmaps
+        //
+        if (EptHookGetCountOfEpthooks(FALSE) == 0)
+        {
+            BroadcastDisableBreakpointExitingOnExceptionBitmapAllCores();
+        }
+    }
+
+    PlatformMemFreePool(Targets);
+
+    return AtLeastOneUnhooked;
+}
+
 /**
  * @brief routines to generally handle breakpoint hit for detour
  * @param Regs
@@ -2502,8 +3358,10 @@ EptHookUnHookAll()
 PVOID
 EptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PVOID CalledFrom)
 {
-    PLIST_ENTRY       TempList    = 0;
-    EPT_HOOKS_CONTEXT TempContext = {0};
+    PLIST_ENTRY        TempList     = 0;
+    EPT_HOOKS_CONTEXT  TempContext  = {0};
+    DETOUR_HASH_RECORD DetourRecord = {0};
+    BOOLEAN            IsInHash;
 
     //
     // The RSP register is the at the RCX and we just added (reverse by stack) to it's
@@ -2523,11 +3381,26 @@ EptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PVOID CalledFrom)
     //        Regs->r9);
     //
 
+    //
+    // Find the precomputed details of the detour (the physical address, the
+    // trampoline, and the tag) by the address of the hooked function
+    //
+    IsInHash = DetourHashLookup(&g_EptState->EptHook2sDetourHash, (UINT64)CalledFrom, &DetourRecord);
+
     //
     // Create temporary context
     //
-    TempContext.VirtualAddress  = (UINT64)CalledFrom;
-    TempContext.PhysicalAddress = VirtualAddressToPhysicalAddress(CalledFrom);
+    TempContext.VirtualAddress = (UINT64)CalledFrom;
+
+    if (IsInHash)
+    {
+        TempContext.PhysicalAddress = DetourRecord.PhysicalAddress;
+        TempContext.HookingTag      = DetourRecord.HookingTag;
+    }
+    else
+    {
+        TempContext.PhysicalAddress = VirtualAddressToPhysicalAddress(CalledFrom);
+    }
 
     //
     // Create a temporary VCpu
@@ -2545,9 +3418,15 @@ EptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PVOID CalledFrom)
     //
     DispatchEventHiddenHookExecDetours(VCpu, &TempContext);
 
+    if (IsInHash)
+    {
+        return (PVOID)DetourRecord.ReturnAddress;
+    }
+
     //
-    // Iterate through the list of hooked pages details to find
-    // and return where want to jump after this functions
+    // The detour is not in the hash (it's full or the entry is changed at
+    // the same time), iterate through the list of hooked pages details to
+    // find and return where want to jump after this functions
     //
     TempList = &g_EptHook2sDetourListHead;
 
@@ -274,23 +274,9 @@ ExecTrapEnableExecuteOnlyPages(PVMM_EPT_PAGE_TABLE EptTable)
     }
 
     //
-    // Set execute access for PML3s
+    // Set execute access for PML3s, PML2s and PML1s
     //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        EptTable->PML3[i].UserModeExecute = TRUE;
-    }
-
-    //
-    // Set execute access for PML2s
-    //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        for (size_t j = 0; j < VMM_EPT_PML2E_COUNT; j++)
-        {
-            EptTable->PML2[i][j].UserModeExecute = TRUE;
-        }
-    }
+    EptAllowUserModeExecution(EptTable);
 
     //
     // *** disallow read or write for certain memory only (not MMIO) EPTP pages ***
@@ -308,7 +294,17 @@ ExecTrapEnableExecuteOnlyPages(PVMM_EPT_PAGE_TABLE EptTable)
                 // Get the target entry in EPT table (every entry is 2-MB granularity)
                 //
                 PEPT_PML2_ENTRY EptEntry = EptGetPml2Entry(EptTable, CurrentAddress);
-                EptEntry->WriteAccess    = FALSE;
+
+                if (EptEntry == NULL)
+                {
+                    //
+                    // The private tables of the region are not allocated
+                    //
+                    LogError("Err, failed to get the PML2 entry of the address : 0x%llx", CurrentAddress);
+                    return FALSE;
+                }
+
+                EptEntry->WriteAccess = FALSE;
 
                 //
                 // Move to the new address
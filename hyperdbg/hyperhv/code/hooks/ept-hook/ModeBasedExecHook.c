@@ -34,23 +34,9 @@ ModeBasedExecHookDisableUserModeExecution(PVMM_EPT_PAGE_TABLE EptTable)
     }
 
     //
-    // Set execute access for PML3s
+    // Set execute access for PML3s, PML2s and PML1s
     //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        EptTable->PML3[i].UserModeExecute = TRUE;
-    }
-
-    //
-    // Set execute access for PML2s
-    //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        for (size_t j = 0; j < VMM_EPT_PML2E_COUNT; j++)
-        {
-            EptTable->PML2[i][j].UserModeExecute = TRUE;
-        }
-    }
+    EptAllowUserModeExecution(EptTable);
 
     return TRUE;
 }
@@ -88,23 +74,9 @@ ModeBasedExecHookDisableKernelModeExecution(PVMM_EPT_PAGE_TABLE EptTable)
     }
 
     //
-    // Set execute access for PML3s
+    // Set execute access for PML3s, PML2s and PML1s
     //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        EptTable->PML3[i].UserModeExecute = TRUE;
-    }
-
-    //
-    // Set execute access for PML2s
-    //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        for (size_t j = 0; j < VMM_EPT_PML2E_COUNT; j++)
-        {
-            EptTable->PML2[i][j].UserModeExecute = TRUE;
-        }
-    }
+    EptAllowUserModeExecution(EptTable);
 
     return TRUE;
 }
@@ -118,8 +90,6 @@ ModeBasedExecHookDisableKernelModeExecution(PVMM_EPT_PAGE_TABLE EptTable)
 BOOLEAN
 ModeBasedExecHookEnableUsermodeExecution(PVMM_EPT_PAGE_TABLE EptTable)
 {
-    EPT_PML1_ENTRY Pml1Entries[VMM_EPT_PML1E_COUNT];
-
     //
     // Set execute access for PML4s
     //
@@ -132,49 +102,9 @@ ModeBasedExecHookEnableUsermodeExecution(PVMM_EPT_PAGE_TABLE EptTable)
     }
 
     //
-    // Set execute access for PML3s
-    //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        EptTable->PML3[i].UserModeExecute = TRUE;
-    }
-
-    //
-    // Set execute access for PML2s
+    // Set execute access for PML3s, PML2s and PML1s
     //
-    for (size_t i = 0; i < VMM_EPT_PML3E_COUNT; i++)
-    {
-        for (size_t j = 0; j < VMM_EPT_PML2E_COUNT; j++)
-        {
-            EptTable->PML2[i][j].UserModeExecute = TRUE;
-
-            //
-            // If the PML2 entry is not a large page, we should set execute access for PML1s
-            // It usually happens when the PML2 entry is not a large page and is previously
-            // used for an EPT hook, so, it has PML1 entries
-            //
-            if (!EptTable->PML2[i][j].LargePage)
-            {
-                //
-                // Shift to the left to get the PFN
-                //
-                MemoryMapperReadMemorySafeByPhysicalAddress(EptTable->PML2[i][j].PageFrameNumber << 12, (UINT64)Pml1Entries, PAGE_SIZE);
-
-                //
-                // Set execute access for PML1s
-                //
-                for (size_t k = 0; k < VMM_EPT_PML1E_COUNT; k++)
-                {
-                    Pml1Entries[k].UserModeExecute = TRUE;
-                }
-
-                //
-                // Write back the PML1 entries to the EPT page table
-                //
-                MemoryMapperWriteMemorySafeByPhysicalAddress(EptTable->PML2[i][j].PageFrameNumber << 12, (UINT64)Pml1Entries, PAGE_SIZE);
-            }
-        }
-    }
+    EptAllowUserModeExecution(EptTable);
 
     return TRUE;
 }
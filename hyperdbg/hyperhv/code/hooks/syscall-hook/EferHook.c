@@ -67,6 +67,11 @@ SyscallHookConfigureEFER(VIRTUAL_MACHINE_STATE * VCpu, BOOLEAN EnableEFERSyscall
         //
         __vmx_vmwrite(VMCS_GUEST_EFER, MsrValue.AsUInt);
 
+        //
+        // The sites that are cached by the previous hooks might be changed
+        //
+        SyscallHookInvalidateSiteCaches();
+
         //
         // also, we have to set exception bitmap to cause vm-exit on #UDs
         //
@@ -266,9 +271,12 @@ _Use_decl_annotations_
 BOOLEAN
 SyscallHookHandleUD(VIRTUAL_MACHINE_STATE * VCpu)
 {
-    CR3_TYPE GuestCr3;
-    UINT64   OriginalCr3;
-    UINT64   Rip;
+    CR3_TYPE                GuestCr3;
+    UINT64                  OriginalCr3;
+    UINT64                  Rip;
+    UINT32                  Generation;
+    SYSCALL_SITE_CACHE_KIND Kind;
+    BOOLEAN                 IsCachedSiteRead = FALSE;
 
     //
     // Reading guest's RIP
@@ -305,6 +313,30 @@ SyscallHookHandleUD(VIRTUAL_MACHINE_STATE * VCpu)
         //
         GuestCr3.Flags = LayoutGetCurrentProcessCr3().Flags;
 
+        //
+        // Check whether the site is already verified. The code of the kernel
+        // image is not changed, so its sites are emulated without reading the
+        // memory, but other sites might be changed by the guest (or the CR3
+        // might be reused by another process), so their instruction is read
+        // again and only the walk of the page-table is skipped
+        //
+        Generation = (UINT32)g_SyscallSiteCacheGeneration;
+        Kind       = SyscallSiteCacheLookup(&VCpu->SyscallSiteCache, GuestCr3.Flags, Rip, Generation);
+
+        if (Kind != SYSCALL_SITE_CACHE_KIND_NONE &&
+            Rip >= g_SyscallSiteCacheKernelImageBase &&
+            Rip < g_SyscallSiteCacheKernelImageEnd)
+        {
+            if (Kind == SYSCALL_SITE_CACHE_KIND_SYSCALL)
+            {
+                goto EmulateSYSCALL;
+            }
+            else
+            {
+                goto EmulateSYSRET;
+            }
+        }
+
         //
         // No, longer needs to be checked because we're sticking to system process
         // and we have to change the cr3
@@ -320,7 +352,24 @@ SyscallHookHandleUD(VIRTUAL_MACHINE_STATE * VCpu)
         //
         UCHAR InstructionBuffer[3] = {0};
 
-        if (MemoryMapperCheckIfPageIsPresentByCr3((PVOID)Rip, GuestCr3))
+        if (Kind != SYSCALL_SITE_CACHE_KIND_NONE)
+        {
+            //
+            // The instruction of the site is just fetched by the processor (that's
+            // why the #UD is caused), so only its bytes are read
+            //
+            IsCachedSiteRead = MemoryMapperReadMemorySafe(Rip,
+                                                          InstructionBuffer,
+                                                          Kind == SYSCALL_SITE_CACHE_KIND_SYSCALL ? 2 : 3);
+        }
+
+        if (IsCachedSiteRead)
+        {
+            //
+            // The instruction is checked below
+            //
+        }
+        else if (MemoryMapperCheckIfPageIsPresentByCr3((PVOID)Rip, GuestCr3))
         {
             //
             // The page is safe to read (present)
@@ -331,6 +380,8 @@ SyscallHookHandleUD(VIRTUAL_MACHINE_STATE * VCpu)
         }
         else
         {
+            __writecr3(OriginalCr3);
+
             //
             // The page is not present, we have to inject a #PF
             //
@@ -354,9 +405,19 @@ SyscallHookHandleUD(VIRTUAL_MACHINE_STATE * VCpu)
 
         __writecr3(OriginalCr3);
 
+        //
+        // The site is cached unless the memory is changed while it's read
+        //
+        Generation = (UINT32)g_SyscallSiteCacheGeneration;
+
         if (InstructionBuffer[0] == 0x0F &&
             InstructionBuffer[1] == 0x05)
         {
+            if (Kind != SYSCALL_SITE_CACHE_KIND_SYSCALL)
+            {
+                SyscallSiteCacheInsert(&VCpu->SyscallSiteCache, GuestCr3.Flags, Rip, SYSCALL_SITE_CACHE_KIND_SYSCALL, Generation);
+            }
+
             goto EmulateSYSCALL;
         }
 
@@ -364,9 +425,22 @@ SyscallHookHandleUD(VIRTUAL_MACHINE_STATE * VCpu)
             InstructionBuffer[1] == 0x0F &&
             InstructionBuffer[2] == 0x07)
         {
+            if (Kind != SYSCALL_SITE_CACHE_KIND_SYSRET)
+            {
+                SyscallSiteCacheInsert(&VCpu->SyscallSiteCache, GuestCr3.Flags, Rip, SYSCALL_SITE_CACHE_KIND_SYSRET, Generation);
+            }
+
             goto EmulateSYSRET;
         }
 
+        if (Kind != SYSCALL_SITE_CACHE_KIND_NONE)
+        {
+            //
+            // The cached site is changed, the sites of this core are forgotten
+            //
+            SyscallSiteCacheFlush(&VCpu->SyscallSiteCache, Generation);
+        }
+
         return FALSE;
     }
 
@@ -409,3 +483,60 @@ EmulateSYSCALL:
 
     return TRUE;
 }
+
+/**
+ * @brief Invalidate the cached SYSCALL and SYSRET sites of all of the cores
+ * @details The caches are flushed once each core looks up its cache, so
+ * it's safe to be called from both vmx-root and vmx non-root
+ *
+ * @return VOID
+ */
+VOID
+SyscallHookInvalidateSiteCaches()
+{
+    InterlockedIncrement(&g_SyscallSiteCacheGeneration);
+}
+
+/**
+ * @brief Locate the image of the system-call handler (the kernel image)
+ * @details Should be called in vmx non-root at PASSIVE_LEVEL, if the image
+ * is not found, none of the cached sites is trusted without reading it
+ *
+ * @return VOID
+ */
+VOID
+SyscallHookLocateKernelImage()
+{
+    PVOID               ImageBase = NULL;
+    PIMAGE_DOS_HEADER   DosHeader;
+    PIMAGE_NT_HEADERS64 NtHeaders;
+
+    g_SyscallSiteCacheKernelImageBase = NULL64_ZERO;
+    g_SyscallSiteCacheKernelImageEnd  = NULL64_ZERO;
+
+    //
+    // Both of the SYSCALL handler (IA32_LSTAR) and its SYSRET instructions
+    // are in the kernel image
+    //
+    if (RtlPcToFileHeader((PVOID)__readmsr(IA32_LSTAR), &ImageBase) == NULL)
+    {
+        return;
+    }
+
+    DosHeader = (PIMAGE_DOS_HEADER)ImageBase;
+
+    if (DosHeader->e_magic != IMAGE_DOS_SIGNATURE)
+    {
+        return;
+    }
+
+    NtHeaders = (PIMAGE_NT_HEADERS64)((UINT64)ImageBase + DosHeader->e_lfanew);
+
+    if (NtHeaders->Signature != IMAGE_NT_SIGNATURE)
+    {
+        return;
+    }
+
+    g_SyscallSiteCacheKernelImageBase = (UINT64)ImageBase;
+    g_SyscallSiteCacheKernelImageEnd  = (UINT64)ImageBase + NtHeaders->OptionalHeader.SizeOfImage;
+}
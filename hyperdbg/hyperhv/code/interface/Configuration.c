@@ -194,6 +194,22 @@ ConfigureEptHookUnHookSingleAddress(UINT64 VirtualAddress,
     return EptHookUnHookSingleAddress(VirtualAddress, PhysAddress, ProcessId);
 }
 
+/**
+ * @brief Remove a batch of hidden breakpoints and restore the entries of
+ * their pages by a single broadcast
+ * @details Should be called from vmx non-root
+ *
+ * @param VirtualAddresses The addresses of the hidden breakpoints
+ * @param NumberOfAddresses Count of the addresses
+ *
+ * @return BOOLEAN If at least one breakpoint is removed it returns true, otherwise false
+ */
+BOOLEAN
+ConfigureEptHookUnHookBatch(UINT64 * VirtualAddresses, UINT32 NumberOfAddresses)
+{
+    return EptHookUnHookBatch(VirtualAddresses, NumberOfAddresses);
+}
+
 /**
  * @brief Remove single hook from the hooked pages list and invalidate TLB
  * @details Should be called from vmx root-mode and it's the responsibility
@@ -282,6 +298,24 @@ ConfigureEptHookFromVmxRoot(PVOID TargetAddress)
     return EptHookFromVmxRoot(TargetAddress);
 }
 
+/**
+ * @brief This function hooks a batch of addresses with hidden breakpoints by a single
+ * VMCALL and a single broadcast to invalidate the EPTs
+ * @details The batch is applied as a whole or not at all, this function should be
+ * called from VMX non-root mode
+ *
+ * @param TargetAddresses The addresses of the functions or memory to be hooked
+ * @param NumberOfTargets Count of the addresses
+ * @param ProcessId The process id to translate based on that process's cr3
+ *
+ * @return BOOLEAN Returns true if the hooks were applied or false if there was an error
+ */
+BOOLEAN
+ConfigureEptHookBatch(PVOID * TargetAddresses, UINT32 NumberOfTargets, UINT32 ProcessId)
+{
+    return EptHookBatch(TargetAddresses, NumberOfTargets, ProcessId);
+}
+
 /**
  * @brief This function allocates a buffer in VMX Non Root Mode and then invokes a VMCALL to set the hook (inline)
  * @details this command uses hidden detours, this NOT be called from vmx-root mode
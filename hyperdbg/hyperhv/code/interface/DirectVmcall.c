@@ -529,3 +529,41 @@ DirectVmcallDisableMov2CrExitingForClearingCrEvents(UINT32                     C
     //
     return VmxVmcallDirectVmcallHandler(&g_GuestState[CoreId], VMCALL_DISABLE_MOV_TO_CR_EXITING_ONLY_FOR_CR_EVENTS, DirectVmcallOptions);
 }
+
+/**
+ * @brief routines for enabling TSC offsetting
+ * @details Should be called from VMX root-mode
+ *
+ * @param CoreId
+ * @param DirectVmcallOptions
+ *
+ * @return NTSTATUS
+ */
+NTSTATUS
+DirectVmcallEnableTscOffsetting(UINT32                     CoreId,
+                                DIRECT_VMCALL_PARAMETERS * DirectVmcallOptions)
+{
+    //
+    // Call the VMCALL handler (directly)
+    //
+    return VmxVmcallDirectVmcallHandler(&g_GuestState[CoreId], VMCALL_SET_TSC_OFFSETTING, DirectVmcallOptions);
+}
+
+/**
+ * @brief routines for disabling TSC offsetting
+ * @details Should be called from VMX root-mode
+ *
+ * @param CoreId
+ * @param DirectVmcallOptions
+ *
+ * @return NTSTATUS
+ */
+NTSTATUS
+DirectVmcallDisableTscOffsetting(UINT32                     CoreId,
+                                 DIRECT_VMCALL_PARAMETERS * DirectVmcallOptions)
+{
+    //
+    // Call the VMCALL handler (directly)
+    //
+    return VmxVmcallDirectVmcallHandler(&g_GuestState[CoreId], VMCALL_UNSET_TSC_OFFSETTING, DirectVmcallOptions);
+}
@@ -892,3 +892,93 @@ VmFuncSmmPerformSmiOperation(SMI_OPERATION_PACKETS * SmiOperationRequest,
 {
     return SmmPerformSmiOperation(SmiOperationRequest, ApplyFromVmxRootMode);
 }
+
+/**
+ * @brief Query the statistics of TSC offsetting
+ *
+ * @param TscOffsettingRequest
+ *
+ * @return VOID
+ */
+VOID
+VmFuncQueryTscOffsetting(TSC_OFFSETTING_OPERATION_PACKETS * TscOffsettingRequest)
+{
+    CounterQueryTscOffsetting(TscOffsettingRequest);
+}
+
+/**
+ * @brief Perform actions related to the sampling profiler
+ *
+ * @param ProfilerRequest
+ * @param Samples The buffer of the samples of the reading requests
+ * @param MaximumSamples
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+VmFuncProfilerPerformOperation(PROFILER_OPERATION_PACKETS * ProfilerRequest,
+                               PROFILER_SAMPLE *            Samples,
+                               UINT32                       MaximumSamples)
+{
+    return ProfilerPerformOperation(ProfilerRequest, Samples, MaximumSamples);
+}
+
+/**
+ * @brief Perform actions related to Intel Processor Trace
+ *
+ * @param ProcessorTraceRequest
+ * @param Buffer The buffer of the packets of the reading requests
+ * @param MaximumBytes
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+VmFuncProcessorTracePerformOperation(PROCESSOR_TRACE_OPERATION_PACKETS * ProcessorTraceRequest,
+                                     UINT8 *                             Buffer,
+                                     UINT32                              MaximumBytes)
+{
+    return ProcessorTracePerformOperation(ProcessorTraceRequest, Buffer, MaximumBytes);
+}
+
+/**
+ * @brief Enable or disable Intel Processor Trace on the current core (with
+ * the options of the last start)
+ * @details Used by the events, could be called in vmx-root or vmx non-root
+ *
+ * @param Enable
+ *
+ * @return VOID
+ */
+VOID
+VmFuncProcessorTraceControlCurrentCore(BOOLEAN Enable)
+{
+    ProcessorTraceControlCurrentCore(Enable);
+}
+
+/**
+ * @brief Perform actions related to the Last Branch Records
+ *
+ * @param LbrRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+VmFuncLbrPerformOperation(LBR_OPERATION_PACKETS * LbrRequest)
+{
+    return LbrPerformOperation(LbrRequest);
+}
+
+/**
+ * @brief Capture the last branches of the current core
+ * @details Used by the events, could be called in vmx-root or vmx non-root
+ *
+ * @param Records The records, the newest one first
+ * @param MaximumRecords
+ *
+ * @return UINT32 Number of the records
+ */
+UINT32
+VmFuncLbrCaptureSnapshot(LBR_DECODE_RECORD * Records, UINT32 MaximumRecords)
+{
+    return LbrCaptureSnapshot(Records, MaximumRecords);
+}
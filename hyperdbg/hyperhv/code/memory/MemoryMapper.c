@@ -1341,6 +1341,11 @@ MemoryMapperWriteMemorySafeWrapper(MEMORY_MAPPER_WRAPPER_FOR_MEMORY_WRITE TypeOf
         return FALSE;
     }
 
+    //
+    // The written memory might be a cached SYSCALL or SYSRET site
+    //
+    SyscallHookInvalidateSiteCaches();
+
     //
     // Check whether it needs multiple accesses to different pages or no
     //
@@ -1489,6 +1494,94 @@ MemoryMapperWriteMemorySafeByPhysicalAddress(UINT64 DestinationPa,
                                               NULL_ZERO);
 }
 
+/**
+ * @brief Atomically compare and exchange the memory by mapping the buffer
+ * by physical address
+ * @details The target should be in a single page, it's used to emulate the
+ * locked instructions of the guest in vmx-root mode
+ *
+ * @param DestinationPa Destination Physical Address
+ * @param Size Size of the target (1, 2, 4 or 8)
+ * @param Comparand The expected value, it's set to the previous value of the target
+ * @param NewValue The value that is written if the target is equal to the comparand
+ *
+ * @return BOOLEAN returns TRUE if it was successful and FALSE if there was error
+ */
+_Use_decl_annotations_
+BOOLEAN
+MemoryMapperCompareExchangeSafeByPhysicalAddress(UINT64   DestinationPa,
+                                                 UINT32   Size,
+                                                 UINT64 * Comparand,
+                                                 UINT64   NewValue)
+{
+    ULONG       CurrentCore = KeGetCurrentProcessorNumberEx(NULL);
+    PAGE_ENTRY  PageEntry;
+    PPAGE_ENTRY Pte;
+    PVOID       Va;
+    PVOID       Target;
+
+    //
+    // Check to see if PTE and Reserved VA already initialized
+    //
+    if (g_MemoryMapper[CurrentCore].VirualAddressForWrite == NULL64_ZERO ||
+        g_MemoryMapper[CurrentCore].PteVirtualAddressForWrite == NULL64_ZERO)
+    {
+        return FALSE;
+    }
+
+    if ((Size != 1 && Size != 2 && Size != 4 && Size != 8) ||
+        (PAGE_4KB_OFFSET & DestinationPa) + Size > PAGE_SIZE)
+    {
+        return FALSE;
+    }
+
+    //
+    // The written memory might be a cached SYSCALL or SYSRET site
+    //
+    SyscallHookInvalidateSiteCaches();
+
+    Pte = (PAGE_ENTRY *)g_MemoryMapper[CurrentCore].PteVirtualAddressForWrite;
+    Va  = (PVOID)g_MemoryMapper[CurrentCore].VirualAddressForWrite;
+
+    //
+    // Map the page the same as the writes
+    //
+    PageEntry.Flags                  = Pte->Flags;
+    PageEntry.Fields.Present         = 1;
+    PageEntry.Fields.Write           = 1;
+    PageEntry.Fields.Global          = 1;
+    PageEntry.Fields.PageFrameNumber = DestinationPa >> 12;
+
+    Pte->Flags = PageEntry.Flags;
+
+    __invlpg(Va);
+
+    Target = (PVOID)((UINT64)Va + (PAGE_4KB_OFFSET & DestinationPa));
+
+    switch (Size)
+    {
+    case 1:
+        *Comparand = (UINT8)_InterlockedCompareExchange8((volatile CHAR *)Target, (CHAR)NewValue, (CHAR)*Comparand);
+        break;
+    case 2:
+        *Comparand = (UINT16)_InterlockedCompareExchange16((volatile SHORT *)Target, (SHORT)NewValue, (SHORT)*Comparand);
+        break;
+    case 4:
+        *Comparand = (UINT32)InterlockedCompareExchange((volatile LONG *)Target, (LONG)NewValue, (LONG)*Comparand);
+        break;
+    default:
+        *Comparand = (UINT64)InterlockedCompareExchange64((volatile LONG64 *)Target, (LONG64)NewValue, (LONG64)*Comparand);
+        break;
+    }
+
+    //
+    // Unmap Address
+    //
+    Pte->Flags = NULL64_ZERO;
+
+    return TRUE;
+}
+
 /**
  * @brief Reserve user mode address (not allocated) in the target user mode application
  * @details this function should be called from vmx non-root mode
@@ -47,6 +47,11 @@ EptCheckFeatures(VOID)
         g_CompatibilityCheck.ExecuteOnlySupport = TRUE;
     }
 
+    //
+    // The regions that have a single memory type are mapped with 1GB pages if it's supported
+    //
+    g_CompatibilityCheck.Ept1GbPagesSupport = VpidRegister.Pdpte1GbPages ? TRUE : FALSE;
+
     if (!MTRRDefType.MtrrEnable)
     {
         LogError("Err, MTRR dynamic ranges are not supported");
@@ -59,7 +64,7 @@ EptCheckFeatures(VOID)
 }
 
 /**
- * @brief Check whether EPT features are present or not
+ * @brief Get the memory type of a page from the MTRR map
  *
  * @param PageFrameNumber
  * @param IsLargePage
@@ -68,83 +73,14 @@ EptCheckFeatures(VOID)
 UINT8
 EptGetMemoryType(SIZE_T PageFrameNumber, BOOLEAN IsLargePage)
 {
-    UINT8                   TargetMemoryType;
-    SIZE_T                  AddressOfPage;
-    SIZE_T                  CurrentMtrrRange;
-    MTRR_RANGE_DESCRIPTOR * CurrentMemoryRange;
+    SIZE_T AddressOfPage;
 
     AddressOfPage = IsLargePage ? PageFrameNumber * SIZE_2_MB : PageFrameNumber * PAGE_SIZE;
 
-    TargetMemoryType = (UINT8)-1;
-
-    //
-    // For each MTRR range
-    //
-    for (CurrentMtrrRange = 0; CurrentMtrrRange < g_EptState->NumberOfEnabledMemoryRanges; CurrentMtrrRange++)
-    {
-        CurrentMemoryRange = &g_EptState->MemoryRanges[CurrentMtrrRange];
-
-        //
-        // If the physical address is described by this MTRR
-        //
-        if (AddressOfPage >= CurrentMemoryRange->PhysicalBaseAddress &&
-            AddressOfPage < CurrentMemoryRange->PhysicalEndAddress)
-        {
-            // LogInfo("0x%X> Range=%llX -> %llX | Begin=%llX End=%llX", PageFrameNumber, AddressOfPage, AddressOfPage + SIZE_2_MB - 1, g_EptState->MemoryRanges[CurrentMtrrRange].PhysicalBaseAddress, g_EptState->MemoryRanges[CurrentMtrrRange].PhysicalEndAddress);
-
-            //
-            // 12.11.4.1 MTRR Precedences
-            //
-            if (CurrentMemoryRange->FixedRange)
-            {
-                //
-                // When the fixed-range MTRRs are enabled, they take priority over the variable-range
-                // MTRRs when overlaps in ranges occur.
-                //
-                TargetMemoryType = CurrentMemoryRange->MemoryType;
-                break;
-            }
-
-            if (TargetMemoryType == MEMORY_TYPE_UNCACHEABLE)
-            {
-                //
-                // If this is going to be marked uncacheable, then we stop the search as UC always
-                // takes precedence
-                //
-                TargetMemoryType = CurrentMemoryRange->MemoryType;
-                break;
-            }
-
-            if (TargetMemoryType == MEMORY_TYPE_WRITE_THROUGH || CurrentMemoryRange->MemoryType == MEMORY_TYPE_WRITE_THROUGH)
-            {
-                if (TargetMemoryType == MEMORY_TYPE_WRITE_BACK)
-                {
-                    //
-                    // If two or more MTRRs overlap and describe the same region, and at least one is WT and
-                    // the other one(s) is/are WB, use WT. However, continue looking, as other MTRRs
-                    // may still specify the address as UC, which always takes precedence
-                    //
-                    TargetMemoryType = MEMORY_TYPE_WRITE_THROUGH;
-                    continue;
-                }
-            }
-
-            //
-            // Otherwise, just use the last MTRR that describes this address
-            //
-            TargetMemoryType = CurrentMemoryRange->MemoryType;
-        }
-    }
-
     //
-    // If no MTRR was found, return the default memory type
+    // The precedences of the MTRRs (12.11.4.1) are applied once for each interval of the map
     //
-    if (TargetMemoryType == (UINT8)-1)
-    {
-        TargetMemoryType = g_EptState->DefaultMemoryType;
-    }
-
-    return TargetMemoryType;
+    return MtrrMapGetMemoryType(&g_EptState->MtrrMap, AddressOfPage);
 }
 
 /**
@@ -173,6 +109,8 @@ EptBuildMtrrMap(VOID)
     if (!MTRRDefType.MtrrEnable)
     {
         g_EptState->DefaultMemoryType = MEMORY_TYPE_UNCACHEABLE;
+        MtrrMapBuild(&g_EptState->MtrrMap, NULL, 0, g_EptState->DefaultMemoryType);
+
         return TRUE;
     }
 
@@ -290,23 +228,237 @@ EptBuildMtrrMap(VOID)
 
     LogDebugInfo("Total MTRR ranges committed: 0x%x", g_EptState->NumberOfEnabledMemoryRanges);
 
+    //
+    // Sort and merge the ranges, so the memory types are not searched in all of the ranges
+    // for each entry of the EPT
+    //
+    MtrrMapBuild(&g_EptState->MtrrMap,
+                 g_EptState->MemoryRanges,
+                 g_EptState->NumberOfEnabledMemoryRanges,
+                 g_EptState->DefaultMemoryType);
+
+    LogDebugInfo("Total MTRR map intervals: 0x%x", g_EptState->MtrrMap.NumberOfIntervals);
+
     return TRUE;
 }
 
 /**
- * @brief Get the PML1 entry for this physical address if the page is split
+ * @brief Allocate a page for a private table of a core
+ *
+ * @param PhysicalAddress The physical address of the allocated page
+ * @param Context Whether to use the pre-allocated pools or not
+ *
+ * @return PVOID
+ */
+static PVOID
+EptAllocatePrivateTable(UINT64 * PhysicalAddress, PVOID Context)
+{
+    PVOID Table;
+
+    if (*(BOOLEAN *)Context)
+    {
+        //
+        // The pool is topped up after the region is privatized (only if other regions are still shared)
+        //
+        Table = (PVOID)PoolManagerRequestPool(EPT_PRIVATE_PAGE_TABLE, FALSE, PAGE_SIZE);
+    }
+    else
+    {
+        Table = PlatformMemAllocateNonPagedPool(PAGE_SIZE);
+    }
+
+    if (Table == NULL)
+    {
+        return NULL;
+    }
+
+    *PhysicalAddress = VirtualAddressToPhysicalAddress(Table);
+
+    return Table;
+}
+
+/**
+ * @brief Free a page that is allocated for a private table of a core
+ *
+ * @param Table
+ * @param Context Whether the pre-allocated pools are used or not
+ *
+ * @return VOID
+ */
+static VOID
+EptFreePrivateTable(PVOID Table, PVOID Context)
+{
+    if (*(BOOLEAN *)Context)
+    {
+        PoolManagerFreePool((UINT64)Table);
+    }
+    else
+    {
+        PlatformMemFreePool(Table);
+    }
+}
+
+/**
+ * @brief Convert the physical address of a table to its virtual address
+ *
+ * @param PhysicalAddress
+ * @param Context
+ *
+ * @return PVOID
+ */
+static PVOID
+EptPhysicalToVirtualTable(UINT64 PhysicalAddress, PVOID Context)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    return (PVOID)PhysicalAddressToVirtualAddress(PhysicalAddress);
+}
+
+/**
+ * @brief Get the private PML2 table of a 1GB region of the core
+ * @details If the region still uses the shared table, the shared tables of
+ * the region are copied for the core, the other cores keep using the shared
+ * tables
  *
  * @param EptPageTable The EPT Page Table
- * @param PhysicalAddress Physical address that we want to get its PML1
- * @return PEPT_PML1_ENTRY Return NULL if the address is invalid or the page wasn't already split
+ * @param DirectoryPointer Index of the 1GB region
+ * @param UsePreAllocatedBuffer Whether allocate a memory or use pre-allocated buffer
+ *
+ * @return PEPT_PML2_ENTRY The private PML2 table or NULL if it's not allocated
  */
-PEPT_PML1_ENTRY
-EptGetPml1Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress)
+static PEPT_PML2_ENTRY
+EptGetPrivatePml2Table(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T DirectoryPointer, BOOLEAN UsePreAllocatedBuffer)
 {
-    SIZE_T            Directory, DirectoryPointer, PML4Entry;
-    PEPT_PML2_ENTRY   PML2;
-    PEPT_PML1_ENTRY   PML1;
-    PEPT_PML2_POINTER PML2Pointer;
+    PEPT_PML2_ENTRY      SharedPml2Table = &g_EptState->SharedPageTable->PML2[DirectoryPointer][0];
+    PEPT_PML2_ENTRY      PrivatePml2Table;
+    SHARED_EPT_CALLBACKS Callbacks;
+    EPT_PML3_ENTRY       LargeEntry;
+    EPT_PML3_POINTER     NewPointer;
+    UINT32               NumberOfTables;
+
+    if (EptPageTable->PML2[DirectoryPointer] != SharedPml2Table)
+    {
+        //
+        // The region is already private
+        //
+        return EptPageTable->PML2[DirectoryPointer];
+    }
+
+    Callbacks.Allocate          = EptAllocatePrivateTable;
+    Callbacks.Free              = EptFreePrivateTable;
+    Callbacks.PhysicalToVirtual = EptPhysicalToVirtualTable;
+    Callbacks.Context           = &UsePreAllocatedBuffer;
+
+    NewPointer.AsUInt = EptPageTable->PML3[DirectoryPointer].AsUInt;
+    LargeEntry.AsUInt = NewPointer.AsUInt;
+
+    if (LargeEntry.LargePage)
+    {
+        //
+        // The 1GB page is split to the 2MB pages of the shared PML2 table (they have the same
+        // memory type), the access bits of the page are kept on the new pointer
+        //
+        NewPointer.AsUInt          = 0;
+        NewPointer.ReadAccess      = LargeEntry.ReadAccess;
+        NewPointer.WriteAccess     = LargeEntry.WriteAccess;
+        NewPointer.ExecuteAccess   = LargeEntry.ExecuteAccess;
+        NewPointer.UserModeExecute = LargeEntry.UserModeExecute;
+        NewPointer.PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(SharedPml2Table) / PAGE_SIZE;
+    }
+
+    PrivatePml2Table = (PEPT_PML2_ENTRY)SharedEptPrivatizeRegion((const UINT64 *)SharedPml2Table,
+                                                                 &NewPointer.AsUInt,
+                                                                 &Callbacks);
+
+    if (PrivatePml2Table == NULL)
+    {
+        LogError("Err, failed to allocate the private tables of the EPT");
+        return NULL;
+    }
+
+    //
+    // The entry is changed at once, so the core always sees a complete hierarchy
+    //
+    EptPageTable->PML3[DirectoryPointer].AsUInt           = NewPointer.AsUInt;
+    EptPageTable->PML2[DirectoryPointer]                  = PrivatePml2Table;
+    EptPageTable->PrivateTablesFromPool[DirectoryPointer] = UsePreAllocatedBuffer;
+
+    //
+    // Top up the reserved tables for the regions that are still shared
+    //
+    SpinlockLock(&EptPrivateTablesReservationLock);
+
+    NumberOfTables = SharedEptRegionPrivatized(&g_EptState->PrivateTablesReservation,
+                                               (UINT32)DirectoryPointer,
+                                               SharedEptGetRegionCost((const UINT64 *)SharedPml2Table),
+                                               UsePreAllocatedBuffer);
+
+    SpinlockUnlock(&EptPrivateTablesReservationLock);
+
+    if (NumberOfTables != 0)
+    {
+        PoolManagerRequestAllocation(PAGE_SIZE, NumberOfTables, EPT_PRIVATE_PAGE_TABLE);
+    }
+
+    return PrivatePml2Table;
+}
+
+/**
+ * @brief Free the private copies of the regions of a core
+ * @details The core should not use the EPT table anymore, the tables that
+ * are split later (e.g., by the hooks) are freed by the pool manager
+ *
+ * @param EptPageTable The EPT Page Table
+ *
+ * @return VOID
+ */
+VOID
+EptFreePrivatePageTables(PVMM_EPT_PAGE_TABLE EptPageTable)
+{
+    PEPT_PML2_ENTRY      SharedPml2Table;
+    SHARED_EPT_CALLBACKS Callbacks;
+
+    if (g_EptState->SharedPageTable == NULL)
+    {
+        return;
+    }
+
+    Callbacks.Allocate          = EptAllocatePrivateTable;
+    Callbacks.Free              = EptFreePrivateTable;
+    Callbacks.PhysicalToVirtual = EptPhysicalToVirtualTable;
+
+    for (SIZE_T i = 0; i < VMM_EPT_PML3E_COUNT; i++)
+    {
+        SharedPml2Table = &g_EptState->SharedPageTable->PML2[i][0];
+
+        if (EptPageTable->PML2[i] == SharedPml2Table)
+        {
+            continue;
+        }
+
+        Callbacks.Context = &EptPageTable->PrivateTablesFromPool[i];
+
+        SharedEptReleaseRegion((const UINT64 *)SharedPml2Table, (UINT64 *)EptPageTable->PML2[i], &Callbacks);
+
+        EptPageTable->PML2[i] = SharedPml2Table;
+    }
+}
+
+/**
+ * @brief Get the PML2 entry that is currently used by the core for this
+ * physical address
+ *
+ * @param EptPageTable The EPT Page Table
+ * @param PhysicalAddress Physical Address that we want to get its PML2
+ * @param Privatize Whether to privatize the region of the address for the core
+ *
+ * @return PEPT_PML2_ENTRY The PML2 Entry Structure
+ */
+static PEPT_PML2_ENTRY
+EptGetCurrentPml2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN Privatize)
+{
+    SIZE_T          Directory, DirectoryPointer, PML4Entry;
+    PEPT_PML2_ENTRY PML2Table;
 
     Directory        = ADDRMASK_EPT_PML2_INDEX(PhysicalAddress);
     DirectoryPointer = ADDRMASK_EPT_PML3_INDEX(PhysicalAddress);
@@ -320,7 +472,58 @@ EptGetPml1Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress)
         return NULL;
     }
 
-    PML2 = &EptPageTable->PML2[DirectoryPointer][Directory];
+    if (Privatize)
+    {
+        //
+        // The entries might be changed for this core, so the region should not be shared,
+        // the pre-allocated pools are used in vmx-root mode
+        //
+        PML2Table = EptGetPrivatePml2Table(EptPageTable, DirectoryPointer, VmxGetCurrentExecutionMode() == VmxExecutionModeRoot);
+    }
+    else if (((PEPT_PML3_ENTRY)&EptPageTable->PML3[DirectoryPointer])->LargePage)
+    {
+        //
+        // The region is mapped by a 1GB page, the low bits (access, accessed and dirty flags) of the
+        // 1GB entries are the same as the 2MB entries
+        //
+        return (PEPT_PML2_ENTRY)&EptPageTable->PML3[DirectoryPointer];
+    }
+    else
+    {
+        PML2Table = EptPageTable->PML2[DirectoryPointer];
+    }
+
+    if (PML2Table == NULL)
+    {
+        return NULL;
+    }
+
+    return &PML2Table[Directory];
+}
+
+/**
+ * @brief Get the PML1 entry for this physical address if the page is split
+ *
+ * @param EptPageTable The EPT Page Table
+ * @param PhysicalAddress Physical address that we want to get its PML1
+ * @return PEPT_PML1_ENTRY Return NULL if the address is invalid, the page wasn't already split or
+ * the private tables of the region are not allocated (never for the regions that are already private,
+ * e.g., the regions of the hooked pages)
+ * @details The region of the address is privatized for the core as the entry might be changed
+ */
+PEPT_PML1_ENTRY
+EptGetPml1Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress)
+{
+    PEPT_PML2_ENTRY   PML2;
+    PEPT_PML1_ENTRY   PML1;
+    PEPT_PML2_POINTER PML2Pointer;
+
+    PML2 = EptGetCurrentPml2Entry(EptPageTable, PhysicalAddress, TRUE);
+
+    if (!PML2)
+    {
+        return NULL;
+    }
 
     //
     // Check to ensure the page is split
@@ -361,31 +564,24 @@ EptGetPml1Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress)
  * @param EptPageTable The EPT Page Table
  * @param PhysicalAddress Physical address that we want to get its PML1
  * @param IsLargePage Shows whether it's a large page or not
+ * @param Privatize Whether to privatize the region of the address for the core
  *
  * @return PVOID Return PEPT_PML1_ENTRY or PEPT_PML2_ENTRY
  */
-PVOID
-EptGetPml1OrPml2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN * IsLargePage)
+static PVOID
+EptGetPml1OrPml2EntryInternal(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN * IsLargePage, BOOLEAN Privatize)
 {
-    SIZE_T            Directory, DirectoryPointer, PML4Entry;
     PEPT_PML2_ENTRY   PML2;
     PEPT_PML1_ENTRY   PML1;
     PEPT_PML2_POINTER PML2Pointer;
 
-    Directory        = ADDRMASK_EPT_PML2_INDEX(PhysicalAddress);
-    DirectoryPointer = ADDRMASK_EPT_PML3_INDEX(PhysicalAddress);
-    PML4Entry        = ADDRMASK_EPT_PML4_INDEX(PhysicalAddress);
+    PML2 = EptGetCurrentPml2Entry(EptPageTable, PhysicalAddress, Privatize);
 
-    //
-    // Addresses above 512GB are invalid because it is > physical address bus width
-    //
-    if (PML4Entry > 0)
+    if (!PML2)
     {
         return NULL;
     }
 
-    PML2 = &EptPageTable->PML2[DirectoryPointer][Directory];
-
     //
     // Check to ensure the page is split
     //
@@ -420,66 +616,130 @@ EptGetPml1OrPml2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress,
     return PML1;
 }
 
+/**
+ * @brief Get the PML1 entry for this physical address if the large page
+ * is available then large page of Pml2 is returned
+ * @details The region of the address is privatized for the core as the
+ * entry might be changed
+ *
+ * @param EptPageTable The EPT Page Table
+ * @param PhysicalAddress Physical address that we want to get its PML1
+ * @param IsLargePage Shows whether it's a large page or not
+ *
+ * @return PVOID Return PEPT_PML1_ENTRY or PEPT_PML2_ENTRY
+ */
+PVOID
+EptGetPml1OrPml2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN * IsLargePage)
+{
+    return EptGetPml1OrPml2EntryInternal(EptPageTable, PhysicalAddress, IsLargePage, TRUE);
+}
+
+/**
+ * @brief Get the PML1 entry (or the large PML2 entry) that is currently used
+ * by the core for this physical address without privatizing its region
+ * @details The entry might be shared by all of the cores
+ *
+ * @param EptPageTable The EPT Page Table
+ * @param PhysicalAddress Physical address that we want to get its PML1
+ * @param IsLargePage Shows whether it's a large page or not
+ *
+ * @return PVOID Return PEPT_PML1_ENTRY or PEPT_PML2_ENTRY
+ */
+PVOID
+EptGetPml1OrPml2EntryWithoutPrivatizing(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN * IsLargePage)
+{
+    return EptGetPml1OrPml2EntryInternal(EptPageTable, PhysicalAddress, IsLargePage, FALSE);
+}
+
 /**
  * @brief Get the PML2 entry for this physical address
+ * @details The region of the address is privatized for the core as the
+ * entry might be changed
  *
  * @param EptPageTable The EPT Page Table
  * @param PhysicalAddress Physical Address that we want to get its PML2
- * @return PEPT_PML2_ENTRY The PML2 Entry Structure
+ * @return PEPT_PML2_ENTRY The PML2 Entry Structure or NULL if the address is invalid or the
+ * private tables of the region are not allocated
  */
 PEPT_PML2_ENTRY
 EptGetPml2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress)
 {
-    SIZE_T          Directory, DirectoryPointer, PML4Entry;
-    PEPT_PML2_ENTRY PML2;
+    return EptGetCurrentPml2Entry(EptPageTable, PhysicalAddress, TRUE);
+}
 
-    Directory        = ADDRMASK_EPT_PML2_INDEX(PhysicalAddress);
-    DirectoryPointer = ADDRMASK_EPT_PML3_INDEX(PhysicalAddress);
-    PML4Entry        = ADDRMASK_EPT_PML4_INDEX(PhysicalAddress);
+/**
+ * @brief Allow the user-mode execution (MBEC) on the PML3, PML2 and PML1
+ * entries of the EPT table
+ * @details The bit is the same on all of the cores, so the PML2 tables of the
+ * regions that are not privatized by the core are intentionally changed on
+ * the shared tables rather than privatizing all of the regions. The regions
+ * that are mapped by a 1GB page don't use their PML2 tables, so the bit of
+ * their PML3 entry (the 1GB page) is set, and once they're split, the private
+ * PML2 table is copied from the shared table that already has the bit
+ *
+ * @param EptPageTable The EPT Page Table
+ *
+ * @return VOID
+ */
+VOID
+EptAllowUserModeExecution(PVMM_EPT_PAGE_TABLE EptPageTable)
+{
+    PEPT_PML2_ENTRY PML2Table;
+    PEPT_PML1_ENTRY PML1Table;
 
-    //
-    // Addresses above 512GB are invalid because it is > physical address bus width
-    //
-    if (PML4Entry > 0)
+    for (SIZE_T i = 0; i < VMM_EPT_PML3E_COUNT; i++)
     {
-        return NULL;
-    }
+        //
+        // Either the pointer to the PML2 table or the 1GB page of the region
+        //
+        EptPageTable->PML3[i].UserModeExecute = TRUE;
 
-    PML2 = &EptPageTable->PML2[DirectoryPointer][Directory];
-    return PML2;
+        PML2Table = EptPageTable->PML2[i];
+
+        for (SIZE_T j = 0; j < VMM_EPT_PML2E_COUNT; j++)
+        {
+            PML2Table[j].UserModeExecute = TRUE;
+
+            if (PML2Table[j].LargePage)
+            {
+                continue;
+            }
+
+            //
+            // The 2MB page is split (e.g., it's previously used for an EPT hook),
+            // so the bit of its PML1 entries should be set too
+            //
+            PML1Table = (PEPT_PML1_ENTRY)PhysicalAddressToVirtualAddress(((PEPT_PML2_POINTER)&PML2Table[j])->PageFrameNumber * PAGE_SIZE);
+
+            if (PML1Table == NULL)
+            {
+                continue;
+            }
+
+            for (SIZE_T k = 0; k < VMM_EPT_PML1E_COUNT; k++)
+            {
+                PML1Table[k].UserModeExecute = TRUE;
+            }
+        }
+    }
 }
 
 /**
- * @brief Convert large pages to 4KB pages
+ * @brief Convert a large PML2 entry to 4KB pages
  *
- * @param EptPageTable The EPT Page Table
+ * @param TargetEntry The PML2 entry
  * @param UsePreAllocatedBuffer Whether allocate a memory or use pre-allocated buffer
- * @param PhysicalAddress Physical address of where we want to split
  *
  * @return BOOLEAN Returns true if it was successful or false if there was an error
  */
-BOOLEAN
-EptSplitLargePage(PVMM_EPT_PAGE_TABLE EptPageTable,
-                  BOOLEAN             UsePreAllocatedBuffer,
-                  SIZE_T              PhysicalAddress)
+static BOOLEAN
+EptSplitLargePml2Entry(PEPT_PML2_ENTRY TargetEntry, BOOLEAN UsePreAllocatedBuffer)
 {
     PVMM_EPT_DYNAMIC_SPLIT NewSplit;
     EPT_PML1_ENTRY         EntryTemplate;
     SIZE_T                 EntryIndex;
-    PEPT_PML2_ENTRY        TargetEntry;
     EPT_PML2_POINTER       NewPointer;
 
-    //
-    // Find the PML2 entry that's currently used
-    //
-    TargetEntry = EptGetPml2Entry(EptPageTable, PhysicalAddress);
-
-    if (!TargetEntry)
-    {
-        LogError("Err, an invalid physical address passed");
-        return FALSE;
-    }
-
     //
     // If this large page is not marked a large page, that means it's a pointer already.
     // That page is therefore already split.
@@ -567,25 +827,65 @@ EptSplitLargePage(PVMM_EPT_PAGE_TABLE EptPageTable,
     NewPointer.ExecuteAccess = 1;
 
     //
-    // Set the UserModeExecute bit based on the global state of MBEC
+    // Set the UserModeExecute bit based on the global state of MBEC
+    //
+    if (g_ModeBasedExecutionControlState)
+    {
+        NewPointer.UserModeExecute = 1;
+    }
+    else
+    {
+        NewPointer.UserModeExecute = 0;
+    }
+
+    NewPointer.PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(&NewSplit->PML1[0]) / PAGE_SIZE;
+
+    //
+    // Now, replace the entry in the page table with our new split pointer
+    //
+    RtlCopyMemory(TargetEntry, &NewPointer, sizeof(NewPointer));
+
+    return TRUE;
+}
+
+/**
+ * @brief Convert large pages to 4KB pages
+ * @details The 1GB region of the address is privatized for the core before
+ * splitting, so the split is not visible to the other cores
+ *
+ * @param EptPageTable The EPT Page Table
+ * @param UsePreAllocatedBuffer Whether allocate a memory or use pre-allocated buffer
+ * @param PhysicalAddress Physical address of where we want to split
+ *
+ * @return BOOLEAN Returns true if it was successful or false if there was an error
+ */
+BOOLEAN
+EptSplitLargePage(PVMM_EPT_PAGE_TABLE EptPageTable,
+                  BOOLEAN             UsePreAllocatedBuffer,
+                  SIZE_T              PhysicalAddress)
+{
+    PEPT_PML2_ENTRY PML2Table;
+
+    //
+    // Addresses above 512GB are invalid because it is > physical address bus width
     //
-    if (g_ModeBasedExecutionControlState)
-    {
-        NewPointer.UserModeExecute = 1;
-    }
-    else
+    if (ADDRMASK_EPT_PML4_INDEX(PhysicalAddress) > 0)
     {
-        NewPointer.UserModeExecute = 0;
+        LogError("Err, an invalid physical address passed");
+        return FALSE;
     }
 
-    NewPointer.PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(&NewSplit->PML1[0]) / PAGE_SIZE;
-
     //
-    // Now, replace the entry in the page table with our new split pointer
+    // Find the PML2 table that's used by this core
     //
-    RtlCopyMemory(TargetEntry, &NewPointer, sizeof(NewPointer));
+    PML2Table = EptGetPrivatePml2Table(EptPageTable, ADDRMASK_EPT_PML3_INDEX(PhysicalAddress), UsePreAllocatedBuffer);
 
-    return TRUE;
+    if (!PML2Table)
+    {
+        return FALSE;
+    }
+
+    return EptSplitLargePml2Entry(&PML2Table[ADDRMASK_EPT_PML2_INDEX(PhysicalAddress)], UsePreAllocatedBuffer);
 }
 
 /**
@@ -597,37 +897,31 @@ EptSplitLargePage(PVMM_EPT_PAGE_TABLE EptPageTable,
 BOOLEAN
 EptIsValidForLargePage(SIZE_T PageFrameNumber)
 {
-    SIZE_T                  StartAddressOfPage = PageFrameNumber * SIZE_2_MB;
-    SIZE_T                  EndAddressOfPage   = StartAddressOfPage + (SIZE_2_MB - 1);
-    MTRR_RANGE_DESCRIPTOR * CurrentMemoryRange;
-    SIZE_T                  CurrentMtrrRange;
-
-    for (CurrentMtrrRange = 0; CurrentMtrrRange < g_EptState->NumberOfEnabledMemoryRanges; CurrentMtrrRange++)
-    {
-        CurrentMemoryRange = &g_EptState->MemoryRanges[CurrentMtrrRange];
-
-        if ((StartAddressOfPage <= CurrentMemoryRange->PhysicalEndAddress &&
-             EndAddressOfPage > CurrentMemoryRange->PhysicalEndAddress) ||
-            (StartAddressOfPage < CurrentMemoryRange->PhysicalBaseAddress &&
-             EndAddressOfPage >= CurrentMemoryRange->PhysicalBaseAddress))
-        {
-            return FALSE;
-        }
-    }
+    return MtrrMapIsUniform(&g_EptState->MtrrMap, PageFrameNumber * SIZE_2_MB, SIZE_2_MB);
+}
 
-    return TRUE;
+/**
+ * @brief Check if potential 1GB page doesn't land on two or more different cache memory types
+ *
+ * @param PageFrameNumber PFN of the 1GB page (Physical Address)
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptIsValidFor1GbPage(SIZE_T PageFrameNumber)
+{
+    return g_CompatibilityCheck.Ept1GbPagesSupport &&
+           MtrrMapIsUniform(&g_EptState->MtrrMap, PageFrameNumber * SIZE_1_GB, SIZE_1_GB);
 }
 
 /**
  * @brief Set up PML2 Entries
  *
- * @param EptPageTable
  * @param NewEntry The PML2 Entry
  * @param PageFrameNumber PFN (Physical Address)
  * @return VOID
  */
 BOOLEAN
-EptSetupPML2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, PEPT_PML2_ENTRY NewEntry, SIZE_T PageFrameNumber)
+EptSetupPML2Entry(PEPT_PML2_ENTRY NewEntry, SIZE_T PageFrameNumber)
 {
     //
     // Each of the 512 collections of 512 PML2 entries is setup here
@@ -649,24 +943,158 @@ EptSetupPML2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, PEPT_PML2_ENTRY NewEntry, SI
         //
         // Here we won't need to use pre-allocated buffers
         //
-        return EptSplitLargePage(EptPageTable, FALSE, PageFrameNumber * SIZE_2_MB);
+        return EptSplitLargePml2Entry(NewEntry, FALSE);
+    }
+}
+
+/**
+ * @brief Allocates and create the tables of the identity map that are
+ * shared by all of the cores
+ * @details The PML2 tables (and the tables of the regions above 512GB) are
+ * the same on all of the cores, so they're built once, each core only has
+ * its own PML4 and PML3 and copies a region once it's changed on that core
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptAllocateAndCreateSharedPageTable(VOID)
+{
+    PVMM_EPT_SHARED_PAGE_TABLE SharedTable;
+    EPT_PML3_ENTRY             PML3TemplateLarge;
+    EPT_PML2_ENTRY             PML2EntryTemplate;
+    SIZE_T                     EntryGroupIndex;
+    SIZE_T                     EntryIndex;
+    UINT32                     RegionCost;
+
+    //
+    // Allocate address anywhere in the OS's memory space and
+    // zero out all entries to ensure all unused entries are marked Not Present
+    //
+    SharedTable = PlatformMemAllocateContiguousZeroedMemory(sizeof(VMM_EPT_SHARED_PAGE_TABLE));
+
+    if (SharedTable == NULL)
+    {
+        LogError("Err, failed to allocate memory for the shared PageTable");
+        return FALSE;
+    }
+
+    //
+    // Ensure stack memory is cleared
+    //
+    PML3TemplateLarge.AsUInt = 0;
+
+    PML3TemplateLarge.LargePage     = 1;
+    PML3TemplateLarge.ReadAccess    = 1;
+    PML3TemplateLarge.WriteAccess   = 1;
+    PML3TemplateLarge.ExecuteAccess = 1;
+    PML3TemplateLarge.MemoryType    = MEMORY_TYPE_UNCACHEABLE;
+
+    //
+    // Copt the template into each of the 512 PML3 entry slots for the reserved entries
+    //
+    for (size_t i = 0; i < VMM_EPT_PML4E_COUNT - 1; i++)
+    {
+        __stosq((SIZE_T *)&SharedTable->PML3_RSVD[i][0], PML3TemplateLarge.AsUInt, VMM_EPT_PML3E_COUNT);
+    }
+
+    //
+    // For each of the 512 PML3 reserved entries for reserved PML3 entries
+    //
+    for (size_t i = 0; i < VMM_EPT_PML4E_COUNT - 1; i++)
+    {
+        for (size_t j = 0; j < VMM_EPT_PML3E_COUNT; j++)
+        {
+            //
+            // Map the 1GB PML3 reserved entry to 512 PML3 (1GB) entries to describe each large page
+            // NOTE: We do *not* manage them since they are reserved for out of 512 GB MMIO ranges
+            // The first 512GB is used for the main system memory and the rest is reserved for MMIO
+            //
+            SharedTable->PML3_RSVD[i][j].PageFrameNumber = (SIZE_512_GB +                           // First 512GB is used for system memory
+                                                            (i * SIZE_512_GB) + (j * SIZE_1_GB)) >> // MMIO ranges
+                                                           30;                                      // Convert to page frame number
+        }
+    }
+
+    //
+    // Now we will set up the PML2 entries, which are 2MB large pages
+    //
+    PML2EntryTemplate.AsUInt = 0;
+
+    //
+    // All PML2 entries will be RWX and 'present'
+    //
+    PML2EntryTemplate.WriteAccess   = 1;
+    PML2EntryTemplate.ReadAccess    = 1;
+    PML2EntryTemplate.ExecuteAccess = 1;
+
+    //
+    // We are using 2MB large pages, so we must mark this 1 here
+    //
+    PML2EntryTemplate.LargePage = 1;
+
+    //
+    // For each collection of 512 PML2 entries (512 collections * 512 entries per collection),
+    // mark it RWX using the same template above.
+    // This marks the entries as "Present" regardless of if the actual system has memory at
+    // this region or not. We will cause a fault in our EPT handler if the guest access a page
+    // outside a usable range, despite the EPT frame being present here
+    //
+    __stosq((SIZE_T *)&SharedTable->PML2[0], PML2EntryTemplate.AsUInt, VMM_EPT_PML3E_COUNT * VMM_EPT_PML2E_COUNT);
+
+    //
+    // For each of the 512 collections of 512 2MB PML2 entries
+    //
+    for (EntryGroupIndex = 0; EntryGroupIndex < VMM_EPT_PML3E_COUNT; EntryGroupIndex++)
+    {
+        //
+        // For each 2MB PML2 entry in the collection
+        //
+        for (EntryIndex = 0; EntryIndex < VMM_EPT_PML2E_COUNT; EntryIndex++)
+        {
+            //
+            // Setup the memory type and frame number of the PML2 entry
+            //
+            EptSetupPML2Entry(&SharedTable->PML2[EntryGroupIndex][EntryIndex], (EntryGroupIndex * VMM_EPT_PML2E_COUNT) + EntryIndex);
+        }
+    }
+
+    //
+    // The regions that are split because of the MTRRs need more tables to be privatized
+    //
+    g_EptState->MaximumRegionCost = 1;
+
+    for (EntryGroupIndex = 0; EntryGroupIndex < VMM_EPT_PML3E_COUNT; EntryGroupIndex++)
+    {
+        RegionCost = SharedEptGetRegionCost((const UINT64 *)&SharedTable->PML2[EntryGroupIndex][0]);
+
+        if (RegionCost > g_EptState->MaximumRegionCost)
+        {
+            g_EptState->MaximumRegionCost = RegionCost;
+        }
     }
+
+    g_EptState->SharedPageTable = SharedTable;
+
+    SharedEptInitializeReservation(&g_EptState->PrivateTablesReservation, KeQueryActiveProcessorCount(0), g_EptState->MaximumRegionCost);
+
+    return TRUE;
 }
 
 /**
  * @brief Allocates page maps and create identity page table
+ * @details The PML2 tables and the reserved PML3 tables are the shared
+ * tables, so the shared tables should be created first
  *
  * @return PVMM_EPT_PAGE_TABLE identity map page-table
  */
 PVMM_EPT_PAGE_TABLE
 EptAllocateAndCreateIdentityPageTable(VOID)
 {
-    PVMM_EPT_PAGE_TABLE PageTable;
-    EPT_PML3_POINTER    PML3Template;
-    EPT_PML3_ENTRY      PML3TemplateLarge;
-    EPT_PML2_ENTRY      PML2EntryTemplate;
-    SIZE_T              EntryGroupIndex;
-    SIZE_T              EntryIndex;
+    PVMM_EPT_PAGE_TABLE        PageTable;
+    PVMM_EPT_SHARED_PAGE_TABLE SharedTable = g_EptState->SharedPageTable;
+    EPT_PML3_POINTER           PML3Template;
+    EPT_PML3_ENTRY             PML3TemplateLarge;
+    SIZE_T                     EntryIndex;
 
     //
     // Allocate all paging structures as 4KB aligned pages
@@ -708,7 +1136,10 @@ EptAllocateAndCreateIdentityPageTable(VOID)
         }
         else
         {
-            PageTable->PML4[i].PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(&PageTable->PML3_RSVD[i - 1][0]) / PAGE_SIZE;
+            //
+            // The reserved PML3 entries are shared by all of the cores
+            //
+            PageTable->PML4[i].PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(&SharedTable->PML3_RSVD[i - 1][0]) / PAGE_SIZE;
         }
     }
 
@@ -719,8 +1150,7 @@ EptAllocateAndCreateIdentityPageTable(VOID)
     //
     // Ensure stack memory is cleared
     //
-    PML3Template.AsUInt      = 0;
-    PML3TemplateLarge.AsUInt = 0;
+    PML3Template.AsUInt = 0;
 
     //
     // Set up one 'template' RWX PML3 entry and copy it into each of the 512 PML3 entries
@@ -730,24 +1160,19 @@ EptAllocateAndCreateIdentityPageTable(VOID)
     PML3Template.WriteAccess   = 1;
     PML3Template.ExecuteAccess = 1;
 
-    PML3TemplateLarge.LargePage     = 1;
-    PML3TemplateLarge.ReadAccess    = 1;
-    PML3TemplateLarge.WriteAccess   = 1;
-    PML3TemplateLarge.ExecuteAccess = 1;
-    PML3TemplateLarge.MemoryType    = MEMORY_TYPE_UNCACHEABLE;
-
     //
     // Copy the template into each of the 512 PML3 entry slots for the original entries
     //
     __stosq((SIZE_T *)&PageTable->PML3[0], PML3Template.AsUInt, VMM_EPT_PML3E_COUNT);
 
     //
-    // Copt the template into each of the 512 PML3 entry slots for the reserved entries
+    // The template of the 1GB pages of the regions that have a single memory type
     //
-    for (size_t i = 0; i < VMM_EPT_PML4E_COUNT - 1; i++)
-    {
-        __stosq((SIZE_T *)&PageTable->PML3_RSVD[i][0], PML3TemplateLarge.AsUInt, VMM_EPT_PML3E_COUNT);
-    }
+    PML3TemplateLarge.AsUInt        = 0;
+    PML3TemplateLarge.LargePage     = 1;
+    PML3TemplateLarge.ReadAccess    = 1;
+    PML3TemplateLarge.WriteAccess   = 1;
+    PML3TemplateLarge.ExecuteAccess = 1;
 
     //
     // For each of the 512 PML3 entries
@@ -755,74 +1180,89 @@ EptAllocateAndCreateIdentityPageTable(VOID)
     for (EntryIndex = 0; EntryIndex < VMM_EPT_PML3E_COUNT; EntryIndex++)
     {
         //
-        // Map the 1GB PML3 entry to 512 PML2 (2MB) entries to describe each large page
-        // NOTE: We do *not* manage any PML1 (4096 byte) entries and do not allocate them
+        // Map the 1GB PML3 entry to the shared 512 PML2 (2MB) entries to describe each large page,
+        // the region is privatized once the core changes it
         //
-        PageTable->PML3[EntryIndex].PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(&PageTable->PML2[EntryIndex][0]) / PAGE_SIZE;
-    }
+        PageTable->PML2[EntryIndex]                 = &SharedTable->PML2[EntryIndex][0];
+        PageTable->PML3[EntryIndex].PageFrameNumber = (SIZE_T)VirtualAddressToPhysicalAddress(PageTable->PML2[EntryIndex]) / PAGE_SIZE;
 
-    //
-    // For each of the 512 PML3 reserved entries for reserved PML3 entries
-    //
-    for (size_t i = 0; i < VMM_EPT_PML4E_COUNT - 1; i++)
-    {
-        for (size_t j = 0; j < VMM_EPT_PML3E_COUNT; j++)
+        //
+        // If the whole region has a single memory type, it's mapped by a 1GB page, and the
+        // page is split to the shared PML2 entries once the core changes the region
+        //
+        if (EptIsValidFor1GbPage(EntryIndex))
         {
-            //
-            // Map the 1GB PML3 reserved entry to 512 PML3 (1GB) entries to describe each large page
-            // NOTE: We do *not* manage them since they are reserved for out of 512 GB MMIO ranges
-            // The first 512GB is used for the main system memory and the rest is reserved for MMIO
-            //
-            PageTable->PML3_RSVD[i][j].PageFrameNumber = (SIZE_512_GB +                           // First 512GB is used for system memory
-                                                          (i * SIZE_512_GB) + (j * SIZE_1_GB)) >> // MMIO ranges
-                                                         30;                                      // Convert to page frame number
+            PML3TemplateLarge.PageFrameNumber = EntryIndex;
+            PML3TemplateLarge.MemoryType      = EptGetMemoryType(EntryIndex * VMM_EPT_PML2E_COUNT, TRUE);
+
+            PageTable->PML3[EntryIndex].AsUInt = PML3TemplateLarge.AsUInt;
         }
     }
 
-    //
-    // Now we will set up the PML2 entries, which are 2MB large pages
-    //
-    PML2EntryTemplate.AsUInt = 0;
+    return PageTable;
+}
 
-    //
-    // All PML2 entries will be RWX and 'present'
-    //
-    PML2EntryTemplate.WriteAccess   = 1;
-    PML2EntryTemplate.ReadAccess    = 1;
-    PML2EntryTemplate.ExecuteAccess = 1;
+/**
+ * @brief Reserve the pools of the private tables of the cores
+ * @details Each hook might privatize a 1GB region on each core, the tables
+ * are only reserved for the regions that are still shared (the reserved
+ * tables that are not used yet are counted)
+ *
+ * @param Count
+ * @return VOID
+ */
+VOID
+EptReservePrivatePageTables(UINT32 Count)
+{
+    UINT32 NumberOfTables;
 
-    //
-    // We are using 2MB large pages, so we must mark this 1 here
-    //
-    PML2EntryTemplate.LargePage = 1;
+    SpinlockLock(&EptPrivateTablesReservationLock);
 
-    //
-    // For each collection of 512 PML2 entries (512 collections * 512 entries per collection),
-    // mark it RWX using the same template above.
-    // This marks the entries as "Present" regardless of if the actual system has memory at
-    // this region or not. We will cause a fault in our EPT handler if the guest access a page
-    // outside a usable range, despite the EPT frame being present here
-    //
-    __stosq((SIZE_T *)&PageTable->PML2[0], PML2EntryTemplate.AsUInt, VMM_EPT_PML3E_COUNT * VMM_EPT_PML2E_COUNT);
+    NumberOfTables = SharedEptReserveRegions(&g_EptState->PrivateTablesReservation, Count);
+
+    SpinlockUnlock(&EptPrivateTablesReservationLock);
+
+    if (NumberOfTables != 0)
+    {
+        PoolManagerRequestAllocation(PAGE_SIZE, NumberOfTables, EPT_PRIVATE_PAGE_TABLE);
+    }
+}
+
+/**
+ * @brief Reserve the pools of the private tables of a 1GB region that is
+ * privatized right away
+ * @details Nothing is reserved if the region is already private on all
+ * of the cores
+ *
+ * @param PhysicalAddress
+ * @return VOID
+ */
+VOID
+EptReservePrivatePageTablesOfRegion(UINT64 PhysicalAddress)
+{
+    SIZE_T DirectoryPointer = ADDRMASK_EPT_PML3_INDEX(PhysicalAddress);
+    UINT32 NumberOfTables;
 
     //
-    // For each of the 512 collections of 512 2MB PML2 entries
+    // Addresses above 512GB are invalid because it is > physical address bus width
     //
-    for (EntryGroupIndex = 0; EntryGroupIndex < VMM_EPT_PML3E_COUNT; EntryGroupIndex++)
+    if (ADDRMASK_EPT_PML4_INDEX(PhysicalAddress) > 0)
     {
-        //
-        // For each 2MB PML2 entry in the collection
-        //
-        for (EntryIndex = 0; EntryIndex < VMM_EPT_PML2E_COUNT; EntryIndex++)
-        {
-            //
-            // Setup the memory type and frame number of the PML2 entry
-            //
-            EptSetupPML2Entry(PageTable, &PageTable->PML2[EntryGroupIndex][EntryIndex], (EntryGroupIndex * VMM_EPT_PML2E_COUNT) + EntryIndex);
-        }
+        return;
     }
 
-    return PageTable;
+    SpinlockLock(&EptPrivateTablesReservationLock);
+
+    NumberOfTables = SharedEptReserveRegion(&g_EptState->PrivateTablesReservation,
+                                            (UINT32)DirectoryPointer,
+                                            SharedEptGetRegionCost((const UINT64 *)&g_EptState->SharedPageTable->PML2[DirectoryPointer][0]));
+
+    SpinlockUnlock(&EptPrivateTablesReservationLock);
+
+    if (NumberOfTables != 0)
+    {
+        PoolManagerRequestAllocation(PAGE_SIZE, NumberOfTables, EPT_PRIVATE_PAGE_TABLE);
+    }
 }
 
 /**
@@ -843,6 +1283,15 @@ EptLogicalProcessorInitialize(VOID)
     //
     ProcessorsCount = KeQueryActiveProcessorCount(0);
 
+    //
+    // Allocate the tables of the identity map that are shared by the cores
+    //
+    if (!EptAllocateAndCreateSharedPageTable())
+    {
+        LogError("Err, unable to allocate memory for EPT");
+        return FALSE;
+    }
+
     for (size_t i = 0; i < ProcessorsCount; i++)
     {
         //
@@ -864,6 +1313,9 @@ EptLogicalProcessorInitialize(VOID)
                 }
             }
 
+            MmFreeContiguousMemory(g_EptState->SharedPageTable);
+            g_EptState->SharedPageTable = NULL;
+
             LogError("Err, unable to allocate memory for EPT");
             return FALSE;
         }
@@ -952,6 +1404,16 @@ EptHandlePageHookExit(VIRTUAL_MACHINE_STATE *              VCpu,
             // happens on 0x123b4600, so we perform the necessary checks here
             //
 
+            //
+            // The reads of the hidden hooks (and the executions after them) are
+            // handled by switching the core between the views
+            //
+            if (HookedEntry->IsExecutionHook && EptpSwitchingHandleHookViolation(VCpu, ViolationQualification))
+            {
+                IsHandled = TRUE;
+                break;
+            }
+
             if (GuestPhysicalAddr >= HookedEntry->StartOfTargetPhysicalAddress && GuestPhysicalAddr <= HookedEntry->EndOfTargetPhysicalAddress)
             {
                 ResultOfHandlingHook = EptHookHandleHookedPage(VCpu,
@@ -978,7 +1440,12 @@ EptHandlePageHookExit(VIRTUAL_MACHINE_STATE *              VCpu,
                 // if we don't apply the below restorations routines, the event
                 // won't redo and the emulation of the memory access is passed
                 //
-                if (!IgnoreReadOrWriteOrExec)
+                // The common data accesses are emulated in vmx-root mode, and the
+                // rest of them are performed by restoring the original entry for
+                // one instruction
+                //
+                if (!IgnoreReadOrWriteOrExec &&
+                    !EptHookEmulateMemoryAccess(VCpu, HookedEntry, ViolationQualification, GuestPhysicalAddr))
                 {
                     //
                     // Pointer to the page entry in the page table
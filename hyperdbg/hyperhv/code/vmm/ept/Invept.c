@@ -42,6 +42,12 @@ EptInveptSingleContext(_In_ UINT64 EptPointer)
     INVEPT_DESCRIPTOR Descriptor = {0};
     Descriptor.EptPointer        = EptPointer;
     Descriptor.Reserved          = 0;
+
+    //
+    // The read view of the hidden hooks is built from the changed EPT
+    //
+    EptpSwitchingInvalidateReadView(EptPointer);
+
     return EptInvept(InveptSingleContext, &Descriptor);
 }
 
@@ -53,5 +59,7 @@ EptInveptSingleContext(_In_ UINT64 EptPointer)
 UCHAR
 EptInveptAllContexts()
 {
+    EptpSwitchingInvalidateReadView(NULL64_ZERO);
+
     return EptInvept(InveptAllContext, NULL);
 }
@@ -29,6 +29,14 @@ CounterEmulateRdtsc(VIRTUAL_MACHINE_STATE * VCpu)
     UINT64      Tsc       = __rdtsc();
     PGUEST_REGS GuestRegs = VCpu->Regs;
 
+    //
+    // If TSC offsetting is enabled, the time spent in vmx-root is hidden
+    //
+    if (VCpu->TscOffsetState.IsEnabled)
+    {
+        Tsc = TscOffsetGetGuestTsc(&VCpu->TscOffsetState);
+    }
+
     GuestRegs->rax = 0x00000000ffffffff & Tsc;
     GuestRegs->rdx = 0x00000000ffffffff & (Tsc >> 32);
 }
@@ -46,6 +54,11 @@ CounterEmulateRdtscp(VIRTUAL_MACHINE_STATE * VCpu)
     UINT64      Tsc       = __rdtscp(&Aux);
     PGUEST_REGS GuestRegs = VCpu->Regs;
 
+    if (VCpu->TscOffsetState.IsEnabled)
+    {
+        Tsc = TscOffsetGetGuestTsc(&VCpu->TscOffsetState);
+    }
+
     GuestRegs->rax = 0x00000000ffffffff & Tsc;
     GuestRegs->rdx = 0x00000000ffffffff & (Tsc >> 32);
 
@@ -98,3 +111,198 @@ CounterClearPreemptionTimer()
     //
     VmxVmwrite64(VMCS_GUEST_VMX_PREEMPTION_TIMER_VALUE, NULL64_ZERO);
 }
+
+/**
+ * @brief Set the rdtsc/p exiting bit of the VMCS
+ * @details The protected resources are not checked, the caller decides
+ *
+ * @param Set
+ * @return VOID
+ */
+VOID
+CounterApplyRdtscExiting(BOOLEAN Set)
+{
+    UINT32 CpuBasedVmExecControls = 0;
+
+    VmxVmread32P(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+
+    if (Set)
+    {
+        CpuBasedVmExecControls |= IA32_VMX_PROCBASED_CTLS_RDTSC_EXITING_FLAG;
+    }
+    else
+    {
+        CpuBasedVmExecControls &= ~IA32_VMX_PROCBASED_CTLS_RDTSC_EXITING_FLAG;
+    }
+
+    VmxVmwrite64(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+}
+
+/**
+ * @brief Enable TSC offsetting on the current core
+ * @details Should be called in vmx-root, the rdtsc/p instructions
+ * no longer cause vm-exits unless the !tsc events need them
+ *
+ * @param VCpu The virtual processor's state
+ * @param TransitionOverhead The cycles of a vm-exit and vm-entry
+ * @param MaximumDeficit The maximum cycles that are hidden (limited to TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT)
+ * @param SamplingPeriod The cycles between two sampled rdtsc/p exits (zero means no sampling)
+ *
+ * @return VOID
+ */
+VOID
+CounterEnableTscOffsetting(VIRTUAL_MACHINE_STATE * VCpu,
+                           UINT64                  TransitionOverhead,
+                           UINT64                  MaximumDeficit,
+                           UINT64                  SamplingPeriod)
+{
+    UINT32 CpuBasedVmExecControls = 0;
+    UINT64 Tsc                    = __rdtsc();
+
+    VmxVmread32P(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+
+    //
+    // The rdtsc/p exiting of the !tsc events is kept, so it's enforced
+    // at the next vm-entry (the current vm-exit is already in the deficit)
+    //
+    if (!VCpu->TscOffsetState.IsEnabled)
+    {
+        VCpu->TscOffsetState.IsRdtscExitingRequested = (CpuBasedVmExecControls & IA32_VMX_PROCBASED_CTLS_RDTSC_EXITING_FLAG) ? TRUE : FALSE;
+    }
+
+    TscOffsetInitialize(&VCpu->TscOffsetState, TransitionOverhead, MaximumDeficit, SamplingPeriod, Tsc);
+
+    VCpu->TscOffsetState.IsInVmxRoot       = TRUE;
+    VCpu->TscOffsetState.IsRdtscExitingSet = (CpuBasedVmExecControls & IA32_VMX_PROCBASED_CTLS_RDTSC_EXITING_FLAG) ? TRUE : FALSE;
+
+    CpuBasedVmExecControls |= IA32_VMX_PROCBASED_CTLS_USE_TSC_OFFSETTING_FLAG;
+
+    VmxVmwrite64(VMCS_CTRL_TSC_OFFSET, NULL64_ZERO);
+    VmxVmwrite64(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+}
+
+/**
+ * @brief Disable TSC offsetting on the current core
+ * @details Should be called in vmx-root, the hidden cycles that are not
+ * given back yet are revealed at once
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+CounterDisableTscOffsetting(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    UINT32 CpuBasedVmExecControls = 0;
+
+    if (!VCpu->TscOffsetState.IsEnabled)
+    {
+        return;
+    }
+
+    VCpu->TscOffsetState.IsEnabled = FALSE;
+
+    VmxVmread32P(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+
+    CpuBasedVmExecControls &= ~IA32_VMX_PROCBASED_CTLS_USE_TSC_OFFSETTING_FLAG;
+
+    //
+    // Restore the rdtsc/p exiting that the !tsc events requested
+    //
+    if (VCpu->TscOffsetState.IsRdtscExitingRequested)
+    {
+        CpuBasedVmExecControls |= IA32_VMX_PROCBASED_CTLS_RDTSC_EXITING_FLAG;
+    }
+    else
+    {
+        CpuBasedVmExecControls &= ~IA32_VMX_PROCBASED_CTLS_RDTSC_EXITING_FLAG;
+    }
+
+    VmxVmwrite64(VMCS_CTRL_TSC_OFFSET, NULL64_ZERO);
+    VmxVmwrite64(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+}
+
+/**
+ * @brief Account the start of a vm-exit for TSC offsetting
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+CounterTscOffsettingHandleVmexit(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    TscOffsetHandleVmexit(&VCpu->TscOffsetState, __rdtsc());
+}
+
+/**
+ * @brief Write the TSC offset before resuming the guest
+ * @details The rdtsc/p exiting is also updated here, since the sampling
+ * of the !tsc events depends on the TSC
+ *
+ * @param VCpu The virtual processor's state
+ *
+ * @return VOID
+ */
+VOID
+CounterTscOffsettingHandleVmresume(VIRTUAL_MACHINE_STATE * VCpu)
+{
+    BOOLEAN IsRdtscExitingNeeded;
+    UINT64  Tsc = __rdtsc();
+
+    IsRdtscExitingNeeded = TscOffsetIsRdtscExitingNeeded(&VCpu->TscOffsetState, Tsc);
+
+    if (IsRdtscExitingNeeded != VCpu->TscOffsetState.IsRdtscExitingSet)
+    {
+        CounterApplyRdtscExiting(IsRdtscExitingNeeded);
+        VCpu->TscOffsetState.IsRdtscExitingSet = IsRdtscExitingNeeded;
+    }
+
+    //
+    // The TSC is read again to hide the cost of the above vmwrites as well
+    //
+    VmxVmwrite64(VMCS_CTRL_TSC_OFFSET, TscOffsetHandleVmresume(&VCpu->TscOffsetState, __rdtsc()));
+}
+
+/**
+ * @brief Query the statistics of TSC offsetting of all cores
+ *
+ * @param TscOffsettingRequest
+ *
+ * @return VOID
+ */
+VOID
+CounterQueryTscOffsetting(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest)
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    TscOffsettingRequest->NumberOfEnabledCores      = 0;
+    TscOffsettingRequest->NumberOfVmexits           = 0;
+    TscOffsettingRequest->NumberOfSampledRdtscExits = 0;
+    TscOffsettingRequest->HiddenCycles              = 0;
+    TscOffsettingRequest->RepaidCycles              = 0;
+    TscOffsettingRequest->LeakedCycles              = 0;
+    TscOffsettingRequest->MaximumCurrentDeficit     = 0;
+
+    for (ULONG i = 0; i < ProcessorsCount; i++)
+    {
+        PTSC_OFFSET_STATE State = &g_GuestState[i].TscOffsetState;
+
+        if (!State->IsEnabled)
+        {
+            continue;
+        }
+
+        TscOffsettingRequest->NumberOfEnabledCores++;
+        TscOffsettingRequest->NumberOfVmexits += State->NumberOfVmexits;
+        TscOffsettingRequest->NumberOfSampledRdtscExits += State->NumberOfSampledRdtscExits;
+        TscOffsettingRequest->HiddenCycles += State->HiddenCycles;
+        TscOffsettingRequest->RepaidCycles += State->RepaidCycles;
+        TscOffsettingRequest->LeakedCycles += State->LeakedCycles;
+
+        if (State->Deficit > TscOffsettingRequest->MaximumCurrentDeficit)
+        {
+            TscOffsettingRequest->MaximumCurrentDeficit = State->Deficit;
+        }
+    }
+}
@@ -52,7 +52,17 @@ VmxHandleXsetbv(VIRTUAL_MACHINE_STATE * VCpu)
 VOID
 VmxHandleVmxPreemptionTimerVmexit(VIRTUAL_MACHINE_STATE * VCpu)
 {
-    LogError("Why vm-exit for VMX preemption timer happened?");
+    if (VCpu->ProfilerState.IsEnabled)
+    {
+        //
+        // Take a sample for the profiler
+        //
+        ProfilerHandleVmxPreemptionTimerVmexit(VCpu);
+    }
+    else
+    {
+        LogError("Why vm-exit for VMX preemption timer happened?");
+    }
 
     //
     // Not increase the RIP by default
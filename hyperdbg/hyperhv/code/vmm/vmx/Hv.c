@@ -1025,6 +1025,78 @@ HvSetVmxPreemptionTimerExiting(BOOLEAN Set)
     VmxVmwrite64(VMCS_CTRL_PIN_BASED_VM_EXECUTION_CONTROLS, PinBasedControls);
 }
 
+/**
+ * @brief Set saving the VMX preemption timer value on vm-exits
+ * @details If it's not set, the timer starts from the value of the VMCS
+ * after each vm-entry
+ *
+ * @param Set Set or unset saving the VMX preemption timer value
+ * @return VOID
+ */
+VOID
+HvSetSaveVmxPreemptionTimerValue(BOOLEAN Set)
+{
+    UINT32 VmExitControls = 0;
+
+    //
+    // Read the previous flags
+    //
+    VmxVmread32P(VMCS_CTRL_PRIMARY_VMEXIT_CONTROLS, &VmExitControls);
+
+    if (Set)
+    {
+        VmExitControls |= IA32_VMX_EXIT_CTLS_SAVE_VMX_PREEMPTION_TIMER_VALUE_FLAG;
+    }
+    else
+    {
+        VmExitControls &= ~IA32_VMX_EXIT_CTLS_SAVE_VMX_PREEMPTION_TIMER_VALUE_FLAG;
+    }
+
+    //
+    // Set the new value
+    //
+    VmxVmwrite64(VMCS_CTRL_PRIMARY_VMEXIT_CONTROLS, VmExitControls);
+}
+
+/**
+ * @brief Set loading IA32_RTIT_CTL on vm-entries and clearing it on
+ * vm-exits
+ * @details The guest is traced by Intel Processor Trace with the value of
+ * the VMCS, and the vmx-root is not traced
+ *
+ * @param Set Set or unset the controls
+ * @return VOID
+ */
+VOID
+HvSetProcessorTraceControls(BOOLEAN Set)
+{
+    UINT32 VmentryControls = 0;
+    UINT32 VmExitControls  = 0;
+
+    //
+    // Read the previous flags
+    //
+    VmxVmread32P(VMCS_CTRL_VMENTRY_CONTROLS, &VmentryControls);
+    VmxVmread32P(VMCS_CTRL_PRIMARY_VMEXIT_CONTROLS, &VmExitControls);
+
+    if (Set)
+    {
+        VmentryControls |= PROCESSOR_TRACE_ENTRY_CTLS_LOAD_RTIT_CTL_FLAG;
+        VmExitControls |= PROCESSOR_TRACE_EXIT_CTLS_CLEAR_RTIT_CTL_FLAG;
+    }
+    else
+    {
+        VmentryControls &= ~PROCESSOR_TRACE_ENTRY_CTLS_LOAD_RTIT_CTL_FLAG;
+        VmExitControls &= ~PROCESSOR_TRACE_EXIT_CTLS_CLEAR_RTIT_CTL_FLAG;
+    }
+
+    //
+    // Set the new values
+    //
+    VmxVmwrite64(VMCS_CTRL_VMENTRY_CONTROLS, VmentryControls);
+    VmxVmwrite64(VMCS_CTRL_PRIMARY_VMEXIT_CONTROLS, VmExitControls);
+}
+
 /**
  * @brief Set exception bitmap in VMCS
  * @details Should be called in vmx-root
@@ -1378,6 +1450,12 @@ HvInitVmm(VMM_CALLBACKS * VmmCallbacks)
     //
     MemoryMapperInitialize();
 
+    //
+    // Locate the kernel image, its SYSCALL and SYSRET sites are trusted by
+    // the cache of the sites
+    //
+    SyscallHookLocateKernelImage();
+
     //
     // Make sure that transparent-mode is disabled
     //
@@ -134,7 +134,17 @@ MsrHandleRdmsrVmexit(VIRTUAL_MACHINE_STATE * VCpu)
             //
             // Msr is valid
             //
-            Msr.Flags = __readmsr(TargetMsr);
+            if (TargetMsr == IA32_TIME_STAMP_COUNTER && VCpu->TscOffsetState.IsEnabled)
+            {
+                //
+                // The time spent in vmx-root is hidden from the guest
+                //
+                Msr.Flags = TscOffsetGetGuestTsc(&VCpu->TscOffsetState);
+            }
+            else
+            {
+                Msr.Flags = __readmsr(TargetMsr);
+            }
 
             //
             // Check if it's EFER MSR then we show a false SCE state
@@ -307,6 +307,16 @@ ProtectedHvSetTscVmexit(VIRTUAL_MACHINE_STATE * VCpu, BOOLEAN Set, PROTECTED_HV_
         }
     }
 
+    //
+    // If TSC offsetting is enabled, the rdtsc/p exiting is applied (and
+    // sampled) before resuming the guest
+    //
+    if (VCpu->TscOffsetState.IsEnabled)
+    {
+        VCpu->TscOffsetState.IsRdtscExitingRequested = Set;
+        return;
+    }
+
     //
     // Read the previous flags
     //
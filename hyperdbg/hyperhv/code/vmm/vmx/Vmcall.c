@@ -534,6 +534,76 @@ VmxVmcallHandler(VIRTUAL_MACHINE_STATE * VCpu,
 
         break;
     }
+    case VMCALL_SET_TSC_OFFSETTING:
+    {
+        CounterEnableTscOffsetting(VCpu,
+                                   OptionalParam1,  /* TransitionOverhead */
+                                   OptionalParam2,  /* MaximumDeficit */
+                                   OptionalParam3); /* SamplingPeriod */
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_UNSET_TSC_OFFSETTING:
+    {
+        CounterDisableTscOffsetting(VCpu);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_SET_HIDDEN_CC_BREAKPOINTS_BATCH:
+    {
+        BOOLEAN HookResult = FALSE;
+
+        HookResult = EptHookPerformPageHookBatch(VCpu,
+                                                 (EPT_HOOK_BATCH_REQUEST *)OptionalParam1); /* the batch */
+
+        VmcallStatus = (HookResult == TRUE) ? STATUS_SUCCESS : STATUS_UNSUCCESSFUL;
+
+        break;
+    }
+    case VMCALL_UNHOOK_PAGES_BATCH:
+    {
+        EptHookRestoreBatchToOriginalEntries(VCpu, (EPT_HOOK_BATCH_UNHOOKING_DETAILS *)OptionalParam1);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_ENABLE_PROFILER:
+    {
+        ProfilerEnable(VCpu,
+                       OptionalParam1,          /* Period */
+                       (UINT32)OptionalParam2); /* StackDepth */
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_DISABLE_PROFILER:
+    {
+        ProfilerDisable(VCpu);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_ENABLE_PROCESSOR_TRACE:
+    {
+        ProcessorTraceEnable(VCpu);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_DISABLE_PROCESSOR_TRACE:
+    {
+        ProcessorTraceDisable(VCpu);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_ENABLE_LBR:
+    {
+        LbrEnable(VCpu);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
+    case VMCALL_DISABLE_LBR:
+    {
+        LbrDisable(VCpu);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
     default:
     {
         LogError("Err, unsupported VMCALL");
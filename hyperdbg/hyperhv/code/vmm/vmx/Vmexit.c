@@ -30,6 +30,14 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
     //
     VCpu = &g_GuestState[KeGetCurrentProcessorNumberEx(NULL)];
 
+    //
+    // Start accounting the time spent in vmx-root (if TSC offsetting is enabled)
+    //
+    if (VCpu->TscOffsetState.IsEnabled)
+    {
+        CounterTscOffsettingHandleVmexit(VCpu);
+    }
+
     //
     // Set the registers (general-purpose and XMM)
     //
@@ -122,6 +130,7 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
     case VMX_EXIT_REASON_EXECUTE_INVVPID:
     case VMX_EXIT_REASON_EXECUTE_GETSEC:
     case VMX_EXIT_REASON_EXECUTE_INVD:
+    case EPTP_SWITCHING_VMX_EXIT_REASON_VMFUNC:
     {
         //
         // Handle unconditional vm-exits (inject #ud)
@@ -207,6 +216,15 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
 
         break;
     }
+    case SPP_VMX_EXIT_REASON_SPP_RELATED_EVENT:
+    {
+        //
+        // Handle SPP misses and misconfigurations (should never happen)
+        //
+        SubPageWritePermissionsHandleVmexit(VCpu);
+
+        break;
+    }
     case VMX_EXIT_REASON_EXECUTE_VMCALL:
     {
         //
@@ -277,6 +295,11 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
     case VMX_EXIT_REASON_EXECUTE_RDTSCP:
 
     {
+        //
+        // Sampling of the rdtsc/p exits (if TSC offsetting is enabled)
+        //
+        TscOffsetHandleRdtscVmexit(&VCpu->TscOffsetState);
+
         //
         // Check whether we are allowed to change the registers
         // and emulate rdtsc or not
@@ -368,6 +391,14 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
         Result = TRUE;
     }
 
+    //
+    // Hide the time spent in vmx-root from the guest (if TSC offsetting is enabled)
+    //
+    if (!Result && VCpu->TscOffsetState.IsEnabled)
+    {
+        CounterTscOffsettingHandleVmresume(VCpu);
+    }
+
     //
     // Set indicator of Vmx non root mode to false
     //
@@ -412,6 +412,8 @@ VmxInitialize()
 BOOLEAN
 VmxPerformVirtualizationOnAllCores()
 {
+    PDETOUR_HASH_ENTRY DetourHashEntries;
+
     PAGED_CODE();
 
     if (!VmxCheckVmxSupport())
@@ -436,6 +438,20 @@ VmxPerformVirtualizationOnAllCores()
     //
     InitializeListHead(&g_EptState->HookedPagesList);
 
+    //
+    // Allocate the hash of the detours of !epthook2, it's used by the
+    // handler of the detours instead of walking the list of the detours
+    //
+    DetourHashEntries = PlatformMemAllocateZeroedNonPagedPool(sizeof(DETOUR_HASH_ENTRY) * EPT_HOOK2_DETOUR_HASH_CAPACITY);
+
+    if (!DetourHashEntries)
+    {
+        LogError("Err, insufficient memory");
+        return FALSE;
+    }
+
+    DetourHashInitialize(&g_EptState->EptHook2sDetourHash, DetourHashEntries, EPT_HOOK2_DETOUR_HASH_CAPACITY);
+
     //
     // Check whether EPT is supported or not
     //
@@ -472,6 +488,11 @@ VmxPerformVirtualizationOnAllCores()
         return FALSE;
     }
 
+    //
+    // Initialize the sub-page write permissions of the monitor hooks (if supported)
+    //
+    SubPageWritePermissionsInitialize();
+
     if (!EptLogicalProcessorInitialize())
     {
         //
@@ -480,6 +501,11 @@ VmxPerformVirtualizationOnAllCores()
         return FALSE;
     }
 
+    //
+    // Initialize the views of the hidden hooks (if enabled)
+    //
+    EptpSwitchingInitialize();
+
     //
     // Broadcast to run vmx-specific task to virtualize cores
     //
@@ -893,7 +919,9 @@ VmxSetupVmcs(VIRTUAL_MACHINE_STATE * VCpu, PVOID GuestStack)
             IA32_VMX_PROCBASED_CTLS2_ENABLE_INVPCID_FLAG |
             IA32_VMX_PROCBASED_CTLS2_ENABLE_XSAVES_FLAG |
             IA32_VMX_PROCBASED_CTLS2_ENABLE_VPID_FLAG |
-            IA32_VMX_PROCBASED_CTLS2_ENABLE_USER_WAIT_PAUSE_FLAG,
+            IA32_VMX_PROCBASED_CTLS2_ENABLE_USER_WAIT_PAUSE_FLAG |
+            (g_CompatibilityCheck.SppSupport ? SPP_PROCBASED_CTLS2_FLAG : 0) |
+            (g_CompatibilityCheck.EptpSwitchingSupport ? EPTP_SWITCHING_PROCBASED_CTLS2_FLAG : 0),
         IA32_VMX_PROCBASED_CTLS2);
 
     VmxVmwrite64(VMCS_CTRL_SECONDARY_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, SecondaryProcBasedVmExecControls);
@@ -1000,6 +1028,19 @@ VmxSetupVmcs(VIRTUAL_MACHINE_STATE * VCpu, PVOID GuestStack)
     //
     VmxVmwrite64(VMCS_CTRL_EPT_POINTER, VCpu->EptPointer.AsUInt);
 
+    //
+    // Set up the tables of the sub-page write permissions (shared by all of the cores)
+    //
+    if (g_CompatibilityCheck.SppSupport)
+    {
+        VmxVmwrite64(SPP_VMCS_CTRL_TABLE_POINTER, g_EptState->SppTable.RootPhysicalAddress);
+    }
+
+    //
+    // Set up the EPTP list of the views of the hidden hooks
+    //
+    EptpSwitchingSetupVmcs(VCpu);
+
     //
     // Set up VPID
 
@@ -1283,18 +1324,52 @@ VmxPerformTermination()
     g_MsrBitmapInvalidMsrs = NULL;
 
     //
-    // Free Identity Page Table
+    // Free Identity Page Table (and the private copies of the shared tables)
     //
     for (size_t i = 0; i < ProcessorsCount; i++)
     {
         if (g_GuestState[i].EptPageTable != NULL)
         {
+            EptFreePrivatePageTables(g_GuestState[i].EptPageTable);
             MmFreeContiguousMemory(g_GuestState[i].EptPageTable);
         }
 
         g_GuestState[i].EptPageTable = NULL;
     }
 
+    //
+    // Free the tables of the identity map that are shared by the cores
+    //
+    if (g_EptState->SharedPageTable != NULL)
+    {
+        MmFreeContiguousMemory(g_EptState->SharedPageTable);
+        g_EptState->SharedPageTable = NULL;
+    }
+
+    //
+    // Free the views of the hidden hooks
+    //
+    EptpSwitchingUninitialize();
+
+    //
+    // Free the histograms of the sampling profiler
+    //
+    ProfilerUninitialize();
+
+    //
+    // Free the output buffers of Intel Processor Trace
+    //
+    ProcessorTraceUninitialize();
+
+    //
+    // Free the hash of the detours
+    //
+    if (g_EptState->EptHook2sDetourHash.Entries != NULL)
+    {
+        PlatformMemFreePool(g_EptState->EptHook2sDetourHash.Entries);
+        g_EptState->EptHook2sDetourHash.Entries = NULL;
+    }
+
     //
     // Free EptState
     //
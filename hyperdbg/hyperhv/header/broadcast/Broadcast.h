@@ -44,3 +44,21 @@ BroadcasDisableMbecOnAllProcessors();
 
 VOID
 BroadcasEnableMbecOnAllProcessors();
+
+VOID
+BroadcastEnableProfilerAllCores(PPROFILER_OPERATION_PACKETS ProfilerRequest);
+
+VOID
+BroadcastDisableProfilerAllCores();
+
+VOID
+BroadcastEnableProcessorTraceAllCores();
+
+VOID
+BroadcastDisableProcessorTraceAllCores();
+
+VOID
+BroadcastEnableLbrAllCores();
+
+VOID
+BroadcastDisableLbrAllCores();
@@ -98,6 +98,31 @@ typedef enum _EPT_HOOKED_LAST_VIOLATION
  */
 #define VMM_EPT_PML1E_COUNT 512
 
+/**
+ * @brief Structure for saving the EPT tables that are shared by all of the cores
+ *
+ */
+typedef struct _VMM_EPT_SHARED_PAGE_TABLE
+{
+    /**
+     * @brief Describes exactly 512 contiguous 1GB memory regions within a our singular 512GB PML4 region
+     * (This entry is used to support the entire address space).
+     * @details The reason why there is a minus one here is that the original PML3 is described in the
+     * page table of the cores.
+     */
+    DECLSPEC_ALIGN(PAGE_SIZE)
+    EPT_PML3_ENTRY PML3_RSVD[VMM_EPT_PML4E_COUNT - 1][VMM_EPT_PML3E_COUNT];
+
+    /**
+     * @brief For each 1GB PML3 entry, create 512 2MB entries to map identity.
+     * NOTE: We are using 2MB pages as the smallest paging size in our map, so we do not manage individual 4096 byte pages.
+     * Therefore, we do not allocate any PML1 (4096 byte) paging structures.
+     */
+    DECLSPEC_ALIGN(PAGE_SIZE)
+    EPT_PML2_ENTRY PML2[VMM_EPT_PML3E_COUNT][VMM_EPT_PML2E_COUNT];
+
+} VMM_EPT_SHARED_PAGE_TABLE, *PVMM_EPT_SHARED_PAGE_TABLE;
+
 /**
  * @brief Structure for saving EPT Table
  *
@@ -111,26 +136,22 @@ typedef struct _VMM_EPT_PAGE_TABLE
     EPT_PML4_POINTER PML4[VMM_EPT_PML4E_COUNT];
 
     /**
-     * @brief Describes exactly 512 contiguous 1GB memory regions within a our singular 512GB PML4 region
-     * (This entry is used to support the entire address space).
-     * @details The reason why there is a minus one here is that the original PML3 is described in the next field.
+     * @brief Describes exactly 512 contiguous 1GB memory regions within a our singular 512GB PML4 region.
      */
     DECLSPEC_ALIGN(PAGE_SIZE)
-    EPT_PML3_ENTRY PML3_RSVD[VMM_EPT_PML4E_COUNT - 1][VMM_EPT_PML3E_COUNT];
+    EPT_PML3_POINTER PML3[VMM_EPT_PML3E_COUNT];
 
     /**
-     * @brief Describes exactly 512 contiguous 1GB memory regions within a our singular 512GB PML4 region.
+     * @brief The PML2 tables (512 2MB entries) of each 1GB PML3 entry, they point to the shared
+     * tables until the core changes the region, then they point to the private copies of the core
      */
-    DECLSPEC_ALIGN(PAGE_SIZE)
-    EPT_PML3_POINTER PML3[VMM_EPT_PML3E_COUNT];
+    PEPT_PML2_ENTRY PML2[VMM_EPT_PML3E_COUNT];
 
     /**
-     * @brief For each 1GB PML3 entry, create 512 2MB entries to map identity.
-     * NOTE: We are using 2MB pages as the smallest paging size in our map, so we do not manage individual 4096 byte pages.
-     * Therefore, we do not allocate any PML1 (4096 byte) paging structures.
+     * @brief Whether the private copies of each 1GB region are allocated from the pre-allocated
+     * pools or not, the copies are freed the same way once the core is terminated
      */
-    DECLSPEC_ALIGN(PAGE_SIZE)
-    EPT_PML2_ENTRY PML2[VMM_EPT_PML3E_COUNT][VMM_EPT_PML2E_COUNT];
+    BOOLEAN PrivateTablesFromPool[VMM_EPT_PML3E_COUNT];
 
 } VMM_EPT_PAGE_TABLE, *PVMM_EPT_PAGE_TABLE;
 
@@ -296,6 +317,52 @@ typedef struct _NMI_BROADCASTING_STATE
 
 } NMI_BROADCASTING_STATE, *PNMI_BROADCASTING_STATE;
 
+/**
+ * @brief The state of the sampling profiler on each core
+ *
+ */
+typedef struct _PROFILER_CORE_STATE
+{
+    BOOLEAN                  IsEnabled;  // Whether the VMX-preemption timer samples this core or not
+    UINT32                   TimerValue; // Ticks of the VMX-preemption timer between two samples
+    UINT32                   StackDepth; // Count of the return addresses that are recorded for each sample
+    SAMPLE_PROFILE_HISTOGRAM Histogram;  // The samples of this core (allocated in vmx non-root)
+
+} PROFILER_CORE_STATE, *PPROFILER_CORE_STATE;
+
+/**
+ * @brief The state of Intel Processor Trace on each core
+ * @details The output buffer is a single region of ToPA, the END entry
+ * points to the same table, so the buffer is a ring
+ *
+ */
+typedef struct _PROCESSOR_TRACE_CORE_STATE
+{
+    BOOLEAN  IsEnabled;   // Whether the guest of this core is traced or not
+    UINT8 *  Buffer;      // The output buffer (allocated in vmx non-root)
+    UINT32   BufferSize;  // A power of two
+    UINT64 * Topa;        // The table of ToPA (a page)
+    UINT64   Control;     // IA32_RTIT_CTL of the guest (TraceEn is set when the tracing is enabled)
+    UINT64   Cr3Match;    // IA32_RTIT_CR3_MATCH
+    UINT64   AddressA;    // IA32_RTIT_ADDR0_A
+    UINT64   AddressB;    // IA32_RTIT_ADDR0_B
+    UINT32   WriteOffset; // The next byte of the buffer that is written (the oldest byte)
+    UINT32   Status;      // IA32_RTIT_STATUS after the tracing is disabled
+
+} PROCESSOR_TRACE_CORE_STATE, *PPROCESSOR_TRACE_CORE_STATE;
+
+/**
+ * @brief The state of the Last Branch Records on each core
+ *
+ */
+typedef struct _LBR_CORE_STATE
+{
+    BOOLEAN IsConfigured; // Whether the core is chosen for recording the branches
+    BOOLEAN IsEnabled;    // Whether IA32_DEBUGCTL.LBR of the guest is set by the debugger
+    UINT32  Select;       // MSR_LBR_SELECT
+
+} LBR_CORE_STATE, *PLBR_CORE_STATE;
+
 /**
  * @brief The status of each core after and before VMX
  *
@@ -340,15 +407,20 @@ typedef struct _VIRTUAL_MACHINE_STATE
                                                                                     // Pending interrupt queue (FIFO).
                                                                                     // Make storage for up-to 64 pending interrupts.
                                                                                     // In practice I haven't seen more than 2 pending interrupts.
-    VMX_VMXOFF_STATE        VmxoffState;                                            // Shows the vmxoff state of the guest
-    NMI_BROADCASTING_STATE  NmiBroadcastingState;                                   // Shows the state of NMI broadcasting
-    VM_EXIT_TRANSPARENCY    TransparencyState;                                      // The state of the debugger in transparent-mode
-    PEPT_HOOKED_PAGE_DETAIL MtfEptHookRestorePoint;                                 // It shows the detail of the hooked paged that should be restore in MTF vm-exit
-    UINT8                   LastExceptionOccurredInHost;                            // The vector of last exception occurred in host
-    UINT64                  HostIdt;                                                // host Interrupt Descriptor Table (actual type is SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64*)
-    UINT64                  HostGdt;                                                // host Global Descriptor Table (actual type is SEGMENT_DESCRIPTOR_32* or SEGMENT_DESCRIPTOR_64*)
-    UINT64                  HostTss;                                                // host Task State Segment (actual type is TASK_STATE_SEGMENT_64*)
-    UINT64                  HostInterruptStack;                                     // host interrupt RSP
+    VMX_VMXOFF_STATE           VmxoffState;                                         // Shows the vmxoff state of the guest
+    NMI_BROADCASTING_STATE     NmiBroadcastingState;                                // Shows the state of NMI broadcasting
+    VM_EXIT_TRANSPARENCY       TransparencyState;                                   // The state of the debugger in transparent-mode
+    PEPT_HOOKED_PAGE_DETAIL    MtfEptHookRestorePoint;                              // It shows the detail of the hooked paged that should be restore in MTF vm-exit
+    UINT8                      LastExceptionOccurredInHost;                         // The vector of last exception occurred in host
+    UINT64                     HostIdt;                                             // host Interrupt Descriptor Table (actual type is SEGMENT_DESCRIPTOR_INTERRUPT_GATE_64*)
+    UINT64                     HostGdt;                                             // host Global Descriptor Table (actual type is SEGMENT_DESCRIPTOR_32* or SEGMENT_DESCRIPTOR_64*)
+    UINT64                     HostTss;                                             // host Task State Segment (actual type is TASK_STATE_SEGMENT_64*)
+    UINT64                     HostInterruptStack;                                  // host interrupt RSP
+    TSC_OFFSET_STATE           TscOffsetState;                                      // The state of hiding the time spent in vmx-root by TSC offsetting
+    SYSCALL_SITE_CACHE         SyscallSiteCache;                                    // The verified SYSCALL and SYSRET sites of the EFER syscall hook
+    PROFILER_CORE_STATE        ProfilerState;                                       // The state of the sampling profiler (VMX-preemption timer)
+    PROCESSOR_TRACE_CORE_STATE ProcessorTraceState;                                 // The state of Intel Processor Trace
+    LBR_CORE_STATE             LbrState;                                            // The state of the Last Branch Records
 
     //
     // EPT Descriptors
@@ -356,4 +428,12 @@ typedef struct _VIRTUAL_MACHINE_STATE
     EPT_POINTER         EptPointer;   // Extended-Page-Table Pointer
     PVMM_EPT_PAGE_TABLE EptPageTable; // Details of core-specific page-table
 
+    //
+    // Views of the hidden hooks
+    //
+    EPTP_VIEW_LIST    EptpViewList;          // EPTP list of the execute view and the read view
+    EPTP_VIEW_OVERLAY EptpReadView;          // The read view (the hooked pages are readable but not executable)
+    BOOLEAN           EptpReadViewIsValid;   // Whether the read view is built from the current EPT or not
+    UINT64            EptpReadViewSwitchRip; // The instruction that switched the core to the read view
+
 } VIRTUAL_MACHINE_STATE, *PVIRTUAL_MACHINE_STATE;
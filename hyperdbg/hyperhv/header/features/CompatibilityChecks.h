@@ -25,10 +25,16 @@ typedef struct _COMPATIBILITY_CHECKS_STATUS
     BOOLEAN IsX2Apic;                  // X2APIC or XAPIC routine
     BOOLEAN RtmSupport;                // check for RTM support
     BOOLEAN PmlSupport;                // check Page Modification Logging (PML) support
+    BOOLEAN SppSupport;                // check sub-page write permissions (SPP) support
+    BOOLEAN EptpSwitchingSupport;      // check EPTP switching (VMFUNC 0) support
     BOOLEAN ModeBasedExecutionSupport; // check for mode based execution support (processors after Kaby Lake release will support this feature)
     BOOLEAN ExecuteOnlySupport;        // Support for execute-only pages (indicating that data accesses are not allowed while instruction fetches are allowed)
+    BOOLEAN Ept1GbPagesSupport;        // Support for 1GB pages in EPT (used for the regions that have a single memory type)
     BOOLEAN CetIbtSupport;             // CET IBT support (indicating that indirect branch tracking is supported)
     BOOLEAN CetShadowStackSupport;     // CET shadow stack support (indicating that shadow stacks are supported)
+    BOOLEAN VmxPreemptionTimerSupport; // Support for the VMX-preemption timer and saving its value on vm-exits (used by the sampling profiler)
+    BOOLEAN ProcessorTraceSupport;     // Support for Intel Processor Trace (ToPA) in VMX operation, and loading and clearing IA32_RTIT_CTL by the VMCS
+    BOOLEAN LbrSupport;                // Support for the (legacy) Last Branch Records of a known model, and loading and saving IA32_DEBUGCTL by the VMCS
     UINT32  VirtualAddressWidth;       // Virtual address width for x86 processors
     UINT32  PhysicalAddressWidth;      // Physical address width for x86 processors
 
@@ -0,0 +1,78 @@
+/**
+ * @file EptpSwitching.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for switching the EPTP views of the hidden hooks
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Secondary processor-based VM-execution control 13 is defined as
+ * enable VM functions
+ *
+ */
+#define EPTP_SWITCHING_PROCBASED_CTLS2_FLAG 0x00002000
+
+/**
+ * @brief The IA32_VMX_VMFUNC MSR (bit 0 shows the support of the EPTP
+ * switching)
+ *
+ */
+#define EPTP_SWITCHING_MSR_IA32_VMX_VMFUNC 0x00000491
+
+/**
+ * @brief The VM-function controls and the EPTP-list address fields of the
+ * VMCS
+ *
+ */
+#define EPTP_SWITCHING_VMCS_CTRL_VMFUNC_CONTROLS 0x00002018
+#define EPTP_SWITCHING_VMCS_CTRL_LIST_ADDRESS    0x00002024
+
+/**
+ * @brief The exit reason of VMFUNC (the functions other than the EPTP
+ * switching and the invalid indexes of the EPTP list)
+ *
+ */
+#define EPTP_SWITCHING_VMX_EXIT_REASON_VMFUNC 59
+
+/**
+ * @brief Maximum tables of the read view of each core (the root, the PML3
+ * and two tables for each 2 MB page of the hooked pages in the worst case)
+ *
+ */
+#define EPTP_SWITCHING_MAXIMUM_TABLES 64
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+EptpSwitchingInitialize();
+
+VOID
+EptpSwitchingUninitialize();
+
+PVOID
+EptpSwitchingPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context);
+
+VOID
+EptpSwitchingSetupVmcs(VIRTUAL_MACHINE_STATE * VCpu);
+
+BOOLEAN
+EptpSwitchingHandleHookViolation(VIRTUAL_MACHINE_STATE *              VCpu,
+                                 VMX_EXIT_QUALIFICATION_EPT_VIOLATION ViolationQualification);
+
+VOID
+EptpSwitchingRestoreExecuteView(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+EptpSwitchingInvalidateReadView(UINT64 EptPointer);
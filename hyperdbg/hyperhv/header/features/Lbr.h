@@ -0,0 +1,28 @@
+/**
+ * @file Lbr.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for the Last Branch Records
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+VOID
+LbrEnable(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+LbrDisable(VIRTUAL_MACHINE_STATE * VCpu);
+
+BOOLEAN
+LbrPerformOperation(PLBR_OPERATION_PACKETS LbrRequest);
+
+UINT32
+LbrCaptureSnapshot(PLBR_DECODE_RECORD Records, UINT32 MaximumRecords);
@@ -0,0 +1,85 @@
+/**
+ * @file ProcessorTrace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for Intel Processor Trace
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The MSRs of Intel Processor Trace
+ *
+ */
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_OUTPUT_BASE      0x00000560
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_OUTPUT_MASK_PTRS 0x00000561
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_CTL              0x00000570
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_STATUS           0x00000571
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_CR3_MATCH        0x00000572
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_ADDR0_A          0x00000580
+#define PROCESSOR_TRACE_MSR_IA32_RTIT_ADDR0_B          0x00000581
+
+/**
+ * @brief The bits of IA32_RTIT_CTL
+ *
+ */
+#define PROCESSOR_TRACE_CTL_TRACE_EN         (1ull << 0)
+#define PROCESSOR_TRACE_CTL_OS               (1ull << 2)
+#define PROCESSOR_TRACE_CTL_USER             (1ull << 3)
+#define PROCESSOR_TRACE_CTL_CR3_FILTER       (1ull << 7)
+#define PROCESSOR_TRACE_CTL_TOPA             (1ull << 8)
+#define PROCESSOR_TRACE_CTL_TSC_EN           (1ull << 10)
+#define PROCESSOR_TRACE_CTL_BRANCH_EN        (1ull << 13)
+#define PROCESSOR_TRACE_CTL_ADDR0_CFG_FILTER (1ull << 32)
+
+/**
+ * @brief The bits of the entries of ToPA (the size is 4 KB shifted by the
+ * value of the bits 9:6)
+ *
+ */
+#define PROCESSOR_TRACE_TOPA_END        (1ull << 0)
+#define PROCESSOR_TRACE_TOPA_SIZE_SHIFT 6
+
+/**
+ * @brief The guest IA32_RTIT_CTL field of the VMCS, and the VM-entry and
+ * VM-exit controls of it
+ *
+ */
+#define PROCESSOR_TRACE_VMCS_GUEST_RTIT_CTL           0x00002814
+#define PROCESSOR_TRACE_ENTRY_CTLS_LOAD_RTIT_CTL_FLAG 0x00040000
+#define PROCESSOR_TRACE_EXIT_CTLS_CLEAR_RTIT_CTL_FLAG 0x02000000
+#define PROCESSOR_TRACE_VMX_MISC_USE_IN_VMX_OPERATION (1ull << 14)
+
+/**
+ * @brief The CPUID leaf of Intel Processor Trace (EBX[0] is CR3 filtering,
+ * EBX[2] is IP filtering, ECX[0] is ToPA)
+ *
+ */
+#define PROCESSOR_TRACE_CPUID_LEAF 0x14
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+VOID
+ProcessorTraceEnable(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+ProcessorTraceDisable(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+ProcessorTraceControlCurrentCore(BOOLEAN Enable);
+
+BOOLEAN
+ProcessorTracePerformOperation(PPROCESSOR_TRACE_OPERATION_PACKETS ProcessorTraceRequest, UINT8 * Buffer, UINT32 MaximumBytes);
+
+VOID
+ProcessorTraceUninitialize();
@@ -0,0 +1,31 @@
+/**
+ * @file Profiler.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for the sampling profiler (VMX-preemption timer)
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+VOID
+ProfilerEnable(VIRTUAL_MACHINE_STATE * VCpu, UINT64 Period, UINT32 StackDepth);
+
+VOID
+ProfilerDisable(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+ProfilerHandleVmxPreemptionTimerVmexit(VIRTUAL_MACHINE_STATE * VCpu);
+
+BOOLEAN
+ProfilerPerformOperation(PPROFILER_OPERATION_PACKETS ProfilerRequest, PPROFILER_SAMPLE Samples, UINT32 MaximumSamples);
+
+VOID
+ProfilerUninitialize();
@@ -0,0 +1,67 @@
+/**
+ * @file SubPageWritePermissions.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for the sub-page write permissions (SPP) of the monitor hooks
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Secondary processor-based VM-execution control 23 is defined as
+ * sub-page write permissions for EPT
+ *
+ */
+#define SPP_PROCBASED_CTLS2_FLAG 0x00800000
+
+/**
+ * @brief The SPP table pointer (SPPTP) field of the VMCS
+ *
+ */
+#define SPP_VMCS_CTRL_TABLE_POINTER 0x00002030
+
+/**
+ * @brief The exit reason of the SPP-related events (SPPT misses and SPPT
+ * misconfigurations)
+ *
+ */
+#define SPP_VMX_EXIT_REASON_SPP_RELATED_EVENT 66
+
+/**
+ * @brief Bit 11 of the exit qualification of the SPP-related events is set
+ * for the misconfigurations (and cleared for the misses)
+ *
+ */
+#define SPP_EXIT_QUALIFICATION_MISCONFIGURATION (1ull << 11)
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+SubPageWritePermissionsInitialize();
+
+PVOID
+SubPageWritePermissionsAllocateTable(UINT64 * PhysicalAddress, PVOID Context);
+
+PVOID
+SubPageWritePermissionsPhysicalToVirtual(UINT64 PhysicalAddress, PVOID Context);
+
+VOID
+SubPageWritePermissionsReservePools(UINT32 Count);
+
+BOOLEAN
+SubPageWritePermissionsProtectRange(SIZE_T PhysicalBaseAddress,
+                                    SIZE_T StartOfTargetPhysicalAddress,
+                                    SIZE_T EndOfTargetPhysicalAddress);
+
+VOID
+SubPageWritePermissionsHandleVmexit(VIRTUAL_MACHINE_STATE * VCpu);
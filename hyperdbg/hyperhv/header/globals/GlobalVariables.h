@@ -25,6 +25,13 @@
  */
 COMPATIBILITY_CHECKS_STATUS g_CompatibilityCheck;
 
+/**
+ * @brief The MSRs and the format of the Last Branch Records of the current
+ * processor (valid if g_CompatibilityCheck.LbrSupport is set)
+ *
+ */
+LBR_DECODE_LAYOUT g_LbrLayout;
+
 /**
  * @brief List of callbacks
  *
@@ -93,6 +100,21 @@ PVOID g_NmiHandlerForKeDeregisterNmiCallback;
  */
 BOOLEAN g_IsUnsafeSyscallOrSysretHandling;
 
+/**
+ * @brief The generation of the caches of the SYSCALL and SYSRET sites,
+ * incrementing it flushes the caches of all of the cores
+ *
+ */
+volatile LONG g_SyscallSiteCacheGeneration;
+
+/**
+ * @brief The range of the kernel image (the image of the system-call
+ * handler), its SYSCALL and SYSRET sites are never re-verified
+ *
+ */
+UINT64 g_SyscallSiteCacheKernelImageBase;
+UINT64 g_SyscallSiteCacheKernelImageEnd;
+
 /**
  * @brief Bitmap of MSRs that cause #GP
  *
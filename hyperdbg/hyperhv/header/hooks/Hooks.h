@@ -27,6 +27,59 @@ typedef struct _HIDDEN_HOOKS_DETOUR_DETAILS
 
 } HIDDEN_HOOKS_DETOUR_DETAILS, *PHIDDEN_HOOKS_DETOUR_DETAILS;
 
+/**
+ * @brief The page of a trapped memory access that the emulator is allowed
+ * to access
+ *
+ */
+typedef struct _EPT_HOOK_EMULATION_CONTEXT
+{
+    UINT64 GuestLinearPage;   // Page of the guest linear address of the access
+    UINT64 GuestPhysicalPage; // Page of the guest physical address of the access
+
+} EPT_HOOK_EMULATION_CONTEXT, *PEPT_HOOK_EMULATION_CONTEXT;
+
+/**
+ * @brief The state of a page of a batch of hidden breakpoints
+ *
+ */
+typedef struct _EPT_HOOK_BATCH_PAGE_STATE
+{
+    EPT_HOOKED_PAGE_DETAIL * HookedPage; // The hooked page of the page (the first one in the list, or a new one)
+    BOOLEAN                  IsNewPage;  // The hooked page is allocated by the batch
+
+} EPT_HOOK_BATCH_PAGE_STATE, *PEPT_HOOK_BATCH_PAGE_STATE;
+
+/**
+ * @brief A batch of hidden breakpoints (the targets are translated, sorted and
+ * grouped by their pages in vmx non-root)
+ *
+ */
+typedef struct _EPT_HOOK_BATCH_REQUEST
+{
+    CR3_TYPE                   ProcessCr3;
+    PHOOK_BATCH_TARGET         Targets;
+    UINT32                     NumberOfTargets;
+    PHOOK_BATCH_PAGE           Pages;
+    PEPT_HOOK_BATCH_PAGE_STATE PageStates;
+    UINT32                     NumberOfPages;
+    UINT64 *                   LargePages;
+    UINT32                     NumberOfLargePages;
+
+} EPT_HOOK_BATCH_REQUEST, *PEPT_HOOK_BATCH_REQUEST;
+
+/**
+ * @brief The hooked pages that are removed by a batch (their entries are
+ * restored on all of the cores by a single broadcast)
+ *
+ */
+typedef struct _EPT_HOOK_BATCH_UNHOOKING_DETAILS
+{
+    EPT_HOOKED_PAGE_DETAIL ** HookedPages;
+    UINT32                    NumberOfHookedPages;
+
+} EPT_HOOK_BATCH_UNHOOKING_DETAILS, *PEPT_HOOK_BATCH_UNHOOKING_DETAILS;
+
 //////////////////////////////////////////////////
 //				   Syscall Hook					//
 //////////////////////////////////////////////////
@@ -78,6 +131,12 @@ SyscallHookEmulateSYSRET(_Inout_ VIRTUAL_MACHINE_STATE * VCpu);
 BOOLEAN
 SyscallHookEmulateSYSCALL(_Inout_ VIRTUAL_MACHINE_STATE * VCpu);
 
+VOID
+SyscallHookInvalidateSiteCaches();
+
+VOID
+SyscallHookLocateKernelImage();
+
 //////////////////////////////////////////////////
 //		    	 Hidden Hooks Test				//
 //////////////////////////////////////////////////
@@ -94,6 +153,12 @@ PVOID(*ExAllocatePoolWithTagOrig)
  */
 #define MAX_EXEC_TRAMPOLINE_SIZE 100
 
+/**
+ * @brief Count of the entries of the hash of the detours (a power of two)
+ *
+ */
+#define EPT_HOOK2_DETOUR_HASH_CAPACITY 0x2000
+
 // ----------------------------------------------------------------------
 
 /**
@@ -107,6 +172,48 @@ PVOID(*ExAllocatePoolWithTagOrig)
 BOOLEAN
 EptHookPerformPageHook(VIRTUAL_MACHINE_STATE * VCpu, PVOID TargetAddress, CR3_TYPE ProcessCr3);
 
+/**
+ * @brief Hook a batch of addresses in VMX Root Mode with hidden breakpoints
+ * (the pools are reserved by the caller)
+ *
+ * @param VCpu
+ * @param Request
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookPerformPageHookBatch(VIRTUAL_MACHINE_STATE * VCpu, PEPT_HOOK_BATCH_REQUEST Request);
+
+/**
+ * @brief Hook a batch of addresses with hidden breakpoints
+ *
+ * @param TargetAddresses
+ * @param NumberOfTargets
+ * @param ProcessId
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookBatch(PVOID * TargetAddresses, UINT32 NumberOfTargets, UINT32 ProcessId);
+
+/**
+ * @brief Restore the entries of the hooked pages of a batch on the current core
+ *
+ * @param VCpu
+ * @param UnhookingDetails
+ * @return VOID
+ */
+VOID
+EptHookRestoreBatchToOriginalEntries(VIRTUAL_MACHINE_STATE * VCpu, PEPT_HOOK_BATCH_UNHOOKING_DETAILS UnhookingDetails);
+
+/**
+ * @brief Remove a batch of hidden breakpoints
+ *
+ * @param VirtualAddresses
+ * @param NumberOfAddresses
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookUnHookBatch(UINT64 * VirtualAddresses, UINT32 NumberOfAddresses);
+
 /**
  * @brief Hook in VMX Root Mode with hidden detours and monitor
  * (A pre-allocated buffer should be available)
@@ -408,3 +515,41 @@ EptHookModifyPageWriteState(VIRTUAL_MACHINE_STATE * VCpu,
  */
 VOID
 EptHookHandleMonitorTrapFlag(VIRTUAL_MACHINE_STATE * VCpu);
+
+/**
+ * @brief Trigger the post events of a hooked page after the access is performed
+ *
+ * @param VCpu The virtual processor's state
+ * @param HookedEntry The entry of the hooked page
+ * @return VOID
+ */
+VOID
+EptHookDispatchPostEvent(VIRTUAL_MACHINE_STATE * VCpu, EPT_HOOKED_PAGE_DETAIL * HookedEntry);
+
+/**
+ * @brief Emulate the trapped memory access instead of stepping it with MTF
+ *
+ * @param VCpu The virtual processor's state
+ * @param HookedEntry The entry of the hooked page
+ * @param ViolationQualification The exit qualification of the EPT violation
+ * @param GuestPhysicalAddr The guest physical address of the access
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookEmulateMemoryAccess(VIRTUAL_MACHINE_STATE *              VCpu,
+                           EPT_HOOKED_PAGE_DETAIL *             HookedEntry,
+                           VMX_EXIT_QUALIFICATION_EPT_VIOLATION ViolationQualification,
+                           UINT64                               GuestPhysicalAddr);
+
+/**
+ * @brief Callbacks of the emulator that access the page of the trapped access
+ *
+ */
+BOOLEAN
+EptHookEmulatorReadMemory(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context);
+
+BOOLEAN
+EptHookEmulatorWriteMemory(UINT64 Address, const VOID * Buffer, UINT32 Size, PVOID Context);
+
+BOOLEAN
+EptHookEmulatorCompareExchangeMemory(UINT64 Address, UINT32 Size, UINT64 * Comparand, UINT64 NewValue, PVOID Context);
@@ -208,3 +208,9 @@ VOID
 MemoryMapperMapPhysicalAddressToPte(_In_ PHYSICAL_ADDRESS PhysicalAddress,
                                     _In_ PVOID            TargetProcessVirtualAddress,
                                     _In_ CR3_TYPE         TargetProcessKernelCr3);
+
+BOOLEAN
+MemoryMapperCompareExchangeSafeByPhysicalAddress(_In_ UINT64    DestinationPa,
+                                                 _In_ UINT32    Size,
+                                                 _Inout_ UINT64 * Comparand,
+                                                 _In_ UINT64    NewValue);
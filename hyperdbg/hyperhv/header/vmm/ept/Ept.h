@@ -72,21 +72,25 @@
  */
 #define ADDRMASK_EPT_PML4_INDEX(_VAR_) (((_VAR_) & 0xFF8000000000ULL) >> 39)
 
+//////////////////////////////////////////////////
+//				      Locks 	    			//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The lock for the reservation of the private tables of the cores
+ *
+ */
+volatile LONG EptPrivateTablesReservationLock;
+
 //////////////////////////////////////////////////
 //			     Structs Cont.                	//
 //////////////////////////////////////////////////
 
 /**
- * @brief MTRR Descriptor
+ * @brief MTRR Descriptor (the same as the ranges of the MTRR map)
  *
  */
-typedef struct _MTRR_RANGE_DESCRIPTOR
-{
-    SIZE_T  PhysicalBaseAddress;
-    SIZE_T  PhysicalEndAddress;
-    UCHAR   MemoryType;
-    BOOLEAN FixedRange;
-} MTRR_RANGE_DESCRIPTOR, *PMTRR_RANGE_DESCRIPTOR;
+typedef MTRR_MAP_RANGE MTRR_RANGE_DESCRIPTOR, *PMTRR_RANGE_DESCRIPTOR;
 
 /**
  * @brief Fixed range MTRR
@@ -127,10 +131,16 @@ typedef union _IA32_MTRR_FIXED_RANGE_TYPE
  */
 typedef struct _EPT_STATE
 {
-    LIST_ENTRY            HookedPagesList;                // A list of the details about hooked pages
-    MTRR_RANGE_DESCRIPTOR MemoryRanges[NUM_MTRR_ENTRIES]; // Physical memory ranges described by the BIOS in the MTRRs. Used to build the EPT identity mapping.
-    UINT32                NumberOfEnabledMemoryRanges;    // Number of memory ranges specified in MemoryRanges
-    UINT8                 DefaultMemoryType;
+    LIST_ENTRY                 HookedPagesList;                // A list of the details about hooked pages
+    MTRR_RANGE_DESCRIPTOR      MemoryRanges[NUM_MTRR_ENTRIES]; // Physical memory ranges described by the BIOS in the MTRRs. Used to build the EPT identity mapping.
+    UINT32                     NumberOfEnabledMemoryRanges;    // Number of memory ranges specified in MemoryRanges
+    UINT8                      DefaultMemoryType;
+    MTRR_MAP                   MtrrMap;                  // Sorted intervals of the memory types of the MTRRs (used for building the EPT)
+    SPP_TABLE                  SppTable;                 // Tables of the sub-page write permissions (shared by all of the cores)
+    PVMM_EPT_SHARED_PAGE_TABLE SharedPageTable;          // Tables of the identity map that are shared by all of the cores
+    UINT32                     MaximumRegionCost;        // Maximum count of the tables for privatizing a 1GB region of a core
+    SHARED_EPT_RESERVATION     PrivateTablesReservation; // The reserved private tables of the regions that are still shared
+    DETOUR_HASH                EptHook2sDetourHash;      // Details of the !epthook2 detours by the address of the hooked functions
 } EPT_STATE, *PEPT_STATE;
 
 /**
@@ -173,7 +183,7 @@ typedef struct _VMM_EPT_DYNAMIC_SPLIT
 //
 
 BOOLEAN
-EptSetupPML2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, PEPT_PML2_ENTRY NewEntry, SIZE_T PageFrameNumber);
+EptSetupPML2Entry(PEPT_PML2_ENTRY NewEntry, SIZE_T PageFrameNumber);
 
 BOOLEAN
 EptHandlePageHookExit(_Inout_ VIRTUAL_MACHINE_STATE *           VCpu,
@@ -208,6 +218,43 @@ EptBuildMtrrMap(VOID);
 PVMM_EPT_PAGE_TABLE
 EptAllocateAndCreateIdentityPageTable(VOID);
 
+/**
+ * @brief Allocates and create the tables of the identity map that are
+ * shared by all of the cores
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptAllocateAndCreateSharedPageTable(VOID);
+
+/**
+ * @brief Reserve the pools of the private tables of the cores
+ *
+ * @param Count
+ * @return VOID
+ */
+VOID
+EptReservePrivatePageTables(UINT32 Count);
+
+/**
+ * @brief Reserve the pools of the private tables of a 1GB region that is
+ * privatized right away
+ *
+ * @param PhysicalAddress
+ * @return VOID
+ */
+VOID
+EptReservePrivatePageTablesOfRegion(UINT64 PhysicalAddress);
+
+/**
+ * @brief Free the private copies of the regions of a core
+ *
+ * @param EptPageTable
+ * @return VOID
+ */
+VOID
+EptFreePrivatePageTables(PVMM_EPT_PAGE_TABLE EptPageTable);
+
 /**
  * @brief Convert large pages to 4KB pages
  *
@@ -274,6 +321,30 @@ EptGetPml1Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress);
 PVOID
 EptGetPml1OrPml2Entry(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN * IsLargePage);
 
+/**
+ * @brief Get the PML1 entry (or the large PML2 entry) that is currently used
+ * by the core for this physical address without privatizing its region
+ *
+ * @param EptPageTable The EPT Page Table
+ * @param PhysicalAddress Physical address that we want to get its PML1
+ * @param IsLargePage Shows whether it's a large page or not
+ *
+ * @return PVOID Return PEPT_PML1_ENTRY or PEPT_PML2_ENTRY
+ */
+PVOID
+EptGetPml1OrPml2EntryWithoutPrivatizing(PVMM_EPT_PAGE_TABLE EptPageTable, SIZE_T PhysicalAddress, BOOLEAN * IsLargePage);
+
+/**
+ * @brief Allow the user-mode execution (MBEC) on the PML3, PML2 and PML1
+ * entries of the EPT table
+ *
+ * @param EptPageTable The EPT Page Table
+ *
+ * @return VOID
+ */
+VOID
+EptAllowUserModeExecution(PVMM_EPT_PAGE_TABLE EptPageTable);
+
 /**
  * @brief Handle Ept Misconfigurations
  *
@@ -29,3 +29,24 @@ CounterSetPreemptionTimer(UINT32 TimerValue);
 
 VOID
 CounterClearPreemptionTimer();
+
+VOID
+CounterApplyRdtscExiting(BOOLEAN Set);
+
+VOID
+CounterEnableTscOffsetting(VIRTUAL_MACHINE_STATE * VCpu,
+                           UINT64                  TransitionOverhead,
+                           UINT64                  MaximumDeficit,
+                           UINT64                  SamplingPeriod);
+
+VOID
+CounterDisableTscOffsetting(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+CounterTscOffsettingHandleVmexit(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+CounterTscOffsettingHandleVmresume(VIRTUAL_MACHINE_STATE * VCpu);
+
+VOID
+CounterQueryTscOffsetting(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest);
@@ -260,6 +260,25 @@ HvSetNmiExiting(BOOLEAN Set);
 VOID
 HvSetVmxPreemptionTimerExiting(BOOLEAN Set);
 
+/**
+ * @brief Set saving the VMX preemption timer value on vm-exits
+ *
+ * @param Set
+ * @return VOID
+ */
+VOID
+HvSetSaveVmxPreemptionTimerValue(BOOLEAN Set);
+
+/**
+ * @brief Set loading IA32_RTIT_CTL on vm-entries and clearing it on
+ * vm-exits
+ *
+ * @param Set
+ * @return VOID
+ */
+VOID
+HvSetProcessorTraceControls(BOOLEAN Set);
+
 /**
  * @brief Set exception bitmap in VMCS
  * @details Should be called in vmx-root
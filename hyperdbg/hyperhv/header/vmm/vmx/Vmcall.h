@@ -321,6 +321,68 @@
  */
 #define VMCALL_WRITE_PHYSICAL_MEMORY 0x00000031
 
+/**
+ * @brief VMCALL to enable TSC offsetting (hiding the time spent in vmx-root)
+ *
+ */
+#define VMCALL_SET_TSC_OFFSETTING 0x00000032
+
+/**
+ * @brief VMCALL to disable TSC offsetting
+ *
+ */
+#define VMCALL_UNSET_TSC_OFFSETTING 0x00000033
+
+/**
+ * @brief VMCALL to set a batch of hidden breakpoints
+ *
+ */
+#define VMCALL_SET_HIDDEN_CC_BREAKPOINTS_BATCH 0x00000034
+
+/**
+ * @brief VMCALL to remove a batch of hooked pages
+ *
+ */
+#define VMCALL_UNHOOK_PAGES_BATCH 0x00000035
+
+/**
+ * @brief VMCALL to enable the sampling profiler (VMX-preemption timer)
+ *
+ */
+#define VMCALL_ENABLE_PROFILER 0x00000036
+
+/**
+ * @brief VMCALL to disable the sampling profiler
+ *
+ */
+#define VMCALL_DISABLE_PROFILER 0x00000037
+
+/**
+ * @brief VMCALL to enable Intel Processor Trace (with the configured
+ * options of the core)
+ *
+ */
+#define VMCALL_ENABLE_PROCESSOR_TRACE 0x00000038
+
+/**
+ * @brief VMCALL to disable Intel Processor Trace
+ *
+ */
+#define VMCALL_DISABLE_PROCESSOR_TRACE 0x00000039
+
+/**
+ * @brief VMCALL to enable the Last Branch Records (with the configured
+ * filter of the core)
+ *
+ */
+#define VMCALL_ENABLE_LBR 0x0000003A
+
+/**
+ * @brief VMCALL to disable the Last Branch Records
+ *
+ */
+#define VMCALL_DISABLE_LBR 0x0000003B
+
 //////////////////////////////////////////////////
 //				    Functions					//
 //////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 //
 #    include <ntifs.h>
 #    include <ntstrsafe.h>
+#    include <ntimage.h>
 #    include <Windef.h>
 #    include <assert.h>
 
@@ -67,6 +68,61 @@
 //
 #include "SDK/modules/VMM.h"
 
+//
+// TSC offsetting (used in the core's state)
+//
+#include "components/tsc-offset/header/TscOffset.h"
+
+//
+// Cache of the SYSCALL and SYSRET sites (used in the core's state)
+//
+#include "components/syscall-site-cache/header/SyscallSiteCache.h"
+
+//
+// Tables of the sub-page write permissions (used in the EPT's state)
+//
+#include "components/sub-page-permission/header/SubPagePermission.h"
+
+//
+// Emulator of the trapped memory accesses (used in the EPT hooks)
+//
+#include "components/memory-access-emulator/header/MemoryAccessEmulator.h"
+
+//
+// EPTP list and views of the hidden hooks (used in the core's state)
+//
+#include "components/eptp-view/header/EptpView.h"
+
+//
+// Sorted interval map of the memory types of the MTRRs (used in the EPT's state)
+//
+#include "components/mtrr-map/header/MtrrMap.h"
+
+//
+// Shared EPT hierarchy and the private regions of the cores (used in the EPT's tables)
+//
+#include "components/shared-ept/header/SharedEpt.h"
+
+//
+// Grouping of the targets of the batches of EPT hooks by their pages
+//
+#include "components/hook-batch/header/HookBatch.h"
+
+//
+// Lock-free hash of the detours of the inline EPT hooks (!epthook2)
+//
+#include "components/detour-hash/header/DetourHash.h"
+
+//
+// Histograms of the sampling profiler
+//
+#include "components/sample-profile/header/SampleProfile.h"
+
+//
+// Layouts and formats of the Last Branch Records (used in the compatibility checks)
+//
+#include "components/lbr-decode/header/LbrDecode.h"
+
 //
 // The core's state
 //
@@ -125,7 +181,12 @@
 #include "hooks/SyscallCallback.h"
 #include "interface/Callback.h"
 #include "features/DirtyLogging.h"
+#include "features/SubPageWritePermissions.h"
+#include "features/EptpSwitching.h"
 #include "features/CompatibilityChecks.h"
+#include "features/Profiler.h"
+#include "features/ProcessorTrace.h"
+#include "features/Lbr.h"
 #include "mmio/MmioShadowing.h"
 
 //
@@ -325,6 +325,88 @@ DebuggerCommandReadMemoryVmxRoot(PDEBUGGER_READ_MEMORY ReadMemRequest, UCHAR * U
     return TRUE;
 }
 
+/**
+ * @brief Read many pages of memory at once
+ * @details Each page is read separately, the pages that are not available
+ * are zeroed and not marked in the bitmap of the valid pages
+ *
+ * @param BulkReadRequest request structure for reading memory
+ * @param UserBuffer user buffer to copy the memory (the size of the request)
+ * @param ApplyFromVmxRoot whether the request is received in vmx-root mode
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+DebuggerCommandBulkReadMemory(PDEBUGGER_BULK_READ_MEMORY BulkReadRequest, UCHAR * UserBuffer, BOOLEAN ApplyFromVmxRoot)
+{
+    DEBUGGER_READ_MEMORY ReadMemRequest = {0};
+    UINT32               NumberOfPages;
+    UINT64               PageAddress;
+    UINT32               PageSize;
+    UINT32               Offset;
+    UINT32               ReturnSizeVmxRoot;
+    SIZE_T               ReturnSize;
+    BOOLEAN              IsRead;
+
+    BulkReadRequest->ValidPagesBitmap   = 0;
+    BulkReadRequest->NumberOfValidPages = 0;
+
+    //
+    // In the Debugger Mode, the result should fit in a single packet
+    //
+    if (!BulkReadIsRequestValid(BulkReadRequest,
+                                ApplyFromVmxRoot ? DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES_OVER_SERIAL : DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES))
+    {
+        BulkReadRequest->KernelStatus = DEBUGGER_ERROR_READING_MEMORY_INVALID_PARAMETER;
+        return FALSE;
+    }
+
+    if (BulkReadRequest->MemoryType != DEBUGGER_READ_PHYSICAL_ADDRESS && BulkReadRequest->MemoryType != DEBUGGER_READ_VIRTUAL_ADDRESS)
+    {
+        BulkReadRequest->KernelStatus = DEBUGGER_ERROR_MEMORY_TYPE_INVALID;
+        return FALSE;
+    }
+
+    NumberOfPages = BulkReadGetNumberOfPages(BulkReadRequest->Address, BulkReadRequest->Size);
+
+    for (UINT32 i = 0; i < NumberOfPages; i++)
+    {
+        BulkReadGetPage(BulkReadRequest, i, &PageAddress, &PageSize, &Offset);
+
+        ReadMemRequest.Pid         = BulkReadRequest->Pid;
+        ReadMemRequest.Address     = PageAddress;
+        ReadMemRequest.Size        = PageSize;
+        ReadMemRequest.MemoryType  = BulkReadRequest->MemoryType;
+        ReadMemRequest.ReadingType = ApplyFromVmxRoot ? READ_FROM_VMX_ROOT : READ_FROM_KERNEL;
+
+        //
+        // Read the page the same way as the regular reads (e.g., the
+        // bytes of the 'bp' breakpoints are restored in vmx-root)
+        //
+        if (ApplyFromVmxRoot)
+        {
+            IsRead = DebuggerCommandReadMemoryVmxRoot(&ReadMemRequest, &UserBuffer[Offset], &ReturnSizeVmxRoot);
+        }
+        else
+        {
+            IsRead = DebuggerCommandReadMemory(&ReadMemRequest, &UserBuffer[Offset], &ReturnSize);
+        }
+
+        if (IsRead)
+        {
+            BulkReadSetPageValid(BulkReadRequest, i);
+        }
+        else
+        {
+            RtlZeroMemory(&UserBuffer[Offset], PageSize);
+        }
+    }
+
+    BulkReadRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+    return TRUE;
+}
+
 /**
  * @brief Perform rdmsr, wrmsr commands
  *
@@ -685,8 +685,75 @@ ExtensionCommandIoBitmapResetAllCores()
     BroadcastIoBitmapResetAllCores();
 }
 
+/**
+ * @brief Read a DWORD of the configuration space for the walk of the PCI topology
+ *
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param Offset
+ * @param Context
+ *
+ * @return UINT32
+ */
+UINT32
+ExtensionCommandPcitreeReadConfig(UINT8 Bus, UINT8 Device, UINT8 Function, UINT8 Offset, PVOID Context)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    return (UINT32)PciReadCam(Bus, Device, Function, Offset, sizeof(DWORD));
+}
+
+/**
+ * @brief Store a function that is found by the walk of the PCI topology
+ *
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param DeviceIdVendorId
+ * @param ClassCodeRevision
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ExtensionCommandPcitreeAddFunction(UINT8  Bus,
+                                   UINT8  Device,
+                                   UINT8  Function,
+                                   UINT32 DeviceIdVendorId,
+                                   UINT32 ClassCodeRevision,
+                                   PVOID  Context)
+{
+    PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET PcitreePacket = (PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET)Context;
+    PPCI_DEV_MINIMAL                          DeviceInfo;
+
+    if (PcitreePacket->DeviceInfoListNum == DEV_MAX_NUM)
+    {
+        LogError("Reached maximum number of devices (%u) that can be stored in debuggee response packet.\n", DEV_MAX_NUM);
+        return FALSE;
+    }
+
+    DeviceInfo = &PcitreePacket->DeviceInfoList[PcitreePacket->DeviceInfoListNum];
+
+    DeviceInfo->Bus                      = Bus;
+    DeviceInfo->Device                   = Device;
+    DeviceInfo->Function                 = Function;
+    DeviceInfo->ConfigSpace.VendorId     = (UINT16)(DeviceIdVendorId & 0xFFFF);
+    DeviceInfo->ConfigSpace.DeviceId     = (UINT16)(DeviceIdVendorId >> 16);
+    DeviceInfo->ConfigSpace.ClassCode[0] = (UINT8)((ClassCodeRevision >> 24) & 0xFF);
+    DeviceInfo->ConfigSpace.ClassCode[1] = (UINT8)((ClassCodeRevision >> 16) & 0xFF);
+    DeviceInfo->ConfigSpace.ClassCode[2] = (UINT8)((ClassCodeRevision >> 8) & 0xFF);
+
+    PcitreePacket->DeviceInfoListNum++;
+
+    return TRUE;
+}
+
 /**
  * @brief routines for PCIe tree
+ * @details the devices are found by following the topology (the multi-function
+ * devices and the buses behind the bridges) instead of probing all of the
+ * bus, device and function numbers
  *
  * @param PcitreePacket
  * @param OperateOnVmxRoot
@@ -696,47 +763,20 @@ ExtensionCommandIoBitmapResetAllCores()
 VOID
 ExtensionCommandPcitree(PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET PcitreePacket, BOOLEAN OperateOnVmxRoot)
 {
-    DWORD DeviceIdVendorId = 0xFFFFFFFF;
-    DWORD ClassCode        = 0xFFFFFFFF;
-    UINT8 DevNum           = 0;
+    PCI_WALK Walk = {0};
 
     //
     // We currently don't use OperateOnVmxRoot, but we might in the future
     //
     UNREFERENCED_PARAMETER(OperateOnVmxRoot);
 
-    for (UINT8 b = 0; b < BUS_MAX_NUM; b++)
-    {
-        for (UINT8 d = 0; d < DEVICE_MAX_NUM; d++)
-        {
-            for (UINT8 f = 0; f < FUNCTION_MAX_NUM; f++)
-            {
-                DeviceIdVendorId = (DWORD)PciReadCam(b, d, f, 0, sizeof(DWORD));
+    PcitreePacket->DeviceInfoListNum = 0;
 
-                if (DeviceIdVendorId != 0xFFFFFFFF)
-                {
-                    PcitreePacket->DeviceInfoList[DevNum].Bus                  = b;
-                    PcitreePacket->DeviceInfoList[DevNum].Device               = d;
-                    PcitreePacket->DeviceInfoList[DevNum].Function             = f;
-                    PcitreePacket->DeviceInfoList[DevNum].ConfigSpace.VendorId = (UINT16)(DeviceIdVendorId & 0xFFFF);
-                    PcitreePacket->DeviceInfoList[DevNum].ConfigSpace.DeviceId = (UINT16)(DeviceIdVendorId >> 16);
-
-                    ClassCode                                                      = (DWORD)PciReadCam(b, d, f, 0, sizeof(DWORD));
-                    PcitreePacket->DeviceInfoList[DevNum].ConfigSpace.ClassCode[0] = (UINT8)((ClassCode >> 24) & 0xFF);
-                    PcitreePacket->DeviceInfoList[DevNum].ConfigSpace.ClassCode[1] = (UINT8)((ClassCode >> 16) & 0xFF);
-                    PcitreePacket->DeviceInfoList[DevNum].ConfigSpace.ClassCode[2] = (UINT8)((ClassCode >> 8) & 0xFF);
-
-                    DevNum++;
-                    if (DevNum == DEV_MAX_NUM)
-                    {
-                        LogError("Reached maximum number of devices (%u) that can be stored in debuggee response packet.\n", DEV_MAX_NUM);
-                        break;
-                    }
-                }
-            }
-        }
-    }
-    PcitreePacket->DeviceInfoListNum = DevNum;
+    Walk.Read     = ExtensionCommandPcitreeReadConfig;
+    Walk.Function = ExtensionCommandPcitreeAddFunction;
+    Walk.Context  = PcitreePacket;
+
+    PciWalkTopology(&Walk);
 
     if (PcitreePacket->DeviceInfoListNum)
     {
@@ -832,3 +872,76 @@ ExtensionCommandPcidevinfo(PDEBUGGEE_PCIDEVINFO_REQUEST_RESPONSE_PACKET Pcidevin
         PcidevinfoPacket->KernelStatus                                 = DEBUGGER_ERROR_INVALID_ADDRESS;
     }
 }
+
+/**
+ * @brief routines for !tscoffset command
+ * @details Enables, disables, or queries TSC offsetting on all cores
+ *
+ * @param TscOffsettingRequest
+ * @param ApplyFromVmxRootMode
+ *
+ * @return VOID
+ */
+VOID
+ExtensionCommandPerformTscOffsettingOperation(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest, BOOLEAN ApplyFromVmxRootMode)
+{
+    switch (TscOffsettingRequest->TscOffsettingOperationType)
+    {
+    case TSC_OFFSETTING_OPERATION_TYPE_ENABLE:
+
+        //
+        // The overhead of a single vm-exit can't be more than the hidden cycles, and the
+        // hidden cycles are limited, so the TSCs of the cores don't drift apart
+        //
+        if (TscOffsettingRequest->MaximumDeficit == 0 ||
+            TscOffsettingRequest->MaximumDeficit > TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT ||
+            TscOffsettingRequest->TransitionOverhead > TscOffsettingRequest->MaximumDeficit)
+        {
+            TscOffsettingRequest->KernelStatus = DEBUGGER_ERROR_INVALID_TSC_OFFSETTING_PARAMETERS;
+            return;
+        }
+
+        if (ApplyFromVmxRootMode)
+        {
+            HaltedBroadcastEnableTscOffsettingAllCores(TscOffsettingRequest);
+        }
+        else
+        {
+            BroadcastEnableTscOffsettingAllCores(TscOffsettingRequest);
+        }
+
+        break;
+
+    case TSC_OFFSETTING_OPERATION_TYPE_DISABLE:
+
+        if (ApplyFromVmxRootMode)
+        {
+            HaltedBroadcastDisableTscOffsettingAllCores();
+        }
+        else
+        {
+            BroadcastDisableTscOffsettingAllCores();
+        }
+
+        break;
+
+    case TSC_OFFSETTING_OPERATION_TYPE_QUERY:
+
+        //
+        // Only the statistics are queried
+        //
+        break;
+
+    default:
+
+        TscOffsettingRequest->KernelStatus = DEBUGGER_ERROR_INVALID_TSC_OFFSETTING_PARAMETERS;
+        return;
+    }
+
+    //
+    // Fill the statistics (after the operation)
+    //
+    VmFuncQueryTscOffsetting(TscOffsettingRequest);
+
+    TscOffsettingRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
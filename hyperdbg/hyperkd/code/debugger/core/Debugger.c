@@ -180,6 +180,22 @@ DebuggerInitialize()
         RtlZeroMemory(CurrentDebuggerState->ScriptEngineCoreSpecificStackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
     }
 
+    //
+    // Allocate the per-core blocks of the binary event trace
+    //
+    if (!DebuggerEventTraceInitialize())
+    {
+        return FALSE;
+    }
+
+    //
+    // Allocate the per-core buffers of the counted step trace
+    //
+    if (!KdStepTraceInitialize())
+    {
+        return FALSE;
+    }
+
     //
     // Request pages for breakpoint detail
     //
@@ -311,6 +327,16 @@ DebuggerUninitialize()
         }
     }
 
+    //
+    // Free the per-core blocks of the binary event trace
+    //
+    DebuggerEventTraceUninitialize();
+
+    //
+    // Free the per-core buffers of the counted step trace
+    //
+    KdStepTraceUninitialize();
+
     //
     // Free g_DbgState
     //
@@ -451,12 +477,14 @@ DebuggerCreateEvent(BOOLEAN                           Enabled,
         }
     }
 
-    Event->CoreId         = CoreId;
-    Event->ProcessId      = ProcessId;
-    Event->Enabled        = Enabled;
-    Event->EventType      = EventType;
-    Event->Tag            = Tag;
-    Event->CountOfActions = 0; // currently there is no action
+    Event->CoreId            = CoreId;
+    Event->ProcessId         = ProcessId;
+    Event->Enabled           = Enabled;
+    Event->EventType         = EventType;
+    Event->Tag               = Tag;
+    Event->CountOfActions    = 0;     // currently there is no action
+    Event->HasSamplingPolicy = FALSE; // the sampling policy is set after parsing
+    Event->HasScriptFilter   = FALSE; // the filter is set once the script action is added
 
     //
     // Copy Options
@@ -617,6 +645,7 @@ DebuggerAllocateSafeRequestedBuffer(SIZE_T                            SizeOfRequ
  * by the user-mode immediately
  * @param InTheCaseOfCustomCode Custom code structure (if any)
  * @param InTheCaseOfRunScript Run script structure (if any)
+ * @param LbrSnapshotCount Count of the branches (if it's an LBR snapshot)
  * @param ResultsToReturn The buffer address that should be returned
  * to the user-mode as the result
  * @param InputFromVmxRoot Whether the input comes from VMX root-mode or IOCTL
@@ -629,6 +658,7 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
                          BOOLEAN                                         SendTheResultsImmediately,
                          PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE             InTheCaseOfCustomCode,
                          PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript,
+                         UINT32                                          LbrSnapshotCount,
                          PDEBUGGER_EVENT_AND_ACTION_RESULT               ResultsToReturn,
                          BOOLEAN                                         InputFromVmxRoot)
 {
@@ -1014,6 +1044,13 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
     Action->ImmediatelySendTheResults = SendTheResultsImmediately;
     Action->ActionType                = ActionType;
     Action->Tag                       = Event->Tag;
+    Action->LbrSnapshotCount          = LbrSnapshotCount;
+
+    //
+    // Check whether the script of the event can be filtered without
+    // running the script engine
+    //
+    ScriptEngineUpdateEventFilter(Event, Action);
 
     //
     // Now we should add the action to the event's LIST_ENTRY of actions
@@ -1071,13 +1108,14 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
                       BOOLEAN *                             PostEventRequired,
                       GUEST_REGS *                          Regs)
 {
-    PROCESSOR_DEBUGGING_STATE *      DbgState = NULL;
-    DebuggerCheckForCondition *      ConditionFunc;
-    DEBUGGER_TRIGGERED_EVENT_DETAILS EventTriggerDetail = {0};
-    PEPT_HOOKS_CONTEXT               EptContext;
-    PLIST_ENTRY                      TempList        = 0;
-    PLIST_ENTRY                      TempList2       = 0;
-    const PVOID                      OriginalContext = Context;
+    PROCESSOR_DEBUGGING_STATE *               DbgState = NULL;
+    DebuggerCheckForCondition *               ConditionFunc;
+    DEBUGGER_TRIGGERED_EVENT_DETAILS          EventTriggerDetail = {0};
+    PEPT_HOOKS_CONTEXT                        EptContext;
+    PLIST_ENTRY                               TempList           = 0;
+    PLIST_ENTRY                               TempList2          = 0;
+    const PVOID                               OriginalContext    = Context;
+    VMM_CALLBACK_TRIGGERING_EVENT_STATUS_TYPE ServiceTableStatus = VMM_CALLBACK_TRIGGERING_EVENT_STATUS_SUCCESSFUL;
 
     //
     // Check if triggering debugging actions are allowed or not
@@ -1100,6 +1138,15 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
     //
     DbgState->Regs = Regs;
 
+    //
+    // The hidden breakpoints on the targets of the system-calls trigger
+    // the !syscall3 events
+    //
+    if (EventType == HIDDEN_HOOK_EXEC_CC && !DbgState->IsTriggeringServiceTableSyscallEvents)
+    {
+        ServiceTableStatus = SyscallServiceTableTriggerEvents(DbgState, CallingStage, Context, PostEventRequired);
+    }
+
     //
     // Find the debugger events list base on the type of the event
     //
@@ -1330,6 +1377,15 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
             // that's why we don't support extra argument for sysret
             //
 
+            //
+            // The !syscall3 events are only triggered by their hidden breakpoints
+            // and the other syscall events are only triggered by the syscall hook
+            //
+            if ((CurrentEvent->Options.OptionalParam2 == DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK) != DbgState->IsTriggeringServiceTableSyscallEvents)
+            {
+                continue;
+            }
+
             //
             // check syscall number
             //
@@ -1469,6 +1525,15 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
             }
         }
 
+        //
+        // Check whether this trigger is sampled or not (the actions of the
+        // events with a sampling policy only run for some of the triggers)
+        //
+        if (CurrentEvent->HasSamplingPolicy && !DebuggerEventSamplingCheck(DbgState, CurrentEvent))
+        {
+            continue;
+        }
+
         //
         // Reset the event ignorance mechanism (apply 'sc on/off' to the events)
         //
@@ -1481,6 +1546,24 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
         EventTriggerDetail.Tag     = CurrentEvent->Tag;
         EventTriggerDetail.Stage   = CallingStage;
 
+        //
+        // Record the event into the binary event trace
+        //
+        if (CurrentEvent->RecordEventTrace)
+        {
+            DebuggerEventTraceRecord(DbgState, CurrentEvent, &EventTriggerDetail);
+        }
+
+        //
+        // If the only action is a script that starts with a simple condition
+        // (e.g., 'if (@rcx == 0x10) { ... }'), the condition is checked here
+        // without entering the script engine
+        //
+        if (CurrentEvent->HasScriptFilter && !ScriptEngineCheckEventFilter(DbgState, CurrentEvent))
+        {
+            continue;
+        }
+
         //
         // perform the actions
         //
@@ -1488,9 +1571,11 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
     }
 
     //
-    // Check if the event should be ignored or not
+    // Check if the event should be ignored or not (the !syscall3 events of
+    // a hidden breakpoint might also request it)
     //
-    if (DbgState->ShortCircuitingEvent)
+    if (DbgState->ShortCircuitingEvent ||
+        ServiceTableStatus == VMM_CALLBACK_TRIGGERING_EVENT_STATUS_SUCCESSFUL_IGNORE_EVENT)
     {
         //
         // Reset the event ignorance (short-circuit) mechanism
@@ -1559,6 +1644,12 @@ DebuggerPerformActions(PROCESSOR_DEBUGGING_STATE *        DbgState,
 
             break;
 
+        case LBR_SNAPSHOT:
+
+            DebuggerLbrSnapshotPerform(CurrentAction->Tag, CurrentAction->ImmediatelySendTheResults, CurrentAction->LbrSnapshotCount);
+
+            break;
+
         default:
 
             //
@@ -2269,6 +2360,15 @@ DebuggerEnableEvent(UINT64 Tag)
         return FALSE;
     }
 
+    //
+    // The events that are disabled by the first-N policy, get
+    // the N triggers again
+    //
+    if (Event->HasSamplingPolicy)
+    {
+        EventSamplingReset(&Event->Sampling);
+    }
+
     //
     // Enable the event
     //
@@ -2630,6 +2730,14 @@ DebuggerRemoveEvent(UINT64 Tag, BOOLEAN PoolManagerAllocatedMemory)
     //
     DebuggerRemoveAllActionsFromEvent(Event, PoolManagerAllocatedMemory);
 
+    //
+    // The slot of the sampling states can be used by other events
+    //
+    if (Event->HasSamplingPolicy)
+    {
+        DebuggerEventSamplingReleaseSlot(Event->Sampling.Slot);
+    }
+
     //
     // Free the pools of Event, when we free the pool,
     // ConditionsBufferAddress is also a part of the
@@ -2700,6 +2808,32 @@ DebuggerValidateEvent(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
         }
     }
 
+    //
+    // Check whether the registers of the event trace records are valid or not
+    //
+    if (EventDetails->RecordEventTrace)
+    {
+        for (UINT32 i = 0; i < EVENT_TRACE_NUMBER_OF_REGISTERS; i++)
+        {
+            if (EventDetails->EventTraceRegisterIds[i] >= EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS)
+            {
+                ResultsToReturn->IsSuccessful = FALSE;
+                ResultsToReturn->Error        = DEBUGGER_ERROR_INVALID_EVENT_TRACE_REGISTER;
+                return FALSE;
+            }
+        }
+    }
+
+    //
+    // Check whether the sampling policy is valid or not
+    //
+    if (!EventSamplingValidatePolicy(&EventDetails->SamplingPolicy))
+    {
+        ResultsToReturn->IsSuccessful = FALSE;
+        ResultsToReturn->Error        = DEBUGGER_ERROR_INVALID_EVENT_SAMPLING_POLICY;
+        return FALSE;
+    }
+
     //
     // Check if process id is valid or not, we won't touch process id here
     // because some of the events use the exact value of DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES
@@ -2810,6 +2944,21 @@ DebuggerValidateEvent(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
 
         break;
     }
+    case SYSCALL_HOOK_EFER_SYSCALL:
+    {
+        //
+        // Check if syscall parameters are valid
+        //
+        if (!ValidateEventSyscall(EventDetails, ResultsToReturn, InputFromVmxRoot))
+        {
+            //
+            // Event parameters are not valid, let break the further execution at this stage
+            //
+            return FALSE;
+        }
+
+        break;
+    }
     default:
 
         //
@@ -2973,7 +3122,10 @@ DebuggerApplyEvent(PDEBUGGER_EVENT                   Event,
         //
         // Apply the EFER SYSCALL hook events
         //
-        ApplyEventEferSyscallHookEvent(Event, ResultsToReturn, InputFromVmxRoot);
+        if (!ApplyEventEferSyscallHookEvent(Event, ResultsToReturn, InputFromVmxRoot))
+        {
+            goto ClearTheEventAfterCreatingEvent;
+        }
 
         break;
     }
@@ -3081,6 +3233,7 @@ DebuggerParseEvent(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
                    BOOLEAN                           InputFromVmxRoot)
 {
     PDEBUGGER_EVENT Event;
+    UINT32          SamplingSlot;
 
     //
     // ----------------------------------------------------------------------------------
@@ -3149,6 +3302,34 @@ DebuggerParseEvent(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
         return FALSE;
     }
 
+    //
+    // Events with a sampling policy need a slot for their per-core states
+    //
+    if (EventDetails->SamplingPolicy.Type != DEBUGGER_EVENT_SAMPLING_TYPE_NONE)
+    {
+        if (!DebuggerEventSamplingAllocateSlot(&SamplingSlot))
+        {
+            //
+            // The event is not registered yet, so it's freed here
+            //
+            if (InputFromVmxRoot)
+            {
+                PoolManagerFreePool((UINT64)Event);
+            }
+            else
+            {
+                PlatformMemFreePool(Event);
+            }
+
+            ResultsToReturn->IsSuccessful = FALSE;
+            ResultsToReturn->Error        = DEBUGGER_ERROR_MAXIMUM_SAMPLED_EVENTS_REACHED;
+            return FALSE;
+        }
+
+        Event->HasSamplingPolicy = TRUE;
+        EventSamplingInitialize(&Event->Sampling, &EventDetails->SamplingPolicy, SamplingSlot);
+    }
+
     //
     // Register the event
     //
@@ -3166,6 +3347,12 @@ DebuggerParseEvent(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
         //
         Event->EnableShortCircuiting = EventDetails->EnableShortCircuiting;
 
+        //
+        // *** Set the event trace state ***
+        //
+        Event->RecordEventTrace = EventDetails->RecordEventTrace;
+        memcpy(Event->EventTraceRegisterIds, EventDetails->EventTraceRegisterIds, sizeof(Event->EventTraceRegisterIds));
+
         //
         // Set the event stage (pre- post- event)
         //
@@ -3185,6 +3372,16 @@ DebuggerParseEvent(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
             Event->EventMode = VMM_CALLBACK_CALLING_STAGE_PRE_EVENT_EMULATION;
         }
 
+        //
+        // Other events are enabled after their actions are attached, but the
+        // events that are only recorded in the event trace have no action, so
+        // they're enabled once the event is completely set
+        //
+        if (Event->RecordEventTrace && EventDetails->CountOfActions == 0)
+        {
+            DebuggerEnableEvent(Event->Tag);
+        }
+
         return TRUE;
     }
     else
@@ -3281,6 +3478,7 @@ DebuggerParseAction(PDEBUGGER_GENERAL_ACTION          ActionDetails,
                                           ActionDetails->ImmediateMessagePassing,
                                           &CustomCode,
                                           NULL,
+                                          0,
                                           ResultsToReturn,
                                           InputFromVmxRoot);
 
@@ -3325,6 +3523,7 @@ DebuggerParseAction(PDEBUGGER_GENERAL_ACTION          ActionDetails,
                                           ActionDetails->ImmediateMessagePassing,
                                           NULL,
                                           &UserScriptConfig,
+                                          0,
                                           ResultsToReturn,
                                           InputFromVmxRoot);
 
@@ -3346,6 +3545,44 @@ DebuggerParseAction(PDEBUGGER_GENERAL_ACTION          ActionDetails,
                                           ActionDetails->ImmediateMessagePassing,
                                           NULL,
                                           NULL,
+                                          0,
+                                          ResultsToReturn,
+                                          InputFromVmxRoot);
+
+        if (!Action)
+        {
+            //
+            // Show that there was an error (error is set by the above function)
+            //
+            return FALSE;
+        }
+    }
+    else if (ActionDetails->ActionType == LBR_SNAPSHOT)
+    {
+        //
+        // Check if the count of the branches is valid
+        //
+        if (ActionDetails->LbrSnapshotCount == 0 ||
+            ActionDetails->LbrSnapshotCount > LBR_SNAPSHOT_MAXIMUM_RECORDS)
+        {
+            //
+            // Set the appropriate error
+            //
+            ResultsToReturn->IsSuccessful = FALSE;
+            ResultsToReturn->Error        = DEBUGGER_ERROR_INVALID_LBR_PARAMETERS;
+
+            return FALSE;
+        }
+
+        //
+        // Add action LBR_SNAPSHOT to event
+        //
+        Action = DebuggerAddActionToEvent(Event,
+                                          LBR_SNAPSHOT,
+                                          ActionDetails->ImmediateMessagePassing,
+                                          NULL,
+                                          NULL,
+                                          ActionDetails->LbrSnapshotCount,
                                           ResultsToReturn,
                                           InputFromVmxRoot);
 
@@ -300,6 +300,24 @@ HaltedCorePerformTargetTask(PROCESSOR_DEBUGGING_STATE * DbgState,
 
         break;
     }
+    case DEBUGGER_HALTED_CORE_TASK_SET_TSC_OFFSETTING:
+    {
+        //
+        // Enable TSC offsetting
+        //
+        DirectVmcallEnableTscOffsetting(DbgState->CoreId, (DIRECT_VMCALL_PARAMETERS *)Context);
+
+        break;
+    }
+    case DEBUGGER_HALTED_CORE_TASK_UNSET_TSC_OFFSETTING:
+    {
+        //
+        // Disable TSC offsetting
+        //
+        DirectVmcallDisableTscOffsetting(DbgState->CoreId, (DIRECT_VMCALL_PARAMETERS *)Context);
+
+        break;
+    }
     default:
         LogWarning("Warning, unknown broadcast on halted core received");
         break;
@@ -327,6 +327,17 @@ ApplyEventEptHookExecCcEvent(PDEBUGGER_EVENT                   Event,
 {
     UINT32 TempProcessId;
 
+    //
+    // The hidden breakpoints of the !syscall3 events are not shared with
+    // this event (see ApplyEventServiceTableSyscallHookEvent)
+    //
+    if (SyscallServiceTableIsTargetHooked(Event->InitOptions.OptionalParam1, Event->Tag))
+    {
+        ResultsToReturn->IsSuccessful = FALSE;
+        ResultsToReturn->Error        = DEBUGGER_ERROR_ADDRESS_IS_HOOKED_BY_ANOTHER_EVENT_TYPE;
+        goto EventNotApplied;
+    }
+
     if (InputFromVmxRoot)
     {
         //
@@ -1000,6 +1011,91 @@ ApplyEventInterruptEvent(PDEBUGGER_EVENT                   Event,
     Event->Options.OptionalParam1 = Event->InitOptions.OptionalParam1;
 }
 
+/**
+ * @brief Applying service table SYSCALL hook events (!syscall3)
+ *
+ * @param Event The created event object
+ * @param ResultsToReturn Result buffer that should be returned to
+ * the user-mode
+ * @param InputFromVmxRoot Whether the input comes from VMX root-mode or IOCTL
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ApplyEventServiceTableSyscallHookEvent(PDEBUGGER_EVENT                   Event,
+                                       PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
+                                       BOOLEAN                           InputFromVmxRoot)
+{
+    UINT64 Target;
+
+    //
+    // Find the target of the system-call in the service table
+    //
+    if (!SyscallServiceTableResolveTarget((UINT32)Event->InitOptions.OptionalParam1, &Target))
+    {
+        ResultsToReturn->IsSuccessful = FALSE;
+        ResultsToReturn->Error        = DEBUGGER_ERROR_UNABLE_TO_RESOLVE_SYSCALL_FROM_SERVICE_TABLE;
+        return FALSE;
+    }
+
+    //
+    // The hidden breakpoint of an !epthook event on the same address is not
+    // shared, clearing either of the events would remove it for the other one
+    //
+    if (SyscallServiceTableIsTargetHookedByEptHook(Target, Event->Tag))
+    {
+        ResultsToReturn->IsSuccessful = FALSE;
+        ResultsToReturn->Error        = DEBUGGER_ERROR_ADDRESS_IS_HOOKED_BY_ANOTHER_EVENT_TYPE;
+        return FALSE;
+    }
+
+    //
+    // The events of the same system-call share a single hidden breakpoint
+    //
+    if (!SyscallServiceTableIsTargetHooked(Target, Event->Tag))
+    {
+        if (InputFromVmxRoot)
+        {
+            //
+            // Breakpoints have to be intercepted as the caller to the
+            // direct hook function have to broadcast it by its own
+            //
+            HaltedBroadcastSetExceptionBitmapAllCores(EXCEPTION_VECTOR_BREAKPOINT);
+
+            if (!ConfigureEptHookFromVmxRoot((PVOID)Target))
+            {
+                ResultsToReturn->IsSuccessful = FALSE;
+                ResultsToReturn->Error        = DebuggerGetLastError();
+                return FALSE;
+            }
+
+            HaltedBroadcastInvalidateSingleContextAllCores();
+        }
+        else
+        {
+            //
+            // The target is in the kernel, so the current process is used
+            //
+            if (!ConfigureEptHook((PVOID)Target, HANDLE_TO_UINT32(PsGetCurrentProcessId())))
+            {
+                ResultsToReturn->IsSuccessful = FALSE;
+                ResultsToReturn->Error        = DebuggerGetLastError();
+                return FALSE;
+            }
+        }
+    }
+
+    //
+    // Set the event's target syscall number and the address of its
+    // hidden breakpoint
+    //
+    Event->Options.OptionalParam1 = Event->InitOptions.OptionalParam1;
+    Event->Options.OptionalParam2 = DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK;
+    Event->Options.OptionalParam3 = Target;
+
+    return TRUE;
+}
+
 /**
  * @brief Applying EFER SYSCALL hook events
  *
@@ -1008,17 +1104,23 @@ ApplyEventInterruptEvent(PDEBUGGER_EVENT                   Event,
  * the user-mode
  * @param InputFromVmxRoot Whether the input comes from VMX root-mode or IOCTL
  *
- * @return VOID
+ * @return BOOLEAN
  */
-VOID
+BOOLEAN
 ApplyEventEferSyscallHookEvent(PDEBUGGER_EVENT                   Event,
                                PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
                                BOOLEAN                           InputFromVmxRoot)
 {
-    UNREFERENCED_PARAMETER(ResultsToReturn);
-
     DEBUGGER_EVENT_SYSCALL_SYSRET_TYPE SyscallHookType = DEBUGGER_EVENT_SYSCALL_SYSRET_SAFE_ACCESS_MEMORY;
 
+    //
+    // whether it's a !syscall3 (it doesn't need the EFER hook)
+    //
+    if (Event->InitOptions.OptionalParam2 == DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK)
+    {
+        return ApplyEventServiceTableSyscallHookEvent(Event, ResultsToReturn, InputFromVmxRoot);
+    }
+
     //
     // whether it's a !syscall2 or !sysret2
     //
@@ -1071,6 +1173,8 @@ ApplyEventEferSyscallHookEvent(PDEBUGGER_EVENT                   Event,
     //
     Event->Options.OptionalParam1 = Event->InitOptions.OptionalParam1;
     Event->Options.OptionalParam2 = SyscallHookType;
+
+    return TRUE;
 }
 
 /**
@@ -0,0 +1,84 @@
+/**
+ * @file DebuggerEventSampling.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The sampling policies of the events
+ * @details Each event that has a sampling policy takes a slot, and each core
+ * keeps the sampling state of the slot in its own debugging state, so the
+ * policies are evaluated in VMX root-mode without any lock or allocation
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate a slot for the sampling states of an event
+ *
+ * @param Slot
+ *
+ * @return BOOLEAN FALSE if all of the slots are used
+ */
+BOOLEAN
+DebuggerEventSamplingAllocateSlot(UINT32 * Slot)
+{
+    for (UINT32 i = 0; i < EVENT_SAMPLING_MAXIMUM_EVENTS; i++)
+    {
+        if (!InterlockedBitTestAndSet(&g_EventSamplingSlots, i))
+        {
+            *Slot = i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Release the slot of the sampling states of an event
+ * @details The states of the cores are reset once the slot is used by
+ * another event
+ *
+ * @param Slot
+ *
+ * @return VOID
+ */
+VOID
+DebuggerEventSamplingReleaseSlot(UINT32 Slot)
+{
+    InterlockedBitTestAndReset(&g_EventSamplingSlots, Slot);
+}
+
+/**
+ * @brief Check whether the actions of the event should be run for the
+ * current trigger
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Event
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+DebuggerEventSamplingCheck(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGER_EVENT Event)
+{
+    EVENT_SAMPLING_RESULT Result;
+
+    Result = EventSamplingCheck(&Event->Sampling,
+                                &DbgState->EventSamplingStates[Event->Sampling.Slot],
+                                Event->Tag,
+                                DbgState->CoreId,
+                                __rdtsc());
+
+    if (Result == EVENT_SAMPLING_RESULT_TRIGGER_AND_DISABLE)
+    {
+        //
+        // The first-N triggers are reached, the other triggers don't
+        // even need to be checked
+        //
+        Event->Enabled = FALSE;
+    }
+
+    return Result != EVENT_SAMPLING_RESULT_SKIP;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file DebuggerEventTrace.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Recording events into the binary event trace
+ * @details Each core collects the records of its triggered events into its
+ * own pre-allocated block, so recording never allocates or waits in VMX
+ * root-mode. Full blocks are sent to the user-mode as a single message and
+ * the user-mode appends them to the (memory-mapped) trace file
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate the per-core blocks of the event trace
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+DebuggerEventTraceInitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (UINT32 i = 0; i < ProcessorsCount; i++)
+    {
+        PROCESSOR_DEBUGGING_STATE * CurrentDebuggerState = &g_DbgState[i];
+
+        if (CurrentDebuggerState->EventTraceBlock == NULL)
+        {
+            CurrentDebuggerState->EventTraceBlock = PlatformMemAllocateZeroedNonPagedPool(sizeof(EVENT_TRACE_BLOCK));
+        }
+
+        if (CurrentDebuggerState->EventTraceBlock == NULL)
+        {
+            //
+            // Out of resource, initialization of the event trace blocks failed
+            //
+            return FALSE;
+        }
+
+        EventTraceInitializeBlock(CurrentDebuggerState->EventTraceBlock, (UINT16)i);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the per-core blocks of the event trace
+ *
+ * @return VOID
+ */
+VOID
+DebuggerEventTraceUninitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (UINT32 i = 0; i < ProcessorsCount; i++)
+    {
+        PROCESSOR_DEBUGGING_STATE * CurrentDebuggerState = &g_DbgState[i];
+
+        if (CurrentDebuggerState->EventTraceBlock != NULL)
+        {
+            PlatformMemFreePool(CurrentDebuggerState->EventTraceBlock);
+            CurrentDebuggerState->EventTraceBlock = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Send the block of the current core to the user-mode and reset it
+ * @details The lock of the block should be held by the caller
+ *
+ * @param DbgState The state of the debugger on the target core
+ *
+ * @return VOID
+ */
+static VOID
+DebuggerEventTraceSendBlock(PROCESSOR_DEBUGGING_STATE * DbgState)
+{
+    PEVENT_TRACE_BLOCK Block = DbgState->EventTraceBlock;
+
+    Block->Header.NumberOfDroppedRecords = (UINT32)InterlockedExchange(&DbgState->EventTraceDroppedRecords, 0);
+
+    if (Block->Header.NumberOfRecords == 0 && Block->Header.NumberOfDroppedRecords == 0)
+    {
+        //
+        // Nothing to send
+        //
+        return;
+    }
+
+    if (LogCallbackSendBuffer(OPERATION_LOG_EVENT_TRACE_BLOCK,
+                              Block,
+                              EventTraceGetBlockLength(&Block->Header),
+                              FALSE))
+    {
+        InterlockedIncrement64(&g_EventTraceNumberOfSentBlocks);
+    }
+    else
+    {
+        InterlockedExchangeAdd64(&g_EventTraceNumberOfDroppedRecords, Block->Header.NumberOfRecords);
+    }
+
+    EventTraceInitializeBlock(Block, (UINT16)DbgState->CoreId);
+}
+
+/**
+ * @brief Record a triggered event into the block of the current core
+ * @details This function might be called from both VMX root-mode and
+ * VMX non-root mode
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Event Event Object
+ * @param EventTriggerDetail Event trigger details
+ *
+ * @return VOID
+ */
+VOID
+DebuggerEventTraceRecord(PROCESSOR_DEBUGGING_STATE *        DbgState,
+                         PDEBUGGER_EVENT                    Event,
+                         DEBUGGER_TRIGGERED_EVENT_DETAILS * EventTriggerDetail)
+{
+    EVENT_TRACE_RECORD Record;
+    UINT64 *           Registers = (UINT64 *)DbgState->Regs;
+
+    if (DbgState->EventTraceBlock == NULL)
+    {
+        return;
+    }
+
+    Record.Tag       = Event->Tag;
+    Record.Tsc       = __rdtsc();
+    Record.Rip       = VmFuncGetLastVmexitRip(DbgState->CoreId);
+    Record.Context   = (UINT64)EventTriggerDetail->Context;
+    Record.Core      = (UINT16)DbgState->CoreId;
+    Record.EventType = (UINT16)Event->EventType;
+    Record.Stage     = (UINT8)EventTriggerDetail->Stage;
+
+    for (UINT32 i = 0; i < EVENT_TRACE_NUMBER_OF_REGISTERS; i++)
+    {
+        //
+        // Register ids are validated when the event is created
+        //
+        Record.RegisterIds[i] = Event->EventTraceRegisterIds[i];
+        Record.Registers[i]   = Registers[Event->EventTraceRegisterIds[i]];
+    }
+
+    //
+    // Never wait for the lock here, the flushing routine might hold it
+    // while this core is interrupted by a VM-exit
+    //
+    if (!SpinlockTryLock(&DbgState->EventTraceLock))
+    {
+        InterlockedIncrement(&DbgState->EventTraceDroppedRecords);
+        InterlockedIncrement64(&g_EventTraceNumberOfDroppedRecords);
+        return;
+    }
+
+    if (EventTraceAddRecordToBlock(DbgState->EventTraceBlock, &Record))
+    {
+        //
+        // The block is full
+        //
+        DebuggerEventTraceSendBlock(DbgState);
+    }
+
+    SpinlockUnlock(&DbgState->EventTraceLock);
+}
+
+/**
+ * @brief Reset or flush the per-core blocks of the event trace
+ *
+ * @param OperationRequest
+ *
+ * @return VOID
+ */
+VOID
+DebuggerEventTracePerformOperation(PDEBUGGER_EVENT_TRACE_OPERATION_PACKET OperationRequest)
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    if (OperationRequest->Operation != DEBUGGER_EVENT_TRACE_OPERATION_RESET_BUFFERS &&
+        OperationRequest->Operation != DEBUGGER_EVENT_TRACE_OPERATION_FLUSH_BUFFERS)
+    {
+        OperationRequest->KernelStatus = DEBUGGER_ERROR_INVALID_EVENT_TRACE_OPERATION;
+        return;
+    }
+
+    for (UINT32 i = 0; i < ProcessorsCount; i++)
+    {
+        PROCESSOR_DEBUGGING_STATE * CurrentDebuggerState = &g_DbgState[i];
+
+        if (CurrentDebuggerState->EventTraceBlock == NULL)
+        {
+            continue;
+        }
+
+        SpinlockLock(&CurrentDebuggerState->EventTraceLock);
+
+        if (OperationRequest->Operation == DEBUGGER_EVENT_TRACE_OPERATION_FLUSH_BUFFERS)
+        {
+            DebuggerEventTraceSendBlock(CurrentDebuggerState);
+        }
+        else
+        {
+            InterlockedExchange(&CurrentDebuggerState->EventTraceDroppedRecords, 0);
+            EventTraceInitializeBlock(CurrentDebuggerState->EventTraceBlock, (UINT16)i);
+        }
+
+        SpinlockUnlock(&CurrentDebuggerState->EventTraceLock);
+    }
+
+    OperationRequest->NumberOfSentBlocks     = (UINT64)g_EventTraceNumberOfSentBlocks;
+    OperationRequest->NumberOfDroppedRecords = (UINT64)g_EventTraceNumberOfDroppedRecords;
+    OperationRequest->KernelStatus           = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
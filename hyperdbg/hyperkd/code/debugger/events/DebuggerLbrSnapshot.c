@@ -0,0 +1,82 @@
+/**
+ * @file DebuggerLbrSnapshot.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The snapshots of the Last Branch Records
+ * @details The last branches of the current core are captured when the event
+ * is triggered (the stack is frozen by the vm-exit), and each branch is sent
+ * as a message with the tag of the event, so the branches are shown with the
+ * other outputs of the event (the scripts and the custom codes)
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Capture and send the last branches of the current core
+ *
+ * @param Tag The tag of the event (the output of the event)
+ * @param ImmediateMessagePassing
+ * @param Count Number of the branches (the newest ones)
+ *
+ * @return VOID
+ */
+VOID
+DebuggerLbrSnapshotPerform(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT32 Count)
+{
+    LBR_DECODE_RECORD Records[LBR_SNAPSHOT_MAXIMUM_RECORDS];
+    UINT32            NumberOfRecords;
+    char              TempBuffer[128] = {0};
+    UINT32            TempBufferLen;
+
+    if (Count > LBR_SNAPSHOT_MAXIMUM_RECORDS)
+    {
+        Count = LBR_SNAPSHOT_MAXIMUM_RECORDS;
+    }
+
+    NumberOfRecords = VmFuncLbrCaptureSnapshot(Records, Count);
+
+    if (NumberOfRecords == 0)
+    {
+        TempBufferLen = sprintf(TempBuffer, "lbr: no branches are recorded on core %x\n", KeGetCurrentProcessorNumberEx(NULL));
+
+        LogSimpleWithTag((UINT32)Tag, ImmediateMessagePassing, TempBuffer, TempBufferLen + 1);
+        return;
+    }
+
+    for (UINT32 i = 0; i < NumberOfRecords; i++)
+    {
+        TempBufferLen = sprintf(TempBuffer,
+                                "lbr[%02x]: %016llx -> %016llx",
+                                i,
+                                Records[i].From,
+                                Records[i].To);
+
+        if (Records[i].Flags & LBR_DECODE_RECORD_FLAG_MISPREDICTED)
+        {
+            TempBufferLen += sprintf(TempBuffer + TempBufferLen, " mispredicted");
+        }
+
+        if (Records[i].Flags & LBR_DECODE_RECORD_FLAG_IN_TSX)
+        {
+            TempBufferLen += sprintf(TempBuffer + TempBufferLen, " in-tsx");
+        }
+
+        if (Records[i].Flags & LBR_DECODE_RECORD_FLAG_TSX_ABORT)
+        {
+            TempBufferLen += sprintf(TempBuffer + TempBufferLen, " tsx-abort");
+        }
+
+        if (Records[i].Flags & LBR_DECODE_RECORD_FLAG_CYCLES_VALID)
+        {
+            TempBufferLen += sprintf(TempBuffer + TempBufferLen, " cycles: %u", Records[i].Cycles);
+        }
+
+        TempBufferLen += sprintf(TempBuffer + TempBufferLen, "\n");
+
+        LogSimpleWithTag((UINT32)Tag, ImmediateMessagePassing, TempBuffer, TempBufferLen + 1);
+    }
+}
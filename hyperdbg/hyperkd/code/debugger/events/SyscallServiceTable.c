@@ -0,0 +1,190 @@
+/**
+ * @file SyscallServiceTable.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Selective system-call events (!syscall3) by hooking the service table targets
+ * @details Instead of clearing EFER.SCE (which makes every syscall in the system
+ * cause a #UD), the target of the requested system-call is resolved from the
+ * service table of the kernel and a hidden breakpoint is placed on it, thus,
+ * other system-calls run without any vm-exit. Once the hidden breakpoint is
+ * triggered, the SYSCALL_HOOK_EFER_SYSCALL events of this system-call are
+ * triggered with the system-call number as their context
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Read callback of the resolver of the service table
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallServiceTableReadMemory(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    if (!CheckAccessValidityAndSafety(Address, Size))
+    {
+        return FALSE;
+    }
+
+    return MemoryMapperReadMemorySafeOnTargetProcess(Address, Buffer, Size);
+}
+
+/**
+ * @brief Resolve the target of a system-call from the service table
+ * @details The service table is located once (from IA32_LSTAR) and then
+ * it's used for all of the next system-calls
+ *
+ * @param ServiceNumber
+ * @param Target
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallServiceTableResolveTarget(UINT32 ServiceNumber, UINT64 * Target)
+{
+    if (!g_SyscallServiceTable.IsLocated)
+    {
+        g_SyscallServiceTable.Read    = SyscallServiceTableReadMemory;
+        g_SyscallServiceTable.Context = NULL;
+
+        if (!SyscallTableLocate(&g_SyscallServiceTable, __readmsr(IA32_LSTAR)))
+        {
+            LogInfo("Err, unable to locate the service table of the kernel");
+            return FALSE;
+        }
+    }
+
+    return SyscallTableResolveService(&g_SyscallServiceTable, ServiceNumber, Target, NULL);
+}
+
+/**
+ * @brief Check whether a hidden hook is already placed on the target of a
+ * system-call by another !syscall3 event
+ *
+ * @param Target
+ * @param ExcludedTag Tag of the event that is not checked
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallServiceTableIsTargetHooked(UINT64 Target, UINT64 ExcludedTag)
+{
+    PLIST_ENTRY TempList = &g_Events->SyscallHooksEferSyscallEventsHead;
+
+    while (&g_Events->SyscallHooksEferSyscallEventsHead != TempList->Flink)
+    {
+        TempList                     = TempList->Flink;
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (CurrentEvent->Tag != ExcludedTag &&
+            CurrentEvent->Options.OptionalParam2 == DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK &&
+            CurrentEvent->Options.OptionalParam3 == Target)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Check whether a hidden breakpoint is already placed on the target
+ * of a system-call by an !epthook event
+ * @details The hidden breakpoints of !epthook events are not shared with the
+ * !syscall3 events (removing either of them would remove the breakpoint of
+ * the other one), so the same address is not accepted for both of them
+ *
+ * @param Target
+ * @param ExcludedTag Tag of the event that is not checked
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallServiceTableIsTargetHookedByEptHook(UINT64 Target, UINT64 ExcludedTag)
+{
+    PLIST_ENTRY TempList = &g_Events->EptHookExecCcEventsHead;
+
+    while (&g_Events->EptHookExecCcEventsHead != TempList->Flink)
+    {
+        TempList                     = TempList->Flink;
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (CurrentEvent->Tag != ExcludedTag && CurrentEvent->Options.OptionalParam1 == Target)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Trigger the !syscall3 events if a hidden breakpoint on the
+ * target of their system-call is triggered
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param CallingStage
+ * @param Context The address of the triggered hidden breakpoint
+ * @param PostEventRequired
+ *
+ * @return VMM_CALLBACK_TRIGGERING_EVENT_STATUS_TYPE the status of handling
+ * the !syscall3 events (e.g., whether they requested short-circuiting)
+ */
+VMM_CALLBACK_TRIGGERING_EVENT_STATUS_TYPE
+SyscallServiceTableTriggerEvents(PROCESSOR_DEBUGGING_STATE *           DbgState,
+                                 VMM_CALLBACK_EVENT_CALLING_STAGE_TYPE CallingStage,
+                                 PVOID                                 Context,
+                                 BOOLEAN *                             PostEventRequired)
+{
+    PLIST_ENTRY                               TempList      = &g_Events->SyscallHooksEferSyscallEventsHead;
+    UINT64                                    ServiceNumber = DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS;
+    VMM_CALLBACK_TRIGGERING_EVENT_STATUS_TYPE Status;
+
+    while (&g_Events->SyscallHooksEferSyscallEventsHead != TempList->Flink)
+    {
+        TempList                     = TempList->Flink;
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (CurrentEvent->Options.OptionalParam2 == DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK &&
+            CurrentEvent->Options.OptionalParam3 == (UINT64)Context)
+        {
+            ServiceNumber = CurrentEvent->Options.OptionalParam1;
+            break;
+        }
+    }
+
+    if (ServiceNumber == DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS)
+    {
+        //
+        // It's a regular hidden breakpoint (!epthook)
+        //
+        return VMM_CALLBACK_TRIGGERING_EVENT_STATUS_SUCCESSFUL;
+    }
+
+    //
+    // Only the events of the service table are checked in this round,
+    // see DebuggerTriggerEvents
+    //
+    DbgState->IsTriggeringServiceTableSyscallEvents = TRUE;
+
+    Status = DebuggerTriggerEvents(SYSCALL_HOOK_EFER_SYSCALL,
+                                   CallingStage,
+                                   (PVOID)ServiceNumber,
+                                   PostEventRequired,
+                                   DbgState->Regs);
+
+    DbgState->IsTriggeringServiceTableSyscallEvents = FALSE;
+
+    return Status;
+}
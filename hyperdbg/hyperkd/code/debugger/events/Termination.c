@@ -1113,6 +1113,48 @@ TerminateDebugRegistersEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot)
     }
 }
 
+/**
+ * @brief Termination function for service table SYSCALL hook events (!syscall3)
+ *
+ * @param Event Target Event Object
+ * @param InputFromVmxRoot Whether the input comes from VMX root-mode or IOCTL
+ *
+ * @return VOID
+ */
+VOID
+TerminateServiceTableSyscallHookEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot)
+{
+    //
+    // In this hook Event->OptionalParam3 is the virtual address of the
+    // target of the system-call, it's not set if the event is not applied
+    //
+    if (Event->Options.OptionalParam3 == NULL64_ZERO)
+    {
+        return;
+    }
+
+    //
+    // The hidden breakpoint is shared with the other events of the
+    // same system-call
+    //
+    if (SyscallServiceTableIsTargetHooked(Event->Options.OptionalParam3, Event->Tag))
+    {
+        return;
+    }
+
+    if (InputFromVmxRoot)
+    {
+        TerminateEptHookUnHookSingleAddressFromVmxRootAndApplyInvalidation(Event->Options.OptionalParam3,
+                                                                           (UINT64)NULL);
+    }
+    else
+    {
+        ConfigureEptHookUnHookSingleAddress(Event->Options.OptionalParam3,
+                                            (UINT64)NULL,
+                                            Event->ProcessId);
+    }
+}
+
 /**
  * @brief Termination function for SYSCALL Instruction events
  *
@@ -1127,6 +1169,15 @@ TerminateSyscallHookEferEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot)
     PLIST_ENTRY                      TempList        = 0;
     DEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn = {0};
 
+    //
+    // The !syscall3 events don't use the EFER hook
+    //
+    if (Event->Options.OptionalParam2 == DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK)
+    {
+        TerminateServiceTableSyscallHookEvent(Event, InputFromVmxRoot);
+        return;
+    }
+
     //
     // For this event we should also check for sysret instructions events too
     // because both of them are emulated by a single bit in vmx controls
@@ -1167,9 +1218,11 @@ TerminateSyscallHookEferEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot)
 
             //
             // We have to check because we don't want to re-apply
-            // the terminated event
+            // the terminated event, the !syscall3 events are not
+            // affected by the EFER hook
             //
-            if (CurrentEvent->Tag != Event->Tag)
+            if (CurrentEvent->Tag != Event->Tag &&
+                CurrentEvent->Options.OptionalParam2 != DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK)
             {
                 //
                 // re-apply the event
@@ -313,3 +313,39 @@ ValidateEventEptHookHiddenBreakpointAndInlineHooks(PDEBUGGER_GENERAL_EVENT_DETAI
     //
     return TRUE;
 }
+
+/**
+ * @brief Validating syscall events
+ *
+ * @param Event The created event object
+ * @param ResultsToReturn Result buffer that should be returned to
+ * the user-mode
+ * @param InputFromVmxRoot Whether the input comes from VMX root-mode or IOCTL
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ValidateEventSyscall(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
+                     PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
+                     BOOLEAN                           InputFromVmxRoot)
+{
+    UNREFERENCED_PARAMETER(InputFromVmxRoot);
+
+    //
+    // The hidden hooks on the service table (!syscall3) are placed on the target
+    // of a single system-call and they're triggered before the target is executed
+    //
+    if (EventDetails->Options.OptionalParam2 == DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK &&
+        (EventDetails->Options.OptionalParam1 == DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS ||
+         EventDetails->EventStage != VMM_CALLBACK_CALLING_STAGE_PRE_EVENT_EMULATION))
+    {
+        ResultsToReturn->IsSuccessful = FALSE;
+        ResultsToReturn->Error        = DEBUGGER_ERROR_INVALID_SERVICE_TABLE_SYSCALL_HOOK;
+        return FALSE;
+    }
+
+    //
+    // The event parameters are valid at this stage
+    //
+    return TRUE;
+}
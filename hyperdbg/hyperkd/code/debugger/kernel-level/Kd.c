@@ -51,6 +51,17 @@ KdInitializeKernelDebugger()
     //
     KdInitializeInstantEventPools();
 
+    //
+    // Allocate the buffer of the pause packet and its prefetched state, nothing
+    // is prefetched until the debugger asks for it
+    //
+    RtlZeroMemory(&g_KdPausePrefetchOptions, sizeof(DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET));
+
+    if (g_KdPausedPacketBuffer == NULL)
+    {
+        g_KdPausedPacketBuffer = PlatformMemAllocateNonPagedPool(KD_PAUSED_PACKET_BUFFER_SIZE);
+    }
+
     //
     // Indicate that the kernel debugger is active
     //
@@ -88,6 +99,17 @@ KdUninitializeKernelDebugger()
         //
         BreakpointRemoveAllBreakpoints();
 
+        //
+        // Free the buffer of the pause packet and its prefetched state
+        //
+        RtlZeroMemory(&g_KdPausePrefetchOptions, sizeof(DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET));
+
+        if (g_KdPausedPacketBuffer != NULL)
+        {
+            PlatformMemFreePool(g_KdPausedPacketBuffer);
+            g_KdPausedPacketBuffer = NULL;
+        }
+
         //
         // Disable vm-exit on Hardware debug exceptions and breakpoints
         // so, not intercept #DBs and #BP by changing exception bitmap (one core)
@@ -1105,9 +1127,11 @@ KdHandleRegisteredMtfCallback(UINT32 CoreId)
         // Only 16 bit is needed however, vmwrite might write on other bits
         // and corrupt other variables, that's why we get 64bit
         //
-        UINT64                           CsSel         = NULL64_ZERO;
-        DEBUGGER_TRIGGERED_EVENT_DETAILS TargetContext = {0};
-        UINT64                           LastVmexitRip = VmFuncGetLastVmexitRip(CoreId);
+        UINT64                           CsSel             = NULL64_ZERO;
+        DEBUGGER_TRIGGERED_EVENT_DETAILS TargetContext     = {0};
+        UINT64                           LastVmexitRip     = VmFuncGetLastVmexitRip(CoreId);
+        BOOLEAN                          IsStepTrace       = DbgState->InstrumentationStepInTrace.CountedTrace;
+        BOOLEAN                          ContinueStepTrace = FALSE;
 
         //
         // Check if the cs selector changed or not, which indicates that the
@@ -1124,6 +1148,31 @@ KdHandleRegisteredMtfCallback(UINT32 CoreId)
         //
         DbgState->InstrumentationStepInTrace.CsSel = 0;
 
+        if (IsStepTrace)
+        {
+            //
+            // Record the step of the counted step trace (i command with the 'trace' keyword)
+            //
+            ContinueStepTrace = KdStepTraceRecordStep(DbgState, LastVmexitRip);
+
+            if (ContinueStepTrace)
+            {
+                //
+                // The debugger reads the trace while the debuggee is paused on a
+                // breakpoint, so the trace is considered as stopped by a breakpoint
+                // until the breakpoints are checked
+                //
+                KdStepTraceStop(DbgState, STEP_TRACE_STOP_REASON_BREAKPOINT);
+            }
+            else
+            {
+                //
+                // The steps are disassembled from the trace, not the pause packet
+                //
+                DbgState->IgnoreDisasmInNextPacket = TRUE;
+            }
+        }
+
         //
         // Check and handle if there is a software defined breakpoint
         //
@@ -1132,13 +1181,26 @@ KdHandleRegisteredMtfCallback(UINT32 CoreId)
                                                                 DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED,
                                                                 TRUE))
         {
+            if (ContinueStepTrace)
+            {
+                //
+                // No breakpoint, continue the counted step trace without pausing
+                //
+                DbgState->InstrumentationStepInTrace.CountedTrace                   = TRUE;
+                DbgState->InstrumentationStepInTrace.TraceBuffer->Header.StopReason = STEP_TRACE_STOP_REASON_NOT_STOPPED;
+
+                KdGuaranteedStepInstruction(DbgState);
+
+                return;
+            }
+
             //
             // Handle the step (if the disassembly ignored here, it means the debugger wants to use it
             // as a tracking mechanism, so we'll change the reason for that)
             //
             TargetContext.Context = (PVOID)LastVmexitRip;
             KdHandleBreakpointAndDebugBreakpoints(DbgState,
-                                                  DbgState->IgnoreDisasmInNextPacket ? DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_STEPPED : DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED,
+                                                  DbgState->IgnoreDisasmInNextPacket && !IsStepTrace ? DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_STEPPED : DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED,
                                                   &TargetContext);
         }
     }
@@ -2186,6 +2248,10 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
     PDEBUGGEE_BP_PACKET                                 BpPacket;
     PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS           PtePacket;
     PSMI_OPERATION_PACKETS                              SmiOperationPacket;
+    PDEBUGGEE_STEP_TRACE_READ_PACKET                    StepTraceReadPacket;
+    PDEBUGGER_BULK_READ_MEMORY                          BulkReadMemoryPacket;
+    PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET             PausePrefetchOptionsPacket;
+    PTSC_OFFSETTING_OPERATION_PACKETS                   TscOffsettingPacket;
     PDEBUGGER_APIC_REQUEST                              ApicPacket;
     PINTERRUPT_DESCRIPTOR_TABLE_ENTRIES_PACKETS         IdtEntryPacket;
     PDEBUGGER_PAGE_IN_REQUEST                           PageinPacket;
@@ -2306,6 +2372,32 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
 
                     break;
 
+                case DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_COUNTED_TRACE:
+
+                    //
+                    // Counted guaranteed step in (i command with the 'trace' keyword), if the
+                    // trace couldn't be started, only a single step is performed and the debugger
+                    // is notified about it once it reads the trace
+                    //
+                    KdStepTraceStart(DbgState, SteppingPacket);
+
+                    //
+                    // Indicate a step
+                    //
+                    KdGuaranteedStepInstruction(DbgState);
+
+                    //
+                    // Unlock just on core
+                    //
+                    KdContinueDebuggeeJustCurrentCore(DbgState);
+
+                    //
+                    // No need to wait for new commands
+                    //
+                    EscapeFromTheLoop = TRUE;
+
+                    break;
+
                 case DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER:
                 case DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU:
                 case DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU_LAST_INSTRUCTION:
@@ -2901,6 +2993,92 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
 
                 break;
 
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_STEP_TRACE:
+
+                StepTraceReadPacket = (DEBUGGEE_STEP_TRACE_READ_PACKET *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Read a chunk of the counted step trace of the current core (the
+                // chunk is copied after the packet)
+                //
+                KdStepTraceReadChunk(DbgState, StepTraceReadPacket);
+
+                //
+                // Send the result of the step trace back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_READING_STEP_TRACE,
+                                           (CHAR *)StepTraceReadPacket,
+                                           SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET + StepTraceReadPacket->ChunkSize);
+
+                break;
+
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_BULK_READ_MEMORY:
+
+                BulkReadMemoryPacket = (DEBUGGER_BULK_READ_MEMORY *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Read the pages (they're copied after the packet)
+                //
+                if (DebuggerCommandBulkReadMemory(BulkReadMemoryPacket,
+                                                  (UCHAR *)BulkReadMemoryPacket + SIZEOF_DEBUGGER_BULK_READ_MEMORY,
+                                                  TRUE))
+                {
+                    ReturnSize = BulkReadMemoryPacket->Size;
+                }
+                else
+                {
+                    ReturnSize = 0;
+                }
+
+                //
+                // Send the result of reading memory back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_BULK_READING_MEMORY,
+                                           (CHAR *)BulkReadMemoryPacket,
+                                           SIZEOF_DEBUGGER_BULK_READ_MEMORY + ReturnSize);
+
+                break;
+
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SET_PAUSE_PREFETCH:
+
+                PausePrefetchOptionsPacket = (DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Set the state that is prefetched in the next pause packets
+                //
+                KdSetPausePrefetchOptions(PausePrefetchOptionsPacket);
+
+                //
+                // Send the result of setting the options back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SET_PAUSE_PREFETCH,
+                                           (CHAR *)PausePrefetchOptionsPacket,
+                                           SIZEOF_DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET);
+
+                break;
+
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_PERFORM_TSC_OFFSETTING_OPERATION:
+
+                TscOffsettingPacket = (TSC_OFFSETTING_OPERATION_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Perform the TSC offsetting operation (applied to the halted cores)
+                //
+                ExtensionCommandPerformTscOffsettingOperation(TscOffsettingPacket, TRUE);
+
+                //
+                // Send the result of the TSC offsetting operation back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_TSC_OFFSETTING_OPERATION,
+                                           (CHAR *)TscOffsettingPacket,
+                                           SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS);
+
+                break;
+
             case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_PERFORM_ACTIONS_ON_APIC:
 
                 ApicPacket = (DEBUGGER_APIC_REQUEST *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
@@ -3133,6 +3311,140 @@ KdIsGuestOnUsermode32Bit()
     return FALSE;
 }
 
+/**
+ * @brief Set the state that is prefetched in the pause packets
+ *
+ * @param PausePrefetchOptions
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSetPausePrefetchOptions(PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET PausePrefetchOptions)
+{
+    if (PausePrefetchOptions->StackWindowSize > DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_STACK_WINDOW ||
+        PausePrefetchOptions->CodeWindowSize > DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_CODE_WINDOW)
+    {
+        PausePrefetchOptions->KernelStatus = DEBUGGER_ERROR_INVALID_PAUSE_PREFETCH_OPTIONS;
+        return FALSE;
+    }
+
+    if (g_KdPausedPacketBuffer == NULL)
+    {
+        PausePrefetchOptions->KernelStatus = DEBUGGER_ERROR_PRE_ALLOCATED_BUFFER_IS_EMPTY;
+        return FALSE;
+    }
+
+    g_KdPausePrefetchOptions.PrefetchRegisters = PausePrefetchOptions->PrefetchRegisters;
+    g_KdPausePrefetchOptions.StackWindowSize   = PausePrefetchOptions->StackWindowSize;
+    g_KdPausePrefetchOptions.CodeWindowSize    = PausePrefetchOptions->CodeWindowSize;
+
+    PausePrefetchOptions->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+    return TRUE;
+}
+
+/**
+ * @brief Read a window of the memory for the pause packet
+ * @details The window is read page by page through the same routine as the read
+ * memory requests (so the bytes of the breakpoints are restored), and it stops
+ * at the first page that is not available
+ *
+ * @param Address
+ * @param Size
+ * @param Buffer
+ * @param AddressMode The address mode of the window (optional)
+ *
+ * @return UINT32 Number of the bytes that are read
+ */
+UINT32
+KdReadPausePrefetchWindow(UINT64 Address, UINT32 Size, BYTE * Buffer, DEBUGGER_READ_MEMORY_ADDRESS_MODE * AddressMode)
+{
+    DEBUGGER_READ_MEMORY ReadMem;
+    UINT32               ReadBytes  = 0;
+    UINT32               ChunkSize  = 0;
+    UINT32               ReturnSize = 0;
+
+    while (ReadBytes < Size && Address + ReadBytes >= Address)
+    {
+        ChunkSize = PAGE_SIZE - (UINT32)((Address + ReadBytes) & (PAGE_SIZE - 1));
+        ChunkSize = ChunkSize < Size - ReadBytes ? ChunkSize : Size - ReadBytes;
+
+        RtlZeroMemory(&ReadMem, sizeof(DEBUGGER_READ_MEMORY));
+
+        ReadMem.Address        = Address + ReadBytes;
+        ReadMem.Size           = ChunkSize;
+        ReadMem.MemoryType     = DEBUGGER_READ_VIRTUAL_ADDRESS;
+        ReadMem.GetAddressMode = AddressMode != NULL && ReadBytes == 0;
+
+        if (!DebuggerCommandReadMemoryVmxRoot(&ReadMem, Buffer + ReadBytes, &ReturnSize))
+        {
+            break;
+        }
+
+        if (ReadMem.GetAddressMode)
+        {
+            *AddressMode = ReadMem.AddressMode;
+        }
+
+        ReadBytes += ChunkSize;
+    }
+
+    return ReadBytes;
+}
+
+/**
+ * @brief Fill the state of the halted core that is prefetched after the pause packet
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Prefetch
+ *
+ * @return UINT32 Size of the prefetch and its windows
+ */
+UINT32
+KdFillPausePrefetch(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGEE_KD_PAUSED_PREFETCH Prefetch)
+{
+    BYTE * Windows = (BYTE *)Prefetch + sizeof(DEBUGGEE_KD_PAUSED_PREFETCH);
+
+    RtlZeroMemory(Prefetch, sizeof(DEBUGGEE_KD_PAUSED_PREFETCH));
+
+    //
+    // All of the general-purpose registers and the registers of the 'r' command
+    //
+    if (g_KdPausePrefetchOptions.PrefetchRegisters)
+    {
+        Prefetch->HasRegisters = TRUE;
+
+        memcpy(&Prefetch->Regs, DbgState->Regs, sizeof(GUEST_REGS));
+
+        Prefetch->ExtraRegs.CS     = (UINT16)DebuggerGetRegValueWrapper(NULL, REGISTER_CS);
+        Prefetch->ExtraRegs.SS     = (UINT16)DebuggerGetRegValueWrapper(NULL, REGISTER_SS);
+        Prefetch->ExtraRegs.DS     = (UINT16)DebuggerGetRegValueWrapper(NULL, REGISTER_DS);
+        Prefetch->ExtraRegs.ES     = (UINT16)DebuggerGetRegValueWrapper(NULL, REGISTER_ES);
+        Prefetch->ExtraRegs.FS     = (UINT16)DebuggerGetRegValueWrapper(NULL, REGISTER_FS);
+        Prefetch->ExtraRegs.GS     = (UINT16)DebuggerGetRegValueWrapper(NULL, REGISTER_GS);
+        Prefetch->ExtraRegs.RFLAGS = DebuggerGetRegValueWrapper(NULL, REGISTER_RFLAGS);
+        Prefetch->ExtraRegs.RIP    = DebuggerGetRegValueWrapper(NULL, REGISTER_RIP);
+    }
+
+    //
+    // The stack window (from the stack pointer) and the code window (from the
+    // instruction pointer)
+    //
+    Prefetch->StackAddress = DbgState->Regs->rsp;
+    Prefetch->StackSize    = KdReadPausePrefetchWindow(Prefetch->StackAddress,
+                                                    g_KdPausePrefetchOptions.StackWindowSize,
+                                                    Windows,
+                                                    NULL);
+
+    Prefetch->CodeAddress = VmFuncGetRip();
+    Prefetch->CodeSize    = KdReadPausePrefetchWindow(Prefetch->CodeAddress,
+                                                   g_KdPausePrefetchOptions.CodeWindowSize,
+                                                   Windows + Prefetch->StackSize,
+                                                   &Prefetch->CodeAddressMode);
+
+    return sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) + Prefetch->StackSize + Prefetch->CodeSize;
+}
+
 /**
  * @brief manage system halt on vmx-root mode
  * @details This function should only be called from KdHandleBreakpointAndDebugBreakpoints
@@ -3150,6 +3462,7 @@ KdManageSystemHaltOnVmxRoot(PROCESSOR_DEBUGGING_STATE *       DbgState,
     ULONG                     ExitInstructionLength = 0;
     RFLAGS                    Rflags                = {0};
     UINT64                    LastVmexitRip         = 0;
+    BOOLEAN                   IsPrefetchEnabled     = FALSE;
 
     //
     // Perform Pre-halt tasks
@@ -3244,13 +3557,44 @@ StartAgain:
                                                   ExitInstructionLength);
 
         //
-        // Send the pause packet, along with RIP and an indication
-        // to pause to the debugger
+        // Check whether the debugger asked for prefetching the state of the core
+        // (to save the round-trips of the usual commands after pausing)
         //
-        KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
-                                   DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
-                                   (CHAR *)&PausePacket,
-                                   sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+        IsPrefetchEnabled = g_KdPausedPacketBuffer != NULL &&
+                            (g_KdPausePrefetchOptions.PrefetchRegisters ||
+                             g_KdPausePrefetchOptions.StackWindowSize != 0 ||
+                             g_KdPausePrefetchOptions.CodeWindowSize != 0);
+
+        if (IsPrefetchEnabled)
+        {
+            //
+            // The prefetched state is sent right after the pause packet
+            //
+            PausePacket.PrefetchSize = KdFillPausePrefetch(DbgState,
+                                                           (PDEBUGGEE_KD_PAUSED_PREFETCH)((CHAR *)g_KdPausedPacketBuffer + sizeof(DEBUGGEE_KD_PAUSED_PACKET)));
+
+            memcpy(g_KdPausedPacketBuffer, &PausePacket, sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+
+            //
+            // Send the pause packet, along with RIP, the prefetched state and
+            // an indication to pause to the debugger
+            //
+            KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                       DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
+                                       (CHAR *)g_KdPausedPacketBuffer,
+                                       sizeof(DEBUGGEE_KD_PAUSED_PACKET) + PausePacket.PrefetchSize);
+        }
+        else
+        {
+            //
+            // Send the pause packet, along with RIP and an indication
+            // to pause to the debugger
+            //
+            KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                       DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
+                                       (CHAR *)&PausePacket,
+                                       sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+        }
 
         //
         // Perform Commands from the debugger
@@ -0,0 +1,255 @@
+/**
+ * @file KdStepTrace.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Counted instrumentation step-in trace
+ * @details Instead of pausing and sending a packet to the debugger after each
+ * MTF step (i command), the current core keeps stepping by itself and records
+ * the steps into its pre-allocated (delta-compressed) trace buffer. The
+ * debuggee is paused once the count is reached or the buffer is full, then
+ * the debugger reads the buffer in a few large chunks and disassembles it
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate the per-core buffers of the step trace
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdStepTraceInitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (UINT32 i = 0; i < ProcessorsCount; i++)
+    {
+        PROCESSOR_DEBUGGING_STATE * CurrentDebuggerState = &g_DbgState[i];
+
+        if (CurrentDebuggerState->InstrumentationStepInTrace.TraceBuffer == NULL)
+        {
+            CurrentDebuggerState->InstrumentationStepInTrace.TraceBuffer = PlatformMemAllocateZeroedNonPagedPool(sizeof(STEP_TRACE_BUFFER));
+        }
+
+        if (CurrentDebuggerState->InstrumentationStepInTrace.TraceBuffer == NULL)
+        {
+            //
+            // Out of resource, initialization of the step trace buffers failed
+            //
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the per-core buffers of the step trace
+ *
+ * @return VOID
+ */
+VOID
+KdStepTraceUninitialize()
+{
+    ULONG ProcessorsCount = KeQueryActiveProcessorCount(0);
+
+    for (UINT32 i = 0; i < ProcessorsCount; i++)
+    {
+        PROCESSOR_DEBUGGING_STATE * CurrentDebuggerState = &g_DbgState[i];
+
+        CurrentDebuggerState->InstrumentationStepInTrace.CountedTrace = FALSE;
+
+        if (CurrentDebuggerState->InstrumentationStepInTrace.TraceBuffer != NULL)
+        {
+            PlatformMemFreePool(CurrentDebuggerState->InstrumentationStepInTrace.TraceBuffer);
+            CurrentDebuggerState->InstrumentationStepInTrace.TraceBuffer = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Read the traced registers of the current core
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Registers
+ *
+ * @return VOID
+ */
+static VOID
+KdStepTraceReadRegisters(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 * Registers)
+{
+    PSTEP_TRACE_BUFFER TraceBuffer    = DbgState->InstrumentationStepInTrace.TraceBuffer;
+    UINT64 *           GuestRegisters = (UINT64 *)DbgState->Regs;
+
+    for (UINT32 i = 0; i < TraceBuffer->Header.NumberOfRegisters; i++)
+    {
+        //
+        // Register ids are validated when the trace is started
+        //
+        Registers[i] = GuestRegisters[TraceBuffer->Header.RegisterIds[i]];
+    }
+}
+
+/**
+ * @brief Start a counted step trace on the current core
+ * @details This function should be called in vmx-root
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param StepPacket
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdStepTraceStart(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGEE_STEP_PACKET StepPacket)
+{
+    PSTEP_TRACE_BUFFER TraceBuffer                               = DbgState->InstrumentationStepInTrace.TraceBuffer;
+    UINT64             Registers[STEP_TRACE_NUMBER_OF_REGISTERS] = {0};
+    UINT64 *           GuestRegisters                            = (UINT64 *)DbgState->Regs;
+
+    DbgState->InstrumentationStepInTrace.CountedTrace = FALSE;
+
+    if (TraceBuffer == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Invalidate the previous trace
+    //
+    TraceBuffer->Header.Magic = 0;
+
+    if (StepPacket->Count == 0 || StepPacket->NumberOfRegisters > STEP_TRACE_NUMBER_OF_REGISTERS)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < StepPacket->NumberOfRegisters; i++)
+    {
+        if (StepPacket->RegisterIds[i] >= EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS)
+        {
+            return FALSE;
+        }
+
+        Registers[i] = GuestRegisters[StepPacket->RegisterIds[i]];
+    }
+
+    if (!StepTraceInitializeBuffer(TraceBuffer,
+                                   (UINT16)DbgState->CoreId,
+                                   StepPacket->NumberOfRegisters,
+                                   StepPacket->RegisterIds,
+                                   VmFuncGetLastVmexitRip(DbgState->CoreId),
+                                   Registers))
+    {
+        return FALSE;
+    }
+
+    DbgState->InstrumentationStepInTrace.RemainingSteps = StepPacket->Count;
+    DbgState->InstrumentationStepInTrace.CountedTrace   = TRUE;
+
+    return TRUE;
+}
+
+/**
+ * @brief Record a step of the counted step trace
+ * @details This function should be called in vmx-root
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Rip RIP after the step
+ *
+ * @return BOOLEAN TRUE if the trace should continue without pausing
+ */
+BOOLEAN
+KdStepTraceRecordStep(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 Rip)
+{
+    PSTEP_TRACE_BUFFER TraceBuffer                               = DbgState->InstrumentationStepInTrace.TraceBuffer;
+    UINT64             Registers[STEP_TRACE_NUMBER_OF_REGISTERS] = {0};
+
+    KdStepTraceReadRegisters(DbgState, Registers);
+
+    if (!StepTraceAddStep(TraceBuffer, Rip, Registers))
+    {
+        KdStepTraceStop(DbgState, STEP_TRACE_STOP_REASON_BUFFER_FULL);
+        return FALSE;
+    }
+
+    DbgState->InstrumentationStepInTrace.RemainingSteps--;
+
+    if (DbgState->InstrumentationStepInTrace.RemainingSteps == 0)
+    {
+        KdStepTraceStop(DbgState, STEP_TRACE_STOP_REASON_COUNT_REACHED);
+        return FALSE;
+    }
+
+    if (StepTraceIsBufferFull(TraceBuffer))
+    {
+        //
+        // Pause now, the debugger continues the trace after reading the buffer
+        //
+        KdStepTraceStop(DbgState, STEP_TRACE_STOP_REASON_BUFFER_FULL);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Stop the counted step trace of the current core
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param StopReason
+ *
+ * @return VOID
+ */
+VOID
+KdStepTraceStop(PROCESSOR_DEBUGGING_STATE * DbgState, STEP_TRACE_STOP_REASON StopReason)
+{
+    DbgState->InstrumentationStepInTrace.CountedTrace                   = FALSE;
+    DbgState->InstrumentationStepInTrace.TraceBuffer->Header.StopReason = (UINT8)StopReason;
+}
+
+/**
+ * @brief Read a chunk of the step trace buffer of the current core
+ * @details This function should be called in vmx-root, the chunk is
+ * copied right after the read packet
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param ReadPacket
+ *
+ * @return VOID
+ */
+VOID
+KdStepTraceReadChunk(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGEE_STEP_TRACE_READ_PACKET ReadPacket)
+{
+    PSTEP_TRACE_BUFFER TraceBuffer = DbgState->InstrumentationStepInTrace.TraceBuffer;
+    UINT32             ChunkSize;
+
+    ReadPacket->ChunkSize = 0;
+
+    if (TraceBuffer == NULL ||
+        TraceBuffer->Header.Magic != STEP_TRACE_BUFFER_MAGIC ||
+        DbgState->InstrumentationStepInTrace.CountedTrace ||
+        ReadPacket->Offset > TraceBuffer->Header.DataSize)
+    {
+        ReadPacket->KernelStatus = DEBUGGER_ERROR_INVALID_STEP_TRACE_CHUNK;
+        return;
+    }
+
+    ChunkSize = TraceBuffer->Header.DataSize - ReadPacket->Offset;
+
+    if (ChunkSize > STEP_TRACE_MAXIMUM_CHUNK_SIZE)
+    {
+        ChunkSize = STEP_TRACE_MAXIMUM_CHUNK_SIZE;
+    }
+
+    memcpy(&ReadPacket->Header, &TraceBuffer->Header, sizeof(STEP_TRACE_HEADER));
+    memcpy((UINT8 *)ReadPacket + sizeof(DEBUGGEE_STEP_TRACE_READ_PACKET),
+           &TraceBuffer->Data[ReadPacket->Offset],
+           ChunkSize);
+
+    ReadPacket->ChunkSize    = ChunkSize;
+    ReadPacket->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
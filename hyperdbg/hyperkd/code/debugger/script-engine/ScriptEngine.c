@@ -121,3 +121,69 @@ ScriptEngineGetTargetCoreDate()
     //
     return (UINT64)&DbgState->DateTimeHolder.DateBuffer;
 }
+
+/**
+ * @brief Lower the condition of the script of an event to a filter
+ * @details The filter is only used if the script is the only action of
+ * the event, otherwise the other actions should be performed even if the
+ * condition of the script is false
+ *
+ * @param Event
+ * @param Action The action that is being added to the event (its type,
+ * and the event's count of actions are already updated)
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineUpdateEventFilter(PDEBUGGER_EVENT Event, PDEBUGGER_EVENT_ACTION Action)
+{
+    //
+    // The filter is disabled before the action is added, so the new action
+    // is never skipped because of the condition of another action
+    //
+    Event->HasScriptFilter = FALSE;
+
+    if (Event->CountOfActions != 1 || Action->ActionType != RUN_SCRIPT)
+    {
+        return;
+    }
+
+    if (ScriptFilterCompile((PSYMBOL)Action->ScriptConfiguration.ScriptBuffer,
+                            Action->ScriptConfiguration.ScriptPointer,
+                            &Event->ScriptFilter))
+    {
+        Event->HasScriptFilter = TRUE;
+    }
+}
+
+/**
+ * @brief Check the filter of the script of an event
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Event
+ *
+ * @return BOOLEAN FALSE if the script does nothing for this trigger
+ */
+BOOLEAN
+ScriptEngineCheckEventFilter(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGER_EVENT Event)
+{
+    UINT64 PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_COUNT] = {0};
+
+    //
+    // Only the pseudo-registers that are used by the filter are read
+    // (the same as the script engine)
+    //
+    if (Event->ScriptFilter.PseudoRegisters & (1 << SCRIPT_FILTER_PSEUDO_REGISTER_PID))
+    {
+        PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_PID] = (UINT64)PsGetCurrentProcessId();
+    }
+
+    if (Event->ScriptFilter.PseudoRegisters & (1 << SCRIPT_FILTER_PSEUDO_REGISTER_TID))
+    {
+        PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_TID] = (UINT64)PsGetCurrentThreadId();
+    }
+
+    PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_CORE] = DbgState->CoreId;
+
+    return ScriptFilterEvaluate(&Event->ScriptFilter, DbgState->Regs, PseudoRegisters);
+}
@@ -27,6 +27,7 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     PIO_STACK_LOCATION                                      IrpStack;
     PREGISTER_NOTIFY_BUFFER                                 RegisterEventRequest;
     PDEBUGGER_READ_MEMORY                                   DebuggerReadMemRequest;
+    PDEBUGGER_BULK_READ_MEMORY                              DebuggerBulkReadMemRequest;
     PDEBUGGER_READ_AND_WRITE_ON_MSR                         DebuggerReadOrWriteMsrRequest;
     PDEBUGGER_HIDE_AND_TRANSPARENT_DEBUGGER_MODE            DebuggerHideAndUnhideRequest;
     PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS               DebuggerPteRequest;
@@ -59,6 +60,11 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     PDEBUGGER_PAUSE_PACKET_RECEIVED                         DebuggerPauseKernelRequest;
     PDEBUGGER_GENERAL_ACTION                                DebuggerNewActionRequest;
     PSMI_OPERATION_PACKETS                                  SmiOperationRequest;
+    PDEBUGGER_EVENT_TRACE_OPERATION_PACKET                  EventTraceOperationRequest;
+    PTSC_OFFSETTING_OPERATION_PACKETS                       TscOffsettingRequest;
+    PPROFILER_OPERATION_PACKETS                             ProfilerRequest;
+    PPROCESSOR_TRACE_OPERATION_PACKETS                      ProcessorTraceRequest;
+    PLBR_OPERATION_PACKETS                                  LbrRequest;
     PVOID                                                   BufferToStoreThreadsAndProcessesDetails;
     NTSTATUS                                                Status;
     ULONG                                                   InBuffLength;  // Input buffer length
@@ -207,6 +213,59 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
             break;
 
+        case IOCTL_DEBUGGER_BULK_READ_MEMORY:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_BULK_READ_MEMORY ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            InBuffLength  = IrpStack->Parameters.DeviceIoControl.InputBufferLength;
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            DebuggerBulkReadMemRequest = (PDEBUGGER_BULK_READ_MEMORY)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // The output buffer should be able to hold the entire range
+            //
+            if (!InBuffLength || OutBuffLength < (UINT64)SIZEOF_DEBUGGER_BULK_READ_MEMORY + DebuggerBulkReadMemRequest->Size)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            if (DebuggerCommandBulkReadMemory(DebuggerBulkReadMemRequest,
+                                              ((UCHAR *)DebuggerBulkReadMemRequest) + SIZEOF_DEBUGGER_BULK_READ_MEMORY,
+                                              FALSE) == TRUE)
+            {
+                //
+                // Return the header and the pages (invalid pages are zeroed)
+                //
+                Irp->IoStatus.Information = SIZEOF_DEBUGGER_BULK_READ_MEMORY + DebuggerBulkReadMemRequest->Size;
+            }
+            else
+            {
+                //
+                // Just return the header to the user-mode
+                //
+                Irp->IoStatus.Information = SIZEOF_DEBUGGER_BULK_READ_MEMORY;
+            }
+
+            Status = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
         case IOCTL_DEBUGGER_READ_OR_WRITE_MSR:
 
             //
@@ -1254,6 +1313,205 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
             break;
 
+        case IOCTL_PERFORM_TSC_OFFSETTING_OPERATION:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            InBuffLength  = IrpStack->Parameters.DeviceIoControl.InputBufferLength;
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            if (!InBuffLength || !OutBuffLength)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the coming buffer are
+            // at the same place
+            //
+            TscOffsettingRequest = (PTSC_OFFSETTING_OPERATION_PACKETS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Perform the TSC offsetting operation (it's not from vmx-root)
+            //
+            ExtensionCommandPerformTscOffsettingOperation(TscOffsettingRequest, FALSE);
+
+            Irp->IoStatus.Information = SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
+        case IOCTL_PERFORM_PROFILER_OPERATION:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_PROFILER_OPERATION_PACKETS ||
+                IrpStack->Parameters.DeviceIoControl.OutputBufferLength < SIZEOF_PROFILER_OPERATION_PACKETS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            //
+            // Both usermode and to send to usermode and the coming buffer are
+            // at the same place, the samples are placed after the request
+            //
+            ProfilerRequest = (PPROFILER_OPERATION_PACKETS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Perform the profiler operation (it's not from vmx-root)
+            //
+            VmFuncProfilerPerformOperation(ProfilerRequest,
+                                           (PPROFILER_SAMPLE)((CHAR *)ProfilerRequest + SIZEOF_PROFILER_OPERATION_PACKETS),
+                                           (UINT32)((OutBuffLength - SIZEOF_PROFILER_OPERATION_PACKETS) / sizeof(PROFILER_SAMPLE)));
+
+            Irp->IoStatus.Information = SIZEOF_PROFILER_OPERATION_PACKETS + ProfilerRequest->NumberOfSamples * sizeof(PROFILER_SAMPLE);
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
+        case IOCTL_PERFORM_PROCESSOR_TRACE_OPERATION:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS ||
+                IrpStack->Parameters.DeviceIoControl.OutputBufferLength < SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            //
+            // Both usermode and to send to usermode and the coming buffer are
+            // at the same place, the bytes of the trace are placed after the request
+            //
+            ProcessorTraceRequest = (PPROCESSOR_TRACE_OPERATION_PACKETS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Perform the processor trace operation (it's not from vmx-root)
+            //
+            VmFuncProcessorTracePerformOperation(ProcessorTraceRequest,
+                                                 (UINT8 *)ProcessorTraceRequest + SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS,
+                                                 (UINT32)(OutBuffLength - SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS));
+
+            Irp->IoStatus.Information = SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS + ProcessorTraceRequest->NumberOfBytes;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
+        case IOCTL_PERFORM_LBR_OPERATION:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_LBR_OPERATION_PACKETS ||
+                IrpStack->Parameters.DeviceIoControl.OutputBufferLength < SIZEOF_LBR_OPERATION_PACKETS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the coming buffer are
+            // at the same place
+            //
+            LbrRequest = (PLBR_OPERATION_PACKETS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Perform the LBR operation (it's not from vmx-root)
+            //
+            VmFuncLbrPerformOperation(LbrRequest);
+
+            Irp->IoStatus.Information = SIZEOF_LBR_OPERATION_PACKETS;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
+        case IOCTL_PERFORM_EVENT_TRACE_OPERATION:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_EVENT_TRACE_OPERATION_PACKET ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            InBuffLength  = IrpStack->Parameters.DeviceIoControl.InputBufferLength;
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            if (!InBuffLength || !OutBuffLength)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the coming buffer are
+            // at the same place
+            //
+            EventTraceOperationRequest = (PDEBUGGER_EVENT_TRACE_OPERATION_PACKET)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Reset or flush the per-core blocks of the event trace
+            //
+            DebuggerEventTracePerformOperation(EventTraceOperationRequest);
+
+            Irp->IoStatus.Information = SIZEOF_DEBUGGER_EVENT_TRACE_OPERATION_PACKET;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
         case IOCTL_SEND_USER_DEBUGGER_COMMANDS:
 
             //
@@ -86,3 +86,9 @@ HaltedBroadcastDisableMov2DrExitingForClearingDrEventsAllCores();
 
 VOID
 HaltedBroadcastDisableMov2CrExitingForClearingCrEventsAllCores(DEBUGGER_EVENT_OPTIONS * BroadcastingOption);
+
+VOID
+HaltedBroadcastEnableTscOffsettingAllCores(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest);
+
+VOID
+HaltedBroadcastDisableTscOffsettingAllCores();
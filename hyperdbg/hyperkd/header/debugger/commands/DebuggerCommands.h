@@ -27,6 +27,9 @@ DebuggerCommandReadMemory(PDEBUGGER_READ_MEMORY ReadMemRequest, PVOID UserBuffer
 BOOLEAN
 DebuggerCommandReadMemoryVmxRoot(PDEBUGGER_READ_MEMORY ReadMemRequest, UCHAR * UserBuffer, UINT32 * ReturnSize);
 
+BOOLEAN
+DebuggerCommandBulkReadMemory(PDEBUGGER_BULK_READ_MEMORY BulkReadRequest, UCHAR * UserBuffer, BOOLEAN ApplyFromVmxRoot);
+
 BOOLEAN
 DebuggerCommandEditMemoryVmxRoot(PDEBUGGER_EDIT_MEMORY EditMemRequest);
 
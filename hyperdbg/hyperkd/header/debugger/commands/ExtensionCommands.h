@@ -90,8 +90,22 @@ ExtensionCommandEnableMovControlRegisterExitingAllCores(PDEBUGGER_EVENT Event);
 VOID
 ExtensionCommandDisableMov2ControlRegsExitingForClearingEventsAllCores(PDEBUGGER_EVENT Event);
 
+UINT32
+ExtensionCommandPcitreeReadConfig(UINT8 Bus, UINT8 Device, UINT8 Function, UINT8 Offset, PVOID Context);
+
+BOOLEAN
+ExtensionCommandPcitreeAddFunction(UINT8  Bus,
+                                   UINT8  Device,
+                                   UINT8  Function,
+                                   UINT32 DeviceIdVendorId,
+                                   UINT32 ClassCodeRevision,
+                                   PVOID  Context);
+
 VOID
 ExtensionCommandPcitree(PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET PcitreePacket, BOOLEAN OperateOnVmxRoot);
 
 VOID
 ExtensionCommandPcidevinfo(PDEBUGGEE_PCIDEVINFO_REQUEST_RESPONSE_PACKET PcidevinfoPacket, BOOLEAN OperateOnVmxRoot);
+
+VOID
+ExtensionCommandPerformTscOffsettingOperation(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest, BOOLEAN ApplyFromVmxRootMode);
@@ -96,6 +96,8 @@ typedef struct _DEBUGGER_EVENT_ACTION
     UINT32 CustomCodeBufferSize;    // if null, means it's not custom code type
     PVOID  CustomCodeBufferAddress; // address of custom code if any
 
+    UINT32 LbrSnapshotCount; // if it's an LBR snapshot, count of the branches
+
 } DEBUGGER_EVENT_ACTION, *PDEBUGGER_EVENT_ACTION;
 
 /* ==============================================================================================
@@ -124,6 +126,15 @@ typedef struct _DEBUGGER_EVENT
     BOOLEAN EnableShortCircuiting; // indicates whether the short-circuiting event
                                    // is enabled or not for this event
 
+    BOOLEAN RecordEventTrace;                                     // indicates whether the triggers are recorded in the event trace
+    UINT8   EventTraceRegisterIds[EVENT_TRACE_NUMBER_OF_REGISTERS]; // registers (GUEST_REGS indexes) of the trace records
+
+    BOOLEAN        HasSamplingPolicy; // indicates whether only some of the triggers run the actions
+    EVENT_SAMPLING Sampling;          // the sampling policy and its shared state
+
+    BOOLEAN       HasScriptFilter; // indicates whether the script action is checked by a filter before running it
+    SCRIPT_FILTER ScriptFilter;    // the condition of the script action (if it's the only action of the event)
+
     VMM_CALLBACK_EVENT_CALLING_STAGE_TYPE EventMode; // reveals the execution mode
                                                      // of the event (whether it's a pre- or post- event)
 
@@ -212,6 +223,7 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
                          BOOLEAN                                         SendTheResultsImmediately,
                          PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE             InTheCaseOfCustomCode,
                          PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript,
+                         UINT32                                          LbrSnapshotCount,
                          PDEBUGGER_EVENT_AND_ACTION_RESULT               ResultsToReturn,
                          BOOLEAN                                         InputFromVmxRoot);
 
@@ -186,6 +186,18 @@
  */
 #define DEBUGGER_HALTED_CORE_TASK_DISABLE_MOV_TO_CR_EXITING_ONLY_FOR_CR_EVENTS 0x0000001c
 
+/**
+ * @brief Halted core task for enabling TSC offsetting
+ *
+ */
+#define DEBUGGER_HALTED_CORE_TASK_SET_TSC_OFFSETTING 0x0000001d
+
+/**
+ * @brief Halted core task for disabling TSC offsetting
+ *
+ */
+#define DEBUGGER_HALTED_CORE_TASK_UNSET_TSC_OFFSETTING 0x0000001e
+
 //////////////////////////////////////////////////
 //			    	 Functions  	      		//
 //////////////////////////////////////////////////
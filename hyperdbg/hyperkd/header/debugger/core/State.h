@@ -33,7 +33,10 @@ typedef struct _PROCESSOR_DEBUGGING_MSR_READ_OR_WRITE
  */
 typedef struct _DEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE
 {
-    UINT16 CsSel; // the cs value to trace the execution modes
+    UINT16             CsSel;          // the cs value to trace the execution modes
+    BOOLEAN            CountedTrace;   // the steps are recorded into the trace buffer without pausing
+    UINT32             RemainingSteps; // remaining steps of the counted trace
+    PSTEP_TRACE_BUFFER TraceBuffer;    // delta-compressed steps of the counted trace
 
 } DEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE, *PDEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE;
 
@@ -172,6 +175,7 @@ typedef struct _PROCESSOR_DEBUGGING_STATE
     BOOLEAN                                    Test; // Used for testing purposes
     BOOLEAN                                    DoNotNmiNotifyOtherCoresByThisCore;
     BOOLEAN                                    TracingMode; // Indicate that the target processor is on the tracing mode or not
+    BOOLEAN                                    IsTriggeringServiceTableSyscallEvents; // The !syscall3 events are triggered by their hidden hooks
     PROCESSOR_DEBUGGING_MSR_READ_OR_WRITE      MsrState;
     DATE_TIME_HOLDER                           DateTimeHolder;
     PDEBUGGEE_BP_DESCRIPTOR                    SoftwareBreakpointState;
@@ -182,7 +186,11 @@ typedef struct _PROCESSOR_DEBUGGING_STATE
     UINT16                                     InstructionLengthHint;
     UINT64                                     HardwareDebugRegisterForStepping;
     UINT64 *                                   ScriptEngineCoreSpecificStackBuffer;
-    PKDPC                                      KdDpcObject;                       // DPC object to be used in kernel debugger
-    CHAR                                       KdRecvBuffer[MaxSerialPacketSize]; // Used for debugging buffers (receiving buffers from serial devices)
+    PEVENT_TRACE_BLOCK                         EventTraceBlock;                                    // Block of the binary event trace records of this core
+    volatile LONG                              EventTraceLock;                                     // Lock of the block of the binary event trace
+    volatile LONG                              EventTraceDroppedRecords;                           // Records that are dropped since the last sent block
+    EVENT_SAMPLING_CORE_STATE                  EventSamplingStates[EVENT_SAMPLING_MAXIMUM_EVENTS]; // Sampling states of the events on this core
+    PKDPC                                      KdDpcObject;                                        // DPC object to be used in kernel debugger
+    CHAR                                       KdRecvBuffer[MaxSerialPacketSize];                  // Used for debugging buffers (receiving buffers from serial devices)
 
 } PROCESSOR_DEBUGGING_STATE, PPROCESSOR_DEBUGGING_STATE;
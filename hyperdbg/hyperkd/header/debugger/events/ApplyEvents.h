@@ -81,7 +81,12 @@ ApplyEventInterruptEvent(PDEBUGGER_EVENT                   Event,
                          PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
                          BOOLEAN                           InputFromVmxRoot);
 
-VOID
+BOOLEAN
+ApplyEventServiceTableSyscallHookEvent(PDEBUGGER_EVENT                   Event,
+                                       PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
+                                       BOOLEAN                           InputFromVmxRoot);
+
+BOOLEAN
 ApplyEventEferSyscallHookEvent(PDEBUGGER_EVENT                   Event,
                                PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
                                BOOLEAN                           InputFromVmxRoot);
@@ -0,0 +1,25 @@
+/**
+ * @file DebuggerEventSampling.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the sampling policies of the events
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+DebuggerEventSamplingAllocateSlot(UINT32 * Slot);
+
+VOID
+DebuggerEventSamplingReleaseSlot(UINT32 Slot);
+
+BOOLEAN
+DebuggerEventSamplingCheck(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGER_EVENT Event);
@@ -0,0 +1,30 @@
+/**
+ * @file DebuggerEventTrace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of recording events into the binary event trace
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+DebuggerEventTraceInitialize();
+
+VOID
+DebuggerEventTraceUninitialize();
+
+VOID
+DebuggerEventTraceRecord(PROCESSOR_DEBUGGING_STATE *        DbgState,
+                         PDEBUGGER_EVENT                    Event,
+                         DEBUGGER_TRIGGERED_EVENT_DETAILS * EventTriggerDetail);
+
+VOID
+DebuggerEventTracePerformOperation(PDEBUGGER_EVENT_TRACE_OPERATION_PACKET OperationRequest);
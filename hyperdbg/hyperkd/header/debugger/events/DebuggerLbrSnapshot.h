@@ -0,0 +1,19 @@
+/**
+ * @file DebuggerLbrSnapshot.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the snapshots of the Last Branch Records
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+DebuggerLbrSnapshotPerform(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT32 Count);
@@ -0,0 +1,34 @@
+/**
+ * @file SyscallServiceTable.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the selective system-call events (!syscall3)
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+SyscallServiceTableReadMemory(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context);
+
+BOOLEAN
+SyscallServiceTableResolveTarget(UINT32 ServiceNumber, UINT64 * Target);
+
+BOOLEAN
+SyscallServiceTableIsTargetHooked(UINT64 Target, UINT64 ExcludedTag);
+
+BOOLEAN
+SyscallServiceTableIsTargetHookedByEptHook(UINT64 Target, UINT64 ExcludedTag);
+
+VMM_CALLBACK_TRIGGERING_EVENT_STATUS_TYPE
+SyscallServiceTableTriggerEvents(PROCESSOR_DEBUGGING_STATE *           DbgState,
+                                 VMM_CALLBACK_EVENT_CALLING_STAGE_TYPE CallingStage,
+                                 PVOID                                 Context,
+                                 BOOLEAN *                             PostEventRequired);
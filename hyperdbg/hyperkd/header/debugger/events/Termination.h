@@ -43,6 +43,9 @@ TerminateInInstructionExecutionEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmx
 VOID
 TerminateOutInstructionExecutionEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot);
 
+VOID
+TerminateServiceTableSyscallHookEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot);
+
 VOID
 TerminateSyscallHookEferEvent(PDEBUGGER_EVENT Event, BOOLEAN InputFromVmxRoot);
 
@@ -40,3 +40,8 @@ BOOLEAN
 ValidateEventEptHookHiddenBreakpointAndInlineHooks(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
                                                    PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
                                                    BOOLEAN                           InputFromVmxRoot);
+
+BOOLEAN
+ValidateEventSyscall(PDEBUGGER_GENERAL_EVENT_DETAIL    EventDetails,
+                     PDEBUGGER_EVENT_AND_ACTION_RESULT ResultsToReturn,
+                     BOOLEAN                           InputFromVmxRoot);
@@ -27,6 +27,19 @@ volatile LONG DebuggerResponseLock;
  */
 volatile LONG DebuggerHandleBreakpointLock;
 
+//////////////////////////////////////////////////
+//				      Constants    			    //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the buffer of the pause packet along with the
+ * prefetched state of the halted core
+ *
+ */
+#define KD_PAUSED_PACKET_BUFFER_SIZE                                           \
+    (sizeof(DEBUGGEE_KD_PAUSED_PACKET) + sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) + \
+     DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_STACK_WINDOW + DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_CODE_WINDOW)
+
 //////////////////////////////////////////////////
 //				      Structures    			//
 //////////////////////////////////////////////////
@@ -235,3 +248,12 @@ KdCheckTheHaltedCore(PROCESSOR_DEBUGGING_STATE * DbgState);
 BOOLEAN
 KdQueryDebuggerQueryThreadOrProcessTracingDetailsByCoreId(UINT32                          CoreId,
                                                           DEBUGGER_THREAD_PROCESS_TRACING TracingType);
+
+BOOLEAN
+KdSetPausePrefetchOptions(PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET PausePrefetchOptions);
+
+UINT32
+KdReadPausePrefetchWindow(UINT64 Address, UINT32 Size, BYTE * Buffer, DEBUGGER_READ_MEMORY_ADDRESS_MODE * AddressMode);
+
+UINT32
+KdFillPausePrefetch(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGEE_KD_PAUSED_PREFETCH Prefetch);
@@ -0,0 +1,34 @@
+/**
+ * @file KdStepTrace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the counted instrumentation step-in trace
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+KdStepTraceInitialize();
+
+VOID
+KdStepTraceUninitialize();
+
+BOOLEAN
+KdStepTraceStart(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGEE_STEP_PACKET StepPacket);
+
+BOOLEAN
+KdStepTraceRecordStep(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 Rip);
+
+VOID
+KdStepTraceStop(PROCESSOR_DEBUGGING_STATE * DbgState, STEP_TRACE_STOP_REASON StopReason);
+
+VOID
+KdStepTraceReadChunk(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGEE_STEP_TRACE_READ_PACKET ReadPacket);
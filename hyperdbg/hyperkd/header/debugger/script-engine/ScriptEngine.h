@@ -26,3 +26,9 @@ ScriptEngineGetTargetCoreTime();
 
 UINT64
 ScriptEngineGetTargetCoreDate();
+
+VOID
+ScriptEngineUpdateEventFilter(PDEBUGGER_EVENT Event, PDEBUGGER_EVENT_ACTION Action);
+
+BOOLEAN
+ScriptEngineCheckEventFilter(PROCESSOR_DEBUGGING_STATE * DbgState, PDEBUGGER_EVENT Event);
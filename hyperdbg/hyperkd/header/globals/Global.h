@@ -195,6 +195,46 @@ BOOLEAN g_IsWaitingForUserModeProcessEntryToBeCalled;
  */
 BOOLEAN g_InterceptBreakpointsAndEventsForCommandsInRemoteComputer;
 
+/**
+ * @brief Number of the blocks of the binary event trace that are
+ * sent to the user-mode
+ *
+ */
+volatile LONG64 g_EventTraceNumberOfSentBlocks;
+
+/**
+ * @brief Number of the records of the binary event trace that are
+ * dropped
+ *
+ */
+volatile LONG64 g_EventTraceNumberOfDroppedRecords;
+
+/**
+ * @brief Bitmap of the slots of the sampling states that are used by
+ * the events
+ *
+ */
+volatile LONG g_EventSamplingSlots;
+
+/**
+ * @brief The state of the halted core that is prefetched in the
+ * pause packets of the kernel debugger
+ *
+ */
+DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET g_KdPausePrefetchOptions;
+
+/**
+ * @brief Buffer of the pause packet along with its prefetched state
+ *
+ */
+PVOID g_KdPausedPacketBuffer;
+
+/**
+ * @brief The service table of the kernel (used in the !syscall3 events)
+ *
+ */
+SYSCALL_TABLE g_SyscallServiceTable;
+
 /**
  * @brief Global test flag (for testing purposes)
  *
@@ -63,12 +63,27 @@
 #include "SDK/imports/kernel/HyperDbgHyperLogImports.h"
 #include "SDK/imports/kernel/HyperDbgHyperLogIntrinsics.h"
 
+//
+// Records of the last branches (used in the VMM imports)
+//
+#include "components/lbr-decode/header/LbrDecode.h"
+
 //
 // Import VMM Module
 //
 #include "SDK/modules/VMM.h"
 #include "SDK/imports/kernel/HyperDbgVmmImports.h"
 
+//
+// Sampling policies of the events (used in the debugging state of the cores)
+//
+#include "components/event-sampling/header/EventSampling.h"
+
+//
+// Fast-path filters of the scripts (used in the events)
+//
+#include "components/script-filter/header/ScriptFilter.h"
+
 //
 // Local Debugger headers
 //
@@ -93,6 +108,31 @@
 #include "components/optimizations/header/BinarySearch.h"
 #include "components/optimizations/header/InsertionSort.h"
 
+//
+// Event trace component
+//
+#include "components/event-trace/header/EventTraceRecorder.h"
+
+//
+// Step trace component
+//
+#include "components/step-trace/header/StepTraceEncoder.h"
+
+//
+// Bulk read component
+//
+#include "components/bulk-read/header/BulkRead.h"
+
+//
+// PCI walk component
+//
+#include "components/pci-walk/header/PciWalk.h"
+
+//
+// Syscall table component
+//
+#include "components/syscall-table/header/SyscallTable.h"
+
 //
 // Debugger Types
 //
@@ -113,6 +153,7 @@
 #include "header/common/Synchronization.h"
 #include "header/debugger/memory/Allocations.h"
 #include "header/debugger/kernel-level/Kd.h"
+#include "header/debugger/kernel-level/KdStepTrace.h"
 #include "header/debugger/user-level/Ud.h"
 #include "header/debugger/commands/BreakpointCommands.h"
 #include "header/debugger/commands/DebuggerCommands.h"
@@ -146,6 +187,10 @@
 #include "header/debugger/events/Termination.h"
 #include "header/debugger/events/DebuggerEvents.h"
 #include "header/debugger/events/ValidateEvents.h"
+#include "header/debugger/events/DebuggerEventTrace.h"
+#include "header/debugger/events/DebuggerEventSampling.h"
+#include "header/debugger/events/DebuggerLbrSnapshot.h"
+#include "header/debugger/events/SyscallServiceTable.h"
 #include "header/debugger/meta-events/Tracing.h"
 #include "header/debugger/meta-events/MetaDispatch.h"
 
@@ -6,6 +6,8 @@
 #include "SDK/headers/Connection.h"
 #include "SDK/headers/DataTypes.h"
 #include "SDK/headers/Ioctls.h"
+#include "SDK/headers/EventTrace.h"
+#include "SDK/headers/StepTrace.h"
 #include "SDK/headers/Events.h"
 #include "SDK/headers/RequestStructures.h"
 #include "SDK/headers/Symbols.h"
@@ -29,3 +29,27 @@ static_assert(sizeof(DEBUGGEE_UD_PAUSED_PACKET) < PacketChunkSize,
  */
 static_assert(sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE) < PacketChunkSize,
               "err (static_assert), size of PacketChunkSize should be bigger than DEBUGGER_UPDATE_SYMBOL_TABLE (MODULE_SYMBOL_DETAIL)");
+
+/**
+ * @brief check so at least one symbol synchronization entry (with maximum
+ * length) fits in each batch
+ *
+ */
+static_assert(sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH) + sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY) +
+                      MAXIMUM_GUID_AND_AGE_SIZE + (MAX_PATH * 2) <=
+                  SYMBOL_SYNC_MAXIMUM_BATCH_SIZE,
+              "err (static_assert), size of SYMBOL_SYNC_MAXIMUM_BATCH_SIZE should be bigger than a single symbol synchronization entry");
+
+/**
+ * @brief check so the records of the event trace keep their fixed layout
+ *
+ */
+static_assert(sizeof(EVENT_TRACE_RECORD) == 64 && sizeof(EVENT_TRACE_BLOCK_HEADER) == 40 && sizeof(EVENT_TRACE_FILE_HEADER) == 64,
+              "err (static_assert), layout of the event trace records or headers is changed");
+
+/**
+ * @brief check so each block of the event trace fits into a single packet chunk
+ *
+ */
+static_assert(sizeof(EVENT_TRACE_BLOCK) < PacketChunkSize,
+              "err (static_assert), size of PacketChunkSize should be bigger than EVENT_TRACE_BLOCK");
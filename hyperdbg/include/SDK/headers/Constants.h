@@ -380,6 +380,7 @@ const unsigned char BuildSignature[] = {
 #define OPERATION_HYPERVISOR_DRIVER_END_OF_IRPS                    14U | OPERATION_MANDATORY_DEBUGGEE_BIT
 #define OPERATION_COMMAND_FROM_DEBUGGER_RELOAD_SYMBOL              15U | OPERATION_MANDATORY_DEBUGGEE_BIT
 #define OPERATION_NOTIFICATION_FROM_USER_DEBUGGER_PAUSE            16U | OPERATION_MANDATORY_DEBUGGEE_BIT
+#define OPERATION_LOG_EVENT_TRACE_BLOCK                            17U | OPERATION_MANDATORY_DEBUGGEE_BIT
 
 //////////////////////////////////////////////////
 //       Breakpoints & Debug Breakpoints        //
@@ -484,6 +485,39 @@ const unsigned char BuildSignature[] = {
  */
 #define MAXIMUM_GUID_AND_AGE_SIZE 60
 
+/**
+ * @brief maximum length of the name of types and fields
+ * of structures (used in the type-layout database)
+ */
+#define MAXIMUM_TYPE_NAME_LENGTH 256
+
+/**
+ * @brief maximum size of each symbol table synchronization
+ * batch (header and the appended entries)
+ */
+#define SYMBOL_SYNC_MAXIMUM_BATCH_SIZE PacketChunkSize
+
+/**
+ * @brief digest of the symbol table when the debugger does not
+ * have a synchronized table (forces a full synchronization)
+ */
+#define SYMBOL_SYNC_DIGEST_UNKNOWN 0
+
+/**
+ * @brief actions of the symbol table synchronization entries
+ */
+#define SYMBOL_SYNC_ENTRY_ACTION_ADD_MODULE    1
+#define SYMBOL_SYNC_ENTRY_ACTION_REMOVE_MODULE 2
+
+/**
+ * @brief flags of the symbol table synchronization entries
+ */
+#define SYMBOL_SYNC_ENTRY_FLAG_SYMBOL_DETAILS_FOUND 0x1
+#define SYMBOL_SYNC_ENTRY_FLAG_LOCAL_SYMBOL_PATH    0x2
+#define SYMBOL_SYNC_ENTRY_FLAG_PDB_AVAILABLE        0x4
+#define SYMBOL_SYNC_ENTRY_FLAG_USER_MODE            0x8
+#define SYMBOL_SYNC_ENTRY_FLAG_32_BIT               0x10
+
 //////////////////////////////////////////////////
 //            Debuggee Communication            //
 //////////////////////////////////////////////////
@@ -44,6 +44,8 @@ typedef enum _POOL_ALLOCATION_INTENTION
     DETOUR_HOOK_DETAILS,
     BREAKPOINT_DEFINITION_STRUCTURE,
     PROCESS_THREAD_HOLDER,
+    SUB_PAGE_PERMISSION_TABLE,
+    EPT_PRIVATE_PAGE_TABLE,
 
     //
     // Instant event buffers
@@ -215,6 +217,7 @@ typedef struct _DEBUGGEE_KD_PAUSED_PACKET
     UINT64                                Rflags;
     BYTE                                  InstructionBytesOnRip[MAXIMUM_INSTR_SIZE];
     UINT16                                ReadInstructionLen;
+    UINT32                                PrefetchSize; // size of the prefetched state (DEBUGGEE_KD_PAUSED_PREFETCH) after the packet, zero if it's not prefetched
 
 } DEBUGGEE_KD_PAUSED_PACKET, *PDEBUGGEE_KD_PAUSED_PACKET;
 
@@ -581,6 +581,128 @@
  */
 #define DEBUGGER_ERROR_UNABLE_TO_APPLY_COMMAND_TO_THE_TARGET_THREAD 0xc0000059
 
+/**
+ * @brief error, invalid operation on the buffers of the event trace
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_EVENT_TRACE_OPERATION 0xc000005a
+
+/**
+ * @brief error, invalid register for the records of the event trace
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_EVENT_TRACE_REGISTER 0xc000005b
+
+/**
+ * @brief error, the requested chunk of the step trace is not valid
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_STEP_TRACE_CHUNK 0xc000005c
+
+/**
+ * @brief error, the windows of the pause-time prefetch are too large
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_PAUSE_PREFETCH_OPTIONS 0xc000005d
+
+/**
+ * @brief error, invalid parameters for TSC offsetting
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_TSC_OFFSETTING_PARAMETERS 0xc000005e
+
+/**
+ * @brief error, the system-call is not found in the service table
+ *
+ */
+#define DEBUGGER_ERROR_UNABLE_TO_RESOLVE_SYSCALL_FROM_SERVICE_TABLE 0xc000005f
+
+/**
+ * @brief error, hooking the service table needs a single system-call
+ * number and only supports the pre-event calling stage
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_SERVICE_TABLE_SYSCALL_HOOK 0xc0000060
+
+/**
+ * @brief error, invalid sampling policy for the event
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_EVENT_SAMPLING_POLICY 0xc0000061
+
+/**
+ * @brief error, the maximum number of the events with sampling policies
+ * is reached
+ *
+ */
+#define DEBUGGER_ERROR_MAXIMUM_SAMPLED_EVENTS_REACHED 0xc0000062
+
+/**
+ * @brief error, invalid parameters for the sampling profiler
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS 0xc0000063
+
+/**
+ * @brief error, the processor doesn't support the VMX-preemption timer
+ * (or saving its value on vm-exits)
+ *
+ */
+#define DEBUGGER_ERROR_PROFILER_IS_NOT_SUPPORTED 0xc0000064
+
+/**
+ * @brief error, unable to allocate the histograms of the sampling profiler
+ *
+ */
+#define DEBUGGER_ERROR_UNABLE_TO_ALLOCATE_PROFILER_HISTOGRAMS 0xc0000065
+
+/**
+ * @brief error, invalid parameters for Intel Processor Trace
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS 0xc0000066
+
+/**
+ * @brief error, the processor doesn't support Intel Processor Trace in
+ * VMX operation (or one of the requested filters)
+ *
+ */
+#define DEBUGGER_ERROR_PROCESSOR_TRACE_IS_NOT_SUPPORTED 0xc0000067
+
+/**
+ * @brief error, unable to allocate the output buffers of Intel Processor
+ * Trace
+ *
+ */
+#define DEBUGGER_ERROR_UNABLE_TO_ALLOCATE_PROCESSOR_TRACE_BUFFERS 0xc0000068
+
+/**
+ * @brief error, the buffer of Intel Processor Trace can't be read while
+ * the core is traced
+ *
+ */
+#define DEBUGGER_ERROR_PROCESSOR_TRACE_IS_RUNNING 0xc0000069
+
+/**
+ * @brief error, invalid parameters for the Last Branch Records
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_LBR_PARAMETERS 0xc000006a
+
+/**
+ * @brief error, the processor doesn't support the (legacy) Last Branch
+ * Records, or its model is not known
+ *
+ */
+#define DEBUGGER_ERROR_LBR_IS_NOT_SUPPORTED 0xc000006b
+
+/**
+ * @brief error, the address is already hooked by a hidden breakpoint of
+ * another type of event (!epthook and !syscall3 events)
+ *
+ */
+#define DEBUGGER_ERROR_ADDRESS_IS_HOOKED_BY_ANOTHER_EVENT_TYPE 0xc000006c
+
 //
 // WHEN YOU ADD ANYTHING TO THIS LIST OF ERRORS, THEN
 // MAKE SURE TO ADD AN ERROR MESSAGE TO ShowErrorMessage(UINT32 Error)
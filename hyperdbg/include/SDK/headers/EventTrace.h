@@ -0,0 +1,166 @@
+/**
+ * @file EventTrace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief HyperDbg's SDK Header Files For Binary Event Traces
+ * @details This file contains the layout of the records, blocks, and
+ * files of the binary event trace
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//              Event Trace Constants           //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Magic of the event trace files ('HDTR')
+ *
+ */
+#define EVENT_TRACE_FILE_MAGIC 0x52544448
+
+/**
+ * @brief Magic of each block of records ('HDTB')
+ *
+ */
+#define EVENT_TRACE_BLOCK_MAGIC 0x42544448
+
+/**
+ * @brief Version of the event trace file format
+ *
+ */
+#define EVENT_TRACE_FILE_VERSION 1
+
+/**
+ * @brief Number of registers that are saved in each record
+ *
+ */
+#define EVENT_TRACE_NUMBER_OF_REGISTERS 3
+
+/**
+ * @brief Number of general-purpose registers that can be
+ * saved in the records (indexes of GUEST_REGS)
+ *
+ */
+#define EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS 16
+
+//////////////////////////////////////////////////
+//              Event Trace Structures          //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Fixed-layout record of a triggered event
+ * @details Registers are saved based on the index of them
+ * in the GUEST_REGS structure
+ *
+ */
+typedef struct _EVENT_TRACE_RECORD
+{
+    UINT64 Tag;
+    UINT64 Tsc;
+    UINT64 Rip;
+    UINT64 Context;
+    UINT64 Registers[EVENT_TRACE_NUMBER_OF_REGISTERS];
+    UINT16 Core;
+    UINT16 EventType;
+    UINT8  RegisterIds[EVENT_TRACE_NUMBER_OF_REGISTERS];
+    UINT8  Stage;
+
+} EVENT_TRACE_RECORD, *PEVENT_TRACE_RECORD;
+
+/**
+ * @brief Header (summary) of a block of records of a single core
+ * @details The tag filter is a 64-bit bloom filter of the tags
+ * of the records in the block
+ *
+ */
+typedef struct _EVENT_TRACE_BLOCK_HEADER
+{
+    UINT32 Magic;
+    UINT16 Core;
+    UINT16 NumberOfRecords;
+    UINT32 NumberOfDroppedRecords; // records of this core that are dropped before this block
+    UINT32 Reserved;
+    UINT64 MinimumTsc;
+    UINT64 MaximumTsc;
+    UINT64 TagFilter;
+
+} EVENT_TRACE_BLOCK_HEADER, *PEVENT_TRACE_BLOCK_HEADER;
+
+/**
+ * @brief Maximum number of records in each block
+ * @details Each block is sent as a single message of the
+ * logging buffers, so it should fit into a packet chunk
+ *
+ */
+#define EVENT_TRACE_MAXIMUM_RECORDS_PER_BLOCK \
+    ((PacketChunkSize - 1 - sizeof(EVENT_TRACE_BLOCK_HEADER)) / sizeof(EVENT_TRACE_RECORD))
+
+/**
+ * @brief Block of records of a single core
+ *
+ */
+typedef struct _EVENT_TRACE_BLOCK
+{
+    EVENT_TRACE_BLOCK_HEADER Header;
+    EVENT_TRACE_RECORD       Records[EVENT_TRACE_MAXIMUM_RECORDS_PER_BLOCK];
+
+} EVENT_TRACE_BLOCK, *PEVENT_TRACE_BLOCK;
+
+/**
+ * @brief Header of the event trace files
+ * @details The header is followed by DataSize bytes of blocks, each
+ * block is a block header followed by its records
+ *
+ */
+typedef struct _EVENT_TRACE_FILE_HEADER
+{
+    UINT32 Magic;
+    UINT16 Version;
+    UINT16 RecordSize;
+    UINT16 BlockHeaderSize;
+    UINT16 NumberOfCores;
+    UINT32 Reserved;
+    UINT64 NumberOfBlocks;
+    UINT64 NumberOfRecords;
+    UINT64 NumberOfDroppedRecords;
+    UINT64 MinimumTsc;
+    UINT64 MaximumTsc;
+    UINT64 DataSize;
+
+} EVENT_TRACE_FILE_HEADER, *PEVENT_TRACE_FILE_HEADER;
+
+//////////////////////////////////////////////////
+//              Event Trace Operations          //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Operations on the per-core buffers of the event trace
+ *
+ */
+typedef enum _DEBUGGER_EVENT_TRACE_OPERATION_TYPE
+{
+    DEBUGGER_EVENT_TRACE_OPERATION_RESET_BUFFERS,
+    DEBUGGER_EVENT_TRACE_OPERATION_FLUSH_BUFFERS,
+
+} DEBUGGER_EVENT_TRACE_OPERATION_TYPE;
+
+#define SIZEOF_DEBUGGER_EVENT_TRACE_OPERATION_PACKET \
+    sizeof(DEBUGGER_EVENT_TRACE_OPERATION_PACKET)
+
+/**
+ * @brief Request for resetting or flushing the per-core buffers
+ * of the event trace
+ *
+ */
+typedef struct _DEBUGGER_EVENT_TRACE_OPERATION_PACKET
+{
+    DEBUGGER_EVENT_TRACE_OPERATION_TYPE Operation;
+    UINT32                              KernelStatus;
+    UINT64                              NumberOfSentBlocks;     // blocks that are sent since the driver is loaded
+    UINT64                              NumberOfDroppedRecords; // records that are dropped since the driver is loaded
+
+} DEBUGGER_EVENT_TRACE_OPERATION_PACKET, *PDEBUGGER_EVENT_TRACE_OPERATION_PACKET;
@@ -184,7 +184,8 @@ typedef enum _DEBUGGER_EVENT_ACTION_TYPE_ENUM
 {
     BREAK_TO_DEBUGGER,
     RUN_SCRIPT,
-    RUN_CUSTOM_CODE
+    RUN_CUSTOM_CODE,
+    LBR_SNAPSHOT
 
 } DEBUGGER_EVENT_ACTION_TYPE_ENUM;
 
@@ -196,6 +197,7 @@ typedef enum _DEBUGGER_EVENT_SYSCALL_SYSRET_TYPE
 {
     DEBUGGER_EVENT_SYSCALL_SYSRET_SAFE_ACCESS_MEMORY = 0,
     DEBUGGER_EVENT_SYSCALL_SYSRET_HANDLE_ALL_UD      = 1,
+    DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK        = 2, // Only for a single system-call (hidden hook on its target)
 
 } DEBUGGER_EVENT_SYSCALL_SYSRET_TYPE;
 
@@ -227,6 +229,34 @@ typedef enum _DEBUGGER_EVENT_TRACE_TYPE
 
 } DEBUGGER_EVENT_TRACE_TYPE;
 
+/**
+ * @brief Type of the sampling policy of the events
+ *
+ */
+typedef enum _DEBUGGER_EVENT_SAMPLING_TYPE
+{
+    DEBUGGER_EVENT_SAMPLING_TYPE_NONE          = 0,
+    DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH     = 1, // Parameter1 : N
+    DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC = 2, // Parameter1 : probability (in 1/2^32)
+    DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET  = 3, // Parameter1 : cycles (TSC) per token, Parameter2 : burst
+    DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N       = 4, // Parameter1 : N
+
+} DEBUGGER_EVENT_SAMPLING_TYPE;
+
+/**
+ * @brief The sampling policy of an event
+ * @details The policy is evaluated after the conditions of the event and
+ * before running any of its actions
+ *
+ */
+typedef struct _DEBUGGER_EVENT_SAMPLING_POLICY
+{
+    DEBUGGER_EVENT_SAMPLING_TYPE Type;
+    UINT64                       Parameter1;
+    UINT64                       Parameter2;
+
+} DEBUGGER_EVENT_SAMPLING_POLICY, *PDEBUGGER_EVENT_SAMPLING_POLICY;
+
 /**
  * @brief different types of modifying events request (enable/disable/clear)
  *
@@ -388,6 +418,16 @@ typedef struct _DEBUGGER_GENERAL_EVENT_DETAIL
                                                                  // scripts to
                                                                  // remote sources
 
+    BOOLEAN RecordEventTrace; // Shows whether the triggers of this event are
+                              // recorded in the binary event trace or not
+
+    UINT8 EventTraceRegisterIds[EVENT_TRACE_NUMBER_OF_REGISTERS]; // Registers (GUEST_REGS
+                                                                  // indexes) that are saved
+                                                                  // in the trace records
+
+    DEBUGGER_EVENT_SAMPLING_POLICY SamplingPolicy; // Shows which triggers of this event
+                                                   // run the actions
+
     UINT32 CountOfActions;
 
     UINT64              Tag; // is same as operation code
@@ -418,6 +458,8 @@ typedef struct _DEBUGGER_GENERAL_ACTION
     UINT32 ScriptBufferSize;
     UINT32 ScriptBufferPointer;
 
+    UINT32 LbrSnapshotCount; // Count of the branches of LBR_SNAPSHOT
+
 } DEBUGGER_GENERAL_ACTION, *PDEBUGGER_GENERAL_ACTION;
 
 /**
@@ -53,6 +53,16 @@
  */
 #define HWDBG_TEST_WRITE_INSTANCE_INFO_PATH "..\\..\\..\\..\\hwdbg\\src\\test\\bram\\instance_info.hex.txt"
 
+/**
+ * @brief Width (in bits) of the type field of each symbol in the bit-packed
+ * script buffer
+ * @details It should be able to hold all of the symbol types (up to
+ * SYMBOL_RETURN_VALUE_TYPE)
+ * @warning This constant should be changed along with hwdbg files
+ *
+ */
+#define HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH 5
+
 //////////////////////////////////////////////////
 //                   Enums                      //
 //////////////////////////////////////////////////
@@ -168,6 +178,11 @@ typedef struct _HWDBG_INSTANCE_INFORMATION
         UINT64 func_mov : 1;
         UINT64 func_printf : 1;
 
+        //
+        // Script buffer encoding (not an operator)
+        //
+        UINT64 bit_packed_script_buffer : 1;
+
         //
         // ANY ADDITION TO THIS MASK SHOULD BE ADDED TO HwdbgInterpreterShowScriptCapabilities
         // and HwdbgInterpreterCheckScriptBufferWithScriptCapabilities as well Scala file
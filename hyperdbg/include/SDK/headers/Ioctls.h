@@ -330,3 +330,45 @@
  */
 #define IOCTL_PERFORM_SMI_OPERATION \
     CTL_CODE(FILE_DEVICE_UNKNOWN, 0x826, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to reset or flush the buffers of the event trace
+ *
+ */
+#define IOCTL_PERFORM_EVENT_TRACE_OPERATION \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x827, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to read many pages of memory at once
+ *
+ */
+#define IOCTL_DEBUGGER_BULK_READ_MEMORY \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x828, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to enable, disable, or query TSC offsetting
+ *
+ */
+#define IOCTL_PERFORM_TSC_OFFSETTING_OPERATION \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x829, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to start, stop, query, or read the sampling profiler
+ *
+ */
+#define IOCTL_PERFORM_PROFILER_OPERATION \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x82a, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to start, stop, query, or read Intel Processor Trace
+ *
+ */
+#define IOCTL_PERFORM_PROCESSOR_TRACE_OPERATION \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x82b, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to enable, disable, or query the Last Branch Records
+ *
+ */
+#define IOCTL_PERFORM_LBR_OPERATION \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x82c, METHOD_BUFFERED, FILE_ANY_ACCESS)
@@ -281,6 +281,98 @@ typedef struct _DEBUGGER_READ_MEMORY
 
 } DEBUGGER_READ_MEMORY, *PDEBUGGER_READ_MEMORY;
 
+/* ==============================================================================================
+ */
+
+#define SIZEOF_DEBUGGER_BULK_READ_MEMORY sizeof(DEBUGGER_BULK_READ_MEMORY)
+
+/**
+ * @brief maximum number of pages in a bulk read request
+ * (the bitmap of the valid pages is a single 64-bit field)
+ *
+ */
+#define DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES 64
+
+/**
+ * @brief maximum number of pages in a bulk read request of the Debugger
+ * Mode (the result should fit in a single serial packet)
+ *
+ */
+#define DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES_OVER_SERIAL 16
+
+/**
+ * @brief request for reading many pages of memory at once
+ * @details the range is split at page boundaries, each page which
+ * is not available is zeroed instead of failing the entire request
+ *
+ */
+typedef struct _DEBUGGER_BULK_READ_MEMORY
+{
+    UINT64                    Address;
+    UINT32                    Size;
+    UINT32                    Pid; // Read from cr3 of what process
+    DEBUGGER_READ_MEMORY_TYPE MemoryType;
+    UINT32                    NumberOfValidPages;
+    UINT64                    ValidPagesBitmap; // Bit 'n' is set if the 'n'th page of the range is read
+    UINT32                    KernelStatus;
+
+    //
+    // Here is the target buffer (actual memory)
+    //
+
+} DEBUGGER_BULK_READ_MEMORY, *PDEBUGGER_BULK_READ_MEMORY;
+
+/* ==============================================================================================
+ */
+
+#define SIZEOF_DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET sizeof(DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET)
+
+/**
+ * @brief maximum size of the stack window and the code window that are
+ * prefetched in the pause packet
+ *
+ */
+#define DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_STACK_WINDOW 0x1000
+#define DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_CODE_WINDOW  0x400
+
+/**
+ * @brief request for setting the state that is prefetched in the
+ * pause packet (all zero means that nothing is prefetched)
+ *
+ */
+typedef struct _DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET
+{
+    BOOLEAN PrefetchRegisters;
+    UINT32  StackWindowSize; // Bytes from the stack pointer
+    UINT32  CodeWindowSize;  // Bytes from the instruction pointer
+    UINT32  KernelStatus;
+
+} DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET, *PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET;
+
+/**
+ * @brief the state of the halted core that is prefetched after the
+ * pause packet (DEBUGGEE_KD_PAUSED_PACKET)
+ * @details the windows are read up to the first page that is not
+ * available, so they might be shorter than the requested windows
+ *
+ */
+typedef struct _DEBUGGEE_KD_PAUSED_PREFETCH
+{
+    BOOLEAN                           HasRegisters;
+    GUEST_REGS                        Regs;
+    GUEST_EXTRA_REGISTERS             ExtraRegs;
+    UINT64                            StackAddress;
+    UINT32                            StackSize;
+    UINT64                            CodeAddress;
+    UINT32                            CodeSize;
+    DEBUGGER_READ_MEMORY_ADDRESS_MODE CodeAddressMode;
+
+    //
+    // Here are the stack window and the code window (in this order)
+    //
+
+} DEBUGGEE_KD_PAUSED_PREFETCH, *PDEBUGGEE_KD_PAUSED_PREFETCH;
+
 /* ==============================================================================================
  */
 
@@ -1030,6 +1122,7 @@ typedef enum _DEBUGGER_REMOTE_STEPPING_REQUEST
     DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_IN,
     DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN,
     DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_FOR_TRACKING,
+    DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_COUNTED_TRACE,
 
     DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER,
     DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU,
@@ -1052,6 +1145,14 @@ typedef struct _DEBUGGEE_STEP_PACKET
     BOOLEAN IsCurrentInstructionACall;
     UINT32  CallLength;
 
+    //
+    // Only in the case of the counted step trace
+    // the 'i' command with the 'trace' keyword
+    //
+    UINT32 Count;
+    UINT8  NumberOfRegisters;
+    UINT8  RegisterIds[STEP_TRACE_NUMBER_OF_REGISTERS];
+
 } DEBUGGEE_STEP_PACKET, *PDEBUGGEE_STEP_PACKET;
 
 /**
@@ -1264,6 +1365,308 @@ typedef struct _SMI_OPERATION_PACKETS
 /* ==============================================================================================
  */
 
+/**
+ * @brief Perform actions related to TSC offsetting
+ *
+ */
+typedef enum _TSC_OFFSETTING_OPERATION_TYPE
+{
+    TSC_OFFSETTING_OPERATION_TYPE_QUERY,
+    TSC_OFFSETTING_OPERATION_TYPE_ENABLE,
+    TSC_OFFSETTING_OPERATION_TYPE_DISABLE,
+
+} TSC_OFFSETTING_OPERATION_TYPE;
+
+/**
+ * @brief Default options of TSC offsetting
+ * @details The transition overhead is not hidden by default, as an
+ * over-estimated overhead makes the TSC of the guest go backward
+ *
+ */
+#define TSC_OFFSETTING_DEFAULT_TRANSITION_OVERHEAD 0x0
+#define TSC_OFFSETTING_DEFAULT_MAXIMUM_DEFICIT     0x4000
+
+/**
+ * @brief The limit of the maximum deficit of TSC offsetting
+ * @details The deficit bounds the skew between the TSCs of the cores, so
+ * it's kept at a few microseconds (below the latency of migrating a thread
+ * to another core), otherwise a thread might see the TSC go backward once
+ * it's moved to a core with a larger deficit
+ *
+ */
+#define TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT 0x4000
+
+/**
+ * @brief The structure of TSC offsetting (hiding the time spent in
+ * vmx-root) requests and their statistics in HyperDbg
+ *
+ */
+typedef struct _TSC_OFFSETTING_OPERATION_PACKETS
+{
+    TSC_OFFSETTING_OPERATION_TYPE TscOffsettingOperationType;
+
+    //
+    // Options (used for enabling)
+    //
+    UINT64 TransitionOverhead;
+    UINT64 MaximumDeficit;
+    UINT64 SamplingPeriod;
+
+    //
+    // Statistics (the sum of all cores)
+    //
+    UINT32 NumberOfEnabledCores;
+    UINT64 NumberOfVmexits;
+    UINT64 NumberOfSampledRdtscExits;
+    UINT64 HiddenCycles;
+    UINT64 RepaidCycles;
+    UINT64 LeakedCycles;
+    UINT64 MaximumCurrentDeficit;
+
+    UINT32 KernelStatus;
+
+} TSC_OFFSETTING_OPERATION_PACKETS, *PTSC_OFFSETTING_OPERATION_PACKETS;
+
+/**
+ * @brief Debugger size of TSC_OFFSETTING_OPERATION_PACKETS
+ *
+ */
+#define SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS \
+    sizeof(TSC_OFFSETTING_OPERATION_PACKETS)
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief Perform actions related to the sampling profiler
+ *
+ */
+typedef enum _PROFILER_OPERATION_TYPE
+{
+    PROFILER_OPERATION_TYPE_QUERY,
+    PROFILER_OPERATION_TYPE_START,
+    PROFILER_OPERATION_TYPE_STOP,
+    PROFILER_OPERATION_TYPE_READ_SAMPLES,
+
+} PROFILER_OPERATION_TYPE;
+
+/**
+ * @brief Options of the sampling profiler
+ * @details The period is in TSC cycles, it's converted to the ticks of the
+ * VMX-preemption timer by the rate that IA32_VMX_MISC reports
+ *
+ */
+#define PROFILER_DEFAULT_PERIOD           0x200000
+#define PROFILER_MINIMUM_PERIOD           0x10000
+#define PROFILER_MAXIMUM_STACK_DEPTH      4
+#define PROFILER_HISTOGRAM_CAPACITY       0x1000
+#define PROFILER_MAXIMUM_SAMPLES_PER_READ 0x400
+
+/**
+ * @brief A distinct sample of the sampling profiler and its count
+ * @details The CR3 is the directory table base of the process (not the
+ * user-mode one of KVA shadowing)
+ *
+ */
+typedef struct _PROFILER_SAMPLE
+{
+    UINT64 Rip;
+    UINT64 Cr3;
+    UINT64 Stack[PROFILER_MAXIMUM_STACK_DEPTH]; // Candidate return addresses found on the top of the stack
+    UINT32 StackDepth;
+    UINT32 Count; // Zero means an empty entry of the histogram
+
+} PROFILER_SAMPLE, *PPROFILER_SAMPLE;
+
+/**
+ * @brief The structure of the sampling profiler requests and their
+ * statistics in HyperDbg
+ * @details The samples of the reading requests are placed after this
+ * structure
+ *
+ */
+typedef struct _PROFILER_OPERATION_PACKETS
+{
+    PROFILER_OPERATION_TYPE ProfilerOperationType;
+
+    //
+    // Options (used for starting)
+    //
+    UINT64 Period;
+    UINT64 CoreMask; // Zero means all cores
+    UINT32 StackDepth;
+
+    //
+    // Reading the samples of a core
+    //
+    UINT32 CoreId;
+    UINT32 FirstSample;     // Index of the histogram to start reading from
+    UINT32 NextSample;      // Index to continue reading from (the capacity of the histogram means finished)
+    UINT32 NumberOfSamples; // Count of the samples after this structure
+
+    //
+    // Statistics (the sum of all cores)
+    //
+    UINT32 NumberOfProfiledCores;
+    UINT32 NumberOfDistinctSamples;
+    UINT64 NumberOfTakenSamples;
+    UINT64 NumberOfDroppedSamples;
+
+    UINT32 KernelStatus;
+
+} PROFILER_OPERATION_PACKETS, *PPROFILER_OPERATION_PACKETS;
+
+/**
+ * @brief Debugger size of PROFILER_OPERATION_PACKETS
+ *
+ */
+#define SIZEOF_PROFILER_OPERATION_PACKETS \
+    sizeof(PROFILER_OPERATION_PACKETS)
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief Perform actions related to Intel Processor Trace
+ *
+ */
+typedef enum _PROCESSOR_TRACE_OPERATION_TYPE
+{
+    PROCESSOR_TRACE_OPERATION_TYPE_QUERY,
+    PROCESSOR_TRACE_OPERATION_TYPE_START,
+    PROCESSOR_TRACE_OPERATION_TYPE_STOP,
+    PROCESSOR_TRACE_OPERATION_TYPE_READ_BUFFER,
+
+} PROCESSOR_TRACE_OPERATION_TYPE;
+
+/**
+ * @brief Options of Intel Processor Trace
+ * @details The output buffer of each core is a power of two (a single
+ * region of ToPA)
+ *
+ */
+#define PROCESSOR_TRACE_DEFAULT_BUFFER_SIZE  0x40000
+#define PROCESSOR_TRACE_MINIMUM_BUFFER_SIZE  0x1000
+#define PROCESSOR_TRACE_MAXIMUM_BUFFER_SIZE  0x800000
+#define PROCESSOR_TRACE_MAXIMUM_READ_SIZE    0x10000
+#define PROCESSOR_TRACE_FILTER_USER_MODE     0x1
+#define PROCESSOR_TRACE_FILTER_KERNEL_MODE   0x2
+#define PROCESSOR_TRACE_STATUS_ERROR         0x10 // IA32_RTIT_STATUS.Error (an error of the output)
+#define PROCESSOR_TRACE_STATUS_STOPPED       0x20 // IA32_RTIT_STATUS.Stopped (TraceStop)
+
+/**
+ * @brief The structure of Intel Processor Trace requests and their
+ * statistics in HyperDbg
+ * @details The packets of the reading requests are placed after this
+ * structure, the buffer of each core is read from its oldest byte
+ *
+ */
+typedef struct _PROCESSOR_TRACE_OPERATION_PACKETS
+{
+    PROCESSOR_TRACE_OPERATION_TYPE ProcessorTraceOperationType;
+
+    //
+    // Options (used for starting)
+    //
+    UINT64  CoreMask; // Zero means all cores
+    UINT32  BufferSize;
+    UINT32  PrivilegeFilter; // PROCESSOR_TRACE_FILTER_USER_MODE and PROCESSOR_TRACE_FILTER_KERNEL_MODE
+    UINT32  ProcessId;       // Zero means the Cr3 (if the Cr3 is zero, all processes are traced)
+    UINT64  Cr3;
+    UINT64  IpFilterStart; // Zero means no IP filtering
+    UINT64  IpFilterEnd;
+    BOOLEAN IsPaused; // The tracing is started by the events (scripts)
+
+    //
+    // Reading the buffer of a core
+    //
+    UINT32 CoreId;
+    UINT32 Offset;        // Offset from the oldest byte of the buffer
+    UINT32 NumberOfBytes; // Count of the bytes after this structure
+
+    //
+    // Statistics (of all cores)
+    //
+    UINT32 NumberOfConfiguredCores;
+    UINT32 NumberOfTracingCores;
+    UINT32 ConfiguredBufferSize;
+    UINT32 TraceStatus; // The PROCESSOR_TRACE_STATUS_* of any of the cores
+    UINT64 ConfiguredCr3;
+
+    UINT32 KernelStatus;
+
+} PROCESSOR_TRACE_OPERATION_PACKETS, *PPROCESSOR_TRACE_OPERATION_PACKETS;
+
+/**
+ * @brief Debugger size of PROCESSOR_TRACE_OPERATION_PACKETS
+ *
+ */
+#define SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS \
+    sizeof(PROCESSOR_TRACE_OPERATION_PACKETS)
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief Perform actions related to the Last Branch Records
+ *
+ */
+typedef enum _LBR_OPERATION_TYPE
+{
+    LBR_OPERATION_TYPE_QUERY,
+    LBR_OPERATION_TYPE_ENABLE,
+    LBR_OPERATION_TYPE_DISABLE,
+
+} LBR_OPERATION_TYPE;
+
+/**
+ * @brief Options of the Last Branch Records
+ * @details The filter is the value of MSR_LBR_SELECT (a set bit suppresses
+ * the branches of its kind, zero records all of the branches)
+ *
+ */
+#define LBR_SELECT_MASK                 0x3ff
+#define LBR_SELECT_SUPPRESS_KERNEL_MODE 0x1 // CPL_EQ_0
+#define LBR_SELECT_SUPPRESS_USER_MODE   0x2 // CPL_NEQ_0
+#define LBR_SNAPSHOT_MAXIMUM_RECORDS    32
+
+/**
+ * @brief The structure of the Last Branch Records requests and their
+ * statistics in HyperDbg
+ *
+ */
+typedef struct _LBR_OPERATION_PACKETS
+{
+    LBR_OPERATION_TYPE LbrOperationType;
+
+    //
+    // Options (used for enabling)
+    //
+    UINT64 CoreMask; // Zero means all cores
+    UINT32 Select;   // MSR_LBR_SELECT
+
+    //
+    // Statistics (of all cores)
+    //
+    UINT32  NumberOfEntries;
+    UINT32  Format; // IA32_PERF_CAPABILITIES.LBR_FMT
+    UINT32  NumberOfEnabledCores;
+    BOOLEAN IsSelectSupported;
+
+    UINT32 KernelStatus;
+
+} LBR_OPERATION_PACKETS, *PLBR_OPERATION_PACKETS;
+
+/**
+ * @brief Debugger size of LBR_OPERATION_PACKETS
+ *
+ */
+#define SIZEOF_LBR_OPERATION_PACKETS \
+    sizeof(LBR_OPERATION_PACKETS)
+
+/* ==============================================================================================
+ */
+
 /**
  * @brief Maximum number of IDT entries
  *
@@ -1319,6 +1722,7 @@ typedef struct _DEBUGGEE_FORMATS_PACKET
 typedef struct _DEBUGGEE_SYMBOL_REQUEST_PACKET
 {
     UINT32 ProcessId;
+    UINT64 SymbolTableDigest; // Digest of the debugger's symbol table (SYMBOL_SYNC_DIGEST_UNKNOWN for full sync)
 
 } DEBUGGEE_SYMBOL_REQUEST_PACKET, *PDEBUGGEE_SYMBOL_REQUEST_PACKET;
 
@@ -133,61 +133,64 @@ static const char *const SymbolTypeNames[] = {
 #define FUNC_SPINLOCK_UNLOCK 44
 #define FUNC_EVENT_SC 45
 #define FUNC_MICROSLEEP 46
-#define FUNC_PRINTF 47
-#define FUNC_PAUSE 48
-#define FUNC_FLUSH 49
-#define FUNC_EVENT_TRACE_STEP 50
-#define FUNC_EVENT_TRACE_STEP_IN 51
-#define FUNC_EVENT_TRACE_STEP_OUT 52
-#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP 53
-#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN 54
-#define FUNC_RDTSC 55
-#define FUNC_RDTSCP 56
-#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 57
-#define FUNC_EVENT_INJECT 58
-#define FUNC_POI 59
-#define FUNC_DB 60
-#define FUNC_DD 61
-#define FUNC_DW 62
-#define FUNC_DQ 63
-#define FUNC_NEG 64
-#define FUNC_HI 65
-#define FUNC_LOW 66
-#define FUNC_NOT 67
-#define FUNC_CHECK_ADDRESS 68
-#define FUNC_DISASSEMBLE_LEN 69
-#define FUNC_DISASSEMBLE_LEN32 70
-#define FUNC_DISASSEMBLE_LEN64 71
-#define FUNC_INTERLOCKED_INCREMENT 72
-#define FUNC_INTERLOCKED_DECREMENT 73
-#define FUNC_PHYSICAL_TO_VIRTUAL 74
-#define FUNC_VIRTUAL_TO_PHYSICAL 75
-#define FUNC_POI_PA 76
-#define FUNC_HI_PA 77
-#define FUNC_LOW_PA 78
-#define FUNC_DB_PA 79
-#define FUNC_DD_PA 80
-#define FUNC_DW_PA 81
-#define FUNC_DQ_PA 82
-#define FUNC_ED 83
-#define FUNC_EB 84
-#define FUNC_EQ 85
-#define FUNC_INTERLOCKED_EXCHANGE 86
-#define FUNC_INTERLOCKED_EXCHANGE_ADD 87
-#define FUNC_EB_PA 88
-#define FUNC_ED_PA 89
-#define FUNC_EQ_PA 90
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 91
-#define FUNC_STRLEN 92
-#define FUNC_STRCMP 93
-#define FUNC_MEMCMP 94
-#define FUNC_STRNCMP 95
-#define FUNC_WCSLEN 96
-#define FUNC_WCSCMP 97
-#define FUNC_EVENT_INJECT_ERROR_CODE 98
-#define FUNC_MEMCPY 99
-#define FUNC_MEMCPY_PA 100
-#define FUNC_WCSNCMP 101
+#define FUNC_LBR_SNAPSHOT 47
+#define FUNC_PRINTF 48
+#define FUNC_PAUSE 49
+#define FUNC_FLUSH 50
+#define FUNC_EVENT_TRACE_STEP 51
+#define FUNC_EVENT_TRACE_STEP_IN 52
+#define FUNC_EVENT_TRACE_STEP_OUT 53
+#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP 54
+#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN 55
+#define FUNC_PT_START 56
+#define FUNC_PT_STOP 57
+#define FUNC_RDTSC 58
+#define FUNC_RDTSCP 59
+#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 60
+#define FUNC_EVENT_INJECT 61
+#define FUNC_POI 62
+#define FUNC_DB 63
+#define FUNC_DD 64
+#define FUNC_DW 65
+#define FUNC_DQ 66
+#define FUNC_NEG 67
+#define FUNC_HI 68
+#define FUNC_LOW 69
+#define FUNC_NOT 70
+#define FUNC_CHECK_ADDRESS 71
+#define FUNC_DISASSEMBLE_LEN 72
+#define FUNC_DISASSEMBLE_LEN32 73
+#define FUNC_DISASSEMBLE_LEN64 74
+#define FUNC_INTERLOCKED_INCREMENT 75
+#define FUNC_INTERLOCKED_DECREMENT 76
+#define FUNC_PHYSICAL_TO_VIRTUAL 77
+#define FUNC_VIRTUAL_TO_PHYSICAL 78
+#define FUNC_POI_PA 79
+#define FUNC_HI_PA 80
+#define FUNC_LOW_PA 81
+#define FUNC_DB_PA 82
+#define FUNC_DD_PA 83
+#define FUNC_DW_PA 84
+#define FUNC_DQ_PA 85
+#define FUNC_ED 86
+#define FUNC_EB 87
+#define FUNC_EQ 88
+#define FUNC_INTERLOCKED_EXCHANGE 89
+#define FUNC_INTERLOCKED_EXCHANGE_ADD 90
+#define FUNC_EB_PA 91
+#define FUNC_ED_PA 92
+#define FUNC_EQ_PA 93
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 94
+#define FUNC_STRLEN 95
+#define FUNC_STRCMP 96
+#define FUNC_MEMCMP 97
+#define FUNC_STRNCMP 98
+#define FUNC_WCSLEN 99
+#define FUNC_WCSCMP 100
+#define FUNC_EVENT_INJECT_ERROR_CODE 101
+#define FUNC_MEMCPY 102
+#define FUNC_MEMCPY_PA 103
+#define FUNC_WCSNCMP 104
 
 static const char *const FunctionNames[] = {
 "FUNC_UNDEFINED",
@@ -237,6 +240,7 @@ static const char *const FunctionNames[] = {
 "FUNC_SPINLOCK_UNLOCK",
 "FUNC_EVENT_SC",
 "FUNC_MICROSLEEP",
+"FUNC_LBR_SNAPSHOT",
 "FUNC_PRINTF",
 "FUNC_PAUSE",
 "FUNC_FLUSH",
@@ -245,6 +249,8 @@ static const char *const FunctionNames[] = {
 "FUNC_EVENT_TRACE_STEP_OUT",
 "FUNC_EVENT_TRACE_INSTRUMENTATION_STEP",
 "FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN",
+"FUNC_PT_START",
+"FUNC_PT_STOP",
 "FUNC_RDTSC",
 "FUNC_RDTSCP",
 "FUNC_SPINLOCK_LOCK_CUSTOM_WAIT",
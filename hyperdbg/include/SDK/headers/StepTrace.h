@@ -0,0 +1,125 @@
+/**
+ * @file StepTrace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief HyperDbg's SDK Header Files For Counted Instrumentation Step-in Traces
+ * @details This file contains the layout of the delta-compressed buffers
+ * that keep the instructions (and optionally the registers) which are
+ * executed by the counted instrumentation step-in (i command)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//               Step Trace Constants           //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Magic of the step trace buffers ('HDST')
+ *
+ */
+#define STEP_TRACE_BUFFER_MAGIC 0x54534448
+
+/**
+ * @brief Maximum number of registers that can be saved with each step
+ *
+ */
+#define STEP_TRACE_NUMBER_OF_REGISTERS 4
+
+/**
+ * @brief Size of the encoded steps of each (per-core) step trace buffer
+ *
+ */
+#define STEP_TRACE_MAXIMUM_DATA_SIZE (64 * 1024)
+
+/**
+ * @brief Maximum size of the encoded steps that are sent to the debugger
+ * in a single packet
+ *
+ */
+#define STEP_TRACE_MAXIMUM_CHUNK_SIZE (32 * 1024)
+
+/**
+ * @brief Maximum size of the encoding of a single step
+ * @details A flags byte and a (10 bytes) varint for the RIP and each of
+ * the registers
+ *
+ */
+#define STEP_TRACE_MAXIMUM_STEP_SIZE (1 + (1 + STEP_TRACE_NUMBER_OF_REGISTERS) * 10)
+
+//////////////////////////////////////////////////
+//               Step Trace Structures          //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The reason that the counted step trace is stopped
+ *
+ */
+typedef enum _STEP_TRACE_STOP_REASON
+{
+    STEP_TRACE_STOP_REASON_NOT_STOPPED,
+    STEP_TRACE_STOP_REASON_COUNT_REACHED,
+    STEP_TRACE_STOP_REASON_BUFFER_FULL,
+    STEP_TRACE_STOP_REASON_BREAKPOINT,
+
+} STEP_TRACE_STOP_REASON;
+
+/**
+ * @brief Header of a step trace buffer
+ * @details Each step is encoded as the zigzag varint of the difference of
+ * its RIP with the previous step. If registers are traced, each step starts
+ * with a byte that its bits indicate the changed registers, the varints of
+ * the difference of the changed registers follow the RIP. Registers are
+ * saved based on the index of them in the GUEST_REGS structure
+ *
+ */
+typedef struct _STEP_TRACE_HEADER
+{
+    UINT32 Magic;
+    UINT16 Core;
+    UINT8  NumberOfRegisters;
+    UINT8  StopReason;
+    UINT8  RegisterIds[STEP_TRACE_NUMBER_OF_REGISTERS];
+    UINT32 NumberOfSteps;
+    UINT32 DataSize;
+    UINT32 Reserved;
+    UINT64 InitialRip;                                        // RIP before the first step
+    UINT64 InitialRegisters[STEP_TRACE_NUMBER_OF_REGISTERS]; // registers before the first step
+    UINT64 LastRip;                                           // RIP after the last step
+    UINT64 LastRegisters[STEP_TRACE_NUMBER_OF_REGISTERS];    // registers after the last step
+
+} STEP_TRACE_HEADER, *PSTEP_TRACE_HEADER;
+
+/**
+ * @brief Step trace buffer of a single core
+ *
+ */
+typedef struct _STEP_TRACE_BUFFER
+{
+    STEP_TRACE_HEADER Header;
+    UINT8             Data[STEP_TRACE_MAXIMUM_DATA_SIZE];
+
+} STEP_TRACE_BUFFER, *PSTEP_TRACE_BUFFER;
+
+#define SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET \
+    sizeof(DEBUGGEE_STEP_TRACE_READ_PACKET)
+
+/**
+ * @brief Request for reading a chunk of the step trace buffer of
+ * the current core
+ * @details In the response, ChunkSize bytes of the encoded steps
+ * follow this structure
+ *
+ */
+typedef struct _DEBUGGEE_STEP_TRACE_READ_PACKET
+{
+    UINT32            Offset;
+    UINT32            ChunkSize;
+    UINT32            KernelStatus;
+    UINT32            Reserved;
+    STEP_TRACE_HEADER Header;
+
+} DEBUGGEE_STEP_TRACE_READ_PACKET, *PDEBUGGEE_STEP_TRACE_READ_PACKET;
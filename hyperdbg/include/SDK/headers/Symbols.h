@@ -77,6 +77,43 @@ typedef struct _DEBUGGER_UPDATE_SYMBOL_TABLE
 
 } DEBUGGER_UPDATE_SYMBOL_TABLE, *PDEBUGGER_UPDATE_SYMBOL_TABLE;
 
+/**
+ * @brief a batch of added or removed modules that is sent from the
+ * debuggee to the debugger to synchronize the symbol table
+ *
+ */
+typedef struct _DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH
+{
+    UINT32  TotalSymbols;          // Number of modules after applying all of the batches
+    UINT32  BatchIndex;            // Index of this batch in the current synchronization
+    UINT32  NumberOfEntries;       // Number of DEBUGGER_SYMBOL_SYNC_ENTRYs in this batch
+    UINT32  EntriesLength;         // Length of the appended entries (in bytes)
+    BOOLEAN IsFullSynchronization; // TRUE if the debugger should drop its previous table
+
+    //
+    // Here is a list of DEBUGGER_SYMBOL_SYNC_ENTRY (appended)
+    //
+
+} DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH, *PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH;
+
+/**
+ * @brief each entry of the symbol table synchronization batch
+ * @details the entry is followed by GuidAndAge, FilePath and ModuleSymbolPath
+ * strings (without null-terminator) with the lengths that are specified here
+ *
+ */
+typedef struct _DEBUGGER_SYMBOL_SYNC_ENTRY
+{
+    UINT64 BaseAddress;
+    UINT8  Action; // SYMBOL_SYNC_ENTRY_ACTION_*
+    UINT8  Flags;  // SYMBOL_SYNC_ENTRY_FLAG_*
+    UINT8  GuidAndAgeLength;
+    UINT8  Reserved;
+    UINT16 FilePathLength;
+    UINT16 ModuleSymbolPathLength;
+
+} DEBUGGER_SYMBOL_SYNC_ENTRY, *PDEBUGGER_SYMBOL_SYNC_ENTRY;
+
 /*
 ==============================================================================================
  */
@@ -166,6 +166,28 @@ IMPORT_EXPORT_VMM BOOLEAN
 VmFuncSmmPerformSmiOperation(SMI_OPERATION_PACKETS * SmiOperationRequest,
                              BOOLEAN                 ApplyFromVmxRootMode);
 
+IMPORT_EXPORT_VMM VOID
+VmFuncQueryTscOffsetting(TSC_OFFSETTING_OPERATION_PACKETS * TscOffsettingRequest);
+
+IMPORT_EXPORT_VMM BOOLEAN
+VmFuncProfilerPerformOperation(PROFILER_OPERATION_PACKETS * ProfilerRequest,
+                               PROFILER_SAMPLE *            Samples,
+                               UINT32                       MaximumSamples);
+
+IMPORT_EXPORT_VMM BOOLEAN
+VmFuncProcessorTracePerformOperation(PROCESSOR_TRACE_OPERATION_PACKETS * ProcessorTraceRequest,
+                                     UINT8 *                             Buffer,
+                                     UINT32                              MaximumBytes);
+
+IMPORT_EXPORT_VMM VOID
+VmFuncProcessorTraceControlCurrentCore(BOOLEAN Enable);
+
+IMPORT_EXPORT_VMM BOOLEAN
+VmFuncLbrPerformOperation(LBR_OPERATION_PACKETS * LbrRequest);
+
+IMPORT_EXPORT_VMM UINT32
+VmFuncLbrCaptureSnapshot(LBR_DECODE_RECORD * Records, UINT32 MaximumRecords);
+
 IMPORT_EXPORT_VMM UINT16
 VmFuncGetCsSelector();
 
@@ -308,6 +330,9 @@ ConfigureEptHook(PVOID TargetAddress, UINT32 ProcessId);
 IMPORT_EXPORT_VMM BOOLEAN
 ConfigureEptHookFromVmxRoot(PVOID TargetAddress);
 
+IMPORT_EXPORT_VMM BOOLEAN
+ConfigureEptHookBatch(PVOID * TargetAddresses, UINT32 NumberOfTargets, UINT32 ProcessId);
+
 IMPORT_EXPORT_VMM BOOLEAN
 ConfigureEptHook2(UINT32 CoreId,
                   PVOID  TargetAddress,
@@ -355,6 +380,9 @@ ConfigureEptHookUnHookSingleAddress(UINT64 VirtualAddress,
                                     UINT64 PhysAddress,
                                     UINT32 ProcessId);
 
+IMPORT_EXPORT_VMM BOOLEAN
+ConfigureEptHookUnHookBatch(UINT64 * VirtualAddresses, UINT32 NumberOfAddresses);
+
 IMPORT_EXPORT_VMM BOOLEAN
 ConfigureEptHookUnHookSingleAddressFromVmxRoot(UINT64                              VirtualAddress,
                                                UINT64                              PhysAddress,
@@ -457,6 +485,12 @@ DirectVmcallDisableMov2DrExitingForClearingDrEvents(UINT32 CoreId, DIRECT_VMCALL
 IMPORT_EXPORT_VMM NTSTATUS
 DirectVmcallDisableMov2CrExitingForClearingCrEvents(UINT32 CoreId, DIRECT_VMCALL_PARAMETERS * DirectVmcallOptions);
 
+IMPORT_EXPORT_VMM NTSTATUS
+DirectVmcallEnableTscOffsetting(UINT32 CoreId, DIRECT_VMCALL_PARAMETERS * DirectVmcallOptions);
+
+IMPORT_EXPORT_VMM NTSTATUS
+DirectVmcallDisableTscOffsetting(UINT32 CoreId, DIRECT_VMCALL_PARAMETERS * DirectVmcallOptions);
+
 //////////////////////////////////////////////////
 //                 Disassembler 	    		//
 //////////////////////////////////////////////////
@@ -988,6 +1022,12 @@ BroadcastEnableEferSyscallEventsOnAllProcessors();
 IMPORT_EXPORT_VMM VOID
 BroadcastDisableEferSyscallEventsOnAllProcessors();
 
+IMPORT_EXPORT_VMM VOID
+BroadcastEnableTscOffsettingAllCores(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest);
+
+IMPORT_EXPORT_VMM VOID
+BroadcastDisableTscOffsettingAllCores();
+
 //////////////////////////////////////////////////
 //     Device-related Functions                	//
 //////////////////////////////////////////////////
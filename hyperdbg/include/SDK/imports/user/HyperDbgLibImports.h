@@ -64,6 +64,26 @@ hyperdbg_u_test_command_parser(CHAR *   command,
 IMPORT_EXPORT_LIBHYPERDBG VOID
 hyperdbg_u_test_command_parser_show_tokens(CHAR * command);
 
+IMPORT_EXPORT_LIBHYPERDBG BOOLEAN
+hyperdbg_u_test_command_parser_benchmark(CHAR **  commands,
+                                         UINT32   number_of_commands,
+                                         UINT32   number_of_iterations,
+                                         UINT64 * parse_time,
+                                         UINT64 * tokenize_time,
+                                         UINT64 * number_of_tokens);
+
+//
+// Testing script engine
+//
+IMPORT_EXPORT_LIBHYPERDBG BOOLEAN
+hyperdbg_u_test_script_filter(CHAR *       script,
+                              GUEST_REGS * states,
+                              UINT32       number_of_states,
+                              BOOLEAN *    filter_results,
+                              BOOLEAN *    interpreter_results,
+                              UINT64 *     filter_time,
+                              UINT64 *     interpreter_time);
+
 //
 // General imports/exports
 //
@@ -46,6 +46,14 @@ HardwareScriptInterpreterCompressBuffer(UINT64 * Buffer,
                                         size_t * NewBufferSize,
                                         size_t * NumberOfBytesPerChunk);
 
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
+HardwareScriptInterpreterBitPackBuffer(HWDBG_SHORT_SYMBOL * Buffer,
+                                       size_t               BufferLength,
+                                       UINT32               ScriptVariableLength,
+                                       UINT32               BramDataWidth,
+                                       size_t *             NewBufferSize,
+                                       size_t *             NumberOfBytesPerChunk);
+
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
 HardwareScriptInterpreterConvertSymbolToHwdbgShortSymbolBuffer(
     HWDBG_INSTANCE_INFORMATION * InstanceInfo,
@@ -94,6 +102,15 @@ ScriptEngineGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffs
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
 ScriptEngineGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize);
 
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
+ScriptEngineCastingQueryForFiledsAndTypes(const char * StructName,
+                                          const char * FiledOfStructName,
+                                          PBOOLEAN     IsStructNamePointerOrNot,
+                                          PBOOLEAN     IsFiledOfStructNamePointerOrNot,
+                                          char **      NewStructOrTypeName,
+                                          UINT32 *     OffsetOfFieldFromTop,
+                                          UINT32 *     SizeOfField);
+
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
 ScriptEngineCreateSymbolTableForDisassembler(void * CallbackFunction);
 
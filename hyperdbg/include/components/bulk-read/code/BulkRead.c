@@ -0,0 +1,321 @@
+/**
+ * @file BulkRead.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Bulk (multi-page) memory reads and their pipeline
+ * @details A bulk read request covers up to 64 pages. The range is split
+ * at page boundaries and each page has a bit in the bitmap of the valid
+ * pages, so an unmapped page is zeroed instead of failing the transfer.
+ * The pipeline keeps a few requests in flight and passes the result of
+ * each of them to the writer in order
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the number of pages that a range touches
+ *
+ * @param Address
+ * @param Size
+ *
+ * @return UINT32
+ */
+UINT32
+BulkReadGetNumberOfPages(UINT64 Address, UINT32 Size)
+{
+    if (Size == 0)
+    {
+        return 0;
+    }
+
+    return (UINT32)(((Address + Size - 1) / NORMAL_PAGE_SIZE) - (Address / NORMAL_PAGE_SIZE) + 1);
+}
+
+/**
+ * @brief Get the size of the next request from the address so the
+ * request touches at most MaximumPages pages
+ *
+ * @param Address
+ * @param RemainingSize
+ * @param MaximumPages
+ *
+ * @return UINT32
+ */
+UINT32
+BulkReadGetRequestSize(UINT64 Address, UINT64 RemainingSize, UINT32 MaximumPages)
+{
+    UINT64 Size = ((UINT64)MaximumPages * NORMAL_PAGE_SIZE) - (Address % NORMAL_PAGE_SIZE);
+
+    if (RemainingSize < Size)
+    {
+        Size = RemainingSize;
+    }
+
+    return (UINT32)Size;
+}
+
+/**
+ * @brief Fill the header of a bulk read request
+ *
+ * @param Request
+ * @param Address
+ * @param Size
+ * @param Pid
+ * @param MemoryType
+ *
+ * @return VOID
+ */
+VOID
+BulkReadInitializeRequest(PDEBUGGER_BULK_READ_MEMORY Request,
+                          UINT64                     Address,
+                          UINT32                     Size,
+                          UINT32                     Pid,
+                          DEBUGGER_READ_MEMORY_TYPE  MemoryType)
+{
+    memset(Request, 0, sizeof(DEBUGGER_BULK_READ_MEMORY));
+
+    Request->Address    = Address;
+    Request->Size       = Size;
+    Request->Pid        = Pid;
+    Request->MemoryType = MemoryType;
+}
+
+/**
+ * @brief Check whether the range of a bulk read request is valid
+ *
+ * @param Request
+ * @param MaximumPages
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BulkReadIsRequestValid(const DEBUGGER_BULK_READ_MEMORY * Request, UINT32 MaximumPages)
+{
+    if (Request->Size == 0 || MaximumPages > DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES)
+    {
+        return FALSE;
+    }
+
+    //
+    // The range should not wrap around
+    //
+    if (Request->Address + (Request->Size - 1) < Request->Address)
+    {
+        return FALSE;
+    }
+
+    return BulkReadGetNumberOfPages(Request->Address, Request->Size) <= MaximumPages;
+}
+
+/**
+ * @brief Get the part of the range that is located on a page
+ *
+ * @param Request
+ * @param Index Index of the page in the range
+ * @param PageAddress Start address of the part
+ * @param PageSize Size of the part
+ * @param Offset Offset of the part in the buffer of the request
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BulkReadGetPage(const DEBUGGER_BULK_READ_MEMORY * Request,
+                UINT32                            Index,
+                UINT64 *                          PageAddress,
+                UINT32 *                          PageSize,
+                UINT32 *                          Offset)
+{
+    UINT64 FirstPage = Request->Address - (Request->Address % NORMAL_PAGE_SIZE);
+    UINT64 LastByte  = Request->Address + (Request->Size - 1);
+    UINT64 Start;
+    UINT64 End;
+
+    if (Index >= BulkReadGetNumberOfPages(Request->Address, Request->Size))
+    {
+        return FALSE;
+    }
+
+    //
+    // Only the first page might start from the middle of the page
+    //
+    Start = Index == 0 ? Request->Address : FirstPage + ((UINT64)Index * NORMAL_PAGE_SIZE);
+    End   = FirstPage + ((UINT64)Index * NORMAL_PAGE_SIZE) + (NORMAL_PAGE_SIZE - 1);
+
+    if (End > LastByte)
+    {
+        End = LastByte;
+    }
+
+    *PageAddress = Start;
+    *PageSize    = (UINT32)(End - Start + 1);
+    *Offset      = (UINT32)(Start - Request->Address);
+
+    return TRUE;
+}
+
+/**
+ * @brief Mark a page of the range as read
+ *
+ * @param Request
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+BulkReadSetPageValid(PDEBUGGER_BULK_READ_MEMORY Request, UINT32 Index)
+{
+    if (!BulkReadIsPageValid(Request, Index))
+    {
+        Request->ValidPagesBitmap |= 1ull << Index;
+        Request->NumberOfValidPages++;
+    }
+}
+
+/**
+ * @brief Check whether a page of the range is read
+ *
+ * @param Request
+ * @param Index
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BulkReadIsPageValid(const DEBUGGER_BULK_READ_MEMORY * Request, UINT32 Index)
+{
+    if (Index >= DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES)
+    {
+        return FALSE;
+    }
+
+    return (Request->ValidPagesBitmap & (1ull << Index)) != 0;
+}
+
+/**
+ * @brief Zero the pages of a finished request which are not read
+ *
+ * @param Request
+ *
+ * @return UINT32 number of the invalid pages
+ */
+static UINT32
+BulkReadZeroInvalidPages(PDEBUGGER_BULK_READ_MEMORY Request)
+{
+    UINT8 * Buffer             = (UINT8 *)Request + SIZEOF_DEBUGGER_BULK_READ_MEMORY;
+    UINT32  NumberOfPages      = BulkReadGetNumberOfPages(Request->Address, Request->Size);
+    UINT32  NumberOfEmptyPages = 0;
+    UINT64  PageAddress;
+    UINT32  PageSize;
+    UINT32  Offset;
+
+    for (UINT32 i = 0; i < NumberOfPages; i++)
+    {
+        if (!BulkReadIsPageValid(Request, i) && BulkReadGetPage(Request, i, &PageAddress, &PageSize, &Offset))
+        {
+            memset(&Buffer[Offset], 0, PageSize);
+            NumberOfEmptyPages++;
+        }
+    }
+
+    return NumberOfEmptyPages;
+}
+
+/**
+ * @brief Read the range of the pipeline and pass it to the writer
+ * @details Up to NumberOfSlots requests are in flight, the oldest request
+ * is always completed first so the writer receives the range in order.
+ * Once something fails, no more requests are sent but the requests that
+ * are in flight are still completed (their buffers are in use)
+ *
+ * @param Pipeline
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BulkReadPipelineRun(PBULK_READ_PIPELINE Pipeline)
+{
+    PDEBUGGER_BULK_READ_MEMORY Request;
+    UINT32                     Size;
+    UINT64                     NextAddress   = Pipeline->Address;
+    UINT64                     RemainingSize = Pipeline->Size;
+    UINT32                     InFlight      = 0;
+    UINT32                     OldestSlot    = 0;
+    UINT32                     NextSlot      = 0;
+    BOOLEAN                    Result        = TRUE;
+
+    Pipeline->NumberOfRequests     = 0;
+    Pipeline->NumberOfInvalidPages = 0;
+    Pipeline->KernelStatus         = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+    if (Pipeline->PagesPerRequest == 0 ||
+        Pipeline->PagesPerRequest > DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES ||
+        Pipeline->NumberOfSlots == 0)
+    {
+        return FALSE;
+    }
+
+    while (TRUE)
+    {
+        //
+        // Fill the free slots
+        //
+        while (Result && RemainingSize != 0 && InFlight < Pipeline->NumberOfSlots)
+        {
+            Request = Pipeline->Slots[NextSlot];
+            Size    = BulkReadGetRequestSize(NextAddress, RemainingSize, Pipeline->PagesPerRequest);
+
+            BulkReadInitializeRequest(Request, NextAddress, Size, Pipeline->Pid, Pipeline->MemoryType);
+
+            if (!Pipeline->Submit(NextSlot, Request, SIZEOF_DEBUGGER_BULK_READ_MEMORY + Size, Pipeline->Context))
+            {
+                Result = FALSE;
+                break;
+            }
+
+            NextAddress += Size;
+            RemainingSize -= Size;
+            NextSlot = (NextSlot + 1) % Pipeline->NumberOfSlots;
+            InFlight++;
+            Pipeline->NumberOfRequests++;
+        }
+
+        if (InFlight == 0)
+        {
+            break;
+        }
+
+        //
+        // Wait for the oldest request
+        //
+        Request = Pipeline->Slots[OldestSlot];
+
+        if (!Pipeline->Complete(OldestSlot, Request, Pipeline->Context))
+        {
+            Result = FALSE;
+        }
+        else if (Result)
+        {
+            if (Request->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+            {
+                Pipeline->KernelStatus = Request->KernelStatus;
+                Result                 = FALSE;
+            }
+            else
+            {
+                Pipeline->NumberOfInvalidPages += BulkReadZeroInvalidPages(Request);
+
+                if (!Pipeline->Write((UINT8 *)Request + SIZEOF_DEBUGGER_BULK_READ_MEMORY, Request->Size, Pipeline->Context))
+                {
+                    Result = FALSE;
+                }
+            }
+        }
+
+        OldestSlot = (OldestSlot + 1) % Pipeline->NumberOfSlots;
+        InFlight--;
+    }
+
+    return Result;
+}
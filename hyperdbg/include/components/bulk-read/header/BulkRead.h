@@ -0,0 +1,107 @@
+/**
+ * @file BulkRead.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the bulk (multi-page) memory reads and their pipeline
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that sends a bulk read request of a slot to the debuggee,
+ * it might return before the request is finished
+ *
+ */
+typedef BOOLEAN (*BULK_READ_SUBMIT_CALLBACK)(UINT32                     Slot,
+                                             PDEBUGGER_BULK_READ_MEMORY Request,
+                                             UINT32                     RequestBufferSize,
+                                             PVOID                      Context);
+
+/**
+ * @brief Callback that waits for the bulk read request of a slot to be finished
+ *
+ */
+typedef BOOLEAN (*BULK_READ_COMPLETE_CALLBACK)(UINT32 Slot, PDEBUGGER_BULK_READ_MEMORY Request, PVOID Context);
+
+/**
+ * @brief Callback that receives the read memory in order
+ *
+ */
+typedef BOOLEAN (*BULK_READ_WRITE_CALLBACK)(const VOID * Buffer, UINT32 Length, PVOID Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The pipeline of the bulk read requests
+ * @details Slots are buffers of SIZEOF_DEBUGGER_BULK_READ_MEMORY plus
+ * PagesPerRequest pages, each slot holds one request in flight
+ *
+ */
+typedef struct _BULK_READ_PIPELINE
+{
+    UINT64                       Address;
+    UINT64                       Size;
+    UINT32                       Pid;
+    DEBUGGER_READ_MEMORY_TYPE    MemoryType;
+    UINT32                       PagesPerRequest;
+    UINT32                       NumberOfSlots;
+    PDEBUGGER_BULK_READ_MEMORY * Slots;
+    BULK_READ_SUBMIT_CALLBACK    Submit;
+    BULK_READ_COMPLETE_CALLBACK  Complete;
+    BULK_READ_WRITE_CALLBACK     Write;
+    PVOID                        Context;
+
+    //
+    // Results
+    //
+    UINT64 NumberOfRequests;
+    UINT64 NumberOfInvalidPages;
+    UINT32 KernelStatus;
+
+} BULK_READ_PIPELINE, *PBULK_READ_PIPELINE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+UINT32
+BulkReadGetNumberOfPages(UINT64 Address, UINT32 Size);
+
+UINT32
+BulkReadGetRequestSize(UINT64 Address, UINT64 RemainingSize, UINT32 MaximumPages);
+
+VOID
+BulkReadInitializeRequest(PDEBUGGER_BULK_READ_MEMORY Request,
+                          UINT64                     Address,
+                          UINT32                     Size,
+                          UINT32                     Pid,
+                          DEBUGGER_READ_MEMORY_TYPE  MemoryType);
+
+BOOLEAN
+BulkReadIsRequestValid(const DEBUGGER_BULK_READ_MEMORY * Request, UINT32 MaximumPages);
+
+BOOLEAN
+BulkReadGetPage(const DEBUGGER_BULK_READ_MEMORY * Request,
+                UINT32                            Index,
+                UINT64 *                          PageAddress,
+                UINT32 *                          PageSize,
+                UINT32 *                          Offset);
+
+VOID
+BulkReadSetPageValid(PDEBUGGER_BULK_READ_MEMORY Request, UINT32 Index);
+
+BOOLEAN
+BulkReadIsPageValid(const DEBUGGER_BULK_READ_MEMORY * Request, UINT32 Index);
+
+BOOLEAN
+BulkReadPipelineRun(PBULK_READ_PIPELINE Pipeline);
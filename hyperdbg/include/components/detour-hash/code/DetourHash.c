@@ -0,0 +1,280 @@
+/**
+ * @file DetourHash.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The lock-free hash of the detours of the inline EPT hooks
+ * @details The details of each detour (the physical address, the trampoline
+ * and the tag) are computed once when the hook is installed, so the handler
+ * of the detours finds them by the address of the hooked function without
+ * walking the list of the detours or translating the address. The writers
+ * are serialized by the callers (the same as the list of the detours) and
+ * each entry has a sequence that is odd while it's changed; a reader that
+ * sees a changing entry reports a miss, so the readers never wait and the
+ * callers use the list in that case
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the first entry of the probes of an address
+ *
+ * @param Hash
+ * @param HookedFunctionAddress
+ *
+ * @return UINT32
+ */
+static UINT32
+DetourHashGetIndex(const DETOUR_HASH * Hash, UINT64 HookedFunctionAddress)
+{
+    //
+    // Fibonacci hashing, the low bits of the addresses of the functions
+    // are mostly the same (alignment) so the high bits of the product are used
+    //
+    return (UINT32)((HookedFunctionAddress * 0x9e3779b97f4a7c15ull) >> Hash->Shift);
+}
+
+/**
+ * @brief Change an entry of the hash
+ *
+ * @param Entry
+ * @param HookedFunctionAddress
+ * @param Record
+ *
+ * @return VOID
+ */
+static VOID
+DetourHashWriteEntry(PDETOUR_HASH_ENTRY Entry, UINT64 HookedFunctionAddress, const DETOUR_HASH_RECORD * Record)
+{
+    //
+    // Make the sequence odd, the readers ignore the entry until it's even again
+    //
+    InterlockedIncrement64(&Entry->Sequence);
+
+    Entry->HookedFunctionAddress = HookedFunctionAddress;
+
+    if (Record != NULL)
+    {
+        Entry->PhysicalAddress = Record->PhysicalAddress;
+        Entry->ReturnAddress   = Record->ReturnAddress;
+        Entry->HookingTag      = Record->HookingTag;
+    }
+
+    InterlockedIncrement64(&Entry->Sequence);
+}
+
+/**
+ * @brief Initialize the hash
+ *
+ * @param Hash
+ * @param Entries The zeroed entries
+ * @param Capacity Count of the entries (a power of two)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+DetourHashInitialize(PDETOUR_HASH Hash, PDETOUR_HASH_ENTRY Entries, UINT32 Capacity)
+{
+    UINT32 Shift = 64;
+
+    if (Capacity == 0 || (Capacity & (Capacity - 1)) != 0)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = Capacity; i > 1; i >>= 1)
+    {
+        Shift--;
+    }
+
+    Hash->Entries  = Entries;
+    Hash->Capacity = Capacity;
+    Hash->Shift    = Shift;
+
+    return TRUE;
+}
+
+/**
+ * @brief Add the details of a detour or update them if the address is
+ * already in the hash
+ *
+ * @param Hash
+ * @param HookedFunctionAddress
+ * @param Record
+ *
+ * @return BOOLEAN FALSE if the hash is full
+ */
+BOOLEAN
+DetourHashInsert(PDETOUR_HASH Hash, UINT64 HookedFunctionAddress, const DETOUR_HASH_RECORD * Record)
+{
+    UINT64 Key;
+    UINT32 Index;
+    UINT32 Mask      = Hash->Capacity - 1;
+    UINT32 FreeIndex = Hash->Capacity;
+
+    if (HookedFunctionAddress == DETOUR_HASH_EMPTY_KEY || HookedFunctionAddress == DETOUR_HASH_DELETED_KEY)
+    {
+        return FALSE;
+    }
+
+    Index = DetourHashGetIndex(Hash, HookedFunctionAddress);
+
+    for (UINT32 Probe = 0; Probe < Hash->Capacity; Probe++, Index = (Index + 1) & Mask)
+    {
+        Key = Hash->Entries[Index].HookedFunctionAddress;
+
+        if (Key == HookedFunctionAddress)
+        {
+            FreeIndex = Index;
+            break;
+        }
+
+        if (Key == DETOUR_HASH_DELETED_KEY && FreeIndex == Hash->Capacity)
+        {
+            FreeIndex = Index;
+        }
+        else if (Key == DETOUR_HASH_EMPTY_KEY)
+        {
+            if (FreeIndex == Hash->Capacity)
+            {
+                FreeIndex = Index;
+            }
+
+            break;
+        }
+    }
+
+    if (FreeIndex == Hash->Capacity)
+    {
+        return FALSE;
+    }
+
+    DetourHashWriteEntry(&Hash->Entries[FreeIndex], HookedFunctionAddress, Record);
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove the details of a detour
+ *
+ * @param Hash
+ * @param HookedFunctionAddress
+ *
+ * @return BOOLEAN FALSE if the address is not in the hash
+ */
+BOOLEAN
+DetourHashRemove(PDETOUR_HASH Hash, UINT64 HookedFunctionAddress)
+{
+    UINT64 Key;
+    UINT32 Index;
+    UINT32 Mask = Hash->Capacity - 1;
+
+    if (HookedFunctionAddress == DETOUR_HASH_EMPTY_KEY || HookedFunctionAddress == DETOUR_HASH_DELETED_KEY)
+    {
+        return FALSE;
+    }
+
+    Index = DetourHashGetIndex(Hash, HookedFunctionAddress);
+
+    for (UINT32 Probe = 0; Probe < Hash->Capacity; Probe++, Index = (Index + 1) & Mask)
+    {
+        Key = Hash->Entries[Index].HookedFunctionAddress;
+
+        if (Key == DETOUR_HASH_EMPTY_KEY)
+        {
+            return FALSE;
+        }
+
+        if (Key != HookedFunctionAddress)
+        {
+            continue;
+        }
+
+        //
+        // The probes of the other addresses might pass this entry
+        //
+        DetourHashWriteEntry(&Hash->Entries[Index], DETOUR_HASH_DELETED_KEY, NULL);
+
+        //
+        // If the next entry is empty, no probe passes this entry and the
+        // deleted entries before it, so they are emptied to keep the probes short
+        //
+        while (Hash->Entries[(Index + 1) & Mask].HookedFunctionAddress == DETOUR_HASH_EMPTY_KEY &&
+               Hash->Entries[Index].HookedFunctionAddress == DETOUR_HASH_DELETED_KEY)
+        {
+            DetourHashWriteEntry(&Hash->Entries[Index], DETOUR_HASH_EMPTY_KEY, NULL);
+
+            Index = (Index - 1) & Mask;
+        }
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Find the details of a detour
+ * @details A miss means that the caller should use the list of the detours,
+ * because the address might not be added (the hash is full) or its entry
+ * might be changed at the same time
+ *
+ * @param Hash
+ * @param HookedFunctionAddress
+ * @param Record
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+DetourHashLookup(const DETOUR_HASH * Hash, UINT64 HookedFunctionAddress, PDETOUR_HASH_RECORD Record)
+{
+    const DETOUR_HASH_ENTRY * Entry;
+    LONG64                    Sequence;
+    UINT64                    Key;
+    UINT32                    Index;
+    UINT32                    Mask = Hash->Capacity - 1;
+
+    if (Hash->Entries == NULL)
+    {
+        return FALSE;
+    }
+
+    Index = DetourHashGetIndex(Hash, HookedFunctionAddress);
+
+    for (UINT32 Probe = 0; Probe < Hash->Capacity; Probe++, Index = (Index + 1) & Mask)
+    {
+        Entry    = &Hash->Entries[Index];
+        Sequence = Entry->Sequence;
+
+        if (Sequence & 1)
+        {
+            return FALSE;
+        }
+
+        Key = Entry->HookedFunctionAddress;
+
+        if (Key == DETOUR_HASH_EMPTY_KEY)
+        {
+            return FALSE;
+        }
+
+        if (Key != HookedFunctionAddress)
+        {
+            continue;
+        }
+
+        Record->PhysicalAddress = Entry->PhysicalAddress;
+        Record->ReturnAddress   = Entry->ReturnAddress;
+        Record->HookingTag      = Entry->HookingTag;
+
+        //
+        // The record is valid only if the entry is not changed while it's read
+        //
+        return Entry->Sequence == Sequence;
+    }
+
+    return FALSE;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file DetourHash.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the lock-free hash of the detours of the inline EPT hooks
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The keys of the entries that are not hooked functions
+ *
+ */
+#define DETOUR_HASH_EMPTY_KEY   0
+#define DETOUR_HASH_DELETED_KEY 1
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The precomputed details of a detour
+ *
+ */
+typedef struct _DETOUR_HASH_RECORD
+{
+    UINT64 PhysicalAddress; // Physical address of the hooked function
+    UINT64 ReturnAddress;   // The trampoline that runs the original instructions
+    UINT64 HookingTag;
+
+} DETOUR_HASH_RECORD, *PDETOUR_HASH_RECORD;
+
+/**
+ * @brief An entry of the hash
+ * @details The sequence is odd while a writer changes the entry, so the
+ * readers never see a half-written record
+ *
+ */
+typedef struct _DETOUR_HASH_ENTRY
+{
+    volatile LONG64 Sequence;
+    volatile UINT64 HookedFunctionAddress;
+    volatile UINT64 PhysicalAddress;
+    volatile UINT64 ReturnAddress;
+    volatile UINT64 HookingTag;
+
+} DETOUR_HASH_ENTRY, *PDETOUR_HASH_ENTRY;
+
+/**
+ * @brief The hash of the detours (open addressing with linear probing)
+ *
+ */
+typedef struct _DETOUR_HASH
+{
+    PDETOUR_HASH_ENTRY Entries;
+    UINT32             Capacity; // A power of two
+    UINT32             Shift;    // 64 - log2(Capacity)
+
+} DETOUR_HASH, *PDETOUR_HASH;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+DetourHashInitialize(PDETOUR_HASH Hash, PDETOUR_HASH_ENTRY Entries, UINT32 Capacity);
+
+BOOLEAN
+DetourHashInsert(PDETOUR_HASH Hash, UINT64 HookedFunctionAddress, const DETOUR_HASH_RECORD * Record);
+
+BOOLEAN
+DetourHashRemove(PDETOUR_HASH Hash, UINT64 HookedFunctionAddress);
+
+BOOLEAN
+DetourHashLookup(const DETOUR_HASH * Hash, UINT64 HookedFunctionAddress, PDETOUR_HASH_RECORD Record);
@@ -0,0 +1,363 @@
+/**
+ * @file EptpView.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The EPTP list and the views of the hidden hooks
+ * @details The hidden hooks (hidden breakpoints and !epthook) make the
+ * hooked pages execute-only, so each read of the page swaps the entry and
+ * steps the instruction with MTF. With the views, each core has an execute
+ * view (its own EPT) and a read view where the hooked pages are readable
+ * but not executable, so the core only moves between the views when it
+ * changes from executing the hooked page to reading it (or vice versa)
+ *
+ * The read view is an overlay of the execute view, it has its own root and
+ * only duplicates the tables on the path to the hooked pages, the rest of
+ * the tables are shared with the execute view
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Initialize the EPTP list
+ *
+ * @param List
+ * @param Entries The page of the list
+ * @param PhysicalAddress Physical address of the page of the list
+ *
+ * @return VOID
+ */
+VOID
+EptpViewListInitialize(PEPTP_VIEW_LIST List, UINT64 * Entries, UINT64 PhysicalAddress)
+{
+    List->Entries         = Entries;
+    List->PhysicalAddress = PhysicalAddress;
+
+    for (UINT32 i = 0; i < EPTP_VIEW_LIST_ENTRIES; i++)
+    {
+        Entries[i] = 0;
+    }
+}
+
+/**
+ * @brief Set an entry of the EPTP list
+ *
+ * @param List
+ * @param Index
+ * @param Eptp
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptpViewListSet(PEPTP_VIEW_LIST List, UINT32 Index, UINT64 Eptp)
+{
+    if (List->Entries == NULL || Index >= EPTP_VIEW_LIST_ENTRIES)
+    {
+        return FALSE;
+    }
+
+    List->Entries[Index] = Eptp;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the view of an EPTP
+ * @details The guest might switch the view by VMFUNC, so the current view
+ * is found from the EPTP of the VMCS
+ *
+ * @param List
+ * @param Eptp
+ *
+ * @return UINT32 The index of the EPTP or EPTP_VIEW_NONE
+ */
+UINT32
+EptpViewListFind(PEPTP_VIEW_LIST List, UINT64 Eptp)
+{
+    if (List->Entries == NULL || Eptp == 0)
+    {
+        return EPTP_VIEW_NONE;
+    }
+
+    for (UINT32 i = 0; i < EPTP_VIEW_COUNT; i++)
+    {
+        if (List->Entries[i] == Eptp)
+        {
+            return i;
+        }
+    }
+
+    return EPTP_VIEW_NONE;
+}
+
+/**
+ * @brief Get the EPTP of a view from the EPTP of the source EPT (with the
+ * same memory type, page-walk length and accessed and dirty flags)
+ *
+ * @param TemplateEptp
+ * @param RootPhysicalAddress
+ *
+ * @return UINT64
+ */
+UINT64
+EptpViewGetEptp(UINT64 TemplateEptp, UINT64 RootPhysicalAddress)
+{
+    return (TemplateEptp & ~EPTP_VIEW_ENTRY_ADDRESS) | (RootPhysicalAddress & EPTP_VIEW_ENTRY_ADDRESS);
+}
+
+/**
+ * @brief Get the view that resolves an EPT violation on a hooked page
+ *
+ * @param CurrentView
+ * @param ReadAccess
+ * @param WriteAccess
+ * @param ExecuteAccess
+ *
+ * @return UINT32 The target view or EPTP_VIEW_NONE if the violation is
+ * not resolved by switching the view
+ */
+UINT32
+EptpViewGetTargetView(UINT32 CurrentView, BOOLEAN ReadAccess, BOOLEAN WriteAccess, BOOLEAN ExecuteAccess)
+{
+    if (CurrentView == EPTP_VIEW_EXECUTE && !ExecuteAccess && (ReadAccess || WriteAccess))
+    {
+        return EPTP_VIEW_READ;
+    }
+    else if (CurrentView == EPTP_VIEW_READ && ExecuteAccess)
+    {
+        return EPTP_VIEW_EXECUTE;
+    }
+
+    return EPTP_VIEW_NONE;
+}
+
+/**
+ * @brief Get the entry of a hooked page in the read view
+ *
+ * @param OriginalEntry The entry of the page before it's hooked
+ *
+ * @return UINT64
+ */
+UINT64
+EptpViewGetReadViewEntry(UINT64 OriginalEntry)
+{
+    return OriginalEntry & ~(EPTP_VIEW_ENTRY_EXECUTE | EPTP_VIEW_ENTRY_USER_EXECUTE);
+}
+
+/**
+ * @brief Initialize an overlay
+ *
+ * @param Overlay
+ * @param Tables The physically contiguous pages of the tables
+ * @param TablesPhysicalAddress
+ * @param MaximumTables Count of the pages
+ * @param PhysicalToVirtual
+ * @param Context
+ *
+ * @return VOID
+ */
+VOID
+EptpViewOverlayInitialize(PEPTP_VIEW_OVERLAY                    Overlay,
+                          UINT64 *                              Tables,
+                          UINT64                                TablesPhysicalAddress,
+                          UINT32                                MaximumTables,
+                          EPTP_VIEW_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual,
+                          PVOID                                 Context)
+{
+    Overlay->Tables                    = Tables;
+    Overlay->TablesPhysicalAddress     = TablesPhysicalAddress;
+    Overlay->MaximumTables             = MaximumTables;
+    Overlay->NumberOfTables            = 0;
+    Overlay->SourceRootPhysicalAddress = 0;
+    Overlay->PhysicalToVirtual         = PhysicalToVirtual;
+    Overlay->Context                   = Context;
+}
+
+/**
+ * @brief Copy a table of the source to a new table of the overlay
+ *
+ * @param Overlay
+ * @param Source
+ * @param PhysicalAddress The physical address of the new table
+ *
+ * @return UINT64 * The new table or NULL if there is no free table
+ */
+static UINT64 *
+EptpViewOverlayDuplicateTable(PEPTP_VIEW_OVERLAY Overlay, const UINT64 * Source, UINT64 * PhysicalAddress)
+{
+    UINT64 * Table;
+
+    if (Overlay->NumberOfTables >= Overlay->MaximumTables)
+    {
+        return NULL;
+    }
+
+    Table            = &Overlay->Tables[(UINT64)Overlay->NumberOfTables * EPTP_VIEW_TABLE_ENTRIES];
+    *PhysicalAddress = Overlay->TablesPhysicalAddress + (UINT64)Overlay->NumberOfTables * EPTP_VIEW_PAGE_SIZE;
+
+    for (UINT32 i = 0; i < EPTP_VIEW_TABLE_ENTRIES; i++)
+    {
+        Table[i] = Source[i];
+    }
+
+    Overlay->NumberOfTables++;
+
+    return Table;
+}
+
+/**
+ * @brief Rebuild the overlay as an exact view of the source EPT
+ * @details Only the root is duplicated, all of the other tables are shared
+ * with the source until an entry of the view is changed
+ *
+ * @param Overlay
+ * @param SourceRootPhysicalAddress The physical address of the root (PML4)
+ * of the source EPT
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptpViewOverlayReset(PEPTP_VIEW_OVERLAY Overlay, UINT64 SourceRootPhysicalAddress)
+{
+    UINT64 * SourceRoot;
+    UINT64   RootPhysicalAddress;
+
+    Overlay->NumberOfTables            = 0;
+    Overlay->SourceRootPhysicalAddress = SourceRootPhysicalAddress & EPTP_VIEW_ENTRY_ADDRESS;
+
+    SourceRoot = (UINT64 *)Overlay->PhysicalToVirtual(Overlay->SourceRootPhysicalAddress, Overlay->Context);
+
+    if (SourceRoot == NULL)
+    {
+        return FALSE;
+    }
+
+    return EptpViewOverlayDuplicateTable(Overlay, SourceRoot, &RootPhysicalAddress) != NULL;
+}
+
+/**
+ * @brief Set the entry of a 4 KB page in the overlay
+ * @details The shared tables on the path to the page are duplicated, the
+ * page should be mapped by a 4 KB entry in the source EPT (the hooked pages
+ * are always split)
+ *
+ * @param Overlay
+ * @param PhysicalAddress
+ * @param Entry The new entry of the page
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptpViewOverlaySetEntry(PEPTP_VIEW_OVERLAY Overlay, UINT64 PhysicalAddress, UINT64 Entry)
+{
+    UINT64 * CurrentTable = Overlay->Tables;
+    UINT64 * NextTable;
+    UINT64   NextTablePhysicalAddress;
+    UINT64   TablesEnd;
+    UINT32   Index;
+
+    if (Overlay->NumberOfTables == 0)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 Level = EPTP_VIEW_TABLE_LEVELS; Level > 1; Level--)
+    {
+        Index = (UINT32)(PhysicalAddress >> (12 + (Level - 1) * 9)) & (EPTP_VIEW_TABLE_ENTRIES - 1);
+
+        if (!(CurrentTable[Index] & EPTP_VIEW_ENTRY_PRESENT) ||
+            (Level != EPTP_VIEW_TABLE_LEVELS && (CurrentTable[Index] & EPTP_VIEW_ENTRY_LARGE_PAGE)))
+        {
+            //
+            // The page is not mapped by a 4 KB entry
+            //
+            return FALSE;
+        }
+
+        NextTablePhysicalAddress = CurrentTable[Index] & EPTP_VIEW_ENTRY_ADDRESS;
+        TablesEnd                = Overlay->TablesPhysicalAddress + (UINT64)Overlay->NumberOfTables * EPTP_VIEW_PAGE_SIZE;
+
+        if (NextTablePhysicalAddress >= Overlay->TablesPhysicalAddress && NextTablePhysicalAddress < TablesEnd)
+        {
+            //
+            // The table is already duplicated
+            //
+            NextTable = &Overlay->Tables[((NextTablePhysicalAddress - Overlay->TablesPhysicalAddress) / EPTP_VIEW_PAGE_SIZE) * EPTP_VIEW_TABLE_ENTRIES];
+        }
+        else
+        {
+            //
+            // The table is shared with the source, so it's duplicated before
+            // it's changed
+            //
+            NextTable = (UINT64 *)Overlay->PhysicalToVirtual(NextTablePhysicalAddress, Overlay->Context);
+
+            if (NextTable == NULL)
+            {
+                return FALSE;
+            }
+
+            NextTable = EptpViewOverlayDuplicateTable(Overlay, NextTable, &NextTablePhysicalAddress);
+
+            if (NextTable == NULL)
+            {
+                return FALSE;
+            }
+
+            CurrentTable[Index] = (CurrentTable[Index] & ~EPTP_VIEW_ENTRY_ADDRESS) | NextTablePhysicalAddress;
+        }
+
+        CurrentTable = NextTable;
+    }
+
+    CurrentTable[(PhysicalAddress >> 12) & (EPTP_VIEW_TABLE_ENTRIES - 1)] = Entry;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the leaf entry that maps a physical address
+ *
+ * @param RootPhysicalAddress The root (PML4) of the EPT
+ * @param PhysicalAddress
+ * @param PhysicalToVirtual
+ * @param Context
+ *
+ * @return UINT64 The leaf entry (4 KB, 2 MB or 1 GB) or 0 if the address
+ * is not mapped
+ */
+UINT64
+EptpViewTranslate(UINT64                                RootPhysicalAddress,
+                  UINT64                                PhysicalAddress,
+                  EPTP_VIEW_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual,
+                  PVOID                                 Context)
+{
+    UINT64 * Table = (UINT64 *)PhysicalToVirtual(RootPhysicalAddress & EPTP_VIEW_ENTRY_ADDRESS, Context);
+    UINT64   Entry;
+
+    for (UINT32 Level = EPTP_VIEW_TABLE_LEVELS; Level >= 1; Level--)
+    {
+        if (Table == NULL)
+        {
+            return 0;
+        }
+
+        Entry = Table[(PhysicalAddress >> (12 + (Level - 1) * 9)) & (EPTP_VIEW_TABLE_ENTRIES - 1)];
+
+        if (!(Entry & EPTP_VIEW_ENTRY_PRESENT))
+        {
+            return 0;
+        }
+
+        if (Level == 1 || (Level != EPTP_VIEW_TABLE_LEVELS && (Entry & EPTP_VIEW_ENTRY_LARGE_PAGE)))
+        {
+            return Entry;
+        }
+
+        Table = (UINT64 *)PhysicalToVirtual(Entry & EPTP_VIEW_ENTRY_ADDRESS, Context);
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file EptpView.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the EPTP list and the views of the hidden hooks
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The EPTP list is a 4 KB page of 512 EPT pointers (indexed by ECX
+ * of the VMFUNC 0)
+ *
+ */
+#define EPTP_VIEW_LIST_ENTRIES 512
+
+/**
+ * @brief The views of the hidden hooks in the EPTP list
+ *
+ */
+#define EPTP_VIEW_EXECUTE 0          // The hooked pages are execute-only and point to the fake pages
+#define EPTP_VIEW_READ    1          // The hooked pages are readable and point to the original pages
+#define EPTP_VIEW_COUNT   2
+#define EPTP_VIEW_NONE    0xffffffff // Not one of the views
+
+/**
+ * @brief Entries of the EPT paging structures
+ *
+ */
+#define EPTP_VIEW_TABLE_ENTRIES      512
+#define EPTP_VIEW_TABLE_LEVELS       4
+#define EPTP_VIEW_PAGE_SIZE          0x1000
+#define EPTP_VIEW_ENTRY_READ         0x1ull
+#define EPTP_VIEW_ENTRY_WRITE        0x2ull
+#define EPTP_VIEW_ENTRY_EXECUTE      0x4ull
+#define EPTP_VIEW_ENTRY_LARGE_PAGE   0x80ull
+#define EPTP_VIEW_ENTRY_USER_EXECUTE 0x400ull // Execute access of the user-mode addresses (MBEC)
+#define EPTP_VIEW_ENTRY_ADDRESS      0x000ffffffffff000ull
+#define EPTP_VIEW_ENTRY_PRESENT      (EPTP_VIEW_ENTRY_READ | EPTP_VIEW_ENTRY_WRITE | EPTP_VIEW_ENTRY_EXECUTE)
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that converts the physical address of a table of the
+ * source EPT to its virtual address
+ *
+ */
+typedef PVOID (*EPTP_VIEW_PHYSICAL_TO_VIRTUAL_CALLBACK)(UINT64 PhysicalAddress, PVOID Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The EPTP list of a core
+ *
+ */
+typedef struct _EPTP_VIEW_LIST
+{
+    UINT64 * Entries; // The page of the EPTP list
+    UINT64   PhysicalAddress;
+
+} EPTP_VIEW_LIST, *PEPTP_VIEW_LIST;
+
+/**
+ * @brief A view that shares the tables of a source EPT and only duplicates
+ * the tables on the path to the entries that are different in the view
+ * @details The tables of the overlay are physically contiguous pages that
+ * are allocated by the caller, the first one is the root (PML4) of the view
+ *
+ */
+typedef struct _EPTP_VIEW_OVERLAY
+{
+    UINT64 *                              Tables;                // Virtual address of the first table
+    UINT64                                TablesPhysicalAddress; // Physical address of the first table (the root)
+    UINT32                                MaximumTables;
+    UINT32                                NumberOfTables;        // Including the root
+    UINT64                                SourceRootPhysicalAddress;
+    EPTP_VIEW_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual;
+    PVOID                                 Context;
+
+} EPTP_VIEW_OVERLAY, *PEPTP_VIEW_OVERLAY;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+EptpViewListInitialize(PEPTP_VIEW_LIST List, UINT64 * Entries, UINT64 PhysicalAddress);
+
+BOOLEAN
+EptpViewListSet(PEPTP_VIEW_LIST List, UINT32 Index, UINT64 Eptp);
+
+UINT32
+EptpViewListFind(PEPTP_VIEW_LIST List, UINT64 Eptp);
+
+UINT64
+EptpViewGetEptp(UINT64 TemplateEptp, UINT64 RootPhysicalAddress);
+
+UINT32
+EptpViewGetTargetView(UINT32 CurrentView, BOOLEAN ReadAccess, BOOLEAN WriteAccess, BOOLEAN ExecuteAccess);
+
+UINT64
+EptpViewGetReadViewEntry(UINT64 OriginalEntry);
+
+VOID
+EptpViewOverlayInitialize(PEPTP_VIEW_OVERLAY                    Overlay,
+                          UINT64 *                              Tables,
+                          UINT64                                TablesPhysicalAddress,
+                          UINT32                                MaximumTables,
+                          EPTP_VIEW_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual,
+                          PVOID                                 Context);
+
+BOOLEAN
+EptpViewOverlayReset(PEPTP_VIEW_OVERLAY Overlay, UINT64 SourceRootPhysicalAddress);
+
+BOOLEAN
+EptpViewOverlaySetEntry(PEPTP_VIEW_OVERLAY Overlay, UINT64 PhysicalAddress, UINT64 Entry);
+
+UINT64
+EptpViewTranslate(UINT64                                RootPhysicalAddress,
+                  UINT64                                PhysicalAddress,
+                  EPTP_VIEW_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual,
+                  PVOID                                 Context);
@@ -0,0 +1,260 @@
+/**
+ * @file EventSampling.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The sampling policies of the events
+ * @details The policies decide which triggers of an event run its actions,
+ * they're evaluated in vmx-root on each trigger, so except for the first-N
+ * policy (which has a shared budget), all of the states are per-core and
+ * there is no contention between the cores:
+ *
+ *  - every-Nth: the first trigger and then each Nth trigger on each core
+ *  - probabilistic: each trigger with the probability of p
+ *  - token bucket: a token is added every given cycles (up to the burst) on
+ *    each core, and each trigger that runs the actions takes a token
+ *  - first-N: the first N triggers (of all of the cores), then the event is
+ *    disabled
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether the sampling policy is valid
+ *
+ * @param Policy
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventSamplingValidatePolicy(PDEBUGGER_EVENT_SAMPLING_POLICY Policy)
+{
+    switch (Policy->Type)
+    {
+    case DEBUGGER_EVENT_SAMPLING_TYPE_NONE:
+
+        return TRUE;
+
+    case DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH:
+    case DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N:
+
+        return Policy->Parameter1 != 0 && Policy->Parameter1 <= MAXLONG64;
+
+    case DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC:
+
+        return Policy->Parameter1 != 0 && Policy->Parameter1 <= EVENT_SAMPLING_PROBABILITY_ONE;
+
+    case DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET:
+
+        return Policy->Parameter1 != 0 && Policy->Parameter2 != 0 && Policy->Parameter2 <= EVENT_SAMPLING_MAXIMUM_BURST;
+
+    default:
+
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Initialize the sampling of an event
+ * @details The states of the cores are reset once they're used
+ *
+ * @param Sampling
+ * @param Policy A validated policy
+ * @param Slot The slot of the states of the cores
+ *
+ * @return VOID
+ */
+VOID
+EventSamplingInitialize(PEVENT_SAMPLING Sampling, PDEBUGGER_EVENT_SAMPLING_POLICY Policy, UINT32 Slot)
+{
+    memcpy(&Sampling->Policy, Policy, sizeof(DEBUGGER_EVENT_SAMPLING_POLICY));
+
+    Sampling->Slot = Slot;
+
+    EventSamplingReset(Sampling);
+}
+
+/**
+ * @brief Reset the shared state of the sampling (the budget of the
+ * first-N policy)
+ *
+ * @param Sampling
+ *
+ * @return VOID
+ */
+VOID
+EventSamplingReset(PEVENT_SAMPLING Sampling)
+{
+    Sampling->RemainingTriggers = Sampling->Policy.Type == DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N ? (LONG64)Sampling->Policy.Parameter1 : 0;
+}
+
+/**
+ * @brief Reset the state of the core for a new owner
+ *
+ * @param Sampling
+ * @param CoreState
+ * @param Owner
+ * @param CoreId
+ * @param Tsc
+ *
+ * @return VOID
+ */
+static VOID
+EventSamplingResetCoreState(PEVENT_SAMPLING            Sampling,
+                            PEVENT_SAMPLING_CORE_STATE CoreState,
+                            UINT64                     Owner,
+                            UINT32                     CoreId,
+                            UINT64                     Tsc)
+{
+    memset(CoreState, 0, sizeof(EVENT_SAMPLING_CORE_STATE));
+
+    CoreState->Owner = Owner;
+
+    //
+    // Each core has its own sequence of random numbers (never zero)
+    //
+    CoreState->RandomState = ((Owner + 1) * 0x9e3779b97f4a7c15ull) ^ ((CoreId + 1ull) * 0xbf58476d1ce4e5b9ull) ^ Tsc;
+
+    if (CoreState->RandomState == 0)
+    {
+        CoreState->RandomState = 0x2545f4914f6cdd1dull;
+    }
+
+    //
+    // The bucket is full at the start
+    //
+    CoreState->Tokens        = Sampling->Policy.Parameter2;
+    CoreState->LastRefillTsc = Tsc;
+}
+
+/**
+ * @brief Check whether the actions of an event should be run for the
+ * current trigger
+ *
+ * @param Sampling
+ * @param CoreState The sampling state of the event on the current core
+ * @param Owner Tag of the event
+ * @param CoreId
+ * @param Tsc The current TSC (only used by the token bucket)
+ *
+ * @return EVENT_SAMPLING_RESULT
+ */
+EVENT_SAMPLING_RESULT
+EventSamplingCheck(PEVENT_SAMPLING            Sampling,
+                   PEVENT_SAMPLING_CORE_STATE CoreState,
+                   UINT64                     Owner,
+                   UINT32                     CoreId,
+                   UINT64                     Tsc)
+{
+    EVENT_SAMPLING_RESULT Result = EVENT_SAMPLING_RESULT_SKIP;
+    UINT64                Elapsed;
+    UINT64                NewTokens;
+    LONG64                Remaining;
+
+    if (CoreState->Owner != Owner)
+    {
+        EventSamplingResetCoreState(Sampling, CoreState, Owner, CoreId, Tsc);
+    }
+
+    switch (Sampling->Policy.Type)
+    {
+    case DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH:
+
+        if (CoreState->Counter == 0)
+        {
+            Result = EVENT_SAMPLING_RESULT_TRIGGER;
+        }
+
+        CoreState->Counter = CoreState->Counter + 1 == Sampling->Policy.Parameter1 ? 0 : CoreState->Counter + 1;
+
+        break;
+
+    case DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC:
+
+        //
+        // xorshift64*
+        //
+        CoreState->RandomState ^= CoreState->RandomState >> 12;
+        CoreState->RandomState ^= CoreState->RandomState << 25;
+        CoreState->RandomState ^= CoreState->RandomState >> 27;
+
+        if (((CoreState->RandomState * 0x2545f4914f6cdd1dull) >> 32) < Sampling->Policy.Parameter1)
+        {
+            Result = EVENT_SAMPLING_RESULT_TRIGGER;
+        }
+
+        break;
+
+    case DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET:
+
+        Elapsed = Tsc - CoreState->LastRefillTsc;
+
+        if (Elapsed >= Sampling->Policy.Parameter1)
+        {
+            NewTokens = Elapsed / Sampling->Policy.Parameter1;
+
+            if (CoreState->Tokens + NewTokens >= Sampling->Policy.Parameter2)
+            {
+                //
+                // The bucket is full, the remaining time is not saved
+                //
+                CoreState->Tokens        = Sampling->Policy.Parameter2;
+                CoreState->LastRefillTsc = Tsc;
+            }
+            else
+            {
+                CoreState->Tokens += NewTokens;
+                CoreState->LastRefillTsc += NewTokens * Sampling->Policy.Parameter1;
+            }
+        }
+
+        if (CoreState->Tokens != 0)
+        {
+            CoreState->Tokens--;
+            Result = EVENT_SAMPLING_RESULT_TRIGGER;
+        }
+
+        break;
+
+    case DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N:
+
+        //
+        // The shared budget is only written while it's not exhausted
+        //
+        if (Sampling->RemainingTriggers > 0)
+        {
+            Remaining = InterlockedDecrement64(&Sampling->RemainingTriggers);
+
+            if (Remaining == 0)
+            {
+                Result = EVENT_SAMPLING_RESULT_TRIGGER_AND_DISABLE;
+            }
+            else if (Remaining > 0)
+            {
+                Result = EVENT_SAMPLING_RESULT_TRIGGER;
+            }
+        }
+
+        break;
+
+    default:
+
+        Result = EVENT_SAMPLING_RESULT_TRIGGER;
+
+        break;
+    }
+
+    if (Result == EVENT_SAMPLING_RESULT_SKIP)
+    {
+        CoreState->NumberOfSkipped++;
+    }
+    else
+    {
+        CoreState->NumberOfTriggered++;
+    }
+
+    return Result;
+}
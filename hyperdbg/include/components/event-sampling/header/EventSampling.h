@@ -0,0 +1,111 @@
+/**
+ * @file EventSampling.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the sampling policies of the events
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of the events that have a sampling policy (each of
+ * them uses a slot of the sampling state of all of the cores)
+ *
+ */
+#define EVENT_SAMPLING_MAXIMUM_EVENTS 32
+
+/**
+ * @brief The probability of the probabilistic policy is in 1/2^32
+ *
+ */
+#define EVENT_SAMPLING_PROBABILITY_ONE (1ull << 32)
+
+/**
+ * @brief Maximum tokens of the token bucket
+ *
+ */
+#define EVENT_SAMPLING_MAXIMUM_BURST 0x100000
+
+//////////////////////////////////////////////////
+//				    Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Result of sampling a trigger of an event
+ *
+ */
+typedef enum _EVENT_SAMPLING_RESULT
+{
+    EVENT_SAMPLING_RESULT_SKIP = 0,
+    EVENT_SAMPLING_RESULT_TRIGGER,
+    EVENT_SAMPLING_RESULT_TRIGGER_AND_DISABLE, // The last trigger of the first-N policy
+
+} EVENT_SAMPLING_RESULT;
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The sampling state of an event on a core
+ * @details The state belongs to the event whose tag is the owner, once the
+ * slot is used by another event, the state is reset by the core itself, so
+ * the states are never touched by the other cores
+ *
+ */
+typedef struct _EVENT_SAMPLING_CORE_STATE
+{
+    UINT64 Owner;         // Tag of the event
+    UINT64 Counter;       // Triggers since the last sampled trigger (every-Nth)
+    UINT64 RandomState;   // Probabilistic
+    UINT64 Tokens;        // Token bucket
+    UINT64 LastRefillTsc; // Token bucket
+
+    //
+    // Statistics
+    //
+    UINT64 NumberOfTriggered;
+    UINT64 NumberOfSkipped;
+    UINT64 Reserved; // Keeps the state in a separate cache line
+
+} EVENT_SAMPLING_CORE_STATE, *PEVENT_SAMPLING_CORE_STATE;
+
+/**
+ * @brief The sampling of an event (shared between the cores)
+ *
+ */
+typedef struct _EVENT_SAMPLING
+{
+    DEBUGGER_EVENT_SAMPLING_POLICY Policy;
+    UINT32                         Slot;              // Index of the sampling state of the cores
+    volatile LONG64                RemainingTriggers; // First-N
+
+} EVENT_SAMPLING, *PEVENT_SAMPLING;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+EventSamplingValidatePolicy(PDEBUGGER_EVENT_SAMPLING_POLICY Policy);
+
+VOID
+EventSamplingInitialize(PEVENT_SAMPLING Sampling, PDEBUGGER_EVENT_SAMPLING_POLICY Policy, UINT32 Slot);
+
+VOID
+EventSamplingReset(PEVENT_SAMPLING Sampling);
+
+EVENT_SAMPLING_RESULT
+EventSamplingCheck(PEVENT_SAMPLING            Sampling,
+                   PEVENT_SAMPLING_CORE_STATE CoreState,
+                   UINT64                     Owner,
+                   UINT32                     CoreId,
+                   UINT64                     Tsc);
@@ -0,0 +1,472 @@
+/**
+ * @file EventTraceRecorder.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Binary event trace recorder, writer, and query routines
+ * @details Records are collected into per-core blocks, each block keeps a
+ * summary (core, TSC range, and a bloom filter of tags) in its header. Blocks
+ * are appended back-to-back after the file header, so an index of the block
+ * headers lets queries skip the blocks that cannot match without touching
+ * their records
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Name of the general-purpose registers based on the GUEST_REGS order
+ *
+ */
+static const CHAR * EventTraceRegisterNames[EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS] = {
+    "rax",
+    "rcx",
+    "rdx",
+    "rbx",
+    "rsp",
+    "rbp",
+    "rsi",
+    "rdi",
+    "r8",
+    "r9",
+    "r10",
+    "r11",
+    "r12",
+    "r13",
+    "r14",
+    "r15"};
+
+/**
+ * @brief Compute the bit of the tag in the bloom filter of blocks
+ *
+ * @param Tag
+ *
+ * @return UINT64
+ */
+UINT64
+EventTraceComputeTagFilter(UINT64 Tag)
+{
+    //
+    // Fibonacci hashing, the top 6 bits select the bit of the filter
+    //
+    return 1ull << ((Tag * 0x9E3779B97F4A7C15ull) >> 58);
+}
+
+/**
+ * @brief Get the index of a register (in GUEST_REGS) by its name
+ *
+ * @param Name
+ * @param RegisterId
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceGetRegisterIdByName(const CHAR * Name, UINT8 * RegisterId)
+{
+    for (UINT8 i = 0; i < EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS; i++)
+    {
+        const CHAR * RegisterName = EventTraceRegisterNames[i];
+        UINT32       j            = 0;
+
+        while (Name[j] != '\0' && RegisterName[j] != '\0')
+        {
+            CHAR Ch = Name[j];
+
+            if (Ch >= 'A' && Ch <= 'Z')
+            {
+                Ch = Ch - 'A' + 'a';
+            }
+
+            if (Ch != RegisterName[j])
+            {
+                break;
+            }
+
+            j++;
+        }
+
+        if (Name[j] == '\0' && RegisterName[j] == '\0')
+        {
+            *RegisterId = i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the name of a register by its index (in GUEST_REGS)
+ *
+ * @param RegisterId
+ *
+ * @return const CHAR *
+ */
+const CHAR *
+EventTraceGetRegisterName(UINT8 RegisterId)
+{
+    if (RegisterId >= EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS)
+    {
+        return "?";
+    }
+
+    return EventTraceRegisterNames[RegisterId];
+}
+
+/**
+ * @brief Reset a block for collecting new records of a core
+ *
+ * @param Block
+ * @param Core
+ *
+ * @return VOID
+ */
+VOID
+EventTraceInitializeBlock(PEVENT_TRACE_BLOCK Block, UINT16 Core)
+{
+    memset(&Block->Header, 0, sizeof(EVENT_TRACE_BLOCK_HEADER));
+
+    Block->Header.Magic      = EVENT_TRACE_BLOCK_MAGIC;
+    Block->Header.Core       = Core;
+    Block->Header.MinimumTsc = ~0ull;
+}
+
+/**
+ * @brief Add a record to the block and update the summary of the block
+ * @details The block should not be full
+ *
+ * @param Block
+ * @param Record
+ *
+ * @return BOOLEAN TRUE if the block is full after adding the record
+ */
+BOOLEAN
+EventTraceAddRecordToBlock(PEVENT_TRACE_BLOCK Block, const EVENT_TRACE_RECORD * Record)
+{
+    EVENT_TRACE_BLOCK_HEADER * Header = &Block->Header;
+
+    memcpy(&Block->Records[Header->NumberOfRecords], Record, sizeof(EVENT_TRACE_RECORD));
+
+    Header->NumberOfRecords++;
+    Header->TagFilter |= EventTraceComputeTagFilter(Record->Tag);
+
+    if (Record->Tsc < Header->MinimumTsc)
+    {
+        Header->MinimumTsc = Record->Tsc;
+    }
+
+    if (Record->Tsc > Header->MaximumTsc)
+    {
+        Header->MaximumTsc = Record->Tsc;
+    }
+
+    return Header->NumberOfRecords >= EVENT_TRACE_MAXIMUM_RECORDS_PER_BLOCK;
+}
+
+/**
+ * @brief Get the length of the used part of a block (header and records)
+ *
+ * @param BlockHeader
+ *
+ * @return UINT32
+ */
+UINT32
+EventTraceGetBlockLength(const EVENT_TRACE_BLOCK_HEADER * BlockHeader)
+{
+    return sizeof(EVENT_TRACE_BLOCK_HEADER) + (UINT32)BlockHeader->NumberOfRecords * sizeof(EVENT_TRACE_RECORD);
+}
+
+/**
+ * @brief Validate a block that is received (or read from a file)
+ *
+ * @param Buffer
+ * @param BufferLength The available length of the buffer
+ * @param BlockLength The length of the block
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceValidateBlock(const VOID * Buffer, UINT64 BufferLength, UINT32 * BlockLength)
+{
+    EVENT_TRACE_BLOCK_HEADER Header;
+
+    if (BufferLength < sizeof(EVENT_TRACE_BLOCK_HEADER))
+    {
+        return FALSE;
+    }
+
+    //
+    // The buffer might not be aligned
+    //
+    memcpy(&Header, Buffer, sizeof(EVENT_TRACE_BLOCK_HEADER));
+
+    if (Header.Magic != EVENT_TRACE_BLOCK_MAGIC ||
+        Header.NumberOfRecords > EVENT_TRACE_MAXIMUM_RECORDS_PER_BLOCK ||
+        EventTraceGetBlockLength(&Header) > BufferLength)
+    {
+        return FALSE;
+    }
+
+    *BlockLength = EventTraceGetBlockLength(&Header);
+
+    return TRUE;
+}
+
+/**
+ * @brief Initialize the header of an empty event trace file
+ *
+ * @param FileHeader
+ *
+ * @return VOID
+ */
+VOID
+EventTraceInitializeFileHeader(PEVENT_TRACE_FILE_HEADER FileHeader)
+{
+    memset(FileHeader, 0, sizeof(EVENT_TRACE_FILE_HEADER));
+
+    FileHeader->Magic           = EVENT_TRACE_FILE_MAGIC;
+    FileHeader->Version         = EVENT_TRACE_FILE_VERSION;
+    FileHeader->RecordSize      = sizeof(EVENT_TRACE_RECORD);
+    FileHeader->BlockHeaderSize = sizeof(EVENT_TRACE_BLOCK_HEADER);
+    FileHeader->MinimumTsc      = ~0ull;
+}
+
+/**
+ * @brief Validate the header of an event trace file
+ *
+ * @param FileBuffer
+ * @param FileSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceValidateFileHeader(const UINT8 * FileBuffer, UINT64 FileSize)
+{
+    const EVENT_TRACE_FILE_HEADER * FileHeader = (const EVENT_TRACE_FILE_HEADER *)FileBuffer;
+
+    if (FileSize < sizeof(EVENT_TRACE_FILE_HEADER))
+    {
+        return FALSE;
+    }
+
+    return FileHeader->Magic == EVENT_TRACE_FILE_MAGIC &&
+           FileHeader->Version == EVENT_TRACE_FILE_VERSION &&
+           FileHeader->RecordSize == sizeof(EVENT_TRACE_RECORD) &&
+           FileHeader->BlockHeaderSize == sizeof(EVENT_TRACE_BLOCK_HEADER) &&
+           FileHeader->DataSize <= FileSize - sizeof(EVENT_TRACE_FILE_HEADER);
+}
+
+/**
+ * @brief Append a block to the end of the (mapped) event trace file and
+ * update the file header
+ * @details The file buffer starts with an initialized file header, the
+ * caller should grow the buffer if the block does not fit
+ *
+ * @param FileBuffer
+ * @param FileBufferSize
+ * @param Block
+ * @param BlockLength
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceAppendBlock(UINT8 * FileBuffer, UINT64 FileBufferSize, const VOID * Block, UINT32 BlockLength)
+{
+    EVENT_TRACE_FILE_HEADER * FileHeader = (EVENT_TRACE_FILE_HEADER *)FileBuffer;
+    EVENT_TRACE_BLOCK_HEADER  Header;
+    UINT32                    ValidatedLength = 0;
+    UINT64                    Offset          = sizeof(EVENT_TRACE_FILE_HEADER) + FileHeader->DataSize;
+
+    if (!EventTraceValidateBlock(Block, BlockLength, &ValidatedLength) ||
+        Offset + ValidatedLength > FileBufferSize)
+    {
+        return FALSE;
+    }
+
+    memcpy(&Header, Block, sizeof(EVENT_TRACE_BLOCK_HEADER));
+    memcpy(FileBuffer + Offset, Block, ValidatedLength);
+
+    FileHeader->NumberOfBlocks++;
+    FileHeader->NumberOfRecords += Header.NumberOfRecords;
+    FileHeader->NumberOfDroppedRecords += Header.NumberOfDroppedRecords;
+    FileHeader->DataSize += ValidatedLength;
+
+    if ((UINT32)Header.Core + 1 > FileHeader->NumberOfCores)
+    {
+        FileHeader->NumberOfCores = Header.Core + 1;
+    }
+
+    if (Header.NumberOfRecords != 0)
+    {
+        if (Header.MinimumTsc < FileHeader->MinimumTsc)
+        {
+            FileHeader->MinimumTsc = Header.MinimumTsc;
+        }
+
+        if (Header.MaximumTsc > FileHeader->MaximumTsc)
+        {
+            FileHeader->MaximumTsc = Header.MaximumTsc;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Build the index of the blocks of an event trace file
+ * @details If Entries is NULL, only the number of blocks is computed
+ *
+ * @param FileBuffer
+ * @param FileSize
+ * @param Entries
+ * @param MaximumNumberOfEntries
+ * @param NumberOfEntries
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceBuildIndex(const UINT8 *             FileBuffer,
+                     UINT64                    FileSize,
+                     EVENT_TRACE_INDEX_ENTRY * Entries,
+                     UINT64                    MaximumNumberOfEntries,
+                     UINT64 *                  NumberOfEntries)
+{
+    const EVENT_TRACE_FILE_HEADER * FileHeader = (const EVENT_TRACE_FILE_HEADER *)FileBuffer;
+    UINT64                          Offset     = sizeof(EVENT_TRACE_FILE_HEADER);
+    UINT64                          End        = 0;
+    UINT64                          Count      = 0;
+    UINT32                          BlockLength;
+
+    if (!EventTraceValidateFileHeader(FileBuffer, FileSize))
+    {
+        return FALSE;
+    }
+
+    End = Offset + FileHeader->DataSize;
+
+    while (Offset < End)
+    {
+        if (!EventTraceValidateBlock(FileBuffer + Offset, End - Offset, &BlockLength))
+        {
+            return FALSE;
+        }
+
+        if (Entries != NULL)
+        {
+            if (Count >= MaximumNumberOfEntries)
+            {
+                return FALSE;
+            }
+
+            Entries[Count].Offset = Offset;
+            memcpy(&Entries[Count].Header, FileBuffer + Offset, sizeof(EVENT_TRACE_BLOCK_HEADER));
+        }
+
+        Count++;
+        Offset += BlockLength;
+    }
+
+    *NumberOfEntries = Count;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether the summary of a block might match the query
+ *
+ * @param Header
+ * @param Query
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EventTraceIsBlockMatched(const EVENT_TRACE_BLOCK_HEADER * Header, const EVENT_TRACE_QUERY * Query)
+{
+    if (Header->NumberOfRecords == 0)
+    {
+        return FALSE;
+    }
+
+    if (Query->FilterByCore && Header->Core != Query->Core)
+    {
+        return FALSE;
+    }
+
+    if (Header->MaximumTsc < Query->MinimumTsc || Header->MinimumTsc > Query->MaximumTsc)
+    {
+        return FALSE;
+    }
+
+    if (Query->FilterByTag && (Header->TagFilter & EventTraceComputeTagFilter(Query->Tag)) == 0)
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Query the records of an indexed event trace file
+ * @details Records are visited in the order of blocks in the file, and the
+ * records of each core are in the order of recording
+ *
+ * @param FileBuffer
+ * @param Entries
+ * @param NumberOfEntries
+ * @param Query
+ * @param Callback
+ * @param Context
+ * @param Result
+ *
+ * @return BOOLEAN FALSE if the callback stopped the query
+ */
+BOOLEAN
+EventTraceQuery(const UINT8 *                   FileBuffer,
+                const EVENT_TRACE_INDEX_ENTRY * Entries,
+                UINT64                          NumberOfEntries,
+                const EVENT_TRACE_QUERY *       Query,
+                EVENT_TRACE_QUERY_CALLBACK      Callback,
+                PVOID                           Context,
+                PEVENT_TRACE_QUERY_RESULT       Result)
+{
+    EVENT_TRACE_RECORD Record;
+
+    memset(Result, 0, sizeof(EVENT_TRACE_QUERY_RESULT));
+
+    for (UINT64 i = 0; i < NumberOfEntries; i++)
+    {
+        const UINT8 * Records = FileBuffer + Entries[i].Offset + sizeof(EVENT_TRACE_BLOCK_HEADER);
+
+        if (!EventTraceIsBlockMatched(&Entries[i].Header, Query))
+        {
+            Result->NumberOfSkippedBlocks++;
+            continue;
+        }
+
+        Result->NumberOfVisitedBlocks++;
+
+        for (UINT32 j = 0; j < Entries[i].Header.NumberOfRecords; j++)
+        {
+            memcpy(&Record, Records + (UINT64)j * sizeof(EVENT_TRACE_RECORD), sizeof(EVENT_TRACE_RECORD));
+
+            Result->NumberOfVisitedRecords++;
+
+            if ((Query->FilterByTag && Record.Tag != Query->Tag) ||
+                Record.Tsc < Query->MinimumTsc ||
+                Record.Tsc > Query->MaximumTsc)
+            {
+                continue;
+            }
+
+            Result->NumberOfMatchedRecords++;
+
+            if (!Callback(&Record, Context))
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    return TRUE;
+}
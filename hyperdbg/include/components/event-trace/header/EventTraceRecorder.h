@@ -0,0 +1,118 @@
+/**
+ * @file EventTraceRecorder.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the binary event trace recorder, writer, and query routines
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Entry of the index of the blocks of an event trace file
+ *
+ */
+typedef struct _EVENT_TRACE_INDEX_ENTRY
+{
+    UINT64                   Offset; // offset of the block from the start of the file
+    EVENT_TRACE_BLOCK_HEADER Header;
+
+} EVENT_TRACE_INDEX_ENTRY, *PEVENT_TRACE_INDEX_ENTRY;
+
+/**
+ * @brief Filters of a query over an event trace file
+ * @details The TSC range is inclusive
+ *
+ */
+typedef struct _EVENT_TRACE_QUERY
+{
+    BOOLEAN FilterByTag;
+    BOOLEAN FilterByCore;
+    UINT16  Core;
+    UINT64  Tag;
+    UINT64  MinimumTsc;
+    UINT64  MaximumTsc;
+
+} EVENT_TRACE_QUERY, *PEVENT_TRACE_QUERY;
+
+/**
+ * @brief Statistics of a query over an event trace file
+ *
+ */
+typedef struct _EVENT_TRACE_QUERY_RESULT
+{
+    UINT64 NumberOfVisitedBlocks;
+    UINT64 NumberOfSkippedBlocks;
+    UINT64 NumberOfVisitedRecords;
+    UINT64 NumberOfMatchedRecords;
+
+} EVENT_TRACE_QUERY_RESULT, *PEVENT_TRACE_QUERY_RESULT;
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that receives each of the matched records, returning
+ * FALSE stops the query
+ *
+ */
+typedef BOOLEAN (*EVENT_TRACE_QUERY_CALLBACK)(const EVENT_TRACE_RECORD * Record,
+                                              PVOID                      Context);
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+UINT64
+EventTraceComputeTagFilter(UINT64 Tag);
+
+BOOLEAN
+EventTraceGetRegisterIdByName(const CHAR * Name, UINT8 * RegisterId);
+
+const CHAR *
+EventTraceGetRegisterName(UINT8 RegisterId);
+
+VOID
+EventTraceInitializeBlock(PEVENT_TRACE_BLOCK Block, UINT16 Core);
+
+BOOLEAN
+EventTraceAddRecordToBlock(PEVENT_TRACE_BLOCK Block, const EVENT_TRACE_RECORD * Record);
+
+UINT32
+EventTraceGetBlockLength(const EVENT_TRACE_BLOCK_HEADER * BlockHeader);
+
+BOOLEAN
+EventTraceValidateBlock(const VOID * Buffer, UINT64 BufferLength, UINT32 * BlockLength);
+
+VOID
+EventTraceInitializeFileHeader(PEVENT_TRACE_FILE_HEADER FileHeader);
+
+BOOLEAN
+EventTraceValidateFileHeader(const UINT8 * FileBuffer, UINT64 FileSize);
+
+BOOLEAN
+EventTraceAppendBlock(UINT8 * FileBuffer, UINT64 FileBufferSize, const VOID * Block, UINT32 BlockLength);
+
+BOOLEAN
+EventTraceBuildIndex(const UINT8 *             FileBuffer,
+                     UINT64                    FileSize,
+                     EVENT_TRACE_INDEX_ENTRY * Entries,
+                     UINT64                    MaximumNumberOfEntries,
+                     UINT64 *                  NumberOfEntries);
+
+BOOLEAN
+EventTraceQuery(const UINT8 *                   FileBuffer,
+                const EVENT_TRACE_INDEX_ENTRY * Entries,
+                UINT64                          NumberOfEntries,
+                const EVENT_TRACE_QUERY *       Query,
+                EVENT_TRACE_QUERY_CALLBACK      Callback,
+                PVOID                           Context,
+                PEVENT_TRACE_QUERY_RESULT       Result);
@@ -0,0 +1,272 @@
+/**
+ * @file HookBatch.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The grouping of the targets of the batches of EPT hooks
+ * @details The targets of a batch are sorted once by their physical
+ * addresses, so the targets of each 4 KB page are contiguous, the large
+ * pages (and the 1 GB regions) that should be split are found in a single
+ * pass over the pages, and a target is found by a binary search instead of
+ * walking the list of the hooked pages for each target
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Compare two targets (by the physical address and then the virtual
+ * address)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return INT32 Negative, zero or positive
+ */
+static INT32
+HookBatchCompareTargets(const HOOK_BATCH_TARGET * First, const HOOK_BATCH_TARGET * Second)
+{
+    if (First->PhysicalAddress != Second->PhysicalAddress)
+    {
+        return First->PhysicalAddress < Second->PhysicalAddress ? -1 : 1;
+    }
+
+    if (First->VirtualAddress != Second->VirtualAddress)
+    {
+        return First->VirtualAddress < Second->VirtualAddress ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Move a target down the heap until its children are not greater
+ *
+ * @param Targets
+ * @param Root
+ * @param NumberOfTargets
+ *
+ * @return VOID
+ */
+static VOID
+HookBatchSiftDown(PHOOK_BATCH_TARGET Targets, UINT32 Root, UINT32 NumberOfTargets)
+{
+    HOOK_BATCH_TARGET Temp;
+    UINT32            Child;
+
+    while ((Child = 2 * Root + 1) < NumberOfTargets)
+    {
+        if (Child + 1 < NumberOfTargets && HookBatchCompareTargets(&Targets[Child], &Targets[Child + 1]) < 0)
+        {
+            Child++;
+        }
+
+        if (HookBatchCompareTargets(&Targets[Root], &Targets[Child]) >= 0)
+        {
+            return;
+        }
+
+        Temp           = Targets[Root];
+        Targets[Root]  = Targets[Child];
+        Targets[Child] = Temp;
+        Root           = Child;
+    }
+}
+
+/**
+ * @brief Sort the targets and remove the duplicated targets
+ * @details The heap sort doesn't need any memory, so it's usable in vmx-root
+ *
+ * @param Targets
+ * @param NumberOfTargets
+ *
+ * @return UINT32 The count of the unique targets
+ */
+UINT32
+HookBatchSortTargets(PHOOK_BATCH_TARGET Targets, UINT32 NumberOfTargets)
+{
+    HOOK_BATCH_TARGET Temp;
+    UINT32            Count;
+
+    if (NumberOfTargets == 0)
+    {
+        return 0;
+    }
+
+    for (UINT32 i = NumberOfTargets / 2; i-- > 0;)
+    {
+        HookBatchSiftDown(Targets, i, NumberOfTargets);
+    }
+
+    for (UINT32 i = NumberOfTargets - 1; i > 0; i--)
+    {
+        Temp       = Targets[0];
+        Targets[0] = Targets[i];
+        Targets[i] = Temp;
+
+        HookBatchSiftDown(Targets, 0, i);
+    }
+
+    Count = 1;
+
+    for (UINT32 i = 1; i < NumberOfTargets; i++)
+    {
+        if (HookBatchCompareTargets(&Targets[Count - 1], &Targets[i]) != 0)
+        {
+            Targets[Count++] = Targets[i];
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Group the sorted targets by their 4 KB pages
+ *
+ * @param Targets The sorted targets
+ * @param NumberOfTargets
+ * @param Pages The pages (the buffer should have room for a page for each
+ * target)
+ *
+ * @return UINT32 The count of the pages
+ */
+UINT32
+HookBatchGroupByPage(const HOOK_BATCH_TARGET * Targets, UINT32 NumberOfTargets, PHOOK_BATCH_PAGE Pages)
+{
+    UINT32 Count = 0;
+    UINT64 PhysicalBaseAddress;
+
+    for (UINT32 i = 0; i < NumberOfTargets; i++)
+    {
+        PhysicalBaseAddress = Targets[i].PhysicalAddress & ~(HOOK_BATCH_PAGE_SIZE - 1);
+
+        if (Count != 0 && Pages[Count - 1].PhysicalBaseAddress == PhysicalBaseAddress)
+        {
+            Pages[Count - 1].NumberOfTargets++;
+            continue;
+        }
+
+        Pages[Count].PhysicalBaseAddress = PhysicalBaseAddress;
+        Pages[Count].FirstTarget         = i;
+        Pages[Count].NumberOfTargets     = 1;
+        Count++;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Get the unique aligned pages (e.g., the 2 MB pages that should be
+ * split) of the sorted pages
+ *
+ * @param Pages The sorted pages
+ * @param NumberOfPages
+ * @param Alignment A power of two
+ * @param AlignedPages The base addresses of the aligned pages (the buffer
+ * should have room for an aligned page for each page)
+ *
+ * @return UINT32 The count of the aligned pages
+ */
+UINT32
+HookBatchGetAlignedPages(const HOOK_BATCH_PAGE * Pages, UINT32 NumberOfPages, UINT64 Alignment, UINT64 * AlignedPages)
+{
+    UINT32 Count = 0;
+    UINT64 BaseAddress;
+
+    for (UINT32 i = 0; i < NumberOfPages; i++)
+    {
+        BaseAddress = Pages[i].PhysicalBaseAddress & ~(Alignment - 1);
+
+        if (Count == 0 || AlignedPages[Count - 1] != BaseAddress)
+        {
+            AlignedPages[Count++] = BaseAddress;
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Find a page in the sorted pages
+ *
+ * @param Pages The sorted pages
+ * @param NumberOfPages
+ * @param PhysicalBaseAddress
+ *
+ * @return UINT32 Index of the page or NumberOfPages if it's not found
+ */
+UINT32
+HookBatchFindPage(const HOOK_BATCH_PAGE * Pages, UINT32 NumberOfPages, UINT64 PhysicalBaseAddress)
+{
+    UINT32 Low  = 0;
+    UINT32 High = NumberOfPages;
+    UINT32 Middle;
+
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (Pages[Middle].PhysicalBaseAddress == PhysicalBaseAddress)
+        {
+            return Middle;
+        }
+
+        if (Pages[Middle].PhysicalBaseAddress < PhysicalBaseAddress)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return NumberOfPages;
+}
+
+/**
+ * @brief Check whether a target is in the sorted targets
+ *
+ * @param Targets The sorted targets
+ * @param NumberOfTargets
+ * @param PhysicalAddress
+ * @param VirtualAddress
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+HookBatchFindTarget(const HOOK_BATCH_TARGET * Targets, UINT32 NumberOfTargets, UINT64 PhysicalAddress, UINT64 VirtualAddress)
+{
+    HOOK_BATCH_TARGET Target;
+    UINT32            Low  = 0;
+    UINT32            High = NumberOfTargets;
+    UINT32            Middle;
+    INT32             Result;
+
+    Target.PhysicalAddress = PhysicalAddress;
+    Target.VirtualAddress  = VirtualAddress;
+
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+        Result = HookBatchCompareTargets(&Targets[Middle], &Target);
+
+        if (Result == 0)
+        {
+            return TRUE;
+        }
+
+        if (Result < 0)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return FALSE;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file HookBatch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the grouping of the targets of the batches of EPT hooks
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Sizes of the pages that the targets are grouped by
+ *
+ */
+#define HOOK_BATCH_PAGE_SIZE       0x1000ull
+#define HOOK_BATCH_LARGE_PAGE_SIZE 0x200000ull
+#define HOOK_BATCH_REGION_SIZE     0x40000000ull
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A target of a batch
+ *
+ */
+typedef struct _HOOK_BATCH_TARGET
+{
+    UINT64 VirtualAddress;
+    UINT64 PhysicalAddress; // Translated by the caller (zero if the targets are only found by the virtual addresses)
+
+} HOOK_BATCH_TARGET, *PHOOK_BATCH_TARGET;
+
+/**
+ * @brief The targets of a batch on a 4 KB page
+ *
+ */
+typedef struct _HOOK_BATCH_PAGE
+{
+    UINT64 PhysicalBaseAddress;
+    UINT32 FirstTarget; // Index of the first target of the page in the sorted targets
+    UINT32 NumberOfTargets;
+
+} HOOK_BATCH_PAGE, *PHOOK_BATCH_PAGE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+UINT32
+HookBatchSortTargets(PHOOK_BATCH_TARGET Targets, UINT32 NumberOfTargets);
+
+UINT32
+HookBatchGroupByPage(const HOOK_BATCH_TARGET * Targets, UINT32 NumberOfTargets, PHOOK_BATCH_PAGE Pages);
+
+UINT32
+HookBatchGetAlignedPages(const HOOK_BATCH_PAGE * Pages, UINT32 NumberOfPages, UINT64 Alignment, UINT64 * AlignedPages);
+
+UINT32
+HookBatchFindPage(const HOOK_BATCH_PAGE * Pages, UINT32 NumberOfPages, UINT64 PhysicalBaseAddress);
+
+BOOLEAN
+HookBatchFindTarget(const HOOK_BATCH_TARGET * Targets, UINT32 NumberOfTargets, UINT64 PhysicalAddress, UINT64 VirtualAddress);
@@ -0,0 +1,289 @@
+/**
+ * @file HwdbgScriptPacking.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Bit-level packing of the hwdbg script buffer
+ * @details Each symbol of the short symbol buffer is stored as a
+ * HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH bit type followed by a value of the
+ * script variable length of the instance. Symbols are laid out back-to-back
+ * (LSB first) over the BRAM words and each BRAM word keeps using
+ * ceil(BramDataWidth / 8) bytes, the same as the byte-level compression
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether the widths of the instance can be used for packing
+ *
+ * @param ScriptVariableLength
+ * @param BramDataWidth
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+HwdbgScriptPackingCheckWidths(UINT32 ScriptVariableLength, UINT32 BramDataWidth)
+{
+    return ScriptVariableLength >= 8 && ScriptVariableLength <= 64 && BramDataWidth >= 8;
+}
+
+/**
+ * @brief Get the bit position of a bit of the stream within the buffer
+ *
+ * @param BitIndex
+ * @param BramDataWidth
+ * @param ByteIndex
+ * @param BitInByte
+ *
+ * @return VOID
+ */
+static VOID
+HwdbgScriptPackingLocateBit(UINT64 BitIndex, UINT32 BramDataWidth, size_t * ByteIndex, UINT32 * BitInByte)
+{
+    UINT64 WordIndex = BitIndex / BramDataWidth;
+    UINT32 BitInWord = (UINT32)(BitIndex % BramDataWidth);
+
+    *ByteIndex = (size_t)(WordIndex * ((BramDataWidth + 7) / 8)) + (BitInWord / 8);
+    *BitInByte = BitInWord % 8;
+}
+
+/**
+ * @brief Write a field into the bit stream
+ *
+ * @param Buffer
+ * @param BitIndex
+ * @param BramDataWidth
+ * @param Field
+ * @param Width
+ *
+ * @return VOID
+ */
+static VOID
+HwdbgScriptPackingWriteField(UINT8 * Buffer, UINT64 BitIndex, UINT32 BramDataWidth, UINT64 Field, UINT32 Width)
+{
+    size_t ByteIndex;
+    UINT32 BitInByte;
+
+    for (UINT32 i = 0; i < Width; i++)
+    {
+        HwdbgScriptPackingLocateBit(BitIndex + i, BramDataWidth, &ByteIndex, &BitInByte);
+
+        if ((Field >> i) & 1)
+        {
+            Buffer[ByteIndex] |= (UINT8)(1 << BitInByte);
+        }
+    }
+}
+
+/**
+ * @brief Read a field from the bit stream
+ *
+ * @param Buffer
+ * @param BitIndex
+ * @param BramDataWidth
+ * @param Width
+ *
+ * @return UINT64
+ */
+static UINT64
+HwdbgScriptPackingReadField(const UINT8 * Buffer, UINT64 BitIndex, UINT32 BramDataWidth, UINT32 Width)
+{
+    UINT64 Field = 0;
+    size_t ByteIndex;
+    UINT32 BitInByte;
+
+    for (UINT32 i = 0; i < Width; i++)
+    {
+        HwdbgScriptPackingLocateBit(BitIndex + i, BramDataWidth, &ByteIndex, &BitInByte);
+
+        if ((Buffer[ByteIndex] >> BitInByte) & 1)
+        {
+            Field |= 1ull << i;
+        }
+    }
+
+    return Field;
+}
+
+/**
+ * @brief Get the number of bits that each symbol takes in the packed buffer
+ *
+ * @param ScriptVariableLength
+ *
+ * @return UINT32
+ */
+UINT32
+HwdbgScriptPackingGetSymbolWidth(UINT32 ScriptVariableLength)
+{
+    return HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH + ScriptVariableLength;
+}
+
+/**
+ * @brief Compute the size of the packed buffer (in bytes)
+ *
+ * @param NumberOfSymbols
+ * @param ScriptVariableLength
+ * @param BramDataWidth
+ *
+ * @return size_t
+ */
+size_t
+HwdbgScriptPackingComputePackedSize(UINT32 NumberOfSymbols, UINT32 ScriptVariableLength, UINT32 BramDataWidth)
+{
+    UINT64 NumberOfBits  = (UINT64)NumberOfSymbols * HwdbgScriptPackingGetSymbolWidth(ScriptVariableLength);
+    UINT64 NumberOfWords = (NumberOfBits + BramDataWidth - 1) / BramDataWidth;
+
+    return (size_t)(NumberOfWords * ((BramDataWidth + 7) / 8));
+}
+
+/**
+ * @brief Pack the short symbol buffer into the bit-packed buffer
+ * @details The value of each symbol is truncated to the script variable
+ * length (the same as the registers of the hardware), but types that do
+ * not fit into HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH bits are rejected
+ *
+ * @param Symbols
+ * @param NumberOfSymbols
+ * @param ScriptVariableLength
+ * @param BramDataWidth
+ * @param PackedBuffer
+ * @param PackedBufferSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+HwdbgScriptPackingPackSymbols(const HWDBG_SHORT_SYMBOL * Symbols,
+                              UINT32                     NumberOfSymbols,
+                              UINT32                     ScriptVariableLength,
+                              UINT32                     BramDataWidth,
+                              UINT8 *                    PackedBuffer,
+                              size_t                     PackedBufferSize)
+{
+    UINT32 SymbolWidth = HwdbgScriptPackingGetSymbolWidth(ScriptVariableLength);
+    UINT64 ValueMask   = ScriptVariableLength == 64 ? ~0ull : (1ull << ScriptVariableLength) - 1;
+
+    if (!HwdbgScriptPackingCheckWidths(ScriptVariableLength, BramDataWidth) ||
+        PackedBufferSize < HwdbgScriptPackingComputePackedSize(NumberOfSymbols, ScriptVariableLength, BramDataWidth))
+    {
+        return FALSE;
+    }
+
+    memset(PackedBuffer, 0, PackedBufferSize);
+
+    for (UINT32 i = 0; i < NumberOfSymbols; i++)
+    {
+        UINT64 BitIndex = (UINT64)i * SymbolWidth;
+
+        if (Symbols[i].Type >= (1ull << HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH))
+        {
+            return FALSE;
+        }
+
+        HwdbgScriptPackingWriteField(PackedBuffer, BitIndex, BramDataWidth, Symbols[i].Type, HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH);
+        HwdbgScriptPackingWriteField(PackedBuffer,
+                                     BitIndex + HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH,
+                                     BramDataWidth,
+                                     Symbols[i].Value & ValueMask,
+                                     ScriptVariableLength);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Unpack the bit-packed buffer into a short symbol buffer
+ * @details This is the same as what the script buffer handler of hwdbg does
+ *
+ * @param PackedBuffer
+ * @param PackedBufferSize
+ * @param ScriptVariableLength
+ * @param BramDataWidth
+ * @param Symbols
+ * @param NumberOfSymbols
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+HwdbgScriptPackingUnpackSymbols(const UINT8 *        PackedBuffer,
+                                size_t               PackedBufferSize,
+                                UINT32               ScriptVariableLength,
+                                UINT32               BramDataWidth,
+                                HWDBG_SHORT_SYMBOL * Symbols,
+                                UINT32               NumberOfSymbols)
+{
+    UINT32 SymbolWidth = HwdbgScriptPackingGetSymbolWidth(ScriptVariableLength);
+
+    if (!HwdbgScriptPackingCheckWidths(ScriptVariableLength, BramDataWidth) ||
+        PackedBufferSize < HwdbgScriptPackingComputePackedSize(NumberOfSymbols, ScriptVariableLength, BramDataWidth))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < NumberOfSymbols; i++)
+    {
+        UINT64 BitIndex = (UINT64)i * SymbolWidth;
+
+        Symbols[i].Type  = HwdbgScriptPackingReadField(PackedBuffer, BitIndex, BramDataWidth, HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH);
+        Symbols[i].Value = HwdbgScriptPackingReadField(PackedBuffer,
+                                                       BitIndex + HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH,
+                                                       BramDataWidth,
+                                                       ScriptVariableLength);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Compute the maximum number of stages that fit into the debugger
+ * area of the shared memory
+ * @details Each stage is the operator symbol plus the maximum number of GET
+ * and SET operands. The packet header and the number of symbols of the
+ * script buffer are subtracted from the debugger area
+ *
+ * @param InstanceInfo
+ * @param BitPacked
+ *
+ * @return UINT32
+ */
+UINT32
+HwdbgScriptPackingComputeMaximumNumberOfStages(HWDBG_INSTANCE_INFORMATION * InstanceInfo, BOOLEAN BitPacked)
+{
+    UINT32 BytesPerWord    = (InstanceInfo->bramDataWidth + 7) / 8;
+    UINT32 SymbolsPerStage = 1 + InstanceInfo->maximumNumberOfSupportedGetScriptOperators + InstanceInfo->maximumNumberOfSupportedSetScriptOperators;
+    UINT64 AreaSize        = 0;
+    UINT64 NumberOfWords   = 0;
+    UINT64 BitsPerStage    = 0;
+    UINT64 HeaderSize      = sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(HWDBG_SCRIPT_BUFFER);
+    UINT64 NumberOfStages  = 0;
+
+    if (InstanceInfo->debuggeeAreaOffset <= InstanceInfo->debuggerAreaOffset || BytesPerWord == 0)
+    {
+        return 0;
+    }
+
+    AreaSize = InstanceInfo->debuggeeAreaOffset - InstanceInfo->debuggerAreaOffset;
+
+    if (AreaSize <= HeaderSize)
+    {
+        return 0;
+    }
+
+    NumberOfWords = (AreaSize - HeaderSize) / BytesPerWord;
+
+    if (BitPacked)
+    {
+        BitsPerStage   = (UINT64)SymbolsPerStage * HwdbgScriptPackingGetSymbolWidth(InstanceInfo->scriptVariableLength);
+        NumberOfStages = (NumberOfWords * InstanceInfo->bramDataWidth) / BitsPerStage;
+    }
+    else
+    {
+        //
+        // Each of the type and value fields takes a separate BRAM word
+        //
+        NumberOfStages = NumberOfWords / ((UINT64)SymbolsPerStage * 2);
+    }
+
+    return (UINT32)NumberOfStages;
+}
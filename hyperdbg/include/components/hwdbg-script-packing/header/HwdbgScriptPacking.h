@@ -0,0 +1,41 @@
+/**
+ * @file HwdbgScriptPacking.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the bit-level packing of the hwdbg script buffer
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+UINT32
+HwdbgScriptPackingGetSymbolWidth(UINT32 ScriptVariableLength);
+
+size_t
+HwdbgScriptPackingComputePackedSize(UINT32 NumberOfSymbols, UINT32 ScriptVariableLength, UINT32 BramDataWidth);
+
+BOOLEAN
+HwdbgScriptPackingPackSymbols(const HWDBG_SHORT_SYMBOL * Symbols,
+                              UINT32                     NumberOfSymbols,
+                              UINT32                     ScriptVariableLength,
+                              UINT32                     BramDataWidth,
+                              UINT8 *                    PackedBuffer,
+                              size_t                     PackedBufferSize);
+
+BOOLEAN
+HwdbgScriptPackingUnpackSymbols(const UINT8 *        PackedBuffer,
+                                size_t               PackedBufferSize,
+                                UINT32               ScriptVariableLength,
+                                UINT32               BramDataWidth,
+                                HWDBG_SHORT_SYMBOL * Symbols,
+                                UINT32               NumberOfSymbols);
+
+UINT32
+HwdbgScriptPackingComputeMaximumNumberOfStages(HWDBG_INSTANCE_INFORMATION * InstanceInfo, BOOLEAN BitPacked);
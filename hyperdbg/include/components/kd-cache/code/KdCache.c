@@ -0,0 +1,525 @@
+/**
+ * @file KdCache.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Debugger-side cache of the memory and the registers of the halted debuggee
+ * @details While the debuggee is halted, its memory and registers won't change
+ * unless the debugger asks for it, so the results of the reads (and the state
+ * that is prefetched in the pause packet) are kept here and the later reads are
+ * served without a serial round-trip
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The first register ids of the general-purpose registers (in the
+ * order of GUEST_REGS), each one is followed by its 32-bit, 16-bit and 8-bit parts
+ *
+ */
+static const UINT32 KdCacheGprRegisterIds[] = {
+    REGISTER_RAX,
+    REGISTER_RCX,
+    REGISTER_RDX,
+    REGISTER_RBX,
+    REGISTER_RSP,
+    REGISTER_RBP,
+    REGISTER_RSI,
+    REGISTER_RDI,
+    REGISTER_R8,
+    REGISTER_R9,
+    REGISTER_R10,
+    REGISTER_R11,
+    REGISTER_R12,
+    REGISTER_R13,
+    REGISTER_R14,
+    REGISTER_R15,
+};
+
+/**
+ * @brief Invalidate the cached memory and registers
+ *
+ * @param Cache
+ *
+ * @return VOID
+ */
+VOID
+KdCacheInvalidate(PKD_CACHE Cache)
+{
+    for (UINT32 i = 0; i < KD_CACHE_NUMBER_OF_PAGES; i++)
+    {
+        Cache->Pages[i].IsUsed = FALSE;
+    }
+
+    Cache->NextPageToReplace      = 0;
+    Cache->AreRegistersValid      = FALSE;
+    Cache->IsUserAddressModeValid = FALSE;
+
+    Cache->NumberOfInvalidations++;
+}
+
+/**
+ * @brief Check whether a request keeps the state of the halted debuggee
+ * @details All of the other requests invalidate the cache, the requests
+ * that are not in this list might change the memory or the registers, the
+ * current core or process, or continue the debuggee
+ *
+ * @param RequestedAction
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdCacheIsReadOnlyRequest(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction)
+{
+    switch (RequestedAction)
+    {
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_REGISTERS:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_MEMORY:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_BULK_READ_MEMORY:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_CALLSTACK:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SEARCH_QUERY:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_PA2VA_AND_VA2PA:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SYMBOL_QUERY_PTE:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_IDT_ENTRIES:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_STEP_TRACE:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SET_PAUSE_PREFETCH:
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Get the page-aligned range that is read to fill the cache for a request
+ *
+ * @param Address
+ * @param Size
+ * @param FillAddress
+ * @param FillSize
+ *
+ * @return BOOLEAN FALSE if the request is too large to be cached
+ */
+BOOLEAN
+KdCacheGetFillRange(UINT64 Address, UINT32 Size, UINT64 * FillAddress, UINT32 * FillSize)
+{
+    UINT64 Start = Address & ~((UINT64)NORMAL_PAGE_SIZE - 1);
+    UINT64 End;
+
+    if (Size == 0 || Address + Size < Address)
+    {
+        return FALSE;
+    }
+
+    End = (Address + Size + NORMAL_PAGE_SIZE - 1) & ~((UINT64)NORMAL_PAGE_SIZE - 1);
+
+    if (End == 0 || End - Start > (UINT64)KD_CACHE_MAXIMUM_FILL_PAGES * NORMAL_PAGE_SIZE)
+    {
+        return FALSE;
+    }
+
+    *FillAddress = Start;
+    *FillSize    = (UINT32)(End - Start);
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the cached page of an address
+ *
+ * @param Cache
+ * @param MemoryType
+ * @param PageAddress
+ *
+ * @return PKD_CACHE_PAGE NULL if the page is not cached
+ */
+static PKD_CACHE_PAGE
+KdCacheFindPage(PKD_CACHE Cache, DEBUGGER_READ_MEMORY_TYPE MemoryType, UINT64 PageAddress)
+{
+    for (UINT32 i = 0; i < KD_CACHE_NUMBER_OF_PAGES; i++)
+    {
+        if (Cache->Pages[i].IsUsed &&
+            Cache->Pages[i].PageAddress == PageAddress &&
+            Cache->Pages[i].MemoryType == MemoryType)
+        {
+            return &Cache->Pages[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Add the memory that is read from the debuggee to the cache
+ *
+ * @param Cache
+ * @param MemoryType
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return VOID
+ */
+VOID
+KdCacheInsertMemory(PKD_CACHE                 Cache,
+                    DEBUGGER_READ_MEMORY_TYPE MemoryType,
+                    UINT64                    Address,
+                    const BYTE *              Buffer,
+                    UINT32                    Size)
+{
+    PKD_CACHE_PAGE Page;
+    UINT64         PageAddress;
+    UINT32         Offset;
+    UINT32         Length;
+
+    if (!Cache->IsEnabled || Size == 0 || Address + Size < Address)
+    {
+        return;
+    }
+
+    while (Size != 0)
+    {
+        PageAddress = Address & ~((UINT64)NORMAL_PAGE_SIZE - 1);
+        Offset      = (UINT32)(Address - PageAddress);
+        Length      = NORMAL_PAGE_SIZE - Offset < Size ? NORMAL_PAGE_SIZE - Offset : Size;
+        Page        = KdCacheFindPage(Cache, MemoryType, PageAddress);
+
+        if (Page == NULL)
+        {
+            //
+            // Replace the pages in a round-robin manner
+            //
+            Page = &Cache->Pages[Cache->NextPageToReplace];
+
+            Cache->NextPageToReplace = (Cache->NextPageToReplace + 1) % KD_CACHE_NUMBER_OF_PAGES;
+
+            Page->IsUsed      = TRUE;
+            Page->MemoryType  = MemoryType;
+            Page->PageAddress = PageAddress;
+            Page->ValidStart  = Offset;
+            Page->ValidEnd    = Offset + Length;
+        }
+        else if (Offset <= Page->ValidEnd && Offset + Length >= Page->ValidStart)
+        {
+            //
+            // The valid bytes should be contiguous, so the ranges are only
+            // merged if they overlap or are adjacent
+            //
+            Page->ValidStart = Offset < Page->ValidStart ? Offset : Page->ValidStart;
+            Page->ValidEnd   = Offset + Length > Page->ValidEnd ? Offset + Length : Page->ValidEnd;
+        }
+        else
+        {
+            Page->ValidStart = Offset;
+            Page->ValidEnd   = Offset + Length;
+        }
+
+        memcpy(&Page->Data[Offset], Buffer, Length);
+
+        Address += Length;
+        Buffer += Length;
+        Size -= Length;
+    }
+}
+
+/**
+ * @brief Read the memory from the cache
+ *
+ * @param Cache
+ * @param MemoryType
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return BOOLEAN TRUE if all of the bytes are cached
+ */
+BOOLEAN
+KdCacheReadMemory(PKD_CACHE                 Cache,
+                  DEBUGGER_READ_MEMORY_TYPE MemoryType,
+                  UINT64                    Address,
+                  BYTE *                    Buffer,
+                  UINT32                    Size)
+{
+    PKD_CACHE_PAGE Page;
+    UINT64         PageAddress;
+    UINT32         Offset;
+    UINT32         Length;
+
+    if (!Cache->IsEnabled || Size == 0 || Address + Size < Address)
+    {
+        return FALSE;
+    }
+
+    while (Size != 0)
+    {
+        PageAddress = Address & ~((UINT64)NORMAL_PAGE_SIZE - 1);
+        Offset      = (UINT32)(Address - PageAddress);
+        Length      = NORMAL_PAGE_SIZE - Offset < Size ? NORMAL_PAGE_SIZE - Offset : Size;
+        Page        = KdCacheFindPage(Cache, MemoryType, PageAddress);
+
+        if (Page == NULL || Offset < Page->ValidStart || Offset + Length > Page->ValidEnd)
+        {
+            Cache->NumberOfMisses++;
+            return FALSE;
+        }
+
+        memcpy(Buffer, &Page->Data[Offset], Length);
+
+        Address += Length;
+        Buffer += Length;
+        Size -= Length;
+    }
+
+    Cache->NumberOfHits++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Save the address mode that the debuggee reported for an address
+ * @details The kernel-mode addresses are always 64-bit, the mode of the
+ * user-mode addresses depends on the current process
+ *
+ * @param Cache
+ * @param Address
+ * @param AddressMode
+ *
+ * @return VOID
+ */
+VOID
+KdCacheSetAddressMode(PKD_CACHE Cache, UINT64 Address, DEBUGGER_READ_MEMORY_ADDRESS_MODE AddressMode)
+{
+    if (Address < 0xFFFF800000000000)
+    {
+        Cache->UserAddressMode        = AddressMode;
+        Cache->IsUserAddressModeValid = TRUE;
+    }
+}
+
+/**
+ * @brief Get the address mode of an address (for disassembling)
+ *
+ * @param Cache
+ * @param Address
+ * @param AddressMode
+ *
+ * @return BOOLEAN FALSE if the address mode is not known
+ */
+BOOLEAN
+KdCacheGetAddressMode(PKD_CACHE Cache, UINT64 Address, DEBUGGER_READ_MEMORY_ADDRESS_MODE * AddressMode)
+{
+    if (Address >= 0xFFFF800000000000)
+    {
+        *AddressMode = DEBUGGER_READ_ADDRESS_MODE_64_BIT;
+        return TRUE;
+    }
+
+    if (!Cache->IsUserAddressModeValid)
+    {
+        return FALSE;
+    }
+
+    *AddressMode = Cache->UserAddressMode;
+
+    return TRUE;
+}
+
+/**
+ * @brief Save the registers of the halted core
+ *
+ * @param Cache
+ * @param Regs
+ * @param ExtraRegs
+ *
+ * @return VOID
+ */
+VOID
+KdCacheSetRegisters(PKD_CACHE Cache, const GUEST_REGS * Regs, const GUEST_EXTRA_REGISTERS * ExtraRegs)
+{
+    if (!Cache->IsEnabled)
+    {
+        return;
+    }
+
+    memcpy(&Cache->Regs, Regs, sizeof(GUEST_REGS));
+    memcpy(&Cache->ExtraRegs, ExtraRegs, sizeof(GUEST_EXTRA_REGISTERS));
+
+    Cache->AreRegistersValid = TRUE;
+}
+
+/**
+ * @brief Get all of the registers of the halted core
+ *
+ * @param Cache
+ * @param Regs
+ * @param ExtraRegs
+ *
+ * @return BOOLEAN FALSE if the registers are not cached
+ */
+BOOLEAN
+KdCacheGetRegisters(PKD_CACHE Cache, GUEST_REGS * Regs, GUEST_EXTRA_REGISTERS * ExtraRegs)
+{
+    if (!Cache->IsEnabled || !Cache->AreRegistersValid)
+    {
+        Cache->NumberOfMisses++;
+        return FALSE;
+    }
+
+    memcpy(Regs, &Cache->Regs, sizeof(GUEST_REGS));
+    memcpy(ExtraRegs, &Cache->ExtraRegs, sizeof(GUEST_EXTRA_REGISTERS));
+
+    Cache->NumberOfHits++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get a register of the halted core
+ * @details Only the general-purpose registers (and their parts), the segment
+ * selectors, the flags and the instruction pointer are cached, the other
+ * registers are read from the debuggee
+ *
+ * @param Cache
+ * @param RegisterId
+ * @param Value
+ *
+ * @return BOOLEAN FALSE if the register is not cached
+ */
+BOOLEAN
+KdCacheGetRegister(PKD_CACHE Cache, UINT32 RegisterId, UINT64 * Value)
+{
+    UINT64 * Gprs = (UINT64 *)&Cache->Regs;
+    UINT32   NumberOfParts;
+    UINT32   Part;
+
+    if (!Cache->IsEnabled || !Cache->AreRegistersValid)
+    {
+        Cache->NumberOfMisses++;
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < RTL_NUMBER_OF(KdCacheGprRegisterIds); i++)
+    {
+        //
+        // rsp, rbp, rsi and rdi don't have a second lower byte register
+        //
+        NumberOfParts = (KdCacheGprRegisterIds[i] >= REGISTER_RSP && KdCacheGprRegisterIds[i] <= REGISTER_RDI) ? 4 : 5;
+
+        if (RegisterId < KdCacheGprRegisterIds[i] || RegisterId >= KdCacheGprRegisterIds[i] + NumberOfParts)
+        {
+            continue;
+        }
+
+        Part = RegisterId - KdCacheGprRegisterIds[i];
+
+        switch (Part)
+        {
+        case 0:
+            *Value = Gprs[i];
+            break;
+        case 1:
+            *Value = Gprs[i] & LOWER_32_BITS;
+            break;
+        case 2:
+            *Value = Gprs[i] & LOWER_16_BITS;
+            break;
+        case 3:
+            *Value = NumberOfParts == 5 ? (Gprs[i] & SECOND_LOWER_8_BITS) >> 8 : Gprs[i] & LOWER_8_BITS;
+            break;
+        default:
+            *Value = Gprs[i] & LOWER_8_BITS;
+            break;
+        }
+
+        Cache->NumberOfHits++;
+        return TRUE;
+    }
+
+    switch (RegisterId)
+    {
+    case REGISTER_DS:
+        *Value = Cache->ExtraRegs.DS;
+        break;
+    case REGISTER_ES:
+        *Value = Cache->ExtraRegs.ES;
+        break;
+    case REGISTER_FS:
+        *Value = Cache->ExtraRegs.FS;
+        break;
+    case REGISTER_GS:
+        *Value = Cache->ExtraRegs.GS;
+        break;
+    case REGISTER_CS:
+        *Value = Cache->ExtraRegs.CS;
+        break;
+    case REGISTER_SS:
+        *Value = Cache->ExtraRegs.SS;
+        break;
+    case REGISTER_RFLAGS:
+        *Value = Cache->ExtraRegs.RFLAGS;
+        break;
+    case REGISTER_EFLAGS:
+        *Value = Cache->ExtraRegs.RFLAGS & LOWER_32_BITS;
+        break;
+    case REGISTER_FLAGS:
+        *Value = Cache->ExtraRegs.RFLAGS & LOWER_16_BITS;
+        break;
+    case REGISTER_RIP:
+        *Value = Cache->ExtraRegs.RIP;
+        break;
+    case REGISTER_EIP:
+        *Value = Cache->ExtraRegs.RIP & LOWER_32_BITS;
+        break;
+    case REGISTER_IP:
+        *Value = Cache->ExtraRegs.RIP & LOWER_16_BITS;
+        break;
+    default:
+        Cache->NumberOfMisses++;
+        return FALSE;
+    }
+
+    Cache->NumberOfHits++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Fill the cache from the state that is prefetched in the pause packet
+ *
+ * @param Cache
+ * @param Prefetch
+ * @param PrefetchSize Size of the prefetch and its windows
+ *
+ * @return BOOLEAN FALSE if the prefetched state is malformed
+ */
+BOOLEAN
+KdCacheLoadPausePrefetch(PKD_CACHE Cache, const DEBUGGEE_KD_PAUSED_PREFETCH * Prefetch, UINT32 PrefetchSize)
+{
+    const BYTE * Windows = (const BYTE *)Prefetch + sizeof(DEBUGGEE_KD_PAUSED_PREFETCH);
+
+    if (PrefetchSize < sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) ||
+        Prefetch->StackSize > DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_STACK_WINDOW ||
+        Prefetch->CodeSize > DEBUGGEE_PAUSE_PREFETCH_MAXIMUM_CODE_WINDOW ||
+        PrefetchSize - sizeof(DEBUGGEE_KD_PAUSED_PREFETCH) < (UINT64)Prefetch->StackSize + Prefetch->CodeSize)
+    {
+        return FALSE;
+    }
+
+    if (Prefetch->HasRegisters)
+    {
+        KdCacheSetRegisters(Cache, &Prefetch->Regs, &Prefetch->ExtraRegs);
+    }
+
+    KdCacheInsertMemory(Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, Prefetch->StackAddress, Windows, Prefetch->StackSize);
+
+    KdCacheInsertMemory(Cache, DEBUGGER_READ_VIRTUAL_ADDRESS, Prefetch->CodeAddress, Windows + Prefetch->StackSize, Prefetch->CodeSize);
+
+    if (Prefetch->CodeSize != 0)
+    {
+        KdCacheSetAddressMode(Cache, Prefetch->CodeAddress, Prefetch->CodeAddressMode);
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file KdCache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the debugger-side cache of the halted debuggee
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the pages that are cached
+ *
+ */
+#define KD_CACHE_NUMBER_OF_PAGES 64
+
+/**
+ * @brief Maximum number of pages that are read to fill the cache for a
+ * single read request, larger requests are sent as they are
+ *
+ */
+#define KD_CACHE_MAXIMUM_FILL_PAGES 4
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A cached page, only the bytes between ValidStart and
+ * ValidEnd are read from the debuggee
+ *
+ */
+typedef struct _KD_CACHE_PAGE
+{
+    BOOLEAN                   IsUsed;
+    DEBUGGER_READ_MEMORY_TYPE MemoryType;
+    UINT64                    PageAddress;
+    UINT32                    ValidStart;
+    UINT32                    ValidEnd;
+    BYTE                      Data[NORMAL_PAGE_SIZE];
+
+} KD_CACHE_PAGE, *PKD_CACHE_PAGE;
+
+/**
+ * @brief The cache of the memory and the registers of the halted debuggee
+ * @details The content is only valid while the debuggee is halted and
+ * nothing is changed, it should be invalidated before any request that
+ * might change the state of the debuggee
+ *
+ */
+typedef struct _KD_CACHE
+{
+    BOOLEAN       IsEnabled;
+    KD_CACHE_PAGE Pages[KD_CACHE_NUMBER_OF_PAGES];
+    UINT32        NextPageToReplace;
+
+    //
+    // Registers
+    //
+    BOOLEAN               AreRegistersValid;
+    GUEST_REGS            Regs;
+    GUEST_EXTRA_REGISTERS ExtraRegs;
+
+    //
+    // Address mode of the user-mode addresses (for disassembling)
+    //
+    BOOLEAN                           IsUserAddressModeValid;
+    DEBUGGER_READ_MEMORY_ADDRESS_MODE UserAddressMode;
+
+    //
+    // Statistics
+    //
+    UINT64 NumberOfHits;
+    UINT64 NumberOfMisses;
+    UINT64 NumberOfInvalidations;
+
+} KD_CACHE, *PKD_CACHE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+KdCacheInvalidate(PKD_CACHE Cache);
+
+BOOLEAN
+KdCacheIsReadOnlyRequest(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction);
+
+BOOLEAN
+KdCacheGetFillRange(UINT64 Address, UINT32 Size, UINT64 * FillAddress, UINT32 * FillSize);
+
+VOID
+KdCacheInsertMemory(PKD_CACHE                 Cache,
+                    DEBUGGER_READ_MEMORY_TYPE MemoryType,
+                    UINT64                    Address,
+                    const BYTE *              Buffer,
+                    UINT32                    Size);
+
+BOOLEAN
+KdCacheReadMemory(PKD_CACHE                 Cache,
+                  DEBUGGER_READ_MEMORY_TYPE MemoryType,
+                  UINT64                    Address,
+                  BYTE *                    Buffer,
+                  UINT32                    Size);
+
+VOID
+KdCacheSetAddressMode(PKD_CACHE Cache, UINT64 Address, DEBUGGER_READ_MEMORY_ADDRESS_MODE AddressMode);
+
+BOOLEAN
+KdCacheGetAddressMode(PKD_CACHE Cache, UINT64 Address, DEBUGGER_READ_MEMORY_ADDRESS_MODE * AddressMode);
+
+VOID
+KdCacheSetRegisters(PKD_CACHE Cache, const GUEST_REGS * Regs, const GUEST_EXTRA_REGISTERS * ExtraRegs);
+
+BOOLEAN
+KdCacheGetRegisters(PKD_CACHE Cache, GUEST_REGS * Regs, GUEST_EXTRA_REGISTERS * ExtraRegs);
+
+BOOLEAN
+KdCacheGetRegister(PKD_CACHE Cache, UINT32 RegisterId, UINT64 * Value);
+
+BOOLEAN
+KdCacheLoadPausePrefetch(PKD_CACHE Cache, const DEBUGGEE_KD_PAUSED_PREFETCH * Prefetch, UINT32 PrefetchSize);
@@ -0,0 +1,315 @@
+/**
+ * @file LbrDecode.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Layouts and formats of the Last Branch Records
+ * @details The MSRs of the stack and the format of the records depend on the
+ * model of the processor. The records are read by the hypervisor, and they're
+ * decoded here (the decoding doesn't touch the MSRs, so it's also tested on
+ * the dumps of the registers)
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The stacks of the models of the family 6 (the legacy LBRs, the
+ * architectural LBRs are not listed)
+ *
+ */
+static const struct
+{
+    UINT8   Model;
+    UINT8   NumberOfEntries;
+    BOOLEAN IsCore2Layout; // MSR_LASTBRANCH_x_FROM_IP at 0x40 and MSR_LASTBRANCH_x_TO_IP at 0x60
+    BOOLEAN HasSelect;
+
+} LbrDecodeModels[] = {
+    //
+    // Core 2
+    //
+    {0x0F, 4, TRUE, FALSE},
+    {0x16, 4, TRUE, FALSE},
+    {0x17, 4, TRUE, FALSE},
+    {0x1D, 4, TRUE, FALSE},
+
+    //
+    // Bonnell and Saltwell
+    //
+    {0x1C, 8, TRUE, FALSE},
+    {0x26, 8, TRUE, FALSE},
+    {0x27, 8, TRUE, FALSE},
+    {0x35, 8, TRUE, FALSE},
+    {0x36, 8, TRUE, FALSE},
+
+    //
+    // Silvermont and Airmont
+    //
+    {0x37, 8, TRUE, TRUE},
+    {0x4A, 8, TRUE, TRUE},
+    {0x4C, 8, TRUE, TRUE},
+    {0x4D, 8, TRUE, TRUE},
+    {0x5A, 8, TRUE, TRUE},
+    {0x5D, 8, TRUE, TRUE},
+
+    //
+    // Nehalem, Westmere, Sandy Bridge, Ivy Bridge, Haswell, and Broadwell
+    //
+    {0x1A, 16, FALSE, TRUE},
+    {0x1E, 16, FALSE, TRUE},
+    {0x1F, 16, FALSE, TRUE},
+    {0x2E, 16, FALSE, TRUE},
+    {0x25, 16, FALSE, TRUE},
+    {0x2C, 16, FALSE, TRUE},
+    {0x2F, 16, FALSE, TRUE},
+    {0x2A, 16, FALSE, TRUE},
+    {0x2D, 16, FALSE, TRUE},
+    {0x3A, 16, FALSE, TRUE},
+    {0x3E, 16, FALSE, TRUE},
+    {0x3C, 16, FALSE, TRUE},
+    {0x3F, 16, FALSE, TRUE},
+    {0x45, 16, FALSE, TRUE},
+    {0x46, 16, FALSE, TRUE},
+    {0x3D, 16, FALSE, TRUE},
+    {0x47, 16, FALSE, TRUE},
+    {0x4F, 16, FALSE, TRUE},
+    {0x56, 16, FALSE, TRUE},
+
+    //
+    // Knights Landing and Knights Mill
+    //
+    {0x57, 8, FALSE, TRUE},
+    {0x85, 8, FALSE, TRUE},
+
+    //
+    // Goldmont, Goldmont Plus, and Tremont
+    //
+    {0x5C, 32, FALSE, TRUE},
+    {0x5F, 32, FALSE, TRUE},
+    {0x7A, 32, FALSE, TRUE},
+    {0x86, 32, FALSE, TRUE},
+    {0x96, 32, FALSE, TRUE},
+    {0x9C, 32, FALSE, TRUE},
+
+    //
+    // Skylake to Rocket Lake
+    //
+    {0x4E, 32, FALSE, TRUE},
+    {0x5E, 32, FALSE, TRUE},
+    {0x55, 32, FALSE, TRUE},
+    {0x8E, 32, FALSE, TRUE},
+    {0x9E, 32, FALSE, TRUE},
+    {0x66, 32, FALSE, TRUE},
+    {0x7D, 32, FALSE, TRUE},
+    {0x7E, 32, FALSE, TRUE},
+    {0x6A, 32, FALSE, TRUE},
+    {0x6C, 32, FALSE, TRUE},
+    {0xA5, 32, FALSE, TRUE},
+    {0xA6, 32, FALSE, TRUE},
+    {0x8C, 32, FALSE, TRUE},
+    {0x8D, 32, FALSE, TRUE},
+    {0xA7, 32, FALSE, TRUE},
+};
+
+/**
+ * @brief Find the MSRs and the format of the stack of a processor
+ *
+ * @param Family The display family (CPUID.01H)
+ * @param Model The display model (CPUID.01H, with the extended model)
+ * @param PerfCapabilities IA32_PERF_CAPABILITIES (zero if it's not supported)
+ * @param Layout
+ *
+ * @return BOOLEAN FALSE if the processor is not known
+ */
+BOOLEAN
+LbrDecodeGetLayout(UINT32 Family, UINT32 Model, UINT64 PerfCapabilities, PLBR_DECODE_LAYOUT Layout)
+{
+    LBR_DECODE_FORMAT Format = (LBR_DECODE_FORMAT)(PerfCapabilities & LBR_DECODE_PERF_CAPABILITIES_FORMAT_MASK);
+
+    if (Family != 6 || Format > LBR_DECODE_FORMAT_INFO2)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < sizeof(LbrDecodeModels) / sizeof(LbrDecodeModels[0]); i++)
+    {
+        if (LbrDecodeModels[i].Model != Model)
+        {
+            continue;
+        }
+
+        Layout->NumberOfEntries = LbrDecodeModels[i].NumberOfEntries;
+        Layout->FromMsr         = LbrDecodeModels[i].IsCore2Layout ? LBR_DECODE_MSR_CORE2_FROM_IP : LBR_DECODE_MSR_NEHALEM_FROM_IP;
+        Layout->ToMsr           = LbrDecodeModels[i].IsCore2Layout ? LBR_DECODE_MSR_CORE2_TO_IP : LBR_DECODE_MSR_NEHALEM_TO_IP;
+        Layout->InfoMsr         = 0;
+        Layout->SelectMsr       = LbrDecodeModels[i].HasSelect ? LBR_DECODE_MSR_LBR_SELECT : 0;
+        Layout->Format          = Format;
+
+        //
+        // Both of the addresses are in the FROM MSR
+        //
+        if (Format == LBR_DECODE_FORMAT_32)
+        {
+            Layout->ToMsr = 0;
+        }
+
+        if (Format == LBR_DECODE_FORMAT_INFO || Format == LBR_DECODE_FORMAT_INFO2)
+        {
+            Layout->InfoMsr = LBR_DECODE_MSR_LBR_INFO;
+        }
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Sign-extend an address after removing its top bits
+ *
+ * @param Value
+ * @param Skip Number of the top bits
+ *
+ * @return UINT64
+ */
+static UINT64
+LbrDecodeSignExtend(UINT64 Value, UINT32 Skip)
+{
+    return (UINT64)((INT64)(Value << Skip) >> Skip);
+}
+
+/**
+ * @brief Decode the records of the stack
+ * @details The arrays are indexed by the entries (same as the MSRs), the
+ * records are filled from the newest (the top of the stack) to the oldest
+ * and the empty entries are skipped
+ *
+ * @param Layout
+ * @param Tos MSR_LASTBRANCH_TOS
+ * @param From The FROM MSRs
+ * @param To The TO MSRs (not used in LBR_DECODE_FORMAT_32)
+ * @param Info The MSR_LBR_INFO MSRs (only used if the layout has them)
+ * @param MaximumRecords
+ * @param Records
+ *
+ * @return UINT32 Number of the records
+ */
+UINT32
+LbrDecodeRecords(const LBR_DECODE_LAYOUT * Layout,
+                 UINT64                    Tos,
+                 const UINT64 *            From,
+                 const UINT64 *            To,
+                 const UINT64 *            Info,
+                 UINT32                    MaximumRecords,
+                 PLBR_DECODE_RECORD        Records)
+{
+    UINT32 NumberOfRecords = 0;
+    UINT32 Index;
+    UINT32 Skip;
+    UINT64 Source;
+    UINT64 Destination;
+    UINT32 Cycles;
+    UINT32 Flags;
+
+    if (Layout->NumberOfEntries == 0 || Layout->NumberOfEntries > LBR_DECODE_MAXIMUM_ENTRIES)
+    {
+        return 0;
+    }
+
+    for (UINT32 i = 0; i < Layout->NumberOfEntries && NumberOfRecords < MaximumRecords; i++)
+    {
+        //
+        // The TOS points to the newest entry, the older ones are below it
+        //
+        Index = (UINT32)((Tos + Layout->NumberOfEntries - i) % Layout->NumberOfEntries);
+
+        Skip   = 0;
+        Cycles = 0;
+        Flags  = 0;
+
+        if (Layout->Format == LBR_DECODE_FORMAT_32)
+        {
+            Source      = From[Index] & 0xffffffff;
+            Destination = From[Index] >> 32;
+        }
+        else
+        {
+            Source      = From[Index];
+            Destination = To[Index];
+        }
+
+        if (Source == 0 && Destination == 0)
+        {
+            continue;
+        }
+
+        switch (Layout->Format)
+        {
+        case LBR_DECODE_FORMAT_EIP_FLAGS:
+
+            Flags |= LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN;
+            Flags |= (Source >> 63) ? LBR_DECODE_RECORD_FLAG_MISPREDICTED : 0;
+            Skip = 1;
+
+            break;
+
+        case LBR_DECODE_FORMAT_EIP_FLAGS2:
+
+            Flags |= LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN;
+            Flags |= (Source >> 63) & 1 ? LBR_DECODE_RECORD_FLAG_MISPREDICTED : 0;
+            Flags |= (Source >> 62) & 1 ? LBR_DECODE_RECORD_FLAG_IN_TSX : 0;
+            Flags |= (Source >> 61) & 1 ? LBR_DECODE_RECORD_FLAG_TSX_ABORT : 0;
+            Skip = 3;
+
+            break;
+
+        case LBR_DECODE_FORMAT_INFO:
+        case LBR_DECODE_FORMAT_INFO2:
+
+            //
+            // MSR_LBR_INFO: the misprediction (63), in TSX (62), TSX abort (61),
+            // the cycles are valid (60), and the cycles (15:0)
+            //
+            if (Info != NULL)
+            {
+                Flags |= LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN;
+                Flags |= (Info[Index] >> 63) & 1 ? LBR_DECODE_RECORD_FLAG_MISPREDICTED : 0;
+                Flags |= (Info[Index] >> 62) & 1 ? LBR_DECODE_RECORD_FLAG_IN_TSX : 0;
+                Flags |= (Info[Index] >> 61) & 1 ? LBR_DECODE_RECORD_FLAG_TSX_ABORT : 0;
+                Flags |= (Info[Index] >> 60) & 1 ? LBR_DECODE_RECORD_FLAG_CYCLES_VALID : 0;
+                Cycles = (UINT32)(Info[Index] & 0xffff);
+            }
+
+            break;
+
+        case LBR_DECODE_FORMAT_TIME:
+
+            Flags |= LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN | LBR_DECODE_RECORD_FLAG_CYCLES_VALID;
+            Flags |= (Source >> 63) ? LBR_DECODE_RECORD_FLAG_MISPREDICTED : 0;
+            Cycles      = (UINT32)((Destination >> 48) & 0xffff);
+            Destination = LbrDecodeSignExtend(Destination, 16);
+            Skip        = 1;
+
+            break;
+
+        default:
+
+            //
+            // Only the addresses
+            //
+            break;
+        }
+
+        Records[NumberOfRecords].From   = LbrDecodeSignExtend(Source, Skip);
+        Records[NumberOfRecords].To     = Destination;
+        Records[NumberOfRecords].Cycles = Cycles;
+        Records[NumberOfRecords].Flags  = Flags;
+
+        NumberOfRecords++;
+    }
+
+    return NumberOfRecords;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file LbrDecode.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the layouts and the formats of the Last Branch Records
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The MSRs of the (legacy) Last Branch Records
+ *
+ */
+#define LBR_DECODE_MSR_LBR_SELECT             0x000001C8
+#define LBR_DECODE_MSR_LBR_TOS                0x000001C9
+#define LBR_DECODE_MSR_IA32_DEBUGCTL          0x000001D9
+#define LBR_DECODE_MSR_IA32_PERF_CAPABILITIES 0x00000345
+#define LBR_DECODE_MSR_CORE2_FROM_IP          0x00000040
+#define LBR_DECODE_MSR_CORE2_TO_IP            0x00000060
+#define LBR_DECODE_MSR_NEHALEM_FROM_IP        0x00000680
+#define LBR_DECODE_MSR_NEHALEM_TO_IP          0x000006C0
+#define LBR_DECODE_MSR_LBR_INFO               0x00000DC0
+
+/**
+ * @brief IA32_DEBUGCTL.LBR (the processor records the branches)
+ *
+ */
+#define LBR_DECODE_DEBUGCTL_LBR (1ull << 0)
+
+/**
+ * @brief The bits of MSR_LBR_SELECT (a set bit suppresses the branches of
+ * its kind)
+ *
+ */
+#define LBR_DECODE_SELECT_CPL_EQ_0      (1ull << 0)
+#define LBR_DECODE_SELECT_CPL_NEQ_0     (1ull << 1)
+#define LBR_DECODE_SELECT_JCC           (1ull << 2)
+#define LBR_DECODE_SELECT_NEAR_REL_CALL (1ull << 3)
+#define LBR_DECODE_SELECT_NEAR_IND_CALL (1ull << 4)
+#define LBR_DECODE_SELECT_NEAR_RET      (1ull << 5)
+#define LBR_DECODE_SELECT_NEAR_IND_JMP  (1ull << 6)
+#define LBR_DECODE_SELECT_NEAR_REL_JMP  (1ull << 7)
+#define LBR_DECODE_SELECT_FAR_BRANCH    (1ull << 8)
+#define LBR_DECODE_SELECT_CALLSTACK     (1ull << 9)
+#define LBR_DECODE_SELECT_MASK          0x3ff
+
+/**
+ * @brief The format of the records is the bits 5:0 of IA32_PERF_CAPABILITIES
+ *
+ */
+#define LBR_DECODE_PERF_CAPABILITIES_FORMAT_MASK 0x3f
+
+/**
+ * @brief Maximum entries of the stacks of the known processors
+ *
+ */
+#define LBR_DECODE_MAXIMUM_ENTRIES 32
+
+/**
+ * @brief The flags of the decoded records
+ *
+ */
+#define LBR_DECODE_RECORD_FLAG_MISPREDICTED     0x1
+#define LBR_DECODE_RECORD_FLAG_PREDICTION_KNOWN 0x2 // The format reports the prediction
+#define LBR_DECODE_RECORD_FLAG_IN_TSX           0x4
+#define LBR_DECODE_RECORD_FLAG_TSX_ABORT        0x8
+#define LBR_DECODE_RECORD_FLAG_CYCLES_VALID     0x10
+
+//////////////////////////////////////////////////
+//				    Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Formats of the records (IA32_PERF_CAPABILITIES.LBR_FMT)
+ *
+ */
+typedef enum _LBR_DECODE_FORMAT
+{
+    LBR_DECODE_FORMAT_32         = 0, // A single MSR, the source is the bits 31:0 and the destination is the bits 63:32
+    LBR_DECODE_FORMAT_LIP        = 1, // Linear addresses
+    LBR_DECODE_FORMAT_EIP        = 2, // Offsets in the segments (same as the linear addresses in the 64-bit mode)
+    LBR_DECODE_FORMAT_EIP_FLAGS  = 3, // The bit 63 of the source is the misprediction
+    LBR_DECODE_FORMAT_EIP_FLAGS2 = 4, // The bits 63:61 of the source are the misprediction, in TSX, and TSX abort
+    LBR_DECODE_FORMAT_INFO       = 5, // The flags and the cycles are in MSR_LBR_INFO
+    LBR_DECODE_FORMAT_TIME       = 6, // The bit 63 of the source is the misprediction, the bits 63:48 of the destination are the cycles
+    LBR_DECODE_FORMAT_INFO2      = 7, // Same as LBR_DECODE_FORMAT_INFO
+
+} LBR_DECODE_FORMAT;
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The MSRs of the stack of a processor
+ *
+ */
+typedef struct _LBR_DECODE_LAYOUT
+{
+    UINT32            NumberOfEntries;
+    UINT32            FromMsr;   // MSR of the first source
+    UINT32            ToMsr;     // MSR of the first destination (zero in LBR_DECODE_FORMAT_32)
+    UINT32            InfoMsr;   // MSR of the first MSR_LBR_INFO (zero if the format has no info)
+    UINT32            SelectMsr; // Zero if the branches can't be filtered
+    LBR_DECODE_FORMAT Format;
+
+} LBR_DECODE_LAYOUT, *PLBR_DECODE_LAYOUT;
+
+/**
+ * @brief A decoded branch
+ *
+ */
+typedef struct _LBR_DECODE_RECORD
+{
+    UINT64 From;
+    UINT64 To;
+    UINT32 Cycles; // Cycles since the previous record (if LBR_DECODE_RECORD_FLAG_CYCLES_VALID)
+    UINT32 Flags;  // LBR_DECODE_RECORD_FLAG_*
+
+} LBR_DECODE_RECORD, *PLBR_DECODE_RECORD;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+LbrDecodeGetLayout(UINT32 Family, UINT32 Model, UINT64 PerfCapabilities, PLBR_DECODE_LAYOUT Layout);
+
+UINT32
+LbrDecodeRecords(const LBR_DECODE_LAYOUT * Layout,
+                 UINT64                    Tos,
+                 const UINT64 *            From,
+                 const UINT64 *            To,
+                 const UINT64 *            Info,
+                 UINT32                    MaximumRecords,
+                 PLBR_DECODE_RECORD        Records);
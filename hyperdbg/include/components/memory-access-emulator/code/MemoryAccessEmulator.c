@@ -0,0 +1,1138 @@
+/**
+ * @file MemoryAccessEmulator.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Decoder and emulator of the trapped memory accesses
+ * @details The accesses to the monitored pages are trapped by the EPT, if the
+ * instruction is one of the common data-access forms (mov, movzx, movsx, stos,
+ * movs and the simple read-modify-write instructions), it's performed on
+ * behalf of the guest and the RIP is moved to the next instruction, so the
+ * hook doesn't need to restore the original entry and wait for an MTF
+ *
+ * Only the 64-bit mode is supported, and the memory is accessed through the
+ * callbacks, so the same code is tested in the user-mode against the native
+ * execution of the instructions. If the instruction is not supported or the
+ * memory is not accessible, nothing is changed and the caller should let the
+ * processor execute the instruction
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the mask of an operand
+ *
+ * @param Size Size of the operand (1, 2, 4 or 8)
+ *
+ * @return UINT64
+ */
+static UINT64
+MemoryAccessEmulatorGetSizeMask(UINT32 Size)
+{
+    return Size >= 8 ? 0xffffffffffffffffull : (1ull << (Size * 8)) - 1;
+}
+
+/**
+ * @brief Sign-extend an operand to 64 bits
+ *
+ * @param Value
+ * @param Size Size of the operand
+ *
+ * @return UINT64
+ */
+static UINT64
+MemoryAccessEmulatorSignExtend(UINT64 Value, UINT32 Size)
+{
+    UINT64 Sign = 1ull << (Size * 8 - 1);
+
+    Value &= MemoryAccessEmulatorGetSizeMask(Size);
+
+    return (Value ^ Sign) - Sign;
+}
+
+/**
+ * @brief Read a little-endian immediate (or displacement) of the instruction
+ *
+ * @param Buffer
+ * @param BufferLength
+ * @param Position Position of the immediate, moved after it
+ * @param Size Size of the immediate (1, 2 or 4)
+ * @param Value The sign-extended immediate
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+MemoryAccessEmulatorDecodeImmediate(const UINT8 * Buffer, UINT32 BufferLength, UINT32 * Position, UINT32 Size, UINT64 * Value)
+{
+    UINT64 Immediate = 0;
+
+    if (*Position + Size > BufferLength)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Size; i++)
+    {
+        Immediate |= (UINT64)Buffer[*Position + i] << (i * 8);
+    }
+
+    *Position += Size;
+    *Value = MemoryAccessEmulatorSignExtend(Immediate, Size);
+
+    return TRUE;
+}
+
+/**
+ * @brief Decode the ModRM (and SIB and displacement) of the instruction
+ * @details The register forms (mod = 3) don't access the memory, so they
+ * are not supported
+ *
+ * @param Buffer
+ * @param BufferLength
+ * @param Position Position of the ModRM, moved after the displacement
+ * @param Rex The REX prefix (or zero)
+ * @param Instruction
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+MemoryAccessEmulatorDecodeModRm(const UINT8 *                      Buffer,
+                                UINT32                             BufferLength,
+                                UINT32 *                           Position,
+                                UINT8                              Rex,
+                                PMEMORY_ACCESS_EMULATOR_INSTRUCTION Instruction)
+{
+    UINT8  ModRm;
+    UINT8  Sib;
+    UINT8  Mod;
+    UINT8  Rm;
+    UINT32 DisplacementSize = 0;
+    UINT64 Displacement     = 0;
+
+    if (*Position >= BufferLength)
+    {
+        return FALSE;
+    }
+
+    ModRm = Buffer[(*Position)++];
+    Mod   = ModRm >> 6;
+    Rm    = ModRm & 7;
+
+    Instruction->Register = ((ModRm >> 3) & 7) | ((Rex & 0x4) ? 8 : 0);
+
+    if (Mod == 3)
+    {
+        return FALSE;
+    }
+
+    if (Rm == 4)
+    {
+        if (*Position >= BufferLength)
+        {
+            return FALSE;
+        }
+
+        Sib = Buffer[(*Position)++];
+
+        Instruction->Scale    = Sib >> 6;
+        Instruction->Index    = ((Sib >> 3) & 7) | ((Rex & 0x2) ? 8 : 0);
+        Instruction->HasIndex = Instruction->Index != 4;
+
+        if ((Sib & 7) == 5 && Mod == 0)
+        {
+            //
+            // No base, only disp32
+            //
+            DisplacementSize = 4;
+        }
+        else
+        {
+            Instruction->HasBase = TRUE;
+            Instruction->Base    = (Sib & 7) | ((Rex & 0x1) ? 8 : 0);
+        }
+    }
+    else if (Rm == 5 && Mod == 0)
+    {
+        Instruction->RipRelative = TRUE;
+        DisplacementSize         = 4;
+    }
+    else
+    {
+        Instruction->HasBase = TRUE;
+        Instruction->Base    = Rm | ((Rex & 0x1) ? 8 : 0);
+    }
+
+    if (Mod == 1)
+    {
+        DisplacementSize = 1;
+    }
+    else if (Mod == 2)
+    {
+        DisplacementSize = 4;
+    }
+
+    if (DisplacementSize != 0 &&
+        !MemoryAccessEmulatorDecodeImmediate(Buffer, BufferLength, Position, DisplacementSize, &Displacement))
+    {
+        return FALSE;
+    }
+
+    Instruction->Displacement = (INT64)Displacement;
+
+    return TRUE;
+}
+
+/**
+ * @brief Decode an instruction of the 64-bit mode
+ *
+ * @param Buffer The bytes of the instruction
+ * @param BufferLength Number of the valid bytes in the buffer
+ * @param Instruction The decoded instruction
+ *
+ * @return BOOLEAN Whether the instruction is supported or not
+ */
+BOOLEAN
+MemoryAccessEmulatorDecode(const UINT8 * Buffer, UINT32 BufferLength, PMEMORY_ACCESS_EMULATOR_INSTRUCTION Instruction)
+{
+    //
+    // The operations of the 80, 81 and 83 groups (adc and sbb are not supported)
+    //
+    static const MEMORY_ACCESS_EMULATOR_OPERATION GroupOperations[8] = {
+        MEMORY_ACCESS_EMULATOR_OPERATION_ADD,
+        MEMORY_ACCESS_EMULATOR_OPERATION_OR,
+        MEMORY_ACCESS_EMULATOR_OPERATION_NONE,
+        MEMORY_ACCESS_EMULATOR_OPERATION_NONE,
+        MEMORY_ACCESS_EMULATOR_OPERATION_AND,
+        MEMORY_ACCESS_EMULATOR_OPERATION_SUB,
+        MEMORY_ACCESS_EMULATOR_OPERATION_XOR,
+        MEMORY_ACCESS_EMULATOR_OPERATION_CMP,
+    };
+
+    UINT32  Position       = 0;
+    UINT32  OperandSize    = 4;
+    UINT32  ImmediateSize  = 0;
+    UINT8   Rex            = 0;
+    UINT8   Opcode         = 0;
+    BOOLEAN OperandSize16  = FALSE;
+    BOOLEAN Repne          = FALSE;
+    BOOLEAN HasModRm       = TRUE;
+    BOOLEAN IsPrefix       = TRUE;
+
+    memset(Instruction, 0, sizeof(MEMORY_ACCESS_EMULATOR_INSTRUCTION));
+
+    if (BufferLength > MEMORY_ACCESS_EMULATOR_MAXIMUM_INSTRUCTION_LENGTH)
+    {
+        BufferLength = MEMORY_ACCESS_EMULATOR_MAXIMUM_INSTRUCTION_LENGTH;
+    }
+
+    //
+    // Legacy prefixes
+    //
+    while (IsPrefix)
+    {
+        if (Position >= BufferLength)
+        {
+            return FALSE;
+        }
+
+        switch (Buffer[Position])
+        {
+        case 0xf0:
+            Instruction->Lock = TRUE;
+            break;
+        case 0xf3:
+            Instruction->Rep = TRUE;
+            break;
+        case 0xf2:
+            Repne = TRUE;
+            break;
+        case 0x66:
+            OperandSize16 = TRUE;
+            break;
+        case 0x67:
+            Instruction->AddressSize32 = TRUE;
+            break;
+        case 0x64:
+            Instruction->Segment = MEMORY_ACCESS_EMULATOR_SEGMENT_FS;
+            break;
+        case 0x65:
+            Instruction->Segment = MEMORY_ACCESS_EMULATOR_SEGMENT_GS;
+            break;
+        case 0x26:
+        case 0x2e:
+        case 0x36:
+        case 0x3e:
+            //
+            // Null segment overrides in the 64-bit mode
+            //
+            break;
+        default:
+            IsPrefix = FALSE;
+            continue;
+        }
+
+        Position++;
+    }
+
+    //
+    // The REX prefix should be right before the opcode
+    //
+    if ((Buffer[Position] & 0xf0) == 0x40)
+    {
+        Rex                 = Buffer[Position++];
+        Instruction->HasRex = TRUE;
+    }
+
+    if (Position >= BufferLength)
+    {
+        return FALSE;
+    }
+
+    Opcode = Buffer[Position++];
+
+    if (Rex & 0x8)
+    {
+        OperandSize = 8;
+    }
+    else if (OperandSize16)
+    {
+        OperandSize = 2;
+    }
+
+    Instruction->MemorySize  = (Opcode & 1) ? OperandSize : 1;
+    Instruction->HasRegister = TRUE;
+
+    switch (Opcode)
+    {
+    case 0x88:
+    case 0x89:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_STORE;
+        break;
+
+    case 0x8a:
+    case 0x8b:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_LOAD;
+        break;
+
+    case 0xc6:
+    case 0xc7:
+        Instruction->Operation   = MEMORY_ACCESS_EMULATOR_OPERATION_STORE;
+        Instruction->HasRegister = FALSE;
+        ImmediateSize            = Instruction->MemorySize == 1 ? 1 : (Instruction->MemorySize == 2 ? 2 : 4);
+        break;
+
+    case 0x63:
+        //
+        // movsxd (without REX.W it's not a sign extension)
+        //
+        if (OperandSize != 8)
+        {
+            return FALSE;
+        }
+
+        Instruction->Operation    = MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_SIGN_EXTEND;
+        Instruction->MemorySize   = 4;
+        Instruction->RegisterSize = 8;
+        break;
+
+    case 0xa4:
+    case 0xa5:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_MOVS;
+        HasModRm               = FALSE;
+        break;
+
+    case 0xaa:
+    case 0xab:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_STOS;
+        HasModRm               = FALSE;
+        break;
+
+    case 0x00:
+    case 0x01:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_ADD;
+        break;
+
+    case 0x08:
+    case 0x09:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_OR;
+        break;
+
+    case 0x20:
+    case 0x21:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_AND;
+        break;
+
+    case 0x28:
+    case 0x29:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_SUB;
+        break;
+
+    case 0x30:
+    case 0x31:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_XOR;
+        break;
+
+    case 0x38:
+    case 0x39:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_CMP;
+        break;
+
+    case 0x86:
+    case 0x87:
+        Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_XCHG;
+        break;
+
+    case 0x80:
+    case 0x81:
+    case 0x83:
+        Instruction->HasRegister = FALSE;
+        ImmediateSize            = (Opcode == 0x83 || Instruction->MemorySize == 1) ? 1 : (Instruction->MemorySize == 2 ? 2 : 4);
+        break;
+
+    case 0xfe:
+    case 0xff:
+        Instruction->HasRegister = FALSE;
+        break;
+
+    case 0x0f:
+        if (Position >= BufferLength)
+        {
+            return FALSE;
+        }
+
+        Opcode = Buffer[Position++];
+
+        switch (Opcode)
+        {
+        case 0xb6:
+        case 0xb7:
+            Instruction->Operation    = MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_ZERO_EXTEND;
+            Instruction->MemorySize   = (Opcode & 1) ? 2 : 1;
+            Instruction->RegisterSize = OperandSize;
+            break;
+
+        case 0xbe:
+        case 0xbf:
+            Instruction->Operation    = MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_SIGN_EXTEND;
+            Instruction->MemorySize   = (Opcode & 1) ? 2 : 1;
+            Instruction->RegisterSize = OperandSize;
+            break;
+
+        case 0xb0:
+        case 0xb1:
+            Instruction->Operation  = MEMORY_ACCESS_EMULATOR_OPERATION_CMPXCHG;
+            Instruction->MemorySize = (Opcode & 1) ? OperandSize : 1;
+            break;
+
+        case 0xc0:
+        case 0xc1:
+            Instruction->Operation  = MEMORY_ACCESS_EMULATOR_OPERATION_XADD;
+            Instruction->MemorySize = (Opcode & 1) ? OperandSize : 1;
+            break;
+
+        default:
+            return FALSE;
+        }
+        break;
+
+    default:
+        return FALSE;
+    }
+
+    //
+    // The register operand is the same size as the memory operand, except
+    // for movzx and movsx
+    //
+    if (Instruction->RegisterSize == 0)
+    {
+        Instruction->RegisterSize = Instruction->MemorySize;
+    }
+
+    if (HasModRm)
+    {
+        if (!MemoryAccessEmulatorDecodeModRm(Buffer, BufferLength, &Position, Rex, Instruction))
+        {
+            return FALSE;
+        }
+
+        //
+        // The operations of the groups are in ModRM.reg
+        //
+        if (Opcode == 0x80 || Opcode == 0x81 || Opcode == 0x83)
+        {
+            Instruction->Operation = GroupOperations[Instruction->Register & 7];
+        }
+        else if (Opcode == 0xfe || Opcode == 0xff)
+        {
+            if ((Instruction->Register & 7) == 0)
+            {
+                Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_INC;
+            }
+            else if ((Instruction->Register & 7) == 1)
+            {
+                Instruction->Operation = MEMORY_ACCESS_EMULATOR_OPERATION_DEC;
+            }
+        }
+        else if ((Opcode == 0xc6 || Opcode == 0xc7) && (Instruction->Register & 7) != 0)
+        {
+            return FALSE;
+        }
+    }
+
+    if (Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_NONE)
+    {
+        return FALSE;
+    }
+
+    if (ImmediateSize != 0)
+    {
+        if (!MemoryAccessEmulatorDecodeImmediate(Buffer, BufferLength, &Position, ImmediateSize, &Instruction->Immediate))
+        {
+            return FALSE;
+        }
+
+        Instruction->HasImmediate = TRUE;
+        Instruction->Immediate &= MemoryAccessEmulatorGetSizeMask(Instruction->MemorySize);
+    }
+
+    Instruction->Length = Position;
+
+    //
+    // The rep prefix is only used by the string instructions (the other
+    // forms of f2 and f3 are different instructions or hints)
+    //
+    if (Repne || (Instruction->Rep && Instruction->Operation != MEMORY_ACCESS_EMULATOR_OPERATION_STOS &&
+                  Instruction->Operation != MEMORY_ACCESS_EMULATOR_OPERATION_MOVS))
+    {
+        return FALSE;
+    }
+
+    //
+    // The 32-bit counters and pointers of the string instructions are not supported
+    //
+    if (!HasModRm && Instruction->AddressSize32)
+    {
+        return FALSE;
+    }
+
+    //
+    // The lock prefix is only valid for the read-modify-write instructions
+    //
+    if (Instruction->Lock)
+    {
+        switch (Instruction->Operation)
+        {
+        case MEMORY_ACCESS_EMULATOR_OPERATION_ADD:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_OR:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_AND:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_SUB:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_XOR:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_INC:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_DEC:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_XCHG:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_XADD:
+        case MEMORY_ACCESS_EMULATOR_OPERATION_CMPXCHG:
+            break;
+
+        default:
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether the instruction writes to the memory or not
+ *
+ * @param Instruction
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+MemoryAccessEmulatorIsWriting(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction)
+{
+    switch (Instruction->Operation)
+    {
+    case MEMORY_ACCESS_EMULATOR_OPERATION_LOAD:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_ZERO_EXTEND:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_SIGN_EXTEND:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_CMP:
+        return FALSE;
+
+    default:
+        return TRUE;
+    }
+}
+
+/**
+ * @brief Get a register operand
+ *
+ * @param State
+ * @param Register Index of the register
+ * @param Size Size of the operand
+ * @param HasRex Whether the byte registers 4 to 7 are spl-dil or ah-bh
+ *
+ * @return UINT64
+ */
+static UINT64
+MemoryAccessEmulatorGetRegister(PMEMORY_ACCESS_EMULATOR_STATE State, UINT32 Register, UINT32 Size, BOOLEAN HasRex)
+{
+    UINT64 * Registers = (UINT64 *)State->Regs;
+
+    if (Size == 1 && !HasRex && Register >= 4 && Register < 8)
+    {
+        return (Registers[Register - 4] >> 8) & 0xff;
+    }
+
+    return Registers[Register] & MemoryAccessEmulatorGetSizeMask(Size);
+}
+
+/**
+ * @brief Set a register operand
+ * @details The 32-bit operands are zero-extended and the 8-bit and 16-bit
+ * operands keep the rest of the register
+ *
+ * @param State
+ * @param Register Index of the register
+ * @param Size Size of the operand
+ * @param HasRex Whether the byte registers 4 to 7 are spl-dil or ah-bh
+ * @param Value
+ *
+ * @return VOID
+ */
+static VOID
+MemoryAccessEmulatorSetRegister(PMEMORY_ACCESS_EMULATOR_STATE State, UINT32 Register, UINT32 Size, BOOLEAN HasRex, UINT64 Value)
+{
+    UINT64 * Registers = (UINT64 *)State->Regs;
+
+    if (Size == 1 && !HasRex && Register >= 4 && Register < 8)
+    {
+        Registers[Register - 4] = (Registers[Register - 4] & ~0xff00ull) | ((Value & 0xff) << 8);
+    }
+    else if (Size == 4)
+    {
+        Registers[Register] = Value & 0xffffffff;
+    }
+    else
+    {
+        Registers[Register] = (Registers[Register] & ~MemoryAccessEmulatorGetSizeMask(Size)) |
+                              (Value & MemoryAccessEmulatorGetSizeMask(Size));
+    }
+}
+
+/**
+ * @brief Get the linear address of the memory operand
+ *
+ * @param Instruction
+ * @param State
+ *
+ * @return UINT64
+ */
+UINT64
+MemoryAccessEmulatorGetEffectiveAddress(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                                        const MEMORY_ACCESS_EMULATOR_STATE *       State)
+{
+    const UINT64 * Registers = (const UINT64 *)State->Regs;
+    UINT64         Address   = (UINT64)Instruction->Displacement;
+
+    if (Instruction->RipRelative)
+    {
+        Address += State->Rip + Instruction->Length;
+    }
+
+    if (Instruction->HasBase)
+    {
+        Address += Registers[Instruction->Base];
+    }
+
+    if (Instruction->HasIndex)
+    {
+        Address += Registers[Instruction->Index] << Instruction->Scale;
+    }
+
+    if (Instruction->AddressSize32)
+    {
+        Address &= 0xffffffff;
+    }
+
+    if (Instruction->Segment == MEMORY_ACCESS_EMULATOR_SEGMENT_FS)
+    {
+        Address += State->FsBase;
+    }
+    else if (Instruction->Segment == MEMORY_ACCESS_EMULATOR_SEGMENT_GS)
+    {
+        Address += State->GsBase;
+    }
+
+    return Address;
+}
+
+/**
+ * @brief Compute the result of a read-modify-write operation
+ *
+ * @param Operation
+ * @param Destination The memory operand
+ * @param Source The register or immediate operand
+ *
+ * @return UINT64
+ */
+static UINT64
+MemoryAccessEmulatorCompute(MEMORY_ACCESS_EMULATOR_OPERATION Operation, UINT64 Destination, UINT64 Source)
+{
+    switch (Operation)
+    {
+    case MEMORY_ACCESS_EMULATOR_OPERATION_ADD:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_XADD:
+        return Destination + Source;
+    case MEMORY_ACCESS_EMULATOR_OPERATION_OR:
+        return Destination | Source;
+    case MEMORY_ACCESS_EMULATOR_OPERATION_AND:
+        return Destination & Source;
+    case MEMORY_ACCESS_EMULATOR_OPERATION_SUB:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_CMP:
+        return Destination - Source;
+    case MEMORY_ACCESS_EMULATOR_OPERATION_XOR:
+        return Destination ^ Source;
+    case MEMORY_ACCESS_EMULATOR_OPERATION_INC:
+        return Destination + 1;
+    case MEMORY_ACCESS_EMULATOR_OPERATION_DEC:
+        return Destination - 1;
+    default:
+        return Source;
+    }
+}
+
+/**
+ * @brief Compute the arithmetic flags of an operation
+ *
+ * @param Operation
+ * @param Size Size of the operands
+ * @param Destination
+ * @param Source
+ * @param Result
+ * @param Rflags The previous flags
+ *
+ * @return UINT64 The new flags
+ */
+static UINT64
+MemoryAccessEmulatorComputeFlags(MEMORY_ACCESS_EMULATOR_OPERATION Operation,
+                                 UINT32                           Size,
+                                 UINT64                           Destination,
+                                 UINT64                           Source,
+                                 UINT64                           Result,
+                                 UINT64                           Rflags)
+{
+    UINT64 Mask   = MemoryAccessEmulatorGetSizeMask(Size);
+    UINT64 Sign   = 1ull << (Size * 8 - 1);
+    UINT64 Flags  = 0;
+    UINT8  Parity = (UINT8)Result;
+
+    Destination &= Mask;
+    Source &= Mask;
+    Result &= Mask;
+
+    switch (Operation)
+    {
+    case MEMORY_ACCESS_EMULATOR_OPERATION_ADD:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_XADD:
+        Flags |= Result < Destination ? MEMORY_ACCESS_EMULATOR_FLAG_CF : 0;
+        Flags |= ((Destination ^ Result) & (Source ^ Result) & Sign) ? MEMORY_ACCESS_EMULATOR_FLAG_OF : 0;
+        Flags |= (Destination ^ Source ^ Result) & MEMORY_ACCESS_EMULATOR_FLAG_AF;
+        break;
+
+    case MEMORY_ACCESS_EMULATOR_OPERATION_SUB:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_CMP:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_CMPXCHG:
+        Flags |= Destination < Source ? MEMORY_ACCESS_EMULATOR_FLAG_CF : 0;
+        Flags |= ((Destination ^ Source) & (Destination ^ Result) & Sign) ? MEMORY_ACCESS_EMULATOR_FLAG_OF : 0;
+        Flags |= (Destination ^ Source ^ Result) & MEMORY_ACCESS_EMULATOR_FLAG_AF;
+        break;
+
+    case MEMORY_ACCESS_EMULATOR_OPERATION_INC:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_DEC:
+        //
+        // The carry flag is not changed
+        //
+        Flags |= Rflags & MEMORY_ACCESS_EMULATOR_FLAG_CF;
+        Flags |= Result == (Operation == MEMORY_ACCESS_EMULATOR_OPERATION_INC ? Sign : Sign - 1) ? MEMORY_ACCESS_EMULATOR_FLAG_OF : 0;
+        Flags |= (Destination ^ Result) & MEMORY_ACCESS_EMULATOR_FLAG_AF;
+        break;
+
+    default:
+        //
+        // The logical operations clear the carry and overflow flags
+        //
+        break;
+    }
+
+    Flags |= Result == 0 ? MEMORY_ACCESS_EMULATOR_FLAG_ZF : 0;
+    Flags |= (Result & Sign) ? MEMORY_ACCESS_EMULATOR_FLAG_SF : 0;
+
+    Parity ^= Parity >> 4;
+    Parity ^= Parity >> 2;
+    Parity ^= Parity >> 1;
+    Flags |= (Parity & 1) ? 0 : MEMORY_ACCESS_EMULATOR_FLAG_PF;
+
+    return (Rflags & ~(UINT64)MEMORY_ACCESS_EMULATOR_ARITHMETIC_FLAGS) | Flags;
+}
+
+/**
+ * @brief Perform a read-modify-write operation on the memory
+ * @details The locked instructions (and xchg) use the compare-exchange
+ * callback, so the memory is not changed between the read and the write
+ *
+ * @param Instruction
+ * @param State
+ * @param Address
+ * @param Source
+ * @param Destination The previous value of the memory
+ * @param Result The new value of the memory
+ *
+ * @return MEMORY_ACCESS_EMULATOR_STATUS
+ */
+static MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorReadModifyWrite(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                                    PMEMORY_ACCESS_EMULATOR_STATE              State,
+                                    UINT64                                     Address,
+                                    UINT64                                     Source,
+                                    UINT64 *                                   Destination,
+                                    UINT64 *                                   Result)
+{
+    UINT64  Mask      = MemoryAccessEmulatorGetSizeMask(Instruction->MemorySize);
+    UINT64  Previous  = 0;
+    UINT64  New       = 0;
+    UINT64  Comparand = 0;
+    BOOLEAN IsAtomic  = Instruction->Lock || Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_XCHG;
+
+    if (IsAtomic && State->CompareExchange == NULL)
+    {
+        return MEMORY_ACCESS_EMULATOR_STATUS_UNSUPPORTED;
+    }
+
+    if (!State->Read(Address, &Previous, Instruction->MemorySize, State->Context))
+    {
+        return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+    }
+
+    for (UINT32 Retry = 0;; Retry++)
+    {
+        New = MemoryAccessEmulatorCompute(Instruction->Operation, Previous, Source) & Mask;
+
+        if (!IsAtomic)
+        {
+            if (Instruction->Operation != MEMORY_ACCESS_EMULATOR_OPERATION_CMP &&
+                !State->Write(Address, &New, Instruction->MemorySize, State->Context))
+            {
+                return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+            }
+
+            break;
+        }
+
+        if (Retry == MEMORY_ACCESS_EMULATOR_MAXIMUM_LOCK_RETRIES)
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+        }
+
+        Comparand = Previous;
+
+        if (!State->CompareExchange(Address, Instruction->MemorySize, &Comparand, New, State->Context))
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+        }
+
+        if (Comparand == Previous)
+        {
+            break;
+        }
+
+        //
+        // Changed by another core, retry with the new value
+        //
+        Previous = Comparand & Mask;
+    }
+
+    *Destination = Previous;
+    *Result      = New;
+
+    return MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED;
+}
+
+/**
+ * @brief Perform a cmpxchg instruction
+ *
+ * @param Instruction
+ * @param State
+ * @param Address
+ *
+ * @return MEMORY_ACCESS_EMULATOR_STATUS
+ */
+static MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorCompareExchange(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                                    PMEMORY_ACCESS_EMULATOR_STATE              State,
+                                    UINT64                                     Address)
+{
+    UINT32 Size        = Instruction->MemorySize;
+    UINT64 Accumulator = MemoryAccessEmulatorGetRegister(State, MEMORY_ACCESS_EMULATOR_REGISTER_RAX, Size, Instruction->HasRex);
+    UINT64 Source      = MemoryAccessEmulatorGetRegister(State, Instruction->Register, Size, Instruction->HasRex);
+    UINT64 Previous    = 0;
+
+    if (Instruction->Lock)
+    {
+        if (State->CompareExchange == NULL)
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_UNSUPPORTED;
+        }
+
+        Previous = Accumulator;
+
+        if (!State->CompareExchange(Address, Size, &Previous, Source, State->Context))
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+        }
+
+        Previous &= MemoryAccessEmulatorGetSizeMask(Size);
+    }
+    else
+    {
+        //
+        // Without the lock, the destination is written even if it's not
+        // equal to the accumulator (the same as the processor)
+        //
+        if (!State->Read(Address, &Previous, Size, State->Context) ||
+            !State->Write(Address, Previous == Accumulator ? &Source : &Previous, Size, State->Context))
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+        }
+    }
+
+    State->Rflags = MemoryAccessEmulatorComputeFlags(MEMORY_ACCESS_EMULATOR_OPERATION_CMPXCHG,
+                                                     Size,
+                                                     Accumulator,
+                                                     Previous,
+                                                     Accumulator - Previous,
+                                                     State->Rflags);
+
+    if (Previous != Accumulator)
+    {
+        MemoryAccessEmulatorSetRegister(State, MEMORY_ACCESS_EMULATOR_REGISTER_RAX, Size, Instruction->HasRex, Previous);
+    }
+
+    return MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED;
+}
+
+/**
+ * @brief Perform a stos or movs instruction (and their rep forms)
+ * @details The iterations are performed until the count is zero or an
+ * access fails, the registers are updated after each iteration, so the
+ * processor continues the rest of the iterations from the same state
+ *
+ * @param Instruction
+ * @param State
+ *
+ * @return MEMORY_ACCESS_EMULATOR_STATUS
+ */
+static MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorExecuteString(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                                  PMEMORY_ACCESS_EMULATOR_STATE              State)
+{
+    GUEST_REGS * Regs        = State->Regs;
+    UINT32       Size        = Instruction->MemorySize;
+    UINT64       Count       = Instruction->Rep ? Regs->rcx : 1;
+    UINT64       Step        = (State->Rflags & MEMORY_ACCESS_EMULATOR_FLAG_DF) ? (UINT64)(-(INT64)Size) : Size;
+    UINT64       SegmentBase = 0;
+    UINT64       Value;
+    UINT32       Iteration;
+
+    if (Instruction->Segment == MEMORY_ACCESS_EMULATOR_SEGMENT_FS)
+    {
+        SegmentBase = State->FsBase;
+    }
+    else if (Instruction->Segment == MEMORY_ACCESS_EMULATOR_SEGMENT_GS)
+    {
+        SegmentBase = State->GsBase;
+    }
+
+    for (Iteration = 0; Count != 0 && Iteration < MEMORY_ACCESS_EMULATOR_MAXIMUM_REP_ITERATIONS; Iteration++)
+    {
+        Value = 0;
+
+        if (Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_MOVS)
+        {
+            //
+            // The source can be overridden, the destination is always es:rdi
+            //
+            if (!State->Read(SegmentBase + Regs->rsi, &Value, Size, State->Context))
+            {
+                break;
+            }
+        }
+        else
+        {
+            Value = MemoryAccessEmulatorGetRegister(State, MEMORY_ACCESS_EMULATOR_REGISTER_RAX, Size, TRUE);
+        }
+
+        if (!State->Write(Regs->rdi, &Value, Size, State->Context))
+        {
+            break;
+        }
+
+        if (Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_MOVS)
+        {
+            Regs->rsi += Step;
+        }
+
+        Regs->rdi += Step;
+        Count--;
+
+        if (Instruction->Rep)
+        {
+            Regs->rcx = Count;
+        }
+    }
+
+    if (Count != 0)
+    {
+        return Iteration == 0 ? MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED : MEMORY_ACCESS_EMULATOR_STATUS_PARTIAL;
+    }
+
+    State->Rip += Instruction->Length;
+
+    return MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED;
+}
+
+/**
+ * @brief Perform a decoded instruction
+ *
+ * @param Instruction
+ * @param State The registers and the callbacks of the memory
+ *
+ * @return MEMORY_ACCESS_EMULATOR_STATUS
+ */
+MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorExecute(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                            PMEMORY_ACCESS_EMULATOR_STATE              State)
+{
+    MEMORY_ACCESS_EMULATOR_STATUS Status;
+    UINT64                        Address;
+    UINT64                        Value       = 0;
+    UINT64                        Source      = 1;
+    UINT64                        Destination = 0;
+    UINT64                        Result      = 0;
+
+    if (Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_STOS ||
+        Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_MOVS)
+    {
+        return MemoryAccessEmulatorExecuteString(Instruction, State);
+    }
+
+    Address = MemoryAccessEmulatorGetEffectiveAddress(Instruction, State);
+
+    if (Instruction->HasImmediate)
+    {
+        Source = Instruction->Immediate;
+    }
+    else if (Instruction->HasRegister)
+    {
+        Source = MemoryAccessEmulatorGetRegister(State, Instruction->Register, Instruction->MemorySize, Instruction->HasRex);
+    }
+
+    switch (Instruction->Operation)
+    {
+    case MEMORY_ACCESS_EMULATOR_OPERATION_STORE:
+
+        if (!State->Write(Address, &Source, Instruction->MemorySize, State->Context))
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+        }
+
+        break;
+
+    case MEMORY_ACCESS_EMULATOR_OPERATION_LOAD:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_ZERO_EXTEND:
+    case MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_SIGN_EXTEND:
+
+        if (!State->Read(Address, &Value, Instruction->MemorySize, State->Context))
+        {
+            return MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED;
+        }
+
+        if (Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_SIGN_EXTEND)
+        {
+            Value = MemoryAccessEmulatorSignExtend(Value, Instruction->MemorySize);
+        }
+
+        MemoryAccessEmulatorSetRegister(State, Instruction->Register, Instruction->RegisterSize, Instruction->HasRex, Value);
+
+        break;
+
+    case MEMORY_ACCESS_EMULATOR_OPERATION_CMPXCHG:
+
+        Status = MemoryAccessEmulatorCompareExchange(Instruction, State, Address);
+
+        if (Status != MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED)
+        {
+            return Status;
+        }
+
+        break;
+
+    default:
+
+        Status = MemoryAccessEmulatorReadModifyWrite(Instruction, State, Address, Source, &Destination, &Result);
+
+        if (Status != MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED)
+        {
+            return Status;
+        }
+
+        if (Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_XCHG ||
+            Instruction->Operation == MEMORY_ACCESS_EMULATOR_OPERATION_XADD)
+        {
+            MemoryAccessEmulatorSetRegister(State, Instruction->Register, Instruction->MemorySize, Instruction->HasRex, Destination);
+        }
+
+        if (Instruction->Operation != MEMORY_ACCESS_EMULATOR_OPERATION_XCHG)
+        {
+            State->Rflags = MemoryAccessEmulatorComputeFlags(Instruction->Operation,
+                                                             Instruction->MemorySize,
+                                                             Destination,
+                                                             Source,
+                                                             Result,
+                                                             State->Rflags);
+        }
+
+        break;
+    }
+
+    State->Rip += Instruction->Length;
+
+    return MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED;
+}
+
+/**
+ * @brief Decode and perform an instruction
+ *
+ * @param Buffer The bytes of the instruction
+ * @param BufferLength Number of the valid bytes in the buffer
+ * @param State The registers and the callbacks of the memory
+ *
+ * @return MEMORY_ACCESS_EMULATOR_STATUS
+ */
+MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorEmulate(const UINT8 *                 Buffer,
+                            UINT32                        BufferLength,
+                            PMEMORY_ACCESS_EMULATOR_STATE State)
+{
+    MEMORY_ACCESS_EMULATOR_INSTRUCTION Instruction;
+
+    if (!MemoryAccessEmulatorDecode(Buffer, BufferLength, &Instruction))
+    {
+        return MEMORY_ACCESS_EMULATOR_STATUS_UNSUPPORTED;
+    }
+
+    return MemoryAccessEmulatorExecute(&Instruction, State);
+}
@@ -0,0 +1,216 @@
+/**
+ * @file MemoryAccessEmulator.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the decoder and emulator of the trapped memory accesses
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum length of an x86 instruction
+ *
+ */
+#define MEMORY_ACCESS_EMULATOR_MAXIMUM_INSTRUCTION_LENGTH 15
+
+/**
+ * @brief Maximum iterations of a rep-prefixed instruction that are emulated
+ * at once, the rest of the iterations are performed by the next execution of
+ * the instruction
+ *
+ */
+#define MEMORY_ACCESS_EMULATOR_MAXIMUM_REP_ITERATIONS 4096
+
+/**
+ * @brief Maximum attempts of the compare-exchange of a locked instruction
+ * when the memory is changed by the other cores
+ *
+ */
+#define MEMORY_ACCESS_EMULATOR_MAXIMUM_LOCK_RETRIES 16
+
+/**
+ * @brief The flags of the RFLAGS that are changed by the emulator
+ *
+ */
+#define MEMORY_ACCESS_EMULATOR_FLAG_CF         0x0001
+#define MEMORY_ACCESS_EMULATOR_FLAG_PF         0x0004
+#define MEMORY_ACCESS_EMULATOR_FLAG_AF         0x0010
+#define MEMORY_ACCESS_EMULATOR_FLAG_ZF         0x0040
+#define MEMORY_ACCESS_EMULATOR_FLAG_SF         0x0080
+#define MEMORY_ACCESS_EMULATOR_FLAG_DF         0x0400
+#define MEMORY_ACCESS_EMULATOR_FLAG_OF         0x0800
+#define MEMORY_ACCESS_EMULATOR_ARITHMETIC_FLAGS 0x08d5
+
+/**
+ * @brief Segment overrides of the memory operand (the other segments have
+ * no base in 64-bit mode)
+ *
+ */
+#define MEMORY_ACCESS_EMULATOR_SEGMENT_NONE 0
+#define MEMORY_ACCESS_EMULATOR_SEGMENT_FS   1
+#define MEMORY_ACCESS_EMULATOR_SEGMENT_GS   2
+
+/**
+ * @brief Index of the accumulator in the GUEST_REGS (the registers of the
+ * GUEST_REGS are in the order of their encoding)
+ *
+ */
+#define MEMORY_ACCESS_EMULATOR_REGISTER_RAX 0
+#define MEMORY_ACCESS_EMULATOR_REGISTER_RCX 1
+#define MEMORY_ACCESS_EMULATOR_REGISTER_RSI 6
+#define MEMORY_ACCESS_EMULATOR_REGISTER_RDI 7
+
+//////////////////////////////////////////////////
+//				      Enums                     //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Operations of the supported instructions
+ *
+ */
+typedef enum _MEMORY_ACCESS_EMULATOR_OPERATION
+{
+    MEMORY_ACCESS_EMULATOR_OPERATION_NONE = 0,
+    MEMORY_ACCESS_EMULATOR_OPERATION_STORE,              // mov r/m, reg and mov r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_LOAD,               // mov reg, r/m
+    MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_ZERO_EXTEND,   // movzx
+    MEMORY_ACCESS_EMULATOR_OPERATION_LOAD_SIGN_EXTEND,   // movsx and movsxd
+    MEMORY_ACCESS_EMULATOR_OPERATION_STOS,               // stos and rep stos
+    MEMORY_ACCESS_EMULATOR_OPERATION_MOVS,               // movs and rep movs
+    MEMORY_ACCESS_EMULATOR_OPERATION_ADD,                // add r/m, reg and add r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_OR,                 // or r/m, reg and or r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_AND,                // and r/m, reg and and r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_SUB,                // sub r/m, reg and sub r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_XOR,                // xor r/m, reg and xor r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_CMP,                // cmp r/m, reg and cmp r/m, imm
+    MEMORY_ACCESS_EMULATOR_OPERATION_INC,                // inc r/m
+    MEMORY_ACCESS_EMULATOR_OPERATION_DEC,                // dec r/m
+    MEMORY_ACCESS_EMULATOR_OPERATION_XCHG,               // xchg r/m, reg
+    MEMORY_ACCESS_EMULATOR_OPERATION_XADD,               // xadd r/m, reg
+    MEMORY_ACCESS_EMULATOR_OPERATION_CMPXCHG,            // cmpxchg r/m, reg
+
+} MEMORY_ACCESS_EMULATOR_OPERATION;
+
+/**
+ * @brief Results of the emulation
+ *
+ */
+typedef enum _MEMORY_ACCESS_EMULATOR_STATUS
+{
+    MEMORY_ACCESS_EMULATOR_STATUS_COMPLETED = 0, // The instruction is performed and the RIP is moved to the next instruction
+    MEMORY_ACCESS_EMULATOR_STATUS_PARTIAL,       // Some iterations of a rep-prefixed instruction are performed, the RIP is not changed
+    MEMORY_ACCESS_EMULATOR_STATUS_UNSUPPORTED,   // The instruction is not supported, nothing is changed
+    MEMORY_ACCESS_EMULATOR_STATUS_ACCESS_FAILED, // The memory is not accessible by the callbacks, nothing is changed
+
+} MEMORY_ACCESS_EMULATOR_STATUS;
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that reads the memory of the guest (the address is the
+ * linear address of the access)
+ *
+ */
+typedef BOOLEAN (*MEMORY_ACCESS_EMULATOR_READ_CALLBACK)(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context);
+
+/**
+ * @brief Callback that writes the memory of the guest
+ *
+ */
+typedef BOOLEAN (*MEMORY_ACCESS_EMULATOR_WRITE_CALLBACK)(UINT64 Address, const VOID * Buffer, UINT32 Size, PVOID Context);
+
+/**
+ * @brief Callback that atomically replaces the memory with the new value if
+ * it's equal to the comparand, the comparand is set to the previous value of
+ * the memory
+ *
+ */
+typedef BOOLEAN (*MEMORY_ACCESS_EMULATOR_COMPARE_EXCHANGE_CALLBACK)(UINT64 Address, UINT32 Size, UINT64 * Comparand, UINT64 NewValue, PVOID Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A decoded instruction
+ *
+ */
+typedef struct _MEMORY_ACCESS_EMULATOR_INSTRUCTION
+{
+    MEMORY_ACCESS_EMULATOR_OPERATION Operation;
+    UINT32                           Length;
+    UINT32                           MemorySize;   // Size of the memory operand
+    UINT32                           RegisterSize; // Size of the register operand (different for movzx and movsx)
+    UINT32                           Register;     // The register operand (ModRM.reg)
+    BOOLEAN                          HasRegister;  // Whether the instruction has a register operand or not
+    BOOLEAN                          HasImmediate;
+    UINT64                           Immediate;    // Sign-extended to the size of the operand
+    BOOLEAN                          HasRex;       // Changes the byte registers 4 to 7 from ah-bh to spl-dil
+    BOOLEAN                          Lock;
+    BOOLEAN                          Rep;
+    BOOLEAN                          AddressSize32;
+    UINT32                           Segment;
+
+    //
+    // The memory operand (not used by the string instructions)
+    //
+    BOOLEAN HasBase;
+    BOOLEAN HasIndex;
+    BOOLEAN RipRelative;
+    UINT32  Base;
+    UINT32  Index;
+    UINT32  Scale; // Shift of the index
+    INT64   Displacement;
+
+} MEMORY_ACCESS_EMULATOR_INSTRUCTION, *PMEMORY_ACCESS_EMULATOR_INSTRUCTION;
+
+/**
+ * @brief The state of the guest that is changed by the emulator
+ *
+ */
+typedef struct _MEMORY_ACCESS_EMULATOR_STATE
+{
+    GUEST_REGS *                                     Regs;
+    UINT64                                           Rip;
+    UINT64                                           Rflags;
+    UINT64                                           FsBase;
+    UINT64                                           GsBase;
+    MEMORY_ACCESS_EMULATOR_READ_CALLBACK             Read;
+    MEMORY_ACCESS_EMULATOR_WRITE_CALLBACK            Write;
+    MEMORY_ACCESS_EMULATOR_COMPARE_EXCHANGE_CALLBACK CompareExchange; // Optional, needed for the locked instructions
+    PVOID                                            Context;
+
+} MEMORY_ACCESS_EMULATOR_STATE, *PMEMORY_ACCESS_EMULATOR_STATE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+MemoryAccessEmulatorDecode(const UINT8 * Buffer, UINT32 BufferLength, PMEMORY_ACCESS_EMULATOR_INSTRUCTION Instruction);
+
+BOOLEAN
+MemoryAccessEmulatorIsWriting(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction);
+
+UINT64
+MemoryAccessEmulatorGetEffectiveAddress(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                                        const MEMORY_ACCESS_EMULATOR_STATE *       State);
+
+MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorExecute(const MEMORY_ACCESS_EMULATOR_INSTRUCTION * Instruction,
+                            PMEMORY_ACCESS_EMULATOR_STATE              State);
+
+MEMORY_ACCESS_EMULATOR_STATUS
+MemoryAccessEmulatorEmulate(const UINT8 *                 Buffer,
+                            UINT32                        BufferLength,
+                            PMEMORY_ACCESS_EMULATOR_STATE State);
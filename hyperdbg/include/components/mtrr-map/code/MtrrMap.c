@@ -0,0 +1,269 @@
+/**
+ * @file MtrrMap.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The sorted interval map of the memory types of the MTRRs
+ * @details The ranges of the MTRRs are converted once to sorted intervals
+ * (each boundary of a range starts a new interval and the neighbor intervals
+ * with the same memory type are merged), so the memory type of an address
+ * is found by a binary search instead of checking all of the ranges, and a
+ * page has a single memory type if it doesn't cross a boundary of the map
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the memory type of an address from the ranges of the MTRRs
+ * @details The set of the ranges that describe an address is the same in
+ * an interval, so the ranges are only checked once for each interval
+ *
+ * @param Ranges
+ * @param NumberOfRanges
+ * @param DefaultMemoryType
+ * @param PhysicalAddress
+ *
+ * @return UINT8
+ */
+static UINT8
+MtrrMapGetRangesMemoryType(const MTRR_MAP_RANGE * Ranges,
+                           UINT32                 NumberOfRanges,
+                           UINT8                  DefaultMemoryType,
+                           UINT64                 PhysicalAddress)
+{
+    UINT8 TargetMemoryType = (UINT8)-1;
+
+    for (UINT32 i = 0; i < NumberOfRanges; i++)
+    {
+        if (PhysicalAddress < Ranges[i].PhysicalBaseAddress || PhysicalAddress >= Ranges[i].PhysicalEndAddress)
+        {
+            continue;
+        }
+
+        //
+        // 12.11.4.1 MTRR Precedences
+        //
+        if (Ranges[i].FixedRange)
+        {
+            //
+            // When the fixed-range MTRRs are enabled, they take priority over the variable-range
+            // MTRRs when overlaps in ranges occur.
+            //
+            TargetMemoryType = Ranges[i].MemoryType;
+            break;
+        }
+
+        if (TargetMemoryType == MTRR_MAP_MEMORY_TYPE_UNCACHEABLE)
+        {
+            //
+            // If this is going to be marked uncacheable, then we stop the search as UC always
+            // takes precedence
+            //
+            TargetMemoryType = Ranges[i].MemoryType;
+            break;
+        }
+
+        if (TargetMemoryType == MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH || Ranges[i].MemoryType == MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH)
+        {
+            if (TargetMemoryType == MTRR_MAP_MEMORY_TYPE_WRITE_BACK)
+            {
+                //
+                // If two or more MTRRs overlap and describe the same region, and at least one is WT and
+                // the other one(s) is/are WB, use WT. However, continue looking, as other MTRRs
+                // may still specify the address as UC, which always takes precedence
+                //
+                TargetMemoryType = MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH;
+                continue;
+            }
+        }
+
+        //
+        // Otherwise, just use the last MTRR that describes this address
+        //
+        TargetMemoryType = Ranges[i].MemoryType;
+    }
+
+    //
+    // If no MTRR was found, return the default memory type
+    //
+    if (TargetMemoryType == (UINT8)-1)
+    {
+        TargetMemoryType = DefaultMemoryType;
+    }
+
+    return TargetMemoryType;
+}
+
+/**
+ * @brief Add a boundary to the sorted boundaries of the map
+ *
+ * @param Map
+ * @param PhysicalAddress
+ *
+ * @return VOID
+ */
+static VOID
+MtrrMapAddBoundary(PMTRR_MAP Map, UINT64 PhysicalAddress)
+{
+    UINT32 i = Map->NumberOfIntervals;
+
+    while (i > 0 && Map->Intervals[i - 1].PhysicalBaseAddress > PhysicalAddress)
+    {
+        Map->Intervals[i] = Map->Intervals[i - 1];
+        i--;
+    }
+
+    if (i > 0 && Map->Intervals[i - 1].PhysicalBaseAddress == PhysicalAddress)
+    {
+        //
+        // The boundary already exists, undo the move
+        //
+        while (i < Map->NumberOfIntervals)
+        {
+            Map->Intervals[i] = Map->Intervals[i + 1];
+            i++;
+        }
+
+        return;
+    }
+
+    Map->Intervals[i].PhysicalBaseAddress = PhysicalAddress;
+    Map->NumberOfIntervals++;
+}
+
+/**
+ * @brief Build the interval map from the ranges of the MTRRs
+ *
+ * @param Map
+ * @param Ranges
+ * @param NumberOfRanges
+ * @param DefaultMemoryType The memory type of the addresses that are not in
+ * the ranges
+ *
+ * @return VOID
+ */
+VOID
+MtrrMapBuild(PMTRR_MAP              Map,
+             const MTRR_MAP_RANGE * Ranges,
+             UINT32                 NumberOfRanges,
+             UINT8                  DefaultMemoryType)
+{
+    UINT32 Count = 0;
+
+    if (NumberOfRanges > MTRR_MAP_MAXIMUM_RANGES)
+    {
+        NumberOfRanges = MTRR_MAP_MAXIMUM_RANGES;
+    }
+
+    Map->NumberOfIntervals                = 1;
+    Map->Intervals[0].PhysicalBaseAddress = 0;
+
+    for (UINT32 i = 0; i < NumberOfRanges; i++)
+    {
+        MtrrMapAddBoundary(Map, Ranges[i].PhysicalBaseAddress);
+
+        //
+        // The range ends at the end of the address space
+        //
+        if (Ranges[i].PhysicalEndAddress != MAXUINT64)
+        {
+            MtrrMapAddBoundary(Map, Ranges[i].PhysicalEndAddress + 1);
+        }
+    }
+
+    //
+    // Get the memory type of each interval and merge it with the previous
+    // interval if they have the same memory type
+    //
+    for (UINT32 i = 0; i < Map->NumberOfIntervals; i++)
+    {
+        UINT8 MemoryType = MtrrMapGetRangesMemoryType(Ranges,
+                                                      NumberOfRanges,
+                                                      DefaultMemoryType,
+                                                      Map->Intervals[i].PhysicalBaseAddress);
+
+        if (Count != 0 && Map->Intervals[Count - 1].MemoryType == MemoryType)
+        {
+            continue;
+        }
+
+        Map->Intervals[Count].PhysicalBaseAddress = Map->Intervals[i].PhysicalBaseAddress;
+        Map->Intervals[Count].MemoryType          = MemoryType;
+        Count++;
+    }
+
+    Map->NumberOfIntervals = Count;
+}
+
+/**
+ * @brief Find the interval of an address
+ *
+ * @param Map
+ * @param PhysicalAddress
+ *
+ * @return UINT32 Index of the interval
+ */
+static UINT32
+MtrrMapFindInterval(const MTRR_MAP * Map, UINT64 PhysicalAddress)
+{
+    UINT32 Low  = 0;
+    UINT32 High = Map->NumberOfIntervals;
+
+    //
+    // The last interval that starts at or before the address
+    //
+    while (High - Low > 1)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (Map->Intervals[Middle].PhysicalBaseAddress <= PhysicalAddress)
+        {
+            Low = Middle;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return Low;
+}
+
+/**
+ * @brief Get the memory type of an address
+ *
+ * @param Map
+ * @param PhysicalAddress
+ *
+ * @return UINT8
+ */
+UINT8
+MtrrMapGetMemoryType(const MTRR_MAP * Map, UINT64 PhysicalAddress)
+{
+    return Map->Intervals[MtrrMapFindInterval(Map, PhysicalAddress)].MemoryType;
+}
+
+/**
+ * @brief Check whether all of the addresses of a range have the same memory
+ * type
+ *
+ * @param Map
+ * @param PhysicalAddress
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+MtrrMapIsUniform(const MTRR_MAP * Map, UINT64 PhysicalAddress, UINT64 Size)
+{
+    UINT32 Index = MtrrMapFindInterval(Map, PhysicalAddress);
+
+    //
+    // The next interval has a different memory type
+    //
+    return Index + 1 == Map->NumberOfIntervals ||
+           Map->Intervals[Index + 1].PhysicalBaseAddress - PhysicalAddress >= Size;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file MtrrMap.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the sorted interval map of the memory types of the MTRRs
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum ranges of the MTRRs (255 variable ranges and 88 fixed
+ * ranges)
+ *
+ */
+#define MTRR_MAP_MAXIMUM_RANGES 343
+
+/**
+ * @brief Each range adds at most two boundaries to the map
+ *
+ */
+#define MTRR_MAP_MAXIMUM_INTERVALS (2 * MTRR_MAP_MAXIMUM_RANGES + 1)
+
+/**
+ * @brief The memory types that have precedence rules when the ranges
+ * overlap
+ *
+ */
+#define MTRR_MAP_MEMORY_TYPE_UNCACHEABLE   0
+#define MTRR_MAP_MEMORY_TYPE_WRITE_THROUGH 4
+#define MTRR_MAP_MEMORY_TYPE_WRITE_BACK    6
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A range of the MTRRs
+ *
+ */
+typedef struct _MTRR_MAP_RANGE
+{
+    UINT64  PhysicalBaseAddress;
+    UINT64  PhysicalEndAddress; // Inclusive
+    UINT8   MemoryType;
+    BOOLEAN FixedRange;
+
+} MTRR_MAP_RANGE, *PMTRR_MAP_RANGE;
+
+/**
+ * @brief An interval of the map, it ends where the next interval starts
+ *
+ */
+typedef struct _MTRR_MAP_INTERVAL
+{
+    UINT64 PhysicalBaseAddress;
+    UINT8  MemoryType;
+
+} MTRR_MAP_INTERVAL, *PMTRR_MAP_INTERVAL;
+
+/**
+ * @brief The sorted and merged intervals of the memory types, the first
+ * interval starts at zero and the last interval has no end
+ *
+ */
+typedef struct _MTRR_MAP
+{
+    UINT32            NumberOfIntervals;
+    MTRR_MAP_INTERVAL Intervals[MTRR_MAP_MAXIMUM_INTERVALS];
+
+} MTRR_MAP, *PMTRR_MAP;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+MtrrMapBuild(PMTRR_MAP              Map,
+             const MTRR_MAP_RANGE * Ranges,
+             UINT32                 NumberOfRanges,
+             UINT8                  DefaultMemoryType);
+
+UINT8
+MtrrMapGetMemoryType(const MTRR_MAP * Map, UINT64 PhysicalAddress);
+
+BOOLEAN
+MtrrMapIsUniform(const MTRR_MAP * Map, UINT64 PhysicalAddress, UINT64 Size);
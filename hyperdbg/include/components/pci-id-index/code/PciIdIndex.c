@@ -0,0 +1,793 @@
+/**
+ * @file PciIdIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Binary index of the PCI ID database
+ * @details The pci.ids text is parsed once into sorted arrays of vendors,
+ * devices and subsystems (each of them points to its contiguous children)
+ * and a pool of interned names. IDs are then resolved with binary searches
+ * instead of rescanning the text
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Type of the lines of the pci.ids
+ *
+ */
+typedef enum _PCI_ID_INDEX_LINE_TYPE
+{
+    PCI_ID_INDEX_LINE_TYPE_OTHER,
+    PCI_ID_INDEX_LINE_TYPE_COMMENT,
+    PCI_ID_INDEX_LINE_TYPE_VENDOR,
+    PCI_ID_INDEX_LINE_TYPE_DEVICE,
+    PCI_ID_INDEX_LINE_TYPE_SUBSYSTEM
+
+} PCI_ID_INDEX_LINE_TYPE;
+
+/**
+ * @brief A parsed line of the pci.ids
+ *
+ */
+typedef struct _PCI_ID_INDEX_LINE
+{
+    PCI_ID_INDEX_LINE_TYPE Type;
+    UINT16                 FirstId;
+    UINT16                 SecondId;
+    const CHAR *           Name;
+    UINT32                 NameLength;
+
+} PCI_ID_INDEX_LINE, *PPCI_ID_INDEX_LINE;
+
+/**
+ * @brief State of building the index
+ *
+ */
+typedef struct _PCI_ID_INDEX_BUILDER
+{
+    PPCI_ID_INDEX_VENDOR    Vendors;
+    PPCI_ID_INDEX_DEVICE    Devices;
+    PPCI_ID_INDEX_SUBSYSTEM Subsystems;
+    CHAR *                  NamePool;
+    UINT32 *                NameTable; // Open addressing table of the offsets of the interned names
+    UINT32                  NameTableMask;
+    UINT32                  NumberOfVendors;
+    UINT32                  NumberOfDevices;
+    UINT32                  NumberOfSubsystems;
+    UINT32                  NamePoolSize;
+
+} PCI_ID_INDEX_BUILDER, *PPCI_ID_INDEX_BUILDER;
+
+/**
+ * @brief Get the vendors of the index
+ *
+ * @param Index
+ *
+ * @return const PCI_ID_INDEX_VENDOR *
+ */
+static const PCI_ID_INDEX_VENDOR *
+PciIdIndexGetVendors(const PCI_ID_INDEX_HEADER * Index)
+{
+    return (const PCI_ID_INDEX_VENDOR *)((const UINT8 *)Index + sizeof(PCI_ID_INDEX_HEADER));
+}
+
+/**
+ * @brief Get the devices of the index
+ *
+ * @param Index
+ *
+ * @return const PCI_ID_INDEX_DEVICE *
+ */
+static const PCI_ID_INDEX_DEVICE *
+PciIdIndexGetDevices(const PCI_ID_INDEX_HEADER * Index)
+{
+    return (const PCI_ID_INDEX_DEVICE *)(PciIdIndexGetVendors(Index) + Index->NumberOfVendors);
+}
+
+/**
+ * @brief Get the subsystems of the index
+ *
+ * @param Index
+ *
+ * @return const PCI_ID_INDEX_SUBSYSTEM *
+ */
+static const PCI_ID_INDEX_SUBSYSTEM *
+PciIdIndexGetSubsystems(const PCI_ID_INDEX_HEADER * Index)
+{
+    return (const PCI_ID_INDEX_SUBSYSTEM *)(PciIdIndexGetDevices(Index) + Index->NumberOfDevices);
+}
+
+/**
+ * @brief Get the pool of the names of the index
+ *
+ * @param Index
+ *
+ * @return const CHAR *
+ */
+static const CHAR *
+PciIdIndexGetNamePool(const PCI_ID_INDEX_HEADER * Index)
+{
+    return (const CHAR *)(PciIdIndexGetSubsystems(Index) + Index->NumberOfSubsystems);
+}
+
+/**
+ * @brief Parse an ID of four hex digits
+ *
+ * @param Text
+ * @param Id
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PciIdIndexParseId(const CHAR * Text, UINT16 * Id)
+{
+    UINT16 Value = 0;
+
+    for (UINT32 i = 0; i < 4; i++)
+    {
+        CHAR Digit = Text[i];
+
+        if (Digit >= '0' && Digit <= '9')
+        {
+            Value = (UINT16)((Value << 4) | (Digit - '0'));
+        }
+        else if (Digit >= 'a' && Digit <= 'f')
+        {
+            Value = (UINT16)((Value << 4) | (Digit - 'a' + 10));
+        }
+        else if (Digit >= 'A' && Digit <= 'F')
+        {
+            Value = (UINT16)((Value << 4) | (Digit - 'A' + 10));
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    *Id = Value;
+
+    return TRUE;
+}
+
+/**
+ * @brief Parse a line of the pci.ids
+ * @details The formats are "vvvv  name", "\tdddd  name" and "\t\tssss ssss  name"
+ *
+ * @param Text
+ * @param Length Length of the line (without the line break)
+ * @param Line
+ *
+ * @return VOID
+ */
+static VOID
+PciIdIndexParseLine(const CHAR * Text, UINT32 Length, PPCI_ID_INDEX_LINE Line)
+{
+    UINT32 NameStart;
+
+    Line->Type = PCI_ID_INDEX_LINE_TYPE_OTHER;
+
+    if (Length == 0 || Text[0] == '#')
+    {
+        Line->Type = PCI_ID_INDEX_LINE_TYPE_COMMENT;
+        return;
+    }
+
+    if (Text[0] != '\t')
+    {
+        if (Length < 6 || !PciIdIndexParseId(Text, &Line->FirstId) || Text[4] != ' ')
+        {
+            return;
+        }
+
+        Line->Type = PCI_ID_INDEX_LINE_TYPE_VENDOR;
+        NameStart  = 5;
+    }
+    else if (Length > 1 && Text[1] != '\t')
+    {
+        if (Length < 7 || !PciIdIndexParseId(&Text[1], &Line->FirstId) || Text[5] != ' ')
+        {
+            return;
+        }
+
+        Line->Type = PCI_ID_INDEX_LINE_TYPE_DEVICE;
+        NameStart  = 6;
+    }
+    else
+    {
+        if (Length < 13 || !PciIdIndexParseId(&Text[2], &Line->FirstId) || Text[6] != ' ' ||
+            !PciIdIndexParseId(&Text[7], &Line->SecondId) || Text[11] != ' ')
+        {
+            return;
+        }
+
+        Line->Type = PCI_ID_INDEX_LINE_TYPE_SUBSYSTEM;
+        NameStart  = 12;
+    }
+
+    //
+    // Trim the spaces of the name
+    //
+    while (NameStart < Length && Text[NameStart] == ' ')
+    {
+        NameStart++;
+    }
+
+    while (Length > NameStart && Text[Length - 1] == ' ')
+    {
+        Length--;
+    }
+
+    if (NameStart == Length)
+    {
+        Line->Type = PCI_ID_INDEX_LINE_TYPE_OTHER;
+        return;
+    }
+
+    Line->Name       = &Text[NameStart];
+    Line->NameLength = Length - NameStart;
+
+    if (Line->NameLength > PCI_ID_INDEX_MAXIMUM_NAME_LENGTH)
+    {
+        Line->NameLength = PCI_ID_INDEX_MAXIMUM_NAME_LENGTH;
+    }
+}
+
+/**
+ * @brief Add a name to the pool (once)
+ *
+ * @param Builder
+ * @param Name
+ * @param NameLength
+ *
+ * @return UINT32 offset of the name in the pool
+ */
+static UINT32
+PciIdIndexInternName(PPCI_ID_INDEX_BUILDER Builder, const CHAR * Name, UINT32 NameLength)
+{
+    UINT32 Hash = 2166136261u;
+    UINT32 Slot;
+    UINT32 Offset;
+
+    for (UINT32 i = 0; i < NameLength; i++)
+    {
+        Hash = (Hash ^ (UINT8)Name[i]) * 16777619u;
+    }
+
+    for (Slot = Hash & Builder->NameTableMask; Builder->NameTable[Slot] != 0; Slot = (Slot + 1) & Builder->NameTableMask)
+    {
+        Offset = Builder->NameTable[Slot];
+
+        if (memcmp(&Builder->NamePool[Offset], Name, NameLength) == 0 && Builder->NamePool[Offset + NameLength] == '\0')
+        {
+            return Offset;
+        }
+    }
+
+    Offset = Builder->NamePoolSize;
+
+    memcpy(&Builder->NamePool[Offset], Name, NameLength);
+    Builder->NamePool[Offset + NameLength] = '\0';
+
+    Builder->NamePoolSize += NameLength + 1;
+    Builder->NameTable[Slot] = Offset;
+
+    return Offset;
+}
+
+/**
+ * @brief Parse the pci.ids
+ * @details If the builder has no arrays, the entries are only counted
+ *
+ * @param Text
+ * @param Length
+ * @param Builder
+ * @param NamesLength Total length of the names (if counting)
+ *
+ * @return VOID
+ */
+static VOID
+PciIdIndexParse(const CHAR * Text, UINT64 Length, PPCI_ID_INDEX_BUILDER Builder, UINT64 * NamesLength)
+{
+    PCI_ID_INDEX_LINE Line;
+    UINT64            Offset     = 0;
+    UINT32            LineLength = 0;
+    BOOLEAN           IsCounting = Builder->Vendors == NULL;
+    BOOLEAN           InVendor   = FALSE;
+    BOOLEAN           InDevice   = FALSE;
+    UINT32            NameOffset = 0;
+    const CHAR *      LineStart  = NULL;
+    const CHAR *      LineBreak  = NULL;
+
+    while (Offset < Length)
+    {
+        LineStart = &Text[Offset];
+        LineBreak = (const CHAR *)memchr(LineStart, '\n', (size_t)(Length - Offset));
+
+        LineLength = LineBreak == NULL ? (UINT32)(Length - Offset) : (UINT32)(LineBreak - LineStart);
+        Offset += LineLength + 1;
+
+        if (LineLength != 0 && LineStart[LineLength - 1] == '\r')
+        {
+            LineLength--;
+        }
+
+        PciIdIndexParseLine(LineStart, LineLength, &Line);
+
+        switch (Line.Type)
+        {
+        case PCI_ID_INDEX_LINE_TYPE_COMMENT:
+
+            //
+            // Comments don't change the current vendor and device
+            //
+            continue;
+
+        case PCI_ID_INDEX_LINE_TYPE_OTHER:
+
+            //
+            // E.g., the classes ("C xx") at the end of the file
+            //
+            if (LineStart[0] != '\t')
+            {
+                InVendor = FALSE;
+            }
+
+            InDevice = FALSE;
+            continue;
+
+        case PCI_ID_INDEX_LINE_TYPE_DEVICE:
+
+            if (!InVendor)
+            {
+                continue;
+            }
+
+            break;
+
+        case PCI_ID_INDEX_LINE_TYPE_SUBSYSTEM:
+
+            if (!InDevice)
+            {
+                continue;
+            }
+
+            break;
+
+        default:
+            break;
+        }
+
+        if (IsCounting)
+        {
+            *NamesLength += Line.NameLength + 1;
+        }
+        else
+        {
+            NameOffset = PciIdIndexInternName(Builder, Line.Name, Line.NameLength);
+        }
+
+        if (Line.Type == PCI_ID_INDEX_LINE_TYPE_VENDOR)
+        {
+            if (!IsCounting)
+            {
+                PPCI_ID_INDEX_VENDOR Vendor = &Builder->Vendors[Builder->NumberOfVendors];
+
+                Vendor->VendorId        = Line.FirstId;
+                Vendor->Reserved        = 0;
+                Vendor->NameOffset      = NameOffset;
+                Vendor->FirstDevice     = Builder->NumberOfDevices;
+                Vendor->NumberOfDevices = 0;
+            }
+
+            Builder->NumberOfVendors++;
+            InVendor = TRUE;
+            InDevice = FALSE;
+        }
+        else if (Line.Type == PCI_ID_INDEX_LINE_TYPE_DEVICE)
+        {
+            if (!IsCounting)
+            {
+                PPCI_ID_INDEX_DEVICE Device = &Builder->Devices[Builder->NumberOfDevices];
+
+                Device->DeviceId           = Line.FirstId;
+                Device->Reserved           = 0;
+                Device->NameOffset         = NameOffset;
+                Device->FirstSubsystem     = Builder->NumberOfSubsystems;
+                Device->NumberOfSubsystems = 0;
+
+                Builder->Vendors[Builder->NumberOfVendors - 1].NumberOfDevices++;
+            }
+
+            Builder->NumberOfDevices++;
+            InDevice = TRUE;
+        }
+        else
+        {
+            if (!IsCounting)
+            {
+                PPCI_ID_INDEX_SUBSYSTEM Subsystem = &Builder->Subsystems[Builder->NumberOfSubsystems];
+
+                Subsystem->SubVendorId = Line.FirstId;
+                Subsystem->SubDeviceId = Line.SecondId;
+                Subsystem->NameOffset  = NameOffset;
+
+                Builder->Devices[Builder->NumberOfDevices - 1].NumberOfSubsystems++;
+            }
+
+            Builder->NumberOfSubsystems++;
+        }
+    }
+}
+
+/**
+ * @brief Compare two vendors (the first entry of the file wins on duplicates)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return int
+ */
+static int
+PciIdIndexCompareVendors(const void * First, const void * Second)
+{
+    const PCI_ID_INDEX_VENDOR * FirstVendor  = (const PCI_ID_INDEX_VENDOR *)First;
+    const PCI_ID_INDEX_VENDOR * SecondVendor = (const PCI_ID_INDEX_VENDOR *)Second;
+
+    if (FirstVendor->VendorId != SecondVendor->VendorId)
+    {
+        return FirstVendor->VendorId < SecondVendor->VendorId ? -1 : 1;
+    }
+
+    return FirstVendor->FirstDevice < SecondVendor->FirstDevice ? -1 : (FirstVendor->FirstDevice > SecondVendor->FirstDevice);
+}
+
+/**
+ * @brief Compare two devices (the first entry of the file wins on duplicates)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return int
+ */
+static int
+PciIdIndexCompareDevices(const void * First, const void * Second)
+{
+    const PCI_ID_INDEX_DEVICE * FirstDevice  = (const PCI_ID_INDEX_DEVICE *)First;
+    const PCI_ID_INDEX_DEVICE * SecondDevice = (const PCI_ID_INDEX_DEVICE *)Second;
+
+    if (FirstDevice->DeviceId != SecondDevice->DeviceId)
+    {
+        return FirstDevice->DeviceId < SecondDevice->DeviceId ? -1 : 1;
+    }
+
+    return FirstDevice->FirstSubsystem < SecondDevice->FirstSubsystem ? -1 : (FirstDevice->FirstSubsystem > SecondDevice->FirstSubsystem);
+}
+
+/**
+ * @brief Compare two subsystems
+ *
+ * @param First
+ * @param Second
+ *
+ * @return int
+ */
+static int
+PciIdIndexCompareSubsystems(const void * First, const void * Second)
+{
+    const PCI_ID_INDEX_SUBSYSTEM * FirstSubsystem  = (const PCI_ID_INDEX_SUBSYSTEM *)First;
+    const PCI_ID_INDEX_SUBSYSTEM * SecondSubsystem = (const PCI_ID_INDEX_SUBSYSTEM *)Second;
+    UINT32                         FirstKey        = ((UINT32)FirstSubsystem->SubVendorId << 16) | FirstSubsystem->SubDeviceId;
+    UINT32                         SecondKey       = ((UINT32)SecondSubsystem->SubVendorId << 16) | SecondSubsystem->SubDeviceId;
+
+    return FirstKey < SecondKey ? -1 : (FirstKey > SecondKey);
+}
+
+/**
+ * @brief Build the index of a pci.ids
+ * @details The returned index should be freed with free()
+ *
+ * @param Text The content of the pci.ids
+ * @param Length
+ * @param SourceTimestamp Last write time of the pci.ids (to detect the stale indexes)
+ *
+ * @return PPCI_ID_INDEX_HEADER NULL if there is not enough memory
+ */
+PPCI_ID_INDEX_HEADER
+PciIdIndexBuild(const CHAR * Text, UINT64 Length, UINT64 SourceTimestamp)
+{
+    PCI_ID_INDEX_BUILDER Builder     = {0};
+    PPCI_ID_INDEX_HEADER Index       = NULL;
+    PPCI_ID_INDEX_HEADER ShrunkIndex = NULL;
+    UINT64               NamesLength = 1;
+    UINT64               ArraysSize;
+    UINT32               NameTableSize = 16;
+
+    //
+    // Count the entries and the length of the names
+    //
+    PciIdIndexParse(Text, Length, &Builder, &NamesLength);
+
+    ArraysSize = (UINT64)Builder.NumberOfVendors * sizeof(PCI_ID_INDEX_VENDOR) +
+                 (UINT64)Builder.NumberOfDevices * sizeof(PCI_ID_INDEX_DEVICE) +
+                 (UINT64)Builder.NumberOfSubsystems * sizeof(PCI_ID_INDEX_SUBSYSTEM);
+
+    if (sizeof(PCI_ID_INDEX_HEADER) + ArraysSize + NamesLength > MAXUINT32)
+    {
+        return NULL;
+    }
+
+    while (NameTableSize < (Builder.NumberOfVendors + Builder.NumberOfDevices + Builder.NumberOfSubsystems) * 2)
+    {
+        NameTableSize <<= 1;
+    }
+
+    Index             = (PPCI_ID_INDEX_HEADER)malloc((size_t)(sizeof(PCI_ID_INDEX_HEADER) + ArraysSize + NamesLength));
+    Builder.NameTable = (UINT32 *)calloc(NameTableSize, sizeof(UINT32));
+
+    if (Index == NULL || Builder.NameTable == NULL)
+    {
+        free(Index);
+        free(Builder.NameTable);
+        return NULL;
+    }
+
+    Index->Magic              = PCI_ID_INDEX_MAGIC;
+    Index->Version            = PCI_ID_INDEX_VERSION;
+    Index->SourceSize         = Length;
+    Index->SourceTimestamp    = SourceTimestamp;
+    Index->NumberOfVendors    = Builder.NumberOfVendors;
+    Index->NumberOfDevices    = Builder.NumberOfDevices;
+    Index->NumberOfSubsystems = Builder.NumberOfSubsystems;
+
+    //
+    // Fill the entries and the names (the empty name is at offset 0)
+    //
+    Builder.Vendors            = (PPCI_ID_INDEX_VENDOR)PciIdIndexGetVendors(Index);
+    Builder.Devices            = (PPCI_ID_INDEX_DEVICE)PciIdIndexGetDevices(Index);
+    Builder.Subsystems         = (PPCI_ID_INDEX_SUBSYSTEM)PciIdIndexGetSubsystems(Index);
+    Builder.NamePool           = (CHAR *)PciIdIndexGetNamePool(Index);
+    Builder.NameTableMask      = NameTableSize - 1;
+    Builder.NumberOfVendors    = 0;
+    Builder.NumberOfDevices    = 0;
+    Builder.NumberOfSubsystems = 0;
+    Builder.NamePool[0]        = '\0';
+    Builder.NamePoolSize       = 1;
+
+    PciIdIndexParse(Text, Length, &Builder, NULL);
+
+    free(Builder.NameTable);
+
+    //
+    // Sort the entries, the children of each entry are sorted in place
+    // so the ranges of the children are still valid
+    //
+    for (UINT32 i = 0; i < Builder.NumberOfDevices; i++)
+    {
+        qsort(&Builder.Subsystems[Builder.Devices[i].FirstSubsystem],
+              Builder.Devices[i].NumberOfSubsystems,
+              sizeof(PCI_ID_INDEX_SUBSYSTEM),
+              PciIdIndexCompareSubsystems);
+    }
+
+    for (UINT32 i = 0; i < Builder.NumberOfVendors; i++)
+    {
+        qsort(&Builder.Devices[Builder.Vendors[i].FirstDevice],
+              Builder.Vendors[i].NumberOfDevices,
+              sizeof(PCI_ID_INDEX_DEVICE),
+              PciIdIndexCompareDevices);
+    }
+
+    qsort(Builder.Vendors, Builder.NumberOfVendors, sizeof(PCI_ID_INDEX_VENDOR), PciIdIndexCompareVendors);
+
+    Index->NamePoolSize = Builder.NamePoolSize;
+    Index->TotalSize    = (UINT32)(sizeof(PCI_ID_INDEX_HEADER) + ArraysSize + Builder.NamePoolSize);
+
+    //
+    // Release the space of the duplicated names
+    //
+    ShrunkIndex = (PPCI_ID_INDEX_HEADER)realloc(Index, Index->TotalSize);
+
+    return ShrunkIndex != NULL ? ShrunkIndex : Index;
+}
+
+/**
+ * @brief Check whether an index (e.g., loaded from the disk) is valid and
+ * belongs to the current pci.ids
+ *
+ * @param Index
+ * @param IndexSize
+ * @param SourceSize Size of the pci.ids
+ * @param SourceTimestamp Last write time of the pci.ids
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PciIdIndexIsValid(const PCI_ID_INDEX_HEADER * Index, UINT64 IndexSize, UINT64 SourceSize, UINT64 SourceTimestamp)
+{
+    const PCI_ID_INDEX_VENDOR *    Vendors;
+    const PCI_ID_INDEX_DEVICE *    Devices;
+    const PCI_ID_INDEX_SUBSYSTEM * Subsystems;
+    UINT64                         ExpectedSize;
+
+    if (IndexSize < sizeof(PCI_ID_INDEX_HEADER) ||
+        Index->Magic != PCI_ID_INDEX_MAGIC ||
+        Index->Version != PCI_ID_INDEX_VERSION ||
+        Index->TotalSize != IndexSize ||
+        Index->SourceSize != SourceSize ||
+        Index->SourceTimestamp != SourceTimestamp ||
+        Index->NamePoolSize == 0)
+    {
+        return FALSE;
+    }
+
+    ExpectedSize = sizeof(PCI_ID_INDEX_HEADER) +
+                   (UINT64)Index->NumberOfVendors * sizeof(PCI_ID_INDEX_VENDOR) +
+                   (UINT64)Index->NumberOfDevices * sizeof(PCI_ID_INDEX_DEVICE) +
+                   (UINT64)Index->NumberOfSubsystems * sizeof(PCI_ID_INDEX_SUBSYSTEM) +
+                   Index->NamePoolSize;
+
+    if (ExpectedSize != IndexSize || PciIdIndexGetNamePool(Index)[Index->NamePoolSize - 1] != '\0')
+    {
+        return FALSE;
+    }
+
+    Vendors    = PciIdIndexGetVendors(Index);
+    Devices    = PciIdIndexGetDevices(Index);
+    Subsystems = PciIdIndexGetSubsystems(Index);
+
+    for (UINT32 i = 0; i < Index->NumberOfVendors; i++)
+    {
+        if (Vendors[i].NameOffset >= Index->NamePoolSize ||
+            (UINT64)Vendors[i].FirstDevice + Vendors[i].NumberOfDevices > Index->NumberOfDevices)
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 i = 0; i < Index->NumberOfDevices; i++)
+    {
+        if (Devices[i].NameOffset >= Index->NamePoolSize ||
+            (UINT64)Devices[i].FirstSubsystem + Devices[i].NumberOfSubsystems > Index->NumberOfSubsystems)
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 i = 0; i < Index->NumberOfSubsystems; i++)
+    {
+        if (Subsystems[i].NameOffset >= Index->NamePoolSize)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a vendor
+ *
+ * @param Index
+ * @param VendorId
+ *
+ * @return const PCI_ID_INDEX_VENDOR * NULL if not found
+ */
+const PCI_ID_INDEX_VENDOR *
+PciIdIndexFindVendor(const PCI_ID_INDEX_HEADER * Index, UINT16 VendorId)
+{
+    const PCI_ID_INDEX_VENDOR * Vendors = PciIdIndexGetVendors(Index);
+    UINT32                      Low     = 0;
+    UINT32                      High    = Index->NumberOfVendors;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (Vendors[Middle].VendorId < VendorId)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return Low < Index->NumberOfVendors && Vendors[Low].VendorId == VendorId ? &Vendors[Low] : NULL;
+}
+
+/**
+ * @brief Find a device of a vendor
+ *
+ * @param Index
+ * @param Vendor
+ * @param DeviceId
+ *
+ * @return const PCI_ID_INDEX_DEVICE * NULL if not found
+ */
+const PCI_ID_INDEX_DEVICE *
+PciIdIndexFindDevice(const PCI_ID_INDEX_HEADER * Index, const PCI_ID_INDEX_VENDOR * Vendor, UINT16 DeviceId)
+{
+    const PCI_ID_INDEX_DEVICE * Devices = PciIdIndexGetDevices(Index) + Vendor->FirstDevice;
+    UINT32                      Low     = 0;
+    UINT32                      High    = Vendor->NumberOfDevices;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (Devices[Middle].DeviceId < DeviceId)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return Low < Vendor->NumberOfDevices && Devices[Low].DeviceId == DeviceId ? &Devices[Low] : NULL;
+}
+
+/**
+ * @brief Find a subsystem of a device
+ *
+ * @param Index
+ * @param Device
+ * @param SubVendorId
+ * @param SubDeviceId
+ *
+ * @return const PCI_ID_INDEX_SUBSYSTEM * NULL if not found
+ */
+const PCI_ID_INDEX_SUBSYSTEM *
+PciIdIndexFindSubsystem(const PCI_ID_INDEX_HEADER * Index,
+                        const PCI_ID_INDEX_DEVICE * Device,
+                        UINT16                      SubVendorId,
+                        UINT16                      SubDeviceId)
+{
+    const PCI_ID_INDEX_SUBSYSTEM * Subsystems = PciIdIndexGetSubsystems(Index) + Device->FirstSubsystem;
+    UINT32                         Key        = ((UINT32)SubVendorId << 16) | SubDeviceId;
+    UINT32                         Low        = 0;
+    UINT32                         High       = Device->NumberOfSubsystems;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if ((((UINT32)Subsystems[Middle].SubVendorId << 16) | Subsystems[Middle].SubDeviceId) < Key)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low < Device->NumberOfSubsystems &&
+        Subsystems[Low].SubVendorId == SubVendorId &&
+        Subsystems[Low].SubDeviceId == SubDeviceId)
+    {
+        return &Subsystems[Low];
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Get a name of the index
+ *
+ * @param Index
+ * @param NameOffset
+ *
+ * @return const CHAR *
+ */
+const CHAR *
+PciIdIndexGetName(const PCI_ID_INDEX_HEADER * Index, UINT32 NameOffset)
+{
+    return &PciIdIndexGetNamePool(Index)[NameOffset];
+}
@@ -0,0 +1,124 @@
+/**
+ * @file PciIdIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the binary index of the PCI ID database
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Magic of the index ('PIDX')
+ *
+ */
+#define PCI_ID_INDEX_MAGIC 0x58444950
+
+/**
+ * @brief Version of the layout of the index
+ *
+ */
+#define PCI_ID_INDEX_VERSION 1
+
+/**
+ * @brief Maximum length of the names (same as the previous parser)
+ *
+ */
+#define PCI_ID_INDEX_MAXIMUM_NAME_LENGTH 254
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Header of the index
+ * @details The index is a single position-independent blob, so it is saved
+ * on the disk as is. The header is followed by the sorted vendors, devices
+ * and subsystems, and then the pool of the (interned) names
+ *
+ */
+typedef struct _PCI_ID_INDEX_HEADER
+{
+    UINT32 Magic;
+    UINT32 Version;
+    UINT64 SourceSize;      // Size of the pci.ids file
+    UINT64 SourceTimestamp; // Last write time of the pci.ids file
+    UINT32 NumberOfVendors;
+    UINT32 NumberOfDevices;
+    UINT32 NumberOfSubsystems;
+    UINT32 NamePoolSize;
+    UINT32 TotalSize;
+
+} PCI_ID_INDEX_HEADER, *PPCI_ID_INDEX_HEADER;
+
+/**
+ * @brief A vendor of the index, its devices are contiguous and sorted
+ *
+ */
+typedef struct _PCI_ID_INDEX_VENDOR
+{
+    UINT16 VendorId;
+    UINT16 Reserved;
+    UINT32 NameOffset;
+    UINT32 FirstDevice;
+    UINT32 NumberOfDevices;
+
+} PCI_ID_INDEX_VENDOR, *PPCI_ID_INDEX_VENDOR;
+
+/**
+ * @brief A device of the index, its subsystems are contiguous and sorted
+ *
+ */
+typedef struct _PCI_ID_INDEX_DEVICE
+{
+    UINT16 DeviceId;
+    UINT16 Reserved;
+    UINT32 NameOffset;
+    UINT32 FirstSubsystem;
+    UINT32 NumberOfSubsystems;
+
+} PCI_ID_INDEX_DEVICE, *PPCI_ID_INDEX_DEVICE;
+
+/**
+ * @brief A subsystem of the index
+ *
+ */
+typedef struct _PCI_ID_INDEX_SUBSYSTEM
+{
+    UINT16 SubVendorId;
+    UINT16 SubDeviceId;
+    UINT32 NameOffset;
+
+} PCI_ID_INDEX_SUBSYSTEM, *PPCI_ID_INDEX_SUBSYSTEM;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+PPCI_ID_INDEX_HEADER
+PciIdIndexBuild(const CHAR * Text, UINT64 Length, UINT64 SourceTimestamp);
+
+BOOLEAN
+PciIdIndexIsValid(const PCI_ID_INDEX_HEADER * Index, UINT64 IndexSize, UINT64 SourceSize, UINT64 SourceTimestamp);
+
+const PCI_ID_INDEX_VENDOR *
+PciIdIndexFindVendor(const PCI_ID_INDEX_HEADER * Index, UINT16 VendorId);
+
+const PCI_ID_INDEX_DEVICE *
+PciIdIndexFindDevice(const PCI_ID_INDEX_HEADER * Index, const PCI_ID_INDEX_VENDOR * Vendor, UINT16 DeviceId);
+
+const PCI_ID_INDEX_SUBSYSTEM *
+PciIdIndexFindSubsystem(const PCI_ID_INDEX_HEADER * Index,
+                        const PCI_ID_INDEX_DEVICE * Device,
+                        UINT16                      SubVendorId,
+                        UINT16                      SubDeviceId);
+
+const CHAR *
+PciIdIndexGetName(const PCI_ID_INDEX_HEADER * Index, UINT32 NameOffset);
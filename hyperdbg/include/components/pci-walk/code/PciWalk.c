@@ -0,0 +1,219 @@
+/**
+ * @file PciWalk.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Topology-aware enumeration of the PCI devices
+ * @details Instead of probing each bus, device and function, the walk starts
+ * from the root bus (and the buses of the host bridges), probes the functions
+ * 1-7 of the multi-function devices only, and goes to the buses behind the
+ * PCI-to-PCI bridges (their secondary bus numbers)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Read a DWORD of the configuration space
+ *
+ * @param Walk
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param Offset
+ *
+ * @return UINT32
+ */
+static UINT32
+PciWalkRead(PPCI_WALK Walk, UINT8 Bus, UINT8 Device, UINT8 Function, UINT8 Offset)
+{
+    Walk->NumberOfReads++;
+
+    return Walk->Read(Bus, Device, Function, Offset, Walk->Context);
+}
+
+/**
+ * @brief Check whether a function is present
+ *
+ * @param DeviceIdVendorId
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PciWalkIsPresent(UINT32 DeviceIdVendorId)
+{
+    return (DeviceIdVendorId & 0xffff) != 0xffff;
+}
+
+/**
+ * @brief Report a present function and queue the bus behind it (if it's a bridge)
+ *
+ * @param Walk
+ * @param Bus
+ * @param Device
+ * @param Function
+ * @param DeviceIdVendorId
+ * @param HeaderType
+ * @param PendingBuses
+ *
+ * @return BOOLEAN FALSE if the walk is stopped
+ */
+static BOOLEAN
+PciWalkScanFunction(PPCI_WALK Walk,
+                    UINT8     Bus,
+                    UINT8     Device,
+                    UINT8     Function,
+                    UINT32    DeviceIdVendorId,
+                    UINT8     HeaderType,
+                    UINT64 *  PendingBuses)
+{
+    UINT32 ClassCodeRevision = PciWalkRead(Walk, Bus, Device, Function, PCI_WALK_OFFSET_CLASS_CODE_REVISION);
+    UINT32 BusNumbers;
+    UINT32 SecondaryBus;
+    UINT32 SubordinateBus;
+
+    if (!Walk->Function(Bus, Device, Function, DeviceIdVendorId, ClassCodeRevision, Walk->Context))
+    {
+        Walk->IsStopped = TRUE;
+        return FALSE;
+    }
+
+    Walk->NumberOfFunctions++;
+
+    if ((HeaderType & PCI_WALK_HEADER_TYPE_MASK) == PCI_WALK_HEADER_TYPE_PCI_BRIDGE)
+    {
+        BusNumbers     = PciWalkRead(Walk, Bus, Device, Function, PCI_WALK_OFFSET_BRIDGE_BUS_NUMBERS);
+        SecondaryBus   = (BusNumbers >> 8) & 0xff;
+        SubordinateBus = (BusNumbers >> 16) & 0xff;
+
+        //
+        // The bridges that are not configured have a secondary bus of 0, and the
+        // buses behind a bridge are always above the bus of the bridge
+        //
+        if (SecondaryBus > Bus && SecondaryBus <= SubordinateBus)
+        {
+            PendingBuses[SecondaryBus / 64] |= 1ull << (SecondaryBus % 64);
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Probe the devices of a bus
+ *
+ * @param Walk
+ * @param Bus
+ * @param PendingBuses
+ *
+ * @return VOID
+ */
+static VOID
+PciWalkScanBus(PPCI_WALK Walk, UINT8 Bus, UINT64 * PendingBuses)
+{
+    UINT32 DeviceIdVendorId;
+    UINT8  HeaderType;
+
+    for (UINT8 d = 0; d < DEVICE_MAX_NUM; d++)
+    {
+        DeviceIdVendorId = PciWalkRead(Walk, Bus, d, 0, PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID);
+
+        if (!PciWalkIsPresent(DeviceIdVendorId))
+        {
+            continue;
+        }
+
+        HeaderType = (UINT8)(PciWalkRead(Walk, Bus, d, 0, PCI_WALK_OFFSET_HEADER_TYPE) >> 16);
+
+        if (!PciWalkScanFunction(Walk, Bus, d, 0, DeviceIdVendorId, HeaderType, PendingBuses))
+        {
+            return;
+        }
+
+        //
+        // The other functions are only implemented by the multi-function devices
+        //
+        if (!(HeaderType & PCI_WALK_HEADER_TYPE_MULTI_FUNCTION))
+        {
+            continue;
+        }
+
+        for (UINT8 f = 1; f < FUNCTION_MAX_NUM; f++)
+        {
+            DeviceIdVendorId = PciWalkRead(Walk, Bus, d, f, PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID);
+
+            if (!PciWalkIsPresent(DeviceIdVendorId))
+            {
+                continue;
+            }
+
+            HeaderType = (UINT8)(PciWalkRead(Walk, Bus, d, f, PCI_WALK_OFFSET_HEADER_TYPE) >> 16);
+
+            if (!PciWalkScanFunction(Walk, Bus, d, f, DeviceIdVendorId, HeaderType, PendingBuses))
+            {
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Enumerate the PCI functions by following the topology
+ * @details The buses are scanned in ascending order, so the functions are
+ * reported in the same order as probing all of the bus, device and function
+ * numbers
+ *
+ * @param Walk
+ *
+ * @return VOID
+ */
+VOID
+PciWalkTopology(PPCI_WALK Walk)
+{
+    UINT64 PendingBuses[PCI_WALK_NUMBER_OF_BUSES / 64] = {0};
+    UINT32 DeviceIdVendorId;
+    UINT32 Bus;
+
+    Walk->NumberOfReads     = 0;
+    Walk->NumberOfFunctions = 0;
+    Walk->NumberOfBuses     = 0;
+    Walk->IsStopped         = FALSE;
+
+    PendingBuses[0] = 1;
+
+    //
+    // If the host bridge (00:00.0) is a multi-function device, each of its
+    // functions is the host bridge of the bus with the same number
+    //
+    if (PciWalkIsPresent(PciWalkRead(Walk, 0, 0, 0, PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID)) &&
+        (PciWalkRead(Walk, 0, 0, 0, PCI_WALK_OFFSET_HEADER_TYPE) >> 16) & PCI_WALK_HEADER_TYPE_MULTI_FUNCTION)
+    {
+        for (UINT8 f = 1; f < FUNCTION_MAX_NUM; f++)
+        {
+            DeviceIdVendorId = PciWalkRead(Walk, 0, 0, f, PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID);
+
+            if (PciWalkIsPresent(DeviceIdVendorId) &&
+                (PciWalkRead(Walk, 0, 0, f, PCI_WALK_OFFSET_CLASS_CODE_REVISION) >> 16) == ((PCI_WALK_CLASS_BRIDGE << 8) | PCI_WALK_SUBCLASS_HOST_BRIDGE))
+            {
+                PendingBuses[0] |= 1ull << f;
+            }
+        }
+    }
+
+    //
+    // Scan the pending buses in ascending order, the buses behind a bridge are
+    // above the bus of the bridge, so they're queued before they're reached
+    //
+    for (Bus = 0; Bus < BUS_MAX_NUM && !Walk->IsStopped; Bus++)
+    {
+        if (!(PendingBuses[Bus / 64] & (1ull << (Bus % 64))))
+        {
+            continue;
+        }
+
+        Walk->NumberOfBuses++;
+
+        PciWalkScanBus(Walk, (UINT8)Bus, PendingBuses);
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file PciWalk.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the topology-aware enumeration of the PCI devices
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Offsets of the registers of the configuration space
+ *
+ */
+#define PCI_WALK_OFFSET_DEVICE_ID_VENDOR_ID 0x00
+#define PCI_WALK_OFFSET_CLASS_CODE_REVISION 0x08
+#define PCI_WALK_OFFSET_HEADER_TYPE         0x0c // DWORD of the cache line size, latency timer, header type and BIST
+#define PCI_WALK_OFFSET_BRIDGE_BUS_NUMBERS  0x18 // DWORD of the primary, secondary and subordinate bus numbers
+
+/**
+ * @brief Header types and classes of the configuration space
+ *
+ */
+#define PCI_WALK_HEADER_TYPE_MULTI_FUNCTION 0x80
+#define PCI_WALK_HEADER_TYPE_MASK           0x7f
+#define PCI_WALK_HEADER_TYPE_PCI_BRIDGE     0x01
+#define PCI_WALK_CLASS_BRIDGE               0x06
+#define PCI_WALK_SUBCLASS_HOST_BRIDGE       0x00
+
+/**
+ * @brief Number of the bus numbers (and the size of the bitmaps of buses)
+ *
+ */
+#define PCI_WALK_NUMBER_OF_BUSES 256
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that reads a DWORD of the configuration space of a function,
+ * it should return 0xffffffff if the function is not present
+ *
+ */
+typedef UINT32 (*PCI_WALK_READ_CALLBACK)(UINT8 Bus, UINT8 Device, UINT8 Function, UINT8 Offset, PVOID Context);
+
+/**
+ * @brief Callback that receives the present functions (in the order of their
+ * bus, device and function numbers), it returns FALSE to stop the walk
+ *
+ */
+typedef BOOLEAN (*PCI_WALK_FUNCTION_CALLBACK)(UINT8  Bus,
+                                              UINT8  Device,
+                                              UINT8  Function,
+                                              UINT32 DeviceIdVendorId,
+                                              UINT32 ClassCodeRevision,
+                                              PVOID  Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The walk of the PCI topology
+ *
+ */
+typedef struct _PCI_WALK
+{
+    PCI_WALK_READ_CALLBACK     Read;
+    PCI_WALK_FUNCTION_CALLBACK Function;
+    PVOID                      Context;
+
+    //
+    // Results
+    //
+    UINT32  NumberOfReads;
+    UINT32  NumberOfFunctions;
+    UINT32  NumberOfBuses;
+    BOOLEAN IsStopped;
+
+} PCI_WALK, *PPCI_WALK;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+PciWalkTopology(PPCI_WALK Walk);
@@ -0,0 +1,1163 @@
+/**
+ * @file PtDecode.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Decoder of the Intel Processor Trace packets
+ * @details The packets are decoded one by one, and the executed
+ * instructions are rebuilt by walking the instructions of the traced
+ * program from the IP of the last TIP.PGE, FUP or PSB+. The conditional
+ * branches take the TNT bits, the indirect branches take the TIPs, and the
+ * compressed returns take their targets from a stack of the calls (the
+ * same as the processor). The instructions are classified by a callback,
+ * so the decoder doesn't depend on the disassembler or on the way that
+ * the memory of the traced program is read
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Bytes of the IP of each IP compression (IPBytes)
+ *
+ */
+static const UINT32 PtDecodeIpPayloadSizes[8] = {0, 2, 4, 6, 6, 0, 8, 0};
+
+/**
+ * @brief Read a little-endian value from the packet
+ *
+ * @param Bytes
+ * @param Count
+ *
+ * @return UINT64
+ */
+static UINT64
+PtDecodeReadValue(const UINT8 * Bytes, UINT32 Count)
+{
+    UINT64 Value = 0;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Value |= (UINT64)Bytes[i] << (i * 8);
+    }
+
+    return Value;
+}
+
+/**
+ * @brief Separate the bits of TNT from its stop bit (the most significant
+ * set bit)
+ *
+ * @param Value
+ * @param Packet
+ *
+ * @return BOOLEAN FALSE if there is no stop bit
+ */
+static BOOLEAN
+PtDecodeTnt(UINT64 Value, PPT_DECODE_PACKET Packet)
+{
+    UINT32 StopBit = 0;
+
+    if (Value == 0)
+    {
+        return FALSE;
+    }
+
+    while ((Value >> StopBit) > 1)
+    {
+        StopBit++;
+    }
+
+    Packet->TntCount = StopBit;
+    Packet->Payload  = Value & ~(1ull << StopBit);
+
+    return TRUE;
+}
+
+/**
+ * @brief Decompress the IP of TIP, TIP.PGE, TIP.PGD and FUP
+ * @details The compressed IPs only contain the lower bytes that are
+ * different from the last IP
+ *
+ * @param Decoder
+ * @param Bytes The packet (the header is the first byte)
+ * @param Packet
+ *
+ * @return VOID
+ */
+static VOID
+PtDecodeIp(PPT_DECODER Decoder, const UINT8 * Bytes, PPT_DECODE_PACKET Packet)
+{
+    UINT64 Value = PtDecodeReadValue(&Bytes[1], PtDecodeIpPayloadSizes[Packet->IpBytes]);
+
+    switch (Packet->IpBytes)
+    {
+    case 0:
+
+        //
+        // The IP is suppressed, the last IP is not changed
+        //
+        Packet->Payload = 0;
+        return;
+
+    case 1:
+        Value |= Decoder->LastIp & ~0xffffull;
+        break;
+
+    case 2:
+        Value |= Decoder->LastIp & ~0xffffffffull;
+        break;
+
+    case 3:
+
+        //
+        // Sign-extended from bit 47
+        //
+        if ((Value & (1ull << 47)) != 0)
+        {
+            Value |= 0xffff000000000000ull;
+        }
+        break;
+
+    case 4:
+        Value |= Decoder->LastIp & 0xffff000000000000ull;
+        break;
+
+    default:
+        break;
+    }
+
+    Decoder->LastIp = Value;
+    Packet->Payload = Value;
+}
+
+/**
+ * @brief Find the type and the size of a packet that starts with 0x02
+ *
+ * @param Bytes
+ * @param Remaining Bytes that are available in the stream
+ * @param Packet
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeExtendedPacketType(const UINT8 * Bytes, UINT64 Remaining, PPT_DECODE_PACKET Packet)
+{
+    UINT8 Opcode;
+
+    if (Remaining < 2)
+    {
+        return PT_DECODE_STATUS_END_OF_STREAM;
+    }
+
+    Opcode = Bytes[1];
+
+    switch (Opcode)
+    {
+    case 0x82:
+        Packet->Type = PT_DECODE_PACKET_TYPE_PSB;
+        Packet->Size = PT_DECODE_PSB_SIZE;
+        break;
+    case 0x23:
+        Packet->Type = PT_DECODE_PACKET_TYPE_PSBEND;
+        Packet->Size = 2;
+        break;
+    case 0xa3:
+        Packet->Type = PT_DECODE_PACKET_TYPE_TNT;
+        Packet->Size = 8;
+        break;
+    case 0x43:
+        Packet->Type = PT_DECODE_PACKET_TYPE_PIP;
+        Packet->Size = 8;
+        break;
+    case 0x03:
+        Packet->Type = PT_DECODE_PACKET_TYPE_CBR;
+        Packet->Size = 4;
+        break;
+    case 0x73:
+        Packet->Type = PT_DECODE_PACKET_TYPE_TMA;
+        Packet->Size = 7;
+        break;
+    case 0xf3:
+        Packet->Type = PT_DECODE_PACKET_TYPE_OVF;
+        Packet->Size = 2;
+        break;
+    case 0x83:
+        Packet->Type = PT_DECODE_PACKET_TYPE_TRACE_STOP;
+        Packet->Size = 2;
+        break;
+    case 0xc8:
+        Packet->Type = PT_DECODE_PACKET_TYPE_VMCS;
+        Packet->Size = 7;
+        break;
+    case 0xc3:
+        Packet->Type = PT_DECODE_PACKET_TYPE_MNT;
+        Packet->Size = 11;
+        break;
+    case 0xc2:
+        Packet->Type = PT_DECODE_PACKET_TYPE_MWAIT;
+        Packet->Size = 10;
+        break;
+    case 0x22:
+        Packet->Type = PT_DECODE_PACKET_TYPE_PWRE;
+        Packet->Size = 4;
+        break;
+    case 0xa2:
+        Packet->Type = PT_DECODE_PACKET_TYPE_PWRX;
+        Packet->Size = 7;
+        break;
+    default:
+
+        if ((Opcode & 0x1f) == 0x12 && (Opcode & 0x60) <= 0x20)
+        {
+            //
+            // PTWRITE with a 4 or 8 bytes payload
+            //
+            Packet->Type = PT_DECODE_PACKET_TYPE_PTW;
+            Packet->Size = (Opcode & 0x60) == 0 ? 6 : 10;
+        }
+        else if ((Opcode & 0x7f) == 0x62)
+        {
+            Packet->Type = PT_DECODE_PACKET_TYPE_EXSTOP;
+            Packet->Size = 2;
+        }
+        else
+        {
+            return PT_DECODE_STATUS_INVALID_PACKET;
+        }
+
+        break;
+    }
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Find the type and the size of a packet
+ *
+ * @param Bytes
+ * @param Remaining Bytes that are available in the stream
+ * @param Packet
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodePacketType(const UINT8 * Bytes, UINT64 Remaining, PPT_DECODE_PACKET Packet)
+{
+    UINT8 Header = Bytes[0];
+
+    Packet->Size = 1;
+
+    if (Header == 0x00)
+    {
+        Packet->Type = PT_DECODE_PACKET_TYPE_PAD;
+    }
+    else if (Header == 0x02)
+    {
+        return PtDecodeExtendedPacketType(Bytes, Remaining, Packet);
+    }
+    else if ((Header & 0x01) == 0)
+    {
+        Packet->Type = PT_DECODE_PACKET_TYPE_TNT;
+    }
+    else if ((Header & 0x03) == 0x03)
+    {
+        Packet->Type = PT_DECODE_PACKET_TYPE_CYC;
+
+        //
+        // The bit 2 of the header and the bit 0 of the next bytes show
+        // whether another byte follows
+        //
+        if ((Header & 0x04) != 0)
+        {
+            do
+            {
+                if (Packet->Size >= Remaining)
+                {
+                    return PT_DECODE_STATUS_END_OF_STREAM;
+                }
+
+            } while ((Bytes[Packet->Size++] & 0x01) != 0);
+        }
+    }
+    else if ((Header & 0x1f) == 0x0d || (Header & 0x1f) == 0x11 || (Header & 0x1f) == 0x01 || (Header & 0x1f) == 0x1d)
+    {
+        Packet->Type = (Header & 0x1f) == 0x0d ? PT_DECODE_PACKET_TYPE_TIP : (Header & 0x1f) == 0x11 ? PT_DECODE_PACKET_TYPE_TIP_PGE
+                                                                         : (Header & 0x1f) == 0x01   ? PT_DECODE_PACKET_TYPE_TIP_PGD
+                                                                                                     : PT_DECODE_PACKET_TYPE_FUP;
+        Packet->IpBytes = Header >> 5;
+
+        if (Packet->IpBytes == 5 || Packet->IpBytes == 7)
+        {
+            return PT_DECODE_STATUS_INVALID_PACKET;
+        }
+
+        Packet->Size += PtDecodeIpPayloadSizes[Packet->IpBytes];
+    }
+    else if (Header == 0x99)
+    {
+        Packet->Type = PT_DECODE_PACKET_TYPE_MODE_EXEC;
+        Packet->Size = 2;
+    }
+    else if (Header == 0x19)
+    {
+        Packet->Type = PT_DECODE_PACKET_TYPE_TSC;
+        Packet->Size = 8;
+    }
+    else if (Header == 0x59)
+    {
+        Packet->Type = PT_DECODE_PACKET_TYPE_MTC;
+        Packet->Size = 2;
+    }
+    else
+    {
+        return PT_DECODE_STATUS_INVALID_PACKET;
+    }
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Initialize the decoder
+ *
+ * @param Decoder
+ * @param Buffer The packets
+ * @param Size
+ * @param Classify The classifier of the instructions (only needed for
+ * decoding the instructions)
+ * @param Context The context of the classifier
+ *
+ * @return VOID
+ */
+VOID
+PtDecodeInitialize(PPT_DECODER                    Decoder,
+                   const UINT8 *                  Buffer,
+                   UINT64                         Size,
+                   PT_DECODE_CLASSIFY_INSTRUCTION Classify,
+                   PVOID                          Context)
+{
+    memset(Decoder, 0, sizeof(PT_DECODER));
+
+    Decoder->Buffer   = Buffer;
+    Decoder->Size     = Size;
+    Decoder->Classify = Classify;
+    Decoder->Context  = Context;
+    Decoder->Is64Bit  = TRUE;
+}
+
+/**
+ * @brief Move to the next PSB (from the current offset)
+ * @details The packets before the first PSB can't be decoded, e.g., the
+ * oldest data of a circular buffer
+ *
+ * @param Decoder
+ *
+ * @return BOOLEAN FALSE if there is no PSB
+ */
+BOOLEAN
+PtDecodeSynchronize(PPT_DECODER Decoder)
+{
+    UINT64 Offset;
+    UINT32 i;
+
+    for (Offset = Decoder->Offset; Offset + PT_DECODE_PSB_SIZE <= Decoder->Size; Offset++)
+    {
+        for (i = 0; i < PT_DECODE_PSB_SIZE; i++)
+        {
+            if (Decoder->Buffer[Offset + i] != (i % 2 == 0 ? 0x02 : 0x82))
+            {
+                break;
+            }
+        }
+
+        if (i == PT_DECODE_PSB_SIZE)
+        {
+            Decoder->Offset            = Offset;
+            Decoder->IsSynchronized    = TRUE;
+            Decoder->IsNextPacketValid = FALSE;
+            Decoder->TntCount          = 0;
+
+            return TRUE;
+        }
+    }
+
+    Decoder->Offset = Decoder->Size;
+
+    return FALSE;
+}
+
+/**
+ * @brief Decode the next packet
+ *
+ * @param Decoder
+ * @param Packet
+ *
+ * @return PT_DECODE_STATUS
+ */
+PT_DECODE_STATUS
+PtDecodeNextPacket(PPT_DECODER Decoder, PPT_DECODE_PACKET Packet)
+{
+    const UINT8 *    Bytes;
+    UINT64           Remaining;
+    PT_DECODE_STATUS Status;
+
+    if (Decoder->Offset >= Decoder->Size)
+    {
+        return PT_DECODE_STATUS_END_OF_STREAM;
+    }
+
+    Bytes     = &Decoder->Buffer[Decoder->Offset];
+    Remaining = Decoder->Size - Decoder->Offset;
+
+    Packet->IpBytes  = 0;
+    Packet->TntCount = 0;
+    Packet->Payload  = 0;
+
+    Status = PtDecodePacketType(Bytes, Remaining, Packet);
+
+    if (Status != PT_DECODE_STATUS_SUCCESS)
+    {
+        return Status;
+    }
+
+    if (Packet->Size > Remaining)
+    {
+        return PT_DECODE_STATUS_END_OF_STREAM;
+    }
+
+    switch (Packet->Type)
+    {
+    case PT_DECODE_PACKET_TYPE_TNT:
+
+        if (!PtDecodeTnt(Packet->Size == 1 ? Bytes[0] >> 1 : PtDecodeReadValue(&Bytes[2], 6), Packet))
+        {
+            return PT_DECODE_STATUS_INVALID_PACKET;
+        }
+        break;
+
+    case PT_DECODE_PACKET_TYPE_TIP:
+    case PT_DECODE_PACKET_TYPE_TIP_PGE:
+    case PT_DECODE_PACKET_TYPE_TIP_PGD:
+    case PT_DECODE_PACKET_TYPE_FUP:
+
+        PtDecodeIp(Decoder, Bytes, Packet);
+        break;
+
+    case PT_DECODE_PACKET_TYPE_PSB:
+
+        for (UINT32 i = 2; i < PT_DECODE_PSB_SIZE; i += 2)
+        {
+            if (Bytes[i] != 0x02 || Bytes[i + 1] != 0x82)
+            {
+                return PT_DECODE_STATUS_INVALID_PACKET;
+            }
+        }
+
+        //
+        // The IPs after a PSB are not compressed against the previous ones
+        //
+        Decoder->LastIp = 0;
+        break;
+
+    case PT_DECODE_PACKET_TYPE_PIP:
+
+        //
+        // The bits 47:1 are the bits 51:5 of CR3 (the bit 0 is NR)
+        //
+        Packet->Payload = (PtDecodeReadValue(&Bytes[2], 6) >> 1) << 5;
+        break;
+
+    case PT_DECODE_PACKET_TYPE_MODE_EXEC:
+
+        //
+        // The leaf 0 is the execution mode (CS.L and CS.D), the leaf 1 is TSX
+        //
+        if ((Bytes[1] >> 5) == 1)
+        {
+            Packet->Type = PT_DECODE_PACKET_TYPE_MODE_TSX;
+        }
+        else if ((Bytes[1] >> 5) != 0)
+        {
+            return PT_DECODE_STATUS_INVALID_PACKET;
+        }
+
+        Packet->Payload = Bytes[1] & 0x03;
+        break;
+
+    case PT_DECODE_PACKET_TYPE_TSC:
+        Packet->Payload = PtDecodeReadValue(&Bytes[1], 7);
+        break;
+
+    case PT_DECODE_PACKET_TYPE_MTC:
+        Packet->Payload = Bytes[1];
+        break;
+
+    case PT_DECODE_PACKET_TYPE_CBR:
+        Packet->Payload = Bytes[2];
+        break;
+
+    case PT_DECODE_PACKET_TYPE_VMCS:
+        Packet->Payload = PtDecodeReadValue(&Bytes[2], 5) << 12;
+        break;
+
+    case PT_DECODE_PACKET_TYPE_MNT:
+
+        if (Bytes[2] != 0x88)
+        {
+            return PT_DECODE_STATUS_INVALID_PACKET;
+        }
+
+        Packet->Payload = PtDecodeReadValue(&Bytes[3], 8);
+        break;
+
+    case PT_DECODE_PACKET_TYPE_PTW:
+        Packet->Payload = PtDecodeReadValue(&Bytes[2], Packet->Size - 2);
+        break;
+
+    default:
+        break;
+    }
+
+    Decoder->Offset += Packet->Size;
+    Decoder->NumberOfPackets++;
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Push a return address to the stack of the calls
+ *
+ * @param Decoder
+ * @param Address
+ *
+ * @return VOID
+ */
+static VOID
+PtDecodePushReturn(PPT_DECODER Decoder, UINT64 Address)
+{
+    //
+    // The oldest entry is overwritten when the stack is full
+    //
+    Decoder->ReturnStackTop                       = (Decoder->ReturnStackTop + 1) % PT_DECODE_RETURN_STACK_SIZE;
+    Decoder->ReturnStack[Decoder->ReturnStackTop] = Address;
+
+    if (Decoder->ReturnStackCount < PT_DECODE_RETURN_STACK_SIZE)
+    {
+        Decoder->ReturnStackCount++;
+    }
+}
+
+/**
+ * @brief Pop a return address from the stack of the calls
+ *
+ * @param Decoder
+ * @param Address
+ *
+ * @return BOOLEAN FALSE if the stack is empty
+ */
+static BOOLEAN
+PtDecodePopReturn(PPT_DECODER Decoder, UINT64 * Address)
+{
+    if (Decoder->ReturnStackCount == 0)
+    {
+        return FALSE;
+    }
+
+    *Address                = Decoder->ReturnStack[Decoder->ReturnStackTop];
+    Decoder->ReturnStackTop = (Decoder->ReturnStackTop + PT_DECODE_RETURN_STACK_SIZE - 1) % PT_DECODE_RETURN_STACK_SIZE;
+    Decoder->ReturnStackCount--;
+
+    return TRUE;
+}
+
+/**
+ * @brief Lose the synchronization, the decoding continues from the next PSB
+ *
+ * @param Decoder
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeDesynchronize(PPT_DECODER Decoder)
+{
+    Decoder->IsSynchronized    = FALSE;
+    Decoder->IsIpValid         = FALSE;
+    Decoder->IsNextPacketValid = FALSE;
+    Decoder->TntCount          = 0;
+    Decoder->ReturnStackCount  = 0;
+
+    Decoder->NumberOfDesynchronizations++;
+
+    return PT_DECODE_STATUS_DESYNCHRONIZED;
+}
+
+/**
+ * @brief Decode the packets of PSB+ (until PSBEND)
+ * @details The FUP of PSB+ is the current IP if the tracing is enabled,
+ * it's only used if the IP is not known (the walk might have passed it)
+ *
+ * @param Decoder
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodePsbPlus(PPT_DECODER Decoder)
+{
+    PT_DECODE_PACKET Packet;
+    PT_DECODE_STATUS Status;
+    BOOLEAN          IsIpFound = FALSE;
+    UINT64           Ip        = 0;
+
+    //
+    // The stack of the calls is kept, the processor doesn't compress the
+    // returns of the calls before the PSB, and the returns that are not
+    // compressed don't pop the stack, so the newer entries still match
+    //
+    do
+    {
+        Status = PtDecodeNextPacket(Decoder, &Packet);
+
+        if (Status != PT_DECODE_STATUS_SUCCESS)
+        {
+            return Status;
+        }
+
+        if (Packet.Type == PT_DECODE_PACKET_TYPE_FUP && Packet.IpBytes != 0)
+        {
+            Ip        = Packet.Payload;
+            IsIpFound = TRUE;
+        }
+        else if (Packet.Type == PT_DECODE_PACKET_TYPE_PIP)
+        {
+            Decoder->Cr3 = Packet.Payload;
+        }
+        else if (Packet.Type == PT_DECODE_PACKET_TYPE_MODE_EXEC)
+        {
+            Decoder->Is64Bit = (Packet.Payload & 0x01) != 0;
+        }
+
+    } while (Packet.Type != PT_DECODE_PACKET_TYPE_PSBEND);
+
+    if (!IsIpFound)
+    {
+        //
+        // The tracing is not enabled at this point
+        //
+        Decoder->IsIpValid = FALSE;
+    }
+    else if (!Decoder->IsIpValid)
+    {
+        Decoder->Ip                        = Ip;
+        Decoder->IsIpValid                 = TRUE;
+        Decoder->TntCount                  = 0;
+        Decoder->InstructionsWithoutPacket = 0;
+    }
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Decode the packets until the next packet that changes the flow
+ * @details The packet is kept in NextPacket until it's consumed, the other
+ * packets (timing, PIP, MODE, PSB+) are applied on the way
+ *
+ * @param Decoder
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeFetchPacket(PPT_DECODER Decoder)
+{
+    PT_DECODE_PACKET Packet;
+    PT_DECODE_STATUS Status;
+
+    while (!Decoder->IsNextPacketValid)
+    {
+        Status = PtDecodeNextPacket(Decoder, &Packet);
+
+        if (Status != PT_DECODE_STATUS_SUCCESS)
+        {
+            return Status;
+        }
+
+        switch (Packet.Type)
+        {
+        case PT_DECODE_PACKET_TYPE_PSB:
+
+            Status = PtDecodePsbPlus(Decoder);
+
+            if (Status != PT_DECODE_STATUS_SUCCESS)
+            {
+                return Status;
+            }
+            break;
+
+        case PT_DECODE_PACKET_TYPE_PIP:
+            Decoder->Cr3 = Packet.Payload;
+            break;
+
+        case PT_DECODE_PACKET_TYPE_MODE_EXEC:
+            Decoder->Is64Bit = (Packet.Payload & 0x01) != 0;
+            break;
+
+        case PT_DECODE_PACKET_TYPE_TNT:
+        case PT_DECODE_PACKET_TYPE_TIP:
+        case PT_DECODE_PACKET_TYPE_TIP_PGE:
+        case PT_DECODE_PACKET_TYPE_TIP_PGD:
+        case PT_DECODE_PACKET_TYPE_FUP:
+        case PT_DECODE_PACKET_TYPE_OVF:
+        case PT_DECODE_PACKET_TYPE_TRACE_STOP:
+
+            Decoder->NextPacket        = Packet;
+            Decoder->IsNextPacketValid = TRUE;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Consume the next packet if it ends the traced flow (TIP.PGD,
+ * OVF or TraceStop)
+ *
+ * @param Decoder
+ *
+ * @return PT_DECODE_STATUS SUCCESS if the next packet is not a gap
+ */
+static PT_DECODE_STATUS
+PtDecodeTakeGap(PPT_DECODER Decoder)
+{
+    switch (Decoder->NextPacket.Type)
+    {
+    case PT_DECODE_PACKET_TYPE_TIP_PGD:
+    case PT_DECODE_PACKET_TYPE_TRACE_STOP:
+
+        Decoder->IsNextPacketValid = FALSE;
+        Decoder->IsIpValid         = FALSE;
+
+        return PT_DECODE_STATUS_TRACE_DISABLED;
+
+    case PT_DECODE_PACKET_TYPE_OVF:
+
+        //
+        // The packets are lost, the state is not valid anymore
+        //
+        Decoder->IsNextPacketValid = FALSE;
+        Decoder->IsIpValid         = FALSE;
+        Decoder->TntCount          = 0;
+        Decoder->ReturnStackCount  = 0;
+
+        Decoder->NumberOfOverflows++;
+
+        return PT_DECODE_STATUS_OVERFLOW;
+
+    default:
+        return PT_DECODE_STATUS_SUCCESS;
+    }
+}
+
+/**
+ * @brief Find the IP that the tracing is (re)started from
+ * @details From the FUP of PSB+, TIP.PGE, or the FUP after OVF, the other
+ * packets are dropped as they can't be followed without the IP
+ *
+ * @param Decoder
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeFindIp(PPT_DECODER Decoder)
+{
+    PT_DECODE_STATUS Status;
+
+    while (!Decoder->IsIpValid)
+    {
+        if (!Decoder->IsSynchronized && !PtDecodeSynchronize(Decoder))
+        {
+            return PT_DECODE_STATUS_END_OF_STREAM;
+        }
+
+        Status = PtDecodeFetchPacket(Decoder);
+
+        if (Status == PT_DECODE_STATUS_INVALID_PACKET)
+        {
+            //
+            // Skip the unknown packet and search for the next PSB
+            //
+            Decoder->Offset++;
+            PtDecodeDesynchronize(Decoder);
+            continue;
+        }
+        else if (Status != PT_DECODE_STATUS_SUCCESS)
+        {
+            return Status;
+        }
+
+        if (Decoder->IsIpValid)
+        {
+            //
+            // Found by PSB+, the fetched packet is after it
+            //
+            break;
+        }
+
+        Decoder->IsNextPacketValid = FALSE;
+
+        if ((Decoder->NextPacket.Type == PT_DECODE_PACKET_TYPE_TIP_PGE || Decoder->NextPacket.Type == PT_DECODE_PACKET_TYPE_FUP) &&
+            Decoder->NextPacket.IpBytes != 0)
+        {
+            Decoder->Ip                        = Decoder->NextPacket.Payload;
+            Decoder->IsIpValid                 = TRUE;
+            Decoder->TntCount                  = 0;
+            Decoder->InstructionsWithoutPacket = 0;
+        }
+        else if (Decoder->NextPacket.Type == PT_DECODE_PACKET_TYPE_OVF)
+        {
+            Decoder->NumberOfOverflows++;
+        }
+    }
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Take the next TNT bit (for a conditional branch or a compressed
+ * return)
+ *
+ * @param Decoder
+ * @param IsTaken
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeTakeTnt(PPT_DECODER Decoder, BOOLEAN * IsTaken)
+{
+    PT_DECODE_STATUS Status;
+
+    if (Decoder->TntCount == 0)
+    {
+        Status = PtDecodeFetchPacket(Decoder);
+
+        if (Status == PT_DECODE_STATUS_END_OF_STREAM)
+        {
+            return Status;
+        }
+        else if (Status != PT_DECODE_STATUS_SUCCESS || !Decoder->IsIpValid)
+        {
+            return PtDecodeDesynchronize(Decoder);
+        }
+
+        if (Decoder->NextPacket.Type != PT_DECODE_PACKET_TYPE_TNT)
+        {
+            Status = PtDecodeTakeGap(Decoder);
+
+            return Status == PT_DECODE_STATUS_SUCCESS ? PtDecodeDesynchronize(Decoder) : Status;
+        }
+
+        Decoder->TntBits           = Decoder->NextPacket.Payload;
+        Decoder->TntCount          = Decoder->NextPacket.TntCount;
+        Decoder->IsNextPacketValid = FALSE;
+    }
+
+    Decoder->TntCount--;
+    Decoder->InstructionsWithoutPacket = 0;
+
+    *IsTaken = (Decoder->TntBits >> Decoder->TntCount) & 0x01;
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Take the target of an indirect branch (TIP)
+ *
+ * @param Decoder
+ * @param Target
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeTakeTip(PPT_DECODER Decoder, UINT64 * Target)
+{
+    PT_DECODE_STATUS Status;
+
+    //
+    // The TNT bits are before the TIP
+    //
+    if (Decoder->TntCount != 0)
+    {
+        return PtDecodeDesynchronize(Decoder);
+    }
+
+    Status = PtDecodeFetchPacket(Decoder);
+
+    if (Status == PT_DECODE_STATUS_END_OF_STREAM)
+    {
+        return Status;
+    }
+    else if (Status != PT_DECODE_STATUS_SUCCESS || !Decoder->IsIpValid)
+    {
+        return PtDecodeDesynchronize(Decoder);
+    }
+
+    if (Decoder->NextPacket.Type != PT_DECODE_PACKET_TYPE_TIP)
+    {
+        Status = PtDecodeTakeGap(Decoder);
+
+        return Status == PT_DECODE_STATUS_SUCCESS ? PtDecodeDesynchronize(Decoder) : Status;
+    }
+
+    Decoder->IsNextPacketValid         = FALSE;
+    Decoder->InstructionsWithoutPacket = 0;
+
+    if (Decoder->NextPacket.IpBytes == 0)
+    {
+        //
+        // The target is not known, the flow continues from the next IP
+        //
+        Decoder->IsIpValid = FALSE;
+        return PT_DECODE_STATUS_TRACE_DISABLED;
+    }
+
+    *Target = Decoder->NextPacket.Payload;
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Take the asynchronous events (interrupts, exceptions, vm-exits)
+ * that happen before the instruction at the current IP
+ * @details The event is a FUP with the current IP and a TIP (the target)
+ * or a TIP.PGD (the tracing is disabled), the instruction is not executed
+ *
+ * @param Decoder
+ *
+ * @return PT_DECODE_STATUS
+ */
+static PT_DECODE_STATUS
+PtDecodeTakeEvents(PPT_DECODER Decoder)
+{
+    PT_DECODE_STATUS Status;
+
+    //
+    // The events are after the remaining TNT bits
+    //
+    while (Decoder->TntCount == 0)
+    {
+        Status = PtDecodeFetchPacket(Decoder);
+
+        if (Status == PT_DECODE_STATUS_END_OF_STREAM)
+        {
+            //
+            // The instructions until the next branch are still known
+            //
+            return PT_DECODE_STATUS_SUCCESS;
+        }
+        else if (Status != PT_DECODE_STATUS_SUCCESS)
+        {
+            return PtDecodeDesynchronize(Decoder);
+        }
+
+        if (!Decoder->IsIpValid)
+        {
+            //
+            // PSB+ shows that the tracing is disabled
+            //
+            return PT_DECODE_STATUS_TRACE_DISABLED;
+        }
+
+        if (Decoder->NextPacket.Type == PT_DECODE_PACKET_TYPE_TRACE_STOP)
+        {
+            return PtDecodeTakeGap(Decoder);
+        }
+
+        //
+        // TIP.PGD and OVF are taken by the next branch, the instructions
+        // until the branch are still executed
+        //
+        if (Decoder->NextPacket.Type != PT_DECODE_PACKET_TYPE_FUP ||
+            Decoder->NextPacket.IpBytes == 0 ||
+            Decoder->NextPacket.Payload != Decoder->Ip)
+        {
+            return PT_DECODE_STATUS_SUCCESS;
+        }
+
+        Decoder->IsNextPacketValid         = FALSE;
+        Decoder->InstructionsWithoutPacket = 0;
+
+        Status = PtDecodeFetchPacket(Decoder);
+
+        if (Status != PT_DECODE_STATUS_SUCCESS)
+        {
+            return Status == PT_DECODE_STATUS_END_OF_STREAM ? Status : PtDecodeDesynchronize(Decoder);
+        }
+
+        if (Decoder->NextPacket.Type == PT_DECODE_PACKET_TYPE_TIP)
+        {
+            Decoder->IsNextPacketValid = FALSE;
+
+            if (Decoder->NextPacket.IpBytes == 0)
+            {
+                Decoder->IsIpValid = FALSE;
+                return PT_DECODE_STATUS_TRACE_DISABLED;
+            }
+
+            //
+            // The handler of the event might also be interrupted
+            //
+            Decoder->Ip = Decoder->NextPacket.Payload;
+            continue;
+        }
+
+        Status = PtDecodeTakeGap(Decoder);
+
+        //
+        // The FUPs without a transfer (e.g., PTWRITE) are only informational
+        //
+        return Status;
+    }
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Decode the next executed instruction
+ * @details The gaps of the flow (TRACE_DISABLED, OVERFLOW and
+ * DESYNCHRONIZED) are reported once, the decoding continues after them
+ *
+ * @param Decoder
+ * @param Instruction
+ *
+ * @return PT_DECODE_STATUS
+ */
+PT_DECODE_STATUS
+PtDecodeNextInstruction(PPT_DECODER Decoder, PPT_DECODE_INSTRUCTION Instruction)
+{
+    PT_DECODE_STATUS Status;
+    UINT64           NextIp;
+    UINT64           Target  = 0;
+    BOOLEAN          IsTaken = FALSE;
+
+    if (Decoder->PendingStatus != PT_DECODE_STATUS_SUCCESS)
+    {
+        Status                 = Decoder->PendingStatus;
+        Decoder->PendingStatus = PT_DECODE_STATUS_SUCCESS;
+
+        return Status;
+    }
+
+    Status = PtDecodeFindIp(Decoder);
+
+    if (Status != PT_DECODE_STATUS_SUCCESS)
+    {
+        return Status;
+    }
+
+    Status = PtDecodeTakeEvents(Decoder);
+
+    if (Status != PT_DECODE_STATUS_SUCCESS)
+    {
+        return Status;
+    }
+
+    if (++Decoder->InstructionsWithoutPacket > PT_DECODE_MAXIMUM_INSTRUCTIONS_WITHOUT_PACKET)
+    {
+        return Decoder->Offset >= Decoder->Size ? PT_DECODE_STATUS_END_OF_STREAM : PtDecodeDesynchronize(Decoder);
+    }
+
+    Instruction->Ip = Decoder->Ip;
+
+    if (!Decoder->Classify(Decoder->Context, Decoder->Cr3, Decoder->Is64Bit, Instruction))
+    {
+        //
+        // The memory of the instruction is not available
+        //
+        return PtDecodeDesynchronize(Decoder);
+    }
+
+    NextIp = Decoder->Ip + Instruction->Length;
+
+    switch (Instruction->Class)
+    {
+    case PT_DECODE_INSTRUCTION_CLASS_DIRECT_CALL:
+
+        PtDecodePushReturn(Decoder, NextIp);
+        Decoder->Ip = Instruction->Target;
+        break;
+
+    case PT_DECODE_INSTRUCTION_CLASS_DIRECT_JUMP:
+
+        Decoder->Ip = Instruction->Target;
+        break;
+
+    case PT_DECODE_INSTRUCTION_CLASS_CONDITIONAL_BRANCH:
+
+        Status      = PtDecodeTakeTnt(Decoder, &IsTaken);
+        Decoder->Ip = IsTaken ? Instruction->Target : NextIp;
+        break;
+
+    case PT_DECODE_INSTRUCTION_CLASS_RETURN:
+
+        //
+        // A compressed return is a taken TNT bit
+        //
+        if (Decoder->TntCount == 0 &&
+            PtDecodeFetchPacket(Decoder) == PT_DECODE_STATUS_SUCCESS &&
+            Decoder->NextPacket.Type != PT_DECODE_PACKET_TYPE_TNT)
+        {
+            Status = PtDecodeTakeTip(Decoder, &Target);
+        }
+        else
+        {
+            Status = PtDecodeTakeTnt(Decoder, &IsTaken);
+
+            if (Status == PT_DECODE_STATUS_SUCCESS && (!IsTaken || !PtDecodePopReturn(Decoder, &Target)))
+            {
+                Status = PtDecodeDesynchronize(Decoder);
+            }
+        }
+
+        Decoder->Ip = Target;
+        break;
+
+    case PT_DECODE_INSTRUCTION_CLASS_INDIRECT_CALL:
+
+        PtDecodePushReturn(Decoder, NextIp);
+        Status      = PtDecodeTakeTip(Decoder, &Target);
+        Decoder->Ip = Target;
+        break;
+
+    case PT_DECODE_INSTRUCTION_CLASS_INDIRECT_JUMP:
+    case PT_DECODE_INSTRUCTION_CLASS_FAR_TRANSFER:
+
+        Status      = PtDecodeTakeTip(Decoder, &Target);
+        Decoder->Ip = Target;
+        break;
+
+    default:
+
+        Decoder->Ip = NextIp;
+        break;
+    }
+
+    if (Status == PT_DECODE_STATUS_TRACE_DISABLED)
+    {
+        //
+        // The branch is executed, then the tracing is disabled
+        //
+        Decoder->PendingStatus = Status;
+    }
+    else if (Status != PT_DECODE_STATUS_SUCCESS)
+    {
+        return Status;
+    }
+
+    Decoder->NumberOfInstructions++;
+
+    return PT_DECODE_STATUS_SUCCESS;
+}
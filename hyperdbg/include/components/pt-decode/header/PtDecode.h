@@ -0,0 +1,211 @@
+/**
+ * @file PtDecode.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the decoder of the Intel Processor Trace packets
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the PSB packet (the synchronization point of the stream)
+ *
+ */
+#define PT_DECODE_PSB_SIZE 16
+
+/**
+ * @brief Entries of the stack of the return addresses (same as the
+ * processor, used for the compressed returns)
+ *
+ */
+#define PT_DECODE_RETURN_STACK_SIZE 64
+
+/**
+ * @brief Maximum instructions that are walked without consuming a packet
+ * (the decoder is desynchronized after that)
+ *
+ */
+#define PT_DECODE_MAXIMUM_INSTRUCTIONS_WITHOUT_PACKET 0x10000
+
+//////////////////////////////////////////////////
+//				    Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Types of the packets
+ *
+ */
+typedef enum _PT_DECODE_PACKET_TYPE
+{
+    PT_DECODE_PACKET_TYPE_PAD,
+    PT_DECODE_PACKET_TYPE_TNT,
+    PT_DECODE_PACKET_TYPE_TIP,
+    PT_DECODE_PACKET_TYPE_TIP_PGE,
+    PT_DECODE_PACKET_TYPE_TIP_PGD,
+    PT_DECODE_PACKET_TYPE_FUP,
+    PT_DECODE_PACKET_TYPE_PSB,
+    PT_DECODE_PACKET_TYPE_PSBEND,
+    PT_DECODE_PACKET_TYPE_PIP,
+    PT_DECODE_PACKET_TYPE_MODE_EXEC,
+    PT_DECODE_PACKET_TYPE_MODE_TSX,
+    PT_DECODE_PACKET_TYPE_TSC,
+    PT_DECODE_PACKET_TYPE_MTC,
+    PT_DECODE_PACKET_TYPE_TMA,
+    PT_DECODE_PACKET_TYPE_CYC,
+    PT_DECODE_PACKET_TYPE_CBR,
+    PT_DECODE_PACKET_TYPE_OVF,
+    PT_DECODE_PACKET_TYPE_TRACE_STOP,
+    PT_DECODE_PACKET_TYPE_VMCS,
+    PT_DECODE_PACKET_TYPE_MNT,
+    PT_DECODE_PACKET_TYPE_PTW,
+    PT_DECODE_PACKET_TYPE_EXSTOP,
+    PT_DECODE_PACKET_TYPE_MWAIT,
+    PT_DECODE_PACKET_TYPE_PWRE,
+    PT_DECODE_PACKET_TYPE_PWRX,
+
+} PT_DECODE_PACKET_TYPE;
+
+/**
+ * @brief Results of decoding the packets and the instructions
+ *
+ */
+typedef enum _PT_DECODE_STATUS
+{
+    PT_DECODE_STATUS_SUCCESS,
+    PT_DECODE_STATUS_END_OF_STREAM,
+    PT_DECODE_STATUS_INVALID_PACKET,  // The packet is unknown (a truncated packet is the end of the stream)
+    PT_DECODE_STATUS_TRACE_DISABLED,  // The tracing is disabled (filtered out, or a vm-exit) until it's enabled again
+    PT_DECODE_STATUS_OVERFLOW,        // The processor lost some packets
+    PT_DECODE_STATUS_DESYNCHRONIZED,  // The packets don't match the instructions, the decoder is synchronized again at the next PSB
+
+} PT_DECODE_STATUS;
+
+/**
+ * @brief Classes of the instructions (from the view of the trace)
+ *
+ */
+typedef enum _PT_DECODE_INSTRUCTION_CLASS
+{
+    PT_DECODE_INSTRUCTION_CLASS_OTHER,
+    PT_DECODE_INSTRUCTION_CLASS_CONDITIONAL_BRANCH, // A TNT bit (Jcc, LOOP, JrCXZ)
+    PT_DECODE_INSTRUCTION_CLASS_DIRECT_JUMP,        // No packet
+    PT_DECODE_INSTRUCTION_CLASS_DIRECT_CALL,        // No packet
+    PT_DECODE_INSTRUCTION_CLASS_INDIRECT_JUMP,      // A TIP
+    PT_DECODE_INSTRUCTION_CLASS_INDIRECT_CALL,      // A TIP
+    PT_DECODE_INSTRUCTION_CLASS_RETURN,             // A TNT bit (compressed) or a TIP
+    PT_DECODE_INSTRUCTION_CLASS_FAR_TRANSFER,       // A TIP (SYSCALL, SYSRET, INT, IRET, far JMP/CALL/RET)
+
+} PT_DECODE_INSTRUCTION_CLASS;
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A decoded packet
+ *
+ */
+typedef struct _PT_DECODE_PACKET
+{
+    PT_DECODE_PACKET_TYPE Type;
+    UINT32                Size;     // Bytes of the packet
+    UINT32                IpBytes;  // IP compression of TIP, TIP.PGE, TIP.PGD and FUP (zero means the IP is suppressed)
+    UINT32                TntCount; // Count of the bits of TNT
+    UINT64                Payload;  // The (decompressed) IP, the TNT bits (the oldest one is the most significant), CR3 of PIP, ...
+
+} PT_DECODE_PACKET, *PPT_DECODE_PACKET;
+
+/**
+ * @brief A decoded instruction
+ *
+ */
+typedef struct _PT_DECODE_INSTRUCTION
+{
+    UINT64                      Ip;
+    UINT64                      Target; // Target of the direct branches
+    UINT32                      Length;
+    PT_DECODE_INSTRUCTION_CLASS Class;
+
+} PT_DECODE_INSTRUCTION, *PPT_DECODE_INSTRUCTION;
+
+/**
+ * @brief Fill the length, the class and the target of the instruction at
+ * Instruction->Ip from the memory of the address space (CR3)
+ *
+ */
+typedef BOOLEAN (*PT_DECODE_CLASSIFY_INSTRUCTION)(PVOID                  Context,
+                                                  UINT64                 Cr3,
+                                                  BOOLEAN                Is64Bit,
+                                                  PPT_DECODE_INSTRUCTION Instruction);
+
+/**
+ * @brief The state of the decoder
+ *
+ */
+typedef struct _PT_DECODER
+{
+    //
+    // Packets
+    //
+    const UINT8 * Buffer;
+    UINT64        Size;
+    UINT64        Offset;
+    UINT64        LastIp; // The base of the compressed IPs
+
+    //
+    // Instruction flow
+    //
+    PT_DECODE_CLASSIFY_INSTRUCTION Classify;
+    PVOID                          Context;
+    UINT64                         Ip;
+    UINT64                         Cr3;
+    BOOLEAN                        IsSynchronized; // Whether a PSB is found (after the start or a desynchronization)
+    BOOLEAN                        IsIpValid;
+    BOOLEAN                        Is64Bit;
+    BOOLEAN                        IsNextPacketValid;
+    PT_DECODE_PACKET               NextPacket; // The next packet that changes the flow (TNT, TIP, FUP, ...)
+    UINT64                         TntBits;    // The next bit is bit (TntCount - 1)
+    UINT32                         TntCount;
+    UINT32                         InstructionsWithoutPacket;
+    PT_DECODE_STATUS               PendingStatus; // Reported after the last instruction before the gap
+    UINT64                         ReturnStack[PT_DECODE_RETURN_STACK_SIZE];
+    UINT32                         ReturnStackTop;
+    UINT32                         ReturnStackCount;
+
+    //
+    // Statistics
+    //
+    UINT64 NumberOfPackets;
+    UINT64 NumberOfInstructions;
+    UINT64 NumberOfOverflows;
+    UINT64 NumberOfDesynchronizations;
+
+} PT_DECODER, *PPT_DECODER;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+PtDecodeInitialize(PPT_DECODER                    Decoder,
+                   const UINT8 *                  Buffer,
+                   UINT64                         Size,
+                   PT_DECODE_CLASSIFY_INSTRUCTION Classify,
+                   PVOID                          Context);
+
+BOOLEAN
+PtDecodeSynchronize(PPT_DECODER Decoder);
+
+PT_DECODE_STATUS
+PtDecodeNextPacket(PPT_DECODER Decoder, PPT_DECODE_PACKET Packet);
+
+PT_DECODE_STATUS
+PtDecodeNextInstruction(PPT_DECODER Decoder, PPT_DECODE_INSTRUCTION Instruction);
@@ -0,0 +1,482 @@
+/**
+ * @file SampleProfile.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The histograms of the sampling profiler
+ * @details The samples of each core are recorded in a fixed histogram
+ * from vmx-root (nothing is allocated there, a sample that doesn't fit is
+ * counted as dropped), the histograms are merged and symbolized in user-mode
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the first entry of the probes of a sample
+ *
+ * @param Histogram
+ * @param Sample
+ *
+ * @return UINT32
+ */
+static UINT32
+SampleProfileGetIndex(const SAMPLE_PROFILE_HISTOGRAM * Histogram, const PROFILER_SAMPLE * Sample)
+{
+    UINT64 Hash = Sample->Rip;
+
+    Hash = (Hash ^ Sample->Cr3) * 0x9e3779b97f4a7c15ull;
+
+    for (UINT32 i = 0; i < Sample->StackDepth; i++)
+    {
+        Hash = (Hash ^ Sample->Stack[i]) * 0x9e3779b97f4a7c15ull;
+    }
+
+    //
+    // The high bits of the product are mixed the most
+    //
+    return (UINT32)(Hash >> Histogram->Shift);
+}
+
+/**
+ * @brief Check whether an entry of the histogram is the same as a sample
+ *
+ * @param Entry
+ * @param Sample
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SampleProfileIsSameSample(const PROFILER_SAMPLE * Entry, const PROFILER_SAMPLE * Sample)
+{
+    if (Entry->Rip != Sample->Rip || Entry->Cr3 != Sample->Cr3 || Entry->StackDepth != Sample->StackDepth)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Sample->StackDepth; i++)
+    {
+        if (Entry->Stack[i] != Sample->Stack[i])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Initialize the histogram
+ *
+ * @param Histogram
+ * @param Samples The entries of the histogram
+ * @param Capacity Count of the entries (a power of two, at least two)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SampleProfileInitialize(PSAMPLE_PROFILE_HISTOGRAM Histogram, PPROFILER_SAMPLE Samples, UINT32 Capacity)
+{
+    if (Samples == NULL || Capacity < 2 || (Capacity & (Capacity - 1)) != 0)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Capacity; i++)
+    {
+        Samples[i].Count = 0;
+    }
+
+    Histogram->Shift = 64;
+
+    for (UINT32 i = Capacity; i > 1; i >>= 1)
+    {
+        Histogram->Shift--;
+    }
+
+    Histogram->Samples                 = Samples;
+    Histogram->Capacity                = Capacity;
+    Histogram->NumberOfDistinctSamples = 0;
+    Histogram->NumberOfTakenSamples    = 0;
+    Histogram->NumberOfDroppedSamples  = 0;
+
+    return TRUE;
+}
+
+/**
+ * @brief Add the count of a sample to the histogram
+ * @details Used both for recording a sample (in vmx-root) and for merging
+ * the histograms, a new entry is filled before its count is set, so the
+ * readers of the histogram skip it until it's complete
+ *
+ * @param Histogram
+ * @param Sample
+ *
+ * @return BOOLEAN FALSE if the sample is dropped
+ */
+BOOLEAN
+SampleProfileAdd(PSAMPLE_PROFILE_HISTOGRAM Histogram, const PROFILER_SAMPLE * Sample)
+{
+    PPROFILER_SAMPLE Entry;
+    UINT32           Index = SampleProfileGetIndex(Histogram, Sample);
+    UINT32           Probes;
+
+    Histogram->NumberOfTakenSamples += Sample->Count;
+
+    //
+    // The probes are bounded, so the cost of a sample in vmx-root is bounded as well
+    //
+    Probes = Histogram->Capacity < SAMPLE_PROFILE_MAXIMUM_PROBES ? Histogram->Capacity : SAMPLE_PROFILE_MAXIMUM_PROBES;
+
+    for (UINT32 i = 0; i < Probes; i++)
+    {
+        Entry = &Histogram->Samples[(Index + i) & (Histogram->Capacity - 1)];
+
+        if (Entry->Count == 0)
+        {
+            //
+            // Keep a quarter of the entries free to keep the probes short
+            //
+            if (Histogram->NumberOfDistinctSamples >= Histogram->Capacity - Histogram->Capacity / 4)
+            {
+                break;
+            }
+
+            Entry->Rip        = Sample->Rip;
+            Entry->Cr3        = Sample->Cr3;
+            Entry->StackDepth = Sample->StackDepth;
+
+            for (UINT32 j = 0; j < PROFILER_MAXIMUM_STACK_DEPTH; j++)
+            {
+                Entry->Stack[j] = j < Sample->StackDepth ? Sample->Stack[j] : 0;
+            }
+
+            *(volatile UINT32 *)&Entry->Count = Sample->Count;
+
+            Histogram->NumberOfDistinctSamples++;
+            return TRUE;
+        }
+
+        if (SampleProfileIsSameSample(Entry, Sample))
+        {
+            *(volatile UINT32 *)&Entry->Count = Entry->Count + Sample->Count;
+            return TRUE;
+        }
+    }
+
+    Histogram->NumberOfDroppedSamples += Sample->Count;
+
+    return FALSE;
+}
+
+/**
+ * @brief Read the (non-empty) samples of the histogram
+ *
+ * @param Histogram
+ * @param FirstSample Index of the histogram to start reading from
+ * @param Samples
+ * @param MaximumSamples
+ * @param NextSample Index to continue reading from (the capacity of the
+ * histogram if all of the samples are read)
+ *
+ * @return UINT32 Count of the read samples
+ */
+UINT32
+SampleProfileRead(const SAMPLE_PROFILE_HISTOGRAM * Histogram,
+                  UINT32                           FirstSample,
+                  PPROFILER_SAMPLE                 Samples,
+                  UINT32                           MaximumSamples,
+                  UINT32 *                         NextSample)
+{
+    UINT32 Count = 0;
+    UINT32 i;
+
+    for (i = FirstSample; i < Histogram->Capacity && Count < MaximumSamples; i++)
+    {
+        if (*(volatile UINT32 *)&Histogram->Samples[i].Count != 0)
+        {
+            Samples[Count++] = Histogram->Samples[i];
+        }
+    }
+
+    *NextSample = i;
+
+    return Count;
+}
+
+/**
+ * @brief Find the candidate return addresses on the top of the stack
+ * @details The frame pointers are not kept on x64, so the words that are
+ * canonical addresses on the same half as the RIP (user or kernel) and
+ * don't point to the stack itself are taken, the words that are not in
+ * any function are ignored by the symbolization
+ *
+ * @param Rip
+ * @param StackPointer
+ * @param StackWords The words from the stack pointer
+ * @param NumberOfWords
+ * @param Frames
+ * @param MaximumFrames
+ *
+ * @return UINT32 Count of the frames
+ */
+UINT32
+SampleProfileFindReturnAddresses(UINT64         Rip,
+                                 UINT64         StackPointer,
+                                 const UINT64 * StackWords,
+                                 UINT32         NumberOfWords,
+                                 UINT64 *       Frames,
+                                 UINT32         MaximumFrames)
+{
+    UINT32 Count = 0;
+    UINT64 Word;
+    INT64  HighBits;
+
+    for (UINT32 i = 0; i < NumberOfWords && Count < MaximumFrames; i++)
+    {
+        Word     = StackWords[i];
+        HighBits = (INT64)Word >> 47;
+
+        if (HighBits != 0 && HighBits != -1)
+        {
+            continue;
+        }
+
+        if (((Word ^ Rip) >> 63) != 0 || (Word >> 12) == 0)
+        {
+            continue;
+        }
+
+        if (Word - StackPointer + SAMPLE_PROFILE_STACK_WINDOW < 2 * SAMPLE_PROFILE_STACK_WINDOW)
+        {
+            continue;
+        }
+
+        if (Count != 0 && Frames[Count - 1] == Word)
+        {
+            continue;
+        }
+
+        Frames[Count++] = Word;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Find the function of an address
+ *
+ * @param Symbols The functions sorted by their addresses
+ * @param NumberOfSymbols
+ * @param Address
+ *
+ * @return UINT32 Index of the function or NumberOfSymbols if it's not found
+ */
+UINT32
+SampleProfileFindSymbol(const SAMPLE_PROFILE_SYMBOL * Symbols, UINT32 NumberOfSymbols, UINT64 Address)
+{
+    UINT32 Low  = 0;
+    UINT32 High = NumberOfSymbols;
+    UINT32 Middle;
+
+    //
+    // Find the last function that starts at or before the address
+    //
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (Symbols[Middle].Address <= Address)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low == 0 || Address - Symbols[Low - 1].Address >= Symbols[Low - 1].Size)
+    {
+        return NumberOfSymbols;
+    }
+
+    return Low - 1;
+}
+
+/**
+ * @brief Count the samples of each function
+ * @details A function is counted once for each sample even if it's found
+ * more than once on the stack (recursion)
+ *
+ * @param Samples
+ * @param NumberOfSamples
+ * @param Symbols The functions sorted by their addresses
+ * @param NumberOfSymbols
+ * @param Functions The samples of each function (NumberOfSymbols + 1
+ * entries, the last one is for the unknown addresses)
+ *
+ * @return VOID
+ */
+VOID
+SampleProfileSymbolize(const PROFILER_SAMPLE *       Samples,
+                       UINT32                        NumberOfSamples,
+                       const SAMPLE_PROFILE_SYMBOL * Symbols,
+                       UINT32                        NumberOfSymbols,
+                       PSAMPLE_PROFILE_FUNCTION      Functions)
+{
+    UINT32  Found[PROFILER_MAXIMUM_STACK_DEPTH + 1];
+    UINT32  NumberOfFound;
+    UINT32  SymbolIndex;
+    BOOLEAN IsCounted;
+
+    for (UINT32 i = 0; i <= NumberOfSymbols; i++)
+    {
+        Functions[i].SymbolIndex = i;
+        Functions[i].SelfCount   = 0;
+        Functions[i].TotalCount  = 0;
+    }
+
+    for (UINT32 i = 0; i < NumberOfSamples; i++)
+    {
+        SymbolIndex = SampleProfileFindSymbol(Symbols, NumberOfSymbols, Samples[i].Rip);
+
+        Functions[SymbolIndex].SelfCount += Samples[i].Count;
+        Functions[SymbolIndex].TotalCount += Samples[i].Count;
+
+        Found[0]      = SymbolIndex;
+        NumberOfFound = 1;
+
+        for (UINT32 j = 0; j < Samples[i].StackDepth && j < PROFILER_MAXIMUM_STACK_DEPTH; j++)
+        {
+            SymbolIndex = SampleProfileFindSymbol(Symbols, NumberOfSymbols, Samples[i].Stack[j]);
+
+            if (SymbolIndex == NumberOfSymbols)
+            {
+                continue;
+            }
+
+            IsCounted = FALSE;
+
+            for (UINT32 k = 0; k < NumberOfFound; k++)
+            {
+                if (Found[k] == SymbolIndex)
+                {
+                    IsCounted = TRUE;
+                    break;
+                }
+            }
+
+            if (!IsCounted)
+            {
+                Functions[SymbolIndex].TotalCount += Samples[i].Count;
+                Found[NumberOfFound++] = SymbolIndex;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compare two functions (the more samples, the lower)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return INT32 Negative, zero or positive
+ */
+static INT32
+SampleProfileCompareFunctions(const SAMPLE_PROFILE_FUNCTION * First, const SAMPLE_PROFILE_FUNCTION * Second)
+{
+    if (First->SelfCount != Second->SelfCount)
+    {
+        return First->SelfCount > Second->SelfCount ? -1 : 1;
+    }
+
+    if (First->TotalCount != Second->TotalCount)
+    {
+        return First->TotalCount > Second->TotalCount ? -1 : 1;
+    }
+
+    if (First->SymbolIndex != Second->SymbolIndex)
+    {
+        return First->SymbolIndex < Second->SymbolIndex ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Move a function down the heap until its children are not greater
+ *
+ * @param Functions
+ * @param Root
+ * @param NumberOfFunctions
+ *
+ * @return VOID
+ */
+static VOID
+SampleProfileSiftDown(PSAMPLE_PROFILE_FUNCTION Functions, UINT32 Root, UINT32 NumberOfFunctions)
+{
+    SAMPLE_PROFILE_FUNCTION Temp;
+    UINT32                  Child;
+
+    while ((Child = 2 * Root + 1) < NumberOfFunctions)
+    {
+        if (Child + 1 < NumberOfFunctions && SampleProfileCompareFunctions(&Functions[Child], &Functions[Child + 1]) < 0)
+        {
+            Child++;
+        }
+
+        if (SampleProfileCompareFunctions(&Functions[Root], &Functions[Child]) >= 0)
+        {
+            return;
+        }
+
+        Temp             = Functions[Root];
+        Functions[Root]  = Functions[Child];
+        Functions[Child] = Temp;
+        Root             = Child;
+    }
+}
+
+/**
+ * @brief Remove the functions without samples and sort the rest by their
+ * self counts (and then their total counts)
+ *
+ * @param Functions
+ * @param NumberOfFunctions
+ *
+ * @return UINT32 Count of the functions with samples
+ */
+UINT32
+SampleProfileSortFunctions(PSAMPLE_PROFILE_FUNCTION Functions, UINT32 NumberOfFunctions)
+{
+    SAMPLE_PROFILE_FUNCTION Temp;
+    UINT32                  Count = 0;
+
+    for (UINT32 i = 0; i < NumberOfFunctions; i++)
+    {
+        if (Functions[i].TotalCount != 0)
+        {
+            Functions[Count++] = Functions[i];
+        }
+    }
+
+    for (UINT32 i = Count / 2; i-- > 0;)
+    {
+        SampleProfileSiftDown(Functions, i, Count);
+    }
+
+    for (UINT32 i = Count; i-- > 1;)
+    {
+        Temp         = Functions[0];
+        Functions[0] = Functions[i];
+        Functions[i] = Temp;
+
+        SampleProfileSiftDown(Functions, 0, i);
+    }
+
+    return Count;
+}
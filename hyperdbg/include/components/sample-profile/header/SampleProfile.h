@@ -0,0 +1,119 @@
+/**
+ * @file SampleProfile.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the histograms of the sampling profiler
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum entries that are probed for recording a sample (the
+ * sample is dropped after that)
+ *
+ */
+#define SAMPLE_PROFILE_MAXIMUM_PROBES 0x20
+
+/**
+ * @brief Count of the stack words that are scanned for the return addresses
+ *
+ */
+#define SAMPLE_PROFILE_STACK_SCAN_WORDS 0x20
+
+/**
+ * @brief The words that are nearer than this to the stack pointer are
+ * considered as pointers to the stack (not return addresses)
+ *
+ */
+#define SAMPLE_PROFILE_STACK_WINDOW 0x100000
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The histogram of the samples (open addressing with linear probing)
+ *
+ */
+typedef struct _SAMPLE_PROFILE_HISTOGRAM
+{
+    PPROFILER_SAMPLE Samples;
+    UINT32           Capacity; // A power of two
+    UINT32           Shift;    // 64 - log2(Capacity)
+    UINT32           NumberOfDistinctSamples;
+    UINT64           NumberOfTakenSamples;
+    UINT64           NumberOfDroppedSamples;
+
+} SAMPLE_PROFILE_HISTOGRAM, *PSAMPLE_PROFILE_HISTOGRAM;
+
+/**
+ * @brief A function that the samples are symbolized to
+ *
+ */
+typedef struct _SAMPLE_PROFILE_SYMBOL
+{
+    UINT64 Address;
+    UINT64 Size;
+
+} SAMPLE_PROFILE_SYMBOL, *PSAMPLE_PROFILE_SYMBOL;
+
+/**
+ * @brief The samples of a function
+ * @details The self count is the samples that the function was running,
+ * the total count also contains the samples that the function was found
+ * on the stack
+ *
+ */
+typedef struct _SAMPLE_PROFILE_FUNCTION
+{
+    UINT32 SymbolIndex; // The count of the symbols means the unknown addresses
+    UINT64 SelfCount;
+    UINT64 TotalCount;
+
+} SAMPLE_PROFILE_FUNCTION, *PSAMPLE_PROFILE_FUNCTION;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+SampleProfileInitialize(PSAMPLE_PROFILE_HISTOGRAM Histogram, PPROFILER_SAMPLE Samples, UINT32 Capacity);
+
+BOOLEAN
+SampleProfileAdd(PSAMPLE_PROFILE_HISTOGRAM Histogram, const PROFILER_SAMPLE * Sample);
+
+UINT32
+SampleProfileRead(const SAMPLE_PROFILE_HISTOGRAM * Histogram,
+                  UINT32                           FirstSample,
+                  PPROFILER_SAMPLE                 Samples,
+                  UINT32                           MaximumSamples,
+                  UINT32 *                         NextSample);
+
+UINT32
+SampleProfileFindReturnAddresses(UINT64         Rip,
+                                 UINT64         StackPointer,
+                                 const UINT64 * StackWords,
+                                 UINT32         NumberOfWords,
+                                 UINT64 *       Frames,
+                                 UINT32         MaximumFrames);
+
+UINT32
+SampleProfileFindSymbol(const SAMPLE_PROFILE_SYMBOL * Symbols, UINT32 NumberOfSymbols, UINT64 Address);
+
+VOID
+SampleProfileSymbolize(const PROFILER_SAMPLE *       Samples,
+                       UINT32                        NumberOfSamples,
+                       const SAMPLE_PROFILE_SYMBOL * Symbols,
+                       UINT32                        NumberOfSymbols,
+                       PSAMPLE_PROFILE_FUNCTION      Functions);
+
+UINT32
+SampleProfileSortFunctions(PSAMPLE_PROFILE_FUNCTION Functions, UINT32 NumberOfFunctions);
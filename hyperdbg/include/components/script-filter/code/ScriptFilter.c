@@ -0,0 +1,418 @@
+/**
+ * @file ScriptFilter.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Fast-path filters of the scripts
+ * @details Most of the scripts of the events are only an if statement that
+ * checks a few registers, e.g., 'if (@rcx == 0x10 && $pid == 4) { ... }'.
+ * The script engine generates the following code for them:
+ *
+ *      add   num(n), stack_index, stack_index  ; allocate the temporaries
+ *      equal num(0x10), reg(rcx), temp(0)
+ *      equal num(4), pseudo_reg($pid), temp(1)
+ *      and   temp(1), temp(0), temp(2)
+ *      jz    num(end of the script), temp(2)
+ *      ...                                     ; the body
+ *
+ * If the code before the jz only compares the registers, the constants and
+ * the pseudo-registers and the jz goes to the end of the script, then the
+ * script does nothing unless all of the comparisons are true, thus the
+ * comparisons are lowered to a filter that is checked without running the
+ * script engine
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Convert a register of the script engine to an operand
+ *
+ * @param RegisterId
+ * @param Operand
+ *
+ * @return BOOLEAN FALSE if it's not a general-purpose register
+ */
+static BOOLEAN
+ScriptFilterCompileRegister(UINT64 RegisterId, PSCRIPT_FILTER_OPERAND Operand)
+{
+    UINT32 Variant;
+
+    //
+    // The registers of the script engine are in the order of GUEST_REGS,
+    // rax-rbx and r8-r15 have 5 forms (64, 32, 16, high 8 and low 8 bits)
+    // and rsp-rdi have 4 forms (64, 32, 16 and low 8 bits)
+    //
+    if (RegisterId < REGISTER_RSP)
+    {
+        Operand->Index = (UINT8)(RegisterId / 5);
+        Variant        = RegisterId % 5;
+    }
+    else if (RegisterId < REGISTER_R8)
+    {
+        Operand->Index = (UINT8)(4 + (RegisterId - REGISTER_RSP) / 4);
+        Variant        = (RegisterId - REGISTER_RSP) % 4;
+
+        //
+        // There is no high 8 bits form
+        //
+        if (Variant == 3)
+        {
+            Variant = 4;
+        }
+    }
+    else if (RegisterId <= REGISTER_R15L)
+    {
+        Operand->Index = (UINT8)(8 + (RegisterId - REGISTER_R8) / 5);
+        Variant        = (RegisterId - REGISTER_R8) % 5;
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    Operand->Type  = SCRIPT_FILTER_OPERAND_TYPE_REGISTER;
+    Operand->Shift = Variant == 3 ? 8 : 0;
+
+    switch (Variant)
+    {
+    case 0:
+        Operand->Value = 0xffffffffffffffffull;
+        break;
+    case 1:
+        Operand->Value = 0xffffffff;
+        break;
+    case 2:
+        Operand->Value = 0xffff;
+        break;
+    default:
+        Operand->Value = 0xff;
+        break;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Convert a symbol to an operand
+ *
+ * @param Symbol
+ * @param Operand
+ *
+ * @return BOOLEAN FALSE if the value of the symbol is not a register, a
+ * constant or a supported pseudo-register
+ */
+static BOOLEAN
+ScriptFilterCompileOperand(PSYMBOL Symbol, PSCRIPT_FILTER_OPERAND Operand)
+{
+    memset(Operand, 0, sizeof(SCRIPT_FILTER_OPERAND));
+
+    switch (Symbol->Type)
+    {
+    case SYMBOL_NUM_TYPE:
+
+        Operand->Type  = SCRIPT_FILTER_OPERAND_TYPE_CONSTANT;
+        Operand->Value = Symbol->Value;
+
+        return TRUE;
+
+    case SYMBOL_REGISTER_TYPE:
+
+        return ScriptFilterCompileRegister(Symbol->Value, Operand);
+
+    case SYMBOL_PSEUDO_REG_TYPE:
+
+        if (Symbol->Value == PSEUDO_REGISTER_PID)
+        {
+            Operand->Index = SCRIPT_FILTER_PSEUDO_REGISTER_PID;
+        }
+        else if (Symbol->Value == PSEUDO_REGISTER_TID)
+        {
+            Operand->Index = SCRIPT_FILTER_PSEUDO_REGISTER_TID;
+        }
+        else if (Symbol->Value == PSEUDO_REGISTER_CORE)
+        {
+            Operand->Index = SCRIPT_FILTER_PSEUDO_REGISTER_CORE;
+        }
+        else
+        {
+            return FALSE;
+        }
+
+        Operand->Type = SCRIPT_FILTER_OPERAND_TYPE_PSEUDO_REGISTER;
+
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Lower the condition of a script to a filter
+ *
+ * @param Symbols The code of the script
+ * @param NumberOfSymbols Number of the symbols of the code (the pointer of
+ * the symbol buffer)
+ * @param Filter
+ *
+ * @return BOOLEAN FALSE if the script doesn't start with an if statement
+ * (without else) whose condition only has comparisons and '&&'
+ */
+BOOLEAN
+ScriptFilterCompile(PSYMBOL Symbols, UINT32 NumberOfSymbols, PSCRIPT_FILTER Filter)
+{
+    SCRIPT_FILTER Compiled                           = {0};
+    UINT32        Temps[SCRIPT_FILTER_MAXIMUM_TEMPS] = {0}; // Mask of the terms of each temporary
+    UINT32        Used                               = 0;
+    UINT32        Index                              = 0;
+    PSYMBOL       Operator;
+    PSYMBOL       Src0;
+    PSYMBOL       Src1;
+    PSYMBOL       Des;
+
+    //
+    // Skip the allocation of the temporaries
+    //
+    if (NumberOfSymbols >= 4 &&
+        Symbols[0].Type == SYMBOL_SEMANTIC_RULE_TYPE && Symbols[0].Value == FUNC_ADD &&
+        Symbols[1].Type == SYMBOL_NUM_TYPE &&
+        Symbols[2].Type == SYMBOL_STACK_INDEX_TYPE &&
+        Symbols[3].Type == SYMBOL_STACK_INDEX_TYPE)
+    {
+        Index = 4;
+    }
+
+    //
+    // All of the instructions have (at least) two operands
+    //
+    while (Index + 2 < NumberOfSymbols)
+    {
+        Operator = &Symbols[Index];
+        Src0     = &Symbols[Index + 1];
+        Src1     = &Symbols[Index + 2];
+
+        if (Operator->Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            return FALSE;
+        }
+
+        if (Operator->Value == FUNC_JZ)
+        {
+            //
+            // The body is skipped by jumping to the end of the script
+            //
+            if (Src0->Type != SYMBOL_NUM_TYPE || Src0->Value != NumberOfSymbols)
+            {
+                return FALSE;
+            }
+
+            if (Src1->Type == SYMBOL_TEMP_TYPE)
+            {
+                if (Src1->Value >= SCRIPT_FILTER_MAXIMUM_TEMPS || Temps[Src1->Value] == 0)
+                {
+                    return FALSE;
+                }
+
+                Used = Temps[Src1->Value];
+            }
+            else
+            {
+                //
+                // e.g., 'if (@rcx) { ... }'
+                //
+                if (Compiled.NumberOfTerms == SCRIPT_FILTER_MAXIMUM_TERMS ||
+                    !ScriptFilterCompileOperand(Src1, &Compiled.Terms[Compiled.NumberOfTerms].Left))
+                {
+                    return FALSE;
+                }
+
+                Compiled.Terms[Compiled.NumberOfTerms].Operator   = SCRIPT_FILTER_OPERATOR_NOT_EQUAL;
+                Compiled.Terms[Compiled.NumberOfTerms].Right.Type = SCRIPT_FILTER_OPERAND_TYPE_CONSTANT;
+
+                Used = 1 << Compiled.NumberOfTerms;
+                Compiled.NumberOfTerms++;
+            }
+
+            //
+            // Only keep the comparisons that are used in the condition
+            //
+            Filter->NumberOfTerms   = 0;
+            Filter->PseudoRegisters = 0;
+
+            for (UINT32 i = 0; i < Compiled.NumberOfTerms; i++)
+            {
+                if (Used & (1 << i))
+                {
+                    Filter->Terms[Filter->NumberOfTerms++] = Compiled.Terms[i];
+
+                    if (Compiled.Terms[i].Left.Type == SCRIPT_FILTER_OPERAND_TYPE_PSEUDO_REGISTER)
+                    {
+                        Filter->PseudoRegisters |= 1 << Compiled.Terms[i].Left.Index;
+                    }
+
+                    if (Compiled.Terms[i].Right.Type == SCRIPT_FILTER_OPERAND_TYPE_PSEUDO_REGISTER)
+                    {
+                        Filter->PseudoRegisters |= 1 << Compiled.Terms[i].Right.Index;
+                    }
+                }
+            }
+
+            return TRUE;
+        }
+
+        //
+        // The other instructions have a destination, that should be a temporary
+        //
+        if (Index + 3 >= NumberOfSymbols)
+        {
+            return FALSE;
+        }
+
+        Des = &Symbols[Index + 3];
+
+        if (Des->Type != SYMBOL_TEMP_TYPE || Des->Value >= SCRIPT_FILTER_MAXIMUM_TEMPS)
+        {
+            return FALSE;
+        }
+
+        if (Operator->Value == FUNC_AND)
+        {
+            //
+            // The results of the comparisons are 0 or 1, so '&' is the same as '&&'
+            //
+            if (Src0->Type != SYMBOL_TEMP_TYPE || Src0->Value >= SCRIPT_FILTER_MAXIMUM_TEMPS || Temps[Src0->Value] == 0 ||
+                Src1->Type != SYMBOL_TEMP_TYPE || Src1->Value >= SCRIPT_FILTER_MAXIMUM_TEMPS || Temps[Src1->Value] == 0)
+            {
+                return FALSE;
+            }
+
+            Temps[Des->Value] = Temps[Src0->Value] | Temps[Src1->Value];
+        }
+        else
+        {
+            PSCRIPT_FILTER_TERM Term = &Compiled.Terms[Compiled.NumberOfTerms];
+
+            switch (Operator->Value)
+            {
+            case FUNC_EQUAL:
+                Term->Operator = SCRIPT_FILTER_OPERATOR_EQUAL;
+                break;
+            case FUNC_NEQ:
+                Term->Operator = SCRIPT_FILTER_OPERATOR_NOT_EQUAL;
+                break;
+            case FUNC_GT:
+                Term->Operator = SCRIPT_FILTER_OPERATOR_GREATER;
+                break;
+            case FUNC_LT:
+                Term->Operator = SCRIPT_FILTER_OPERATOR_LESS;
+                break;
+            case FUNC_EGT:
+                Term->Operator = SCRIPT_FILTER_OPERATOR_GREATER_OR_EQUAL;
+                break;
+            case FUNC_ELT:
+                Term->Operator = SCRIPT_FILTER_OPERATOR_LESS_OR_EQUAL;
+                break;
+            default:
+                return FALSE;
+            }
+
+            //
+            // The script engine compares the second operand to the first one
+            //
+            if (Compiled.NumberOfTerms == SCRIPT_FILTER_MAXIMUM_TERMS ||
+                !ScriptFilterCompileOperand(Src1, &Term->Left) ||
+                !ScriptFilterCompileOperand(Src0, &Term->Right))
+            {
+                return FALSE;
+            }
+
+            Temps[Des->Value] = 1 << Compiled.NumberOfTerms;
+            Compiled.NumberOfTerms++;
+        }
+
+        Index += 4;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Get the value of an operand
+ *
+ * @param Operand
+ * @param Regs
+ * @param PseudoRegisters
+ *
+ * @return UINT64
+ */
+static UINT64
+ScriptFilterGetOperand(PSCRIPT_FILTER_OPERAND Operand, PGUEST_REGS Regs, UINT64 * PseudoRegisters)
+{
+    switch (Operand->Type)
+    {
+    case SCRIPT_FILTER_OPERAND_TYPE_REGISTER:
+        return (((UINT64 *)Regs)[Operand->Index] >> Operand->Shift) & Operand->Value;
+
+    case SCRIPT_FILTER_OPERAND_TYPE_PSEUDO_REGISTER:
+        return PseudoRegisters[Operand->Index];
+
+    default:
+        return Operand->Value;
+    }
+}
+
+/**
+ * @brief Check whether the body of the script should be run or not
+ *
+ * @param Filter
+ * @param Regs
+ * @param PseudoRegisters Values of the pseudo-registers (only the ones that
+ * are used by the filter are read)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptFilterEvaluate(PSCRIPT_FILTER Filter, PGUEST_REGS Regs, UINT64 * PseudoRegisters)
+{
+    INT64   Left;
+    INT64   Right;
+    BOOLEAN Result;
+
+    for (UINT32 i = 0; i < Filter->NumberOfTerms; i++)
+    {
+        Left  = (INT64)ScriptFilterGetOperand(&Filter->Terms[i].Left, Regs, PseudoRegisters);
+        Right = (INT64)ScriptFilterGetOperand(&Filter->Terms[i].Right, Regs, PseudoRegisters);
+
+        switch (Filter->Terms[i].Operator)
+        {
+        case SCRIPT_FILTER_OPERATOR_EQUAL:
+            Result = Left == Right;
+            break;
+        case SCRIPT_FILTER_OPERATOR_NOT_EQUAL:
+            Result = Left != Right;
+            break;
+        case SCRIPT_FILTER_OPERATOR_GREATER:
+            Result = Left > Right;
+            break;
+        case SCRIPT_FILTER_OPERATOR_LESS:
+            Result = Left < Right;
+            break;
+        case SCRIPT_FILTER_OPERATOR_GREATER_OR_EQUAL:
+            Result = Left >= Right;
+            break;
+        default:
+            Result = Left <= Right;
+            break;
+        }
+
+        if (!Result)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file ScriptFilter.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the fast-path filters of the scripts
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum comparisons in the condition of a filter
+ *
+ */
+#define SCRIPT_FILTER_MAXIMUM_TERMS 8
+
+/**
+ * @brief Maximum temporary variables (of the script engine) that are
+ * tracked while the filter is compiled
+ *
+ */
+#define SCRIPT_FILTER_MAXIMUM_TEMPS 32
+
+//////////////////////////////////////////////////
+//				    Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Type of the operands of the comparisons
+ *
+ */
+typedef enum _SCRIPT_FILTER_OPERAND_TYPE
+{
+    SCRIPT_FILTER_OPERAND_TYPE_CONSTANT = 0,
+    SCRIPT_FILTER_OPERAND_TYPE_REGISTER,        // A (part of a) general-purpose register
+    SCRIPT_FILTER_OPERAND_TYPE_PSEUDO_REGISTER, // $pid, $tid or $core
+
+} SCRIPT_FILTER_OPERAND_TYPE;
+
+/**
+ * @brief The pseudo-registers that are passed to the filter
+ *
+ */
+typedef enum _SCRIPT_FILTER_PSEUDO_REGISTER
+{
+    SCRIPT_FILTER_PSEUDO_REGISTER_PID = 0,
+    SCRIPT_FILTER_PSEUDO_REGISTER_TID,
+    SCRIPT_FILTER_PSEUDO_REGISTER_CORE,
+    SCRIPT_FILTER_PSEUDO_REGISTER_COUNT,
+
+} SCRIPT_FILTER_PSEUDO_REGISTER;
+
+/**
+ * @brief Operators of the comparisons (the same as the script engine, the
+ * relational operators are signed)
+ *
+ */
+typedef enum _SCRIPT_FILTER_OPERATOR
+{
+    SCRIPT_FILTER_OPERATOR_EQUAL = 0,
+    SCRIPT_FILTER_OPERATOR_NOT_EQUAL,
+    SCRIPT_FILTER_OPERATOR_GREATER,
+    SCRIPT_FILTER_OPERATOR_LESS,
+    SCRIPT_FILTER_OPERATOR_GREATER_OR_EQUAL,
+    SCRIPT_FILTER_OPERATOR_LESS_OR_EQUAL,
+
+} SCRIPT_FILTER_OPERATOR;
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief An operand of a comparison
+ * @details The value of a register operand is
+ * (GUEST_REGS[Index] >> Shift) & Value
+ *
+ */
+typedef struct _SCRIPT_FILTER_OPERAND
+{
+    UINT8  Type;  // SCRIPT_FILTER_OPERAND_TYPE
+    UINT8  Index; // Index of the register in GUEST_REGS or the pseudo-register
+    UINT8  Shift;
+    UINT8  Reserved[5];
+    UINT64 Value; // The constant or the mask of the register
+
+} SCRIPT_FILTER_OPERAND, *PSCRIPT_FILTER_OPERAND;
+
+/**
+ * @brief A comparison of the condition
+ *
+ */
+typedef struct _SCRIPT_FILTER_TERM
+{
+    UINT32                Operator; // SCRIPT_FILTER_OPERATOR
+    UINT32                Reserved;
+    SCRIPT_FILTER_OPERAND Left;
+    SCRIPT_FILTER_OPERAND Right;
+
+} SCRIPT_FILTER_TERM, *PSCRIPT_FILTER_TERM;
+
+/**
+ * @brief The filter of a script whose body is only run if all of the
+ * comparisons are true
+ *
+ */
+typedef struct _SCRIPT_FILTER
+{
+    UINT32             NumberOfTerms;
+    UINT32             PseudoRegisters; // Mask of the used pseudo-registers
+    SCRIPT_FILTER_TERM Terms[SCRIPT_FILTER_MAXIMUM_TERMS];
+
+} SCRIPT_FILTER, *PSCRIPT_FILTER;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+ScriptFilterCompile(PSYMBOL Symbols, UINT32 NumberOfSymbols, PSCRIPT_FILTER Filter);
+
+BOOLEAN
+ScriptFilterEvaluate(PSCRIPT_FILTER Filter, PGUEST_REGS Regs, UINT64 * PseudoRegisters);
@@ -0,0 +1,333 @@
+/**
+ * @file SharedEpt.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The shared EPT hierarchy and the private regions of the cores
+ * @details The identity map (the PML2 tables of the 1 GB regions and the
+ * tables of the 1 GB pages above 512 GB) is built once and shared by all of
+ * the cores, each core only has its own PML4 and PML3. Once a core changes
+ * a 1 GB region (e.g., splits a page for a hook), the region is privatized:
+ * its PML2 table (and the PML1 tables of the pages that are already split in
+ * the shared hierarchy) are copied and the PML3 entry of the core points to
+ * the copy, so the changes of the core are not visible to the other cores
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether an entry of a PML2 table points to a PML1 table
+ *
+ * @param Entry
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SharedEptIsSplitEntry(UINT64 Entry)
+{
+    return (Entry & SHARED_EPT_ENTRY_PRESENT) && !(Entry & SHARED_EPT_ENTRY_LARGE_PAGE);
+}
+
+/**
+ * @brief Get the count of the tables that the privatization of a region needs
+ *
+ * @param SharedPml2Table The shared PML2 table of the region
+ *
+ * @return UINT32
+ */
+UINT32
+SharedEptGetRegionCost(const UINT64 * SharedPml2Table)
+{
+    UINT32 Cost = 1;
+
+    for (UINT32 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        if (SharedEptIsSplitEntry(SharedPml2Table[i]))
+        {
+            Cost++;
+        }
+    }
+
+    return Cost;
+}
+
+/**
+ * @brief Copy a table to a new private table
+ *
+ * @param Source
+ * @param PhysicalAddress The physical address of the new table
+ * @param Callbacks
+ *
+ * @return UINT64 * The new table or NULL
+ */
+static UINT64 *
+SharedEptCopyTable(const UINT64 * Source, UINT64 * PhysicalAddress, PSHARED_EPT_CALLBACKS Callbacks)
+{
+    UINT64 * Table = (UINT64 *)Callbacks->Allocate(PhysicalAddress, Callbacks->Context);
+
+    if (Table == NULL)
+    {
+        return NULL;
+    }
+
+    for (UINT32 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        Table[i] = Source[i];
+    }
+
+    return Table;
+}
+
+/**
+ * @brief Free the copies of the PML1 tables of a private region
+ * @details Only the entries that are split in the shared hierarchy have
+ * copies, the tables of the pages that are split later (e.g., by the hooks)
+ * are not freed
+ *
+ * @param SharedPml2Table The shared PML2 table of the region
+ * @param Pml2Table The private PML2 table of the region
+ * @param NumberOfEntries Count of the entries that are copied
+ * @param Callbacks
+ *
+ * @return VOID
+ */
+static VOID
+SharedEptFreePml1Copies(const UINT64 * SharedPml2Table, UINT64 * Pml2Table, UINT32 NumberOfEntries, PSHARED_EPT_CALLBACKS Callbacks)
+{
+    for (UINT32 i = 0; i < NumberOfEntries; i++)
+    {
+        if (SharedEptIsSplitEntry(SharedPml2Table[i]) &&
+            (Pml2Table[i] & SHARED_EPT_ENTRY_ADDRESS) != (SharedPml2Table[i] & SHARED_EPT_ENTRY_ADDRESS))
+        {
+            Callbacks->Free(Callbacks->PhysicalToVirtual(Pml2Table[i] & SHARED_EPT_ENTRY_ADDRESS, Callbacks->Context), Callbacks->Context);
+        }
+    }
+}
+
+/**
+ * @brief Privatize a 1 GB region of a core
+ * @details The copies are completed before the PML3 entry of the core is
+ * changed, so the core always sees a complete hierarchy. The region should
+ * not be already private (the caller checks the PML3 entry)
+ *
+ * @param SharedPml2Table The shared PML2 table of the region
+ * @param Pml3Entry The PML3 entry of the core that maps the region
+ * @param Callbacks
+ *
+ * @return UINT64 * The private PML2 table or NULL if the tables are not
+ * allocated (nothing is changed)
+ */
+UINT64 *
+SharedEptPrivatizeRegion(const UINT64 * SharedPml2Table, UINT64 * Pml3Entry, PSHARED_EPT_CALLBACKS Callbacks)
+{
+    UINT64 * Pml2Table;
+    UINT64 * Pml1Table;
+    UINT64 * SharedPml1Table;
+    UINT64   Pml2PhysicalAddress;
+    UINT64   Pml1PhysicalAddress;
+    UINT32   i;
+
+    Pml2Table = SharedEptCopyTable(SharedPml2Table, &Pml2PhysicalAddress, Callbacks);
+
+    if (Pml2Table == NULL)
+    {
+        return NULL;
+    }
+
+    //
+    // The pages that are split in the shared hierarchy need their own PML1
+    // tables, otherwise the changes of their 4 KB entries are shared
+    //
+    for (i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        if (!SharedEptIsSplitEntry(SharedPml2Table[i]))
+        {
+            continue;
+        }
+
+        SharedPml1Table = (UINT64 *)Callbacks->PhysicalToVirtual(SharedPml2Table[i] & SHARED_EPT_ENTRY_ADDRESS, Callbacks->Context);
+        Pml1Table       = SharedPml1Table == NULL ? NULL : SharedEptCopyTable(SharedPml1Table, &Pml1PhysicalAddress, Callbacks);
+
+        if (Pml1Table == NULL)
+        {
+            break;
+        }
+
+        Pml2Table[i] = (SharedPml2Table[i] & ~SHARED_EPT_ENTRY_ADDRESS) | Pml1PhysicalAddress;
+    }
+
+    if (i != SHARED_EPT_TABLE_ENTRIES)
+    {
+        //
+        // Free the copies of the previous entries (they point to the new
+        // tables)
+        //
+        SharedEptFreePml1Copies(SharedPml2Table, Pml2Table, i, Callbacks);
+
+        Callbacks->Free(Pml2Table, Callbacks->Context);
+
+        return NULL;
+    }
+
+    *Pml3Entry = (*Pml3Entry & ~SHARED_EPT_ENTRY_ADDRESS) | Pml2PhysicalAddress;
+
+    return Pml2Table;
+}
+
+/**
+ * @brief Free the private tables of a region of a core (the copies that are
+ * allocated by the privatization)
+ * @details The PML3 entry of the core should not be used anymore (or should
+ * point to the shared table again)
+ *
+ * @param SharedPml2Table The shared PML2 table of the region
+ * @param Pml2Table The private PML2 table of the region
+ * @param Callbacks
+ *
+ * @return VOID
+ */
+VOID
+SharedEptReleaseRegion(const UINT64 * SharedPml2Table, UINT64 * Pml2Table, PSHARED_EPT_CALLBACKS Callbacks)
+{
+    SharedEptFreePml1Copies(SharedPml2Table, Pml2Table, SHARED_EPT_TABLE_ENTRIES, Callbacks);
+
+    Callbacks->Free(Pml2Table, Callbacks->Context);
+}
+
+/**
+ * @brief Initialize the reservation of the private tables, all of the
+ * regions are shared by all of the cores
+ *
+ * @param Reservation
+ * @param NumberOfCores
+ * @param MaximumRegionCost Maximum count of the tables for privatizing a region
+ *
+ * @return VOID
+ */
+VOID
+SharedEptInitializeReservation(PSHARED_EPT_RESERVATION Reservation, UINT32 NumberOfCores, UINT32 MaximumRegionCost)
+{
+    Reservation->NumberOfCores           = NumberOfCores;
+    Reservation->MaximumRegionCost       = MaximumRegionCost;
+    Reservation->NumberOfSharedRegions   = SHARED_EPT_TABLE_ENTRIES;
+    Reservation->NumberOfReservedRegions = 0;
+    Reservation->NumberOfReservedTables  = 0;
+
+    for (UINT32 i = 0; i < SHARED_EPT_TABLE_ENTRIES; i++)
+    {
+        Reservation->NumberOfSharedCores[i] = NumberOfCores;
+    }
+}
+
+/**
+ * @brief Top up the reserved tables, so they cover the reserved regions
+ * (but not more than the regions that are still shared)
+ *
+ * @param Reservation
+ *
+ * @return UINT32 Count of the tables that should be allocated
+ */
+static UINT32
+SharedEptTopUpReservation(PSHARED_EPT_RESERVATION Reservation)
+{
+    UINT64 NumberOfRegions;
+    UINT64 NumberOfTables;
+
+    NumberOfRegions = Reservation->NumberOfReservedRegions < Reservation->NumberOfSharedRegions ? Reservation->NumberOfReservedRegions : Reservation->NumberOfSharedRegions;
+    NumberOfTables  = NumberOfRegions * Reservation->NumberOfCores * Reservation->MaximumRegionCost;
+
+    if (Reservation->NumberOfReservedTables >= NumberOfTables)
+    {
+        return 0;
+    }
+
+    NumberOfTables -= Reservation->NumberOfReservedTables;
+
+    Reservation->NumberOfReservedTables += NumberOfTables;
+
+    return (UINT32)NumberOfTables;
+}
+
+/**
+ * @brief Reserve the tables of the regions that might be privatized later
+ * (e.g., by the hooks in vmx-root mode)
+ * @details Each hook privatizes at most one region, so the count of the
+ * hooks is added to the reserved regions, the tables are only allocated
+ * for the regions that are still shared and the reserved tables that are
+ * not used yet are counted
+ *
+ * @param Reservation
+ * @param NumberOfRegions
+ *
+ * @return UINT32 Count of the tables that should be allocated
+ */
+UINT32
+SharedEptReserveRegions(PSHARED_EPT_RESERVATION Reservation, UINT32 NumberOfRegions)
+{
+    if (NumberOfRegions > SHARED_EPT_TABLE_ENTRIES - Reservation->NumberOfReservedRegions)
+    {
+        Reservation->NumberOfReservedRegions = SHARED_EPT_TABLE_ENTRIES;
+    }
+    else
+    {
+        Reservation->NumberOfReservedRegions += NumberOfRegions;
+    }
+
+    return SharedEptTopUpReservation(Reservation);
+}
+
+/**
+ * @brief Reserve the tables of a region that is privatized right away
+ * (e.g., by a batch of the hooks)
+ *
+ * @param Reservation
+ * @param Region Index of the region
+ * @param RegionCost Count of the tables for privatizing the region
+ *
+ * @return UINT32 Count of the tables that should be allocated (zero if the
+ * region is already private on all of the cores)
+ */
+UINT32
+SharedEptReserveRegion(PSHARED_EPT_RESERVATION Reservation, UINT32 Region, UINT32 RegionCost)
+{
+    UINT32 NumberOfTables = Reservation->NumberOfSharedCores[Region] * RegionCost;
+
+    Reservation->NumberOfReservedTables += NumberOfTables;
+
+    return NumberOfTables;
+}
+
+/**
+ * @brief Account a region that is privatized on a core
+ *
+ * @param Reservation
+ * @param Region Index of the region
+ * @param RegionCost Count of the tables that are used for privatizing the region
+ * @param IsReserved Whether the reserved tables are used or not
+ *
+ * @return UINT32 Count of the tables that should be allocated to top up the
+ * reservation (zero if the other regions are already covered)
+ */
+UINT32
+SharedEptRegionPrivatized(PSHARED_EPT_RESERVATION Reservation, UINT32 Region, UINT32 RegionCost, BOOLEAN IsReserved)
+{
+    if (Reservation->NumberOfSharedCores[Region] != 0)
+    {
+        Reservation->NumberOfSharedCores[Region]--;
+
+        if (Reservation->NumberOfSharedCores[Region] == 0)
+        {
+            Reservation->NumberOfSharedRegions--;
+        }
+    }
+
+    if (IsReserved)
+    {
+        Reservation->NumberOfReservedTables -= RegionCost < Reservation->NumberOfReservedTables ? RegionCost : Reservation->NumberOfReservedTables;
+    }
+
+    return SharedEptTopUpReservation(Reservation);
+}
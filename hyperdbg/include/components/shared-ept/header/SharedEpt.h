@@ -0,0 +1,115 @@
+/**
+ * @file SharedEpt.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the shared EPT hierarchy and the private regions of the cores
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Entries of the tables of the EPT
+ *
+ */
+#define SHARED_EPT_TABLE_ENTRIES 512
+#define SHARED_EPT_PAGE_SIZE     0x1000
+
+/**
+ * @brief Bits of the entries of the EPT
+ *
+ */
+#define SHARED_EPT_ENTRY_PRESENT    0x7ull // Read, write or execute
+#define SHARED_EPT_ENTRY_LARGE_PAGE 0x80ull
+#define SHARED_EPT_ENTRY_ADDRESS    0x000ffffffffff000ull
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that allocates a page for a private table, it returns the
+ * virtual address of the page (or NULL) and its physical address
+ *
+ */
+typedef PVOID (*SHARED_EPT_ALLOCATE_TABLE_CALLBACK)(UINT64 * PhysicalAddress, PVOID Context);
+
+/**
+ * @brief Callback that frees a page that is allocated by the allocation
+ * callback (when the privatization of a region fails or the region is
+ * released)
+ *
+ */
+typedef VOID (*SHARED_EPT_FREE_TABLE_CALLBACK)(PVOID Table, PVOID Context);
+
+/**
+ * @brief Callback that converts the physical address of a table to its
+ * virtual address
+ *
+ */
+typedef PVOID (*SHARED_EPT_PHYSICAL_TO_VIRTUAL_CALLBACK)(UINT64 PhysicalAddress, PVOID Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The callbacks of the privatization of the regions
+ *
+ */
+typedef struct _SHARED_EPT_CALLBACKS
+{
+    SHARED_EPT_ALLOCATE_TABLE_CALLBACK      Allocate;
+    SHARED_EPT_FREE_TABLE_CALLBACK          Free;
+    SHARED_EPT_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual;
+    PVOID                                   Context;
+
+} SHARED_EPT_CALLBACKS, *PSHARED_EPT_CALLBACKS;
+
+/**
+ * @brief The reservation of the private tables, the tables are only reserved
+ * for the regions that are still shared by at least one of the cores
+ *
+ */
+typedef struct _SHARED_EPT_RESERVATION
+{
+    UINT32 NumberOfCores;
+    UINT32 MaximumRegionCost;                             // Maximum count of the tables for privatizing a region of a core
+    UINT32 NumberOfSharedRegions;                         // Regions that are still shared by at least one of the cores
+    UINT32 NumberOfSharedCores[SHARED_EPT_TABLE_ENTRIES]; // Cores that still share each region
+    UINT32 NumberOfReservedRegions;                       // Regions that the reserved tables should cover
+    UINT64 NumberOfReservedTables;                        // Tables that are reserved and not used yet
+
+} SHARED_EPT_RESERVATION, *PSHARED_EPT_RESERVATION;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+UINT32
+SharedEptGetRegionCost(const UINT64 * SharedPml2Table);
+
+UINT64 *
+SharedEptPrivatizeRegion(const UINT64 * SharedPml2Table, UINT64 * Pml3Entry, PSHARED_EPT_CALLBACKS Callbacks);
+
+VOID
+SharedEptReleaseRegion(const UINT64 * SharedPml2Table, UINT64 * Pml2Table, PSHARED_EPT_CALLBACKS Callbacks);
+
+VOID
+SharedEptInitializeReservation(PSHARED_EPT_RESERVATION Reservation, UINT32 NumberOfCores, UINT32 MaximumRegionCost);
+
+UINT32
+SharedEptReserveRegions(PSHARED_EPT_RESERVATION Reservation, UINT32 NumberOfRegions);
+
+UINT32
+SharedEptReserveRegion(PSHARED_EPT_RESERVATION Reservation, UINT32 Region, UINT32 RegionCost);
+
+UINT32
+SharedEptRegionPrivatized(PSHARED_EPT_RESERVATION Reservation, UINT32 Region, UINT32 RegionCost, BOOLEAN IsReserved);
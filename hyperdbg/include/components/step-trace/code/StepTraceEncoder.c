@@ -0,0 +1,289 @@
+/**
+ * @file StepTraceEncoder.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Delta encoder and decoder of the step traces
+ * @details Consecutive instructions are mostly a few bytes apart and most
+ * instructions only change one or two registers, so each step keeps the
+ * zigzag varint of the difference of RIP (and of the changed registers)
+ * with the previous step. This way, a step of a straight-line code takes
+ * a single byte instead of a full RIP
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Encode a signed difference as a zigzag varint
+ *
+ * @param Data
+ * @param Delta
+ *
+ * @return UINT32 number of written bytes
+ */
+static UINT32
+StepTraceWriteVarint(UINT8 * Data, UINT64 Delta)
+{
+    UINT64 Value  = (Delta << 1) ^ (UINT64)((INT64)Delta >> 63);
+    UINT32 Length = 0;
+
+    while (Value >= 0x80)
+    {
+        Data[Length++] = (UINT8)(Value | 0x80);
+        Value >>= 7;
+    }
+
+    Data[Length++] = (UINT8)Value;
+
+    return Length;
+}
+
+/**
+ * @brief Decode a zigzag varint
+ *
+ * @param Data
+ * @param DataSize
+ * @param Offset Offset of the varint, it's moved after the varint
+ * @param Delta
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+StepTraceReadVarint(const UINT8 * Data, UINT32 DataSize, UINT32 * Offset, UINT64 * Delta)
+{
+    UINT64 Value = 0;
+
+    for (UINT32 Shift = 0; Shift < 64; Shift += 7)
+    {
+        UINT8 Byte;
+
+        if (*Offset >= DataSize)
+        {
+            return FALSE;
+        }
+
+        Byte = Data[(*Offset)++];
+        Value |= (UINT64)(Byte & 0x7f) << Shift;
+
+        if ((Byte & 0x80) == 0)
+        {
+            *Delta = (Value >> 1) ^ (0 - (Value & 1));
+            return TRUE;
+        }
+    }
+
+    //
+    // Malformed varint
+    //
+    return FALSE;
+}
+
+/**
+ * @brief Initialize a step trace buffer
+ *
+ * @param Buffer
+ * @param Core
+ * @param NumberOfRegisters
+ * @param RegisterIds Indexes of the traced registers in GUEST_REGS
+ * @param Rip RIP before the first step
+ * @param Registers Values of the traced registers before the first step
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+StepTraceInitializeBuffer(PSTEP_TRACE_BUFFER Buffer,
+                          UINT16             Core,
+                          UINT8              NumberOfRegisters,
+                          const UINT8 *      RegisterIds,
+                          UINT64             Rip,
+                          const UINT64 *     Registers)
+{
+    STEP_TRACE_HEADER * Header = &Buffer->Header;
+
+    if (NumberOfRegisters > STEP_TRACE_NUMBER_OF_REGISTERS)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < NumberOfRegisters; i++)
+    {
+        if (RegisterIds[i] >= EVENT_TRACE_NUMBER_OF_GENERAL_REGISTERS)
+        {
+            return FALSE;
+        }
+    }
+
+    memset(Header, 0, sizeof(STEP_TRACE_HEADER));
+
+    Header->Magic             = STEP_TRACE_BUFFER_MAGIC;
+    Header->Core              = Core;
+    Header->NumberOfRegisters = NumberOfRegisters;
+    Header->StopReason        = STEP_TRACE_STOP_REASON_NOT_STOPPED;
+    Header->InitialRip        = Rip;
+    Header->LastRip           = Rip;
+
+    for (UINT32 i = 0; i < NumberOfRegisters; i++)
+    {
+        Header->RegisterIds[i]      = RegisterIds[i];
+        Header->InitialRegisters[i] = Registers[i];
+        Header->LastRegisters[i]    = Registers[i];
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether the buffer might not have room for another step
+ *
+ * @param Buffer
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+StepTraceIsBufferFull(const STEP_TRACE_BUFFER * Buffer)
+{
+    return Buffer->Header.DataSize + STEP_TRACE_MAXIMUM_STEP_SIZE > STEP_TRACE_MAXIMUM_DATA_SIZE;
+}
+
+/**
+ * @brief Add a step to the step trace buffer
+ *
+ * @param Buffer
+ * @param Rip RIP after the step
+ * @param Registers Values of the traced registers after the step
+ *
+ * @return BOOLEAN FALSE if the buffer is full
+ */
+BOOLEAN
+StepTraceAddStep(PSTEP_TRACE_BUFFER Buffer, UINT64 Rip, const UINT64 * Registers)
+{
+    STEP_TRACE_HEADER * Header = &Buffer->Header;
+    UINT8 *             Data;
+    UINT32              Length = 0;
+    UINT8               Flags  = 0;
+
+    if (StepTraceIsBufferFull(Buffer))
+    {
+        return FALSE;
+    }
+
+    Data = &Buffer->Data[Header->DataSize];
+
+    if (Header->NumberOfRegisters != 0)
+    {
+        //
+        // The first byte marks the changed registers
+        //
+        for (UINT32 i = 0; i < Header->NumberOfRegisters; i++)
+        {
+            if (Registers[i] != Header->LastRegisters[i])
+            {
+                Flags |= (UINT8)(1 << i);
+            }
+        }
+
+        Data[Length++] = Flags;
+    }
+
+    Length += StepTraceWriteVarint(&Data[Length], Rip - Header->LastRip);
+    Header->LastRip = Rip;
+
+    for (UINT32 i = 0; i < Header->NumberOfRegisters; i++)
+    {
+        if (Flags & (1 << i))
+        {
+            Length += StepTraceWriteVarint(&Data[Length], Registers[i] - Header->LastRegisters[i]);
+            Header->LastRegisters[i] = Registers[i];
+        }
+    }
+
+    Header->DataSize += Length;
+    Header->NumberOfSteps++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Decode the steps of a step trace
+ *
+ * @param Header
+ * @param Data Encoded steps
+ * @param DataSize Size of the encoded steps
+ * @param Callback Called for each of the steps (can be NULL for validating
+ * the trace)
+ * @param Context
+ *
+ * @return BOOLEAN FALSE if the trace is malformed
+ */
+BOOLEAN
+StepTraceDecode(const STEP_TRACE_HEADER *  Header,
+                const UINT8 *              Data,
+                UINT32                     DataSize,
+                STEP_TRACE_DECODE_CALLBACK Callback,
+                PVOID                      Context)
+{
+    UINT64 Rip                                       = Header->InitialRip;
+    UINT64 Registers[STEP_TRACE_NUMBER_OF_REGISTERS] = {0};
+    UINT32 Offset                                    = 0;
+    UINT64 Delta;
+
+    if (Header->Magic != STEP_TRACE_BUFFER_MAGIC ||
+        Header->NumberOfRegisters > STEP_TRACE_NUMBER_OF_REGISTERS ||
+        DataSize != Header->DataSize)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Header->NumberOfRegisters; i++)
+    {
+        Registers[i] = Header->InitialRegisters[i];
+    }
+
+    for (UINT32 Step = 0; Step < Header->NumberOfSteps; Step++)
+    {
+        UINT8 Flags = 0;
+
+        if (Header->NumberOfRegisters != 0)
+        {
+            if (Offset >= DataSize)
+            {
+                return FALSE;
+            }
+
+            Flags = Data[Offset++];
+        }
+
+        if (!StepTraceReadVarint(Data, DataSize, &Offset, &Delta))
+        {
+            return FALSE;
+        }
+
+        Rip += Delta;
+
+        for (UINT32 i = 0; i < Header->NumberOfRegisters; i++)
+        {
+            if (Flags & (1 << i))
+            {
+                if (!StepTraceReadVarint(Data, DataSize, &Offset, &Delta))
+                {
+                    return FALSE;
+                }
+
+                Registers[i] += Delta;
+            }
+        }
+
+        if (Callback != NULL && !Callback(Step, Rip, Registers, Context))
+        {
+            return TRUE;
+        }
+    }
+
+    //
+    // The whole buffer should be consumed and the last step should
+    // be the one that is saved in the header
+    //
+    return Offset == DataSize && Rip == Header->LastRip;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file StepTraceEncoder.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the delta encoder and decoder of the step traces
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that receives each of the decoded steps, returning
+ * FALSE stops the decoding
+ *
+ */
+typedef BOOLEAN (*STEP_TRACE_DECODE_CALLBACK)(UINT32         StepIndex,
+                                              UINT64         Rip,
+                                              const UINT64 * Registers,
+                                              PVOID          Context);
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+StepTraceInitializeBuffer(PSTEP_TRACE_BUFFER Buffer,
+                          UINT16             Core,
+                          UINT8              NumberOfRegisters,
+                          const UINT8 *      RegisterIds,
+                          UINT64             Rip,
+                          const UINT64 *     Registers);
+
+BOOLEAN
+StepTraceAddStep(PSTEP_TRACE_BUFFER Buffer, UINT64 Rip, const UINT64 * Registers);
+
+BOOLEAN
+StepTraceIsBufferFull(const STEP_TRACE_BUFFER * Buffer);
+
+BOOLEAN
+StepTraceDecode(const STEP_TRACE_HEADER *  Header,
+                const UINT8 *              Data,
+                UINT32                     DataSize,
+                STEP_TRACE_DECODE_CALLBACK Callback,
+                PVOID                      Context);
@@ -0,0 +1,262 @@
+/**
+ * @file SubPagePermission.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Tables of the sub-page write permissions (SPP)
+ * @details When the write access of the EPT entry of a 4 KB page is 0 and
+ * bit 61 of the entry is set, the processor walks the SPP tables (with the
+ * same layout as the EPT) and uses the SPP vector of the page to check the
+ * write permission of each 128 byte sub-page of it, so the writes to the
+ * sub-pages that are writable in the vector won't cause EPT violations
+ *
+ * The tables are allocated by the callbacks, so the same code builds the
+ * tables from the pre-allocated pools in vmx-root mode and from the regular
+ * memory in the tests
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the sub-pages that are touched by a range
+ * @details Both of the addresses are in the same page, and the end address
+ * is inclusive (the same as the ranges of the monitor hooks)
+ *
+ * @param StartAddress
+ * @param EndAddress
+ *
+ * @return UINT32 The mask of sub-pages (bit i for sub-page i)
+ */
+UINT32
+SppGetSubPagesOfRange(UINT64 StartAddress, UINT64 EndAddress)
+{
+    UINT32 FirstSubPage;
+    UINT32 LastSubPage;
+
+    if (EndAddress < StartAddress || (StartAddress & ~((UINT64)SPP_PAGE_SIZE - 1)) != (EndAddress & ~((UINT64)SPP_PAGE_SIZE - 1)))
+    {
+        //
+        // The range is not in a single page
+        //
+        return 0;
+    }
+
+    FirstSubPage = (UINT32)((StartAddress & (SPP_PAGE_SIZE - 1)) >> SPP_SUB_PAGE_SHIFT);
+    LastSubPage  = (UINT32)((EndAddress & (SPP_PAGE_SIZE - 1)) >> SPP_SUB_PAGE_SHIFT);
+
+    return (UINT32)((2ull << LastSubPage) - (1ull << FirstSubPage));
+}
+
+/**
+ * @brief Get the SPP vector that protects the sub-pages against writes
+ * and lets the other sub-pages to be written
+ *
+ * @param ProtectedSubPages The mask of the protected sub-pages
+ *
+ * @return UINT64 The SPP vector
+ */
+UINT64
+SppGetWriteVector(UINT32 ProtectedSubPages)
+{
+    UINT64 Vector = (UINT32)~ProtectedSubPages;
+
+    //
+    // Move bit i of the writable sub-pages to bit 2i
+    //
+    Vector = (Vector | (Vector << 16)) & 0x0000ffff0000ffffull;
+    Vector = (Vector | (Vector << 8)) & 0x00ff00ff00ff00ffull;
+    Vector = (Vector | (Vector << 4)) & 0x0f0f0f0f0f0f0f0full;
+    Vector = (Vector | (Vector << 2)) & 0x3333333333333333ull;
+    Vector = (Vector | (Vector << 1)) & 0x5555555555555555ull;
+
+    return Vector;
+}
+
+/**
+ * @brief Check whether a write is allowed by the SPP vector of its page
+ * @details A write is allowed if all of its sub-pages are writable, the
+ * bytes of the write that go to the next page are checked by the vector of
+ * the next page
+ *
+ * @param WriteVector
+ * @param Address
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SppIsWriteAllowedByVector(UINT64 WriteVector, UINT64 Address, UINT32 Size)
+{
+    UINT64 EndAddress = Address + (Size ? Size - 1 : 0);
+
+    if ((EndAddress & ~((UINT64)SPP_PAGE_SIZE - 1)) != (Address & ~((UINT64)SPP_PAGE_SIZE - 1)))
+    {
+        EndAddress = Address | (SPP_PAGE_SIZE - 1);
+    }
+
+    return (SppGetWriteVector(SppGetSubPagesOfRange(Address, EndAddress)) | WriteVector) == SPP_WRITE_VECTOR_ALL_WRITABLE;
+}
+
+/**
+ * @brief Initialize the tables and allocate the root table
+ *
+ * @param Table
+ * @param Allocate
+ * @param PhysicalToVirtual
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SppTableInitialize(PSPP_TABLE                             Table,
+                   SPP_TABLE_ALLOCATE_CALLBACK            Allocate,
+                   SPP_TABLE_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual,
+                   PVOID                                  Context)
+{
+    Table->Allocate          = Allocate;
+    Table->PhysicalToVirtual = PhysicalToVirtual;
+    Table->Context           = Context;
+    Table->NumberOfTables    = 0;
+    Table->Root              = (UINT64 *)Allocate(&Table->RootPhysicalAddress, Context);
+
+    if (Table->Root == NULL)
+    {
+        return FALSE;
+    }
+
+    Table->NumberOfTables = 1;
+
+    return TRUE;
+}
+
+/**
+ * @brief Walk the tables to the SPP vector of a page
+ *
+ * @param Table
+ * @param PhysicalAddress
+ * @param AllocateTables Whether the missing tables should be allocated or not
+ *
+ * @return UINT64 * The SPP vector or NULL if the page is not mapped
+ */
+static UINT64 *
+SppTableWalk(PSPP_TABLE Table, UINT64 PhysicalAddress, BOOLEAN AllocateTables)
+{
+    UINT64 * CurrentTable = Table->Root;
+    UINT64 * NextTable;
+    UINT64   NextTablePhysicalAddress;
+    UINT32   Index;
+
+    if (CurrentTable == NULL)
+    {
+        return NULL;
+    }
+
+    for (UINT32 Level = SPP_TABLE_LEVELS; Level > 1; Level--)
+    {
+        Index = (UINT32)(PhysicalAddress >> (12 + (Level - 1) * 9)) & (SPP_TABLE_ENTRIES - 1);
+
+        if (CurrentTable[Index] & SPP_TABLE_ENTRY_VALID)
+        {
+            NextTable = (UINT64 *)Table->PhysicalToVirtual(CurrentTable[Index] & SPP_TABLE_ENTRY_ADDRESS, Table->Context);
+
+            if (NextTable == NULL)
+            {
+                return NULL;
+            }
+        }
+        else
+        {
+            if (!AllocateTables)
+            {
+                return NULL;
+            }
+
+            NextTable = (UINT64 *)Table->Allocate(&NextTablePhysicalAddress, Table->Context);
+
+            if (NextTable == NULL)
+            {
+                return NULL;
+            }
+
+            //
+            // The new table is zeroed, so the tables below it are not valid
+            //
+            CurrentTable[Index] = (NextTablePhysicalAddress & SPP_TABLE_ENTRY_ADDRESS) | SPP_TABLE_ENTRY_VALID;
+            Table->NumberOfTables++;
+        }
+
+        CurrentTable = NextTable;
+    }
+
+    return &CurrentTable[(PhysicalAddress >> 12) & (SPP_TABLE_ENTRIES - 1)];
+}
+
+/**
+ * @brief Get the SPP vector of a page
+ *
+ * @param Table
+ * @param PhysicalAddress
+ *
+ * @return UINT64 * The SPP vector or NULL if the tables of the page are
+ * not allocated
+ */
+UINT64 *
+SppTableGetWriteVector(PSPP_TABLE Table, UINT64 PhysicalAddress)
+{
+    return SppTableWalk(Table, PhysicalAddress, FALSE);
+}
+
+/**
+ * @brief Set the SPP vector of a page and allocate the missing tables of it
+ * @details The vector should be set before the EPT entry of the page is
+ * changed to use it, at most SPP_TABLE_MAXIMUM_NEW_PAGE tables are allocated
+ *
+ * @param Table
+ * @param PhysicalAddress
+ * @param WriteVector
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SppTableSetWriteVector(PSPP_TABLE Table, UINT64 PhysicalAddress, UINT64 WriteVector)
+{
+    UINT64 * Vector = SppTableWalk(Table, PhysicalAddress, TRUE);
+
+    if (Vector == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // The reserved (odd) bits should be zero, otherwise the processor
+    // reports a misconfiguration
+    //
+    *Vector = WriteVector & SPP_WRITE_VECTOR_ALL_WRITABLE;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether a write to a page that uses the SPP is allowed, the
+ * same as the processor (a missing table doesn't allow the write)
+ *
+ * @param Table
+ * @param PhysicalAddress
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SppTableIsWriteAllowed(PSPP_TABLE Table, UINT64 PhysicalAddress, UINT32 Size)
+{
+    UINT64 * Vector = SppTableWalk(Table, PhysicalAddress, FALSE);
+
+    if (Vector == NULL)
+    {
+        return FALSE;
+    }
+
+    return SppIsWriteAllowedByVector(*Vector, PhysicalAddress, Size);
+}
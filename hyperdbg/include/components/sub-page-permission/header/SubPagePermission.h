@@ -0,0 +1,116 @@
+/**
+ * @file SubPagePermission.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the tables of the sub-page write permissions (SPP)
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Each 4 KB page is divided into 32 sub-pages of 128 bytes
+ *
+ */
+#define SPP_PAGE_SIZE           0x1000
+#define SPP_SUB_PAGE_SIZE       128
+#define SPP_SUB_PAGE_SHIFT      7
+#define SPP_SUB_PAGES_IN_A_PAGE 32
+#define SPP_ALL_SUB_PAGES       0xffffffff
+
+/**
+ * @brief Entries of the tables of the SPP (the same as the EPT, the tables
+ * are indexed by bits 47:39, 38:30, 29:21 and 20:12 of the physical address)
+ *
+ */
+#define SPP_TABLE_ENTRIES          512
+#define SPP_TABLE_LEVELS           4
+#define SPP_TABLE_ENTRY_VALID      0x1ull
+#define SPP_TABLE_ENTRY_ADDRESS    0x000ffffffffff000ull
+#define SPP_TABLE_MAXIMUM_NEW_PAGE (SPP_TABLE_LEVELS - 1) // Tables that a page might need below the root
+
+/**
+ * @brief The leaf entries (SPP vectors) have the write permission of
+ * sub-page i in bit 2i, the odd bits are reserved
+ *
+ */
+#define SPP_WRITE_VECTOR_ALL_WRITABLE 0x5555555555555555ull
+
+/**
+ * @brief Bit 61 of the EPT entries of the 4 KB pages makes the processor
+ * check the SPP vector of the page when the write access of the entry is 0
+ *
+ */
+#define SPP_EPT_ENTRY_FLAG (1ull << 61)
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that allocates a zeroed page for a table, it returns the
+ * virtual address of the page (or NULL) and its physical address
+ *
+ */
+typedef PVOID (*SPP_TABLE_ALLOCATE_CALLBACK)(UINT64 * PhysicalAddress, PVOID Context);
+
+/**
+ * @brief Callback that converts the physical address of a table (previously
+ * allocated by the allocation callback) to its virtual address
+ *
+ */
+typedef PVOID (*SPP_TABLE_PHYSICAL_TO_VIRTUAL_CALLBACK)(UINT64 PhysicalAddress, PVOID Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The tables of the sub-page write permissions
+ *
+ */
+typedef struct _SPP_TABLE
+{
+    UINT64 *                               Root;                // The table of the level 4 (SPPTP)
+    UINT64                                 RootPhysicalAddress;
+    UINT32                                 NumberOfTables;      // Including the root
+    SPP_TABLE_ALLOCATE_CALLBACK            Allocate;
+    SPP_TABLE_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual;
+    PVOID                                  Context;
+
+} SPP_TABLE, *PSPP_TABLE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+UINT32
+SppGetSubPagesOfRange(UINT64 StartAddress, UINT64 EndAddress);
+
+UINT64
+SppGetWriteVector(UINT32 ProtectedSubPages);
+
+BOOLEAN
+SppIsWriteAllowedByVector(UINT64 WriteVector, UINT64 Address, UINT32 Size);
+
+BOOLEAN
+SppTableInitialize(PSPP_TABLE                             Table,
+                   SPP_TABLE_ALLOCATE_CALLBACK            Allocate,
+                   SPP_TABLE_PHYSICAL_TO_VIRTUAL_CALLBACK PhysicalToVirtual,
+                   PVOID                                  Context);
+
+UINT64 *
+SppTableGetWriteVector(PSPP_TABLE Table, UINT64 PhysicalAddress);
+
+BOOLEAN
+SppTableSetWriteVector(PSPP_TABLE Table, UINT64 PhysicalAddress, UINT64 WriteVector);
+
+BOOLEAN
+SppTableIsWriteAllowed(PSPP_TABLE Table, UINT64 PhysicalAddress, UINT32 Size);
@@ -0,0 +1,630 @@
+/**
+ * @file SymbolSync.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Incremental (diff-based) and batched symbol table synchronization
+ * @details The debuggee computes the difference between the previously sent
+ * symbol table and the current one (keyed on the base address of the module
+ * plus the GUID and age of its PDB) and only sends the added and removed
+ * modules. Multiple compact entries are packed into each batch
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether the module has a valid GUID and age
+ *
+ * @param Module
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymbolSyncHasGuidAndAge(PMODULE_SYMBOL_DETAIL Module)
+{
+    return Module->IsSymbolDetailsFound && Module->ModuleSymbolGuidAndAge[0] != '\0';
+}
+
+/**
+ * @brief Check whether two entries of the symbol table refer to the same module
+ * @details Modules are keyed on their base address and the GUID and age of
+ * their PDB, modules without symbol details are keyed on their file path
+ *
+ * @param FirstModule
+ * @param SecondModule
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolSyncIsSameModule(PMODULE_SYMBOL_DETAIL FirstModule, PMODULE_SYMBOL_DETAIL SecondModule)
+{
+    if (FirstModule->BaseAddress != SecondModule->BaseAddress)
+    {
+        return FALSE;
+    }
+
+    if (SymbolSyncHasGuidAndAge(FirstModule) != SymbolSyncHasGuidAndAge(SecondModule))
+    {
+        return FALSE;
+    }
+
+    if (SymbolSyncHasGuidAndAge(FirstModule))
+    {
+        return strncmp(FirstModule->ModuleSymbolGuidAndAge,
+                       SecondModule->ModuleSymbolGuidAndAge,
+                       MAXIMUM_GUID_AND_AGE_SIZE - 1) == 0;
+    }
+
+    return strncmp(FirstModule->FilePath, SecondModule->FilePath, MAX_PATH - 1) == 0;
+}
+
+/**
+ * @brief Compute the hash of the key of a module
+ *
+ * @param Module
+ *
+ * @return UINT64
+ */
+static UINT64
+SymbolSyncHashModule(PMODULE_SYMBOL_DETAIL Module)
+{
+    UINT64       Hash = 0xcbf29ce484222325ull;
+    const char * Key;
+    UINT32       KeyLength;
+
+    if (SymbolSyncHasGuidAndAge(Module))
+    {
+        Key       = Module->ModuleSymbolGuidAndAge;
+        KeyLength = (UINT32)strnlen(Module->ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE - 1);
+    }
+    else
+    {
+        Key       = Module->FilePath;
+        KeyLength = (UINT32)strnlen(Module->FilePath, MAX_PATH - 1);
+    }
+
+    //
+    // FNV-1a over the base address and the key
+    //
+    for (UINT32 i = 0; i < sizeof(UINT64); i++)
+    {
+        Hash ^= (Module->BaseAddress >> (i * 8)) & 0xff;
+        Hash *= 0x100000001b3ull;
+    }
+
+    for (UINT32 i = 0; i < KeyLength; i++)
+    {
+        Hash ^= (UINT8)Key[i];
+        Hash *= 0x100000001b3ull;
+    }
+
+    //
+    // Finalize (mix) the bits as the hashes are summed up
+    //
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdull;
+    Hash ^= Hash >> 33;
+
+    return Hash;
+}
+
+/**
+ * @brief Compute the digest of a symbol table
+ * @details The digest does not depend on the order of the modules, thus
+ * both of the debugger and the debuggee compute the same digest for the
+ * same set of modules
+ *
+ * @param SymbolTable
+ * @param NumberOfModules
+ *
+ * @return UINT64
+ */
+UINT64
+SymbolSyncComputeDigest(PMODULE_SYMBOL_DETAIL SymbolTable, UINT32 NumberOfModules)
+{
+    UINT64 Digest = NumberOfModules;
+
+    for (UINT32 i = 0; i < NumberOfModules; i++)
+    {
+        Digest += SymbolSyncHashModule(&SymbolTable[i]);
+    }
+
+    //
+    // Zero is reserved for showing an unknown table
+    //
+    if (Digest == SYMBOL_SYNC_DIGEST_UNKNOWN)
+    {
+        Digest = 1;
+    }
+
+    return Digest;
+}
+
+/**
+ * @brief Compare two modules based on their base address (used for sorting)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return int
+ */
+static int
+SymbolSyncCompareBaseAddress(const void * First, const void * Second)
+{
+    PMODULE_SYMBOL_DETAIL FirstModule  = *(PMODULE_SYMBOL_DETAIL *)First;
+    PMODULE_SYMBOL_DETAIL SecondModule = *(PMODULE_SYMBOL_DETAIL *)Second;
+
+    if (FirstModule->BaseAddress < SecondModule->BaseAddress)
+    {
+        return -1;
+    }
+    else if (FirstModule->BaseAddress > SecondModule->BaseAddress)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Allocate an array of pointers to the modules sorted by their base address
+ *
+ * @param SymbolTable
+ * @param NumberOfModules
+ *
+ * @return PMODULE_SYMBOL_DETAIL * the caller should free the buffer
+ */
+static PMODULE_SYMBOL_DETAIL *
+SymbolSyncSortByBaseAddress(PMODULE_SYMBOL_DETAIL SymbolTable, UINT32 NumberOfModules)
+{
+    PMODULE_SYMBOL_DETAIL * SortedModules;
+
+    //
+    // Allocate at least one entry so a NULL always shows an error
+    //
+    SortedModules = (PMODULE_SYMBOL_DETAIL *)malloc((NumberOfModules + 1) * sizeof(PMODULE_SYMBOL_DETAIL));
+
+    if (SortedModules == NULL)
+    {
+        return NULL;
+    }
+
+    for (UINT32 i = 0; i < NumberOfModules; i++)
+    {
+        SortedModules[i] = &SymbolTable[i];
+    }
+
+    qsort(SortedModules, NumberOfModules, sizeof(PMODULE_SYMBOL_DETAIL), SymbolSyncCompareBaseAddress);
+
+    return SortedModules;
+}
+
+/**
+ * @brief Encode a single module into the synchronization buffer
+ *
+ * @param Buffer
+ * @param RemainingLength
+ * @param Action
+ * @param Module
+ *
+ * @return UINT32 length of the encoded entry or zero if it does not fit
+ */
+static UINT32
+SymbolSyncEncodeEntry(BYTE * Buffer, UINT32 RemainingLength, UINT8 Action, PMODULE_SYMBOL_DETAIL Module)
+{
+    DEBUGGER_SYMBOL_SYNC_ENTRY Entry = {0};
+    UINT32                     EntryLength;
+
+    Entry.BaseAddress = Module->BaseAddress;
+    Entry.Action      = Action;
+
+    Entry.Flags = (UINT8)((Module->IsSymbolDetailsFound ? SYMBOL_SYNC_ENTRY_FLAG_SYMBOL_DETAILS_FOUND : 0) |
+                          (Module->IsLocalSymbolPath ? SYMBOL_SYNC_ENTRY_FLAG_LOCAL_SYMBOL_PATH : 0) |
+                          (Module->IsSymbolPDBAvaliable ? SYMBOL_SYNC_ENTRY_FLAG_PDB_AVAILABLE : 0) |
+                          (Module->IsUserMode ? SYMBOL_SYNC_ENTRY_FLAG_USER_MODE : 0) |
+                          (Module->Is32Bit ? SYMBOL_SYNC_ENTRY_FLAG_32_BIT : 0));
+
+    if (Action == SYMBOL_SYNC_ENTRY_ACTION_REMOVE_MODULE)
+    {
+        //
+        // Only the key of the module is needed for removing it
+        //
+        if (SymbolSyncHasGuidAndAge(Module))
+        {
+            Entry.GuidAndAgeLength = (UINT8)strnlen(Module->ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE - 1);
+        }
+        else
+        {
+            Entry.FilePathLength = (UINT16)strnlen(Module->FilePath, MAX_PATH - 1);
+        }
+    }
+    else
+    {
+        Entry.GuidAndAgeLength       = (UINT8)strnlen(Module->ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE - 1);
+        Entry.FilePathLength         = (UINT16)strnlen(Module->FilePath, MAX_PATH - 1);
+        Entry.ModuleSymbolPathLength = (UINT16)strnlen(Module->ModuleSymbolPath, MAX_PATH - 1);
+    }
+
+    EntryLength = sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY) + Entry.GuidAndAgeLength + Entry.FilePathLength + Entry.ModuleSymbolPathLength;
+
+    if (EntryLength > RemainingLength)
+    {
+        return 0;
+    }
+
+    //
+    // Entries are not aligned, so they are copied byte by byte
+    //
+    memcpy(Buffer, &Entry, sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY));
+    Buffer += sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY);
+
+    memcpy(Buffer, Module->ModuleSymbolGuidAndAge, Entry.GuidAndAgeLength);
+    Buffer += Entry.GuidAndAgeLength;
+
+    memcpy(Buffer, Module->FilePath, Entry.FilePathLength);
+    Buffer += Entry.FilePathLength;
+
+    memcpy(Buffer, Module->ModuleSymbolPath, Entry.ModuleSymbolPathLength);
+
+    return EntryLength;
+}
+
+/**
+ * @brief Decode a single module from the synchronization buffer
+ *
+ * @param Buffer
+ * @param RemainingLength
+ * @param Action
+ * @param Module
+ *
+ * @return UINT32 length of the decoded entry or zero if the entry is malformed
+ */
+static UINT32
+SymbolSyncDecodeEntry(BYTE * Buffer, UINT32 RemainingLength, PUINT8 Action, PMODULE_SYMBOL_DETAIL Module)
+{
+    DEBUGGER_SYMBOL_SYNC_ENTRY Entry;
+    UINT32                     EntryLength;
+
+    if (RemainingLength < sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY))
+    {
+        return 0;
+    }
+
+    memcpy(&Entry, Buffer, sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY));
+    Buffer += sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY);
+
+    EntryLength = sizeof(DEBUGGER_SYMBOL_SYNC_ENTRY) + Entry.GuidAndAgeLength + Entry.FilePathLength + Entry.ModuleSymbolPathLength;
+
+    //
+    // Check for the malformed entries (strings should be null-terminated
+    // in the symbol table)
+    //
+    if (EntryLength > RemainingLength ||
+        Entry.GuidAndAgeLength >= MAXIMUM_GUID_AND_AGE_SIZE ||
+        Entry.FilePathLength >= MAX_PATH ||
+        Entry.ModuleSymbolPathLength >= MAX_PATH)
+    {
+        return 0;
+    }
+
+    RtlZeroMemory(Module, sizeof(MODULE_SYMBOL_DETAIL));
+
+    Module->BaseAddress          = Entry.BaseAddress;
+    Module->IsSymbolDetailsFound = (Entry.Flags & SYMBOL_SYNC_ENTRY_FLAG_SYMBOL_DETAILS_FOUND) ? TRUE : FALSE;
+    Module->IsLocalSymbolPath    = (Entry.Flags & SYMBOL_SYNC_ENTRY_FLAG_LOCAL_SYMBOL_PATH) ? TRUE : FALSE;
+    Module->IsSymbolPDBAvaliable = (Entry.Flags & SYMBOL_SYNC_ENTRY_FLAG_PDB_AVAILABLE) ? TRUE : FALSE;
+    Module->IsUserMode           = (Entry.Flags & SYMBOL_SYNC_ENTRY_FLAG_USER_MODE) ? TRUE : FALSE;
+    Module->Is32Bit              = (Entry.Flags & SYMBOL_SYNC_ENTRY_FLAG_32_BIT) ? TRUE : FALSE;
+
+    memcpy(Module->ModuleSymbolGuidAndAge, Buffer, Entry.GuidAndAgeLength);
+    Buffer += Entry.GuidAndAgeLength;
+
+    memcpy(Module->FilePath, Buffer, Entry.FilePathLength);
+    Buffer += Entry.FilePathLength;
+
+    memcpy(Module->ModuleSymbolPath, Buffer, Entry.ModuleSymbolPathLength);
+
+    *Action = Entry.Action;
+
+    return EntryLength;
+}
+
+/**
+ * @brief Add a module to the current batch and flush the batch whenever it is full
+ *
+ * @param Batch
+ * @param BatchLength
+ * @param Action
+ * @param Module
+ * @param SendBatch
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymbolSyncAddToBatch(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch,
+                     PUINT32                             BatchLength,
+                     UINT8                               Action,
+                     PMODULE_SYMBOL_DETAIL               Module,
+                     SYMBOL_SYNC_SEND_BATCH_CALLBACK     SendBatch,
+                     PVOID                               Context)
+{
+    UINT32 EntryLength;
+
+    EntryLength = SymbolSyncEncodeEntry((BYTE *)Batch + *BatchLength,
+                                        SYMBOL_SYNC_MAXIMUM_BATCH_SIZE - *BatchLength,
+                                        Action,
+                                        Module);
+
+    if (EntryLength == 0)
+    {
+        //
+        // The batch is full, send it and start a new one
+        //
+        if (!SendBatch(Batch, *BatchLength, Context))
+        {
+            return FALSE;
+        }
+
+        Batch->BatchIndex++;
+        Batch->NumberOfEntries = 0;
+        Batch->EntriesLength   = 0;
+        *BatchLength           = sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH);
+
+        EntryLength = SymbolSyncEncodeEntry((BYTE *)Batch + *BatchLength,
+                                            SYMBOL_SYNC_MAXIMUM_BATCH_SIZE - *BatchLength,
+                                            Action,
+                                            Module);
+
+        if (EntryLength == 0)
+        {
+            return FALSE;
+        }
+    }
+
+    Batch->NumberOfEntries++;
+    Batch->EntriesLength += EntryLength;
+    *BatchLength += EntryLength;
+
+    return TRUE;
+}
+
+/**
+ * @brief Send the difference of the previous and the current symbol tables
+ * @details If the digest of the debugger's table does not match the previous
+ * table (or it's unknown), all of the modules are sent and the debugger is asked
+ * to drop its previous table
+ *
+ * @param PreviousTable The symbol table that was previously sent to the debugger
+ * @param PreviousNumberOfModules
+ * @param CurrentTable The newly built symbol table
+ * @param CurrentNumberOfModules
+ * @param DebuggerSymbolTableDigest Digest of the debugger's symbol table
+ * @param SendBatch Callback to send each batch
+ * @param Context Context of the callback
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolSyncSendDifference(PMODULE_SYMBOL_DETAIL           PreviousTable,
+                         UINT32                          PreviousNumberOfModules,
+                         PMODULE_SYMBOL_DETAIL           CurrentTable,
+                         UINT32                          CurrentNumberOfModules,
+                         UINT64                          DebuggerSymbolTableDigest,
+                         SYMBOL_SYNC_SEND_BATCH_CALLBACK SendBatch,
+                         PVOID                           Context)
+{
+    PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch;
+    UINT32                              BatchLength;
+    PMODULE_SYMBOL_DETAIL *             PreviousSorted;
+    PMODULE_SYMBOL_DETAIL *             CurrentSorted;
+    BOOLEAN                             IsFullSynchronization;
+    BOOLEAN                             Result = TRUE;
+    UINT32                              i = 0, j = 0;
+
+    //
+    // Check whether the debugger has the same table as the previous one
+    //
+    IsFullSynchronization = PreviousTable == NULL ||
+                            DebuggerSymbolTableDigest == SYMBOL_SYNC_DIGEST_UNKNOWN ||
+                            DebuggerSymbolTableDigest != SymbolSyncComputeDigest(PreviousTable, PreviousNumberOfModules);
+
+    if (IsFullSynchronization)
+    {
+        PreviousNumberOfModules = 0;
+    }
+
+    Batch = (PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH)malloc(SYMBOL_SYNC_MAXIMUM_BATCH_SIZE);
+
+    if (Batch == NULL)
+    {
+        return FALSE;
+    }
+
+    RtlZeroMemory(Batch, SYMBOL_SYNC_MAXIMUM_BATCH_SIZE);
+
+    Batch->TotalSymbols          = CurrentNumberOfModules;
+    Batch->IsFullSynchronization = IsFullSynchronization;
+    BatchLength                  = sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH);
+
+    PreviousSorted = SymbolSyncSortByBaseAddress(PreviousTable, PreviousNumberOfModules);
+    CurrentSorted  = SymbolSyncSortByBaseAddress(CurrentTable, CurrentNumberOfModules);
+
+    if (PreviousSorted == NULL || CurrentSorted == NULL)
+    {
+        Result = FALSE;
+        goto Finished;
+    }
+
+    //
+    // Removed modules are sent first, thus a module that is replaced
+    // by another module at the same base address is removed first
+    //
+    while (Result && i < PreviousNumberOfModules)
+    {
+        while (j < CurrentNumberOfModules && CurrentSorted[j]->BaseAddress < PreviousSorted[i]->BaseAddress)
+        {
+            j++;
+        }
+
+        if (j >= CurrentNumberOfModules || !SymbolSyncIsSameModule(PreviousSorted[i], CurrentSorted[j]))
+        {
+            Result = SymbolSyncAddToBatch(Batch, &BatchLength, SYMBOL_SYNC_ENTRY_ACTION_REMOVE_MODULE, PreviousSorted[i], SendBatch, Context);
+        }
+
+        i++;
+    }
+
+    //
+    // Then, the newly added modules
+    //
+    i = 0;
+
+    for (j = 0; Result && j < CurrentNumberOfModules; j++)
+    {
+        while (i < PreviousNumberOfModules && PreviousSorted[i]->BaseAddress < CurrentSorted[j]->BaseAddress)
+        {
+            i++;
+        }
+
+        if (i >= PreviousNumberOfModules || !SymbolSyncIsSameModule(PreviousSorted[i], CurrentSorted[j]))
+        {
+            Result = SymbolSyncAddToBatch(Batch, &BatchLength, SYMBOL_SYNC_ENTRY_ACTION_ADD_MODULE, CurrentSorted[j], SendBatch, Context);
+        }
+    }
+
+    //
+    // Send the last batch, a full synchronization is always sent
+    // so the debugger drops its previous table
+    //
+    if (Result && (Batch->NumberOfEntries != 0 || (IsFullSynchronization && Batch->BatchIndex == 0)))
+    {
+        Result = SendBatch(Batch, BatchLength, Context);
+    }
+
+Finished:
+
+    if (PreviousSorted != NULL)
+    {
+        free(PreviousSorted);
+    }
+
+    if (CurrentSorted != NULL)
+    {
+        free(CurrentSorted);
+    }
+
+    free(Batch);
+
+    return Result;
+}
+
+/**
+ * @brief Apply a received batch to the symbol table
+ * @details The caller should allocate the symbol table with the capacity of
+ * MaximumNumberOfModules entries
+ *
+ * @param Batch
+ * @param BatchLength
+ * @param SymbolTable
+ * @param NumberOfModules Number of valid modules in the symbol table (updated)
+ * @param MaximumNumberOfModules
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolSyncApplyBatch(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch,
+                     UINT32                              BatchLength,
+                     PMODULE_SYMBOL_DETAIL               SymbolTable,
+                     PUINT32                             NumberOfModules,
+                     UINT32                              MaximumNumberOfModules)
+{
+    MODULE_SYMBOL_DETAIL Module;
+    UINT8                Action;
+    UINT32               EntryLength;
+    UINT32               Offset;
+    UINT32               Index;
+    BYTE *               Entries = (BYTE *)Batch + sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH);
+
+    if (BatchLength < sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH) ||
+        Batch->EntriesLength > BatchLength - sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH))
+    {
+        return FALSE;
+    }
+
+    //
+    // The first batch of a full synchronization drops the previous table
+    //
+    if (Batch->IsFullSynchronization && Batch->BatchIndex == 0)
+    {
+        *NumberOfModules = 0;
+    }
+
+    Offset = 0;
+
+    for (UINT32 i = 0; i < Batch->NumberOfEntries; i++)
+    {
+        EntryLength = SymbolSyncDecodeEntry(Entries + Offset, Batch->EntriesLength - Offset, &Action, &Module);
+
+        if (EntryLength == 0)
+        {
+            return FALSE;
+        }
+
+        Offset += EntryLength;
+
+        //
+        // Find the module in the table
+        //
+        for (Index = 0; Index < *NumberOfModules; Index++)
+        {
+            if (SymbolSyncIsSameModule(&SymbolTable[Index], &Module))
+            {
+                break;
+            }
+        }
+
+        if (Action == SYMBOL_SYNC_ENTRY_ACTION_REMOVE_MODULE)
+        {
+            if (Index != *NumberOfModules)
+            {
+                //
+                // Keep the order of the remaining modules
+                //
+                memmove(&SymbolTable[Index],
+                        &SymbolTable[Index + 1],
+                        (*NumberOfModules - Index - 1) * sizeof(MODULE_SYMBOL_DETAIL));
+
+                (*NumberOfModules)--;
+            }
+        }
+        else if (Action == SYMBOL_SYNC_ENTRY_ACTION_ADD_MODULE)
+        {
+            if (Index != *NumberOfModules)
+            {
+                //
+                // Already exists, update the details
+                //
+                memcpy(&SymbolTable[Index], &Module, sizeof(MODULE_SYMBOL_DETAIL));
+            }
+            else
+            {
+                if (*NumberOfModules >= MaximumNumberOfModules)
+                {
+                    return FALSE;
+                }
+
+                memcpy(&SymbolTable[*NumberOfModules], &Module, sizeof(MODULE_SYMBOL_DETAIL));
+                (*NumberOfModules)++;
+            }
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file SymbolSync.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the incremental symbol table synchronization routines
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that sends (or consumes) each of the built batches
+ *
+ */
+typedef BOOLEAN (*SYMBOL_SYNC_SEND_BATCH_CALLBACK)(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch,
+                                                   UINT32                              BatchLength,
+                                                   PVOID                               Context);
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+SymbolSyncIsSameModule(PMODULE_SYMBOL_DETAIL FirstModule, PMODULE_SYMBOL_DETAIL SecondModule);
+
+UINT64
+SymbolSyncComputeDigest(PMODULE_SYMBOL_DETAIL SymbolTable, UINT32 NumberOfModules);
+
+BOOLEAN
+SymbolSyncSendDifference(PMODULE_SYMBOL_DETAIL           PreviousTable,
+                         UINT32                          PreviousNumberOfModules,
+                         PMODULE_SYMBOL_DETAIL           CurrentTable,
+                         UINT32                          CurrentNumberOfModules,
+                         UINT64                          DebuggerSymbolTableDigest,
+                         SYMBOL_SYNC_SEND_BATCH_CALLBACK SendBatch,
+                         PVOID                           Context);
+
+BOOLEAN
+SymbolSyncApplyBatch(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch,
+                     UINT32                              BatchLength,
+                     PMODULE_SYMBOL_DETAIL               SymbolTable,
+                     PUINT32                             NumberOfModules,
+                     UINT32                              MaximumNumberOfModules);
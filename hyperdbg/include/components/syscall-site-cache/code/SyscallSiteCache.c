@@ -0,0 +1,178 @@
+/**
+ * @file SyscallSiteCache.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The cache of the verified SYSCALL and SYSRET sites
+ * @details Once the EFER syscall hook is enabled, each SYSCALL and SYSRET
+ * causes a #UD and in the safe mode, the instruction is read from the memory
+ * of the guest (which needs switching to the guest's CR3 and checking the
+ * page) before it can be emulated. The sites that are already read are cached
+ * with the (CR3, RIP) key, so the hot sites of the kernel image (the SYSRETs)
+ * are emulated without reading the memory.
+ *
+ * A #UD is never caused by an instruction that is not present (it's a #PF),
+ * so a cached site is only stale if the code is changed, that's why the cache
+ * is flushed once the memory is modified by the debugger. The code that is
+ * changed by the guest itself (or a CR3 that is reused by a new process with a
+ * different layout) is not detected by the cache, thus, only the sites of the
+ * kernel image are trusted by the caller and the instruction of other sites is
+ * read again (without walking the page-table)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Make the key of a site
+ *
+ * @param Cr3
+ * @param Rip
+ *
+ * @return UINT64 The CR3 part of the key
+ */
+static UINT64
+SyscallSiteCacheMakeKey(UINT64 Cr3, UINT64 Rip)
+{
+    if (Rip & SYSCALL_SITE_CACHE_KERNEL_ADDRESS_MASK)
+    {
+        //
+        // SYSRET sites are shared between the processes
+        //
+        return NULL64_ZERO;
+    }
+
+    return Cr3 & SYSCALL_SITE_CACHE_CR3_MASK;
+}
+
+/**
+ * @brief Find the set of a site
+ * @details The stubs of ntdll are 0x20 bytes apart and the page tables of
+ * the processes are page aligned, so the bits are mixed by multiplying
+ *
+ * @param Cr3 The CR3 part of the key
+ * @param Rip
+ *
+ * @return UINT32
+ */
+static UINT32
+SyscallSiteCacheGetSet(UINT64 Cr3, UINT64 Rip)
+{
+    UINT64 Hash = (Rip ^ (Cr3 >> 12) * 0x9e3779b97f4a7c15ull) * 0x9e3779b97f4a7c15ull;
+
+    return (UINT32)(Hash >> 32) & (SYSCALL_SITE_CACHE_NUMBER_OF_SETS - 1);
+}
+
+/**
+ * @brief Flush the cache
+ *
+ * @param Cache
+ * @param Generation The new generation of the cache
+ *
+ * @return VOID
+ */
+VOID
+SyscallSiteCacheFlush(PSYSCALL_SITE_CACHE Cache, UINT32 Generation)
+{
+    memset(Cache->Entries, 0, sizeof(Cache->Entries));
+    memset(Cache->MostRecentlyUsed, 0, sizeof(Cache->MostRecentlyUsed));
+
+    Cache->Generation = Generation;
+    Cache->NumberOfFlushes++;
+}
+
+/**
+ * @brief Find a site in the cache
+ *
+ * @param Cache
+ * @param Cr3 The CR3 of the process
+ * @param Rip The address of the instruction that caused the #UD
+ * @param Generation The current (global) generation of the caches
+ *
+ * @return SYSCALL_SITE_CACHE_KIND SYSCALL_SITE_CACHE_KIND_NONE if the site
+ * is not cached
+ */
+SYSCALL_SITE_CACHE_KIND
+SyscallSiteCacheLookup(PSYSCALL_SITE_CACHE Cache, UINT64 Cr3, UINT64 Rip, UINT32 Generation)
+{
+    UINT64 Key = SyscallSiteCacheMakeKey(Cr3, Rip);
+    UINT32 Set = SyscallSiteCacheGetSet(Key, Rip);
+
+    if (Cache->Generation != Generation)
+    {
+        SyscallSiteCacheFlush(Cache, Generation);
+    }
+
+    for (UINT32 Way = 0; Way < SYSCALL_SITE_CACHE_NUMBER_OF_WAYS; Way++)
+    {
+        PSYSCALL_SITE_CACHE_ENTRY Entry = &Cache->Entries[Set][Way];
+
+        if (Entry->Kind != SYSCALL_SITE_CACHE_KIND_NONE && Entry->Rip == Rip && Entry->Cr3 == Key)
+        {
+            Cache->MostRecentlyUsed[Set] = (UINT8)Way;
+            Cache->NumberOfHits++;
+
+            return Entry->Kind;
+        }
+    }
+
+    Cache->NumberOfMisses++;
+
+    return SYSCALL_SITE_CACHE_KIND_NONE;
+}
+
+/**
+ * @brief Add a verified site to the cache
+ * @details The least recently used entry of the set is replaced
+ *
+ * @param Cache
+ * @param Cr3 The CR3 of the process
+ * @param Rip The address of the SYSCALL or the SYSRET instruction
+ * @param Kind
+ * @param Generation The current (global) generation of the caches, read
+ * after the site is verified
+ *
+ * @return VOID
+ */
+VOID
+SyscallSiteCacheInsert(PSYSCALL_SITE_CACHE     Cache,
+                       UINT64                  Cr3,
+                       UINT64                  Rip,
+                       SYSCALL_SITE_CACHE_KIND Kind,
+                       UINT32                  Generation)
+{
+    UINT64                    Key = SyscallSiteCacheMakeKey(Cr3, Rip);
+    UINT32                    Set = SyscallSiteCacheGetSet(Key, Rip);
+    UINT32                    Way;
+    PSYSCALL_SITE_CACHE_ENTRY Entry;
+
+    if (Cache->Generation != Generation)
+    {
+        //
+        // The memory is changed after the site is read
+        //
+        return;
+    }
+
+    for (Way = 0; Way < SYSCALL_SITE_CACHE_NUMBER_OF_WAYS; Way++)
+    {
+        if (Cache->Entries[Set][Way].Kind == SYSCALL_SITE_CACHE_KIND_NONE)
+        {
+            break;
+        }
+    }
+
+    if (Way == SYSCALL_SITE_CACHE_NUMBER_OF_WAYS)
+    {
+        Way = (Cache->MostRecentlyUsed[Set] + 1) % SYSCALL_SITE_CACHE_NUMBER_OF_WAYS;
+        Cache->NumberOfEvictions++;
+    }
+
+    Entry       = &Cache->Entries[Set][Way];
+    Entry->Cr3  = Key;
+    Entry->Rip  = Rip;
+    Entry->Kind = Kind;
+
+    Cache->MostRecentlyUsed[Set] = (UINT8)Way;
+}
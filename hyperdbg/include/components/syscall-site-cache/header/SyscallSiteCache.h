@@ -0,0 +1,110 @@
+/**
+ * @file SyscallSiteCache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the cache of the verified SYSCALL and SYSRET sites
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the sets (should be a power of two) and the entries in
+ * each set of the cache
+ *
+ */
+#define SYSCALL_SITE_CACHE_NUMBER_OF_SETS 64
+#define SYSCALL_SITE_CACHE_NUMBER_OF_WAYS 2
+
+/**
+ * @brief The PCID and the flags of the CR3 are not a part of the key
+ *
+ */
+#define SYSCALL_SITE_CACHE_CR3_MASK 0x000ffffffffff000ull
+
+/**
+ * @brief The kernel addresses are mapped the same in all of the processes,
+ * so the CR3 is not a part of their key
+ *
+ */
+#define SYSCALL_SITE_CACHE_KERNEL_ADDRESS_MASK 0xff00000000000000ull
+
+//////////////////////////////////////////////////
+//				    Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The instruction at a cached site
+ *
+ */
+typedef enum _SYSCALL_SITE_CACHE_KIND
+{
+    SYSCALL_SITE_CACHE_KIND_NONE = 0,
+    SYSCALL_SITE_CACHE_KIND_SYSCALL,
+    SYSCALL_SITE_CACHE_KIND_SYSRET,
+
+} SYSCALL_SITE_CACHE_KIND;
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of the cache
+ *
+ */
+typedef struct _SYSCALL_SITE_CACHE_ENTRY
+{
+    UINT64                  Cr3;
+    UINT64                  Rip;
+    SYSCALL_SITE_CACHE_KIND Kind;
+
+} SYSCALL_SITE_CACHE_ENTRY, *PSYSCALL_SITE_CACHE_ENTRY;
+
+/**
+ * @brief The cache of the verified SYSCALL and SYSRET sites of a core
+ * @details Each core has its own cache, so there is no lock. The cache is
+ * flushed whenever the generation that is passed to it is changed, thus,
+ * other cores (or vmx non-root) can invalidate all of the caches by only
+ * incrementing the global generation
+ *
+ */
+typedef struct _SYSCALL_SITE_CACHE
+{
+    SYSCALL_SITE_CACHE_ENTRY Entries[SYSCALL_SITE_CACHE_NUMBER_OF_SETS][SYSCALL_SITE_CACHE_NUMBER_OF_WAYS];
+    UINT8                    MostRecentlyUsed[SYSCALL_SITE_CACHE_NUMBER_OF_SETS];
+    UINT32                   Generation;
+
+    //
+    // Statistics
+    //
+    UINT64 NumberOfHits;
+    UINT64 NumberOfMisses;
+    UINT64 NumberOfEvictions;
+    UINT64 NumberOfFlushes;
+
+} SYSCALL_SITE_CACHE, *PSYSCALL_SITE_CACHE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+SYSCALL_SITE_CACHE_KIND
+SyscallSiteCacheLookup(PSYSCALL_SITE_CACHE Cache, UINT64 Cr3, UINT64 Rip, UINT32 Generation);
+
+VOID
+SyscallSiteCacheInsert(PSYSCALL_SITE_CACHE     Cache,
+                       UINT64                  Cr3,
+                       UINT64                  Rip,
+                       SYSCALL_SITE_CACHE_KIND Kind,
+                       UINT32                  Generation);
+
+VOID
+SyscallSiteCacheFlush(PSYSCALL_SITE_CACHE Cache, UINT32 Generation);
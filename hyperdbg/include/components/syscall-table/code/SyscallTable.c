@@ -0,0 +1,223 @@
+/**
+ * @file SyscallTable.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Resolving the targets of the system-calls from the service table
+ * @details KeServiceDescriptorTable is not exported, so it's located from the
+ * system-call entry (IA32_LSTAR) by scanning for the instructions that load
+ * the service descriptor tables in KiSystemServiceRepeat:
+ *
+ *      lea r10, [nt!KeServiceDescriptorTable]          ; 4c 8d 15 rel32
+ *      lea r11, [nt!KeServiceDescriptorTableShadow]    ; 4c 8d 1d rel32
+ *
+ * If KVA shadowing is enabled, the entry is KiSystemCall64Shadow which
+ * jumps to the body of KiSystemCall64, so the targets of its jumps are
+ * scanned too. All the accesses to the memory are through the read callback,
+ * thus, it works both on the live kernel and on dumped tables
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Scan the code for the instructions that load the service
+ * descriptor tables
+ *
+ * @param Table
+ * @param Start Address of the code
+ * @param JumpTargets If not NULL, targets of the 'jmp rel32' instructions
+ * are saved here (up to SYSCALL_TABLE_MAXIMUM_JUMP_TARGETS)
+ * @param NumberOfJumpTargets
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SyscallTableScan(PSYSCALL_TABLE Table, UINT64 Start, UINT64 * JumpTargets, UINT32 * NumberOfJumpTargets)
+{
+    BYTE   Window[SYSCALL_TABLE_SCAN_CHUNK_SIZE + SYSCALL_TABLE_PATTERN_SIZE];
+    UINT32 WindowSize    = 0;
+    UINT64 WindowAddress = Start;
+    UINT32 Overlap       = SYSCALL_TABLE_PATTERN_SIZE - 1;
+    INT32  Displacement;
+
+    for (UINT32 Scanned = 0; Scanned < SYSCALL_TABLE_MAXIMUM_SCAN_SIZE; Scanned += SYSCALL_TABLE_SCAN_CHUNK_SIZE)
+    {
+        //
+        // Keep the bytes that might be the start of an instruction that
+        // continues in the next chunk
+        //
+        if (WindowSize > Overlap)
+        {
+            memmove(Window, Window + WindowSize - Overlap, Overlap);
+            WindowAddress += WindowSize - Overlap;
+            WindowSize = Overlap;
+        }
+
+        if (!Table->Read(Start + Scanned, Window + WindowSize, SYSCALL_TABLE_SCAN_CHUNK_SIZE, Table->Context))
+        {
+            return FALSE;
+        }
+
+        Table->NumberOfReads++;
+        WindowSize += SYSCALL_TABLE_SCAN_CHUNK_SIZE;
+
+        for (UINT32 i = 0; i < WindowSize - Overlap; i++)
+        {
+            if (Window[i] == 0x4c && Window[i + 1] == 0x8d && Window[i + 2] == 0x15 &&
+                Window[i + 7] == 0x4c && Window[i + 8] == 0x8d && Window[i + 9] == 0x1d)
+            {
+                memcpy(&Displacement, &Window[i + 3], sizeof(INT32));
+                Table->ServiceDescriptorTable = WindowAddress + i + SYSCALL_TABLE_LEA_SIZE + (INT64)Displacement;
+
+                memcpy(&Displacement, &Window[i + 10], sizeof(INT32));
+                Table->ServiceDescriptorTableShadow = WindowAddress + i + SYSCALL_TABLE_PATTERN_SIZE + (INT64)Displacement;
+
+                return TRUE;
+            }
+
+            if (JumpTargets != NULL && Window[i] == 0xe9 && *NumberOfJumpTargets < SYSCALL_TABLE_MAXIMUM_JUMP_TARGETS)
+            {
+                memcpy(&Displacement, &Window[i + 1], sizeof(INT32));
+                JumpTargets[(*NumberOfJumpTargets)++] = WindowAddress + i + 5 + (INT64)Displacement;
+            }
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Read and check the service descriptor table
+ *
+ * @param Table
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SyscallTableReadDescriptor(PSYSCALL_TABLE Table)
+{
+    SYSCALL_TABLE_DESCRIPTOR Descriptor;
+
+    if (!Table->Read(Table->ServiceDescriptorTable, &Descriptor, sizeof(SYSCALL_TABLE_DESCRIPTOR), Table->Context))
+    {
+        return FALSE;
+    }
+
+    Table->NumberOfReads++;
+
+    //
+    // A byte pattern that is not really the load of the tables, is
+    // rejected here
+    //
+    if (Descriptor.ServiceTableBase == NULL64_ZERO ||
+        Descriptor.NumberOfServices == 0 ||
+        Descriptor.NumberOfServices > SYSCALL_TABLE_MAXIMUM_SERVICES)
+    {
+        return FALSE;
+    }
+
+    Table->ServiceTableBase = Descriptor.ServiceTableBase;
+    Table->NumberOfServices = (UINT32)Descriptor.NumberOfServices;
+
+    return TRUE;
+}
+
+/**
+ * @brief Locate the service table of the kernel
+ *
+ * @param Table The read callback (and its context) should be set
+ * @param SyscallEntry The system-call entry (IA32_LSTAR)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallTableLocate(PSYSCALL_TABLE Table, UINT64 SyscallEntry)
+{
+    UINT64 JumpTargets[SYSCALL_TABLE_MAXIMUM_JUMP_TARGETS];
+    UINT32 NumberOfJumpTargets = 0;
+
+    Table->IsLocated     = FALSE;
+    Table->NumberOfReads = 0;
+
+    //
+    // KiSystemCall64 loads the tables itself
+    //
+    if (SyscallTableScan(Table, SyscallEntry, JumpTargets, &NumberOfJumpTargets) &&
+        SyscallTableReadDescriptor(Table))
+    {
+        Table->IsLocated = TRUE;
+        return TRUE;
+    }
+
+    //
+    // KiSystemCall64Shadow jumps to KiSystemServiceUser, some of the 0xe9
+    // bytes are not jumps, they're skipped as their targets are either not
+    // readable or don't load the tables
+    //
+    for (UINT32 i = 0; i < NumberOfJumpTargets; i++)
+    {
+        if (SyscallTableScan(Table, JumpTargets[i], NULL, NULL) &&
+            SyscallTableReadDescriptor(Table))
+        {
+            Table->IsLocated = TRUE;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Resolve the target (the Nt* routine) of a system-call
+ *
+ * @param Table The located service table
+ * @param ServiceNumber The system-call number (eax)
+ * @param Target
+ * @param NumberOfStackArguments Can be NULL
+ *
+ * @return BOOLEAN FALSE if the service is not in the service table of the kernel
+ */
+BOOLEAN
+SyscallTableResolveService(PSYSCALL_TABLE Table,
+                           UINT32         ServiceNumber,
+                           UINT64 *       Target,
+                           UINT32 *       NumberOfStackArguments)
+{
+    INT32 Entry;
+
+    if (!Table->IsLocated)
+    {
+        return FALSE;
+    }
+
+    //
+    // The win32k services (and invalid numbers) are not in the table
+    // of the kernel
+    //
+    if (ServiceNumber > SYSCALL_TABLE_SERVICE_INDEX_MASK || ServiceNumber >= Table->NumberOfServices)
+    {
+        return FALSE;
+    }
+
+    if (!Table->Read(Table->ServiceTableBase + ServiceNumber * sizeof(INT32), &Entry, sizeof(INT32), Table->Context))
+    {
+        return FALSE;
+    }
+
+    Table->NumberOfReads++;
+
+    //
+    // The offset is signed, the target might be before the table
+    //
+    *Target = Table->ServiceTableBase + (INT64)(Entry >> 4);
+
+    if (NumberOfStackArguments != NULL)
+    {
+        *NumberOfStackArguments = Entry & 0xf;
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file SyscallTable.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of resolving the targets of the system-calls from the service table
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum bytes that are scanned (after the system-call entry or
+ * after a jump target) for the reference to the service descriptor table
+ *
+ */
+#define SYSCALL_TABLE_MAXIMUM_SCAN_SIZE 0x800
+
+/**
+ * @brief Bytes that are read at each step of the scan
+ *
+ */
+#define SYSCALL_TABLE_SCAN_CHUNK_SIZE 0x80
+
+/**
+ * @brief Maximum jump targets (of the system-call entry) that are scanned,
+ * the entry with KVA shadowing jumps to the body of the regular entry
+ *
+ */
+#define SYSCALL_TABLE_MAXIMUM_JUMP_TARGETS 16
+
+/**
+ * @brief The service number is an index (bits 0-11) and the index of the
+ * table (bits 12-13), the second table (win32k) is only mapped in the GUI
+ * sessions
+ *
+ */
+#define SYSCALL_TABLE_SERVICE_INDEX_MASK 0xfff
+#define SYSCALL_TABLE_MAXIMUM_SERVICES   (SYSCALL_TABLE_SERVICE_INDEX_MASK + 1)
+
+/**
+ * @brief Size of the 'lea r10, [KeServiceDescriptorTable]' and
+ * 'lea r11, [KeServiceDescriptorTableShadow]' instructions
+ *
+ */
+#define SYSCALL_TABLE_LEA_SIZE     7
+#define SYSCALL_TABLE_PATTERN_SIZE (SYSCALL_TABLE_LEA_SIZE * 2)
+
+//////////////////////////////////////////////////
+//				    Callbacks                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback that reads the (kernel) memory, it returns FALSE if the
+ * memory is not accessible
+ *
+ */
+typedef BOOLEAN (*SYSCALL_TABLE_READ_CALLBACK)(UINT64 Address, PVOID Buffer, UINT32 Size, PVOID Context);
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of the service descriptor table (KSERVICE_TABLE_DESCRIPTOR)
+ *
+ */
+typedef struct _SYSCALL_TABLE_DESCRIPTOR
+{
+    UINT64 ServiceTableBase;
+    UINT64 ServiceCounterTableBase;
+    UINT64 NumberOfServices;
+    UINT64 ArgumentTableBase;
+
+} SYSCALL_TABLE_DESCRIPTOR, *PSYSCALL_TABLE_DESCRIPTOR;
+
+/**
+ * @brief The service table of the kernel
+ * @details Each entry of the service table is the offset of the target
+ * from the base of the table (shifted left by 4) and the number of the
+ * arguments that are passed on the stack (the low 4 bits)
+ *
+ */
+typedef struct _SYSCALL_TABLE
+{
+    SYSCALL_TABLE_READ_CALLBACK Read;
+    PVOID                       Context;
+
+    //
+    // Results
+    //
+    BOOLEAN IsLocated;
+    UINT64  ServiceDescriptorTable;       // KeServiceDescriptorTable
+    UINT64  ServiceDescriptorTableShadow; // KeServiceDescriptorTableShadow
+    UINT64  ServiceTableBase;             // KiServiceTable
+    UINT32  NumberOfServices;
+    UINT32  NumberOfReads;
+
+} SYSCALL_TABLE, *PSYSCALL_TABLE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+SyscallTableLocate(PSYSCALL_TABLE Table, UINT64 SyscallEntry);
+
+BOOLEAN
+SyscallTableResolveService(PSYSCALL_TABLE Table,
+                           UINT32         ServiceNumber,
+                           UINT64 *       Target,
+                           UINT32 *       NumberOfStackArguments);
@@ -0,0 +1,256 @@
+/**
+ * @file TscOffset.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Accounting of the TSC offset (hiding the time spent in vmx-root)
+ * @details The rdtsc/p instructions are not intercepted, instead, the time
+ * that is spent in vmx-root (plus the cost of the transitions) is added to the
+ * deficit of the core, and the negative of the deficit is used as the TSC offset.
+ * While the guest runs, the deficit is given back slowly (a few cycles at each
+ * vm-exit) so the TSC of the guest converges to the real TSC, and the deficit
+ * never exceeds the maximum deficit which bounds the skew between the cores.
+ * Once the maximum deficit is reached, the time of the vm-exits is leaked.
+ * The maximum deficit is limited to a few microseconds, so a thread that is
+ * moved to another core never sees the TSC go backward.
+ *
+ * The transition overhead should be under-estimated, if it's larger than the
+ * actual cost of a vm-exit and vm-entry, two reads of the TSC around a vm-exit
+ * might go backward
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Initialize (and enable) the TSC offsetting of a core
+ *
+ * @param State
+ * @param TransitionOverhead
+ * @param MaximumDeficit Zero or larger values are limited to TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT
+ * @param SamplingPeriod
+ * @param Tsc The current TSC
+ *
+ * @return VOID
+ */
+VOID
+TscOffsetInitialize(PTSC_OFFSET_STATE State,
+                    UINT64            TransitionOverhead,
+                    UINT64            MaximumDeficit,
+                    UINT64            SamplingPeriod,
+                    UINT64            Tsc)
+{
+    BOOLEAN IsRdtscExitingRequested = State->IsRdtscExitingRequested;
+
+    memset(State, 0, sizeof(TSC_OFFSET_STATE));
+
+    if (MaximumDeficit == 0 || MaximumDeficit > TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT)
+    {
+        MaximumDeficit = TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT;
+    }
+
+    State->TransitionOverhead = TransitionOverhead;
+    State->MaximumDeficit     = MaximumDeficit;
+    State->SamplingPeriod     = SamplingPeriod;
+
+    State->VmexitTsc       = Tsc;
+    State->LastVmresumeTsc = Tsc;
+
+    //
+    // The !tsc events that are already applied remain applied
+    //
+    State->IsRdtscExitingRequested = IsRdtscExitingRequested;
+    State->IsRdtscExitingArmed     = TRUE;
+
+    State->IsEnabled = TRUE;
+}
+
+/**
+ * @brief Account a vm-exit
+ * @details The guest has run since the last vm-resume, so some of the
+ * deficit is given back
+ *
+ * @param State
+ * @param Tsc The TSC at the start of the vm-exit handler
+ *
+ * @return VOID
+ */
+VOID
+TscOffsetHandleVmexit(PTSC_OFFSET_STATE State, UINT64 Tsc)
+{
+    UINT64 Repayment;
+
+    if (!State->IsEnabled)
+    {
+        return;
+    }
+
+    State->IsInVmxRoot = TRUE;
+    State->VmexitTsc   = Tsc;
+    State->NumberOfVmexits++;
+
+    Repayment = (Tsc - State->LastVmresumeTsc) >> TSC_OFFSET_REPAYMENT_SHIFT;
+
+    if (Repayment > TSC_OFFSET_MAXIMUM_REPAYMENT)
+    {
+        Repayment = TSC_OFFSET_MAXIMUM_REPAYMENT;
+    }
+
+    if (Repayment > State->Deficit)
+    {
+        Repayment = State->Deficit;
+    }
+
+    State->Deficit -= Repayment;
+    State->RepaidCycles += Repayment;
+}
+
+/**
+ * @brief Get the TSC that the guest should see at the current vm-exit
+ * @details Used for emulating rdtsc/p and reading IA32_TIME_STAMP_COUNTER,
+ * the result is never less than the previous emulated TSC
+ *
+ * @param State
+ *
+ * @return UINT64
+ */
+UINT64
+TscOffsetGetGuestTsc(PTSC_OFFSET_STATE State)
+{
+    UINT64 GuestTsc;
+    UINT64 Hidden = State->Deficit + State->TransitionOverhead;
+
+    GuestTsc = State->VmexitTsc > Hidden ? State->VmexitTsc - Hidden : 0;
+
+    if (GuestTsc <= State->LastGuestTsc)
+    {
+        GuestTsc = State->LastGuestTsc + 1;
+    }
+
+    State->LastGuestTsc = GuestTsc;
+
+    return GuestTsc;
+}
+
+/**
+ * @brief Account a vm-exit that is caused by rdtsc/p
+ * @details If sampling is enabled, the rdtsc/p exiting is disarmed until
+ * the sampling period is elapsed
+ *
+ * @param State
+ *
+ * @return VOID
+ */
+VOID
+TscOffsetHandleRdtscVmexit(PTSC_OFFSET_STATE State)
+{
+    if (!State->IsEnabled)
+    {
+        return;
+    }
+
+    State->NumberOfSampledRdtscExits++;
+
+    if (State->SamplingPeriod != 0)
+    {
+        State->IsRdtscExitingArmed = FALSE;
+        State->RearmTsc            = State->VmexitTsc + State->SamplingPeriod;
+    }
+}
+
+/**
+ * @brief Hide the time of the current vm-exit and compute the TSC offset
+ *
+ * @param State
+ * @param Tsc The TSC at the end of the vm-exit handler
+ *
+ * @return UINT64 The value of the TSC offset field
+ */
+UINT64
+TscOffsetHandleVmresume(PTSC_OFFSET_STATE State, UINT64 Tsc)
+{
+    UINT64 Hidden;
+    UINT64 Leaked = 0;
+
+    if (!State->IsEnabled)
+    {
+        return NULL64_ZERO;
+    }
+
+    Hidden = (Tsc - State->VmexitTsc) + State->TransitionOverhead;
+
+    //
+    // Limit the deficit, so the TSCs of the cores won't drift apart
+    //
+    if (State->Deficit + Hidden > State->MaximumDeficit)
+    {
+        Leaked = State->Deficit + Hidden - State->MaximumDeficit;
+
+        if (Leaked > Hidden)
+        {
+            //
+            // The maximum deficit is lowered while there was a deficit
+            //
+            State->Deficit = State->MaximumDeficit;
+            Leaked         = Hidden;
+        }
+
+        Hidden -= Leaked;
+    }
+
+    State->Deficit += Hidden;
+
+    //
+    // The guest should never see a TSC less than the previous emulated TSC
+    //
+    if (State->LastGuestTsc != 0 && Tsc - State->Deficit < State->LastGuestTsc)
+    {
+        UINT64 Deficit = Tsc > State->LastGuestTsc ? Tsc - State->LastGuestTsc : 0;
+        UINT64 Excess  = State->Deficit - Deficit;
+
+        Hidden = Excess > Hidden ? 0 : Hidden - Excess;
+        Leaked += Excess;
+
+        State->Deficit = Deficit;
+    }
+
+    State->HiddenCycles += Hidden;
+    State->LeakedCycles += Leaked;
+
+    State->LastVmresumeTsc = Tsc;
+    State->IsInVmxRoot     = FALSE;
+
+    return (UINT64)0 - State->Deficit;
+}
+
+/**
+ * @brief Check whether the rdtsc/p exiting should be set for the next vm-entry
+ * @details The rdtsc/p exiting is only needed for the !tsc events, and if
+ * sampling is enabled, only one vm-exit is taken in each sampling period
+ *
+ * @param State
+ * @param Tsc The current TSC
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TscOffsetIsRdtscExitingNeeded(PTSC_OFFSET_STATE State, UINT64 Tsc)
+{
+    if (!State->IsRdtscExitingRequested)
+    {
+        return FALSE;
+    }
+
+    if (State->SamplingPeriod == 0)
+    {
+        return TRUE;
+    }
+
+    if (!State->IsRdtscExitingArmed && Tsc >= State->RearmTsc)
+    {
+        State->IsRdtscExitingArmed = TRUE;
+    }
+
+    return State->IsRdtscExitingArmed;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file TscOffset.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the accounting of the TSC offset (hiding the time spent in vmx-root)
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The hidden cycles are given back to the guest at the rate of
+ * 1/(2^TSC_OFFSET_REPAYMENT_SHIFT) of the time that the guest runs
+ *
+ */
+#define TSC_OFFSET_REPAYMENT_SHIFT 10
+
+/**
+ * @brief The maximum cycles that are given back at each vm-exit
+ * @details The repayment is visible to the guest as a slower vm-exit, so
+ * it's kept far below the cost of a vm-exit
+ *
+ */
+#define TSC_OFFSET_MAXIMUM_REPAYMENT 0x80
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The state of the TSC offsetting of a core
+ * @details The offset that is written to the VMCS is always the negative of
+ * the deficit (the cycles that are hidden from the guest and not given back
+ * yet), the deficit is limited, so the TSCs of the cores won't drift apart
+ *
+ */
+typedef struct _TSC_OFFSET_STATE
+{
+    BOOLEAN IsEnabled;
+    BOOLEAN IsInVmxRoot;
+
+    //
+    // Options
+    //
+    UINT64 TransitionOverhead; // Cycles of a vm-exit and vm-entry that the handler can't see
+    UINT64 MaximumDeficit;     // Never more than TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT
+    UINT64 SamplingPeriod;     // Zero means that all of the rdtsc/p instructions cause vm-exits
+
+    //
+    // Accounting
+    //
+    UINT64 Deficit;
+    UINT64 VmexitTsc;
+    UINT64 LastVmresumeTsc;
+    UINT64 LastGuestTsc; // The last TSC that is emulated for the guest
+
+    //
+    // Sampling the rdtsc/p instructions
+    //
+    BOOLEAN IsRdtscExitingRequested; // Requested by the !tsc events
+    BOOLEAN IsRdtscExitingArmed;     // Not disarmed by the sampling
+    BOOLEAN IsRdtscExitingSet;       // Applied to the VMCS
+    UINT64  RearmTsc;
+
+    //
+    // Statistics
+    //
+    UINT64 NumberOfVmexits;
+    UINT64 NumberOfSampledRdtscExits;
+    UINT64 HiddenCycles;
+    UINT64 RepaidCycles;
+    UINT64 LeakedCycles; // Cycles that are not hidden because of the maximum deficit
+
+} TSC_OFFSET_STATE, *PTSC_OFFSET_STATE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+TscOffsetInitialize(PTSC_OFFSET_STATE State,
+                    UINT64            TransitionOverhead,
+                    UINT64            MaximumDeficit,
+                    UINT64            SamplingPeriod,
+                    UINT64            Tsc);
+
+VOID
+TscOffsetHandleVmexit(PTSC_OFFSET_STATE State, UINT64 Tsc);
+
+UINT64
+TscOffsetGetGuestTsc(PTSC_OFFSET_STATE State);
+
+VOID
+TscOffsetHandleRdtscVmexit(PTSC_OFFSET_STATE State);
+
+UINT64
+TscOffsetHandleVmresume(PTSC_OFFSET_STATE State, UINT64 Tsc);
+
+BOOLEAN
+TscOffsetIsRdtscExitingNeeded(PTSC_OFFSET_STATE State, UINT64 Tsc);
@@ -0,0 +1,633 @@
+/**
+ * @file TypeLayout.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The image of the precompiled type-layout database
+ * @details The layout of the structures of a module (extracted from the
+ * PDB by the symbol parser) is stored into a compact image which consists
+ * of the records of types and fields, two open-addressing hash tables and a
+ * pool of strings. The image doesn't contain pointers, so it's saved and
+ * loaded as-is, and the queries for the fields of the structures are
+ * answered by hashed lookups
+ *
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Interning table of the strings of the pool
+ *
+ */
+typedef struct _TYPE_LAYOUT_STRING_POOL
+{
+    CHAR *   Buffer;
+    UINT32   Size;
+    UINT32   Capacity;
+    UINT32 * Slots; // offset + 1
+    UINT32   NumberOfSlots;
+
+} TYPE_LAYOUT_STRING_POOL, *PTYPE_LAYOUT_STRING_POOL;
+
+/**
+ * @brief Convert an ASCII character to lower-case
+ *
+ * @param Character
+ *
+ * @return UINT8
+ */
+static UINT8
+TypeLayoutToLower(UINT8 Character)
+{
+    return (Character >= 'A' && Character <= 'Z') ? Character + ('a' - 'A') : Character;
+}
+
+/**
+ * @brief Compare two names (case-insensitive)
+ *
+ * @param Name1
+ * @param Name2
+ *
+ * @return BOOLEAN TRUE if the names are equal
+ */
+static BOOLEAN
+TypeLayoutIsNameEqual(const CHAR * Name1, const CHAR * Name2)
+{
+    while (TypeLayoutToLower((UINT8)*Name1) == TypeLayoutToLower((UINT8)*Name2))
+    {
+        if (*Name1 == '\0')
+        {
+            return TRUE;
+        }
+
+        Name1++;
+        Name2++;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Hash the name of a type or a field (case-insensitive FNV-1a)
+ * @details DbgHelp is initialized with SYMOPT_CASE_INSENSITIVE, so the
+ * lookups are case-insensitive too
+ *
+ * @param Name
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TypeLayoutHashName(const CHAR * Name, UINT32 Seed)
+{
+    UINT32 Hash = 2166136261u ^ Seed;
+
+    while (*Name != '\0')
+    {
+        Hash ^= TypeLayoutToLower((UINT8)*Name);
+        Hash *= 16777619u;
+        Name++;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Hash of a field which also depends on its owner structure
+ *
+ * @param OwnerType
+ * @param FieldName
+ *
+ * @return UINT32
+ */
+static UINT32
+TypeLayoutHashField(UINT32 OwnerType, const CHAR * FieldName)
+{
+    return TypeLayoutHashName(FieldName, (OwnerType + 1) * 0x9e3779b1);
+}
+
+/**
+ * @brief Compute the number of buckets of the hash tables (power of two)
+ *
+ * @param NumberOfEntries
+ *
+ * @return UINT32
+ */
+static UINT32
+TypeLayoutComputeNumberOfBuckets(UINT32 NumberOfEntries)
+{
+    UINT32 Buckets = 16;
+
+    //
+    // Keep the load factor below 0.5
+    //
+    while (Buckets < NumberOfEntries * 2)
+    {
+        Buckets <<= 1;
+    }
+
+    return Buckets;
+}
+
+/**
+ * @brief Add a string to the pool (each distinct string is stored once)
+ *
+ * @param Pool
+ * @param String
+ * @param Offset Offset of the string in the pool
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TypeLayoutInternString(PTYPE_LAYOUT_STRING_POOL Pool, const CHAR * String, UINT32 * Offset)
+{
+    UINT32 Mask   = Pool->NumberOfSlots - 1;
+    UINT32 Hash   = 2166136261u;
+    UINT32 Length = (UINT32)strlen(String);
+    UINT32 Slot;
+
+    //
+    // The pool is case-sensitive (FNV-1a over the exact bytes)
+    //
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Hash ^= (UINT8)String[i];
+        Hash *= 16777619u;
+    }
+
+    Slot = Hash & Mask;
+
+    while (Pool->Slots[Slot] != TYPE_LAYOUT_EMPTY_BUCKET)
+    {
+        if (strcmp(&Pool->Buffer[Pool->Slots[Slot] - 1], String) == 0)
+        {
+            *Offset = Pool->Slots[Slot] - 1;
+            return TRUE;
+        }
+
+        Slot = (Slot + 1) & Mask;
+    }
+
+    if ((UINT64)Pool->Size + Length + 1 > MAXUINT32 / 2)
+    {
+        return FALSE;
+    }
+
+    if (Pool->Size + Length + 1 > Pool->Capacity)
+    {
+        UINT32 NewCapacity = Pool->Capacity == 0 ? 0x1000 : Pool->Capacity;
+        CHAR * NewBuffer   = NULL;
+
+        while (NewCapacity < Pool->Size + Length + 1)
+        {
+            NewCapacity <<= 1;
+        }
+
+        NewBuffer = (CHAR *)realloc(Pool->Buffer, NewCapacity);
+
+        if (NewBuffer == NULL)
+        {
+            return FALSE;
+        }
+
+        Pool->Buffer   = NewBuffer;
+        Pool->Capacity = NewCapacity;
+    }
+
+    memcpy(&Pool->Buffer[Pool->Size], String, Length + 1);
+
+    *Offset           = Pool->Size;
+    Pool->Slots[Slot] = Pool->Size + 1;
+    Pool->Size += Length + 1;
+
+    return TRUE;
+}
+
+/**
+ * @brief Build a type-layout database from the structures of a module
+ * @details PDBs usually contain a lot of duplicated UDTs (one per compiland),
+ * only the first definition of each name is kept. Unnamed unions might create
+ * the same field names more than once, the lookups return the first one
+ *
+ * @param Types
+ * @param NumberOfTypes
+ * @param PdbFileSize
+ * @param PdbLastWriteTime
+ *
+ * @return PTYPE_LAYOUT_DATABASE NULL if it's not possible to build the database
+ */
+PTYPE_LAYOUT_DATABASE
+TypeLayoutBuildDatabase(const TYPE_LAYOUT_BUILD_TYPE * Types,
+                        UINT32                         NumberOfTypes,
+                        UINT64                         PdbFileSize,
+                        UINT64                         PdbLastWriteTime)
+{
+    TYPE_LAYOUT_DATABASE_HEADER Header           = {0};
+    TYPE_LAYOUT_STRING_POOL     Pool             = {0};
+    UINT32 *                    UniqueTypes      = NULL;
+    UINT32 *                    TypeBuckets      = NULL;
+    UINT32 *                    FieldBuckets     = NULL;
+    PTYPE_LAYOUT_TYPE_ENTRY     TypeEntries      = NULL;
+    PTYPE_LAYOUT_FIELD_ENTRY    FieldEntries     = NULL;
+    UINT32                      NumberOfUnique   = 0;
+    UINT64                      NumberOfFields   = 0;
+    UINT32                      NumberOfTBuckets = TypeLayoutComputeNumberOfBuckets(NumberOfTypes);
+    UINT32                      NumberOfFBuckets = 0;
+    UINT32                      FieldIndex       = 0;
+    UINT64                      ImageSize        = 0;
+    BYTE *                      Image            = NULL;
+    BYTE *                      Cursor           = NULL;
+    PTYPE_LAYOUT_DATABASE       Database         = NULL;
+
+    if (NumberOfTypes > MAXUINT32 / 4)
+    {
+        return NULL;
+    }
+
+    UniqueTypes = (UINT32 *)malloc(((size_t)NumberOfTypes + 1) * sizeof(UINT32));
+    TypeBuckets = (UINT32 *)calloc(NumberOfTBuckets, sizeof(UINT32));
+
+    if (UniqueTypes == NULL || TypeBuckets == NULL)
+    {
+        goto Cleanup;
+    }
+
+    //
+    // Remove the duplicated types, the index of each unique type is its
+    // final index so the buckets are filled in the same pass
+    //
+    for (UINT32 i = 0; i < NumberOfTypes; i++)
+    {
+        UINT32  Mask      = NumberOfTBuckets - 1;
+        UINT32  Bucket    = TypeLayoutHashName(Types[i].Name, 0) & Mask;
+        BOOLEAN Duplicate = FALSE;
+
+        while (TypeBuckets[Bucket] != TYPE_LAYOUT_EMPTY_BUCKET)
+        {
+            if (TypeLayoutIsNameEqual(Types[UniqueTypes[TypeBuckets[Bucket] - 1]].Name, Types[i].Name))
+            {
+                Duplicate = TRUE;
+                break;
+            }
+
+            Bucket = (Bucket + 1) & Mask;
+        }
+
+        if (Duplicate)
+        {
+            continue;
+        }
+
+        UniqueTypes[NumberOfUnique++] = i;
+        TypeBuckets[Bucket]           = NumberOfUnique;
+        NumberOfFields += Types[i].NumberOfFields;
+    }
+
+    if (NumberOfFields > MAXUINT32 / 4)
+    {
+        goto Cleanup;
+    }
+
+    NumberOfFBuckets = TypeLayoutComputeNumberOfBuckets((UINT32)NumberOfFields);
+
+    //
+    // Each type has a name and each field has a name and a type name
+    //
+    Pool.NumberOfSlots = TypeLayoutComputeNumberOfBuckets(NumberOfUnique + 2 * (UINT32)NumberOfFields);
+    Pool.Slots         = (UINT32 *)calloc(Pool.NumberOfSlots, sizeof(UINT32));
+    FieldBuckets       = (UINT32 *)calloc(NumberOfFBuckets, sizeof(UINT32));
+    TypeEntries        = (PTYPE_LAYOUT_TYPE_ENTRY)calloc((size_t)NumberOfUnique + 1, sizeof(TYPE_LAYOUT_TYPE_ENTRY));
+    FieldEntries       = (PTYPE_LAYOUT_FIELD_ENTRY)calloc((size_t)NumberOfFields + 1, sizeof(TYPE_LAYOUT_FIELD_ENTRY));
+
+    if (Pool.Slots == NULL || FieldBuckets == NULL || TypeEntries == NULL || FieldEntries == NULL)
+    {
+        goto Cleanup;
+    }
+
+    //
+    // Create the records of types and fields
+    //
+    for (UINT32 TypeIndex = 0; TypeIndex < NumberOfUnique; TypeIndex++)
+    {
+        const TYPE_LAYOUT_BUILD_TYPE * BuildType = &Types[UniqueTypes[TypeIndex]];
+        PTYPE_LAYOUT_TYPE_ENTRY        Type      = &TypeEntries[TypeIndex];
+
+        if (!TypeLayoutInternString(&Pool, BuildType->Name, &Type->NameOffset))
+        {
+            goto Cleanup;
+        }
+
+        Type->NameHash       = TypeLayoutHashName(BuildType->Name, 0);
+        Type->Size           = BuildType->Size;
+        Type->FirstField     = FieldIndex;
+        Type->NumberOfFields = BuildType->NumberOfFields;
+
+        for (UINT32 i = 0; i < BuildType->NumberOfFields; i++)
+        {
+            const TYPE_LAYOUT_BUILD_FIELD * BuildField = &BuildType->Fields[i];
+            PTYPE_LAYOUT_FIELD_ENTRY        Field      = &FieldEntries[FieldIndex];
+            UINT32                          Mask       = NumberOfFBuckets - 1;
+            UINT32                          Bucket;
+
+            if (!TypeLayoutInternString(&Pool, BuildField->Name, &Field->NameOffset) ||
+                !TypeLayoutInternString(&Pool, BuildField->TypeName, &Field->TypeNameOffset))
+            {
+                goto Cleanup;
+            }
+
+            Field->NameHash    = TypeLayoutHashField(TypeIndex, BuildField->Name);
+            Field->OwnerType   = TypeIndex;
+            Field->Offset      = BuildField->Offset;
+            Field->Size        = BuildField->Size;
+            Field->BitPosition = BuildField->BitPosition;
+            Field->BitLength   = BuildField->BitLength;
+            Field->Flags       = BuildField->Flags;
+
+            Bucket = Field->NameHash & Mask;
+
+            while (FieldBuckets[Bucket] != TYPE_LAYOUT_EMPTY_BUCKET)
+            {
+                Bucket = (Bucket + 1) & Mask;
+            }
+
+            FieldBuckets[Bucket] = ++FieldIndex;
+        }
+    }
+
+    if (Pool.Size == 0)
+    {
+        UINT32 EmptyOffset;
+
+        if (!TypeLayoutInternString(&Pool, "", &EmptyOffset))
+        {
+            goto Cleanup;
+        }
+    }
+
+    //
+    // Create the image
+    //
+    Header.Magic                = TYPE_LAYOUT_DATABASE_MAGIC;
+    Header.Version              = TYPE_LAYOUT_DATABASE_VERSION;
+    Header.PdbFileSize          = PdbFileSize;
+    Header.PdbLastWriteTime     = PdbLastWriteTime;
+    Header.NumberOfTypes        = NumberOfUnique;
+    Header.NumberOfFields       = (UINT32)NumberOfFields;
+    Header.NumberOfTypeBuckets  = NumberOfTBuckets;
+    Header.NumberOfFieldBuckets = NumberOfFBuckets;
+    Header.StringPoolSize       = Pool.Size;
+
+    ImageSize = sizeof(TYPE_LAYOUT_DATABASE_HEADER) +
+                (UINT64)NumberOfUnique * sizeof(TYPE_LAYOUT_TYPE_ENTRY) +
+                NumberOfFields * sizeof(TYPE_LAYOUT_FIELD_ENTRY) +
+                (UINT64)NumberOfTBuckets * sizeof(UINT32) +
+                (UINT64)NumberOfFBuckets * sizeof(UINT32) +
+                Pool.Size;
+
+    if (ImageSize > MAXUINT32)
+    {
+        goto Cleanup;
+    }
+
+    Image = (BYTE *)malloc((size_t)ImageSize);
+
+    if (Image == NULL)
+    {
+        goto Cleanup;
+    }
+
+    Cursor = Image;
+
+    memcpy(Cursor, &Header, sizeof(TYPE_LAYOUT_DATABASE_HEADER));
+    Cursor += sizeof(TYPE_LAYOUT_DATABASE_HEADER);
+
+    memcpy(Cursor, TypeEntries, NumberOfUnique * sizeof(TYPE_LAYOUT_TYPE_ENTRY));
+    Cursor += NumberOfUnique * sizeof(TYPE_LAYOUT_TYPE_ENTRY);
+
+    memcpy(Cursor, FieldEntries, (size_t)NumberOfFields * sizeof(TYPE_LAYOUT_FIELD_ENTRY));
+    Cursor += (size_t)NumberOfFields * sizeof(TYPE_LAYOUT_FIELD_ENTRY);
+
+    memcpy(Cursor, TypeBuckets, NumberOfTBuckets * sizeof(UINT32));
+    Cursor += NumberOfTBuckets * sizeof(UINT32);
+
+    memcpy(Cursor, FieldBuckets, NumberOfFBuckets * sizeof(UINT32));
+    Cursor += NumberOfFBuckets * sizeof(UINT32);
+
+    memcpy(Cursor, Pool.Buffer, Pool.Size);
+
+    Database = TypeLayoutMapImage(Image, (UINT32)ImageSize);
+
+    if (Database == NULL)
+    {
+        free(Image);
+    }
+
+Cleanup:
+
+    free(UniqueTypes);
+    free(TypeBuckets);
+    free(FieldBuckets);
+    free(TypeEntries);
+    free(FieldEntries);
+    free(Pool.Slots);
+    free(Pool.Buffer);
+
+    return Database;
+}
+
+/**
+ * @brief Fix the pointers of the database based on a serialized image
+ * @details The image is validated before using it as it might be read
+ * from a corrupted (or old) file. The image is owned by the database
+ * after a successful call
+ *
+ * @param Image
+ * @param ImageSize
+ *
+ * @return PTYPE_LAYOUT_DATABASE NULL if the image is not valid
+ */
+PTYPE_LAYOUT_DATABASE
+TypeLayoutMapImage(BYTE * Image, UINT32 ImageSize)
+{
+    PTYPE_LAYOUT_DATABASE        Database = NULL;
+    PTYPE_LAYOUT_DATABASE_HEADER Header   = (PTYPE_LAYOUT_DATABASE_HEADER)Image;
+    UINT64                       ExpectedSize;
+
+    if (ImageSize < sizeof(TYPE_LAYOUT_DATABASE_HEADER) ||
+        Header->Magic != TYPE_LAYOUT_DATABASE_MAGIC ||
+        Header->Version != TYPE_LAYOUT_DATABASE_VERSION ||
+        Header->StringPoolSize == 0)
+    {
+        return NULL;
+    }
+
+    ExpectedSize = sizeof(TYPE_LAYOUT_DATABASE_HEADER) +
+                   (UINT64)Header->NumberOfTypes * sizeof(TYPE_LAYOUT_TYPE_ENTRY) +
+                   (UINT64)Header->NumberOfFields * sizeof(TYPE_LAYOUT_FIELD_ENTRY) +
+                   (UINT64)Header->NumberOfTypeBuckets * sizeof(UINT32) +
+                   (UINT64)Header->NumberOfFieldBuckets * sizeof(UINT32) +
+                   (UINT64)Header->StringPoolSize;
+
+    if (ExpectedSize != ImageSize ||
+        (Header->NumberOfTypeBuckets & (Header->NumberOfTypeBuckets - 1)) != 0 ||
+        (Header->NumberOfFieldBuckets & (Header->NumberOfFieldBuckets - 1)) != 0 ||
+        Header->NumberOfTypeBuckets <= Header->NumberOfTypes ||
+        Header->NumberOfFieldBuckets <= Header->NumberOfFields)
+    {
+        return NULL;
+    }
+
+    Database = (PTYPE_LAYOUT_DATABASE)malloc(sizeof(TYPE_LAYOUT_DATABASE));
+
+    if (Database == NULL)
+    {
+        return NULL;
+    }
+
+    Database->Image        = Image;
+    Database->ImageSize    = ImageSize;
+    Database->Header       = Header;
+    Database->Types        = (PTYPE_LAYOUT_TYPE_ENTRY)(Image + sizeof(TYPE_LAYOUT_DATABASE_HEADER));
+    Database->Fields       = (PTYPE_LAYOUT_FIELD_ENTRY)(Database->Types + Header->NumberOfTypes);
+    Database->TypeBuckets  = (UINT32 *)(Database->Fields + Header->NumberOfFields);
+    Database->FieldBuckets = Database->TypeBuckets + Header->NumberOfTypeBuckets;
+    Database->StringPool   = (CHAR *)(Database->FieldBuckets + Header->NumberOfFieldBuckets);
+
+    //
+    // Check the references of the records
+    //
+    if (Database->StringPool[Header->StringPoolSize - 1] != '\0')
+    {
+        goto InvalidImage;
+    }
+
+    for (UINT32 i = 0; i < Header->NumberOfTypes; i++)
+    {
+        PTYPE_LAYOUT_TYPE_ENTRY Type = &Database->Types[i];
+
+        if (Type->NameOffset >= Header->StringPoolSize ||
+            (UINT64)Type->FirstField + Type->NumberOfFields > Header->NumberOfFields)
+        {
+            goto InvalidImage;
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->NumberOfFields; i++)
+    {
+        PTYPE_LAYOUT_FIELD_ENTRY Field = &Database->Fields[i];
+
+        if (Field->NameOffset >= Header->StringPoolSize ||
+            Field->TypeNameOffset >= Header->StringPoolSize ||
+            Field->OwnerType >= Header->NumberOfTypes)
+        {
+            goto InvalidImage;
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->NumberOfTypeBuckets; i++)
+    {
+        if (Database->TypeBuckets[i] > Header->NumberOfTypes)
+        {
+            goto InvalidImage;
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->NumberOfFieldBuckets; i++)
+    {
+        if (Database->FieldBuckets[i] > Header->NumberOfFields)
+        {
+            goto InvalidImage;
+        }
+    }
+
+    return Database;
+
+InvalidImage:
+
+    free(Database);
+    return NULL;
+}
+
+/**
+ * @brief Free the type-layout database
+ *
+ * @param Database
+ *
+ * @return VOID
+ */
+VOID
+TypeLayoutFreeDatabase(PTYPE_LAYOUT_DATABASE Database)
+{
+    if (Database == NULL)
+    {
+        return;
+    }
+
+    free(Database->Image);
+    free(Database);
+}
+
+/**
+ * @brief Find a structure in the type-layout database
+ *
+ * @param Database
+ * @param TypeName
+ *
+ * @return PTYPE_LAYOUT_TYPE_ENTRY NULL if not found
+ */
+PTYPE_LAYOUT_TYPE_ENTRY
+TypeLayoutLookupType(PTYPE_LAYOUT_DATABASE Database, const CHAR * TypeName)
+{
+    UINT32 Hash   = TypeLayoutHashName(TypeName, 0);
+    UINT32 Mask   = Database->Header->NumberOfTypeBuckets - 1;
+    UINT32 Bucket = Hash & Mask;
+
+    while (Database->TypeBuckets[Bucket] != TYPE_LAYOUT_EMPTY_BUCKET)
+    {
+        PTYPE_LAYOUT_TYPE_ENTRY Type = &Database->Types[Database->TypeBuckets[Bucket] - 1];
+
+        if (Type->NameHash == Hash && TypeLayoutIsNameEqual(&Database->StringPool[Type->NameOffset], TypeName))
+        {
+            return Type;
+        }
+
+        Bucket = (Bucket + 1) & Mask;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a field of a structure in the type-layout database
+ *
+ * @param Database
+ * @param Type
+ * @param FieldName
+ *
+ * @return PTYPE_LAYOUT_FIELD_ENTRY NULL if not found
+ */
+PTYPE_LAYOUT_FIELD_ENTRY
+TypeLayoutLookupField(PTYPE_LAYOUT_DATABASE Database, PTYPE_LAYOUT_TYPE_ENTRY Type, const CHAR * FieldName)
+{
+    UINT32 TypeIndex = (UINT32)(Type - Database->Types);
+    UINT32 Hash      = TypeLayoutHashField(TypeIndex, FieldName);
+    UINT32 Mask      = Database->Header->NumberOfFieldBuckets - 1;
+    UINT32 Bucket    = Hash & Mask;
+
+    while (Database->FieldBuckets[Bucket] != TYPE_LAYOUT_EMPTY_BUCKET)
+    {
+        PTYPE_LAYOUT_FIELD_ENTRY Field = &Database->Fields[Database->FieldBuckets[Bucket] - 1];
+
+        if (Field->NameHash == Hash && Field->OwnerType == TypeIndex &&
+            TypeLayoutIsNameEqual(&Database->StringPool[Field->NameOffset], FieldName))
+        {
+            return Field;
+        }
+
+        Bucket = (Bucket + 1) & Mask;
+    }
+
+    return NULL;
+}
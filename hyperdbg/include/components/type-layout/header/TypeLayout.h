@@ -0,0 +1,173 @@
+/**
+ * @file TypeLayout.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the image of the precompiled type-layout database
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Magic of the type-layout database files ('HTLD')
+ *
+ */
+#define TYPE_LAYOUT_DATABASE_MAGIC 0x444c5448
+
+/**
+ * @brief Version of the type-layout database format, increase it
+ * whenever the layout of the records is changed
+ *
+ */
+#define TYPE_LAYOUT_DATABASE_VERSION 1
+
+/**
+ * @brief Empty slot of the hash tables
+ *
+ */
+#define TYPE_LAYOUT_EMPTY_BUCKET 0
+
+//
+// Flags of the fields
+//
+#define TYPE_LAYOUT_FIELD_FLAG_POINTER  0x1
+#define TYPE_LAYOUT_FIELD_FLAG_BITFIELD 0x2
+#define TYPE_LAYOUT_FIELD_FLAG_ARRAY    0x4
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Header of the type-layout database
+ * @details The file (and the in-memory image) is laid out as follows:
+ *
+ *      TYPE_LAYOUT_DATABASE_HEADER
+ *      TYPE_LAYOUT_TYPE_ENTRY  [NumberOfTypes]
+ *      TYPE_LAYOUT_FIELD_ENTRY [NumberOfFields]
+ *      UINT32                  [NumberOfTypeBuckets]  (type index + 1)
+ *      UINT32                  [NumberOfFieldBuckets] (field index + 1)
+ *      CHAR                    [StringPoolSize]
+ *
+ */
+typedef struct _TYPE_LAYOUT_DATABASE_HEADER
+{
+    UINT32 Magic;
+    UINT32 Version;
+    UINT64 PdbFileSize;
+    UINT64 PdbLastWriteTime;
+    UINT32 NumberOfTypes;
+    UINT32 NumberOfFields;
+    UINT32 NumberOfTypeBuckets;
+    UINT32 NumberOfFieldBuckets;
+    UINT32 StringPoolSize;
+    UINT32 Reserved;
+
+} TYPE_LAYOUT_DATABASE_HEADER, *PTYPE_LAYOUT_DATABASE_HEADER;
+
+/**
+ * @brief A structure (UDT) in the type-layout database
+ *
+ */
+typedef struct _TYPE_LAYOUT_TYPE_ENTRY
+{
+    UINT32 NameOffset;
+    UINT32 NameHash;
+    UINT32 Size;
+    UINT32 FirstField;
+    UINT32 NumberOfFields;
+
+} TYPE_LAYOUT_TYPE_ENTRY, *PTYPE_LAYOUT_TYPE_ENTRY;
+
+/**
+ * @brief A field of a structure in the type-layout database
+ *
+ */
+typedef struct _TYPE_LAYOUT_FIELD_ENTRY
+{
+    UINT32 NameOffset;
+    UINT32 NameHash;
+    UINT32 TypeNameOffset;
+    UINT32 OwnerType;
+    UINT32 Offset;
+    UINT32 Size;
+    UINT16 BitPosition;
+    UINT8  BitLength;
+    UINT8  Flags;
+
+} TYPE_LAYOUT_FIELD_ENTRY, *PTYPE_LAYOUT_FIELD_ENTRY;
+
+/**
+ * @brief The loaded type-layout database of a module
+ *
+ */
+typedef struct _TYPE_LAYOUT_DATABASE
+{
+    BYTE *                       Image;
+    UINT32                       ImageSize;
+    PTYPE_LAYOUT_DATABASE_HEADER Header;
+    PTYPE_LAYOUT_TYPE_ENTRY      Types;
+    PTYPE_LAYOUT_FIELD_ENTRY     Fields;
+    UINT32 *                     TypeBuckets;
+    UINT32 *                     FieldBuckets;
+    CHAR *                       StringPool;
+
+} TYPE_LAYOUT_DATABASE, *PTYPE_LAYOUT_DATABASE;
+
+/**
+ * @brief A field of a structure that is added to a new database
+ *
+ */
+typedef struct _TYPE_LAYOUT_BUILD_FIELD
+{
+    const CHAR * Name;
+    const CHAR * TypeName;
+    UINT32       Offset;
+    UINT32       Size;
+    UINT16       BitPosition;
+    UINT8        BitLength;
+    UINT8        Flags;
+
+} TYPE_LAYOUT_BUILD_FIELD, *PTYPE_LAYOUT_BUILD_FIELD;
+
+/**
+ * @brief A structure that is added to a new database
+ *
+ */
+typedef struct _TYPE_LAYOUT_BUILD_TYPE
+{
+    const CHAR *                    Name;
+    UINT32                          Size;
+    const TYPE_LAYOUT_BUILD_FIELD * Fields;
+    UINT32                          NumberOfFields;
+
+} TYPE_LAYOUT_BUILD_TYPE, *PTYPE_LAYOUT_BUILD_TYPE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+PTYPE_LAYOUT_DATABASE
+TypeLayoutBuildDatabase(const TYPE_LAYOUT_BUILD_TYPE * Types,
+                        UINT32                         NumberOfTypes,
+                        UINT64                         PdbFileSize,
+                        UINT64                         PdbLastWriteTime);
+
+PTYPE_LAYOUT_DATABASE
+TypeLayoutMapImage(BYTE * Image, UINT32 ImageSize);
+
+VOID
+TypeLayoutFreeDatabase(PTYPE_LAYOUT_DATABASE Database);
+
+PTYPE_LAYOUT_TYPE_ENTRY
+TypeLayoutLookupType(PTYPE_LAYOUT_DATABASE Database, const CHAR * TypeName);
+
+PTYPE_LAYOUT_FIELD_ENTRY
+TypeLayoutLookupField(PTYPE_LAYOUT_DATABASE Database, PTYPE_LAYOUT_TYPE_ENTRY Type, const CHAR * FieldName);
@@ -78,3 +78,12 @@
  * @brief Activates the hyperevade project
  */
 #define ActivateHyperEvadeProject TRUE
+
+/**
+ * @brief Switch the cores between the execute view and the read view of the
+ * hidden hooks instead of restoring the hooked entries with MTF
+ * @details it's useful when the hooked pages are frequently read (e.g., by
+ * the integrity checks), but the code that both executes and reads the
+ * hooked pages causes more vm-exits
+ */
+#define UseEptpViewsForHiddenHooks FALSE
@@ -94,11 +94,136 @@
  */
 #define TEST_CASE_PARAMETER_FOR_MAIN_COMMAND_PARSER "test-command-parser"
 
+/**
+ * @brief Test case parameter for benchmarking the main command parser
+ */
+#define TEST_CASE_PARAMETER_FOR_COMMAND_PARSER_BENCHMARK "test-command-parser-benchmark"
+
+/**
+ * @brief Test case parameter for testing the binary event trace
+ */
+#define TEST_CASE_PARAMETER_FOR_EVENT_TRACE "test-event-trace"
+
+/**
+ * @brief Test case parameter for testing the encoder and decoder of the step traces
+ */
+#define TEST_CASE_PARAMETER_FOR_STEP_TRACE "test-step-trace"
+
+/**
+ * @brief Test case parameter for testing the bulk memory reads and their pipeline
+ */
+#define TEST_CASE_PARAMETER_FOR_BULK_READ "test-bulk-read"
+
+/**
+ * @brief Test case parameter for testing the binary index of the PCI ID database
+ */
+#define TEST_CASE_PARAMETER_FOR_PCI_ID_INDEX "test-pci-id-index"
+
+/**
+ * @brief Test case parameter for testing the topology-aware enumeration of the PCI devices
+ */
+#define TEST_CASE_PARAMETER_FOR_PCI_WALK "test-pci-walk"
+
+/**
+ * @brief Test case parameter for testing the cache of the halted debuggee
+ */
+#define TEST_CASE_PARAMETER_FOR_KD_CACHE "test-kd-cache"
+
+/**
+ * @brief Test case parameter for testing the TSC offsetting
+ */
+#define TEST_CASE_PARAMETER_FOR_TSC_OFFSET "test-tsc-offset"
+
+/**
+ * @brief Test case parameter for testing the resolution of the service table
+ */
+#define TEST_CASE_PARAMETER_FOR_SYSCALL_TABLE "test-syscall-table"
+
+/**
+ * @brief Test case parameter for testing the cache of the SYSCALL and SYSRET sites
+ */
+#define TEST_CASE_PARAMETER_FOR_SYSCALL_SITE_CACHE "test-syscall-site-cache"
+
+/**
+ * @brief Test case parameter for testing the sampling policies of the events
+ */
+#define TEST_CASE_PARAMETER_FOR_EVENT_SAMPLING "test-event-sampling"
+
+/**
+ * @brief Test case parameter for testing the fast-path filters of the scripts
+ */
+#define TEST_CASE_PARAMETER_FOR_SCRIPT_FILTER "test-script-filter"
+
+/**
+ * @brief Test case parameter for testing the tables of the sub-page write permissions
+ */
+#define TEST_CASE_PARAMETER_FOR_SUB_PAGE_PERMISSION "test-sub-page-permission"
+
+/**
+ * @brief Test case parameter for testing the emulator of the trapped memory accesses
+ */
+#define TEST_CASE_PARAMETER_FOR_MEMORY_ACCESS_EMULATOR "test-memory-access-emulator"
+
+/**
+ * @brief Test case parameter for the EPTP list and the views of the hidden hooks
+ */
+#define TEST_CASE_PARAMETER_FOR_EPTP_VIEW "test-eptp-view"
+
+/**
+ * @brief Test case parameter for the shared EPT hierarchy and the private regions of the cores
+ */
+#define TEST_CASE_PARAMETER_FOR_SHARED_EPT "test-shared-ept"
+
+/**
+ * @brief Test case parameter for the MTRR map and the 1GB pages of the EPT
+ */
+#define TEST_CASE_PARAMETER_FOR_MTRR_MAP "test-mtrr-map"
+
+/**
+ * @brief Test case parameter for the batches of EPT hooks
+ */
+#define TEST_CASE_PARAMETER_FOR_HOOK_BATCH "test-hook-batch"
+
+/**
+ * @brief Test case parameter for the hash of the detours of the inline EPT hooks
+ */
+#define TEST_CASE_PARAMETER_FOR_DETOUR_HASH "test-detour-hash"
+
+/**
+ * @brief Test case parameter for the histograms of the sampling profiler
+ */
+#define TEST_CASE_PARAMETER_FOR_SAMPLE_PROFILE "test-sample-profile"
+
+/**
+ * @brief Test case parameter for the decoder of Intel Processor Trace
+ */
+#define TEST_CASE_PARAMETER_FOR_PT_DECODE "test-pt-decode"
+
+/**
+ * @brief Test case parameter for the decoder of the Last Branch Records
+ */
+#define TEST_CASE_PARAMETER_FOR_LBR_DECODE "test-lbr-decode"
+
+/**
+ * @brief Test case parameter for the precompiled layouts of the structures
+ */
+#define TEST_CASE_PARAMETER_FOR_TYPE_LAYOUT "test-type-layout"
+
 /**
  * @brief Test case parameter for testing semantic script tests
  */
 #define TEST_CASE_PARAMETER_FOR_SCRIPT_SEMANTIC_TEST_CASES "test-script-semantic-test-cases"
 
+/**
+ * @brief Test case parameter for testing the symbol table synchronization
+ */
+#define TEST_CASE_PARAMETER_FOR_SYMBOL_SYNCHRONIZATION "test-symbol-synchronization"
+
+/**
+ * @brief Test case parameter for testing the bit-packed hwdbg script buffer
+ */
+#define TEST_HWDBG_BIT_PACKED_SCRIPT_BUFFER "test-hwdbg-bit-packed-script-buffer"
+
 /**
  * @brief Test cases file name
  */
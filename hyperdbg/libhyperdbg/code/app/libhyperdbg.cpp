@@ -531,7 +531,18 @@ ReadIrpBasedBuffer()
                     // Pause debugger after getting the results
                     //
                     KdReloadSymbolsInDebuggee(TRUE,
-                                              ((PDEBUGGEE_SYMBOL_REQUEST_PACKET)(OutputBuffer + sizeof(UINT32)))->ProcessId);
+                                              ((PDEBUGGEE_SYMBOL_REQUEST_PACKET)(OutputBuffer + sizeof(UINT32)))->ProcessId,
+                                              ((PDEBUGGEE_SYMBOL_REQUEST_PACKET)(OutputBuffer + sizeof(UINT32)))->SymbolTableDigest);
+
+                    break;
+
+                case OPERATION_LOG_EVENT_TRACE_BLOCK:
+
+                    //
+                    // Append the block to the event trace file
+                    //
+                    EventTraceWriterAppendBlock(OutputBuffer + sizeof(UINT32),
+                                                ReturnedLength - sizeof(UINT32));
 
                     break;
 
@@ -444,12 +444,12 @@ ConvertStringToUInt32(string TextToConvert, PUINT32 Result)
  * @return BOOLEAN shows whether the conversion was successful or not
  */
 BOOLEAN
-ConvertTokenToUInt64(CommandToken TargetToken, PUINT64 Result)
+ConvertTokenToUInt64(const CommandToken & TargetToken, PUINT64 Result)
 {
     //
     // Extract the token type and value from the tuple
     //
-    std::string TargetTokenValue = std::get<1>(TargetToken);
+    const std::string & TargetTokenValue = std::get<1>(TargetToken);
 
     //
     // Convert the token value to 64 bit unsigned integer
@@ -464,12 +464,12 @@ ConvertTokenToUInt64(CommandToken TargetToken, PUINT64 Result)
  * @return string the string value of the token
  */
 std::string
-GetCaseSensitiveStringFromCommandToken(CommandToken TargetToken)
+GetCaseSensitiveStringFromCommandToken(const CommandToken & TargetToken)
 {
     //
     // Extract the token type and value from the tuple
     //
-    std::string TargetTokenValue = std::get<1>(TargetToken); // the first index is case sensitive
+    const std::string & TargetTokenValue = std::get<1>(TargetToken); // the first index is case sensitive
 
     return TargetTokenValue;
 }
@@ -481,12 +481,12 @@ GetCaseSensitiveStringFromCommandToken(CommandToken TargetToken)
  * @return string the string value of the token
  */
 std::string
-GetLowerStringFromCommandToken(CommandToken TargetToken)
+GetLowerStringFromCommandToken(const CommandToken & TargetToken)
 {
     //
     // Extract the token type and value from the tuple
     //
-    std::string TargetTokenValue = std::get<2>(TargetToken); // the second index is lower case
+    const std::string & TargetTokenValue = std::get<2>(TargetToken); // the second index is lower case
 
     return TargetTokenValue;
 }
@@ -500,12 +500,12 @@ GetLowerStringFromCommandToken(CommandToken TargetToken)
  * @return BOOLEAN shows whether text is equal or not
  */
 BOOLEAN
-CompareLowerCaseStrings(CommandToken TargetToken, const char * StringToCompare)
+CompareLowerCaseStrings(const CommandToken & TargetToken, const char * StringToCompare)
 {
     //
     // Extract the token type and value from the tuple
     //
-    std::string TargetTokenValue = std::get<2>(TargetToken); // the second index is lower case
+    const std::string & TargetTokenValue = std::get<2>(TargetToken); // the second index is lower case
 
     //
     // Convert the token value to 64 bit unsigned integer
@@ -521,7 +521,7 @@ CompareLowerCaseStrings(CommandToken TargetToken, const char * StringToCompare)
  * @return BOOLEAN shows whether the token is bracket string or not
  */
 BOOLEAN
-IsTokenBracketString(CommandToken TargetToken)
+IsTokenBracketString(const CommandToken & TargetToken)
 {
     //
     // Extract the token type and value from the tuple
@@ -543,12 +543,12 @@ IsTokenBracketString(CommandToken TargetToken)
  * @return BOOLEAN shows whether the conversion was successful or not
  */
 BOOLEAN
-ConvertTokenToUInt32(CommandToken TargetToken, PUINT32 Result)
+ConvertTokenToUInt32(const CommandToken & TargetToken, PUINT32 Result)
 {
     //
     // Extract the token type and value from the tuple
     //
-    std::string TargetTokenValue = std::get<1>(TargetToken);
+    const std::string & TargetTokenValue = std::get<1>(TargetToken);
 
     //
     // Convert the token value to 32 bit unsigned integer
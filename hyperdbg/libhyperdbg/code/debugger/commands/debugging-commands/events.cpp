@@ -42,7 +42,15 @@ CommandEventsHelp()
     ShowMessages("c : clear\n");
 
     ShowMessages("note : If you specify 'all' then e, d, or c will be applied to "
-                 "all of the events.\n\n");
+                 "all of the events.\n");
+    ShowMessages("note : The actions of high-frequency events can be sampled by adding "
+                 "one of these policies to the event command (N, Cycles, and Burst are hex):\n");
+    ShowMessages("\tsample every N : the first and then each Nth trigger on each core\n");
+    ShowMessages("\tsample prob P : each trigger with the probability of P (decimal, e.g., 0.01)\n");
+    ShowMessages("\tsample bucket Cycles Burst : up to Burst triggers, plus one trigger for each Cycles (TSC) elapsed, on each core\n");
+    ShowMessages("\tsample first N : the first N triggers, then the event is disabled (enabling it again resets N)\n");
+    ShowMessages("note : The last N (hex) branches of the core are shown in the output of the event by adding "
+                 "'lbr N' to the event command (the records are enabled by the '!lbr' command).\n\n");
 
     ShowMessages("\n");
     ShowMessages("\te.g : events \n");
@@ -52,6 +60,9 @@ CommandEventsHelp()
     ShowMessages("\te.g : events c all\n");
     ShowMessages("\te.g : events sc on\n");
     ShowMessages("\te.g : events sc off\n");
+    ShowMessages("\te.g : !msrread sample every 100 script { printf(\"msr: %%llx\\n\", @rcx); }\n");
+    ShowMessages("\te.g : !syscall sample bucket 1000000 10\n");
+    ShowMessages("\te.g : !exception e lbr 10\n");
 }
 
 /**
@@ -16,6 +16,7 @@
 //
 extern BOOLEAN                  g_IsSerialConnectedToRemoteDebuggee;
 extern BOOLEAN                  g_IsInstrumentingInstructions;
+extern BOOLEAN                  g_IsRunningInstruction32Bit;
 extern ACTIVE_DEBUGGING_PROCESS g_ActiveProcessDebuggingState;
 
 /**
@@ -37,11 +38,70 @@ CommandIHelp()
     ShowMessages("syntax : \ti [Count (hex)]\n");
     ShowMessages("syntax : \tir\n");
     ShowMessages("syntax : \tir [Count (hex)]\n");
+    ShowMessages("syntax : \ti [Count (hex)] trace [Register1] [Register2] ...\n");
 
     ShowMessages("\n");
     ShowMessages("\t\te.g : i\n");
     ShowMessages("\t\te.g : ir\n");
     ShowMessages("\t\te.g : ir 1f\n");
+    ShowMessages("\t\te.g : i 100000 trace\n");
+    ShowMessages("\t\te.g : i 1000 trace rax rcx\n");
+
+    ShowMessages("\n");
+    ShowMessages("with 'trace', the debuggee steps the instructions by itself and records them "
+                 "(and at most %d of the general-purpose registers) into a compressed buffer, "
+                 "the buffer is sent back and disassembled once the count is reached\n",
+                 STEP_TRACE_NUMBER_OF_REGISTERS);
+}
+
+/**
+ * @brief Perform the counted step trace and show the traced instructions
+ *
+ * @param StepCount Number of steps
+ * @param NumberOfRegisters Number of the traced registers
+ * @param RegisterIds Indexes of the traced registers in GUEST_REGS
+ *
+ * @return VOID
+ */
+VOID
+CommandIStepTrace(UINT32 StepCount, UINT8 NumberOfRegisters, const UINT8 * RegisterIds)
+{
+    STEP_TRACE_HEADER Header         = {0};
+    UINT32            RemainingSteps = StepCount;
+    vector<UINT8>     Data;
+
+    while (RemainingSteps != 0 && g_IsInstrumentingInstructions)
+    {
+        //
+        // The debuggee pauses once the count is reached, a breakpoint is
+        // hit, or its trace buffer is full
+        //
+        if (!SteppingInstrumentationStepInTrace(RemainingSteps, NumberOfRegisters, RegisterIds))
+        {
+            break;
+        }
+
+        //
+        // Receive the trace in large chunks and disassemble it here
+        //
+        if (!StepTraceReadFromDebuggee(&Header, Data) ||
+            !StepTraceShowSteps(&Header, Data, g_IsRunningInstruction32Bit))
+        {
+            break;
+        }
+
+        if (Header.StopReason != STEP_TRACE_STOP_REASON_BUFFER_FULL ||
+            Header.NumberOfSteps == 0 ||
+            Header.NumberOfSteps > RemainingSteps)
+        {
+            break;
+        }
+
+        //
+        // The buffer is full, continue the trace with the remaining steps
+        //
+        RemainingSteps -= Header.NumberOfSteps;
+    }
 }
 
 /**
@@ -55,12 +115,40 @@ CommandIHelp()
 VOID
 CommandI(vector<CommandToken> CommandTokens, string Command)
 {
-    UINT32 StepCount;
+    UINT32  StepCount;
+    BOOLEAN IsStepTrace                                 = FALSE;
+    UINT8   NumberOfRegisters                           = 0;
+    UINT8   RegisterIds[STEP_TRACE_NUMBER_OF_REGISTERS] = {0};
 
     //
     // Validate the commands
     //
-    if (CommandTokens.size() != 1 && CommandTokens.size() != 2)
+    if (CommandTokens.size() >= 3 && CompareLowerCaseStrings(CommandTokens.at(2), "trace"))
+    {
+        IsStepTrace = TRUE;
+
+        if (CommandTokens.size() - 3 > STEP_TRACE_NUMBER_OF_REGISTERS)
+        {
+            ShowMessages("err, at most %d registers can be traced\n\n", STEP_TRACE_NUMBER_OF_REGISTERS);
+            CommandIHelp();
+            return;
+        }
+
+        for (size_t i = 3; i < CommandTokens.size(); i++)
+        {
+            if (!EventTraceGetRegisterIdByName(GetLowerStringFromCommandToken(CommandTokens.at(i)).c_str(),
+                                               &RegisterIds[NumberOfRegisters]))
+            {
+                ShowMessages("err, couldn't resolve the general-purpose register '%s'\n\n",
+                             GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+                CommandIHelp();
+                return;
+            }
+
+            NumberOfRegisters++;
+        }
+    }
+    else if (CommandTokens.size() != 1 && CommandTokens.size() != 2)
     {
         ShowMessages("incorrect use of the '%s'\n\n",
                      GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
@@ -80,7 +168,7 @@ CommandI(vector<CommandToken> CommandTokens, string Command)
     //
     // Check if the command has a counter parameter
     //
-    if (CommandTokens.size() == 2)
+    if (CommandTokens.size() >= 2)
     {
         if (!ConvertTokenToUInt32(CommandTokens.at(1), &StepCount))
         {
@@ -104,39 +192,57 @@ CommandI(vector<CommandToken> CommandTokens, string Command)
         //
         g_IsInstrumentingInstructions = TRUE;
 
-        for (size_t i = 0; i < StepCount; i++)
+        if (IsStepTrace)
         {
             //
-            // For logging purpose
-            //
-            // ShowMessages("percentage : %f %% (%x)\n", 100.0 * (i /
-            //   (float)StepCount), i);
-            //
-
-            //
-            // It's stepping over serial connection in kernel debugger
+            // The steps are performed and recorded by the debuggee
             //
-            SteppingInstrumentationStepIn();
+            CommandIStepTrace(StepCount, NumberOfRegisters, RegisterIds);
 
             if (CompareLowerCaseStrings(CommandTokens.at(0), "ir"))
             {
                 //
-                // Show registers
+                // Show registers of the last step
                 //
                 HyperDbgRegisterShowAll();
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < StepCount; i++)
+            {
+                //
+                // For logging purpose
+                //
+                // ShowMessages("percentage : %f %% (%x)\n", 100.0 * (i /
+                //   (float)StepCount), i);
+                //
 
-                if (i != StepCount - 1)
+                //
+                // It's stepping over serial connection in kernel debugger
+                //
+                SteppingInstrumentationStepIn();
+
+                if (CompareLowerCaseStrings(CommandTokens.at(0), "ir"))
                 {
-                    ShowMessages("\n");
+                    //
+                    // Show registers
+                    //
+                    HyperDbgRegisterShowAll();
+
+                    if (i != StepCount - 1)
+                    {
+                        ShowMessages("\n");
+                    }
                 }
-            }
 
-            //
-            // Check if user pressed CTRL+C
-            //
-            if (!g_IsInstrumentingInstructions)
-            {
-                break;
+                //
+                // Check if user pressed CTRL+C
+                //
+                if (!g_IsInstrumentingInstructions)
+                {
+                    break;
+                }
             }
         }
 
@@ -207,7 +207,7 @@ HyperDbgReadAllRegisters(GUEST_REGS * GuestRegisters, GUEST_EXTRA_REGISTERS * Ex
     //
     if (g_IsSerialConnectedToRemoteDebuggee)
     {
-        if (!KdSendReadRegisterPacketToDebuggee(RegState, SizeOfRegState))
+        if (!KdCacheReadRegistersOrSendPacket(RegState, SizeOfRegState))
         {
             free(RegState);
             return FALSE;
@@ -276,7 +276,7 @@ HyperDbgReadTargetRegister(REGS_ENUM RegisterId, UINT64 * TargetRegister)
 
     if (g_IsSerialConnectedToRemoteDebuggee)
     {
-        if (!KdSendReadRegisterPacketToDebuggee(&RegState, sizeof(DEBUGGEE_REGISTER_READ_DESCRIPTION)))
+        if (!KdCacheReadRegistersOrSendPacket(&RegState, sizeof(DEBUGGEE_REGISTER_READ_DESCRIPTION)))
         {
             return FALSE;
         }
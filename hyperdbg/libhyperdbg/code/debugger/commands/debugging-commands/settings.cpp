@@ -19,6 +19,10 @@ extern BOOLEAN g_AutoFlush;
 extern BOOLEAN g_AddressConversion;
 extern BOOLEAN g_IsConnectedToRemoteDebuggee;
 extern UINT32  g_DisassemblerSyntax;
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+extern KD_CACHE                               g_KdCache;
+extern DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET g_KdPausePrefetchOptions;
 
 /**
  * @brief help of the settings command
@@ -47,6 +51,10 @@ CommandSettingsHelp()
     ShowMessages("\t\te.g : settings syntax intel\n");
     ShowMessages("\t\te.g : settings syntax att\n");
     ShowMessages("\t\te.g : settings syntax masm\n");
+    ShowMessages("\t\te.g : settings kdcache on\n");
+    ShowMessages("\t\te.g : settings kdcache off\n");
+    ShowMessages("\t\te.g : settings pauseprefetch 200 40\n");
+    ShowMessages("\t\te.g : settings pauseprefetch off\n");
 }
 
 /**
@@ -261,6 +269,186 @@ CommandSettingsLoadDefaultValuesFromConfigFile()
             ShowMessages("err, incorrect address conversion settings\n");
         }
     }
+
+    //
+    // Set the cache of the halted debuggee
+    //
+    if (CommandSettingsGetValueFromConfigFile("KdCache", OptionValue))
+    {
+        if (!OptionValue.compare("on"))
+        {
+            g_KdCache.IsEnabled = TRUE;
+        }
+        else if (!OptionValue.compare("off"))
+        {
+            g_KdCache.IsEnabled = FALSE;
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("err, incorrect kd cache settings\n");
+        }
+    }
+}
+
+/**
+ * @brief set the cache of the halted debuggee to enabled and disabled
+ * and query the status (and statistics) of the cache
+ *
+ * @param CommandTokens
+ * @return VOID
+ */
+VOID
+CommandSettingsKdCache(vector<CommandToken> CommandTokens)
+{
+    if (CommandTokens.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        KdCacheShowStatistics();
+    }
+    else if (CommandTokens.size() == 3)
+    {
+        //
+        // The user tries to set a value as the kdcache
+        //
+        if (CompareLowerCaseStrings(CommandTokens.at(2), "on"))
+        {
+            g_KdCache.IsEnabled = TRUE;
+            CommandSettingsSetValueFromConfigFile("KdCache", "on");
+
+            ShowMessages("set kd cache to enabled\n");
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(2), "off"))
+        {
+            //
+            // Nothing should be served from the previously cached state
+            //
+            KdCacheInvalidate(&g_KdCache);
+
+            g_KdCache.IsEnabled = FALSE;
+            CommandSettingsSetValueFromConfigFile("KdCache", "off");
+
+            ShowMessages("set kd cache to disabled\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        return;
+    }
+}
+
+/**
+ * @brief set the stack and code windows that the debuggee sends with
+ * the pause packet and query the current windows
+ *
+ * @param CommandTokens
+ * @return VOID
+ */
+VOID
+CommandSettingsPausePrefetch(vector<CommandToken> CommandTokens)
+{
+    DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET PausePrefetchOptions = {0};
+
+    if (CommandTokens.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_KdPausePrefetchOptions.PrefetchRegisters)
+        {
+            ShowMessages("pause prefetch is enabled (stack window: %x, code window: %x)\n",
+                         g_KdPausePrefetchOptions.StackWindowSize,
+                         g_KdPausePrefetchOptions.CodeWindowSize);
+        }
+        else
+        {
+            ShowMessages("pause prefetch is disabled\n");
+        }
+
+        return;
+    }
+    else if (CommandTokens.size() == 3 && CompareLowerCaseStrings(CommandTokens.at(2), "off"))
+    {
+        //
+        // All of the options are zero
+        //
+    }
+    else if (CommandTokens.size() == 4)
+    {
+        if (!ConvertTokenToUInt32(CommandTokens.at(2), &PausePrefetchOptions.StackWindowSize) ||
+            !ConvertTokenToUInt32(CommandTokens.at(3), &PausePrefetchOptions.CodeWindowSize))
+        {
+            ShowMessages("err, couldn't resolve error at '%s'\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(2)).c_str());
+            return;
+        }
+
+        PausePrefetchOptions.PrefetchRegisters = TRUE;
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        return;
+    }
+
+    //
+    // The options are applied on the debuggee
+    //
+    if (!g_IsSerialConnectedToRemoteDebuggee)
+    {
+        ShowMessages("err, pause prefetch is only available in the debugger mode\n");
+        return;
+    }
+
+    if (!KdSendPausePrefetchOptionsPacketToDebuggee(&PausePrefetchOptions))
+    {
+        ShowMessages("err, unable to send the pause prefetch options to the debuggee\n");
+        return;
+    }
+
+    if (PausePrefetchOptions.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        ShowErrorMessage(PausePrefetchOptions.KernelStatus);
+        return;
+    }
+
+    g_KdPausePrefetchOptions = PausePrefetchOptions;
+
+    if (PausePrefetchOptions.PrefetchRegisters)
+    {
+        ShowMessages("set pause prefetch to enabled (stack window: %x, code window: %x)\n",
+                     PausePrefetchOptions.StackWindowSize,
+                     PausePrefetchOptions.CodeWindowSize);
+    }
+    else
+    {
+        ShowMessages("set pause prefetch to disabled\n");
+    }
 }
 
 /**
@@ -624,6 +812,20 @@ CommandSettings(vector<CommandToken> CommandTokens, string Command)
             CommandSettingsAddressConversion(CommandTokens);
         }
     }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "kdcache"))
+    {
+        //
+        // The cache is on the debugger, so it's handled locally
+        //
+        CommandSettingsKdCache(CommandTokens);
+    }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "pauseprefetch"))
+    {
+        //
+        // Handle it locally, the options are sent to the debuggee
+        //
+        CommandSettingsPausePrefetch(CommandTokens);
+    }
     else
     {
         //
@@ -123,6 +123,222 @@ CommandTestAllFunctionalities()
         ShowMessages("err, start HyperDbg test process for testing semantic tests\n");
         return;
     }
+
+    //
+    // Test symbol table synchronization (debuggee to debugger)
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SYMBOL_SYNCHRONIZATION))
+    {
+        ShowMessages("err, start HyperDbg test process for testing symbol synchronization\n");
+        return;
+    }
+
+    //
+    // Benchmark command parser
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_COMMAND_PARSER_BENCHMARK))
+    {
+        ShowMessages("err, start HyperDbg test process for benchmarking the main command parser\n");
+        return;
+    }
+
+    //
+    // Test binary event trace
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_EVENT_TRACE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the binary event trace\n");
+        return;
+    }
+
+    //
+    // Test step trace encoder and decoder
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_STEP_TRACE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the step traces\n");
+        return;
+    }
+
+    //
+    // Test bulk memory reads
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_BULK_READ))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the bulk memory reads\n");
+        return;
+    }
+
+    //
+    // Test the index of the PCI ID database
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_PCI_ID_INDEX))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the PCI ID index\n");
+        return;
+    }
+
+    //
+    // Test the enumeration of the PCI devices
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_PCI_WALK))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the PCI walk\n");
+        return;
+    }
+
+    //
+    // Test the cache of the halted debuggee
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_KD_CACHE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the kd cache\n");
+        return;
+    }
+
+    //
+    // Test the TSC offsetting
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_TSC_OFFSET))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the TSC offsetting\n");
+        return;
+    }
+
+    //
+    // Test the resolution of the service table
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SYSCALL_TABLE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the syscall table\n");
+        return;
+    }
+
+    //
+    // Test the cache of the SYSCALL and SYSRET sites
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SYSCALL_SITE_CACHE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the syscall site cache\n");
+        return;
+    }
+
+    //
+    // Test the sampling policies of the events
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_EVENT_SAMPLING))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the event sampling\n");
+        return;
+    }
+
+    //
+    // Testing the fast-path filters of the scripts
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SCRIPT_FILTER))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the fast-path filters of the scripts\n");
+        return;
+    }
+
+    //
+    // Testing the tables of the sub-page write permissions
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SUB_PAGE_PERMISSION))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the tables of the sub-page write permissions\n");
+        return;
+    }
+
+    //
+    // Testing the emulator of the trapped memory accesses
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_MEMORY_ACCESS_EMULATOR))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the emulator of the trapped memory accesses\n");
+        return;
+    }
+
+    //
+    // Testing the EPTP list and the views of the hidden hooks
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_EPTP_VIEW))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the EPTP list and the views of the hidden hooks\n");
+        return;
+    }
+
+    //
+    // Testing the shared EPT hierarchy and the private regions of the cores
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SHARED_EPT))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the shared EPT hierarchy and the private regions of the cores\n");
+        return;
+    }
+
+    //
+    // Testing the MTRR map and the 1GB pages of the EPT
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_MTRR_MAP))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the MTRR map and the 1GB pages of the EPT\n");
+        return;
+    }
+
+    //
+    // Testing the batches of EPT hooks
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_HOOK_BATCH))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the batches of EPT hooks\n");
+        return;
+    }
+
+    //
+    // Testing the hash of the detours of the inline EPT hooks
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_DETOUR_HASH))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the hash of the detours of the inline EPT hooks\n");
+        return;
+    }
+
+    //
+    // Testing the histograms of the sampling profiler
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_SAMPLE_PROFILE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the histograms of the sampling profiler\n");
+        return;
+    }
+
+    //
+    // Testing the decoder of Intel Processor Trace
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_PT_DECODE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the decoder of Intel Processor Trace\n");
+        return;
+    }
+
+    //
+    // Testing the decoder of the Last Branch Records
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_LBR_DECODE))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the decoder of the Last Branch Records\n");
+        return;
+    }
+
+    //
+    // Testing the precompiled layouts of the structures
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_CASE_PARAMETER_FOR_TYPE_LAYOUT))
+    {
+        ShowMessages("err, start HyperDbg test process for testing the precompiled layouts of the structures\n");
+        return;
+    }
 }
 
 /**
@@ -144,6 +360,15 @@ CommandTestAllHwdbg()
         ShowMessages("err, start HyperDbg test process for testing hwdbg functionalities\n");
         return;
     }
+
+    //
+    // Test bit-packed script buffer of hwdbg
+    //
+    if (!OpenHyperDbgTestProcess(&ThreadHandle, &ProcessHandle, (CHAR *)TEST_HWDBG_BIT_PACKED_SCRIPT_BUFFER))
+    {
+        ShowMessages("err, start HyperDbg test process for testing hwdbg bit-packed script buffer\n");
+        return;
+    }
 }
 
 /**
@@ -0,0 +1,240 @@
+/**
+ * @file lbr.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief !lbr command
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+/**
+ * @brief help of the !lbr command
+ *
+ * @return VOID
+ */
+VOID
+CommandLbrHelp()
+{
+    ShowMessages("!lbr : records the last branches of the cores using the Last Branch Records.\n");
+    ShowMessages("Note : the last branches are shown by the events, using the 'lbr Count' option of the "
+                 "events or the 'lbr_snapshot(Count)' function of the scripts, in the output of the event.\n\n");
+
+    ShowMessages("syntax : \t!lbr [enable] [user] [kernel] [select Value (hex)] [core Id (hex)]\n");
+    ShowMessages("syntax : \t!lbr [disable]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !lbr\n");
+    ShowMessages("\t\te.g : !lbr enable\n");
+    ShowMessages("\t\te.g : !lbr enable user core 2\n");
+    ShowMessages("\t\te.g : !lbr enable select c4\n");
+    ShowMessages("\t\te.g : !lbr disable\n");
+    ShowMessages("\t\te.g : !syscall lbr 10\n");
+    ShowMessages("\t\te.g : !epthook nt!ExAllocatePoolWithTag script { lbr_snapshot(8); }\n");
+
+    ShowMessages("\n");
+    ShowMessages("\tuser   : the branches of the user-mode are recorded (default: both the user-mode and the kernel-mode)\n");
+    ShowMessages("\tkernel : the branches of the kernel-mode are recorded\n");
+    ShowMessages("\tselect : the value of MSR_LBR_SELECT (a set bit suppresses the branches of its kind, "
+                 "not supported on the oldest processors)\n");
+    ShowMessages("\tcore   : a core that is recorded, it can be repeated "
+                 "(default: all cores, only the first 64 cores can be chosen)\n");
+    ShowMessages("\tcount  : count of the last branches that are shown by the events (maximum: %x)\n",
+                 LBR_SNAPSHOT_MAXIMUM_RECORDS);
+}
+
+/**
+ * @brief Send Last Branch Records requests
+ *
+ * @param LbrRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandLbrSendRequest(LBR_OPERATION_PACKETS * LbrRequest)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    //
+    // Send IOCTL
+    //
+    Status = DeviceIoControl(
+        g_DeviceHandle,               // Handle to device
+        IOCTL_PERFORM_LBR_OPERATION,  // IO Control Code (IOCTL)
+        LbrRequest,                   // Input Buffer to driver.
+        SIZEOF_LBR_OPERATION_PACKETS, // Input buffer length
+        LbrRequest,                   // Output Buffer from driver.
+        SIZEOF_LBR_OPERATION_PACKETS, // Length of output buffer in bytes.
+        &ReturnedLength,              // Bytes placed in buffer.
+        NULL                          // synchronous call
+    );
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+
+        return FALSE;
+    }
+
+    return LbrRequest->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
+
+/**
+ * @brief !lbr command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandLbr(vector<CommandToken> CommandTokens, string Command)
+{
+    LBR_OPERATION_PACKETS LbrRequest   = {0};
+    BOOLEAN               IsUserMode   = FALSE;
+    BOOLEAN               IsKernelMode = FALSE;
+    UINT64                Value        = 0;
+    UINT64 *              TargetOption = NULL;
+    const char *          TargetName   = NULL;
+
+    LbrRequest.LbrOperationType = LBR_OPERATION_TYPE_QUERY;
+
+    for (size_t i = 1; i < CommandTokens.size(); i++)
+    {
+        if (TargetOption != NULL)
+        {
+            if (!ConvertTokenToUInt64(CommandTokens.at(i), TargetOption))
+            {
+                ShowMessages("err, couldn't resolve error at '%s'\n\n",
+                             GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+                CommandLbrHelp();
+                return;
+            }
+
+            if (strcmp(TargetName, "select") == 0)
+            {
+                if (Value & ~(UINT64)LBR_SELECT_MASK)
+                {
+                    ShowMessages("err, the filter should be in the mask %x\n", LBR_SELECT_MASK);
+                    return;
+                }
+
+                LbrRequest.Select |= (UINT32)Value;
+            }
+            else if (strcmp(TargetName, "core") == 0)
+            {
+                if (Value >= 64)
+                {
+                    ShowMessages("err, only the first 64 cores can be chosen\n");
+                    return;
+                }
+
+                LbrRequest.CoreMask |= 1ull << Value;
+            }
+
+            TargetOption = NULL;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "enable"))
+        {
+            LbrRequest.LbrOperationType = LBR_OPERATION_TYPE_ENABLE;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "disable"))
+        {
+            LbrRequest.LbrOperationType = LBR_OPERATION_TYPE_DISABLE;
+        }
+        else if (LbrRequest.LbrOperationType == LBR_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "user"))
+        {
+            IsUserMode = TRUE;
+        }
+        else if (LbrRequest.LbrOperationType == LBR_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "kernel"))
+        {
+            IsKernelMode = TRUE;
+        }
+        else if (LbrRequest.LbrOperationType == LBR_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "select"))
+        {
+            TargetOption = &Value;
+            TargetName   = "select";
+        }
+        else if (LbrRequest.LbrOperationType == LBR_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "core"))
+        {
+            TargetOption = &Value;
+            TargetName   = "core";
+        }
+        else
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandLbrHelp();
+            return;
+        }
+    }
+
+    if (TargetOption != NULL)
+    {
+        ShowMessages("please specify a value for the option\n\n");
+        CommandLbrHelp();
+        return;
+    }
+
+    //
+    // Only choosing one of the modes suppresses the other one
+    //
+    if (IsUserMode && !IsKernelMode)
+    {
+        LbrRequest.Select |= LBR_SELECT_SUPPRESS_KERNEL_MODE;
+    }
+    else if (IsKernelMode && !IsUserMode)
+    {
+        LbrRequest.Select |= LBR_SELECT_SUPPRESS_USER_MODE;
+    }
+
+    //
+    // The records are configured through the driver, so the last branch
+    // records are only available in the VMI mode
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        ShowMessages("err, the last branch records are only supported in the VMI mode\n");
+        return;
+    }
+
+    //
+    // Send the last branch records request
+    //
+    if (!CommandLbrSendRequest(&LbrRequest))
+    {
+        ShowErrorMessage(LbrRequest.KernelStatus);
+        return;
+    }
+
+    if (LbrRequest.LbrOperationType == LBR_OPERATION_TYPE_DISABLE || LbrRequest.NumberOfEnabledCores == 0)
+    {
+        ShowMessages("the last branch records are not enabled on any core\n");
+    }
+    else
+    {
+        ShowMessages("the last branch records are enabled on %d core(s), filter (MSR_LBR_SELECT): %x\n",
+                     LbrRequest.NumberOfEnabledCores,
+                     LbrRequest.Select);
+    }
+
+    ShowMessages("entries: %d, format: %x, filtering is %s\n",
+                 LbrRequest.NumberOfEntries,
+                 LbrRequest.Format,
+                 LbrRequest.IsSelectSupported ? "supported" : "not supported");
+}
@@ -95,19 +95,17 @@ CommandPcitree(vector<CommandToken> CommandTokens, string Command)
             ShowMessages("%-12s | %-9s | %-17s | %s \n%s\n", "DBDF", "VID:DID", "Vendor Name", "Device Name", "----------------------------------------------------------------------");
             for (UINT8 i = 0; i < (PcitreePacket.DeviceInfoListNum < DEV_MAX_NUM ? PcitreePacket.DeviceInfoListNum : DEV_MAX_NUM); i++)
             {
-                Vendor * CurrentVendor     = GetVendorById(PcitreePacket.DeviceInfoList[i].ConfigSpace.VendorId);
-                CHAR *   CurrentVendorName = (CHAR *)"N/A";
-                CHAR *   CurrentDeviceName = (CHAR *)"N/A";
+                const char * CurrentVendorName = PciIdGetVendorName(PcitreePacket.DeviceInfoList[i].ConfigSpace.VendorId);
+                const char * CurrentDeviceName = PciIdGetDeviceName(PcitreePacket.DeviceInfoList[i].ConfigSpace.VendorId, PcitreePacket.DeviceInfoList[i].ConfigSpace.DeviceId);
 
-                if (CurrentVendor != NULL)
+                if (CurrentVendorName == NULL)
                 {
-                    CurrentVendorName      = CurrentVendor->VendorName;
-                    Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcitreePacket.DeviceInfoList[i].ConfigSpace.DeviceId);
+                    CurrentVendorName = "N/A";
+                }
 
-                    if (CurrentDevice != NULL)
-                    {
-                        CurrentDeviceName = CurrentDevice->DeviceName;
-                    }
+                if (CurrentDeviceName == NULL)
+                {
+                    CurrentDeviceName = "N/A";
                 }
 
                 ShowMessages("%04x:%02x:%02x:%x | %04x:%04x | %-17.*s | %.*s\n",
@@ -123,8 +121,6 @@ CommandPcitree(vector<CommandToken> CommandTokens, string Command)
                              CurrentDeviceName
 
                 );
-
-                FreeVendor(CurrentVendor);
             }
             FreePciIdDatabase();
         }
@@ -0,0 +1,451 @@
+/**
+ * @file profile.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief !profile command
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN                                      g_IsSerialConnectedToRemoteDebuggee;
+extern std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION> g_DisassemblerSymbolMap;
+
+/**
+ * @brief Default count of the functions that are shown in the report
+ *
+ */
+#define PROFILE_DEFAULT_TOP_FUNCTIONS 0x14
+
+/**
+ * @brief help of the !profile command
+ *
+ * @return VOID
+ */
+VOID
+CommandProfileHelp()
+{
+    ShowMessages("!profile : samples the running instructions of the cores using the VMX-preemption timer and "
+                 "shows the hottest functions.\n");
+    ShowMessages("Note : the call stacks are found by scanning the top of the stack for return addresses, "
+                 "so the total percentages are approximate. Symbols should be loaded before the report.\n\n");
+
+    ShowMessages("syntax : \t!profile [start] [period Cycles (hex)] [depth Count (hex)] [core Id (hex)]\n");
+    ShowMessages("syntax : \t!profile [stop]\n");
+    ShowMessages("syntax : \t!profile [report] [top Count (hex)] [cr3 Value (hex)]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !profile\n");
+    ShowMessages("\t\te.g : !profile start\n");
+    ShowMessages("\t\te.g : !profile start period 100000 depth 2 core 0 core 1\n");
+    ShowMessages("\t\te.g : !profile stop\n");
+    ShowMessages("\t\te.g : !profile report\n");
+    ShowMessages("\t\te.g : !profile report top 40 cr3 1aa000\n");
+
+    ShowMessages("\n");
+    ShowMessages("\tperiod : TSC cycles between two samples of a core (default: %llx, minimum: %llx)\n",
+                 PROFILER_DEFAULT_PERIOD,
+                 PROFILER_MINIMUM_PERIOD);
+    ShowMessages("\tdepth  : count of the return addresses that are kept for each sample (default: %x, maximum: %x)\n",
+                 PROFILER_MAXIMUM_STACK_DEPTH,
+                 PROFILER_MAXIMUM_STACK_DEPTH);
+    ShowMessages("\tcore   : a core that is profiled, it can be repeated (default: all cores, only the first 64 cores can be chosen)\n");
+    ShowMessages("\ttop    : count of the functions that are shown (default: %x)\n", PROFILE_DEFAULT_TOP_FUNCTIONS);
+    ShowMessages("\tcr3    : only the samples of this address space are reported\n");
+}
+
+/**
+ * @brief Send sampling profiler requests
+ *
+ * @param ProfilerRequest The request which is followed by the buffer of the samples
+ * @param MaximumSamples Count of the samples that the buffer can hold
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandProfileSendRequest(PROFILER_OPERATION_PACKETS * ProfilerRequest, UINT32 MaximumSamples)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+    ULONG BufferLength = SIZEOF_PROFILER_OPERATION_PACKETS + MaximumSamples * sizeof(PROFILER_SAMPLE);
+
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    //
+    // Send IOCTL
+    //
+    Status = DeviceIoControl(
+        g_DeviceHandle,                    // Handle to device
+        IOCTL_PERFORM_PROFILER_OPERATION,  // IO Control Code (IOCTL)
+        ProfilerRequest,                   // Input Buffer to driver.
+        SIZEOF_PROFILER_OPERATION_PACKETS, // Input buffer length
+        ProfilerRequest,                   // Output Buffer from driver.
+        BufferLength,                      // Length of output buffer in bytes.
+        &ReturnedLength,                   // Bytes placed in buffer.
+        NULL                               // synchronous call
+    );
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+
+        return FALSE;
+    }
+
+    return ProfilerRequest->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
+
+/**
+ * @brief Read and merge the samples of all cores
+ *
+ * @param Cr3 Only the samples of this address space are kept (zero means all)
+ * @param Distinct The merged samples
+ * @param NumberOfMergeDrops Count of the samples that could not be merged
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandProfileReadSamples(UINT64 Cr3, std::vector<PROFILER_SAMPLE> & Distinct, UINT64 * NumberOfMergeDrops)
+{
+    SYSTEM_INFO                  SysInfo;
+    std::vector<BYTE>            Buffer(SIZEOF_PROFILER_OPERATION_PACKETS + PROFILER_MAXIMUM_SAMPLES_PER_READ * sizeof(PROFILER_SAMPLE));
+    std::vector<PROFILER_SAMPLE> Read;
+    std::vector<PROFILER_SAMPLE> Table;
+    SAMPLE_PROFILE_HISTOGRAM     Merged          = {0};
+    PROFILER_OPERATION_PACKETS * ProfilerRequest = (PROFILER_OPERATION_PACKETS *)Buffer.data();
+    PROFILER_SAMPLE *            Samples         = (PROFILER_SAMPLE *)(Buffer.data() + SIZEOF_PROFILER_OPERATION_PACKETS);
+    UINT32                       Capacity        = PROFILER_HISTOGRAM_CAPACITY;
+    UINT32                       NextSample;
+
+    GetSystemInfo(&SysInfo);
+
+    //
+    // Read the samples of each core in chunks
+    //
+    for (UINT32 Core = 0; Core < SysInfo.dwNumberOfProcessors; Core++)
+    {
+        NextSample = 0;
+
+        while (NextSample < PROFILER_HISTOGRAM_CAPACITY)
+        {
+            RtlZeroMemory(ProfilerRequest, SIZEOF_PROFILER_OPERATION_PACKETS);
+
+            ProfilerRequest->ProfilerOperationType = PROFILER_OPERATION_TYPE_READ_SAMPLES;
+            ProfilerRequest->CoreId                = Core;
+            ProfilerRequest->FirstSample           = NextSample;
+
+            if (!CommandProfileSendRequest(ProfilerRequest, PROFILER_MAXIMUM_SAMPLES_PER_READ))
+            {
+                //
+                // The cores that were not profiled have no histogram
+                //
+                if (ProfilerRequest->KernelStatus == DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS)
+                {
+                    break;
+                }
+
+                ShowErrorMessage(ProfilerRequest->KernelStatus);
+                return FALSE;
+            }
+
+            for (UINT32 i = 0; i < ProfilerRequest->NumberOfSamples; i++)
+            {
+                if (Cr3 == 0 || Samples[i].Cr3 == Cr3)
+                {
+                    Read.push_back(Samples[i]);
+                }
+            }
+
+            if (ProfilerRequest->NextSample <= NextSample)
+            {
+                break;
+            }
+
+            NextSample = ProfilerRequest->NextSample;
+        }
+    }
+
+    //
+    // The same samples of different cores are merged (the table is kept
+    // at most half full)
+    //
+    while (Capacity < Read.size() * 2)
+    {
+        Capacity *= 2;
+    }
+
+    Table.resize(Capacity);
+    SampleProfileInitialize(&Merged, Table.data(), Capacity);
+
+    for (auto & Sample : Read)
+    {
+        SampleProfileAdd(&Merged, &Sample);
+    }
+
+    *NumberOfMergeDrops = Merged.NumberOfDroppedSamples;
+
+    Distinct.resize(Merged.NumberOfDistinctSamples);
+    SampleProfileRead(&Merged, 0, Distinct.data(), (UINT32)Distinct.size(), &NextSample);
+
+    return TRUE;
+}
+
+/**
+ * @brief Show the hottest functions of the samples
+ *
+ * @param Cr3 Only the samples of this address space are reported (zero means all)
+ * @param TopFunctions Count of the functions that are shown
+ *
+ * @return VOID
+ */
+VOID
+CommandProfileReport(UINT64 Cr3, UINT32 TopFunctions)
+{
+    std::vector<PROFILER_SAMPLE>         Distinct;
+    std::vector<SAMPLE_PROFILE_SYMBOL>   Symbols;
+    std::vector<std::string>             Names;
+    std::vector<SAMPLE_PROFILE_FUNCTION> Functions;
+    UINT64                               NumberOfMergeDrops = 0;
+    UINT64                               NumberOfSamples    = 0;
+    UINT32                               NumberOfFunctions;
+
+    if (!CommandProfileReadSamples(Cr3, Distinct, &NumberOfMergeDrops))
+    {
+        return;
+    }
+
+    for (auto & Sample : Distinct)
+    {
+        NumberOfSamples += Sample.Count;
+    }
+
+    if (NumberOfSamples == 0)
+    {
+        ShowMessages("no sample is recorded\n");
+        return;
+    }
+
+    //
+    // Build the sorted functions from the loaded symbols, the size of a
+    // function never passes the next symbol
+    //
+    for (auto Iterate = g_DisassemblerSymbolMap.begin(); Iterate != g_DisassemblerSymbolMap.end(); Iterate++)
+    {
+        auto   Next = std::next(Iterate);
+        UINT64 Size = Iterate->second.ObjectSize;
+
+        if (Next != g_DisassemblerSymbolMap.end() && (Size == 0 || Iterate->first + Size > Next->first))
+        {
+            Size = Next->first - Iterate->first;
+        }
+
+        if (Size == 0)
+        {
+            continue;
+        }
+
+        Symbols.push_back({Iterate->first, Size});
+        Names.push_back(Iterate->second.ObjectName);
+    }
+
+    if (Symbols.empty())
+    {
+        ShowMessages("warning, no symbol is loaded, all of the samples are reported as unknown (use '.sym load')\n");
+    }
+
+    //
+    // The last function means the unknown addresses
+    //
+    Functions.resize(Symbols.size() + 1);
+
+    SampleProfileSymbolize(Distinct.data(),
+                           (UINT32)Distinct.size(),
+                           Symbols.data(),
+                           (UINT32)Symbols.size(),
+                           Functions.data());
+
+    NumberOfFunctions = SampleProfileSortFunctions(Functions.data(), (UINT32)Functions.size());
+
+    ShowMessages("samples: %llx, distinct samples: %llx", NumberOfSamples, (UINT64)Distinct.size());
+
+    if (NumberOfMergeDrops != 0)
+    {
+        ShowMessages(", dropped while merging: %llx", NumberOfMergeDrops);
+    }
+
+    ShowMessages("\n\n  self%%   total%%   samples   function\n");
+
+    for (UINT32 i = 0; i < NumberOfFunctions && i < TopFunctions; i++)
+    {
+        ShowMessages("%6.2f%%  %6.2f%%  %8llx   %s\n",
+                     (double)Functions[i].SelfCount * 100.0 / (double)NumberOfSamples,
+                     (double)Functions[i].TotalCount * 100.0 / (double)NumberOfSamples,
+                     Functions[i].SelfCount,
+                     Functions[i].SymbolIndex == Symbols.size() ? "<unknown>" : Names[Functions[i].SymbolIndex].c_str());
+    }
+}
+
+/**
+ * @brief !profile command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandProfile(vector<CommandToken> CommandTokens, string Command)
+{
+    PROFILER_OPERATION_PACKETS ProfilerRequest = {0};
+    BOOLEAN                    IsReport        = FALSE;
+    UINT64                     Cr3             = 0;
+    UINT64                     Value           = 0;
+    UINT32                     TopFunctions    = PROFILE_DEFAULT_TOP_FUNCTIONS;
+    UINT64 *                   TargetOption    = NULL;
+    const char *               TargetName      = NULL;
+
+    ProfilerRequest.ProfilerOperationType = PROFILER_OPERATION_TYPE_QUERY;
+    ProfilerRequest.Period                = PROFILER_DEFAULT_PERIOD;
+    ProfilerRequest.StackDepth            = PROFILER_MAXIMUM_STACK_DEPTH;
+
+    for (size_t i = 1; i < CommandTokens.size(); i++)
+    {
+        if (TargetOption != NULL)
+        {
+            if (!ConvertTokenToUInt64(CommandTokens.at(i), TargetOption))
+            {
+                ShowMessages("err, couldn't resolve error at '%s'\n\n",
+                             GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+                CommandProfileHelp();
+                return;
+            }
+
+            //
+            // Options that are not directly kept in the request
+            //
+            if (strcmp(TargetName, "depth") == 0)
+            {
+                ProfilerRequest.StackDepth = (UINT32)Value;
+            }
+            else if (strcmp(TargetName, "core") == 0)
+            {
+                if (Value >= 64)
+                {
+                    ShowMessages("err, only the first 64 cores can be chosen\n");
+                    return;
+                }
+
+                ProfilerRequest.CoreMask |= 1ull << Value;
+            }
+            else if (strcmp(TargetName, "top") == 0)
+            {
+                TopFunctions = (UINT32)Value;
+            }
+
+            TargetOption = NULL;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "start"))
+        {
+            ProfilerRequest.ProfilerOperationType = PROFILER_OPERATION_TYPE_START;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "stop"))
+        {
+            ProfilerRequest.ProfilerOperationType = PROFILER_OPERATION_TYPE_STOP;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "report"))
+        {
+            IsReport = TRUE;
+        }
+        else if (ProfilerRequest.ProfilerOperationType == PROFILER_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "period"))
+        {
+            TargetOption = &ProfilerRequest.Period;
+            TargetName   = "period";
+        }
+        else if (ProfilerRequest.ProfilerOperationType == PROFILER_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "depth"))
+        {
+            TargetOption = &Value;
+            TargetName   = "depth";
+        }
+        else if (ProfilerRequest.ProfilerOperationType == PROFILER_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "core"))
+        {
+            TargetOption = &Value;
+            TargetName   = "core";
+        }
+        else if (IsReport && CompareLowerCaseStrings(CommandTokens.at(i), "top"))
+        {
+            TargetOption = &Value;
+            TargetName   = "top";
+        }
+        else if (IsReport && CompareLowerCaseStrings(CommandTokens.at(i), "cr3"))
+        {
+            TargetOption = &Cr3;
+            TargetName   = "cr3";
+        }
+        else
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandProfileHelp();
+            return;
+        }
+    }
+
+    if (TargetOption != NULL)
+    {
+        ShowMessages("please specify a value for the option\n\n");
+        CommandProfileHelp();
+        return;
+    }
+
+    //
+    // The samples are read through the driver, so the profiler is only
+    // available in the VMI mode
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        ShowMessages("err, the profiler is only supported in the VMI mode\n");
+        return;
+    }
+
+    if (IsReport)
+    {
+        CommandProfileReport(Cr3, TopFunctions);
+        return;
+    }
+
+    //
+    // Send the profiler request
+    //
+    if (!CommandProfileSendRequest(&ProfilerRequest, 0))
+    {
+        ShowErrorMessage(ProfilerRequest.KernelStatus);
+        return;
+    }
+
+    if (ProfilerRequest.ProfilerOperationType == PROFILER_OPERATION_TYPE_STOP)
+    {
+        ShowMessages("the profiler is stopped (use '!profile report' to see the samples)\n");
+    }
+    else if (ProfilerRequest.NumberOfProfiledCores == 0)
+    {
+        ShowMessages("the profiler is not running\n");
+    }
+    else
+    {
+        ShowMessages("the profiler is running on %d core(s)\n", ProfilerRequest.NumberOfProfiledCores);
+    }
+
+    ShowMessages("taken samples: %llx, distinct samples: %x, dropped samples: %llx\n",
+                 ProfilerRequest.NumberOfTakenSamples,
+                 ProfilerRequest.NumberOfDistinctSamples,
+                 ProfilerRequest.NumberOfDroppedSamples);
+}
@@ -0,0 +1,648 @@
+/**
+ * @file pt.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief !pt command
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+/**
+ * @brief Default count of the instructions that are shown by decoding
+ *
+ */
+#define PT_DEFAULT_DECODED_INSTRUCTIONS 0x40
+
+/**
+ * @brief The context of classifying the instructions of the trace
+ *
+ */
+typedef struct _PT_CLASSIFY_CONTEXT
+{
+    UINT32                                         ProcessId;
+    unordered_map<UINT64, vector<UINT8>>           PageCache;
+    unordered_map<UINT64, vector<UINT8>>::iterator LastPage; // The page of the previous instruction
+    BOOLEAN                                        IsLastPageValid;
+
+} PT_CLASSIFY_CONTEXT, *PPT_CLASSIFY_CONTEXT;
+
+/**
+ * @brief help of the !pt command
+ *
+ * @return VOID
+ */
+VOID
+CommandPtHelp()
+{
+    ShowMessages("!pt : records the branches of the cores using Intel Processor Trace and reconstructs the "
+                 "executed instructions from the memory.\n");
+    ShowMessages("Note : the trace is decoded from the current memory, so the code should not be changed "
+                 "after it's traced. The paused tracing is started and stopped by the 'pt_start()' and "
+                 "'pt_stop()' functions of the events.\n\n");
+
+    ShowMessages("syntax : \t!pt [start] [size Bytes (hex)] [pid ProcessId (hex)] [cr3 Value (hex)] "
+                 "[range FromAddress (hex) ToAddress (hex)] [user] [kernel] [core Id (hex)] [paused]\n");
+    ShowMessages("syntax : \t!pt [stop]\n");
+    ShowMessages("syntax : \t!pt [decode] [core Id (hex)] [pid ProcessId (hex)] [count Count (hex)]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !pt\n");
+    ShowMessages("\t\te.g : !pt start user pid 1c0\n");
+    ShowMessages("\t\te.g : !pt start size 100000 kernel range fffff80212340000 fffff80212350000 core 2\n");
+    ShowMessages("\t\te.g : !pt start paused core 0\n");
+    ShowMessages("\t\te.g : !pt stop\n");
+    ShowMessages("\t\te.g : !pt decode core 2 count 100\n");
+
+    ShowMessages("\n");
+    ShowMessages("\tsize   : the buffer of each core, a power of two (default: %x, minimum: %x, maximum: %x)\n",
+                 PROCESSOR_TRACE_DEFAULT_BUFFER_SIZE,
+                 PROCESSOR_TRACE_MINIMUM_BUFFER_SIZE,
+                 PROCESSOR_TRACE_MAXIMUM_BUFFER_SIZE);
+    ShowMessages("\tpid    : only this process is traced (by starting), or the user-mode memory is read from it (by decoding)\n");
+    ShowMessages("\tcr3    : only this address space is traced\n");
+    ShowMessages("\trange  : only the instructions of this range are traced\n");
+    ShowMessages("\tuser   : the user-mode is traced (default: both the user-mode and the kernel-mode)\n");
+    ShowMessages("\tkernel : the kernel-mode is traced\n");
+    ShowMessages("\tcore   : a core that is traced (or decoded), it can be repeated by starting "
+                 "(default: all cores, only the first 64 cores can be chosen)\n");
+    ShowMessages("\tpaused : the buffers are configured, but the tracing is started by the events\n");
+    ShowMessages("\tcount  : count of the last instructions that are shown (default: %x)\n", PT_DEFAULT_DECODED_INSTRUCTIONS);
+}
+
+/**
+ * @brief Send Intel Processor Trace requests
+ *
+ * @param ProcessorTraceRequest The request which is followed by the buffer of the trace
+ * @param MaximumBytes Count of the bytes that the buffer can hold
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandPtSendRequest(PROCESSOR_TRACE_OPERATION_PACKETS * ProcessorTraceRequest, UINT32 MaximumBytes)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+    ULONG BufferLength = SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS + MaximumBytes;
+
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    //
+    // Send IOCTL
+    //
+    Status = DeviceIoControl(
+        g_DeviceHandle,                           // Handle to device
+        IOCTL_PERFORM_PROCESSOR_TRACE_OPERATION,  // IO Control Code (IOCTL)
+        ProcessorTraceRequest,                    // Input Buffer to driver.
+        SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS, // Input buffer length
+        ProcessorTraceRequest,                    // Output Buffer from driver.
+        BufferLength,                             // Length of output buffer in bytes.
+        &ReturnedLength,                          // Bytes placed in buffer.
+        NULL                                      // synchronous call
+    );
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+
+        return FALSE;
+    }
+
+    return ProcessorTraceRequest->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
+
+/**
+ * @brief Read the buffer of a core (from the oldest byte)
+ *
+ * @param CoreId
+ * @param BufferSize
+ * @param Trace
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandPtReadBuffer(UINT32 CoreId, UINT32 BufferSize, vector<UINT8> & Trace)
+{
+    vector<BYTE>                        Buffer(SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS + PROCESSOR_TRACE_MAXIMUM_READ_SIZE);
+    PROCESSOR_TRACE_OPERATION_PACKETS * ProcessorTraceRequest = (PROCESSOR_TRACE_OPERATION_PACKETS *)Buffer.data();
+
+    Trace.clear();
+
+    while (Trace.size() < BufferSize)
+    {
+        RtlZeroMemory(ProcessorTraceRequest, SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS);
+
+        ProcessorTraceRequest->ProcessorTraceOperationType = PROCESSOR_TRACE_OPERATION_TYPE_READ_BUFFER;
+        ProcessorTraceRequest->CoreId                      = CoreId;
+        ProcessorTraceRequest->Offset                      = (UINT32)Trace.size();
+
+        if (!CommandPtSendRequest(ProcessorTraceRequest, PROCESSOR_TRACE_MAXIMUM_READ_SIZE))
+        {
+            ShowErrorMessage(ProcessorTraceRequest->KernelStatus);
+            return FALSE;
+        }
+
+        if (ProcessorTraceRequest->NumberOfBytes == 0)
+        {
+            break;
+        }
+
+        Trace.insert(Trace.end(),
+                     Buffer.data() + SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS,
+                     Buffer.data() + SIZEOF_PROCESSOR_TRACE_OPERATION_PACKETS + ProcessorTraceRequest->NumberOfBytes);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the bytes of an instruction from the cached pages
+ *
+ * @param ClassifyContext
+ * @param Address
+ * @param InstructionBytes
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+CommandPtGetInstructionBytes(PPT_CLASSIFY_CONTEXT ClassifyContext, UINT64 Address, UINT8 * InstructionBytes)
+{
+    for (UINT32 i = 0; i < MAXIMUM_INSTR_SIZE; i++)
+    {
+        UINT64 PageAddress = (Address + i) & ~((UINT64)NORMAL_PAGE_SIZE - 1);
+
+        //
+        // Most of the instructions are on the page of the previous one
+        //
+        if (!ClassifyContext->IsLastPageValid || ClassifyContext->LastPage->first != PageAddress)
+        {
+            auto Page = ClassifyContext->PageCache.find(PageAddress);
+
+            if (Page == ClassifyContext->PageCache.end())
+            {
+                vector<UINT8> PageBuffer(NORMAL_PAGE_SIZE);
+                UINT32        ReturnLength = 0;
+
+                if (!HyperDbgReadMemory(PageAddress,
+                                        DEBUGGER_READ_VIRTUAL_ADDRESS,
+                                        READ_FROM_KERNEL,
+                                        ClassifyContext->ProcessId,
+                                        NORMAL_PAGE_SIZE,
+                                        FALSE,
+                                        NULL,
+                                        PageBuffer.data(),
+                                        &ReturnLength) ||
+                    ReturnLength != NORMAL_PAGE_SIZE)
+                {
+                    //
+                    // Keep an empty page to avoid reading it again
+                    //
+                    PageBuffer.clear();
+                }
+
+                Page = ClassifyContext->PageCache.emplace(PageAddress, std::move(PageBuffer)).first;
+            }
+
+            ClassifyContext->LastPage        = Page;
+            ClassifyContext->IsLastPageValid = TRUE;
+        }
+
+        if (ClassifyContext->LastPage->second.empty())
+        {
+            //
+            // The first byte is not available, the instruction is unknown
+            //
+            if (i == 0)
+            {
+                return FALSE;
+            }
+
+            //
+            // The remaining bytes are not available, the instruction
+            // might be shorter than the maximum size
+            //
+            memset(&InstructionBytes[i], 0, MAXIMUM_INSTR_SIZE - i);
+            break;
+        }
+
+        InstructionBytes[i] = ClassifyContext->LastPage->second[(Address + i) - PageAddress];
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Classify an instruction of the trace (the callback of the decoder)
+ *
+ * @param Context
+ * @param Cr3
+ * @param Is64Bit
+ * @param Instruction
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+CommandPtClassifyInstruction(PVOID Context, UINT64 Cr3, BOOLEAN Is64Bit, PPT_DECODE_INSTRUCTION Instruction)
+{
+    PPT_CLASSIFY_CONTEXT    ClassifyContext                      = (PPT_CLASSIFY_CONTEXT)Context;
+    UINT8                   InstructionBytes[MAXIMUM_INSTR_SIZE] = {0};
+    ZydisDecoder            Decoder;
+    ZydisDecodedInstruction DecodedInstruction;
+    ZydisDecodedOperand     Operands[ZYDIS_MAX_OPERAND_COUNT];
+    ZyanU64                 Target;
+
+    UNREFERENCED_PARAMETER(Cr3);
+
+    if (!CommandPtGetInstructionBytes(ClassifyContext, Instruction->Ip, InstructionBytes))
+    {
+        return FALSE;
+    }
+
+    if (Is64Bit)
+    {
+        ZydisDecoderInit(&Decoder, ZYDIS_MACHINE_MODE_LONG_64, ZYDIS_STACK_WIDTH_64);
+    }
+    else
+    {
+        ZydisDecoderInit(&Decoder, ZYDIS_MACHINE_MODE_LONG_COMPAT_32, ZYDIS_STACK_WIDTH_32);
+    }
+
+    if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(&Decoder, InstructionBytes, MAXIMUM_INSTR_SIZE, &DecodedInstruction, Operands)))
+    {
+        return FALSE;
+    }
+
+    Instruction->Length = DecodedInstruction.length;
+    Instruction->Class  = PT_DECODE_INSTRUCTION_CLASS_OTHER;
+    Instruction->Target = 0;
+
+    //
+    // The far branches (and the IRETs) always generate a TIP
+    //
+    if (DecodedInstruction.meta.branch_type == ZYDIS_BRANCH_TYPE_FAR ||
+        DecodedInstruction.mnemonic == ZYDIS_MNEMONIC_IRET ||
+        DecodedInstruction.mnemonic == ZYDIS_MNEMONIC_IRETD ||
+        DecodedInstruction.mnemonic == ZYDIS_MNEMONIC_IRETQ)
+    {
+        Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_FAR_TRANSFER;
+        return TRUE;
+    }
+
+    switch (DecodedInstruction.meta.category)
+    {
+    case ZYDIS_CATEGORY_COND_BR:
+    case ZYDIS_CATEGORY_UNCOND_BR:
+    case ZYDIS_CATEGORY_CALL:
+
+        //
+        // The relative branches have a known target, the others are
+        // followed by a TIP
+        //
+        if (Operands[0].type == ZYDIS_OPERAND_TYPE_IMMEDIATE && Operands[0].imm.is_relative &&
+            ZYAN_SUCCESS(ZydisCalcAbsoluteAddress(&DecodedInstruction, &Operands[0], Instruction->Ip, &Target)))
+        {
+            Instruction->Target = Target;
+
+            if (DecodedInstruction.meta.category == ZYDIS_CATEGORY_COND_BR)
+            {
+                Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_CONDITIONAL_BRANCH;
+            }
+            else if (DecodedInstruction.meta.category == ZYDIS_CATEGORY_CALL)
+            {
+                Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_DIRECT_CALL;
+            }
+            else
+            {
+                Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_DIRECT_JUMP;
+            }
+        }
+        else if (DecodedInstruction.meta.category == ZYDIS_CATEGORY_CALL)
+        {
+            Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_INDIRECT_CALL;
+        }
+        else
+        {
+            Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_INDIRECT_JUMP;
+        }
+
+        break;
+
+    case ZYDIS_CATEGORY_RET:
+
+        Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_RETURN;
+        break;
+
+    case ZYDIS_CATEGORY_SYSCALL:
+    case ZYDIS_CATEGORY_SYSRET:
+    case ZYDIS_CATEGORY_INTERRUPT:
+
+        Instruction->Class = PT_DECODE_INSTRUCTION_CLASS_FAR_TRANSFER;
+        break;
+
+    default:
+        break;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Decode the buffer of a core and show the last instructions
+ *
+ * @param CoreId
+ * @param BufferSize
+ * @param ProcessId The process of the user-mode memory
+ * @param Count Count of the instructions that are shown
+ *
+ * @return VOID
+ */
+VOID
+CommandPtDecode(UINT32 CoreId, UINT32 BufferSize, UINT32 ProcessId, UINT32 Count)
+{
+    vector<UINT8>         Trace;
+    PT_CLASSIFY_CONTEXT   ClassifyContext;
+    PT_DECODER            Decoder;
+    PT_DECODE_INSTRUCTION Instruction;
+    PT_DECODE_STATUS      Status;
+    UINT8                 InstructionBytes[MAXIMUM_INSTR_SIZE] = {0};
+    UINT64                NumberOfGaps                         = 0;
+    UINT64                NumberOfShown                        = 0;
+    vector<UINT64>        LastInstructions(Count); // A ring of the IPs, and the gaps (zero)
+
+    if (Count == 0 || !CommandPtReadBuffer(CoreId, BufferSize, Trace))
+    {
+        return;
+    }
+
+    ClassifyContext.ProcessId       = ProcessId;
+    ClassifyContext.IsLastPageValid = FALSE;
+
+    PtDecodeInitialize(&Decoder, Trace.data(), Trace.size(), CommandPtClassifyInstruction, &ClassifyContext);
+
+    while ((Status = PtDecodeNextInstruction(&Decoder, &Instruction)) != PT_DECODE_STATUS_END_OF_STREAM)
+    {
+        if (Status != PT_DECODE_STATUS_SUCCESS)
+        {
+            //
+            // Consecutive gaps are shown once
+            //
+            NumberOfGaps++;
+
+            if (NumberOfShown != 0 && LastInstructions[(NumberOfShown - 1) % Count] == NULL64_ZERO)
+            {
+                continue;
+            }
+        }
+
+        LastInstructions[NumberOfShown % Count] = Status == PT_DECODE_STATUS_SUCCESS ? Instruction.Ip : NULL64_ZERO;
+        NumberOfShown++;
+    }
+
+    ShowMessages("packets: %llx, instructions: %llx, gaps: %llx, overflows: %llx, desynchronizations: %llx\n\n",
+                 Decoder.NumberOfPackets,
+                 Decoder.NumberOfInstructions,
+                 NumberOfGaps,
+                 Decoder.NumberOfOverflows,
+                 Decoder.NumberOfDesynchronizations);
+
+    for (UINT64 i = NumberOfShown > Count ? NumberOfShown - Count : 0; i < NumberOfShown; i++)
+    {
+        UINT64 Ip = LastInstructions[i % Count];
+
+        if (Ip == NULL64_ZERO)
+        {
+            ShowMessages("    ... (the trace is not continuous)\n");
+        }
+        else if (CommandPtGetInstructionBytes(&ClassifyContext, Ip, InstructionBytes))
+        {
+            HyperDbgDisassembler64(InstructionBytes, Ip, MAXIMUM_INSTR_SIZE, 1, FALSE, NULL);
+        }
+        else
+        {
+            ShowMessages("%s    ??\n", SeparateTo64BitValue(Ip).c_str());
+        }
+    }
+}
+
+/**
+ * @brief !pt command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandPt(vector<CommandToken> CommandTokens, string Command)
+{
+    PROCESSOR_TRACE_OPERATION_PACKETS ProcessorTraceRequest = {0};
+    BOOLEAN                           IsDecode              = FALSE;
+    UINT64                            Value                 = 0;
+    UINT64                            CoreId                = 0;
+    UINT64                            Count                 = PT_DEFAULT_DECODED_INSTRUCTIONS;
+    UINT64 *                          TargetOption          = NULL;
+    const char *                      TargetName            = NULL;
+
+    ProcessorTraceRequest.ProcessorTraceOperationType = PROCESSOR_TRACE_OPERATION_TYPE_QUERY;
+    ProcessorTraceRequest.BufferSize                  = PROCESSOR_TRACE_DEFAULT_BUFFER_SIZE;
+
+    for (size_t i = 1; i < CommandTokens.size(); i++)
+    {
+        if (TargetOption != NULL)
+        {
+            if (!ConvertTokenToUInt64(CommandTokens.at(i), TargetOption))
+            {
+                ShowMessages("err, couldn't resolve error at '%s'\n\n",
+                             GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+                CommandPtHelp();
+                return;
+            }
+
+            //
+            // Options that are not directly kept in the request
+            //
+            if (strcmp(TargetName, "size") == 0)
+            {
+                ProcessorTraceRequest.BufferSize = (UINT32)Value;
+            }
+            else if (strcmp(TargetName, "pid") == 0)
+            {
+                ProcessorTraceRequest.ProcessId = (UINT32)Value;
+            }
+            else if (strcmp(TargetName, "core") == 0 && !IsDecode)
+            {
+                if (Value >= 64)
+                {
+                    ShowMessages("err, only the first 64 cores can be chosen\n");
+                    return;
+                }
+
+                ProcessorTraceRequest.CoreMask |= 1ull << Value;
+            }
+            else if (strcmp(TargetName, "range") == 0)
+            {
+                //
+                // The end of the range is the next token
+                //
+                TargetOption = &ProcessorTraceRequest.IpFilterEnd;
+                TargetName   = "range end";
+                continue;
+            }
+
+            TargetOption = NULL;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "start"))
+        {
+            ProcessorTraceRequest.ProcessorTraceOperationType = PROCESSOR_TRACE_OPERATION_TYPE_START;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "stop"))
+        {
+            ProcessorTraceRequest.ProcessorTraceOperationType = PROCESSOR_TRACE_OPERATION_TYPE_STOP;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "decode"))
+        {
+            IsDecode = TRUE;
+        }
+        else if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "size"))
+        {
+            TargetOption = &Value;
+            TargetName   = "size";
+        }
+        else if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "cr3"))
+        {
+            TargetOption = &ProcessorTraceRequest.Cr3;
+            TargetName   = "cr3";
+        }
+        else if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "range"))
+        {
+            TargetOption = &ProcessorTraceRequest.IpFilterStart;
+            TargetName   = "range";
+        }
+        else if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "user"))
+        {
+            ProcessorTraceRequest.PrivilegeFilter |= PROCESSOR_TRACE_FILTER_USER_MODE;
+        }
+        else if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "kernel"))
+        {
+            ProcessorTraceRequest.PrivilegeFilter |= PROCESSOR_TRACE_FILTER_KERNEL_MODE;
+        }
+        else if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "paused"))
+        {
+            ProcessorTraceRequest.IsPaused = TRUE;
+        }
+        else if ((ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START || IsDecode) &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "pid"))
+        {
+            TargetOption = &Value;
+            TargetName   = "pid";
+        }
+        else if ((ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_START || IsDecode) &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "core"))
+        {
+            TargetOption = IsDecode ? &CoreId : &Value;
+            TargetName   = "core";
+        }
+        else if (IsDecode && CompareLowerCaseStrings(CommandTokens.at(i), "count"))
+        {
+            TargetOption = &Count;
+            TargetName   = "count";
+        }
+        else
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandPtHelp();
+            return;
+        }
+    }
+
+    if (TargetOption != NULL)
+    {
+        ShowMessages("please specify a value for the option\n\n");
+        CommandPtHelp();
+        return;
+    }
+
+    //
+    // Both the user-mode and the kernel-mode are traced by default
+    //
+    if (ProcessorTraceRequest.PrivilegeFilter == 0)
+    {
+        ProcessorTraceRequest.PrivilegeFilter = PROCESSOR_TRACE_FILTER_USER_MODE | PROCESSOR_TRACE_FILTER_KERNEL_MODE;
+    }
+
+    //
+    // The trace is read through the driver, so the processor trace is only
+    // available in the VMI mode
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        ShowMessages("err, the processor trace is only supported in the VMI mode\n");
+        return;
+    }
+
+    //
+    // Send the processor trace request (the decoding needs the size of the
+    // buffers)
+    //
+    if (!CommandPtSendRequest(&ProcessorTraceRequest, 0))
+    {
+        ShowErrorMessage(ProcessorTraceRequest.KernelStatus);
+        return;
+    }
+
+    if (IsDecode)
+    {
+        if (ProcessorTraceRequest.NumberOfConfiguredCores == 0)
+        {
+            ShowMessages("err, the processor trace is not configured (use '!pt start')\n");
+            return;
+        }
+
+        CommandPtDecode((UINT32)CoreId, ProcessorTraceRequest.ConfiguredBufferSize, ProcessorTraceRequest.ProcessId, (UINT32)Count);
+        return;
+    }
+
+    if (ProcessorTraceRequest.ProcessorTraceOperationType == PROCESSOR_TRACE_OPERATION_TYPE_STOP)
+    {
+        ShowMessages("the processor trace is stopped (use '!pt decode' to see the instructions)\n");
+    }
+    else if (ProcessorTraceRequest.NumberOfTracingCores == 0)
+    {
+        ShowMessages("the processor trace is not running on any core\n");
+    }
+    else
+    {
+        ShowMessages("the processor trace is running on %d core(s)\n", ProcessorTraceRequest.NumberOfTracingCores);
+    }
+
+    ShowMessages("configured cores: %d, buffer size: %x",
+                 ProcessorTraceRequest.NumberOfConfiguredCores,
+                 ProcessorTraceRequest.ConfiguredBufferSize);
+
+    if (ProcessorTraceRequest.ConfiguredCr3 != NULL64_ZERO)
+    {
+        ShowMessages(", cr3: %llx", ProcessorTraceRequest.ConfiguredCr3);
+    }
+
+    if (ProcessorTraceRequest.TraceStatus & PROCESSOR_TRACE_STATUS_ERROR)
+    {
+        ShowMessages(", an error of the output is reported");
+    }
+
+    ShowMessages("\n");
+}
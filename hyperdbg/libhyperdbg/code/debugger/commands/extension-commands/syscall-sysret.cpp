@@ -23,6 +23,8 @@ CommandSyscallHelp()
                  "instructions (by accessing memory and checking for instructions).\n\n");
     ShowMessages("!syscall2 : monitors and hooks all execution of syscall "
                  "instructions (by emulating all #UDs).\n\n");
+    ShowMessages("!syscall3 : monitors and hooks a single system-call by putting a hidden "
+                 "breakpoint on its target in the service table (other system-calls run without vm-exits).\n\n");
 
     ShowMessages("syntax : \t!syscall [SyscallNumber (hex)] [pid ProcessId (hex)] [core CoreId (hex)] "
                  "[imm IsImmediate (yesno)] [sc EnableShortCircuiting (onoff)] [stage CallingStage (prepostall)] "
@@ -32,6 +34,9 @@ CommandSyscallHelp()
                  "[imm IsImmediate (yesno)] [sc EnableShortCircuiting (onoff)] [stage CallingStage (prepostall)] "
                  "[buffer PreAllocatedBuffer (hex)] [script { Script (string) }] [asm condition { Condition (assembly/hex) }] "
                  "[asm code { Code (assembly/hex) }] [output {OutputName (string)}]\n");
+    ShowMessages("syntax : \t!syscall3 [SyscallNumber (hex)] [pid ProcessId (hex)] [core CoreId (hex)] "
+                 "[imm IsImmediate (yesno)] [buffer PreAllocatedBuffer (hex)] [script { Script (string) }] "
+                 "[asm condition { Condition (assembly/hex) }] [asm code { Code (assembly/hex) }] [output {OutputName (string)}]\n");
 
     ShowMessages("\n");
     ShowMessages("\t\te.g : !syscall\n");
@@ -41,8 +46,15 @@ CommandSyscallHelp()
     ShowMessages("\t\te.g : !syscall 0x55 pid 400\n");
     ShowMessages("\t\te.g : !syscall 0x55 core 2 pid 400\n");
     ShowMessages("\t\te.g : !syscall2 0x55 core 2 pid 400\n");
+    ShowMessages("\t\te.g : !syscall3 0x55\n");
+    ShowMessages("\t\te.g : !syscall3 0x55 pid 400\n");
     ShowMessages("\t\te.g : !syscall script { printf(\"system-call num: %%llx, at process id: %%x\\n\", @rax, $pid); }\n");
     ShowMessages("\t\te.g : !syscall asm code { nop; nop; nop }\n");
+
+    ShowMessages("\n");
+    ShowMessages("note : !syscall3 only supports the system-calls of the kernel (not win32k) and the pre-event "
+                 "stage, it's triggered at the start of the target routine (e.g., nt!NtCreateFile) where the "
+                 "arguments are in the registers and the stack\n");
 }
 
 /**
@@ -103,7 +115,7 @@ CommandSyscallAndSysret(vector<CommandToken> CommandTokens, string Command)
     //
     Cmd = GetLowerStringFromCommandToken(CommandTokens.at(0));
 
-    if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2"))
+    if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2") || !Cmd.compare("!syscall3"))
     {
         if (!InterpretGeneralEventAndActionsFields(
                 &CommandTokens,
@@ -150,12 +162,13 @@ CommandSyscallAndSysret(vector<CommandToken> CommandTokens, string Command)
     // and we don't wanna deal with dynamic mapping of rcx (user stack)
     // in vmx-root
     //
-    if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2"))
+    if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2") || !Cmd.compare("!syscall3"))
     {
         for (auto Section : CommandTokens)
         {
             if (CompareLowerCaseStrings(Section, "!syscall") ||
                 CompareLowerCaseStrings(Section, "!syscall2") ||
+                CompareLowerCaseStrings(Section, "!syscall3") ||
                 CompareLowerCaseStrings(Section, "!sysret") ||
                 CompareLowerCaseStrings(Section, "!sysret2"))
             {
@@ -177,7 +190,7 @@ CommandSyscallAndSysret(vector<CommandToken> CommandTokens, string Command)
                     ShowMessages("unknown parameter '%s'\n\n",
                                  GetCaseSensitiveStringFromCommandToken(Section).c_str());
 
-                    if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2"))
+                    if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2") || !Cmd.compare("!syscall3"))
                     {
                         CommandSyscallHelp();
                     }
@@ -202,7 +215,7 @@ CommandSyscallAndSysret(vector<CommandToken> CommandTokens, string Command)
                 ShowMessages("unknown parameter '%s'\n\n",
                              GetCaseSensitiveStringFromCommandToken(Section).c_str());
 
-                if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2"))
+                if (!Cmd.compare("!syscall") || !Cmd.compare("!syscall2") || !Cmd.compare("!syscall3"))
                 {
                     CommandSyscallHelp();
                 }
@@ -216,6 +229,18 @@ CommandSyscallAndSysret(vector<CommandToken> CommandTokens, string Command)
             }
         }
 
+        //
+        // The !syscall3 hooks the target of a single system-call
+        //
+        if (!Cmd.compare("!syscall3") && !GetSyscallNumber)
+        {
+            ShowMessages("please specify the system-call number\n\n");
+            CommandSyscallHelp();
+
+            FreeEventsAndActionsMemory(Event, ActionBreakToDebugger, ActionCustomCode, ActionScript);
+            return;
+        }
+
         //
         // Set the target syscall
         //
@@ -223,9 +248,16 @@ CommandSyscallAndSysret(vector<CommandToken> CommandTokens, string Command)
     }
 
     //
-    // Set whether it's !syscall or !syscall2 or !sysret or !sysret2
+    // Set whether it's !syscall or !syscall2 or !syscall3 or !sysret or !sysret2
     //
-    if (!Cmd.compare("!syscall2") || !Cmd.compare("!sysret2"))
+    if (!Cmd.compare("!syscall3"))
+    {
+        //
+        // It's a !syscall3
+        //
+        Event->Options.OptionalParam2 = DEBUGGER_EVENT_SYSCALL_SERVICE_TABLE_HOOK;
+    }
+    else if (!Cmd.compare("!syscall2") || !Cmd.compare("!sysret2"))
     {
         //
         // It's a !syscall2 or !sysret2
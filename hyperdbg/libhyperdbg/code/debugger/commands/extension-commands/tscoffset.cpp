@@ -0,0 +1,202 @@
+/**
+ * @file tscoffset.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief !tscoffset command
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+
+/**
+ * @brief help of the !tscoffset command
+ *
+ * @return VOID
+ */
+VOID
+CommandTscoffsetHelp()
+{
+    ShowMessages("!tscoffset : hides the time spent in the hypervisor from the guest using TSC offsetting.\n");
+    ShowMessages("Note : rdtsc/p instructions no longer cause vm-exits (unless !tsc events are enabled), "
+                 "the hidden cycles are given back slowly and never exceed the maximum deficit.\n\n");
+
+    ShowMessages("syntax : \t!tscoffset [on|off] [overhead Cycles (hex)] [deficit Cycles (hex)] [sample Cycles (hex)]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : !tscoffset\n");
+    ShowMessages("\t\te.g : !tscoffset on\n");
+    ShowMessages("\t\te.g : !tscoffset on overhead 200 deficit 2000\n");
+    ShowMessages("\t\te.g : !tscoffset on sample 100000\n");
+    ShowMessages("\t\te.g : !tscoffset off\n");
+
+    ShowMessages("\n");
+    ShowMessages("\toverhead : cycles of a vm-exit and vm-entry that are hidden (default: %llx), it should be under-estimated\n",
+                 TSC_OFFSETTING_DEFAULT_TRANSITION_OVERHEAD);
+    ShowMessages("\tdeficit  : maximum cycles that are hidden, it bounds the skew between cores (default: %llx, at most %llx)\n",
+                 TSC_OFFSETTING_DEFAULT_MAXIMUM_DEFICIT,
+                 TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT);
+    ShowMessages("\tsample   : cycles between two rdtsc/p vm-exits of the !tsc events (default: 0, all of them)\n");
+}
+
+/**
+ * @brief Send TSC offsetting requests
+ *
+ * @param TscOffsettingRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandTscoffsetSendRequest(TSC_OFFSETTING_OPERATION_PACKETS * TscOffsettingRequest)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // Send the request over serial kernel debugger
+        //
+        if (!KdSendTscOffsettingPacketsToDebuggee(TscOffsettingRequest))
+        {
+            return FALSE;
+        }
+    }
+    else
+    {
+        AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+        //
+        // Send IOCTL
+        //
+        Status = DeviceIoControl(
+            g_DeviceHandle,                          // Handle to device
+            IOCTL_PERFORM_TSC_OFFSETTING_OPERATION,  // IO Control Code (IOCTL)
+            TscOffsettingRequest,                    // Input Buffer to driver.
+            SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS, // Input buffer length
+            TscOffsettingRequest,                    // Output Buffer from driver.
+            SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS, // Length of output buffer in bytes.
+            &ReturnedLength,                         // Bytes placed in buffer.
+            NULL                                     // synchronous call
+        );
+
+        if (!Status)
+        {
+            ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+
+            return FALSE;
+        }
+    }
+
+    return TscOffsettingRequest->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+}
+
+/**
+ * @brief !tscoffset command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandTscoffset(vector<CommandToken> CommandTokens, string Command)
+{
+    TSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest = {0};
+    UINT64 *                         TargetOption         = NULL;
+
+    TscOffsettingRequest.TscOffsettingOperationType = TSC_OFFSETTING_OPERATION_TYPE_QUERY;
+    TscOffsettingRequest.TransitionOverhead         = TSC_OFFSETTING_DEFAULT_TRANSITION_OVERHEAD;
+    TscOffsettingRequest.MaximumDeficit             = TSC_OFFSETTING_DEFAULT_MAXIMUM_DEFICIT;
+
+    for (size_t i = 1; i < CommandTokens.size(); i++)
+    {
+        if (TargetOption != NULL)
+        {
+            if (!ConvertTokenToUInt64(CommandTokens.at(i), TargetOption))
+            {
+                ShowMessages("err, couldn't resolve error at '%s'\n\n",
+                             GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+                CommandTscoffsetHelp();
+                return;
+            }
+
+            TargetOption = NULL;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "on"))
+        {
+            TscOffsettingRequest.TscOffsettingOperationType = TSC_OFFSETTING_OPERATION_TYPE_ENABLE;
+        }
+        else if (i == 1 && CompareLowerCaseStrings(CommandTokens.at(i), "off"))
+        {
+            TscOffsettingRequest.TscOffsettingOperationType = TSC_OFFSETTING_OPERATION_TYPE_DISABLE;
+        }
+        else if (TscOffsettingRequest.TscOffsettingOperationType == TSC_OFFSETTING_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "overhead"))
+        {
+            TargetOption = &TscOffsettingRequest.TransitionOverhead;
+        }
+        else if (TscOffsettingRequest.TscOffsettingOperationType == TSC_OFFSETTING_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "deficit"))
+        {
+            TargetOption = &TscOffsettingRequest.MaximumDeficit;
+        }
+        else if (TscOffsettingRequest.TscOffsettingOperationType == TSC_OFFSETTING_OPERATION_TYPE_ENABLE &&
+                 CompareLowerCaseStrings(CommandTokens.at(i), "sample"))
+        {
+            TargetOption = &TscOffsettingRequest.SamplingPeriod;
+        }
+        else
+        {
+            ShowMessages("incorrect use of the '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            CommandTscoffsetHelp();
+            return;
+        }
+    }
+
+    if (TargetOption != NULL)
+    {
+        ShowMessages("please specify a value for the option\n\n");
+        CommandTscoffsetHelp();
+        return;
+    }
+
+    //
+    // Send the TSC offsetting request
+    //
+    if (!CommandTscoffsetSendRequest(&TscOffsettingRequest))
+    {
+        ShowErrorMessage(TscOffsettingRequest.KernelStatus);
+        return;
+    }
+
+    if (TscOffsettingRequest.TscOffsettingOperationType == TSC_OFFSETTING_OPERATION_TYPE_DISABLE)
+    {
+        ShowMessages("TSC offsetting is disabled\n");
+        return;
+    }
+
+    if (TscOffsettingRequest.NumberOfEnabledCores == 0)
+    {
+        ShowMessages("TSC offsetting is not enabled\n");
+        return;
+    }
+
+    ShowMessages("TSC offsetting is enabled on %d core(s)\n", TscOffsettingRequest.NumberOfEnabledCores);
+    ShowMessages("vm-exits: %llx, sampled rdtsc/p vm-exits: %llx\n",
+                 TscOffsettingRequest.NumberOfVmexits,
+                 TscOffsettingRequest.NumberOfSampledRdtscExits);
+    ShowMessages("hidden cycles: %llx, repaid cycles: %llx, leaked cycles: %llx, maximum current deficit: %llx\n",
+                 TscOffsettingRequest.HiddenCycles,
+                 TscOffsettingRequest.RepaidCycles,
+                 TscOffsettingRequest.LeakedCycles,
+                 TscOffsettingRequest.MaximumCurrentDeficit);
+}
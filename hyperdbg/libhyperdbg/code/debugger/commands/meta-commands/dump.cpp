@@ -62,20 +62,18 @@ VOID
 CommandDump(vector<CommandToken> CommandTokens, string Command)
 {
     wstring                   Filepath;
-    UINT32                    ActualLength;
-    UINT32                    Iterator;
-    UINT32                    Pid                 = 0;
-    UINT32                    Length              = 0;
-    UINT64                    StartAddress        = 0;
-    UINT64                    EndAddress          = 0;
-    BOOLEAN                   IsFirstCommand      = TRUE;
-    BOOLEAN                   NextIsProcId        = FALSE;
-    BOOLEAN                   NextIsPath          = FALSE;
-    BOOLEAN                   IsTheFirstAddr      = FALSE;
-    BOOLEAN                   IsTheSecondAddr     = FALSE;
-    BOOLEAN                   IsDumpPathSpecified = FALSE;
-    string                    FirstCommand        = GetLowerStringFromCommandToken(CommandTokens.front());
-    DEBUGGER_READ_MEMORY_TYPE MemoryType          = DEBUGGER_READ_VIRTUAL_ADDRESS;
+    UINT64                    NumberOfInvalidPages = 0;
+    UINT32                    Pid                  = 0;
+    UINT64                    StartAddress         = 0;
+    UINT64                    EndAddress           = 0;
+    BOOLEAN                   IsFirstCommand       = TRUE;
+    BOOLEAN                   NextIsProcId         = FALSE;
+    BOOLEAN                   NextIsPath           = FALSE;
+    BOOLEAN                   IsTheFirstAddr       = FALSE;
+    BOOLEAN                   IsTheSecondAddr      = FALSE;
+    BOOLEAN                   IsDumpPathSpecified  = FALSE;
+    string                    FirstCommand         = GetLowerStringFromCommandToken(CommandTokens.front());
+    DEBUGGER_READ_MEMORY_TYPE MemoryType           = DEBUGGER_READ_VIRTUAL_ADDRESS;
 
     if (CommandTokens.size() <= 4)
     {
@@ -242,41 +240,22 @@ CommandDump(vector<CommandToken> CommandTokens, string Command)
     }
 
     //
-    // Compute the length
+    // Read the range with bulk requests (many pages per request, a few requests
+    // in flight) and save it through a buffered writer, the pages that are not
+    // available are saved as zeros instead of aborting the dump
     //
-    Length = (UINT32)(EndAddress - StartAddress);
-
-    ActualLength = NULL;
-    Iterator     = Length / PAGE_SIZE;
-
-    for (size_t i = 0; i <= Iterator; i++)
+    if (!BulkReadMemoryIntoFile(StartAddress,
+                                EndAddress - StartAddress,
+                                MemoryType,
+                                Pid,
+                                DumpFileHandle,
+                                &NumberOfInvalidPages))
     {
-        UINT64 Address = StartAddress + (i * PAGE_SIZE);
-
-        if (Length >= PAGE_SIZE)
-        {
-            ActualLength = PAGE_SIZE;
-        }
-        else
-        {
-            ActualLength = Length;
-        }
-
-        Length -= ActualLength;
-
-        if (ActualLength != 0)
-        {
-            // ShowMessages("address: 0x%llx | actual length: 0x%llx\n", Address, ActualLength);
-
-            HyperDbgShowMemoryOrDisassemble(
-                DEBUGGER_SHOW_COMMAND_DUMP,
-                Address,
-                MemoryType,
-                READ_FROM_KERNEL,
-                Pid,
-                ActualLength,
-                NULL);
-        }
+        ShowMessages("err, unable to dump the memory\n");
+    }
+    else if (NumberOfInvalidPages != 0)
+    {
+        ShowMessages("%llx page(s) were not available and saved as zeros\n", NumberOfInvalidPages);
     }
 
     //
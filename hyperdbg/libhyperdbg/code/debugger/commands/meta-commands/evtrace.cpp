@@ -0,0 +1,377 @@
+/**
+ * @file evtrace.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief .evtrace command
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+extern BOOLEAN g_BreakPrintingOutput;
+
+/**
+ * @brief Number of blocks that the kernel sent before the current
+ * event trace file is opened
+ *
+ */
+static UINT64 EventTraceNumberOfSentBlocksOnOpen = 0;
+
+/**
+ * @brief Maximum time (in milliseconds) to wait for the remaining
+ * blocks once the event trace is closed
+ *
+ */
+#define EVENT_TRACE_CLOSE_TIMEOUT 2000
+
+/**
+ * @brief Default number of records that are shown by a query
+ *
+ */
+#define EVENT_TRACE_DEFAULT_QUERY_COUNT 100
+
+/**
+ * @brief Context of showing the records of a query
+ *
+ */
+typedef struct _EVENT_TRACE_SHOW_CONTEXT
+{
+    UINT64 NumberOfShownRecords;
+    UINT64 MaximumNumberOfShownRecords;
+
+} EVENT_TRACE_SHOW_CONTEXT, *PEVENT_TRACE_SHOW_CONTEXT;
+
+/**
+ * @brief help of the .evtrace command
+ *
+ * @return VOID
+ */
+VOID
+CommandEvtraceHelp()
+{
+    ShowMessages(".evtrace : records the events that have the 'trace' option into a binary file and queries it.\n\n");
+
+    ShowMessages("syntax : \t.evtrace [open FilePath (string)]\n");
+    ShowMessages("syntax : \t.evtrace [close]\n");
+    ShowMessages("syntax : \t.evtrace [info FilePath (string)]\n");
+    ShowMessages("syntax : \t.evtrace [query FilePath (string)] [event EventId (hex)] [core CoreId (hex)] "
+                 "[from Tsc (hex)] [to Tsc (hex)] [count Count (hex)]\n");
+
+    ShowMessages("\n");
+    ShowMessages("\t\te.g : .evtrace open c:\\users\\sina\\desktop\\trace.hdt\n");
+    ShowMessages("\t\te.g : !syscall trace\n");
+    ShowMessages("\t\te.g : !epthook nt!ExAllocatePoolWithTag trace {rcx, rdx, r8}\n");
+    ShowMessages("\t\te.g : .evtrace close\n");
+    ShowMessages("\t\te.g : .evtrace info c:\\users\\sina\\desktop\\trace.hdt\n");
+    ShowMessages("\t\te.g : .evtrace query c:\\users\\sina\\desktop\\trace.hdt event 1 core 2\n");
+    ShowMessages("\t\te.g : .evtrace query c:\\users\\sina\\desktop\\trace.hdt from 2a1b6fd4c000 to 2a1b6fd5c000 count 20\n");
+}
+
+/**
+ * @brief Send a reset or flush request of the event trace to the kernel
+ *
+ * @param OperationRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandEvtraceSendRequest(PDEBUGGER_EVENT_TRACE_OPERATION_PACKET OperationRequest)
+{
+    BOOL  Status;
+    ULONG ReturnedLength;
+
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    //
+    // Send IOCTL
+    //
+    Status = DeviceIoControl(
+        g_DeviceHandle,                               // Handle to device
+        IOCTL_PERFORM_EVENT_TRACE_OPERATION,          // IO Control Code (IOCTL)
+        OperationRequest,                             // Input Buffer to driver.
+        SIZEOF_DEBUGGER_EVENT_TRACE_OPERATION_PACKET, // Input buffer length
+        OperationRequest,                             // Output Buffer from driver.
+        SIZEOF_DEBUGGER_EVENT_TRACE_OPERATION_PACKET, // Length of output buffer in bytes.
+        &ReturnedLength,                              // Bytes placed in buffer.
+        NULL                                          // synchronous call
+    );
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+        return FALSE;
+    }
+
+    if (OperationRequest->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        ShowErrorMessage(OperationRequest->KernelStatus);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Show the header of an event trace file
+ *
+ * @param FileHeader
+ *
+ * @return VOID
+ */
+VOID
+CommandEvtraceShowFileHeader(const EVENT_TRACE_FILE_HEADER * FileHeader)
+{
+    ShowMessages("blocks: %llx | records: %llx | dropped records: %llx | cores: %x | data size: %llx\n",
+                 FileHeader->NumberOfBlocks,
+                 FileHeader->NumberOfRecords,
+                 FileHeader->NumberOfDroppedRecords,
+                 FileHeader->NumberOfCores,
+                 FileHeader->DataSize);
+
+    if (FileHeader->NumberOfRecords != 0)
+    {
+        ShowMessages("tsc range: %llx - %llx\n", FileHeader->MinimumTsc, FileHeader->MaximumTsc);
+    }
+}
+
+/**
+ * @brief Show a matched record of the query
+ *
+ * @param Record
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+CommandEvtraceShowRecord(const EVENT_TRACE_RECORD * Record, PVOID Context)
+{
+    PEVENT_TRACE_SHOW_CONTEXT ShowContext = (PEVENT_TRACE_SHOW_CONTEXT)Context;
+
+    if (ShowContext->NumberOfShownRecords >= ShowContext->MaximumNumberOfShownRecords)
+    {
+        //
+        // Keep counting the matched records without showing them
+        //
+        return TRUE;
+    }
+
+    ShowContext->NumberOfShownRecords++;
+
+    ShowMessages("%016llx  core: %x  event: %llx  stage: %s  rip: %016llx  context: %llx  ",
+                 Record->Tsc,
+                 Record->Core,
+                 Record->Tag - DebuggerEventTagStartSeed,
+                 Record->Stage == VMM_CALLBACK_CALLING_STAGE_POST_EVENT_EMULATION ? "post" : "pre",
+                 Record->Rip,
+                 Record->Context);
+
+    for (UINT32 i = 0; i < EVENT_TRACE_NUMBER_OF_REGISTERS; i++)
+    {
+        ShowMessages("%s: %llx%s",
+                     EventTraceGetRegisterName(Record->RegisterIds[i]),
+                     Record->Registers[i],
+                     i + 1 == EVENT_TRACE_NUMBER_OF_REGISTERS ? "\n" : "  ");
+    }
+
+    return !g_BreakPrintingOutput;
+}
+
+/**
+ * @brief Query an event trace file
+ *
+ * @param CommandTokens
+ *
+ * @return VOID
+ */
+VOID
+CommandEvtraceQuery(vector<CommandToken> & CommandTokens)
+{
+    EVENT_TRACE_MAPPED_FILE  MappedFile  = {0};
+    EVENT_TRACE_QUERY        Query       = {0};
+    EVENT_TRACE_QUERY_RESULT Result      = {0};
+    EVENT_TRACE_SHOW_CONTEXT ShowContext = {0};
+    UINT64                   Value;
+
+    Query.MinimumTsc                        = 0;
+    Query.MaximumTsc                        = MAXUINT64;
+    ShowContext.MaximumNumberOfShownRecords = EVENT_TRACE_DEFAULT_QUERY_COUNT;
+
+    //
+    // Parse the filters (pairs of keyword and value)
+    //
+    for (size_t i = 3; i < CommandTokens.size(); i += 2)
+    {
+        if (i + 1 >= CommandTokens.size() || !ConvertTokenToUInt64(CommandTokens.at(i + 1), &Value))
+        {
+            ShowMessages("err, please specify a valid hex value for '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+            CommandEvtraceHelp();
+            return;
+        }
+
+        if (CompareLowerCaseStrings(CommandTokens.at(i), "event"))
+        {
+            Query.FilterByTag = TRUE;
+            Query.Tag         = Value + DebuggerEventTagStartSeed;
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(i), "core"))
+        {
+            Query.FilterByCore = TRUE;
+            Query.Core         = (UINT16)Value;
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(i), "from"))
+        {
+            Query.MinimumTsc = Value;
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(i), "to"))
+        {
+            Query.MaximumTsc = Value;
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(i), "count"))
+        {
+            ShowContext.MaximumNumberOfShownRecords = Value;
+        }
+        else
+        {
+            ShowMessages("err, couldn't resolve error at '%s'\n\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(i)).c_str());
+            CommandEvtraceHelp();
+            return;
+        }
+    }
+
+    if (!EventTraceMapFile(GetCaseSensitiveStringFromCommandToken(CommandTokens.at(2)), &MappedFile))
+    {
+        return;
+    }
+
+    EventTraceQuery(MappedFile.Buffer,
+                    MappedFile.Index.data(),
+                    MappedFile.Index.size(),
+                    &Query,
+                    CommandEvtraceShowRecord,
+                    &ShowContext,
+                    &Result);
+
+    ShowMessages("\nmatched records: %llx (shown: %llx) | visited records: %llx | visited blocks: %llx | skipped blocks: %llx\n",
+                 Result.NumberOfMatchedRecords,
+                 ShowContext.NumberOfShownRecords,
+                 Result.NumberOfVisitedRecords,
+                 Result.NumberOfVisitedBlocks,
+                 Result.NumberOfSkippedBlocks);
+
+    EventTraceUnmapFile(&MappedFile);
+}
+
+/**
+ * @brief .evtrace command handler
+ *
+ * @param CommandTokens
+ * @param Command
+ *
+ * @return VOID
+ */
+VOID
+CommandEvtrace(vector<CommandToken> CommandTokens, string Command)
+{
+    DEBUGGER_EVENT_TRACE_OPERATION_PACKET OperationRequest = {0};
+    EVENT_TRACE_FILE_HEADER               FileHeader       = {0};
+    EVENT_TRACE_MAPPED_FILE               MappedFile       = {0};
+    UINT64                                ExpectedBlocks;
+    UINT32                                WaitedTime = 0;
+
+    if (CommandTokens.size() < 2)
+    {
+        ShowMessages("incorrect use of the '%s'\n\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        CommandEvtraceHelp();
+        return;
+    }
+
+    if (CompareLowerCaseStrings(CommandTokens.at(1), "open") && CommandTokens.size() == 3)
+    {
+        if (g_IsSerialConnectedToRemoteDebuggee)
+        {
+            ShowMessages("err, the event trace is only supported in the VMI Mode\n");
+            return;
+        }
+
+        //
+        // Discard the records that are collected before opening the file
+        //
+        OperationRequest.Operation = DEBUGGER_EVENT_TRACE_OPERATION_RESET_BUFFERS;
+
+        if (!CommandEvtraceSendRequest(&OperationRequest))
+        {
+            return;
+        }
+
+        if (!EventTraceWriterOpen(GetCaseSensitiveStringFromCommandToken(CommandTokens.at(2))))
+        {
+            return;
+        }
+
+        EventTraceNumberOfSentBlocksOnOpen = OperationRequest.NumberOfSentBlocks;
+
+        ShowMessages("recording the traced events into : %s\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(2)).c_str());
+    }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "close") && CommandTokens.size() == 2)
+    {
+        if (!EventTraceWriterIsOpen())
+        {
+            ShowMessages("err, no event trace file is open (use '.evtrace open')\n");
+            return;
+        }
+
+        //
+        // Send the partially filled blocks of all cores
+        //
+        OperationRequest.Operation = DEBUGGER_EVENT_TRACE_OPERATION_FLUSH_BUFFERS;
+
+        if (CommandEvtraceSendRequest(&OperationRequest))
+        {
+            //
+            // Wait for the kernel messages thread to receive the remaining blocks
+            //
+            ExpectedBlocks = OperationRequest.NumberOfSentBlocks - EventTraceNumberOfSentBlocksOnOpen;
+
+            while (EventTraceWriterGetNumberOfReceivedBlocks() < ExpectedBlocks &&
+                   WaitedTime < EVENT_TRACE_CLOSE_TIMEOUT)
+            {
+                Sleep(DefaultSpeedOfReadingKernelMessages);
+                WaitedTime += DefaultSpeedOfReadingKernelMessages;
+            }
+        }
+
+        if (EventTraceWriterClose(&FileHeader))
+        {
+            CommandEvtraceShowFileHeader(&FileHeader);
+        }
+    }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "info") && CommandTokens.size() == 3)
+    {
+        if (EventTraceMapFile(GetCaseSensitiveStringFromCommandToken(CommandTokens.at(2)), &MappedFile))
+        {
+            CommandEvtraceShowFileHeader((const EVENT_TRACE_FILE_HEADER *)MappedFile.Buffer);
+            EventTraceUnmapFile(&MappedFile);
+        }
+    }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "query") && CommandTokens.size() >= 3)
+    {
+        CommandEvtraceQuery(CommandTokens);
+    }
+    else
+    {
+        ShowMessages("incorrect use of the '%s'\n\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        CommandEvtraceHelp();
+    }
+}
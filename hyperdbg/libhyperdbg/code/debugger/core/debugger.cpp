@@ -569,6 +569,120 @@ ShowErrorMessage(UINT32 Error)
                      Error);
         break;
 
+    case DEBUGGER_ERROR_INVALID_EVENT_TRACE_OPERATION:
+        ShowMessages("err, invalid operation on the event trace buffers (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_EVENT_TRACE_REGISTER:
+        ShowMessages("err, invalid register for the event trace records (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_STEP_TRACE_CHUNK:
+        ShowMessages("err, invalid chunk of the step trace buffer (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_PAUSE_PREFETCH_OPTIONS:
+        ShowMessages("err, the stack window or the code window of the pause prefetch is too large (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_TSC_OFFSETTING_PARAMETERS:
+        ShowMessages("err, invalid TSC offsetting parameters, the overhead should not be more than the maximum deficit "
+                     "and the maximum deficit should be between 1 and %llx (%x)\n",
+                     TSC_OFFSETTING_MAXIMUM_DEFICIT_LIMIT,
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_UNABLE_TO_RESOLVE_SYSCALL_FROM_SERVICE_TABLE:
+        ShowMessages("err, unable to find the system-call in the service table of the kernel, "
+                     "note that the win32k system-calls are not supported (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_SERVICE_TABLE_SYSCALL_HOOK:
+        ShowMessages("err, hooking the service table needs a system-call number and "
+                     "only the pre-event calling stage is supported (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_EVENT_SAMPLING_POLICY:
+        ShowMessages("err, invalid sampling policy for the event (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_MAXIMUM_SAMPLED_EVENTS_REACHED:
+        ShowMessages("err, the maximum number of the events with sampling policies is reached, "
+                     "please clear some of them (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_PROFILER_PARAMETERS:
+        ShowMessages("err, invalid parameters for the profiler, the period should not be less than %x "
+                     "cycles and the stack depth should not be more than %x (%x)\n",
+                     PROFILER_MINIMUM_PERIOD,
+                     PROFILER_MAXIMUM_STACK_DEPTH,
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_PROFILER_IS_NOT_SUPPORTED:
+        ShowMessages("err, the processor doesn't support the VMX-preemption timer or saving its value "
+                     "on vm-exits (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_UNABLE_TO_ALLOCATE_PROFILER_HISTOGRAMS:
+        ShowMessages("err, unable to allocate the histograms of the profiler (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_PROCESSOR_TRACE_PARAMETERS:
+        ShowMessages("err, invalid parameters for the processor trace, the buffer size should be a power "
+                     "of two between %x and %x bytes, and the process, the core or the range should be "
+                     "valid (%x)\n",
+                     PROCESSOR_TRACE_MINIMUM_BUFFER_SIZE,
+                     PROCESSOR_TRACE_MAXIMUM_BUFFER_SIZE,
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_PROCESSOR_TRACE_IS_NOT_SUPPORTED:
+        ShowMessages("err, the processor doesn't support Intel Processor Trace in VMX operation, or "
+                     "the requested filter (CR3 or IP) is not supported (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_UNABLE_TO_ALLOCATE_PROCESSOR_TRACE_BUFFERS:
+        ShowMessages("err, unable to allocate the buffers of the processor trace (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_PROCESSOR_TRACE_IS_RUNNING:
+        ShowMessages("err, the processor trace is still running on the core, stop it first (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_LBR_PARAMETERS:
+        ShowMessages("err, invalid parameters for the last branch records, the count of the branches "
+                     "should be between 1 and %d, at least one core should be chosen, and the filter "
+                     "is not supported on this processor (%x)\n",
+                     LBR_SNAPSHOT_MAXIMUM_RECORDS,
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_LBR_IS_NOT_SUPPORTED:
+        ShowMessages("err, the last branch records of this processor are not supported, or the "
+                     "debug controls are not available in VMX operation (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_ADDRESS_IS_HOOKED_BY_ANOTHER_EVENT_TYPE:
+        ShowMessages("err, the address is already hooked by another type of event, a '!syscall3' "
+                     "and an '!epthook' event can't be used on the same address (%x)\n",
+                     Error);
+        break;
+
     default:
         ShowMessages("err, error not found (%x)\n",
                      Error);
@@ -1277,6 +1391,319 @@ InterpretOutput(vector<CommandToken> * CommandTokens,
     return TRUE;
 }
 
+/**
+ * @brief Interpret the event trace option (if the event should be recorded
+ * into the binary event trace)
+ * @details The 'trace' keyword might be followed by a bracket list of (up to
+ * three) general-purpose registers to be saved in each record, otherwise
+ * rax, rcx, and rdx are saved
+ *
+ * @param CommandTokens command tokens
+ * @param HasEventTrace shows whether the 'trace' keyword is found or not
+ * @param RegisterIds the index of the registers that will be saved in the records
+ * @return BOOLEAN shows whether the interpret was successful (true) or not
+ * successful (false)
+ */
+BOOLEAN
+InterpretEventTrace(vector<CommandToken> * CommandTokens,
+                    BOOLEAN *              HasEventTrace,
+                    UINT8 *                RegisterIds)
+{
+    BOOLEAN        IsTextVisited       = FALSE;
+    string         TargetBracketString = "";
+    vector<string> RegisterNames;
+    vector<int>    IndexesToRemove;
+    string         Token;
+    int            NewIndexToRemove = 0;
+    int            Index            = 0;
+    char           Delimiter        = ',';
+    size_t         Pos              = 0;
+
+    *HasEventTrace = FALSE;
+
+    //
+    // By default, rax, rcx, and rdx are saved
+    //
+    RegisterIds[0] = 0;
+    RegisterIds[1] = 1;
+    RegisterIds[2] = 2;
+
+    for (auto Section : *CommandTokens)
+    {
+        Index++;
+
+        if (IsTextVisited && IsTokenBracketString(Section))
+        {
+            //
+            // Save to remove this string from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            //
+            // Fill the bracket string
+            //
+            TargetBracketString = GetCaseSensitiveStringFromCommandToken(Section);
+
+            IsTextVisited = FALSE;
+            continue;
+        }
+
+        IsTextVisited = FALSE;
+
+        if (CompareLowerCaseStrings(Section, "trace"))
+        {
+            //
+            // Save to remove this string from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            *HasEventTrace = TRUE;
+            IsTextVisited  = TRUE;
+            continue;
+        }
+    }
+
+    //
+    // Removing indexes from the command
+    //
+    NewIndexToRemove = 0;
+    for (auto IndexToRemove : IndexesToRemove)
+    {
+        NewIndexToRemove++;
+        CommandTokens->erase(CommandTokens->begin() + (IndexToRemove - NewIndexToRemove));
+    }
+
+    if (TargetBracketString.length() == 0)
+    {
+        //
+        // Default registers are used
+        //
+        return TRUE;
+    }
+
+    //
+    // Split the list of registers
+    //
+    while ((Pos = TargetBracketString.find(Delimiter)) != string::npos)
+    {
+        Token = TargetBracketString.substr(0, Pos);
+        Trim(Token);
+
+        if (!Token.empty())
+        {
+            RegisterNames.push_back(Token);
+        }
+
+        TargetBracketString.erase(0, Pos + sizeof(Delimiter) / sizeof(char));
+    }
+
+    Trim(TargetBracketString);
+
+    if (!TargetBracketString.empty())
+    {
+        RegisterNames.push_back(TargetBracketString);
+    }
+
+    if (RegisterNames.size() == 0 || RegisterNames.size() > EVENT_TRACE_NUMBER_OF_REGISTERS)
+    {
+        ShowMessages("err, please specify one to %d registers for the event trace\n",
+                     EVENT_TRACE_NUMBER_OF_REGISTERS);
+        return FALSE;
+    }
+
+    for (size_t i = 0; i < EVENT_TRACE_NUMBER_OF_REGISTERS; i++)
+    {
+        //
+        // Unused slots repeat the last register
+        //
+        const string & Name = RegisterNames[i < RegisterNames.size() ? i : RegisterNames.size() - 1];
+
+        if (!EventTraceGetRegisterIdByName(Name.c_str(), &RegisterIds[i]))
+        {
+            ShowMessages("err, register '%s' is not a general-purpose register\n", Name.c_str());
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Interpret the sampling policy of the event (which triggers of the
+ * event run the actions)
+ * @details The 'sample' keyword is followed by the policy:
+ *      sample every N (hex)                   : the first and then each Nth trigger on each core
+ *      sample prob P (decimal)                : each trigger with the probability of P
+ *      sample bucket Cycles (hex) Burst (hex) : up to Burst triggers, and one more per Cycles, on each core
+ *      sample first N (hex)                   : the first N triggers, then the event is disabled
+ *
+ * @param CommandTokens command tokens
+ * @param Policy the sampling policy (DEBUGGER_EVENT_SAMPLING_TYPE_NONE if not found)
+ * @return BOOLEAN shows whether the interpret was successful (true) or not
+ * successful (false)
+ */
+BOOLEAN
+InterpretEventSampling(vector<CommandToken> *          CommandTokens,
+                       PDEBUGGER_EVENT_SAMPLING_POLICY Policy)
+{
+    size_t Index;
+    size_t NumberOfParameters;
+    string Type;
+    double Probability;
+
+    RtlZeroMemory(Policy, sizeof(DEBUGGER_EVENT_SAMPLING_POLICY));
+
+    for (Index = 0; Index < CommandTokens->size(); Index++)
+    {
+        if (CompareLowerCaseStrings(CommandTokens->at(Index), "sample"))
+        {
+            break;
+        }
+    }
+
+    if (Index == CommandTokens->size())
+    {
+        //
+        // No sampling policy, all of the triggers run the actions
+        //
+        return TRUE;
+    }
+
+    if (Index + 2 >= CommandTokens->size())
+    {
+        ShowMessages("err, please specify the sampling policy and its parameters\n");
+        return FALSE;
+    }
+
+    Type               = GetLowerStringFromCommandToken(CommandTokens->at(Index + 1));
+    NumberOfParameters = 1;
+
+    if (!Type.compare("every") || !Type.compare("first"))
+    {
+        Policy->Type = !Type.compare("every") ? DEBUGGER_EVENT_SAMPLING_TYPE_EVERY_NTH : DEBUGGER_EVENT_SAMPLING_TYPE_FIRST_N;
+
+        if (!ConvertTokenToUInt64(CommandTokens->at(Index + 2), &Policy->Parameter1) || Policy->Parameter1 == 0)
+        {
+            ShowMessages("err, the number of the triggers should be a non-zero hex number\n");
+            return FALSE;
+        }
+    }
+    else if (!Type.compare("prob"))
+    {
+        Policy->Type = DEBUGGER_EVENT_SAMPLING_TYPE_PROBABILISTIC;
+
+        try
+        {
+            Probability = stod(GetCaseSensitiveStringFromCommandToken(CommandTokens->at(Index + 2)));
+        }
+        catch (...)
+        {
+            Probability = 0;
+        }
+
+        if (!(Probability > 0 && Probability <= 1))
+        {
+            ShowMessages("err, the probability should be a decimal number in (0, 1]\n");
+            return FALSE;
+        }
+
+        //
+        // The probability is in 1/2^32
+        //
+        Policy->Parameter1 = (UINT64)(Probability * 4294967296.0);
+
+        if (Policy->Parameter1 == 0)
+        {
+            Policy->Parameter1 = 1;
+        }
+    }
+    else if (!Type.compare("bucket"))
+    {
+        Policy->Type       = DEBUGGER_EVENT_SAMPLING_TYPE_TOKEN_BUCKET;
+        NumberOfParameters = 2;
+
+        if (Index + 3 >= CommandTokens->size() ||
+            !ConvertTokenToUInt64(CommandTokens->at(Index + 2), &Policy->Parameter1) ||
+            !ConvertTokenToUInt64(CommandTokens->at(Index + 3), &Policy->Parameter2) ||
+            Policy->Parameter1 == 0 ||
+            Policy->Parameter2 == 0)
+        {
+            ShowMessages("err, please specify the cycles of each token and the burst as non-zero hex numbers\n");
+            return FALSE;
+        }
+    }
+    else
+    {
+        ShowMessages("err, unknown sampling policy '%s' (every, prob, bucket, or first)\n", Type.c_str());
+        return FALSE;
+    }
+
+    //
+    // Remove the policy from the command
+    //
+    CommandTokens->erase(CommandTokens->begin() + Index, CommandTokens->begin() + Index + 2 + NumberOfParameters);
+
+    return TRUE;
+}
+
+/**
+ * @brief Interpret the last branch records option (if the last branches should
+ * be captured when the event is triggered)
+ * @details The 'lbr' keyword is followed by the count of the branches (hex),
+ * the branches are shown in the output of the event
+ *
+ * @param CommandTokens command tokens
+ * @param HasLbrSnapshot shows whether the 'lbr' keyword is found or not
+ * @param Count the count of the branches
+ * @return BOOLEAN shows whether the interpret was successful (true) or not
+ * successful (false)
+ */
+BOOLEAN
+InterpretEventLbr(vector<CommandToken> * CommandTokens,
+                  BOOLEAN *              HasLbrSnapshot,
+                  UINT32 *               Count)
+{
+    size_t Index;
+
+    *HasLbrSnapshot = FALSE;
+    *Count          = 0;
+
+    for (Index = 0; Index < CommandTokens->size(); Index++)
+    {
+        if (CompareLowerCaseStrings(CommandTokens->at(Index), "lbr"))
+        {
+            break;
+        }
+    }
+
+    if (Index == CommandTokens->size())
+    {
+        //
+        // The last branches are not captured
+        //
+        return TRUE;
+    }
+
+    if (Index + 1 >= CommandTokens->size() ||
+        !ConvertTokenToUInt32(CommandTokens->at(Index + 1), Count) ||
+        *Count == 0 ||
+        *Count > LBR_SNAPSHOT_MAXIMUM_RECORDS)
+    {
+        ShowMessages("err, please specify the count of the branches as a hex number between 1 and %x\n",
+                     LBR_SNAPSHOT_MAXIMUM_RECORDS);
+        return FALSE;
+    }
+
+    *HasLbrSnapshot = TRUE;
+
+    //
+    // Remove the option from the command
+    //
+    CommandTokens->erase(CommandTokens->begin() + Index, CommandTokens->begin() + Index + 2);
+
+    return TRUE;
+}
+
 /**
  * @brief Register the event to the kernel
  *
@@ -1682,6 +2109,8 @@ InterpretGeneralEventAndActionsFields(
     UINT64                                ConditionBufferAddress;
     UINT32                                ConditionBufferLength = 0;
     vector<string>                        ListOfOutputSources;
+    UINT8                                 EventTraceRegisterIds[EVENT_TRACE_NUMBER_OF_REGISTERS];
+    DEBUGGER_EVENT_SAMPLING_POLICY        SamplingPolicy;
     UINT64                                CodeBufferAddress;
     UINT32                                CodeBufferLength = 0;
     UINT64                                ScriptBufferAddress;
@@ -1696,6 +2125,8 @@ InterpretGeneralEventAndActionsFields(
     BOOLEAN                               HasOutputPath                    = FALSE;
     BOOLEAN                               HasCodeBuffer                    = FALSE;
     BOOLEAN                               HasScript                        = FALSE;
+    BOOLEAN                               HasEventTrace                    = FALSE;
+    BOOLEAN                               HasLbrSnapshot                   = FALSE;
     BOOLEAN                               IsNextCommandPid                 = FALSE;
     BOOLEAN                               IsNextCommandCoreId              = FALSE;
     BOOLEAN                               IsNextCommandBufferSize          = FALSE;
@@ -1706,7 +2137,8 @@ InterpretGeneralEventAndActionsFields(
     UINT32                                CoreId;
     UINT32                                ProcessId;
     UINT32                                IndexOfValidSourceTags;
-    UINT32                                RequestBuffer = 0;
+    UINT32                                RequestBuffer    = 0;
+    UINT32                                LbrSnapshotCount = 0;
     PLIST_ENTRY                           TempList;
     BOOLEAN                               OutputSourceFound;
     vector<int>                           IndexesToRemove;
@@ -1999,6 +2431,49 @@ InterpretGeneralEventAndActionsFields(
         HasOutputPath = TRUE;
     }
 
+    //
+    // Check if the event should be recorded into the event trace
+    //
+    if (!InterpretEventTrace(CommandTokens, &HasEventTrace, EventTraceRegisterIds))
+    {
+        free(BufferOfCommandString);
+
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+        return FALSE;
+    }
+
+    if (HasEventTrace && g_IsSerialConnectedToRemoteDebuggee)
+    {
+        free(BufferOfCommandString);
+
+        ShowMessages("err, the event trace is only supported in the VMI Mode\n");
+
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_EVENT_TRACE_IN_DEBUGGER_MODE;
+        return FALSE;
+    }
+
+    //
+    // Check if only some of the triggers of the event should run the actions
+    //
+    if (!InterpretEventSampling(CommandTokens, &SamplingPolicy))
+    {
+        free(BufferOfCommandString);
+
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+        return FALSE;
+    }
+
+    //
+    // Check if the last branches should be captured
+    //
+    if (!InterpretEventLbr(CommandTokens, &HasLbrSnapshot, &LbrSnapshotCount))
+    {
+        free(BufferOfCommandString);
+
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+        return FALSE;
+    }
+
     //
     // Create action and event based on previously parsed buffers
     // (DEBUGGER_GENERAL_ACTION)
@@ -2198,9 +2673,39 @@ InterpretGeneralEventAndActionsFields(
 
     //
     // If this action didn't contain a buffer for custom code and
-    // a buffer for script then it's a break to debugger
+    // a buffer for script then it's a break to debugger (events that
+    // are only recorded into the event trace need no action, and the
+    // capture of the last branches is sent in the place of the break)
     //
-    if (!HasCodeBuffer && !HasScript)
+    if (HasLbrSnapshot)
+    {
+        //
+        // Allocate the Action (THIS ACTION BUFFER WILL BE FREED WHEN WE SENT IT TO
+        // THE KERNEL AND RETURNED FROM THE KERNEL AS WE DON'T NEED IT ANYMORE)
+        //
+        LengthOfBreakActionBuffer = sizeof(DEBUGGER_GENERAL_ACTION);
+
+        TempActionBreak = (PDEBUGGER_GENERAL_ACTION)malloc(LengthOfBreakActionBuffer);
+
+        RtlZeroMemory(TempActionBreak, LengthOfBreakActionBuffer);
+
+        //
+        // Set the action Tag
+        //
+        TempActionBreak->EventTag = TempEvent->Tag;
+
+        //
+        // Set the action type and the count of the branches
+        //
+        TempActionBreak->ActionType       = LBR_SNAPSHOT;
+        TempActionBreak->LbrSnapshotCount = LbrSnapshotCount;
+
+        //
+        // Increase the count of actions
+        //
+        TempEvent->CountOfActions = TempEvent->CountOfActions + 1;
+    }
+    else if (!HasCodeBuffer && !HasScript && !HasEventTrace)
     {
         //
         // Allocate the Action (THIS ACTION BUFFER WILL BE FREED WHEN WE SENT IT TO
@@ -2581,7 +3086,7 @@ InterpretGeneralEventAndActionsFields(
     //
     // It's not possible to break to debugger in VMI-mode
     //
-    if (!g_IsSerialConnectedToRemoteDebuggee && TempActionBreak != NULL)
+    if (!g_IsSerialConnectedToRemoteDebuggee && TempActionBreak != NULL && TempActionBreak->ActionType == BREAK_TO_DEBUGGER)
     {
         ShowMessages(
             "err, the script or assembly code is either not found or invalid. "
@@ -2656,6 +3161,20 @@ InterpretGeneralEventAndActionsFields(
         TempEvent->EnableShortCircuiting = TRUE;
     }
 
+    //
+    // Set the registers that are saved into the event trace
+    //
+    if (HasEventTrace)
+    {
+        TempEvent->RecordEventTrace = TRUE;
+        memcpy(TempEvent->EventTraceRegisterIds, EventTraceRegisterIds, sizeof(EventTraceRegisterIds));
+    }
+
+    //
+    // Set the sampling policy
+    //
+    memcpy(&TempEvent->SamplingPolicy, &SamplingPolicy, sizeof(DEBUGGER_EVENT_SAMPLING_POLICY));
+
     //
     // Set the specific event mode (calling stage)
     //
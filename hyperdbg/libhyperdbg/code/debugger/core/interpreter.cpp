@@ -42,25 +42,86 @@ class CommandParser
 public:
     /**
      * @brief Parse the input string (commands)
-     * @param input
+     * @details The tokens are copied out of the arena of the tokenizer
+     * into the CommandToken tuples that are passed to the commands
+     *
+     * @param Input
      *
      * @return std::vector<CommandToken>
      */
-    std::vector<CommandToken> Parse(const std::string & ConstInput)
+    std::vector<CommandToken> Parse(std::string_view Input)
+    {
+        std::vector<CommandToken> Tokens;
+
+        const std::vector<COMMAND_TOKEN_VIEW> & TokenViews = Tokenize(Input);
+
+        Tokens.reserve(TokenViews.size());
+
+        for (const auto & TokenView : TokenViews)
+        {
+            Tokens.emplace_back(TokenView.Type, std::string(TokenView.Text), std::string(TokenView.LowerText));
+        }
+
+        return Tokens;
+    }
+
+    /**
+     * @brief Tokenize the input string (commands)
+     * @details The text of all tokens (and their lower case form) is kept
+     * in a single arena, so the returned views are only valid until the
+     * next call to the tokenizer (or until the parser is destroyed)
+     *
+     * @param ConstInput
+     *
+     * @return const std::vector<COMMAND_TOKEN_VIEW> &
+     */
+    const std::vector<COMMAND_TOKEN_VIEW> & Tokenize(std::string_view ConstInput)
     {
-        std::vector<CommandToken> tokens;
-        std::string               current;
-        bool                      InQuotes   = FALSE;
-        int                       IdxBracket = 0;
+        size_t                TokenStart         = 0;
+        bool                  InQuotes           = FALSE;
+        int                   IdxBracket         = 0;
+        COMMAND_PARSER_SEARCH NextQuote          = {std::string::npos, std::string::npos, 0};
+        COMMAND_PARSER_SEARCH NextClosingQuote   = {std::string::npos, std::string::npos, 0};
+        COMMAND_PARSER_SEARCH NextCloseBracket   = {std::string::npos, std::string::npos, 0};
+        COMMAND_PARSER_SEARCH NextEscapedNewLine = {std::string::npos, std::string::npos, 0};
+        COMMAND_PARSER_SEARCH NextNewLine        = {std::string::npos, std::string::npos, 0};
 
         //
-        // mainly for removing \ from escaped chars
+        // The input is only copied if escaped chars should be removed from it
         //
-        std::string input = ConstInput;
+        std::string_view input = ConstInput;
+
+        IsInputCopied = FALSE;
+        InputVersion  = 0;
+        Arena.clear();
+        Spans.clear();
+        Views.clear();
+
+        Arena.reserve(ConstInput.size() * 2);
+
         for (size_t i = 0; i < input.length(); ++i)
         {
             char c = input[i];
 
+            //
+            // Chars that are not delimiters are always added to the current
+            // token, so the whole run of them is added at once
+            //
+            if (!IsDelimiterChar(c, !InQuotes && !IdxBracket))
+            {
+                size_t RunEnd = i + 1;
+
+                while (RunEnd < input.length() && !IsDelimiterChar(input[RunEnd], !InQuotes && !IdxBracket))
+                {
+                    RunEnd++;
+                }
+
+                Arena.append(input.substr(i, RunEnd - i));
+                i = RunEnd - 1;
+
+                continue;
+            }
+
             if (c == '/') // start comment parse
             {
                 //
@@ -68,8 +129,7 @@ public:
                 //
                 if (!InQuotes)
                 {
-                    size_t j  = i;
-                    char   c2 = input[++j];
+                    char c2 = CharAt(input, i + 1);
 
                     if (c2 == '/') // start to look for comments
                     {
@@ -77,34 +137,18 @@ public:
                         // to solve cases like: //"}"
                         //
                         size_t StrLitEnd = 0;
-                        size_t StrLitBeg = input.find("\"", i);
+                        size_t StrLitBeg = FindForward(input, "\"", i, NextQuote);
                         if (StrLitBeg != std::string::npos)
                         {
-                            if (i)
+                            if (!i || input[i - 1] != '\\') // if not escaped
                             {
-                                if (input[i - 1] != '\\') // if not escaped
-                                {
-                                    StrLitEnd = input.find("\"", StrLitBeg + 1);
-                                    if (StrLitEnd != std::string::npos)
-                                    {
-                                        std::string StrLit(input.substr(i, StrLitEnd - i + 1));
-                                    }
-                                }
-                            }
-                            else
-                            {
-                                StrLitEnd = input.find("\"", StrLitBeg + 1);
-                                if (StrLitEnd != std::string::npos)
-                                {
-                                    std::string StrLit(input.substr(i, StrLitEnd - i + 1));
-                                }
+                                StrLitEnd = FindForward(input, "\"", StrLitBeg + 1, NextClosingQuote);
                             }
                         }
 
                         //
                         // assuming " }" as the end of a line comment aka //, if we are within {}
                         //
-                        bool   CmntEndBrkt  = false;
                         size_t CloseBrktPos = 0;
                         if (IdxBracket)
                         {
@@ -112,12 +156,12 @@ public:
                             // loop for escaped }
                             //
                             auto pos = (StrLitEnd > i) ? StrLitEnd : i;
-                            for (CloseBrktPos = input.find("}", pos); CloseBrktPos != std::string::npos;)
+                            for (CloseBrktPos = FindForward(input, "}", pos, NextCloseBracket); CloseBrktPos != std::string::npos;)
                             {
-                                CloseBrktPos = input.find("}", CloseBrktPos);
-                                if (input[CloseBrktPos - 1] == '\\')
+                                CloseBrktPos = FindForward(input, "}", CloseBrktPos, NextCloseBracket);
+                                if (CharAt(input, CloseBrktPos - 1) == '\\')
                                 {
-                                    input.erase(CloseBrktPos - 1, 1);
+                                    EraseInputChar(input, CloseBrktPos - 1);
                                     CloseBrktPos += 1;
                                 }
                                 else
@@ -131,30 +175,23 @@ public:
                             CloseBrktPos = std::string::npos;
                         }
 
-                        size_t NewLineSrtPos = input.find("\\n", i);                               // "\\n" entered by user
+                        size_t NewLineSrtPos = FindForward(input, "\\n", i, NextEscapedNewLine);    // "\\n" entered by user
                         if (StrLitBeg && StrLitBeg <= NewLineSrtPos && NewLineSrtPos <= StrLitEnd) // is it within the string literal?
                         {
                             NewLineSrtPos = std::string::npos;
                         }
-                        size_t NewLineChrPos = input.find('\n', i);
+                        size_t NewLineChrPos = FindForward(input, "\n", i, NextNewLine);
 
-                        std::vector<size_t> PosVec = {CloseBrktPos, NewLineSrtPos, NewLineChrPos};
+                        auto min = std::min({CloseBrktPos, NewLineSrtPos, NewLineChrPos}); // see which one occures first
 
-                        auto min = *(min_element(PosVec.begin(), PosVec.end())); // see which one occures first
-
-                        if (min != std::string::npos && input[min - 1] != '\\')
+                        if (min != std::string::npos && CharAt(input, min - 1) != '\\')
                         {
-                            //
-                            // here we could get the comment but for now we just skip
-                            //
-                            std::string comment(input.substr(i, min - i));
-
                             //
                             // append comments to be passed to script engine
                             //
                             if (IdxBracket)
                             {
-                                current += comment;
+                                Arena.append(input.substr(i, min - i));
                             }
 
                             //
@@ -167,92 +204,40 @@ public:
                         }
                         else
                         {
-                            bool IsNewLineEsc = false;
-                            if (NewLineSrtPos != std::string::npos)
-                            {
-                                IsNewLineEsc = input[NewLineSrtPos - 1] == '\\';
-                            }
-
-                            // if (NewLineSrtPos != std::string::npos && !IsNewLineEsc) // is not escaped
-                            //{
-                            //     //
-                            //     // here we could get the comment but for now we just skip
-                            //     //
-                            //     std::string comment(input.substr(i, NewLineSrtPos - i));
-
-                            //    //
-                            //    // append comments to be passed to script engine
-                            //    //
-                            //    if (IdxBracket)
-                            //    {
-                            //        current += comment;
-                            //    }
-
-                            //    //
-                            //    // forward the buffer
-                            //    //
-                            //    i = i + (NewLineSrtPos - i) + 1; // +1 for "\n". the "continue;" will also go past another time.
-
-                            //    continue;
-                            //}
-                            // else if (NewLineChrPos != std::string::npos)
-                            //{
-                            //    //
-                            //    // here we could get the comment but for now we just skip
-                            //    //
-                            //    std::string comment(input.substr(i, NewLineChrPos - i));
-
-                            //    //
-                            //    // append comments to be passed to script engine
-                            //    //
-                            //    if (IdxBracket)
-                            //    {
-                            //        current += comment;
-                            //    }
-
-                            //    //
-                            //    // forward the buffer
-                            //    //
-                            //    i = i + (NewLineChrPos - i);
-
-                            //    continue; // go past '\n'
-                            //}
-                            // else
-                            //{
                             //
                             // no "\\n" nor '\n' found so we just mark the chars as comment till end of string
                             //
-                            std::string comment(input.substr(i, input.size()));
-
-                            // fix the escaped newline
-                            if (IsNewLineEsc)
+                            if (IdxBracket)
                             {
-                                size_t start_pos = 0;
-                                while ((start_pos = comment.find("\\\\n", start_pos)) != std::string::npos)
+                                if (NewLineSrtPos != std::string::npos && CharAt(input, NewLineSrtPos - 1) == '\\')
                                 {
-                                    comment.replace(start_pos, 3, "\\n");
-                                    start_pos += 2; // Handles case where 'to' is a substring of 'from'
-                                }
+                                    //
+                                    // fix the escaped newline
+                                    //
+                                    std::string comment(input.substr(i));
+                                    size_t      start_pos = 0;
 
-                                IsNewLineEsc = false;
-                            }
+                                    while ((start_pos = comment.find("\\\\n", start_pos)) != std::string::npos)
+                                    {
+                                        comment.replace(start_pos, 3, "\\n");
+                                        start_pos += 2; // Handles case where 'to' is a substring of 'from'
+                                    }
 
-                            //
-                            // append comments to be passed to script engine
-                            //
-                            if (IdxBracket)
-                            {
-                                current += comment;
+                                    Arena.append(comment);
+                                }
+                                else
+                                {
+                                    Arena.append(input.substr(i));
+                                }
                             }
 
                             //
                             // forward the buffer
                             //
-                            i = i + (input.size() - i);
+                            i = input.size();
 
                             continue;
                         }
-                        //}
                     }
                     else if (c2 == '*')
                     {
@@ -260,17 +245,12 @@ public:
 
                         if (EndPose != std::string::npos)
                         {
-                            //
-                            // here we could get the comment but for now we just skip
-                            //
-                            std::string comment(input.substr(i, EndPose - i + 2)); // */ is two bytes long
-
                             //
                             // append comments to be passed to script engine
                             //
                             if (IdxBracket)
                             {
-                                current += comment;
+                                Arena.append(input.substr(i, EndPose - i + 2)); // */ is two bytes long
                             }
 
                             //
@@ -292,7 +272,7 @@ public:
             {
                 if (c == '"')
                 {
-                    if (input[i - 1] != '\\')
+                    if (CharAt(input, i - 1) != '\\')
                     {
                         InQuotes = FALSE;
 
@@ -301,13 +281,12 @@ public:
                         //
                         if (!IdxBracket)
                         {
-                            AddStringToken(tokens, current, TRUE); // TRUE for StringLiteral type
-                            current.clear();
-                            continue; // dont add " char
+                            AddStringToken(TokenStart, TRUE); // TRUE for StringLiteral type
+                            continue;                         // dont add " char
                         }
                         else
                         {
-                            current += c;
+                            Arena.push_back(c);
                             continue; // dont add " char
                         }
                         //
@@ -316,7 +295,7 @@ public:
                     }
                     else
                     {
-                        input.erase(i - 1, 1);
+                        EraseInputChar(input, i - 1);
                         i--; // compensate for the removed char
 
                         //
@@ -324,9 +303,9 @@ public:
                         //
                         if (!IdxBracket)
                         {
-                            current.pop_back();
+                            PopLastChar(TokenStart);
                         }
-                        current += c;
+                        Arena.push_back(c);
                         continue;
                     }
                 }
@@ -334,7 +313,7 @@ public:
 
             if (c == '}')
             {
-                if (input[i - 1] != '\\')
+                if (CharAt(input, i - 1) != '\\')
                 {
                     if (IdxBracket)
                     {
@@ -345,8 +324,7 @@ public:
 
                         if (!IdxBracket) // is closing }
                         {
-                            AddBracketStringToken(tokens, current);
-                            current.clear();
+                            AddBracketStringToken(TokenStart);
 
                             continue;
                         }
@@ -354,19 +332,18 @@ public:
                 }
                 else if (!InQuotes)
                 {
-                    input.erase(i - 1, 1);
-                    i--;                // compensate for the removed char
-                    current.pop_back(); // remove last read \\
+                    EraseInputChar(input, i - 1);
+                    i--;                     // compensate for the removed char
+                    PopLastChar(TokenStart); // remove last read \\
 
                 }
             }
 
-            if (((c == ' ' && !InQuotes) || c == '    ') && !InQuotes && !IdxBracket) // finding seperator space char // Tab seperator added too
+            if (c == ' ' && !InQuotes && !IdxBracket) // finding seperator space char
             {
-                if (!current.empty() && current != " ")
+                if (!GetCurrentToken(TokenStart).empty() && GetCurrentToken(TokenStart) != " ")
                 {
-                    AddToken(tokens, current);
-                    current.clear();
+                    AddToken(TokenStart);
 
                     continue;
                 }
@@ -376,10 +353,9 @@ public:
             {
                 if (i) // check if this " is the first char to avoid out of range check
                 {
-                    if (input[i - 1] != ' ' && !IdxBracket && !current.empty() && !InQuotes) // is prev cmd adjacent to "
+                    if (input[i - 1] != ' ' && !IdxBracket && !GetCurrentToken(TokenStart).empty() && !InQuotes) // is prev cmd adjacent to "
                     {
-                        AddStringToken(tokens, current);
-                        current.clear();
+                        AddStringToken(TokenStart);
                     }
 
                     if (input[i - 1] != '\\')
@@ -408,8 +384,7 @@ public:
                     {
                         if (input[i - 1] != ' ' && !IdxBracket) // in case '{' is adjacent to previous command like "command{", on first {
                         {
-                            AddToken(tokens, current);
-                            current.clear();
+                            AddToken(TokenStart);
                         }
 
                         IdxBracket++;
@@ -418,9 +393,9 @@ public:
                     }
                     else
                     {
-                        input.erase(i - 1, 1);
-                        i--;                // compensate for the removed char
-                        current.pop_back(); // remove last read \\
+                        EraseInputChar(input, i - 1);
+                        i--;                     // compensate for the removed char
+                        PopLastChar(TokenStart); // remove last read \\
 
                     }
                 }
@@ -437,19 +412,19 @@ public:
             //
             if (c == '\\' && !InQuotes)
             {
-                if (current.empty() && input[i + 1] == 'n')
+                if (GetCurrentToken(TokenStart).empty() && CharAt(input, i + 1) == 'n')
                 {
                     i++;
                     continue;
                 }
             }
 
-            current += c;
+            Arena.push_back(c);
         }
 
-        if (!current.empty() && current != " ")
+        if (!GetCurrentToken(TokenStart).empty() && GetCurrentToken(TokenStart) != " ")
         {
-            AddToken(tokens, current);
+            AddToken(TokenStart);
         }
 
         if (IdxBracket)
@@ -462,7 +437,31 @@ public:
             // error: Quote not closed
         }
 
-        return tokens;
+        //
+        // Put the lower case form of the arena right after it, so both
+        // forms of each token are at the same offsets of the two halves
+        //
+        size_t LowerCaseBase = Arena.size();
+
+        Arena.resize(LowerCaseBase * 2);
+
+        for (size_t i = 0; i < LowerCaseBase; i++)
+        {
+            char Ch = Arena[i];
+
+            Arena[LowerCaseBase + i] = (Ch >= 'A' && Ch <= 'Z') ? (char)(Ch - 'A' + 'a') : Ch;
+        }
+
+        std::string_view ArenaView = Arena;
+
+        for (const auto & Span : Spans)
+        {
+            Views.push_back({Span.Type,
+                             ArenaView.substr(Span.Offset, Span.Length),
+                             ArenaView.substr(LowerCaseBase + Span.Offset, Span.Length)});
+        }
+
+        return Views;
     }
 
     /**
@@ -579,88 +578,335 @@ public:
 
 private:
     /**
-     * @brief Convert a string to lowercase
-     * @param str
+     * @brief Position and type of a token in the arena
+     *
+     */
+    typedef struct _COMMAND_TOKEN_SPAN
+    {
+        CommandParsingTokenType Type;
+        size_t                  Offset;
+        size_t                  Length;
+
+    } COMMAND_TOKEN_SPAN, *PCOMMAND_TOKEN_SPAN;
+
+    /**
+     * @brief Result of a forward search in the input
      *
-     * @return std::string
      */
-    std::string ToLower(const std::string & str) const
+    typedef struct _COMMAND_PARSER_SEARCH
     {
-        std::string result = str;
-        std::transform(result.begin(), result.end(), result.begin(), ::tolower);
+        size_t From;
+        size_t Result;
+        UINT32 InputVersion;
+
+    } COMMAND_PARSER_SEARCH, *PCOMMAND_PARSER_SEARCH;
+
+    std::string                     Arena {};
+    std::string                     EscapedInput {};
+    BOOLEAN                         IsInputCopied {};
+    UINT32                          InputVersion {};
+    std::vector<COMMAND_TOKEN_SPAN> Spans {};
+    std::vector<COMMAND_TOKEN_VIEW> Views {};
 
-        return result;
+    /**
+     * @brief Get a char of the input (or a null char if it's out of range)
+     * @param Input
+     * @param Index
+     *
+     * @return char
+     */
+    static char CharAt(std::string_view Input, size_t Index)
+    {
+        return Index < Input.size() ? Input[Index] : '\0';
     }
 
     /**
-     * @brief Add Token
-     * @param tokens
-     * @param str
+     * @brief Check whether the char changes the state of the tokenizer
+     * @details Spaces are only separators if they're not within quotes
+     * or brackets
+     *
+     * @param Ch
+     * @param IsSpaceSeparator
+     *
+     * @return BOOLEAN
+     */
+    static BOOLEAN IsDelimiterChar(char Ch, BOOLEAN IsSpaceSeparator)
+    {
+        switch (Ch)
+        {
+        case '"':
+        case '{':
+        case '}':
+        case '/':
+        case '\\':
+            return TRUE;
+
+        case ' ':
+            return IsSpaceSeparator;
+
+        default:
+            return FALSE;
+        }
+    }
+
+    /**
+     * @brief Remove a char (the escape char) from the input
+     * @details The input is copied to the parser on the first removal
+     *
+     * @param Input
+     * @param Index
      *
      * @return VOID
      */
-    VOID AddToken(std::vector<CommandToken> & tokens, std::string & str)
+    VOID EraseInputChar(std::string_view & Input, size_t Index)
     {
-        auto   tmp    = str;
-        UINT64 tmpNum = 0;
+        if (Index >= Input.size())
+        {
+            return;
+        }
+
+        if (!IsInputCopied)
+        {
+            EscapedInput.assign(Input);
+            IsInputCopied = TRUE;
+        }
+
+        EscapedInput.erase(Index, 1);
+        Input = EscapedInput;
 
         //
-        // Trim the string
+        // The previous search results are not valid anymore
         //
-        Trim(tmp);
+        InputVersion++;
+    }
+
+    /**
+     * @brief Search the input forward from a position
+     * @details Comments search for the same delimiters from increasing
+     * positions, so the previous result is reused as long as it's still
+     * ahead of the position (otherwise long scripts are rescanned on each
+     * comment)
+     *
+     * @param Input
+     * @param Needle
+     * @param Position
+     * @param Search
+     *
+     * @return size_t
+     */
+    size_t FindForward(std::string_view Input, std::string_view Needle, size_t Position, COMMAND_PARSER_SEARCH & Search) const
+    {
+        if (Search.InputVersion != InputVersion || Search.From > Position ||
+            (Search.Result != std::string::npos && Search.Result < Position))
+        {
+            Search.From         = Position;
+            Search.Result       = Input.find(Needle, Position);
+            Search.InputVersion = InputVersion;
+        }
+
+        return Search.Result;
+    }
+
+    /**
+     * @brief Get the text of the token that is currently being built
+     * @param TokenStart
+     *
+     * @return std::string_view
+     */
+    std::string_view GetCurrentToken(size_t TokenStart) const
+    {
+        return std::string_view(Arena).substr(TokenStart);
+    }
+
+    /**
+     * @brief Remove the last char of the token that is currently being built
+     * @param TokenStart
+     *
+     * @return VOID
+     */
+    VOID PopLastChar(size_t TokenStart)
+    {
+        if (Arena.size() > TokenStart)
+        {
+            Arena.pop_back();
+        }
+    }
+
+    /**
+     * @brief Trim the whitespaces from both ends of the token
+     * @param Token
+     *
+     * @return std::string_view
+     */
+    static std::string_view TrimToken(std::string_view Token)
+    {
+        while (!Token.empty() && isspace((unsigned char)Token.front()))
+        {
+            Token.remove_prefix(1);
+        }
+
+        while (!Token.empty() && isspace((unsigned char)Token.back()))
+        {
+            Token.remove_suffix(1);
+        }
+
+        return Token;
+    }
+
+    /**
+     * @brief Check whether the token is a number
+     * @details The same notations as ConvertStringToUInt64 are accepted
+     * (0x, 0n, x, n, \x, \n and '`' separators) without copying the token
+     *
+     * @param Token
+     *
+     * @return BOOLEAN
+     */
+    static BOOLEAN IsNumberToken(std::string_view Token)
+    {
+        BOOLEAN IsDecimal  = FALSE; // By default everything is hex
+        BOOLEAN IsAnyThing = FALSE;
+        UINT64  Value      = 0;
+
+        if (Token.starts_with("0x") || Token.starts_with("0X") ||
+            Token.starts_with("\\x") || Token.starts_with("\\X"))
+        {
+            Token.remove_prefix(2);
+        }
+        else if (Token.starts_with('x') || Token.starts_with('X'))
+        {
+            Token.remove_prefix(1);
+        }
+        else if (Token.starts_with("0n") || Token.starts_with("0N") ||
+                 Token.starts_with("\\n") || Token.starts_with("\\N"))
+        {
+            Token.remove_prefix(2);
+            IsDecimal = TRUE;
+        }
+        else if (Token.starts_with('n') || Token.starts_with('N'))
+        {
+            Token.remove_prefix(1);
+            IsDecimal = TRUE;
+        }
+
+        for (char Ch : Token)
+        {
+            if (Ch == '`')
+            {
+                continue;
+            }
+
+            IsAnyThing = TRUE;
+
+            if (!IsDecimal)
+            {
+                if (!isxdigit((unsigned char)Ch))
+                {
+                    return FALSE;
+                }
+            }
+            else
+            {
+                if (!isdigit((unsigned char)Ch))
+                {
+                    return FALSE;
+                }
+
+                //
+                // Decimal numbers that don't fit into 64 bits are not numbers
+                //
+                if (Value > (MAXUINT64 - (Ch - '0')) / 10)
+                {
+                    return FALSE;
+                }
+
+                Value = Value * 10 + (Ch - '0');
+            }
+        }
+
+        return IsAnyThing;
+    }
+
+    /**
+     * @brief Add the span of a token and start the next token
+     * @param Type
+     * @param Token
+     * @param TokenStart
+     *
+     * @return VOID
+     */
+    VOID AddSpan(CommandParsingTokenType Type, std::string_view Token, size_t & TokenStart)
+    {
+        Spans.push_back({Type, (size_t)(Token.data() - Arena.data()), Token.size()});
+
+        TokenStart = Arena.size();
+    }
+
+    /**
+     * @brief Add Token
+     * @param TokenStart
+     *
+     * @return VOID
+     */
+    VOID AddToken(size_t & TokenStart)
+    {
+        std::string_view Token = TrimToken(GetCurrentToken(TokenStart));
 
-        if (ConvertStringToUInt64(tmp, &tmpNum)) // tmp will be modified to actual number
+        if (IsNumberToken(Token))
         {
-            tokens.emplace_back(CommandParsingTokenType::Num, tmp, ToLower(tmp));
+            AddSpan(CommandParsingTokenType::Num, Token, TokenStart);
         }
         else
         {
-            AddStringToken(tokens, str);
+            AddStringToken(TokenStart);
         }
     }
 
     /**
      * @brief Add String Token
-     * @param tokens
-     * @param str
+     * @param TokenStart
+     * @param isLiteral
      *
      * @return VOID
      */
-    VOID AddStringToken(std::vector<CommandToken> & tokens, std::string & str, BOOL isLiteral = FALSE)
+    VOID AddStringToken(size_t & TokenStart, BOOL isLiteral = FALSE)
     {
-        auto tmp = str;
+        std::string_view Token = GetCurrentToken(TokenStart);
 
         //
         // Trim the string
         //
         if (!isLiteral)
-            Trim(tmp);
+            Token = TrimToken(Token);
 
         //
         // If the string is empty, we don't need to add it
         //
-        if (tmp.empty())
+        if (Token.empty())
+        {
+            TokenStart = Arena.size();
             return;
+        }
+
         if (isLiteral)
         {
-            tokens.emplace_back(CommandParsingTokenType::StringLiteral, tmp, ToLower(tmp));
+            AddSpan(CommandParsingTokenType::StringLiteral, Token, TokenStart);
         }
         else
         {
-            tokens.emplace_back(CommandParsingTokenType::String, tmp, ToLower(tmp));
+            AddSpan(CommandParsingTokenType::String, Token, TokenStart);
         }
     }
 
     /**
      * @brief Add Bracket String Token
-     * @param tokens
-     * @param str
+     * @param TokenStart
      *
      * @return VOID
      */
-    VOID AddBracketStringToken(std::vector<CommandToken> & tokens, const std::string & str)
+    VOID AddBracketStringToken(size_t & TokenStart)
     {
-        tokens.emplace_back(CommandParsingTokenType::BracketString, str, ToLower(str));
+        AddSpan(CommandParsingTokenType::BracketString, GetCurrentToken(TokenStart), TokenStart);
     }
 };
 
@@ -794,6 +1040,118 @@ HyperDbgTestCommandParserShowTokens(CHAR * Command)
     Parser.PrintTokens(Tokens);
 }
 
+/**
+ * @brief Parse the commands repeatedly (used for benchmarking purposes)
+ * @details First, the tokens that are passed to the commands are checked to
+ * be identical to the tokens of the tokenizer, then both of them are timed
+ * while the first token of each command is looked up in the commands
+ * dictionary (the same as the interpreter)
+ *
+ * @param Commands The list of commands
+ * @param NumberOfCommands The number of commands
+ * @param NumberOfIterations The number of times that the list is parsed
+ * @param ParseTime The time of building the command tokens (in microseconds)
+ * @param TokenizeTime The time of only tokenizing the commands (in microseconds)
+ * @param NumberOfTokens The number of tokens in the list of commands
+ *
+ * @return BOOLEAN returns false if the tokens were not identical
+ */
+BOOLEAN
+HyperDbgTestCommandParserBenchmark(CHAR **  Commands,
+                                   UINT32   NumberOfCommands,
+                                   UINT32   NumberOfIterations,
+                                   UINT64 * ParseTime,
+                                   UINT64 * TokenizeTime,
+                                   UINT64 * NumberOfTokens)
+{
+    CommandParser Parser;
+    LARGE_INTEGER Frequency;
+    LARGE_INTEGER StartTime;
+    LARGE_INTEGER ParseEndTime;
+    LARGE_INTEGER TokenizeEndTime;
+    UINT64        ParseFoundCommands    = 0;
+    UINT64        TokenizeFoundCommands = 0;
+
+    *NumberOfTokens = 0;
+
+    //
+    // Check that both forms of the tokens are identical
+    //
+    for (UINT32 i = 0; i < NumberOfCommands; i++)
+    {
+        std::vector<CommandToken>               Tokens     = Parser.Parse(Commands[i]);
+        const std::vector<COMMAND_TOKEN_VIEW> & TokenViews = Parser.Tokenize(Commands[i]);
+
+        if (Tokens.size() != TokenViews.size())
+        {
+            ShowMessages("err, the number of tokens is not identical for command number %d\n", i);
+            return FALSE;
+        }
+
+        for (size_t j = 0; j < Tokens.size(); j++)
+        {
+            if (std::get<0>(Tokens[j]) != TokenViews[j].Type ||
+                std::get<1>(Tokens[j]) != TokenViews[j].Text ||
+                std::get<2>(Tokens[j]) != TokenViews[j].LowerText)
+            {
+                ShowMessages("err, token number %d is not identical for command number %d\n", (UINT32)j, i);
+                return FALSE;
+            }
+        }
+
+        *NumberOfTokens += Tokens.size();
+    }
+
+    //
+    // The commands dictionary is needed for looking up the commands
+    //
+    if (g_CommandsList.empty())
+    {
+        InitializeCommandsDictionary();
+    }
+
+    QueryPerformanceFrequency(&Frequency);
+    QueryPerformanceCounter(&StartTime);
+
+    for (UINT32 Iteration = 0; Iteration < NumberOfIterations; Iteration++)
+    {
+        for (UINT32 i = 0; i < NumberOfCommands; i++)
+        {
+            std::vector<CommandToken> Tokens = Parser.Parse(Commands[i]);
+
+            if (!Tokens.empty() && g_CommandsList.find(std::get<2>(Tokens.front())) != g_CommandsList.end())
+            {
+                ParseFoundCommands++;
+            }
+        }
+    }
+
+    QueryPerformanceCounter(&ParseEndTime);
+
+    for (UINT32 Iteration = 0; Iteration < NumberOfIterations; Iteration++)
+    {
+        for (UINT32 i = 0; i < NumberOfCommands; i++)
+        {
+            const std::vector<COMMAND_TOKEN_VIEW> & TokenViews = Parser.Tokenize(Commands[i]);
+
+            if (!TokenViews.empty() && g_CommandsList.find(TokenViews.front().LowerText) != g_CommandsList.end())
+            {
+                TokenizeFoundCommands++;
+            }
+        }
+    }
+
+    QueryPerformanceCounter(&TokenizeEndTime);
+
+    *ParseTime    = ((ParseEndTime.QuadPart - StartTime.QuadPart) * 1000000) / Frequency.QuadPart;
+    *TokenizeTime = ((TokenizeEndTime.QuadPart - ParseEndTime.QuadPart) * 1000000) / Frequency.QuadPart;
+
+    //
+    // Both of the loops should have found the same commands
+    //
+    return ParseFoundCommands == TokenizeFoundCommands;
+}
+
 /**
  * @brief Interpret commands
  *
@@ -808,6 +1166,7 @@ HyperDbgInterpreter(CHAR * Command)
     UINT64                CommandAttributes = NULL;
     CommandType::iterator Iterator;
     CommandParser         Parser;
+    std::string_view      FirstCommand;
 
     //
     // Check if it's the first command and whether the mapping of command is
@@ -832,15 +1191,10 @@ HyperDbgInterpreter(CHAR * Command)
         LogopenSaveToFile("\n");
     }
 
-    //
-    // Convert to string
-    //
-    string CommandString(Command);
-
     //
     // Tokenize the command string
     //
-    auto Tokens = Parser.Parse(CommandString);
+    auto Tokens = Parser.Parse(Command);
 
     //
     // Print the tokens
@@ -859,7 +1213,7 @@ HyperDbgInterpreter(CHAR * Command)
     //
     // Get the first command (lower case)
     //
-    string FirstCommand = GetLowerStringFromCommandToken(Tokens.front());
+    FirstCommand = std::get<2>(Tokens.front());
 
     //
     // Read the command's attributes
@@ -955,7 +1309,7 @@ HyperDbgInterpreter(CHAR * Command)
             // Show that it's a help command
             //
             HelpCommand  = TRUE;
-            FirstCommand = GetLowerStringFromCommandToken(Tokens.at(1));
+            FirstCommand = std::get<2>(Tokens.at(1));
         }
         else
         {
@@ -999,7 +1353,7 @@ HyperDbgInterpreter(CHAR * Command)
             //
             // Call the parser with tokens
             //
-            Iterator->second.CommandFunctionNewParser(Tokens, CaseSensitiveCommandString);
+            Iterator->second.CommandFunctionNewParser(std::move(Tokens), CaseSensitiveCommandString);
         }
     }
 
@@ -1257,7 +1611,7 @@ ContinuePreviousCommand()
  * @return BOOLEAN Mask of the command's attributes
  */
 UINT64
-GetCommandAttributes(const string & FirstCommand)
+GetCommandAttributes(std::string_view FirstCommand)
 {
     CommandType::iterator Iterator;
 
@@ -1342,6 +1696,11 @@ InitializeDebugger()
 VOID
 InitializeCommandsDictionary()
 {
+    //
+    // Allocate the buckets once, instead of rehashing while adding the commands
+    //
+    g_CommandsList.reserve(256);
+
     g_CommandsList[".help"] = {NULL, &CommandHelpHelp, DEBUGGER_COMMAND_HELP_ATTRIBUTES};
     g_CommandsList[".hh"]   = {NULL, &CommandHelpHelp, DEBUGGER_COMMAND_HELP_ATTRIBUTES};
     g_CommandsList["help"]  = {NULL, &CommandHelpHelp, DEBUGGER_COMMAND_HELP_ATTRIBUTES};
@@ -1515,6 +1874,7 @@ InitializeCommandsDictionary()
 
     g_CommandsList["!syscall"]  = {&CommandSyscallAndSysret, &CommandSyscallHelp, DEBUGGER_COMMAND_SYSCALL_ATTRIBUTES};
     g_CommandsList["!syscall2"] = {&CommandSyscallAndSysret, &CommandSyscallHelp, DEBUGGER_COMMAND_SYSCALL_ATTRIBUTES};
+    g_CommandsList["!syscall3"] = {&CommandSyscallAndSysret, &CommandSyscallHelp, DEBUGGER_COMMAND_SYSCALL_ATTRIBUTES};
 
     g_CommandsList["!sysret"]  = {&CommandSyscallAndSysret, &CommandSysretHelp, DEBUGGER_COMMAND_SYSRET_ATTRIBUTES};
     g_CommandsList["!sysret2"] = {&CommandSyscallAndSysret, &CommandSysretHelp, DEBUGGER_COMMAND_SYSRET_ATTRIBUTES};
@@ -1603,6 +1963,8 @@ InitializeCommandsDictionary()
 
     g_CommandsList[".pe"] = {&CommandPe, &CommandPeHelp, DEBUGGER_COMMAND_PE_ATTRIBUTES};
 
+    g_CommandsList[".evtrace"] = {&CommandEvtrace, &CommandEvtraceHelp, DEBUGGER_COMMAND_EVTRACE_ATTRIBUTES};
+
     g_CommandsList["!rev"] = {&CommandRev, &CommandRevHelp, DEBUGGER_COMMAND_REV_ATTRIBUTES};
     g_CommandsList["rev"]  = {&CommandRev, &CommandRevHelp, DEBUGGER_COMMAND_REV_ATTRIBUTES};
 
@@ -1631,6 +1993,14 @@ InitializeCommandsDictionary()
 
     g_CommandsList["!smi"] = {&CommandSmi, &CommandSmiHelp, DEBUGGER_COMMAND_SMI_ATTRIBUTES};
 
+    g_CommandsList["!tscoffset"] = {&CommandTscoffset, &CommandTscoffsetHelp, DEBUGGER_COMMAND_TSCOFFSET_ATTRIBUTES};
+
+    g_CommandsList["!profile"] = {&CommandProfile, &CommandProfileHelp, DEBUGGER_COMMAND_PROFILE_ATTRIBUTES};
+
+    g_CommandsList["!pt"] = {&CommandPt, &CommandPtHelp, DEBUGGER_COMMAND_PT_ATTRIBUTES};
+
+    g_CommandsList["!lbr"] = {&CommandLbr, &CommandLbrHelp, DEBUGGER_COMMAND_LBR_ATTRIBUTES};
+
     //
     // hwdbg commands
     //
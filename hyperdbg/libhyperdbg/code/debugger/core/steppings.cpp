@@ -71,6 +71,30 @@ SteppingInstrumentationStepInForTracking()
     return KdSendStepPacketToDebuggee(RequestFormat);
 }
 
+/**
+ * @brief Perform a counted Instrumentation Step-in that is traced by the debuggee
+ *
+ * @param Count Number of steps
+ * @param NumberOfRegisters Number of the traced registers
+ * @param RegisterIds Indexes of the traced registers in GUEST_REGS
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SteppingInstrumentationStepInTrace(UINT32 Count, UINT8 NumberOfRegisters, const UINT8 * RegisterIds)
+{
+    //
+    // Check if we're in VMI mode
+    //
+    if (g_ActiveProcessDebuggingState.IsActive)
+    {
+        ShowMessages("the instrumentation step-in is only supported in Debugger Mode\n");
+        return FALSE;
+    }
+
+    return KdSendStepTracePacketToDebuggee(Count, NumberOfRegisters, RegisterIds);
+}
+
 /**
  * @brief Perform Regular Step-in
  *
@@ -0,0 +1,297 @@
+/**
+ * @file kd-cache.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Serving the reads of the halted debuggee from the cache
+ * @details The memory and the registers that are read from the debuggee (or
+ * prefetched in the pause packet) are kept until the debugger sends a request
+ * that might change the state of the debuggee (continue, step, write, etc.)
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern KD_CACHE                         g_KdCache;
+extern std::map<std::string, REGS_ENUM> RegistersMap;
+
+/**
+ * @brief Invalidate the cache if a request might change the state of the debuggee
+ *
+ * @param RequestedAction
+ *
+ * @return VOID
+ */
+VOID
+KdCacheInvalidateBeforeRequest(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction)
+{
+    if (!KdCacheIsReadOnlyRequest(RequestedAction))
+    {
+        KdCacheInvalidate(&g_KdCache);
+    }
+}
+
+/**
+ * @brief Fill the cache from a new pause packet
+ * @details The state of the previous pause is invalidated
+ *
+ * @param PausePacket
+ * @param PausePacketLength Length of the pause packet and its prefetched state
+ *
+ * @return VOID
+ */
+VOID
+KdCacheLoadPausePacket(PDEBUGGEE_KD_PAUSED_PACKET PausePacket, UINT32 PausePacketLength)
+{
+    KdCacheInvalidate(&g_KdCache);
+
+    if (PausePacket->PrefetchSize == 0 ||
+        PausePacketLength < sizeof(DEBUGGEE_KD_PAUSED_PACKET) ||
+        PausePacket->PrefetchSize > PausePacketLength - sizeof(DEBUGGEE_KD_PAUSED_PACKET))
+    {
+        return;
+    }
+
+    if (!KdCacheLoadPausePrefetch(&g_KdCache,
+                                  (PDEBUGGEE_KD_PAUSED_PREFETCH)((CHAR *)PausePacket + sizeof(DEBUGGEE_KD_PAUSED_PACKET)),
+                                  PausePacket->PrefetchSize))
+    {
+        //
+        // Nothing should be used from a malformed prefetch
+        //
+        KdCacheInvalidate(&g_KdCache);
+    }
+}
+
+/**
+ * @brief Read the memory from the cache
+ *
+ * @param ReadMem
+ *
+ * @return BOOLEAN TRUE if the entire request is served from the cache
+ */
+BOOLEAN
+KdCacheReadMemoryFromCache(PDEBUGGER_READ_MEMORY ReadMem)
+{
+    DEBUGGER_READ_MEMORY_ADDRESS_MODE AddressMode = DEBUGGER_READ_ADDRESS_MODE_64_BIT;
+
+    if (ReadMem->GetAddressMode && !KdCacheGetAddressMode(&g_KdCache, ReadMem->Address, &AddressMode))
+    {
+        return FALSE;
+    }
+
+    if (!KdCacheReadMemory(&g_KdCache,
+                           ReadMem->MemoryType,
+                           ReadMem->Address,
+                           (BYTE *)ReadMem + sizeof(DEBUGGER_READ_MEMORY),
+                           ReadMem->Size))
+    {
+        return FALSE;
+    }
+
+    if (ReadMem->GetAddressMode)
+    {
+        ReadMem->AddressMode = AddressMode;
+    }
+
+    ReadMem->ReturnLength = ReadMem->Size;
+    ReadMem->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+    return TRUE;
+}
+
+/**
+ * @brief Keep the result of a read memory request in the cache
+ *
+ * @param ReadMem
+ *
+ * @return VOID
+ */
+VOID
+KdCacheInsertReadMemory(PDEBUGGER_READ_MEMORY ReadMem)
+{
+    if (ReadMem->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        return;
+    }
+
+    KdCacheInsertMemory(&g_KdCache,
+                        ReadMem->MemoryType,
+                        ReadMem->Address,
+                        (BYTE *)ReadMem + sizeof(DEBUGGER_READ_MEMORY),
+                        ReadMem->ReturnLength);
+
+    if (ReadMem->GetAddressMode)
+    {
+        KdCacheSetAddressMode(&g_KdCache, ReadMem->Address, ReadMem->AddressMode);
+    }
+}
+
+/**
+ * @brief Read memory of the halted debuggee through the cache
+ * @details On a miss, the entire pages of the request are read (if they're
+ * not too many), so the later reads of the same pages are served locally
+ *
+ * @param ReadMem
+ * @param RequestSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdCacheReadMemoryOrSendPacket(PDEBUGGER_READ_MEMORY ReadMem, UINT32 RequestSize)
+{
+    UINT64                FillAddress;
+    UINT32                FillSize;
+    PDEBUGGER_READ_MEMORY FillReadMem;
+
+    if (KdCacheReadMemoryFromCache(ReadMem))
+    {
+        return TRUE;
+    }
+
+    if (g_KdCache.IsEnabled && KdCacheGetFillRange(ReadMem->Address, ReadMem->Size, &FillAddress, &FillSize))
+    {
+        FillReadMem = (PDEBUGGER_READ_MEMORY)malloc(sizeof(DEBUGGER_READ_MEMORY) + FillSize);
+
+        if (FillReadMem != NULL)
+        {
+            ZeroMemory(FillReadMem, sizeof(DEBUGGER_READ_MEMORY) + FillSize);
+
+            memcpy(FillReadMem, ReadMem, sizeof(DEBUGGER_READ_MEMORY));
+
+            FillReadMem->Address = FillAddress;
+            FillReadMem->Size    = FillSize;
+
+            if (KdSendReadMemoryPacketToDebuggee(FillReadMem, sizeof(DEBUGGER_READ_MEMORY) + FillSize))
+            {
+                KdCacheInsertMemory(&g_KdCache,
+                                    FillReadMem->MemoryType,
+                                    FillAddress,
+                                    (BYTE *)FillReadMem + sizeof(DEBUGGER_READ_MEMORY),
+                                    FillReadMem->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL ? FillReadMem->ReturnLength : 0);
+
+                //
+                // The address mode is the same for the entire pages of the request
+                //
+                if (FillReadMem->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL && FillReadMem->GetAddressMode)
+                {
+                    KdCacheSetAddressMode(&g_KdCache, ReadMem->Address, FillReadMem->AddressMode);
+                }
+            }
+
+            free(FillReadMem);
+
+            if (KdCacheReadMemoryFromCache(ReadMem))
+            {
+                return TRUE;
+            }
+        }
+    }
+
+    //
+    // The request is too large or some of its pages are not available, so
+    // it's sent as it is
+    //
+    if (!KdSendReadMemoryPacketToDebuggee(ReadMem, RequestSize))
+    {
+        return FALSE;
+    }
+
+    KdCacheInsertReadMemory(ReadMem);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read registers of the halted debuggee through the cache
+ *
+ * @param RegDes
+ * @param RegBuffSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdCacheReadRegistersOrSendPacket(PDEBUGGEE_REGISTER_READ_DESCRIPTION RegDes, UINT32 RegBuffSize)
+{
+    GUEST_REGS *            Regs      = (GUEST_REGS *)((CHAR *)RegDes + sizeof(DEBUGGEE_REGISTER_READ_DESCRIPTION));
+    GUEST_EXTRA_REGISTERS * ExtraRegs = (GUEST_EXTRA_REGISTERS *)((CHAR *)Regs + sizeof(GUEST_REGS));
+    BOOLEAN                 IsAllRegisters;
+
+    IsAllRegisters = RegDes->RegisterId == DEBUGGEE_SHOW_ALL_REGISTERS &&
+                     RegBuffSize >= sizeof(DEBUGGEE_REGISTER_READ_DESCRIPTION) + sizeof(GUEST_REGS) + sizeof(GUEST_EXTRA_REGISTERS);
+
+    if (IsAllRegisters ? KdCacheGetRegisters(&g_KdCache, Regs, ExtraRegs) : KdCacheGetRegister(&g_KdCache, RegDes->RegisterId, &RegDes->Value))
+    {
+        RegDes->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+        return TRUE;
+    }
+
+    if (!KdSendReadRegisterPacketToDebuggee(RegDes, RegBuffSize))
+    {
+        return FALSE;
+    }
+
+    //
+    // Keep all of the registers for the later reads
+    //
+    if (IsAllRegisters && RegDes->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        KdCacheSetRegisters(&g_KdCache, Regs, ExtraRegs);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Evaluate an expression that is only a register (e.g., '@rsp') from the cache
+ * @details Other expressions are sent to the debuggee to be evaluated there
+ *
+ * @param Expr
+ * @param Value
+ *
+ * @return BOOLEAN TRUE if the expression is evaluated from the cache
+ */
+BOOLEAN
+KdCacheTryEvalRegisterExpression(const string & Expr, UINT64 * Value)
+{
+    string RegisterName = Expr;
+
+    Trim(RegisterName);
+
+    if (RegisterName.size() < 2 || RegisterName[0] != '@')
+    {
+        return FALSE;
+    }
+
+    RegisterName.erase(0, 1);
+
+    std::transform(RegisterName.begin(), RegisterName.end(), RegisterName.begin(), ::tolower);
+
+    auto Register = RegistersMap.find(RegisterName);
+
+    if (Register == RegistersMap.end())
+    {
+        return FALSE;
+    }
+
+    return KdCacheGetRegister(&g_KdCache, Register->second, Value);
+}
+
+/**
+ * @brief Show the statistics of the cache
+ *
+ * @return VOID
+ */
+VOID
+KdCacheShowStatistics()
+{
+    ShowMessages("cache of the halted debuggee is %s (hits: %lld, misses: %lld, invalidations: %lld)\n",
+                 g_KdCache.IsEnabled ? "enabled" : "disabled",
+                 g_KdCache.NumberOfHits,
+                 g_KdCache.NumberOfMisses,
+                 g_KdCache.NumberOfInvalidations);
+}
@@ -490,11 +490,12 @@ KdSendTestQueryPacketWithContextToDebuggee(DEBUGGER_TEST_QUERY_STATE Type, UINT6
  * @return BOOLEAN
  */
 BOOLEAN
-KdSendSymbolReloadPacketToDebuggee(UINT32 ProcessId)
+KdSendSymbolReloadPacketToDebuggee(UINT32 ProcessId, UINT64 SymbolTableDigest)
 {
     DEBUGGEE_SYMBOL_REQUEST_PACKET SymbolRequest = {0};
 
-    SymbolRequest.ProcessId = ProcessId;
+    SymbolRequest.ProcessId         = ProcessId;
+    SymbolRequest.SymbolTableDigest = SymbolTableDigest;
 
     //
     // Send '.sym reload' as symbol reload packet
@@ -1383,6 +1384,198 @@ KdSendStepPacketToDebuggee(DEBUGGER_REMOTE_STEPPING_REQUEST StepRequestType)
     return TRUE;
 }
 
+/**
+ * @brief Sends a counted step trace (i command with the 'trace' keyword)
+ * packet to the debuggee
+ *
+ * @param Count Number of steps
+ * @param NumberOfRegisters Number of the traced registers
+ * @param RegisterIds Indexes of the traced registers in GUEST_REGS
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendStepTracePacketToDebuggee(UINT32 Count, UINT8 NumberOfRegisters, const UINT8 * RegisterIds)
+{
+    DEBUGGEE_STEP_PACKET StepPacket = {0};
+
+    //
+    // Set the type of step packet and the traced registers
+    //
+    StepPacket.StepType          = DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_COUNTED_TRACE;
+    StepPacket.Count             = Count;
+    StepPacket.NumberOfRegisters = NumberOfRegisters;
+
+    memcpy(StepPacket.RegisterIds, RegisterIds, NumberOfRegisters * sizeof(UINT8));
+
+    //
+    // Send step packet to the serial
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_STEP,
+            (CHAR *)&StepPacket,
+            sizeof(DEBUGGEE_STEP_PACKET)))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the debuggee is paused after the last step
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_IS_DEBUGGER_RUNNING);
+
+    return TRUE;
+}
+
+/**
+ * @brief Sends a request for reading a chunk of the step trace to the debuggee
+ *
+ * @param ReadPacket The read packet followed by a buffer for the chunk
+ * @param ExpectedSize Size of the read packet and the buffer of the chunk
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendReadStepTracePacketToDebuggee(PDEBUGGEE_STEP_TRACE_READ_PACKET ReadPacket, UINT32 ExpectedSize)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_STEP_TRACE_RESULT, ReadPacket, ExpectedSize);
+
+    //
+    // Send the read step trace packet
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_STEP_TRACE,
+            (CHAR *)ReadPacket,
+            SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the chunk of the step trace is received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_STEP_TRACE_RESULT);
+
+    return TRUE;
+}
+
+/**
+ * @brief Sends a bulk read memory packet to the debuggee
+ *
+ * @param BulkReadMem The request followed by a buffer for the pages
+ * @param RequestSize Size of the request and the buffer of the pages
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendBulkReadMemoryPacketToDebuggee(PDEBUGGER_BULK_READ_MEMORY BulkReadMem, UINT32 RequestSize)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_BULK_READ_MEMORY, BulkReadMem, RequestSize);
+
+    //
+    // Send the bulk read memory packet
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_BULK_READ_MEMORY,
+            (CHAR *)BulkReadMem,
+            SIZEOF_DEBUGGER_BULK_READ_MEMORY // only the header is enough, no need to send the entire buffer
+            ))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the pages are received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_BULK_READ_MEMORY);
+
+    return TRUE;
+}
+
+/**
+ * @brief Sends the options of prefetching the state of the halted core
+ * to the debuggee
+ *
+ * @param PausePrefetchOptions
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendPausePrefetchOptionsPacketToDebuggee(PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET PausePrefetchOptions)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PAUSE_PREFETCH,
+                                PausePrefetchOptions,
+                                sizeof(DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET));
+
+    //
+    // Send the pause prefetch options packet
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SET_PAUSE_PREFETCH,
+            (CHAR *)PausePrefetchOptions,
+            sizeof(DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET)))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the result of setting the options is received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PAUSE_PREFETCH);
+
+    return TRUE;
+}
+
+/**
+ * @brief Send requests for TSC offsetting operation packet to the debuggee
+ *
+ * @param TscOffsettingRequest
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendTscOffsettingPacketsToDebuggee(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest)
+{
+    //
+    // Set the request data
+    //
+    DbgWaitSetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_TSC_OFFSETTING_RESULT,
+                                TscOffsettingRequest,
+                                SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS);
+
+    //
+    // Send the TSC offsetting request packets
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_PERFORM_TSC_OFFSETTING_OPERATION,
+            (CHAR *)TscOffsettingRequest,
+            SIZEOF_TSC_OFFSETTING_OPERATION_PACKETS))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the result of the TSC offsetting operation is received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_TSC_OFFSETTING_RESULT);
+
+    return TRUE;
+}
+
 /**
  * @brief Sends a PAUSE packet to the debuggee
  *
@@ -1817,6 +2010,12 @@ KdCommandPacketToDebuggee(
     // sizeof(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION) + sizeof(DEBUGGER_REMOTE_PACKET)
     //
 
+    //
+    // The cached state of the halted debuggee is not valid anymore if
+    // this request might change it
+    //
+    KdCacheInvalidateBeforeRequest(RequestedAction);
+
     //
     // Make the packet's structure
     //
@@ -1875,6 +2074,12 @@ KdCommandPacketAndBufferToDebuggee(
         return FALSE;
     }
 
+    //
+    // The cached state of the halted debuggee is not valid anymore if
+    // this request might change it
+    //
+    KdCacheInvalidateBeforeRequest(RequestedAction);
+
     //
     // Make the packet's structure
     //
@@ -2675,7 +2880,7 @@ KdPrepareAndConnectDebugPort(const CHAR * PortName,
             //
             // Do not pause debugger after finish
             //
-            KdReloadSymbolsInDebuggee(FALSE, GetCurrentProcessId());
+            KdReloadSymbolsInDebuggee(FALSE, GetCurrentProcessId(), SYMBOL_SYNC_DIGEST_UNKNOWN);
         }
         else
         {
@@ -2894,11 +3099,12 @@ KdSendGeneralBuffersFromDebuggeeToDebugger(
  * the debugger
  * @param PauseDebuggee
  * @param UserProcessId
+ * @param DebuggerSymbolTableDigest Digest of the debugger's symbol table
  *
  * @return BOOLEAN
  */
 BOOLEAN
-KdReloadSymbolsInDebuggee(BOOLEAN PauseDebuggee, UINT32 UserProcessId)
+KdReloadSymbolsInDebuggee(BOOLEAN PauseDebuggee, UINT32 UserProcessId, UINT64 DebuggerSymbolTableDigest)
 {
     DEBUGGEE_SYMBOL_UPDATE_RESULT SymReload = {0};
 
@@ -2914,7 +3120,7 @@ KdReloadSymbolsInDebuggee(BOOLEAN PauseDebuggee, UINT32 UserProcessId)
     //
     // Request debuggee to send new symbol packets
     //
-    SymbolPrepareDebuggerWithSymbolInfo(UserProcessId);
+    SymbolPrepareDebuggerWithSymbolInfo(UserProcessId, DebuggerSymbolTableDigest);
 
     //
     // Set the status
@@ -3299,54 +3505,33 @@ KdSendUsermodePrints(CHAR * Input, UINT32 Length)
 }
 
 /**
- * @brief Send each packet of debugging information (PDB) to the debugger
- * @param SymbolDetailPacket
- * @param CurrentSymbolInfoIndex
- * @param TotalSymbols
+ * @brief Send each batch of the symbol table (debugging information) to the debugger
+ * @details This function is used as the callback of the symbol synchronization
+ * @param Batch
+ * @param BatchLength
+ * @param Context
  *
- * @return VOID
+ * @return BOOLEAN
  */
-VOID
-KdSendSymbolDetailPacket(PMODULE_SYMBOL_DETAIL SymbolDetailPacket, UINT32 CurrentSymbolInfoIndex, UINT32 TotalSymbols)
+BOOLEAN
+KdSendSymbolTableBatchPacket(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch, UINT32 BatchLength, PVOID Context)
 {
-    BOOLEAN                       Result;
-    PDEBUGGER_UPDATE_SYMBOL_TABLE UsermodeSymDetailRequest;
-
-    UsermodeSymDetailRequest =
-        (DEBUGGER_UPDATE_SYMBOL_TABLE *)malloc(sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE));
-
-    RtlZeroMemory(UsermodeSymDetailRequest, sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE));
-
-    //
-    // Set other parameters for the symbol details
-    //
-    UsermodeSymDetailRequest->CurrentSymbolIndex = CurrentSymbolInfoIndex;
-    UsermodeSymDetailRequest->TotalSymbols       = TotalSymbols;
-
-    //
-    // Move the user message buffer at the bottom of the structure packet
-    //
-    memcpy((PVOID)((UINT64)&UsermodeSymDetailRequest->SymbolDetailPacket),
-           (PVOID)SymbolDetailPacket,
-           sizeof(MODULE_SYMBOL_DETAIL));
+    UNREFERENCED_PARAMETER(Context);
 
     //
     // Send the symbol update buffer to the debugger
     //
-    Result = KdSendGeneralBuffersFromDebuggeeToDebugger(
-        DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_UPDATE_SYMBOL_INFO,
-        UsermodeSymDetailRequest,
-        sizeof(DEBUGGER_UPDATE_SYMBOL_TABLE),
-        FALSE);
-
-    if (!Result)
+    if (!KdSendGeneralBuffersFromDebuggeeToDebugger(
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_UPDATE_SYMBOL_INFO_BATCH,
+            Batch,
+            BatchLength,
+            FALSE))
     {
         ShowMessages("err, sending symbol packets failed in debuggee");
-        free(UsermodeSymDetailRequest);
-        return;
+        return FALSE;
     }
 
-    free(UsermodeSymDetailRequest);
+    return TRUE;
 }
 
 /**
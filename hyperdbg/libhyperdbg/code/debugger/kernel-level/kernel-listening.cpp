@@ -51,7 +51,7 @@ ListeningSerialPortInDebugger()
     PDEBUGGEE_SCRIPT_PACKET                      ScriptPacket;
     PDEBUGGEE_FORMATS_PACKET                     FormatsPacket;
     PDEBUGGER_EVENT_AND_ACTION_RESULT            EventAndActionPacket;
-    PDEBUGGER_UPDATE_SYMBOL_TABLE                SymbolUpdatePacket;
+    PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH          SymbolUpdateBatchPacket;
     PDEBUGGER_MODIFY_EVENTS                      EventModifyAndQueryPacket;
     PDEBUGGEE_SYMBOL_UPDATE_RESULT               SymbolReloadFinishedPacket;
     PDEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET  ChangeProcessPacket;
@@ -70,6 +70,8 @@ ListeningSerialPortInDebugger()
     PDEBUGGER_SHORT_CIRCUITING_EVENT             ShortCircuitingPacket;
     PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS    PtePacket;
     PSMI_OPERATION_PACKETS                       SmiOperationPacket;
+    PDEBUGGEE_STEP_TRACE_READ_PACKET             StepTraceReadPacket;
+    PDEBUGGER_BULK_READ_MEMORY                   BulkReadMemoryPacket;
     PDEBUGGER_PAGE_IN_REQUEST                    PageinPacket;
     PDEBUGGER_VA2PA_AND_PA2VA_COMMANDS           Va2paPa2vaPacket;
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET           ListOrModifyBreakpointPacket;
@@ -79,6 +81,8 @@ ListeningSerialPortInDebugger()
     PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET    PcitreePacket;
     PINTERRUPT_DESCRIPTOR_TABLE_ENTRIES_PACKETS  IdtEntryRequestPacket;
     PDEBUGGEE_PCIDEVINFO_REQUEST_RESPONSE_PACKET PcidevinfoPacket;
+    PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET      PausePrefetchOptionsPacket;
+    PTSC_OFFSETTING_OPERATION_PACKETS            TscOffsettingPacket;
 
 StartAgain:
 
@@ -244,6 +248,12 @@ StartAgain:
 
             g_IsRunningInstruction32Bit = PausePacket->IsProcessorOn32BitMode;
 
+            //
+            // The cached state of the previous pause is not valid anymore, the
+            // prefetched state of this pause (if any) is cached instead
+            //
+            KdCacheLoadPausePacket(PausePacket, LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET));
+
             //
             // Show additional messages before showing assembly and pausing
             //
@@ -1006,6 +1016,90 @@ StartAgain:
 
             break;
 
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_READING_STEP_TRACE:
+
+            StepTraceReadPacket = (DEBUGGEE_STEP_TRACE_READ_PACKET *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_STEP_TRACE_RESULT, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the packet and the chunk of the trace for the caller
+            //
+            memcpy(CallerAddress, StepTraceReadPacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of reading the step trace
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_STEP_TRACE_RESULT);
+
+            break;
+
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_BULK_READING_MEMORY:
+
+            BulkReadMemoryPacket = (DEBUGGER_BULK_READ_MEMORY *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_BULK_READ_MEMORY, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the header and the pages for the caller
+            //
+            memcpy(CallerAddress, BulkReadMemoryPacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of reading memory
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_BULK_READ_MEMORY);
+
+            break;
+
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_TSC_OFFSETTING_OPERATION:
+
+            TscOffsettingPacket = (TSC_OFFSETTING_OPERATION_PACKETS *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_TSC_OFFSETTING_RESULT, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the memory buffer for the caller
+            //
+            memcpy(CallerAddress, TscOffsettingPacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of TSC offsetting operation
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_TSC_OFFSETTING_RESULT);
+
+            break;
+
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SET_PAUSE_PREFETCH:
+
+            PausePrefetchOptionsPacket = (DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Get the address and size of the caller
+            //
+            DbgWaitGetKernelRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PAUSE_PREFETCH, &CallerAddress, &CallerSize);
+
+            //
+            // Copy the result (the kernel status) for the caller
+            //
+            memcpy(CallerAddress, PausePrefetchOptionsPacket, CallerSize);
+
+            //
+            // Signal the event relating to receiving result of setting the options
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PAUSE_PREFETCH);
+
+            break;
+
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_BRINGING_PAGES_IN:
 
             PageinPacket = (DEBUGGER_PAGE_IN_REQUEST *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
@@ -1080,13 +1174,15 @@ StartAgain:
 
             break;
 
-        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_UPDATE_SYMBOL_INFO:
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_UPDATE_SYMBOL_INFO_BATCH:
+
+            SymbolUpdateBatchPacket = (DEBUGGER_UPDATE_SYMBOL_TABLE_BATCH *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
 
-            SymbolUpdatePacket = (DEBUGGER_UPDATE_SYMBOL_TABLE *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
             //
-            // Perform updates for the symbol table
+            // Apply the added or removed modules to the symbol table
             //
-            SymbolBuildAndUpdateSymbolTable(&SymbolUpdatePacket->SymbolDetailPacket);
+            SymbolUpdateSymbolTableFromBatch(SymbolUpdateBatchPacket,
+                                             LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET));
 
             break;
 
@@ -1102,19 +1198,17 @@ StartAgain:
                 ShowMessages("%-12s | %-9s | %-17s | %s \n%s\n", "DBDF", "VID:DID", "Vendor Name", "Device Name", "----------------------------------------------------------------------");
                 for (UINT8 i = 0; i < (PcitreePacket->DeviceInfoListNum < DEV_MAX_NUM ? PcitreePacket->DeviceInfoListNum : DEV_MAX_NUM); i++)
                 {
-                    Vendor * CurrentVendor     = GetVendorById(PcitreePacket->DeviceInfoList[i].ConfigSpace.VendorId);
-                    char *   CurrentVendorName = (char *)"N/A";
-                    char *   CurrentDeviceName = (char *)"N/A";
+                    const char * CurrentVendorName = PciIdGetVendorName(PcitreePacket->DeviceInfoList[i].ConfigSpace.VendorId);
+                    const char * CurrentDeviceName = PciIdGetDeviceName(PcitreePacket->DeviceInfoList[i].ConfigSpace.VendorId, PcitreePacket->DeviceInfoList[i].ConfigSpace.DeviceId);
 
-                    if (CurrentVendor != NULL)
+                    if (CurrentVendorName == NULL)
                     {
-                        CurrentVendorName      = CurrentVendor->VendorName;
-                        Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcitreePacket->DeviceInfoList[i].ConfigSpace.DeviceId);
+                        CurrentVendorName = "N/A";
+                    }
 
-                        if (CurrentDevice != NULL)
-                        {
-                            CurrentDeviceName = CurrentDevice->DeviceName;
-                        }
+                    if (CurrentDeviceName == NULL)
+                    {
+                        CurrentDeviceName = "N/A";
                     }
 
                     ShowMessages("%04x:%02x:%02x:%x | %04x:%04x | %-17.*s | %.*s\n",
@@ -1130,8 +1224,6 @@ StartAgain:
                                  CurrentDeviceName
 
                     );
-
-                    FreeVendor(CurrentVendor);
                 }
                 FreePciIdDatabase();
             }
@@ -1169,19 +1261,17 @@ StartAgain:
 
                 if (!PcidevinfoPacket->PrintRaw)
                 {
-                    Vendor * CurrentVendor     = GetVendorById(PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId);
-                    CHAR *   CurrentVendorName = (CHAR *)"N/A";
-                    CHAR *   CurrentDeviceName = (CHAR *)"N/A";
+                    const char * CurrentVendorName = PciIdGetVendorName(PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId);
+                    const char * CurrentDeviceName = PciIdGetDeviceName(PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId, PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.DeviceId);
 
-                    if (CurrentVendor != NULL)
+                    if (CurrentVendorName == NULL)
                     {
-                        CurrentVendorName      = CurrentVendor->VendorName;
-                        Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.DeviceId);
+                        CurrentVendorName = "N/A";
+                    }
 
-                        if (CurrentDevice != NULL)
-                        {
-                            CurrentDeviceName = CurrentDevice->DeviceName;
-                        }
+                    if (CurrentDeviceName == NULL)
+                    {
+                        CurrentDeviceName = "N/A";
                     }
 
                     ShowMessages("\nCommon Header:\nVID:DID: %04x:%04x\nVendor Name: %-17.*s\nDevice Name: %.*s\nCommand: %04x\n",
@@ -1210,7 +1300,6 @@ StartAgain:
                                  PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.HeaderType,
                                  (PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.HeaderType & 0x1) ? "True" : "False",
                                  PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.Bist);
-                    FreeVendor(CurrentVendor);
                     FreePciIdDatabase();
 
                     ShowMessages("\nDevice Header:\n");
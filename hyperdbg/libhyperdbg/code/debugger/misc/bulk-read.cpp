@@ -0,0 +1,308 @@
+/**
+ * @file bulk-read.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Reading large ranges of memory with bulk read requests
+ * @details Each request returns up to 64 pages (16 pages in the Debugger
+ * Mode). In VMI Mode, a few requests are in flight at the same time (each
+ * of them on its own thread, so the driver reads them in parallel), and
+ * the result is written to the file through a large buffer
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+extern HANDLE  g_DeviceHandle;
+
+/**
+ * @brief State of the requests in flight and of the file writer
+ *
+ */
+typedef struct _BULK_READ_FILE_CONTEXT
+{
+    HANDLE          FileHandle;
+    UINT8 *         WriteBuffer;
+    UINT32          WriteBufferUsed;
+    future<BOOLEAN> Results[BULK_READ_NUMBER_OF_REQUESTS_IN_FLIGHT];
+
+} BULK_READ_FILE_CONTEXT, *PBULK_READ_FILE_CONTEXT;
+
+/**
+ * @brief Read many pages of memory at once
+ * @details the pages that are not available are zeroed and not set
+ * in the bitmap of the valid pages of the request
+ *
+ * @param Request The request followed by a buffer for the pages
+ * @param RequestBufferSize Size of the request and the buffer of the pages
+ *
+ * @return BOOLEAN TRUE if the request is sent and received
+ */
+BOOLEAN
+HyperDbgBulkReadMemory(PDEBUGGER_BULK_READ_MEMORY Request, UINT32 RequestBufferSize)
+{
+    BOOL       Status;
+    ULONG      ReturnedLength = 0;
+    OVERLAPPED Overlapped     = {0};
+
+    //
+    // Check if this is used for Debugger Mode or VMI mode
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // It's on Debugger mode
+        //
+        return KdSendBulkReadMemoryPacketToDebuggee(Request, RequestBufferSize);
+    }
+
+    //
+    // It's on VMI mode
+    //
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    //
+    // The handle of the device is opened for overlapped I/O and this function
+    // is called from more than one thread, so each call needs its own event
+    //
+    Overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+
+    if (Overlapped.hEvent == NULL)
+    {
+        return FALSE;
+    }
+
+    Status = DeviceIoControl(g_DeviceHandle,                   // Handle to device
+                             IOCTL_DEBUGGER_BULK_READ_MEMORY,  // IO Control Code (IOCTL)
+                             Request,                          // Input Buffer to driver.
+                             SIZEOF_DEBUGGER_BULK_READ_MEMORY, // Input buffer length
+                             Request,                          // Output Buffer from driver.
+                             RequestBufferSize,                // Length of output buffer in bytes.
+                             &ReturnedLength,                  // Bytes placed in buffer.
+                             &Overlapped                       // overlapped call
+    );
+
+    if (!Status && GetLastError() == ERROR_IO_PENDING)
+    {
+        Status = GetOverlappedResult(g_DeviceHandle, &Overlapped, &ReturnedLength, TRUE);
+    }
+
+    CloseHandle(Overlapped.hEvent);
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Send a request of the pipeline
+ *
+ * @param Slot
+ * @param Request
+ * @param RequestBufferSize
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BulkReadSubmitRequest(UINT32 Slot, PDEBUGGER_BULK_READ_MEMORY Request, UINT32 RequestBufferSize, PVOID Context)
+{
+    PBULK_READ_FILE_CONTEXT FileContext = (PBULK_READ_FILE_CONTEXT)Context;
+
+    //
+    // The debuggee handles a single request at a time, so in the Debugger Mode,
+    // the pipeline has one slot and the request is sent once it's waited for
+    //
+    FileContext->Results[Slot] = async(g_IsSerialConnectedToRemoteDebuggee ? launch::deferred : launch::async,
+                                       HyperDbgBulkReadMemory,
+                                       Request,
+                                       RequestBufferSize);
+
+    return TRUE;
+}
+
+/**
+ * @brief Wait for a request of the pipeline
+ *
+ * @param Slot
+ * @param Request
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BulkReadCompleteRequest(UINT32 Slot, PDEBUGGER_BULK_READ_MEMORY Request, PVOID Context)
+{
+    PBULK_READ_FILE_CONTEXT FileContext = (PBULK_READ_FILE_CONTEXT)Context;
+
+    UNREFERENCED_PARAMETER(Request);
+
+    return FileContext->Results[Slot].get();
+}
+
+/**
+ * @brief Write the buffer of the file writer into the file
+ *
+ * @param FileContext
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BulkReadFlushFileWriter(PBULK_READ_FILE_CONTEXT FileContext)
+{
+    DWORD BytesWritten;
+
+    if (FileContext->WriteBufferUsed == 0)
+    {
+        return TRUE;
+    }
+
+    if (!WriteFile(FileContext->FileHandle, FileContext->WriteBuffer, FileContext->WriteBufferUsed, &BytesWritten, NULL) ||
+        BytesWritten != FileContext->WriteBufferUsed)
+    {
+        ShowMessages("err, unable to write buffer into the dump\n");
+        return FALSE;
+    }
+
+    FileContext->WriteBufferUsed = 0;
+
+    return TRUE;
+}
+
+/**
+ * @brief Receive the memory of the pipeline (in order) into the file writer
+ *
+ * @param Buffer
+ * @param Length
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BulkReadWriteIntoFile(const VOID * Buffer, UINT32 Length, PVOID Context)
+{
+    PBULK_READ_FILE_CONTEXT FileContext = (PBULK_READ_FILE_CONTEXT)Context;
+    const UINT8 *           Source      = (const UINT8 *)Buffer;
+    UINT32                  CopySize;
+
+    while (Length != 0)
+    {
+        CopySize = BULK_READ_FILE_WRITER_BUFFER_SIZE - FileContext->WriteBufferUsed;
+
+        if (CopySize > Length)
+        {
+            CopySize = Length;
+        }
+
+        memcpy(&FileContext->WriteBuffer[FileContext->WriteBufferUsed], Source, CopySize);
+
+        FileContext->WriteBufferUsed += CopySize;
+        Source += CopySize;
+        Length -= CopySize;
+
+        if (FileContext->WriteBufferUsed == BULK_READ_FILE_WRITER_BUFFER_SIZE && !BulkReadFlushFileWriter(FileContext))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read a range of memory into a file with bulk read requests
+ * @details the pages that are not available are saved as zeros
+ *
+ * @param Address Start address of the range
+ * @param Size Size of the range
+ * @param MemoryType type of memory (phyical or virtual)
+ * @param Pid The target process id
+ * @param FileHandle Handle of the file
+ * @param NumberOfInvalidPages Number of pages that are not available
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BulkReadMemoryIntoFile(UINT64                    Address,
+                       UINT64                    Size,
+                       DEBUGGER_READ_MEMORY_TYPE MemoryType,
+                       UINT32                    Pid,
+                       HANDLE                    FileHandle,
+                       UINT64 *                  NumberOfInvalidPages)
+{
+    BULK_READ_FILE_CONTEXT     FileContext                                   = {0};
+    BULK_READ_PIPELINE         Pipeline                                      = {0};
+    PDEBUGGER_BULK_READ_MEMORY Slots[BULK_READ_NUMBER_OF_REQUESTS_IN_FLIGHT] = {0};
+    BOOLEAN                    Result                                        = FALSE;
+
+    //
+    // In the Debugger Mode, the result of each request should fit in a
+    // single serial packet
+    //
+    Pipeline.Address         = Address;
+    Pipeline.Size            = Size;
+    Pipeline.Pid             = Pid;
+    Pipeline.MemoryType      = MemoryType;
+    Pipeline.PagesPerRequest = g_IsSerialConnectedToRemoteDebuggee ? DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES_OVER_SERIAL : DEBUGGER_BULK_READ_MEMORY_MAXIMUM_PAGES;
+    Pipeline.NumberOfSlots   = g_IsSerialConnectedToRemoteDebuggee ? 1 : BULK_READ_NUMBER_OF_REQUESTS_IN_FLIGHT;
+    Pipeline.Slots           = Slots;
+    Pipeline.Submit          = BulkReadSubmitRequest;
+    Pipeline.Complete        = BulkReadCompleteRequest;
+    Pipeline.Write           = BulkReadWriteIntoFile;
+    Pipeline.Context         = &FileContext;
+
+    FileContext.FileHandle  = FileHandle;
+    FileContext.WriteBuffer = (UINT8 *)malloc(BULK_READ_FILE_WRITER_BUFFER_SIZE);
+
+    if (FileContext.WriteBuffer == NULL)
+    {
+        goto Free;
+    }
+
+    for (UINT32 i = 0; i < Pipeline.NumberOfSlots; i++)
+    {
+        Slots[i] = (PDEBUGGER_BULK_READ_MEMORY)malloc(SIZEOF_DEBUGGER_BULK_READ_MEMORY + (Pipeline.PagesPerRequest * NORMAL_PAGE_SIZE));
+
+        if (Slots[i] == NULL)
+        {
+            goto Free;
+        }
+    }
+
+    Result = BulkReadPipelineRun(&Pipeline);
+
+    if (!Result && Pipeline.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+    {
+        ShowErrorMessage(Pipeline.KernelStatus);
+    }
+
+    //
+    // Write the remaining of the buffer into the file
+    //
+    if (Result)
+    {
+        Result = BulkReadFlushFileWriter(&FileContext);
+    }
+
+    *NumberOfInvalidPages = Pipeline.NumberOfInvalidPages;
+
+Free:
+
+    for (UINT32 i = 0; i < BULK_READ_NUMBER_OF_REQUESTS_IN_FLIGHT; i++)
+    {
+        free(Slots[i]);
+    }
+
+    free(FileContext.WriteBuffer);
+
+    return Result;
+}
@@ -0,0 +1,404 @@
+/**
+ * @file event-trace.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Writing and reading the binary event trace files
+ * @details The blocks that are received from the kernel are appended to a
+ * memory-mapped file, the file grows by remapping it whenever the current
+ * view is full and it's truncated to its data size once it's closed
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// State of the event trace writer, the blocks are appended from the
+// thread that reads the kernel messages
+//
+static std::mutex EventTraceWriterLock;
+static HANDLE     EventTraceWriterFileHandle      = INVALID_HANDLE_VALUE;
+static HANDLE     EventTraceWriterMapObjectHandle = NULL;
+static UINT8 *    EventTraceWriterView            = NULL;
+static UINT64     EventTraceWriterMappedSize      = 0;
+static UINT64     EventTraceWriterReceivedBlocks  = 0;
+static UINT64     EventTraceWriterInvalidBlocks   = 0;
+
+/**
+ * @brief Unmap the current view of the event trace file
+ * @details The lock of the writer should be held by the caller
+ *
+ * @return VOID
+ */
+static VOID
+EventTraceWriterUnmap()
+{
+    if (EventTraceWriterView != NULL)
+    {
+        UnmapViewOfFile(EventTraceWriterView);
+        EventTraceWriterView = NULL;
+    }
+
+    if (EventTraceWriterMapObjectHandle != NULL)
+    {
+        CloseHandle(EventTraceWriterMapObjectHandle);
+        EventTraceWriterMapObjectHandle = NULL;
+    }
+
+    EventTraceWriterMappedSize = 0;
+}
+
+/**
+ * @brief (Re)map the event trace file with the specified size
+ * @details The lock of the writer should be held by the caller, the
+ * file is extended if it's smaller than the specified size
+ *
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EventTraceWriterRemap(UINT64 Size)
+{
+    EventTraceWriterUnmap();
+
+    EventTraceWriterMapObjectHandle = CreateFileMapping(EventTraceWriterFileHandle,
+                                                        NULL,
+                                                        PAGE_READWRITE,
+                                                        (DWORD)(Size >> 32),
+                                                        (DWORD)(Size & 0xffffffff),
+                                                        NULL);
+
+    if (EventTraceWriterMapObjectHandle == NULL)
+    {
+        return FALSE;
+    }
+
+    EventTraceWriterView = (UINT8 *)MapViewOfFile(EventTraceWriterMapObjectHandle, FILE_MAP_WRITE, 0, 0, 0);
+
+    if (EventTraceWriterView == NULL)
+    {
+        EventTraceWriterUnmap();
+        return FALSE;
+    }
+
+    EventTraceWriterMappedSize = Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Create the event trace file and start writing the blocks into it
+ *
+ * @param FilePath
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceWriterOpen(const string & FilePath)
+{
+    std::lock_guard<std::mutex> Lock(EventTraceWriterLock);
+
+    if (EventTraceWriterFileHandle != INVALID_HANDLE_VALUE)
+    {
+        ShowMessages("err, an event trace file is already open\n");
+        return FALSE;
+    }
+
+    EventTraceWriterFileHandle = CreateFileA(FilePath.c_str(),
+                                             GENERIC_READ | GENERIC_WRITE,
+                                             FILE_SHARE_READ,
+                                             NULL,
+                                             CREATE_ALWAYS,
+                                             FILE_ATTRIBUTE_NORMAL,
+                                             NULL);
+
+    if (EventTraceWriterFileHandle == INVALID_HANDLE_VALUE)
+    {
+        ShowMessages("err, unable to create the event trace file (%x)\n", GetLastError());
+        return FALSE;
+    }
+
+    if (!EventTraceWriterRemap(EVENT_TRACE_FILE_GROWTH_SIZE))
+    {
+        ShowMessages("err, unable to map the event trace file (%x)\n", GetLastError());
+
+        CloseHandle(EventTraceWriterFileHandle);
+        EventTraceWriterFileHandle = INVALID_HANDLE_VALUE;
+        return FALSE;
+    }
+
+    EventTraceInitializeFileHeader((PEVENT_TRACE_FILE_HEADER)EventTraceWriterView);
+
+    EventTraceWriterReceivedBlocks = 0;
+    EventTraceWriterInvalidBlocks  = 0;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether an event trace file is open or not
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceWriterIsOpen()
+{
+    std::lock_guard<std::mutex> Lock(EventTraceWriterLock);
+
+    return EventTraceWriterFileHandle != INVALID_HANDLE_VALUE;
+}
+
+/**
+ * @brief Append a block that is received from the kernel to the
+ * event trace file
+ *
+ * @param Buffer
+ * @param BufferLength
+ *
+ * @return VOID
+ */
+VOID
+EventTraceWriterAppendBlock(const VOID * Buffer, UINT32 BufferLength)
+{
+    UINT64 UsedSize    = 0;
+    UINT32 BlockLength = 0;
+
+    std::lock_guard<std::mutex> Lock(EventTraceWriterLock);
+
+    if (EventTraceWriterView == NULL)
+    {
+        //
+        // Blocks of a closed (or not opened) trace are ignored
+        //
+        return;
+    }
+
+    EventTraceWriterReceivedBlocks++;
+
+    if (!EventTraceValidateBlock(Buffer, BufferLength, &BlockLength))
+    {
+        EventTraceWriterInvalidBlocks++;
+        return;
+    }
+
+    UsedSize = sizeof(EVENT_TRACE_FILE_HEADER) + ((PEVENT_TRACE_FILE_HEADER)EventTraceWriterView)->DataSize;
+
+    if (UsedSize + BlockLength > EventTraceWriterMappedSize)
+    {
+        //
+        // The view is full, grow the file
+        //
+        if (!EventTraceWriterRemap(EventTraceWriterMappedSize + EVENT_TRACE_FILE_GROWTH_SIZE))
+        {
+            ShowMessages("err, unable to grow the event trace file (%x)\n", GetLastError());
+
+            //
+            // Keep the previous part of the trace
+            //
+            EventTraceWriterRemap(UsedSize);
+            EventTraceWriterInvalidBlocks++;
+            return;
+        }
+    }
+
+    if (!EventTraceAppendBlock(EventTraceWriterView, EventTraceWriterMappedSize, Buffer, BlockLength))
+    {
+        EventTraceWriterInvalidBlocks++;
+    }
+}
+
+/**
+ * @brief Get the number of blocks that are received since the event
+ * trace file is opened
+ *
+ * @return UINT64
+ */
+UINT64
+EventTraceWriterGetNumberOfReceivedBlocks()
+{
+    std::lock_guard<std::mutex> Lock(EventTraceWriterLock);
+
+    return EventTraceWriterReceivedBlocks;
+}
+
+/**
+ * @brief Finalize and close the event trace file
+ * @details The file is truncated to the end of its last block
+ *
+ * @param FinalHeader The final header of the file
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceWriterClose(PEVENT_TRACE_FILE_HEADER FinalHeader)
+{
+    LARGE_INTEGER EndOfFile;
+    BOOLEAN       Result = TRUE;
+
+    std::lock_guard<std::mutex> Lock(EventTraceWriterLock);
+
+    if (EventTraceWriterFileHandle == INVALID_HANDLE_VALUE)
+    {
+        ShowMessages("err, no event trace file is open\n");
+        return FALSE;
+    }
+
+    if (EventTraceWriterView != NULL)
+    {
+        memcpy(FinalHeader, EventTraceWriterView, sizeof(EVENT_TRACE_FILE_HEADER));
+        FlushViewOfFile(EventTraceWriterView, 0);
+    }
+    else
+    {
+        Result = FALSE;
+        RtlZeroMemory(FinalHeader, sizeof(EVENT_TRACE_FILE_HEADER));
+    }
+
+    EventTraceWriterUnmap();
+
+    if (Result)
+    {
+        EndOfFile.QuadPart = sizeof(EVENT_TRACE_FILE_HEADER) + FinalHeader->DataSize;
+
+        if (!SetFilePointerEx(EventTraceWriterFileHandle, EndOfFile, NULL, FILE_BEGIN) ||
+            !SetEndOfFile(EventTraceWriterFileHandle))
+        {
+            ShowMessages("err, unable to truncate the event trace file (%x)\n", GetLastError());
+            Result = FALSE;
+        }
+    }
+
+    if (EventTraceWriterInvalidBlocks != 0)
+    {
+        ShowMessages("warning, %llu block(s) could not be written into the event trace file\n",
+                     EventTraceWriterInvalidBlocks);
+    }
+
+    CloseHandle(EventTraceWriterFileHandle);
+    EventTraceWriterFileHandle = INVALID_HANDLE_VALUE;
+
+    return Result;
+}
+
+/**
+ * @brief Map an event trace file (read-only) and build the index
+ * of its blocks
+ *
+ * @param FilePath
+ * @param MappedFile
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EventTraceMapFile(const string & FilePath, PEVENT_TRACE_MAPPED_FILE MappedFile)
+{
+    LARGE_INTEGER FileSize;
+    UINT64        NumberOfEntries = 0;
+
+    MappedFile->FileHandle      = INVALID_HANDLE_VALUE;
+    MappedFile->MapObjectHandle = NULL;
+    MappedFile->Buffer          = NULL;
+    MappedFile->FileSize        = 0;
+    MappedFile->Index.clear();
+
+    MappedFile->FileHandle = CreateFileA(FilePath.c_str(),
+                                         GENERIC_READ,
+                                         FILE_SHARE_READ,
+                                         NULL,
+                                         OPEN_EXISTING,
+                                         FILE_ATTRIBUTE_NORMAL,
+                                         NULL);
+
+    if (MappedFile->FileHandle == INVALID_HANDLE_VALUE)
+    {
+        ShowMessages("err, could not open the file specified\n");
+        return FALSE;
+    }
+
+    if (!GetFileSizeEx(MappedFile->FileHandle, &FileSize) ||
+        (UINT64)FileSize.QuadPart < sizeof(EVENT_TRACE_FILE_HEADER))
+    {
+        ShowMessages("err, the file is not an event trace file\n");
+        EventTraceUnmapFile(MappedFile);
+        return FALSE;
+    }
+
+    MappedFile->FileSize        = FileSize.QuadPart;
+    MappedFile->MapObjectHandle = CreateFileMapping(MappedFile->FileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (MappedFile->MapObjectHandle == NULL)
+    {
+        ShowMessages("err, unable to map the event trace file (%x)\n", GetLastError());
+        EventTraceUnmapFile(MappedFile);
+        return FALSE;
+    }
+
+    MappedFile->Buffer = (const UINT8 *)MapViewOfFile(MappedFile->MapObjectHandle, FILE_MAP_READ, 0, 0, 0);
+
+    if (MappedFile->Buffer == NULL)
+    {
+        ShowMessages("err, unable to map the event trace file (%x)\n", GetLastError());
+        EventTraceUnmapFile(MappedFile);
+        return FALSE;
+    }
+
+    //
+    // Compute the number of blocks, then build the index
+    //
+    if (!EventTraceValidateFileHeader(MappedFile->Buffer, MappedFile->FileSize) ||
+        !EventTraceBuildIndex(MappedFile->Buffer, MappedFile->FileSize, NULL, 0, &NumberOfEntries))
+    {
+        ShowMessages("err, the event trace file is corrupted\n");
+        EventTraceUnmapFile(MappedFile);
+        return FALSE;
+    }
+
+    MappedFile->Index.resize(NumberOfEntries);
+
+    if (NumberOfEntries != 0 &&
+        !EventTraceBuildIndex(MappedFile->Buffer,
+                              MappedFile->FileSize,
+                              MappedFile->Index.data(),
+                              NumberOfEntries,
+                              &NumberOfEntries))
+    {
+        ShowMessages("err, the event trace file is corrupted\n");
+        EventTraceUnmapFile(MappedFile);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Unmap an event trace file that is mapped by EventTraceMapFile
+ *
+ * @param MappedFile
+ *
+ * @return VOID
+ */
+VOID
+EventTraceUnmapFile(PEVENT_TRACE_MAPPED_FILE MappedFile)
+{
+    if (MappedFile->Buffer != NULL)
+    {
+        UnmapViewOfFile(MappedFile->Buffer);
+        MappedFile->Buffer = NULL;
+    }
+
+    if (MappedFile->MapObjectHandle != NULL)
+    {
+        CloseHandle(MappedFile->MapObjectHandle);
+        MappedFile->MapObjectHandle = NULL;
+    }
+
+    if (MappedFile->FileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(MappedFile->FileHandle);
+        MappedFile->FileHandle = INVALID_HANDLE_VALUE;
+    }
+
+    MappedFile->Index.clear();
+}
@@ -2,7 +2,8 @@
  * @file pci-id.cpp
  * @author Bjrn Ruytenberg (bjorn@bjornweb.nl)
  * @brief Provides runtime access to PCI ID database
- * @details
+ * @details The pci.ids is parsed once into a binary index which is cached on
+ * the disk next to it, so the names are resolved with binary searches
  * @version 0.12
  * @date 2024-12-04
  *
@@ -11,376 +12,279 @@
  */
 #include "pch.h"
 
-static char * PciIdDatabaseBuffer = NULL;
+//
+// The index of the PCI ID database (loaded once per query session)
+//
+static PPCI_ID_INDEX_HEADER g_PciIdIndex           = NULL;
+static BOOLEAN              g_PciIdIndexLoadFailed = FALSE;
 
 /**
- * @brief Trims whitespaces in passed string
+ * @brief Get the path of a file of the PCI ID database (next to the executable)
  *
- * @param Str
- * @param MaxLen
- * @return char *
+ * @param FileName
+ * @param Path
+ * @param PathSize
+ * @return BOOLEAN
  */
-char *
-TrimWhitespace(char * Str, UINT8 MaxLen)
+static BOOLEAN
+PciIdGetDatabasePath(const char * FileName, char * Path, UINT32 PathSize)
 {
-    char * End;
-    while (*Str == ' ')
-        Str++; // Trim leading space
-    if (*Str == '\0')
-        return Str;
-    End = Str + strnlen_s(Str, MaxLen) - 1;
-    while (End > Str && (*End == ' ' || *End == '\n' || *End == '\r'))
-        End--;
-    *(End + 1) = '\0';
-    return Str;
-}
+    char *  ExecutableName;
+    HMODULE hModule = GetModuleHandle(NULL);
 
-/**
- * @brief Converts passed string to lowercase
- *
- * @param Str
- * @return char *
- */
-char *
-ToLower(char * Str)
-{
-    UINT8  StrLength   = (UINT8)strnlen_s(Str, PCI_ID_AS_STR_LENGTH);
-    char * CurrentChar = Str;
+    if (GetModuleFileName(hModule, Path, PathSize) == 0)
+    {
+        return FALSE;
+    }
 
-    while (CurrentChar < Str + StrLength)
+    // Extract executable name
+    ExecutableName = strrchr(Path, '\\');
+    if (ExecutableName != NULL)
     {
-        *CurrentChar = tolower(*CurrentChar);
-        CurrentChar++;
+        ExecutableName++;
     }
-    return Str;
+    else
+    {
+        ExecutableName = Path;
+    }
+
+    // Swap executable name for the file name
+    return strcpy_s(ExecutableName, PathSize - (ExecutableName - Path), FileName) == 0;
 }
 
 /**
- * @brief Read line from string. Treats SrcBuffer as a stream (similar to fgets and friends), i.e. updates SrcBuffer by number of characters read.
+ * @brief Read a whole file into a new buffer
+ * @details The buffer should be freed with free()
  *
- * @param DestBuffer
- * @param CharLimit
- * @param SrcBuffer
- * @return char *
+ * @param Path
+ * @param Size
+ * @return UINT8 *
  */
-char *
-ReadLine(char * DestBuffer, UINT64 CharLimit, char ** SrcBuffer)
+static UINT8 *
+PciIdReadFile(const char * Path, UINT64 * Size)
 {
-    char * Line = strchr(*SrcBuffer, '\n');
-    if (!Line)
+    FILE *  f      = fopen(Path, "rb");
+    UINT8 * Buffer = NULL;
+    INT64   Length;
+
+    if (f == NULL)
     {
         return NULL;
     }
-    else
+
+    _fseeki64(f, 0, SEEK_END);
+    Length = _ftelli64(f);
+    _fseeki64(f, 0, SEEK_SET);
+
+    if (Length >= 0)
     {
-        strncpy_s(DestBuffer, CharLimit, *SrcBuffer, (Line - *SrcBuffer));
-        *SrcBuffer += (Line - *SrcBuffer + 1);
-        return *SrcBuffer;
+        Buffer = (UINT8 *)malloc(Length != 0 ? (size_t)Length : 1);
     }
+
+    if (Buffer != NULL && fread(Buffer, 1, (size_t)Length, f) != (size_t)Length)
+    {
+        free(Buffer);
+        Buffer = NULL;
+    }
+
+    fclose(f);
+
+    *Size = (UINT64)Length;
+
+    return Buffer;
 }
 
 /**
- * @brief Get Vendor by PCI ID, encoded in ASCII. Do not call directly - use GetVendorById() instead.
+ * @brief Load the index of the PCI ID database
+ * @details The index is read from the cache file if it belongs to the current
+ * pci.ids (same size and last write time), otherwise the pci.ids is parsed
+ * and the cache file is updated
  *
- * @param Filename
- * @param VendorId
- * @return Vendor *
+ * @return PPCI_ID_INDEX_HEADER
  */
-Vendor *
-GetVendorByIdStr(const char * Filename, const char * VendorId)
+static PPCI_ID_INDEX_HEADER
+PciIdLoadIndex()
 {
-    Vendor *    MatchedVendor = NULL;
-    BOOLEAN     FoundVendorId = FALSE;
-    Device *    LastDevice    = NULL;
-    SubDevice * LastSubDevice = NULL;
-    char *      PciIdDbBufPtr = NULL;
-    char        Line[1024]    = {'\0'};
-
-    if (!PciIdDatabaseBuffer)
+    WIN32_FILE_ATTRIBUTE_DATA Attributes;
+    char                      DatabasePath[MAX_PATH];
+    char                      IndexPath[MAX_PATH];
+    UINT64                    SourceSize;
+    UINT64                    SourceTimestamp;
+    UINT64                    Size;
+    UINT8 *                   Buffer;
+    PPCI_ID_INDEX_HEADER      Index;
+    FILE *                    f;
+
+    if (!PciIdGetDatabasePath(PCI_ID_DATABASE_PATH, DatabasePath, sizeof(DatabasePath)) ||
+        !PciIdGetDatabasePath(PCI_ID_INDEX_PATH, IndexPath, sizeof(IndexPath)))
     {
-        FILE * f      = fopen(Filename, "rb");
-        size_t Length = 0;
+        return NULL;
+    }
 
-        if (f == NULL)
-        {
-            ShowMessages("Error: Cannot open file '%s': error %d\n", Filename, errno);
-            return NULL;
-        }
+    if (!GetFileAttributesExA(DatabasePath, GetFileExInfoStandard, &Attributes))
+    {
+        ShowMessages("err, cannot open file '%s': error %d\n", DatabasePath, GetLastError());
+        return NULL;
+    }
+
+    SourceSize      = ((UINT64)Attributes.nFileSizeHigh << 32) | Attributes.nFileSizeLow;
+    SourceTimestamp = ((UINT64)Attributes.ftLastWriteTime.dwHighDateTime << 32) | Attributes.ftLastWriteTime.dwLowDateTime;
 
-        fseek(f, 0, SEEK_END);
-        Length = ftell(f);
+    //
+    // Use the cached index if it's still valid
+    //
+    Buffer = PciIdReadFile(IndexPath, &Size);
 
-        PciIdDatabaseBuffer = (char *)malloc(Length);
-        if (!PciIdDatabaseBuffer)
+    if (Buffer != NULL)
+    {
+        if (PciIdIndexIsValid((PPCI_ID_INDEX_HEADER)Buffer, Size, SourceSize, SourceTimestamp))
         {
-            return NULL;
+            return (PPCI_ID_INDEX_HEADER)Buffer;
         }
 
-        fseek(f, 0, SEEK_SET);
-        fread(PciIdDatabaseBuffer, 1, Length, f);
-        fclose(f);
+        free(Buffer);
     }
 
-    PciIdDbBufPtr = PciIdDatabaseBuffer;
+    //
+    // Parse the database and save the index for the next time
+    //
+    Buffer = PciIdReadFile(DatabasePath, &Size);
 
-    while (ReadLine(Line, sizeof(Line), &PciIdDbBufPtr) != NULL)
+    if (Buffer == NULL)
     {
-        char FormatStr[24];
+        ShowMessages("err, cannot read file '%s'\n", DatabasePath);
+        return NULL;
+    }
 
-        // Skip comments and empty lines
-        if (Line[0] == '#' || Line[0] == '\0')
-        {
-            continue;
-        }
+    Index = PciIdIndexBuild((const CHAR *)Buffer, Size, SourceTimestamp);
 
-        // Find vendor
-        // We assume PCI ID database comprises unique entries only, i.e. we return the first matching entry
-        if (Line[0] != '\t' && FoundVendorId == FALSE)
-        {
-            char VendorBuf[PCI_ID_AS_STR_LENGTH + 1], VendorNameBuf[PCI_NAME_STR_LENGTH + 1];
-
-            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%%d[^\n]", PCI_NAME_STR_LENGTH); // FormatStr = "%4s %PCI_NAME_STR_LENGTH[^\n]"
-            if (sscanf(Line, FormatStr, VendorBuf, VendorNameBuf) == 2)
-            {
-                if (strncmp(VendorBuf, VendorId, sizeof(VendorId)) == 0)
-                {
-                    MatchedVendor = (Vendor *)malloc(sizeof(Vendor));
-                    if (!MatchedVendor)
-                    {
-                        return NULL;
-                    }
-
-                    int result = sscanf(VendorBuf, "%hx", &(MatchedVendor->VendorId));
-                    if (result != 1)
-                    {
-                        return NULL;
-                    }
-                    strncpy_s(MatchedVendor->VendorName, sizeof(MatchedVendor->VendorName), TrimWhitespace(VendorNameBuf, PCI_NAME_STR_LENGTH), _TRUNCATE);
-                    FoundVendorId = TRUE;
-                }
-            }
-        }
-        // Get all devices for vendor
-        else if (Line[0] == '\t' && Line[1] != '\t' && FoundVendorId == TRUE)
-        {
-            char DeviceBuf[PCI_ID_AS_STR_LENGTH + 1], DeviceNameBuf[PCI_NAME_STR_LENGTH + 1];
-
-            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%%d[^\n]", PCI_NAME_STR_LENGTH); // FormatStr = "%4s %PCI_NAME_STR_LENGTH[^\n]"
-            if (sscanf(Line + 1, FormatStr, DeviceBuf, DeviceNameBuf) == 2)
-            {
-                Device * NewDevice = (Device *)malloc(sizeof(Device));
-                if (!NewDevice)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                int Result = sscanf(DeviceBuf, "%hx", &(NewDevice->DeviceId));
-                if (Result != 1)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                strncpy_s(NewDevice->DeviceName, sizeof(NewDevice->DeviceName), TrimWhitespace(DeviceNameBuf, PCI_NAME_STR_LENGTH), _TRUNCATE);
-                NewDevice->SubDevices = NULL;
-                NewDevice->Next       = NULL;
-
-                if (LastDevice)
-                {
-                    LastDevice->Next = NewDevice;
-                }
-                else
-                {
-                    MatchedVendor->Devices = NewDevice; // First device
-                }
-                LastDevice    = NewDevice;
-                LastSubDevice = NULL;
-            }
-        }
-        // Get all subdevices for device
-        else if (Line[0] == '\t' && Line[1] == '\t' && FoundVendorId == TRUE && LastDevice)
-        {
-            char SubVendorBuf[PCI_ID_AS_STR_LENGTH + 1], SubDeviceBuf[PCI_ID_AS_STR_LENGTH + 1], SubsystemNameBuf[PCI_NAME_STR_LENGTH + 1];
-
-            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%4s %%%d[^\n]", PCI_NAME_STR_LENGTH); // FormatStr = "%4s %4s %PCI_NAME_STR_LENGTH[^\n]"
-            if (sscanf(Line + 2, FormatStr, SubVendorBuf, SubDeviceBuf, SubsystemNameBuf) == 3)
-            {
-                SubDevice * NewSubDevice = (SubDevice *)malloc(sizeof(SubDevice));
-                if (!NewSubDevice)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                int Result = sscanf(SubVendorBuf, "%hx", &NewSubDevice->SubVendorId);
-                if (Result != 1)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                Result = sscanf(SubDeviceBuf, "%hx", &NewSubDevice->SubDeviceId);
-                if (Result != 1)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                strncpy_s(NewSubDevice->SubSystemName, sizeof(NewSubDevice->SubSystemName), TrimWhitespace(SubsystemNameBuf, PCI_NAME_STR_LENGTH), _TRUNCATE);
-                NewSubDevice->Next = NULL;
-
-                if (LastSubDevice)
-                {
-                    LastSubDevice->Next = NewSubDevice;
-                }
-                else
-                {
-                    LastDevice->SubDevices = NewSubDevice; // First subdevice
-                }
-                LastSubDevice = NewSubDevice;
-            }
-        }
-        else if (Line[0] != '\t' && FoundVendorId == TRUE) // We hit the next vendor entry, so we're done parsing
-        {
-            break;
-        }
+    free(Buffer);
+
+    if (Index == NULL)
+    {
+        return NULL;
+    }
+
+    //
+    // The size is checked against the attributes of the file, so the index
+    // of a file that is changed while it's read is rebuilt next time
+    //
+    Index->SourceSize = SourceSize;
+
+    f = fopen(IndexPath, "wb");
+
+    if (f != NULL)
+    {
+        fwrite(Index, 1, Index->TotalSize, f);
+        fclose(f);
     }
 
-    return MatchedVendor;
+    return Index;
 }
 
 /**
- * @brief Frees Vendor and all of its members
+ * @brief Get the index of the PCI ID database (loaded on the first call)
  *
- * @param VendorToFree
- * @return void
+ * @return PPCI_ID_INDEX_HEADER
  */
-void
-FreeVendor(Vendor * VendorToFree)
+static PPCI_ID_INDEX_HEADER
+PciIdGetIndex()
 {
-    if (VendorToFree == NULL)
-        return;
-
-    Device * CurrentDevice = VendorToFree->Devices;
-    while (CurrentDevice)
+    if (g_PciIdIndex == NULL && !g_PciIdIndexLoadFailed)
     {
-        SubDevice * CurrentSubDevice = CurrentDevice->SubDevices;
+        g_PciIdIndex = PciIdLoadIndex();
 
-        while (CurrentSubDevice)
-        {
-            SubDevice * nextSubDevice = CurrentSubDevice->Next;
-            free(CurrentSubDevice);
-            CurrentSubDevice = nextSubDevice;
-        }
-
-        Device * NextDevice = CurrentDevice->Next;
-        free(CurrentDevice);
-        CurrentDevice = NextDevice;
+        //
+        // Don't retry (and show the error) for each of the devices
+        //
+        g_PciIdIndexLoadFailed = g_PciIdIndex == NULL;
     }
+
+    return g_PciIdIndex;
 }
 
 /**
- * @brief Frees PciIdDatabaseBuffer
+ * @brief Frees the index of the PCI ID database
  * @return void
  */
 void
 FreePciIdDatabase()
 {
-    if (PciIdDatabaseBuffer != NULL)
-    {
-        free(PciIdDatabaseBuffer);
-        PciIdDatabaseBuffer = NULL;
-    }
+    free(g_PciIdIndex);
+
+    g_PciIdIndex           = NULL;
+    g_PciIdIndexLoadFailed = FALSE;
 }
 
 /**
- * @brief Returns Vendor entry, including corresponding devices and subdevices
- * @details Use FreeVendor() on returned Vendor pointer after usage. First call will initialize database - call FreeDatabase() once done querying.
+ * @brief Returns the name of a vendor
+ * @details First call will initialize database - call FreePciIdDatabase() once done querying.
  *
  * @param VendorId
- * @return Vendor
+ * @return const char * NULL if not found
  */
-Vendor *
-GetVendorById(UINT16 VendorId)
+const char *
+PciIdGetVendorName(UINT16 VendorId)
 {
-    char    VendorIdAsStr[5];
-    char    ExecutablePath[MAX_PATH];
-    HMODULE hModule = GetModuleHandle(NULL);
-
-    snprintf(VendorIdAsStr, sizeof(VendorIdAsStr), "%04X", VendorId);
-    GetModuleFileName(hModule, ExecutablePath, sizeof(ExecutablePath));
+    PPCI_ID_INDEX_HEADER        Index = PciIdGetIndex();
+    const PCI_ID_INDEX_VENDOR * Vendor;
 
-    // Extract executable name
-    char * ExecutableName = strrchr(ExecutablePath, '\\');
-    if (ExecutableName != NULL)
+    if (Index == NULL || (Vendor = PciIdIndexFindVendor(Index, VendorId)) == NULL)
     {
-        ExecutableName++;
-    }
-    else
-    {
-        ExecutableName = ExecutablePath;
+        return NULL;
     }
 
-    // Swap executable name for PCI_ID_DATABASE_PATH
-    strncpy(ExecutableName, PCI_ID_DATABASE_PATH, sizeof(PCI_ID_DATABASE_PATH));
-
-    return GetVendorByIdStr(ExecutablePath, ToLower(VendorIdAsStr));
+    return PciIdIndexGetName(Index, Vendor->NameOffset);
 }
 
 /**
- * @brief Returns Device entry corresponding to DeviceId
+ * @brief Returns the name of a device
  *
- * @param VendorToUse
+ * @param VendorId
  * @param DeviceId
- * @return Device
+ * @return const char * NULL if not found
  */
-Device *
-GetDeviceFromVendor(Vendor * VendorToUse, UINT16 DeviceId)
+const char *
+PciIdGetDeviceName(UINT16 VendorId, UINT16 DeviceId)
 {
-    Device * CurrentDevice = NULL;
-    if (!VendorToUse)
+    PPCI_ID_INDEX_HEADER        Index = PciIdGetIndex();
+    const PCI_ID_INDEX_VENDOR * Vendor;
+    const PCI_ID_INDEX_DEVICE * Device;
+
+    if (Index == NULL ||
+        (Vendor = PciIdIndexFindVendor(Index, VendorId)) == NULL ||
+        (Device = PciIdIndexFindDevice(Index, Vendor, DeviceId)) == NULL)
     {
         return NULL;
     }
 
-    CurrentDevice = VendorToUse->Devices;
-    while (CurrentDevice != NULL)
-    {
-        if (CurrentDevice->DeviceId == DeviceId)
-        {
-            return CurrentDevice;
-        }
-        CurrentDevice = CurrentDevice->Next;
-    }
-    return NULL;
+    return PciIdIndexGetName(Index, Device->NameOffset);
 }
 
 /**
- * @brief Returns SubDevice entry corresponding to SubVendorId and DeviceId
+ * @brief Returns the name of a subsystem
  *
- * @param DeviceToUse
+ * @param VendorId
+ * @param DeviceId
  * @param SubVendorId
  * @param SubDeviceId
- * @return SubDevice
+ * @return const char * NULL if not found
  */
-SubDevice *
-GetSubDeviceFromDevice(Device * DeviceToUse, UINT16 SubVendorId, UINT16 SubDeviceId)
+const char *
+PciIdGetSubsystemName(UINT16 VendorId, UINT16 DeviceId, UINT16 SubVendorId, UINT16 SubDeviceId)
 {
-    SubDevice * CurrentSubDevice = NULL;
-    if (!DeviceToUse)
+    PPCI_ID_INDEX_HEADER           Index = PciIdGetIndex();
+    const PCI_ID_INDEX_VENDOR *    Vendor;
+    const PCI_ID_INDEX_DEVICE *    Device;
+    const PCI_ID_INDEX_SUBSYSTEM * Subsystem;
+
+    if (Index == NULL ||
+        (Vendor = PciIdIndexFindVendor(Index, VendorId)) == NULL ||
+        (Device = PciIdIndexFindDevice(Index, Vendor, DeviceId)) == NULL ||
+        (Subsystem = PciIdIndexFindSubsystem(Index, Device, SubVendorId, SubDeviceId)) == NULL)
     {
         return NULL;
     }
 
-    CurrentSubDevice = DeviceToUse->SubDevices;
-    while (CurrentSubDevice != NULL)
-    {
-        if (CurrentSubDevice->SubVendorId == SubVendorId && CurrentSubDevice->SubDeviceId == SubDeviceId)
-        {
-            return CurrentSubDevice;
-        }
-        CurrentSubDevice = CurrentSubDevice->Next;
-    }
-    return NULL;
+    return PciIdIndexGetName(Index, Subsystem->NameOffset);
 }
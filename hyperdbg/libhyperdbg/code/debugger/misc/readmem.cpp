@@ -93,9 +93,10 @@ HyperDbgReadMemory(UINT64                              TargetAddress,
     if (g_IsSerialConnectedToRemoteDebuggee)
     {
         //
-        // It's on Debugger mode
+        // It's on Debugger mode (the memory might be served from the cache
+        // while the debuggee is halted)
         //
-        if (!KdSendReadMemoryPacketToDebuggee(MemReadRequest, SizeOfTargetBuffer))
+        if (!KdCacheReadMemoryOrSendPacket(MemReadRequest, SizeOfTargetBuffer))
         {
             std::free(MemReadRequest);
             return FALSE;
@@ -0,0 +1,229 @@
+/**
+ * @file step-trace.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Receiving and showing the counted step traces
+ * @details The steps are received in a few large chunks once the debuggee
+ * is paused, then the instructions are disassembled here, the pages of the
+ * instructions are read once and cached for the whole trace
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN g_IsInstrumentingInstructions;
+
+/**
+ * @brief Context of showing the steps of a trace
+ *
+ */
+typedef struct _STEP_TRACE_SHOW_CONTEXT
+{
+    const STEP_TRACE_HEADER *               Header;
+    BOOLEAN                                 Is32Bit;
+    unordered_map<UINT64, vector<UINT8>> * PageCache;
+
+} STEP_TRACE_SHOW_CONTEXT, *PSTEP_TRACE_SHOW_CONTEXT;
+
+/**
+ * @brief Read the whole step trace of the current core from the debuggee
+ *
+ * @param Header The header of the trace
+ * @param Data The encoded steps
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+StepTraceReadFromDebuggee(PSTEP_TRACE_HEADER Header, vector<UINT8> & Data)
+{
+    UINT32                           ExpectedSize = SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET + STEP_TRACE_MAXIMUM_CHUNK_SIZE;
+    vector<UINT8>                    Buffer(ExpectedSize);
+    PDEBUGGEE_STEP_TRACE_READ_PACKET ReadPacket = (PDEBUGGEE_STEP_TRACE_READ_PACKET)Buffer.data();
+
+    Data.clear();
+
+    do
+    {
+        RtlZeroMemory(ReadPacket, SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET);
+        ReadPacket->Offset = (UINT32)Data.size();
+
+        if (!KdSendReadStepTracePacketToDebuggee(ReadPacket, ExpectedSize))
+        {
+            return FALSE;
+        }
+
+        if (ReadPacket->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+        {
+            ShowErrorMessage(ReadPacket->KernelStatus);
+            return FALSE;
+        }
+
+        if (ReadPacket->ChunkSize > STEP_TRACE_MAXIMUM_CHUNK_SIZE)
+        {
+            ShowMessages("err, invalid chunk of the step trace is received\n");
+            return FALSE;
+        }
+
+        Data.insert(Data.end(),
+                    Buffer.begin() + SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET,
+                    Buffer.begin() + SIZEOF_DEBUGGEE_STEP_TRACE_READ_PACKET + ReadPacket->ChunkSize);
+
+    } while (ReadPacket->ChunkSize != 0 && Data.size() < ReadPacket->Header.DataSize);
+
+    memcpy(Header, &ReadPacket->Header, sizeof(STEP_TRACE_HEADER));
+
+    return Data.size() == Header->DataSize;
+}
+
+/**
+ * @brief Get the bytes of the instruction at the target address
+ * @details The pages are read from the debuggee once for the whole trace
+ *
+ * @param PageCache
+ * @param Address
+ * @param InstructionBytes
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+StepTraceGetInstructionBytes(unordered_map<UINT64, vector<UINT8>> * PageCache,
+                             UINT64                                 Address,
+                             UINT8 *                                InstructionBytes)
+{
+    for (UINT32 i = 0; i < MAXIMUM_INSTR_SIZE; i++)
+    {
+        UINT64 PageAddress = (Address + i) & ~((UINT64)NORMAL_PAGE_SIZE - 1);
+        auto   Page        = PageCache->find(PageAddress);
+
+        if (Page == PageCache->end())
+        {
+            vector<UINT8> PageBuffer(NORMAL_PAGE_SIZE);
+            UINT32        ReturnLength = 0;
+
+            if (!HyperDbgReadMemory(PageAddress,
+                                    DEBUGGER_READ_VIRTUAL_ADDRESS,
+                                    READ_FROM_KERNEL,
+                                    0,
+                                    NORMAL_PAGE_SIZE,
+                                    FALSE,
+                                    NULL,
+                                    PageBuffer.data(),
+                                    &ReturnLength) ||
+                ReturnLength != NORMAL_PAGE_SIZE)
+            {
+                //
+                // Keep an empty page to avoid reading it again
+                //
+                PageBuffer.clear();
+            }
+
+            Page = PageCache->emplace(PageAddress, std::move(PageBuffer)).first;
+        }
+
+        if (Page->second.empty())
+        {
+            //
+            // The first byte is not available, the instruction is unknown
+            //
+            if (i == 0)
+            {
+                return FALSE;
+            }
+
+            //
+            // The remaining bytes are not available, the instruction
+            // might be shorter than the maximum size
+            //
+            memset(&InstructionBytes[i], 0, MAXIMUM_INSTR_SIZE - i);
+            break;
+        }
+
+        InstructionBytes[i] = Page->second[(Address + i) - PageAddress];
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Show a single decoded step
+ *
+ * @param StepIndex
+ * @param Rip
+ * @param Registers
+ * @param Context
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+StepTraceShowStep(UINT32 StepIndex, UINT64 Rip, const UINT64 * Registers, PVOID Context)
+{
+    PSTEP_TRACE_SHOW_CONTEXT ShowContext                          = (PSTEP_TRACE_SHOW_CONTEXT)Context;
+    UINT8                    InstructionBytes[MAXIMUM_INSTR_SIZE] = {0};
+
+    UNREFERENCED_PARAMETER(StepIndex);
+
+    if (!StepTraceGetInstructionBytes(ShowContext->PageCache, Rip, InstructionBytes))
+    {
+        ShowMessages("%s    ??\n", SeparateTo64BitValue(Rip).c_str());
+    }
+    else if (ShowContext->Is32Bit)
+    {
+        HyperDbgDisassembler32(InstructionBytes, Rip, MAXIMUM_INSTR_SIZE, 1, FALSE, NULL);
+    }
+    else
+    {
+        HyperDbgDisassembler64(InstructionBytes, Rip, MAXIMUM_INSTR_SIZE, 1, FALSE, NULL);
+    }
+
+    if (ShowContext->Header->NumberOfRegisters != 0)
+    {
+        ShowMessages("\t");
+
+        for (UINT32 i = 0; i < ShowContext->Header->NumberOfRegisters; i++)
+        {
+            ShowMessages(" %s=%016llx",
+                         EventTraceGetRegisterName(ShowContext->Header->RegisterIds[i]),
+                         Registers[i]);
+        }
+
+        ShowMessages("\n");
+    }
+
+    //
+    // Check if user pressed CTRL+C
+    //
+    return g_IsInstrumentingInstructions;
+}
+
+/**
+ * @brief Decode and disassemble the steps of a trace
+ *
+ * @param Header The header of the trace
+ * @param Data The encoded steps
+ * @param Is32Bit Whether the instructions are disassembled as 32-bit
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+StepTraceShowSteps(const STEP_TRACE_HEADER * Header, const vector<UINT8> & Data, BOOLEAN Is32Bit)
+{
+    unordered_map<UINT64, vector<UINT8>> PageCache;
+    STEP_TRACE_SHOW_CONTEXT              ShowContext = {0};
+
+    ShowContext.Header    = Header;
+    ShowContext.Is32Bit   = Is32Bit;
+    ShowContext.PageCache = &PageCache;
+
+    if (!StepTraceDecode(Header, Data.data(), (UINT32)Data.size(), StepTraceShowStep, &ShowContext))
+    {
+        ShowMessages("err, the received step trace is malformed\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
@@ -492,6 +492,109 @@ ScriptAutomaticStatementsTestWrapper(const string & Expr, UINT64 ExpectationValu
     return FALSE;
 }
 
+/**
+ * @brief Compare the fast-path filter of a script with the script engine
+ * (used for testing purposes)
+ * @details The script engine result of each state is whether the script
+ * changed the registers or not, so the body of the tested scripts should
+ * always change a register
+ *
+ * @param Expr The script
+ * @param States The registers of each run
+ * @param NumberOfStates
+ * @param FilterResults Results of the filter for each state
+ * @param InterpreterResults Results of the script engine for each state
+ * @param FilterTime The time of checking the filter for all of the states (in nanoseconds)
+ * @param InterpreterTime The time of running the script for all of the states (in nanoseconds)
+ *
+ * @return BOOLEAN FALSE if the script is not valid or it can't be lowered to a filter
+ */
+BOOLEAN
+ScriptEngineWrapperTestFilter(const CHAR * Expr,
+                              GUEST_REGS * States,
+                              UINT32       NumberOfStates,
+                              BOOLEAN *    FilterResults,
+                              BOOLEAN *    InterpreterResults,
+                              UINT64 *     FilterTime,
+                              UINT64 *     InterpreterTime)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    ACTION_BUFFER                   ActionBuffer           = {0};
+    SYMBOL                          ErrorSymbol            = {0};
+    SCRIPT_FILTER                   Filter                 = {0};
+    GUEST_REGS                      Regs;
+    vector<UINT64>                  StackBuffer(MAX_STACK_BUFFER_COUNT);
+    vector<UINT64>                  GlobalVariables(MAX_VAR_COUNT);
+    UINT64                          PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_COUNT];
+    LARGE_INTEGER                   Frequency;
+    LARGE_INTEGER                   StartTime;
+    LARGE_INTEGER                   FilterEndTime;
+    LARGE_INTEGER                   InterpreterEndTime;
+
+    //
+    // The script engine reads the pseudo-registers of the current thread
+    //
+    PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_PID]  = GetCurrentProcessId();
+    PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_TID]  = GetCurrentThreadId();
+    PseudoRegisters[SCRIPT_FILTER_PSEUDO_REGISTER_CORE] = GetCurrentProcessorNumber();
+
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((char *)Expr);
+
+    if (CodeBuffer->Message != NULL || !ScriptFilterCompile(CodeBuffer->Head, CodeBuffer->Pointer, &Filter))
+    {
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    QueryPerformanceFrequency(&Frequency);
+    QueryPerformanceCounter(&StartTime);
+
+    for (UINT32 i = 0; i < NumberOfStates; i++)
+    {
+        FilterResults[i] = ScriptFilterEvaluate(&Filter, &States[i], PseudoRegisters);
+    }
+
+    QueryPerformanceCounter(&FilterEndTime);
+
+    for (UINT32 i = 0; i < NumberOfStates; i++)
+    {
+        //
+        // The same as running the script of an event
+        //
+        Regs                                       = States[i];
+        ScriptGeneralRegisters.StackBuffer         = StackBuffer.data();
+        ScriptGeneralRegisters.GlobalVariablesList = GlobalVariables.data();
+        ScriptGeneralRegisters.StackIndx           = 0;
+        ScriptGeneralRegisters.StackBaseIndx       = 0;
+        RtlZeroMemory(StackBuffer.data(), MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
+
+        for (UINT64 j = 0; j < CodeBuffer->Pointer;)
+        {
+            if (ScriptEngineExecute(&Regs,
+                                    &ActionBuffer,
+                                    &ScriptGeneralRegisters,
+                                    CodeBuffer,
+                                    &j,
+                                    &ErrorSymbol) == TRUE ||
+                ScriptGeneralRegisters.StackIndx >= MAX_STACK_BUFFER_COUNT)
+            {
+                break;
+            }
+        }
+
+        InterpreterResults[i] = memcmp(&Regs, &States[i], sizeof(GUEST_REGS)) != 0;
+    }
+
+    QueryPerformanceCounter(&InterpreterEndTime);
+
+    *FilterTime      = ((FilterEndTime.QuadPart - StartTime.QuadPart) * 1000000000) / Frequency.QuadPart;
+    *InterpreterTime = ((InterpreterEndTime.QuadPart - FilterEndTime.QuadPart) * 1000000000) / Frequency.QuadPart;
+
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return TRUE;
+}
+
 /**
  * @brief allocate memory and build structure for casting
  * @param AllocationsForCastings Memory details for future deallocations
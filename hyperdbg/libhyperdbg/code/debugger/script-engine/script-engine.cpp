@@ -32,6 +32,17 @@ ScriptEngineEvalSingleExpression(string Expr, PBOOLEAN HasError)
 {
     UINT64 Result = NULL;
 
+    //
+    // A single register of the halted debuggee (e.g., '@rsp') might be
+    // available in the cache, so there is no need to run a script on
+    // the debuggee
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee && KdCacheTryEvalRegisterExpression(Expr, &Result))
+    {
+        *HasError = FALSE;
+        return Result;
+    }
+
     //
     // Prepend and append 'formats(' and ')'
     //
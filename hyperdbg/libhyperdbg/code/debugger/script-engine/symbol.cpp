@@ -51,7 +51,7 @@ SymbolLocalReload(UINT32 UserProcessId)
 {
     ShowMessages("interpreting symbols and creating symbol maps\n");
 
-    SymbolBuildSymbolTable(&g_SymbolTable, &g_SymbolTableSize, UserProcessId, FALSE);
+    SymbolBuildSymbolTable(&g_SymbolTable, &g_SymbolTableSize, UserProcessId);
 
     //
     // And also load the symbols
@@ -62,17 +62,50 @@ SymbolLocalReload(UINT32 UserProcessId)
 /**
  * @brief Initial and send the results of serial for the debugger
  * in the case of debugger mode
+ * @details Only the difference between the previously sent table and the
+ * new table is sent if the debugger's table matches the previous table
+ *
  * @param UserProcessId
+ * @param DebuggerSymbolTableDigest Digest of the debugger's symbol table
  *
- * @return VOID
+ * @return BOOLEAN
  */
-VOID
-SymbolPrepareDebuggerWithSymbolInfo(UINT32 UserProcessId)
+BOOLEAN
+SymbolPrepareDebuggerWithSymbolInfo(UINT32 UserProcessId, UINT64 DebuggerSymbolTableDigest)
 {
+    BOOLEAN               Result;
+    PMODULE_SYMBOL_DETAIL PreviousSymbolTable     = g_SymbolTable;
+    UINT32                PreviousSymbolTableSize = g_SymbolTableSize;
+
+    //
+    // Keep the previous table to compute the difference
+    //
+    g_SymbolTable             = NULL;
+    g_SymbolTableSize         = 0;
+    g_SymbolTableCurrentIndex = 0;
+
     //
     // Load already downloaded symbol (won't download at this point)
     //
-    SymbolBuildSymbolTable(&g_SymbolTable, &g_SymbolTableSize, UserProcessId, TRUE);
+    Result = SymbolBuildSymbolTable(&g_SymbolTable, &g_SymbolTableSize, UserProcessId);
+
+    if (Result)
+    {
+        Result = SymbolSyncSendDifference(PreviousSymbolTable,
+                                          PreviousSymbolTableSize / sizeof(MODULE_SYMBOL_DETAIL),
+                                          g_SymbolTable,
+                                          g_SymbolTableSize / sizeof(MODULE_SYMBOL_DETAIL),
+                                          DebuggerSymbolTableDigest,
+                                          KdSendSymbolTableBatchPacket,
+                                          NULL);
+    }
+
+    if (PreviousSymbolTable != NULL)
+    {
+        free(PreviousSymbolTable);
+    }
+
+    return Result;
 }
 
 /**
@@ -463,16 +496,13 @@ SymbolDeleteSymTable()
  * this buffer will be allocated by this function and needs to be freed by caller
  * @param StoredLength The length that stored on the BufferToStoreDetails
  * @param UserProcessId Which user mode process to get its modules
- * @param SendOverSerial Shows whether the packet should be sent to the debugger
- * over the serial or not
  *
  * @return BOOLEAN shows whether the operation was successful or not
  */
 BOOLEAN
 SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
                        PUINT32                 StoredLength,
-                       UINT32                  UserProcessId,
-                       BOOLEAN                 SendOverSerial)
+                       UINT32                  UserProcessId)
 {
     BOOLEAN                         Status;
     ULONG                           ReturnedLength;
@@ -776,16 +806,6 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
             {
                 ModuleSymDetailArray[i].IsSymbolDetailsFound = FALSE;
             }
-
-            //
-            // Check if it should be send to the remote debugger over serial
-            // and also make sure that we're connected to the remote debugger
-            // and this is a debuggee
-            //
-            if (SendOverSerial)
-            {
-                KdSendSymbolDetailPacket(&ModuleSymDetailArray[i], i, ModuleInfo->NumberOfModules + ModulesCount);
-            }
         }
     }
 
@@ -867,16 +887,6 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
         {
             ModuleSymDetailArray[IndexInSymbolBuffer].IsSymbolDetailsFound = FALSE;
         }
-
-        //
-        // Check if it should be send to the remote debugger over serial
-        // and also make sure that we're connected to the remote debugger
-        // and this is a debuggee
-        //
-        if (SendOverSerial)
-        {
-            KdSendSymbolDetailPacket(&ModuleSymDetailArray[IndexInSymbolBuffer], i, ModuleInfo->NumberOfModules + ModulesCount);
-        }
     }
 
     //
@@ -900,29 +910,27 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
 }
 
 /**
- * @brief Allocate (build) and update the symbol table whenever a debuggee is attached
- * on the debugger mode
+ * @brief Apply a batch of added or removed modules (received from the
+ * debuggee) to the symbol table in debugger mode
  *
- * @param SymbolDetail Pointer to a buffer that was received as the single
- * symbol info
+ * @param Batch Pointer to the received batch
+ * @param BatchLength Length of the received batch
  *
  * @return BOOLEAN shows whether the operation was successful or not
  */
 BOOLEAN
-SymbolBuildAndUpdateSymbolTable(PMODULE_SYMBOL_DETAIL SymbolDetail)
+SymbolUpdateSymbolTableFromBatch(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch, UINT32 BatchLength)
 {
+    BOOLEAN Result;
+
     //
-    // Check to avoid overflow in symbol table
+    // The first batch of a full synchronization drops the previous table
     //
-    if (g_SymbolTableCurrentIndex >= MAXIMUM_SUPPORTED_SYMBOLS)
+    if (Batch->IsFullSynchronization && Batch->BatchIndex == 0)
     {
-        ShowMessages("err, the symbol table buffer is full, unable to add new symbol\n");
-        return FALSE;
+        SymbolDeleteSymTable();
     }
 
-    //
-    // Check if we found an already built symbol table
-    //
     if (g_SymbolTable == NULL)
     {
         //
@@ -937,37 +945,35 @@ SymbolBuildAndUpdateSymbolTable(PMODULE_SYMBOL_DETAIL SymbolDetail)
             return FALSE;
         }
 
-        //
-        // Reset the index
-        //
         g_SymbolTableCurrentIndex = 0;
 
-        //
-        // Make sure buffer is zero
-        //
         RtlZeroMemory(g_SymbolTable, MAXIMUM_SUPPORTED_SYMBOLS * sizeof(MODULE_SYMBOL_DETAIL));
     }
 
-    //
-    // Move it to the new buffer
-    //
-    memcpy(&g_SymbolTable[g_SymbolTableCurrentIndex], SymbolDetail, sizeof(MODULE_SYMBOL_DETAIL));
+    Result = SymbolSyncApplyBatch(Batch,
+                                  BatchLength,
+                                  g_SymbolTable,
+                                  &g_SymbolTableCurrentIndex,
+                                  MAXIMUM_SUPPORTED_SYMBOLS);
 
-    //
-    // Add to index for future symbols
-    //
-    g_SymbolTableCurrentIndex++;
+    if (!Result)
+    {
+        ShowMessages("err, unable to apply the symbol table updates (invalid batch or the table is full)\n");
+    }
 
     //
     // Compute the (new) current size
     //
     g_SymbolTableSize = g_SymbolTableCurrentIndex * sizeof(MODULE_SYMBOL_DETAIL);
 
-    return TRUE;
+    return Result;
 }
 
 /**
  * @brief Update the symbol table from remote debuggee in debugger mode
+ * @details The current table is kept and its digest is sent to the debuggee
+ * so only the added or removed modules are sent back
+ *
  * @param ProcessId
  *
  * @return BOOLEAN shows whether the operation was successful or not
@@ -975,15 +981,20 @@ SymbolBuildAndUpdateSymbolTable(PMODULE_SYMBOL_DETAIL SymbolDetail)
 BOOLEAN
 SymbolReloadSymbolTableInDebuggerMode(UINT32 ProcessId)
 {
+    UINT64 SymbolTableDigest = SYMBOL_SYNC_DIGEST_UNKNOWN;
+
     //
-    // Check if we found an already built symbol table
+    // Compute the digest of the already built symbol table
     //
-    SymbolDeleteSymTable();
+    if (g_SymbolTable != NULL)
+    {
+        SymbolTableDigest = SymbolSyncComputeDigest(g_SymbolTable, g_SymbolTableSize / sizeof(MODULE_SYMBOL_DETAIL));
+    }
 
     //
     // Request to send new symbol details
     //
-    if (KdSendSymbolReloadPacketToDebuggee(ProcessId))
+    if (KdSendSymbolReloadPacketToDebuggee(ProcessId, SymbolTableDigest))
     {
         ShowMessages("symbol table updated successfully\n");
         return TRUE;
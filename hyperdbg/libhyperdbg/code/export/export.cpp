@@ -139,6 +139,66 @@ hyperdbg_u_test_command_parser_show_tokens(CHAR * command)
     return HyperDbgTestCommandParserShowTokens(command);
 }
 
+/**
+ * @brief Benchmark the command parser (used for testing purposes)
+ *
+ * @param commands The list of commands
+ * @param number_of_commands The number of commands
+ * @param number_of_iterations The number of times that the list is parsed
+ * @param parse_time The time of building the command tokens (in microseconds)
+ * @param tokenize_time The time of only tokenizing the commands (in microseconds)
+ * @param number_of_tokens The number of tokens in the list of commands
+ *
+ * @return BOOLEAN returns false if the tokens of the parser were not identical
+ */
+BOOLEAN
+hyperdbg_u_test_command_parser_benchmark(CHAR **  commands,
+                                         UINT32   number_of_commands,
+                                         UINT32   number_of_iterations,
+                                         UINT64 * parse_time,
+                                         UINT64 * tokenize_time,
+                                         UINT64 * number_of_tokens)
+{
+    return HyperDbgTestCommandParserBenchmark(commands,
+                                              number_of_commands,
+                                              number_of_iterations,
+                                              parse_time,
+                                              tokenize_time,
+                                              number_of_tokens);
+}
+
+/**
+ * @brief Compare the fast-path filter of a script with the script
+ * engine (used for testing purposes)
+ *
+ * @param script The script
+ * @param states The registers of each run
+ * @param number_of_states The number of states
+ * @param filter_results Results of the filter for each state
+ * @param interpreter_results Results of the script engine for each state
+ * @param filter_time The time of checking the filter (in nanoseconds)
+ * @param interpreter_time The time of running the script (in nanoseconds)
+ *
+ * @return BOOLEAN returns false if the script can't be lowered to a filter
+ */
+BOOLEAN
+hyperdbg_u_test_script_filter(CHAR *       script,
+                              GUEST_REGS * states,
+                              UINT32       number_of_states,
+                              BOOLEAN *    filter_results,
+                              BOOLEAN *    interpreter_results,
+                              UINT64 *     filter_time,
+                              UINT64 *     interpreter_time)
+{
+    return ScriptEngineWrapperTestFilter(script,
+                                         states,
+                                         number_of_states,
+                                         filter_results,
+                                         interpreter_results,
+                                         filter_time,
+                                         interpreter_time);
+}
+
 /**
  * @brief Show the signature of the debugger
  *
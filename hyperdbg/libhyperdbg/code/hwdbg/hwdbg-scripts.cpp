@@ -110,15 +110,32 @@ HwdbgScriptCompressScriptBuffer(HWDBG_INSTANCE_INFORMATION * InstanceInfo,
     }
 
     //
-    // we put BRAM data width size here instead of script variable length (InstanceInfo.scriptVariableLength)
+    // If the instance supports it, symbols are packed at the bit level (the type and
+    // the value only take their exact widths), otherwise, we put BRAM data width size
+    // here instead of script variable length (InstanceInfo.scriptVariableLength)
     // since we want it to read one symbol filed at a time
     //
-    if (!HardwareScriptInterpreterCompressBuffer((UINT64 *)*NewScriptBuffer,
-                                                 *NewCompressedBufferSize,
-                                                 InstanceInfo->scriptVariableLength,
-                                                 InstanceInfo->bramDataWidth,
-                                                 NewCompressedBufferSize,
-                                                 NumberOfBytesPerChunk))
+    if (InstanceInfo->scriptCapabilities.bit_packed_script_buffer)
+    {
+        if (!HardwareScriptInterpreterBitPackBuffer(*NewScriptBuffer,
+                                                    *NewCompressedBufferSize,
+                                                    InstanceInfo->scriptVariableLength,
+                                                    InstanceInfo->bramDataWidth,
+                                                    NewCompressedBufferSize,
+                                                    NumberOfBytesPerChunk))
+        {
+            //
+            // Unable to pack the buffer
+            //
+            return FALSE;
+        }
+    }
+    else if (!HardwareScriptInterpreterCompressBuffer((UINT64 *)*NewScriptBuffer,
+                                                      *NewCompressedBufferSize,
+                                                      InstanceInfo->scriptVariableLength,
+                                                      InstanceInfo->bramDataWidth,
+                                                      NewCompressedBufferSize,
+                                                      NumberOfBytesPerChunk))
     {
         //
         // Unable to compress the buffer
@@ -0,0 +1,43 @@
+/**
+ * @file bulk-read.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers for reading large ranges of memory with bulk read requests
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of bulk read requests that are in flight in VMI Mode
+ *
+ */
+#define BULK_READ_NUMBER_OF_REQUESTS_IN_FLIGHT 4
+
+/**
+ * @brief Size of the buffer of the file writer
+ *
+ */
+#define BULK_READ_FILE_WRITER_BUFFER_SIZE (4 * 1024 * 1024)
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+HyperDbgBulkReadMemory(PDEBUGGER_BULK_READ_MEMORY Request, UINT32 RequestBufferSize);
+
+BOOLEAN
+BulkReadMemoryIntoFile(UINT64                    Address,
+                       UINT64                    Size,
+                       DEBUGGER_READ_MEMORY_TYPE MemoryType,
+                       UINT32                    Pid,
+                       HANDLE                    FileHandle,
+                       UINT64 *                  NumberOfInvalidPages);
@@ -176,6 +176,18 @@ typedef enum
  */
 typedef std::tuple<CommandParsingTokenType, std::string, std::string> CommandToken;
 
+/**
+ * @brief Command's token as a view into the arena of the command parser
+ *
+ */
+typedef struct _COMMAND_TOKEN_VIEW
+{
+    CommandParsingTokenType Type;
+    std::string_view        Text;
+    std::string_view        LowerText;
+
+} COMMAND_TOKEN_VIEW, *PCOMMAND_TOKEN_VIEW;
+
 /**
  * @brief Command's function type
  *
@@ -200,11 +212,27 @@ typedef struct _COMMAND_DETAIL
 
 } COMMAND_DETAIL, *PCOMMAND_DETAIL;
 
+/**
+ * @brief Hash of the command names
+ * @details It's transparent, so the commands can be looked up by
+ * std::string_view without creating a string
+ *
+ */
+struct CommandNameHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view Name) const
+    {
+        return std::hash<std::string_view> {}(Name);
+    }
+};
+
 /**
  * @brief Type saving commands and mapping to command string
  *
  */
-typedef std::map<std::string, COMMAND_DETAIL> CommandType;
+typedef std::unordered_map<std::string, COMMAND_DETAIL, CommandNameHash, std::equal_to<>> CommandType;
 
 /**
  * @brief Different attributes of commands
@@ -477,10 +505,25 @@ typedef std::map<std::string, COMMAND_DETAIL> CommandType;
 #define DEBUGGER_COMMAND_SMI_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
 
+#define DEBUGGER_COMMAND_TSCOFFSET_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
+#define DEBUGGER_COMMAND_PROFILE_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
+#define DEBUGGER_COMMAND_PT_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
+#define DEBUGGER_COMMAND_LBR_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
 // Show driver/device randomization info
 #define DEBUGGER_COMMAND_DRVINFO_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_ABSOLUTE_LOCAL
 
+#define DEBUGGER_COMMAND_EVTRACE_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_ABSOLUTE_LOCAL
+
 //////////////////////////////////////////////////
 //             Command Functions                //
 //////////////////////////////////////////////////
@@ -771,6 +814,18 @@ CommandIdt(vector<CommandToken> CommandTokens, string Command);
 VOID
 CommandSmi(vector<CommandToken> CommandTokens, string Command);
 
+VOID
+CommandTscoffset(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandProfile(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandPt(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandLbr(vector<CommandToken> CommandTokens, string Command);
+
 //
 // hwdbg commands
 //
@@ -785,3 +840,9 @@ CommandXsetbv(vector<CommandToken> CommandTokens, string Command);
 
 VOID
 CommandXsetbvHelp();
+
+VOID
+CommandEvtrace(vector<CommandToken> CommandTokens, string Command);
+
+VOID
+CommandEvtraceHelp();
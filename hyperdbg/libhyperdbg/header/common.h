@@ -239,22 +239,22 @@ BOOLEAN
 ConvertStringToUInt32(string TextToConvert, PUINT32 Result);
 
 BOOLEAN
-ConvertTokenToUInt64(CommandToken TargetToken, PUINT64 Result);
+ConvertTokenToUInt64(const CommandToken & TargetToken, PUINT64 Result);
 
 BOOLEAN
-ConvertTokenToUInt32(CommandToken TargetToken, PUINT32 Result);
+ConvertTokenToUInt32(const CommandToken & TargetToken, PUINT32 Result);
 
 std::string
-GetCaseSensitiveStringFromCommandToken(CommandToken TargetToken);
+GetCaseSensitiveStringFromCommandToken(const CommandToken & TargetToken);
 
 std::string
-GetLowerStringFromCommandToken(CommandToken TargetToken);
+GetLowerStringFromCommandToken(const CommandToken & TargetToken);
 
 BOOLEAN
-CompareLowerCaseStrings(CommandToken TargetToken, const char * StringToCompare);
+CompareLowerCaseStrings(const CommandToken & TargetToken, const char * StringToCompare);
 
 BOOLEAN
-IsTokenBracketString(CommandToken TargetToken);
+IsTokenBracketString(const CommandToken & TargetToken);
 
 BOOLEAN
 HasEnding(string const & fullString, string const & ending);
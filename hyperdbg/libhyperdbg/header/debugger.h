@@ -61,6 +61,10 @@
 #define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PCIDEVINFO_RESULT                   0x1d
 #define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_IDT_ENTRIES                         0x1e
 #define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SMI_OPERATION_RESULT                0x1f
+#define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_STEP_TRACE_RESULT                   0x20
+#define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_BULK_READ_MEMORY                    0x21
+#define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PAUSE_PREFETCH                      0x22
+#define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_TSC_OFFSETTING_RESULT               0x23
 
 //////////////////////////////////////////////////
 //               Event Details                  //
@@ -83,6 +87,7 @@ typedef enum _DEBUGGER_EVENT_PARSING_ERROR_CAUSE
     DEBUGGER_EVENT_PARSING_ERROR_CAUSE_ATTEMPT_TO_BREAK_ON_VMI_MODE                 = 8,
     DEBUGGER_EVENT_PARSING_ERROR_CAUSE_IMMEDIATE_MESSAGING_IN_EVENT_FORWARDING_MODE = 9,
     DEBUGGER_EVENT_PARSING_ERROR_CAUSE_USING_SHORT_CIRCUITING_IN_POST_EVENTS        = 10,
+    DEBUGGER_EVENT_PARSING_ERROR_CAUSE_EVENT_TRACE_IN_DEBUGGER_MODE                 = 11,
 
 } DEBUGGER_EVENT_PARSING_ERROR_CAUSE,
     *PDEBUGGER_EVENT_PARSING_ERROR_CAUSE;
@@ -218,7 +223,7 @@ VOID
 CommandFlushRequestFlush();
 
 UINT64
-GetCommandAttributes(const string & FirstCommand);
+GetCommandAttributes(std::string_view FirstCommand);
 
 VOID
 DetachFromProcess();
@@ -0,0 +1,66 @@
+/**
+ * @file event-trace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers for writing and reading the binary event trace files
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				  Definitions                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The size that the event trace file grows each time
+ * that its mapped view is full
+ *
+ */
+#define EVENT_TRACE_FILE_GROWTH_SIZE (16 * 1024 * 1024)
+
+//////////////////////////////////////////////////
+//				  Structures                    //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A (read-only) mapped view of an event trace file
+ *
+ */
+typedef struct _EVENT_TRACE_MAPPED_FILE
+{
+    HANDLE                          FileHandle;
+    HANDLE                          MapObjectHandle;
+    const UINT8 *                   Buffer;
+    UINT64                          FileSize;
+    vector<EVENT_TRACE_INDEX_ENTRY> Index;
+
+} EVENT_TRACE_MAPPED_FILE, *PEVENT_TRACE_MAPPED_FILE;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+EventTraceWriterOpen(const string & FilePath);
+
+BOOLEAN
+EventTraceWriterIsOpen();
+
+VOID
+EventTraceWriterAppendBlock(const VOID * Buffer, UINT32 BufferLength);
+
+UINT64
+EventTraceWriterGetNumberOfReceivedBlocks();
+
+BOOLEAN
+EventTraceWriterClose(PEVENT_TRACE_FILE_HEADER FinalHeader);
+
+BOOLEAN
+EventTraceMapFile(const string & FilePath, PEVENT_TRACE_MAPPED_FILE MappedFile);
+
+VOID
+EventTraceUnmapFile(PEVENT_TRACE_MAPPED_FILE MappedFile);
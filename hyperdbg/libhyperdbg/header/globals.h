@@ -209,6 +209,20 @@ BYTE g_CurrentRunningInstruction[MAXIMUM_INSTR_SIZE] = {0};
  */
 BOOLEAN g_IsRunningInstruction32Bit = FALSE;
 
+/**
+ * @brief The cache of the memory and the registers of the halted
+ * debuggee (enabled by default)
+ *
+ */
+KD_CACHE g_KdCache = {TRUE};
+
+/**
+ * @brief The options of prefetching the state of the halted core that
+ * are sent to the debuggee
+ *
+ */
+DEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET g_KdPausePrefetchOptions = {0};
+
 /**
  * @brief In debuggee and debugger, we save the handle
  * of the user-mode listening thread for pauses here
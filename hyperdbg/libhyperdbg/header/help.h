@@ -309,6 +309,18 @@ CommandIdtHelp();
 VOID
 CommandSmiHelp();
 
+VOID
+CommandTscoffsetHelp();
+
+VOID
+CommandProfileHelp();
+
+VOID
+CommandPtHelp();
+
+VOID
+CommandLbrHelp();
+
 // Show driver/device randomization info
 VOID
 CommandDrvinfoHelp();
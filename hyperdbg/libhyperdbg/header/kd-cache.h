@@ -0,0 +1,40 @@
+/**
+ * @file kd-cache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers for serving the reads of the halted debuggee from the cache
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+KdCacheInvalidateBeforeRequest(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction);
+
+VOID
+KdCacheLoadPausePacket(PDEBUGGEE_KD_PAUSED_PACKET PausePacket, UINT32 PausePacketLength);
+
+BOOLEAN
+KdCacheReadMemoryFromCache(PDEBUGGER_READ_MEMORY ReadMem);
+
+VOID
+KdCacheInsertReadMemory(PDEBUGGER_READ_MEMORY ReadMem);
+
+BOOLEAN
+KdCacheReadMemoryOrSendPacket(PDEBUGGER_READ_MEMORY ReadMem, UINT32 RequestSize);
+
+BOOLEAN
+KdCacheReadRegistersOrSendPacket(PDEBUGGEE_REGISTER_READ_DESCRIPTION RegDes, UINT32 RegBuffSize);
+
+BOOLEAN
+KdCacheTryEvalRegisterExpression(const string & Expr, UINT64 * Value);
+
+VOID
+KdCacheShowStatistics();
@@ -107,7 +107,7 @@ BOOLEAN
 KdSendTestQueryPacketWithContextToDebuggee(DEBUGGER_TEST_QUERY_STATE Type, UINT64 Context);
 
 BOOLEAN
-KdSendSymbolReloadPacketToDebuggee(UINT32 ProcessId);
+KdSendSymbolReloadPacketToDebuggee(UINT32 ProcessId, UINT64 SymbolTableDigest);
 
 BOOLEAN
 KdSendReadRegisterPacketToDebuggee(PDEBUGGEE_REGISTER_READ_DESCRIPTION RegDes, UINT32 RegBuffSize);
@@ -180,6 +180,21 @@ KdSendSearchRequestPacketToDebuggee(UINT64 * SearchRequestBuffer, UINT32 SearchR
 BOOLEAN
 KdSendStepPacketToDebuggee(DEBUGGER_REMOTE_STEPPING_REQUEST StepRequestType);
 
+BOOLEAN
+KdSendStepTracePacketToDebuggee(UINT32 Count, UINT8 NumberOfRegisters, const UINT8 * RegisterIds);
+
+BOOLEAN
+KdSendReadStepTracePacketToDebuggee(PDEBUGGEE_STEP_TRACE_READ_PACKET ReadPacket, UINT32 ExpectedSize);
+
+BOOLEAN
+KdSendBulkReadMemoryPacketToDebuggee(PDEBUGGER_BULK_READ_MEMORY BulkReadMem, UINT32 RequestSize);
+
+BOOLEAN
+KdSendPausePrefetchOptionsPacketToDebuggee(PDEBUGGEE_PAUSE_PREFETCH_OPTIONS_PACKET PausePrefetchOptions);
+
+BOOLEAN
+KdSendTscOffsettingPacketsToDebuggee(PTSC_OFFSETTING_OPERATION_PACKETS TscOffsettingRequest);
+
 BYTE
 KdComputeDataChecksum(PVOID Buffer, UINT32 Length);
 
@@ -205,7 +220,7 @@ BOOLEAN
 KdCloseConnection();
 
 BOOLEAN
-KdReloadSymbolsInDebuggee(BOOLEAN PauseDebuggee, UINT32 UserProcessId);
+KdReloadSymbolsInDebuggee(BOOLEAN PauseDebuggee, UINT32 UserProcessId, UINT64 DebuggerSymbolTableDigest);
 
 BOOLEAN
 KdSendResponseOfThePingPacket();
@@ -216,10 +231,10 @@ KdUninitializeConnection();
 VOID
 KdSendUsermodePrints(CHAR * Input, UINT32 Length);
 
-VOID
-KdSendSymbolDetailPacket(PMODULE_SYMBOL_DETAIL SymbolDetailPacket,
-                         UINT32                CurrentSymbolInfoIndex,
-                         UINT32                TotalSymbols);
+BOOLEAN
+KdSendSymbolTableBatchPacket(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch,
+                             UINT32                              BatchLength,
+                             PVOID                               Context);
 
 VOID
 KdHandleUserInputInDebuggee(DEBUGGEE_USER_INPUT_PACKET * Descriptor);
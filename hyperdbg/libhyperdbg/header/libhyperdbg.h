@@ -46,6 +46,14 @@ HyperDbgTestCommandParser(CHAR *   Command,
 VOID
 HyperDbgTestCommandParserShowTokens(CHAR * Command);
 
+BOOLEAN
+HyperDbgTestCommandParserBenchmark(CHAR **  Commands,
+                                   UINT32   NumberOfCommands,
+                                   UINT32   NumberOfIterations,
+                                   UINT64 * ParseTime,
+                                   UINT64 * TokenizeTime,
+                                   UINT64 * NumberOfTokens);
+
 INT
 ScriptReadFileAndExecuteCommandline(INT argc, CHAR * argv[]);
 
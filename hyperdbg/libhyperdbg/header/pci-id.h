@@ -1,7 +1,7 @@
 /**
  * @file pci-id.h
  * @author Bjrn Ruytenberg (bjorn@bjornweb.nl)
- * @brief PCI ID-related data structures
+ * @brief PCI ID-related functions
  * @details
  * @version 0.12
  * @date 2024-12-04
@@ -11,31 +11,7 @@
  */
 #pragma once
 
-#define PCI_ID_AS_STR_LENGTH (sizeof(UINT16) * 2)
-#define PCI_NAME_STR_LENGTH  255
-
-typedef struct SubDevice
-{
-    UINT16             SubVendorId;
-    UINT16             SubDeviceId;
-    char               SubSystemName[PCI_NAME_STR_LENGTH];
-    struct SubDevice * Next;
-} SubDevice;
-
-typedef struct Device
-{
-    UINT16          DeviceId;
-    char            DeviceName[PCI_NAME_STR_LENGTH];
-    SubDevice *     SubDevices;
-    struct Device * Next;
-} Device;
-
-typedef struct Vendor
-{
-    UINT16   VendorId;
-    char     VendorName[PCI_NAME_STR_LENGTH];
-    Device * Devices;
-} Vendor;
+#define PCI_NAME_STR_LENGTH 255
 
 //
 // PCI ID database courtesy of PCI ID Database (pciutils) project at
@@ -43,16 +19,19 @@ typedef struct Vendor
 //
 #define PCI_ID_DATABASE_PATH "constants\\pci.ids"
 
+//
+// Binary index of the PCI ID database (rebuilt whenever the pci.ids changes)
+//
+#define PCI_ID_INDEX_PATH "constants\\pci.ids.idx"
+
 //////////////////////////////////////////////////
 //					  Functions                 //
 //////////////////////////////////////////////////
-Vendor *
-GetVendorById(UINT16 VendorId);
-void
-FreeVendor(Vendor * VendorToFree);
 void
 FreePciIdDatabase();
-Device *
-GetDeviceFromVendor(Vendor * VendorToUse, UINT16 DeviceId);
-SubDevice *
-GetSubDeviceFromDevice(Device * DeviceToUse, UINT16 SubVendorId, UINT16 SubDeviceId);
+const char *
+PciIdGetVendorName(UINT16 VendorId);
+const char *
+PciIdGetDeviceName(UINT16 VendorId, UINT16 DeviceId);
+const char *
+PciIdGetSubsystemName(UINT16 VendorId, UINT16 DeviceId, UINT16 SubVendorId, UINT16 SubDeviceId);
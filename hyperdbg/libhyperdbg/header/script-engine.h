@@ -84,6 +84,15 @@ ScriptAutomaticStatementsTestWrapper(const string & Expr, UINT64 ExpectationValu
 PVOID
 ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny);
 
+BOOLEAN
+ScriptEngineWrapperTestFilter(const CHAR * Expr,
+                              GUEST_REGS * States,
+                              UINT32       NumberOfStates,
+                              BOOLEAN *    FilterResults,
+                              BOOLEAN *    InterpreterResults,
+                              UINT64 *     FilterTime,
+                              UINT64 *     InterpreterTime);
+
 VOID
 PrintSymbolBufferWrapper(PVOID SymbolBuffer);
 
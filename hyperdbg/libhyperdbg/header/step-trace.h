@@ -0,0 +1,22 @@
+/**
+ * @file step-trace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers for receiving and showing the counted step traces
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+StepTraceReadFromDebuggee(PSTEP_TRACE_HEADER Header, vector<UINT8> & Data);
+
+BOOLEAN
+StepTraceShowSteps(const STEP_TRACE_HEADER * Header, const vector<UINT8> & Data, BOOLEAN Is32Bit);
@@ -27,5 +27,8 @@ SteppingStepOver();
 BOOLEAN
 SteppingInstrumentationStepInForTracking();
 
+BOOLEAN
+SteppingInstrumentationStepInTrace(UINT32 Count, UINT8 NumberOfRegisters, const UINT8 * RegisterIds);
+
 BOOLEAN
 SteppingStepOverForGu(BOOLEAN LastInstruction);
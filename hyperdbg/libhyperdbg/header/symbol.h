@@ -54,11 +54,10 @@ SymbolDeleteSymTable();
 BOOLEAN
 SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
                        PUINT32                 StoredLength,
-                       UINT32                  UserProcessId,
-                       BOOLEAN                 SendOverSerial);
+                       UINT32                  UserProcessId);
 
 BOOLEAN
-SymbolBuildAndUpdateSymbolTable(PMODULE_SYMBOL_DETAIL SymbolDetail);
+SymbolUpdateSymbolTableFromBatch(PDEBUGGER_UPDATE_SYMBOL_TABLE_BATCH Batch, UINT32 BatchLength);
 
 VOID
 SymbolInitialReload();
@@ -66,8 +65,8 @@ SymbolInitialReload();
 BOOLEAN
 SymbolLocalReload(UINT32 UserProcessId);
 
-VOID
-SymbolPrepareDebuggerWithSymbolInfo(UINT32 UserProcessId);
+BOOLEAN
+SymbolPrepareDebuggerWithSymbolInfo(UINT32 UserProcessId, UINT64 DebuggerSymbolTableDigest);
 
 BOOLEAN
 SymbolReloadSymbolTableInDebuggerMode(UINT32 ProcessId);
@@ -102,7 +102,11 @@ typedef const wchar_t *LPCWCHAR, *PCWCHAR;
 #include <cctype>
 #include <cstring>
 #include <unordered_set>
+#include <unordered_map>
+#include <string_view>
 #include <regex>
+#include <mutex>
+#include <future>
 
 //
 // Scope definitions
@@ -141,6 +145,23 @@ typedef const wchar_t *LPCWCHAR, *PCWCHAR;
 #include "SDK/imports/user/HyperDbgScriptImports.h"
 #include "SDK/imports/user/HyperDbgLibImports.h"
 
+//
+// Components
+//
+#include "components/symbol-sync/header/SymbolSync.h"
+#include "components/event-trace/header/EventTraceRecorder.h"
+#include "components/step-trace/header/StepTraceEncoder.h"
+#include "components/bulk-read/header/BulkRead.h"
+#include "components/pci-id-index/header/PciIdIndex.h"
+#include "components/kd-cache/header/KdCache.h"
+#include "components/script-filter/header/ScriptFilter.h"
+#include "components/sample-profile/header/SampleProfile.h"
+
+//
+// Decoder of the packets of Intel Processor Trace
+//
+#include "components/pt-decode/header/PtDecode.h"
+
 //
 // PCI IDs
 //
@@ -172,6 +193,10 @@ typedef const wchar_t *LPCWCHAR, *PCWCHAR;
 #include "header/steppings.h"
 #include "header/rev-ctrl.h"
 #include "header/assembler.h"
+#include "header/event-trace.h"
+#include "header/step-trace.h"
+#include "header/bulk-read.h"
+#include "header/kd-cache.h"
 
 //
 // hwdbg
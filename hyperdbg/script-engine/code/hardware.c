@@ -63,6 +63,7 @@ HardwareScriptInterpreterShowScriptCapabilities(HWDBG_INSTANCE_INFORMATION * Ins
                  (InstanceInfo->scriptCapabilities.func_jnz && InstanceInfo->scriptCapabilities.conditional_statements_and_comparison_operators) ? "supported" : "not supported");
     ShowMessages("\tmove: %s \n", InstanceInfo->scriptCapabilities.func_mov ? "supported" : "not supported");
     ShowMessages("\tprintf: %s \n", InstanceInfo->scriptCapabilities.func_printf ? "supported" : "not supported");
+    ShowMessages("\tbit-packed script buffer: %s \n", InstanceInfo->scriptCapabilities.bit_packed_script_buffer ? "supported" : "not supported");
     ShowMessages("\n");
 }
 
@@ -507,6 +508,88 @@ HardwareScriptInterpreterCompressBuffer(UINT64 * Buffer,
     return TRUE;
 }
 
+/**
+ * @brief Function to pack the short symbol buffer at the bit level
+ * @details Instead of using a separate BRAM word for the type and value of
+ * each symbol, the type takes HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH bits and the
+ * value takes exactly the script variable length and symbols are put back-to-back
+ * in the BRAM words
+ *
+ * @param Buffer
+ * @param BufferLength
+ * @param ScriptVariableLength
+ * @param BramDataWidth
+ * @param NewBufferSize
+ * @param NumberOfBytesPerChunk
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+HardwareScriptInterpreterBitPackBuffer(HWDBG_SHORT_SYMBOL * Buffer,
+                                       size_t               BufferLength,
+                                       UINT32               ScriptVariableLength,
+                                       UINT32               BramDataWidth,
+                                       size_t *             NewBufferSize,
+                                       size_t *             NumberOfBytesPerChunk)
+{
+    if (ScriptVariableLength <= 7 || ScriptVariableLength > 64)
+    {
+        ShowMessages("err, invalid bit size, it should be between 7 and 64\n");
+        return FALSE;
+    }
+
+    if (ScriptVariableLength > BramDataWidth)
+    {
+        ShowMessages("err, script variable length cannot be more than the BRAM data width\n");
+        return FALSE;
+    }
+
+    //
+    // Calculate the number of symbols and the size of the packed buffer
+    //
+    UINT32 NumberOfSymbols = (UINT32)(BufferLength / sizeof(HWDBG_SHORT_SYMBOL));
+
+    *NumberOfBytesPerChunk = (BramDataWidth + 7) / 8; // ceil(BramDataWidth / 8)
+    *NewBufferSize         = HwdbgScriptPackingComputePackedSize(NumberOfSymbols, ScriptVariableLength, BramDataWidth);
+
+    if (*NewBufferSize > BufferLength)
+    {
+        ShowMessages("err, the packed buffer is larger than the original buffer\n");
+        return FALSE;
+    }
+
+    //
+    // Create a temporary buffer to hold the packed data
+    //
+    UINT8 * TempBuffer = (UINT8 *)malloc(*NewBufferSize);
+
+    if (TempBuffer == NULL)
+    {
+        ShowMessages("err, memory allocation failed\n");
+        return FALSE;
+    }
+
+    if (!HwdbgScriptPackingPackSymbols(Buffer, NumberOfSymbols, ScriptVariableLength, BramDataWidth, TempBuffer, *NewBufferSize))
+    {
+        ShowMessages("err, the symbol type does not fit in the bit-packed script buffer\n");
+        free(TempBuffer);
+        return FALSE;
+    }
+
+    //
+    // Copy the packed data back to the original buffer
+    //
+    RtlZeroMemory(Buffer, BufferLength);
+    memcpy(Buffer, TempBuffer, *NewBufferSize);
+
+    //
+    // Free the temporary buffer
+    //
+    free(TempBuffer);
+
+    return TRUE;
+}
+
 /**
  * @brief Function to compress the buffer
  *
@@ -120,6 +120,9 @@ const struct _SCRIPT_ENGINE_TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "IF_STATEMENT"},
@@ -313,6 +316,7 @@ const struct _SCRIPT_ENGINE_TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "spinlock_unlock"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_UNLOCK"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_sc"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EVENT_SC"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "microsleep"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MICROSLEEP"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "lbr_snapshot"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@LBR_SNAPSHOT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "printf"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "STRING"},{SEMANTIC_RULE, "@VARGSTART"},{NON_TERMINAL, "VA"},{SEMANTIC_RULE, "@PRINTF"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "pause"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PAUSE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "flush"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@FLUSH"},{SPECIAL_TOKEN, ")"}},
@@ -321,6 +325,8 @@ const struct _SCRIPT_ENGINE_TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "event_trace_step_out"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@EVENT_TRACE_STEP_OUT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_trace_instrumentation_step"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@EVENT_TRACE_INSTRUMENTATION_STEP"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_trace_instrumentation_step_in"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@EVENT_TRACE_INSTRUMENTATION_STEP_IN"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "pt_start"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PT_START"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "pt_stop"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PT_STOP"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "rdtsc"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@RDTSC"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "rdtscp"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@RDTSCP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "spinlock_lock_custom_wait"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK_CUSTOM_WAIT"},{SPECIAL_TOKEN, ")"}},
@@ -562,6 +568,7 @@ const unsigned int RhsSize[RULES_COUNT]=
 5,
 5,
 5,
+5,
 7,
 4,
 4,
@@ -570,6 +577,8 @@ const unsigned int RhsSize[RULES_COUNT]=
 4,
 4,
 4,
+4,
+4,
 5,
 5,
 7,
@@ -748,229 +757,232 @@ const unsigned int RhsSize[RULES_COUNT]=
 };
 const char* NoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"END_OF_IF",
-"E0'",
-"RETURN",
-"WstringNumber",
-"L_VALUE",
-"E5",
-"E2",
-"VARIABLE_TYPE2",
-"EXPRESSION",
-"VA3",
-"MULTIPLE_ASSIGNMENT",
-"E4'",
-"DO_WHILE_STATEMENT",
 "S",
+"IF_STATEMENT",
+"MULTIPLE_ASSIGNMENT2",
+"E0'",
+"VA",
 "WSTRING",
 "FOR_STATEMENT",
-"VARIABLE_TYPE4",
-"E1'",
-"STATEMENT",
+"ELSIF_STATEMENT",
+"StringNumber",
+"VARIABLE_TYPE3",
 "CALL_FUNC_STATEMENT",
-"VA2",
+"MULTIPLE_ASSIGNMENT",
 "INC_DEC'",
-"ELSE_STATEMENT",
-"E2'",
-"E1",
-"STATEMENT2",
-"ASSIGNMENT_STATEMENT'",
+"E4'",
 "E3'",
-"STRING",
-"VARIABLE_TYPE6",
-"MULTIPLE_ASSIGNMENT2",
-"BOOLEAN_EXPRESSION",
-"E12",
-"S2",
-"StringNumber",
 "E3",
-"ASSIGNMENT_STATEMENT",
-"ELSIF_STATEMENT",
 "VARIABLE_TYPE5",
-"ELSIF_STATEMENT'",
-"VARIABLE_TYPE1",
-"VARIABLE_TYPE3",
 "E4",
+"STATEMENT",
+"E2",
+"VARIABLE_TYPE4",
+"END_OF_IF",
+"S2",
+"VA2",
+"E5",
+"ELSE_STATEMENT",
+"ASSIGNMENT_STATEMENT'",
 "E5'",
-"INC_DEC",
 "SIMPLE_ASSIGNMENT",
-"IF_STATEMENT",
+"WstringNumber",
+"BOOLEAN_EXPRESSION",
+"RETURN",
+"VA3",
+"E1'",
+"STATEMENT2",
+"E2'",
+"EXPRESSION",
+"ASSIGNMENT_STATEMENT",
+"L_VALUE",
+"DO_WHILE_STATEMENT",
+"VARIABLE_TYPE2",
+"ELSIF_STATEMENT'",
+"E12",
+"INC_DEC",
+"VARIABLE_TYPE1",
+"E1",
+"STRING",
 "WHILE_STATEMENT",
-"VA"
+"VARIABLE_TYPE6"
 };
 const char* TerminalMap[TERMINAL_COUNT]= 
 {
-"memcmp",
-"_register",
-"_function_parameter_id",
-"<<=",
-"db",
-"dw",
-"continue",
-"disassemble_len",
-"do",
-"strncmp",
-"--",
-"formats",
-"interlocked_increment",
-"strlen",
-"interlocked_exchange",
-"_hex",
-"event_sc",
-"|=",
-"test_statement",
-"^",
-"disassemble_len32",
-"hi_pa",
-"dq_pa",
-"flush",
-"else",
-"event_trace_step_in",
-"/=",
-"~",
-"low_pa",
 "dd_pa",
-"rdtsc",
-"++",
-"_decimal",
-"break",
-"%=",
-"hi",
-"eb_pa",
-"ed",
-"disassemble_len64",
+"return",
 "memcpy",
 ";",
-"event_inject_error_code",
-"wcscmp",
-"^=",
-"eb",
+"~",
+"/=",
+"eb_pa",
+"eq_pa",
+"event_trace_instrumentation_step_in",
+"ed_pa",
+"++",
+"pt_start",
+"test_statement",
+"rdtscp",
+"interlocked_exchange",
+"+=",
 "poi",
-"{",
+"&",
+"%=",
+"/",
+"event_inject_error_code",
 ">>=",
-"not",
-"low",
+"_script_variable_type",
+"strlen",
+"*=",
+"spinlock_unlock",
+"wcsncmp",
+"reference",
+"do",
+"_function_id",
+"disassemble_len",
+"continue",
 "_wstring",
-"-=",
-"_pseudo_register",
-"+",
 "poi_pa",
-"event_disable",
-"print",
-"+=",
-"*=",
-"dq",
-"&=",
-"interlocked_compare_exchange",
+"pt_stop",
+"spinlock_lock_custom_wait",
+"}",
 "_binary",
-"event_enable",
+"check_address",
+">>",
+"_hex",
+"|=",
+"event_trace_step",
+"_register",
+"|",
+"$",
+"dq_pa",
 "wcslen",
-"_local_id",
-"strcmp",
-",",
-"spinlock_lock_custom_wait",
-"reference",
-"microsleep",
-"return",
-"elsif",
-"eq",
-"_function_id",
-"/",
-"interlocked_decrement",
-"interlocked_exchange_add",
-"ed_pa",
-"event_trace_step_out",
 "if",
-"eq_pa",
-"_script_variable_type",
-"db_pa",
-"$",
-">>",
-"event_clear",
-"event_inject",
-"physical_to_virtual",
-"spinlock_unlock",
+"disassemble_len32",
 "memcpy_pa",
-"spinlock_lock",
-"event_trace_instrumentation_step",
 "*",
-"&",
-"while",
+"<<=",
+"event_trace_instrumentation_step",
+"hi_pa",
+"event_trace_step_out",
+"interlocked_compare_exchange",
+"spinlock_lock",
+"elsif",
+"rdtsc",
+"{",
 "-",
-"}",
-"=",
-"rdtscp",
-"wcsncmp",
-"for",
+"--",
+"_decimal",
+"event_clear",
+"&=",
 "%",
-"_octal",
-"_string",
+"^",
+")",
+"db_pa",
+"dw",
+"eq",
+"printf",
+"interlocked_exchange_add",
+"memcmp",
+"pause",
+"event_enable",
 "_global_id",
+"strncmp",
+"(",
+"hi",
+"while",
+"ed",
+"interlocked_increment",
+"lbr_snapshot",
 "virtual_to_physical",
-"<<",
-"dd",
-"event_trace_step",
+"-=",
+",",
 "dw_pa",
-"|",
+"low",
+"microsleep",
+"print",
+"flush",
+"not",
+"_pseudo_register",
+"dq",
+"event_trace_step_in",
+"event_sc",
+"_string",
+"+",
+"_function_parameter_id",
+"_octal",
+"wcscmp",
+"interlocked_decrement",
+"strcmp",
+"break",
+"formats",
+"^=",
+"disassemble_len64",
+"event_disable",
+"event_inject",
+"eb",
+"else",
 "neg",
-"printf",
-")",
-"event_trace_instrumentation_step_in",
-"pause",
-"check_address",
-"("
+"dd",
+"low_pa",
+"physical_to_virtual",
+"<<",
+"for",
+"db",
+"=",
+"_local_id"
 };
 const int ParseTable[NONETERMINAL_COUNT][TERMINAL_COUNT]= 
 {
-	{127		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,2147483648		,127		,2147483648		,127		,2147483648		,127		,127		,127		,127		,2147483648		,127		,2147483648		,2147483648		,127		,127		,127		,2147483648		,2147483648		,127		,2147483648		,127		,127		,127		,127		,127		,2147483648		,127		,127		,2147483648		,127		,127		,127		,2147483648		,127		,127		,2147483648		,2147483648		,2147483648		,2147483648		,127		,127		,127		,2147483648		,2147483648		,127		,2147483648		,127		,2147483648		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,2147483648		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,127		,2147483648		,2147483648		,127		,2147483648		,127		,2147483648		,127		,127		,127		,2147483648		,2147483648		,2147483648		,127		,127		,2147483648		,127		,127		,127		,2147483648		,127		,127		,2147483648		,127		,127		,127		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,155		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{28		,28		,28		,2147483648		,28		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,28		,28		,28		,28		,2147483648		,2147483648		,2147483648		,2147483648		,28		,28		,28		,2147483648		,2147483648		,2147483648		,2147483648		,28		,28		,28		,28		,2147483648		,28		,2147483648		,2147483648		,28		,28		,28		,28		,2147483648		,27		,2147483648		,28		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,28		,28		,2147483648		,28		,28		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,28		,28		,2147483648		,28		,28		,28		,2147483648		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,28		,28		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,28		,2147483648		,28		,28		,2147483648		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,28		,28	},
-	{244		,244		,244		,2147483648		,244		,244		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,244		,244		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,244		,244		,244		,2147483648		,244		,2147483648		,2147483648		,244		,244		,244		,244		,2147483648		,2147483648		,2147483648		,244		,2147483648		,244		,244		,2147483648		,2147483648		,244		,244		,245		,2147483648		,244		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,244		,244		,2147483648		,244		,244		,244		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,244		,244		,2147483648		,244		,244		,244		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,244		,2147483648		,244		,2147483648		,2147483648		,244		,244		,2147483648		,2147483648		,244		,2147483648		,244		,244		,2147483648		,244		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,244	},
-	{2147483648		,236		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{171		,171		,171		,2147483648		,171		,171		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,171		,171		,171		,171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,171		,171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,171		,171		,171		,2147483648		,171		,2147483648		,2147483648		,171		,171		,171		,171		,2147483648		,2147483648		,2147483648		,171		,2147483648		,171		,171		,2147483648		,2147483648		,171		,171		,2147483648		,2147483648		,171		,171		,171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,171		,171		,2147483648		,171		,171		,171		,2147483648		,2147483648		,171		,2147483648		,2147483648		,2147483648		,171		,171		,2147483648		,171		,171		,171		,2147483648		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,171		,2147483648		,171		,2147483648		,2147483648		,171		,171		,2147483648		,2147483648		,171		,2147483648		,171		,171		,2147483648		,171		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,171	},
-	{160		,160		,160		,2147483648		,160		,160		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,160		,160		,160		,160		,2147483648		,2147483648		,2147483648		,2147483648		,160		,160		,160		,2147483648		,2147483648		,2147483648		,2147483648		,160		,160		,160		,160		,2147483648		,160		,2147483648		,2147483648		,160		,160		,160		,160		,2147483648		,2147483648		,2147483648		,160		,2147483648		,160		,160		,2147483648		,2147483648		,160		,160		,2147483648		,2147483648		,160		,160		,160		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,160		,160		,2147483648		,160		,160		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,160		,160		,2147483648		,160		,160		,160		,2147483648		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,160		,160		,2147483648		,160		,2147483648		,2147483648		,160		,160		,2147483648		,2147483648		,160		,2147483648		,160		,160		,2147483648		,160		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,160		,160	},
-	{2147483648		,31		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{154		,154		,154		,2147483648		,154		,154		,2147483648		,154		,2147483648		,154		,2147483648		,2147483648		,154		,154		,154		,154		,2147483648		,2147483648		,2147483648		,2147483648		,154		,154		,154		,2147483648		,2147483648		,2147483648		,2147483648		,154		,154		,154		,154		,2147483648		,154		,2147483648		,2147483648		,154		,154		,154		,154		,2147483648		,2147483648		,2147483648		,154		,2147483648		,154		,154		,2147483648		,2147483648		,154		,154		,2147483648		,2147483648		,154		,154		,154		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,154		,154		,2147483648		,154		,154		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,154		,154		,2147483648		,154		,154		,154		,2147483648		,2147483648		,154		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,154		,154		,2147483648		,154		,2147483648		,2147483648		,154		,154		,2147483648		,2147483648		,154		,2147483648		,154		,154		,2147483648		,154		,2147483648		,154		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,154		,154	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,168		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,169		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{0		,0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,2147483648		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,2147483648		,2147483648		,0		,0		,0		,2147483648		,2147483648		,0		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,0		,2147483648		,0		,0		,1		,2147483648		,0		,0		,2147483648		,2147483648		,2147483648		,2147483648		,0		,0		,0		,2147483648		,2147483648		,0		,2147483648		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,0		,2147483648		,2147483648		,0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,2		,2147483648		,0		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,2147483648		,2		,2147483648		,0		,0		,0		,2147483648		,2147483648		,2147483648		,0		,0		,2147483648		,0		,0		,0		,2147483648		,0		,0		,2147483648		,0		,0		,0		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,233		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,34	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{9		,7		,7		,2147483648		,9		,9		,11		,9		,5		,9		,2147483648		,9		,9		,9		,9		,2147483648		,9		,2147483648		,9		,2147483648		,9		,9		,9		,9		,2147483648		,9		,2147483648		,2147483648		,9		,9		,9		,2147483648		,2147483648		,10		,2147483648		,9		,9		,9		,9		,9		,2147483648		,9		,9		,2147483648		,9		,9		,2147483648		,2147483648		,9		,9		,2147483648		,2147483648		,2147483648		,2147483648		,9		,9		,9		,2147483648		,2147483648		,9		,2147483648		,9		,2147483648		,9		,9		,7		,9		,2147483648		,9		,9		,9		,2147483648		,2147483648		,9		,8		,2147483648		,9		,9		,9		,9		,3		,9		,12		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,9		,2147483648		,2147483648		,4		,2147483648		,2147483648		,2147483648		,9		,9		,6		,2147483648		,2147483648		,2147483648		,7		,9		,2147483648		,9		,9		,9		,2147483648		,9		,9		,2147483648		,9		,9		,9		,2147483648	},
-	{111		,2147483648		,2147483648		,2147483648		,76		,78		,2147483648		,85		,2147483648		,112		,2147483648		,54		,88		,109		,103		,2147483648		,61		,2147483648		,58		,2147483648		,86		,94		,99		,65		,2147483648		,67		,2147483648		,2147483648		,95		,97		,71		,2147483648		,2147483648		,2147483648		,2147483648		,81		,105		,100		,87		,116		,2147483648		,115		,114		,2147483648		,101		,75		,2147483648		,2147483648		,83		,82		,2147483648		,2147483648		,2147483648		,2147483648		,93		,56		,53		,2147483648		,2147483648		,79		,2147483648		,108		,2147483648		,55		,113		,2147483648		,110		,2147483648		,73		,90		,62		,2147483648		,2147483648		,102		,2147483648		,2147483648		,89		,104		,106		,68		,2147483648		,107		,2147483648		,96		,2147483648		,2147483648		,57		,74		,91		,60		,117		,59		,69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,72		,118		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,77		,66		,98		,2147483648		,80		,63		,2147483648		,70		,64		,84		,2147483648	},
-	{239		,239		,239		,2147483648		,239		,239		,2147483648		,239		,2147483648		,239		,2147483648		,2147483648		,239		,239		,239		,239		,2147483648		,2147483648		,2147483648		,2147483648		,239		,239		,239		,2147483648		,2147483648		,2147483648		,2147483648		,239		,239		,239		,239		,2147483648		,239		,2147483648		,2147483648		,239		,239		,239		,239		,2147483648		,2147483648		,2147483648		,239		,2147483648		,239		,239		,2147483648		,2147483648		,239		,239		,2147483648		,2147483648		,239		,239		,239		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,239		,239		,2147483648		,239		,239		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,239		,239		,2147483648		,239		,239		,239		,2147483648		,2147483648		,239		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,239		,239		,2147483648		,239		,2147483648		,2147483648		,239		,239		,2147483648		,2147483648		,239		,2147483648		,239		,239		,2147483648		,239		,2147483648		,239		,2147483648		,239		,2147483648		,238		,2147483648		,2147483648		,239		,239	},
-	{2147483648		,2147483648		,2147483648		,143		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,147		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,141		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,142		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,148		,2147483648		,2147483648		,146		,2147483648		,2147483648		,2147483648		,144		,2147483648		,2147483648		,2147483648		,139		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,140		,2147483648		,145		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,148		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{126		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,2147483648		,126		,2147483648		,126		,2147483648		,126		,126		,126		,126		,125		,126		,2147483648		,2147483648		,126		,126		,126		,2147483648		,2147483648		,126		,2147483648		,126		,126		,126		,126		,126		,2147483648		,126		,126		,2147483648		,126		,126		,126		,2147483648		,126		,126		,2147483648		,2147483648		,2147483648		,2147483648		,126		,126		,126		,2147483648		,2147483648		,126		,2147483648		,126		,2147483648		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,2147483648		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,126		,2147483648		,2147483648		,126		,2147483648		,126		,2147483648		,126		,126		,126		,2147483648		,2147483648		,2147483648		,126		,126		,2147483648		,126		,126		,126		,2147483648		,126		,126		,2147483648		,126		,126		,126		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{157		,157		,157		,2147483648		,157		,157		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,157		,157		,157		,157		,2147483648		,2147483648		,2147483648		,2147483648		,157		,157		,157		,2147483648		,2147483648		,2147483648		,2147483648		,157		,157		,157		,157		,2147483648		,157		,2147483648		,2147483648		,157		,157		,157		,157		,2147483648		,2147483648		,2147483648		,157		,2147483648		,157		,157		,2147483648		,2147483648		,157		,157		,2147483648		,2147483648		,157		,157		,157		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,157		,157		,2147483648		,157		,157		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,157		,157		,2147483648		,157		,157		,157		,2147483648		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,157		,157		,2147483648		,157		,2147483648		,2147483648		,157		,157		,2147483648		,2147483648		,157		,2147483648		,157		,157		,2147483648		,157		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,157		,157	},
-	{22		,20		,20		,2147483648		,22		,22		,24		,22		,18		,22		,2147483648		,22		,22		,22		,22		,2147483648		,22		,2147483648		,22		,2147483648		,22		,22		,22		,22		,2147483648		,22		,2147483648		,2147483648		,22		,22		,22		,2147483648		,2147483648		,23		,2147483648		,22		,22		,22		,22		,22		,2147483648		,22		,22		,2147483648		,22		,22		,2147483648		,2147483648		,22		,22		,2147483648		,2147483648		,2147483648		,2147483648		,22		,22		,22		,2147483648		,2147483648		,22		,2147483648		,22		,2147483648		,22		,22		,20		,22		,2147483648		,22		,22		,22		,26		,2147483648		,22		,21		,2147483648		,22		,22		,22		,22		,16		,22		,25		,22		,2147483648		,2147483648		,22		,22		,22		,22		,22		,22		,22		,2147483648		,2147483648		,17		,2147483648		,2147483648		,2147483648		,22		,22		,19		,2147483648		,2147483648		,2147483648		,20		,22		,2147483648		,22		,22		,22		,2147483648		,22		,22		,2147483648		,22		,22		,22		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,46		,2147483648		,2147483648		,2147483648		,2147483648		,40		,2147483648		,2147483648		,47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,51		,2147483648		,2147483648		,2147483648		,49		,2147483648		,2147483648		,2147483648		,44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,43		,45		,2147483648		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,38		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,152		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,149		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,149		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{214		,220		,220		,2147483648		,179		,181		,2147483648		,188		,2147483648		,215		,2147483648		,2147483648		,191		,212		,206		,222		,2147483648		,2147483648		,2147483648		,2147483648		,189		,197		,202		,2147483648		,2147483648		,2147483648		,2147483648		,229		,198		,200		,176		,2147483648		,223		,2147483648		,2147483648		,184		,208		,203		,190		,2147483648		,2147483648		,2147483648		,217		,2147483648		,204		,178		,2147483648		,2147483648		,186		,185		,2147483648		,2147483648		,226		,228		,196		,2147483648		,2147483648		,2147483648		,2147483648		,182		,2147483648		,211		,225		,2147483648		,216		,220		,213		,2147483648		,2147483648		,193		,2147483648		,2147483648		,2147483648		,205		,221		,2147483648		,192		,207		,209		,2147483648		,2147483648		,210		,2147483648		,199		,2147483648		,2147483648		,2147483648		,2147483648		,194		,2147483648		,2147483648		,2147483648		,2147483648		,230		,231		,2147483648		,227		,2147483648		,2147483648		,177		,218		,2147483648		,2147483648		,224		,2147483648		,220		,195		,2147483648		,180		,2147483648		,201		,2147483648		,183		,2147483648		,2147483648		,2147483648		,2147483648		,187		,219	},
-	{13		,13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,2147483648		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,2147483648		,2147483648		,13		,13		,13		,2147483648		,2147483648		,13		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,13		,2147483648		,13		,13		,14		,2147483648		,13		,13		,2147483648		,2147483648		,2147483648		,2147483648		,13		,13		,13		,2147483648		,2147483648		,13		,2147483648		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,13		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,13		,13		,2147483648		,2147483648		,13		,2147483648		,15		,2147483648		,13		,13		,13		,2147483648		,2147483648		,2147483648		,13		,13		,2147483648		,13		,13		,13		,2147483648		,13		,13		,2147483648		,13		,13		,13		,2147483648	},
-	{242		,242		,242		,2147483648		,242		,242		,2147483648		,242		,2147483648		,242		,2147483648		,2147483648		,242		,242		,242		,242		,2147483648		,2147483648		,2147483648		,2147483648		,242		,242		,242		,2147483648		,2147483648		,2147483648		,2147483648		,242		,242		,242		,242		,2147483648		,242		,2147483648		,2147483648		,242		,242		,242		,242		,2147483648		,2147483648		,2147483648		,242		,2147483648		,242		,242		,2147483648		,2147483648		,242		,242		,2147483648		,2147483648		,242		,242		,242		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,242		,242		,2147483648		,242		,242		,242		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,242		,242		,2147483648		,242		,242		,242		,2147483648		,2147483648		,242		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,242		,242		,2147483648		,242		,2147483648		,2147483648		,242		,242		,2147483648		,2147483648		,242		,243		,242		,242		,2147483648		,242		,2147483648		,242		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,242		,242	},
-	{163		,163		,163		,2147483648		,163		,163		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,163		,163		,163		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,163		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,163		,163		,163		,2147483648		,163		,2147483648		,2147483648		,163		,163		,163		,163		,2147483648		,2147483648		,2147483648		,163		,2147483648		,163		,163		,2147483648		,2147483648		,163		,163		,2147483648		,2147483648		,163		,163		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,163		,163		,2147483648		,163		,163		,163		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,163		,163		,2147483648		,163		,163		,163		,2147483648		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,163		,2147483648		,163		,2147483648		,2147483648		,163		,163		,2147483648		,2147483648		,163		,2147483648		,163		,163		,2147483648		,163		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,163	},
-	{2147483648		,39		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{123		,123		,123		,2147483648		,123		,123		,123		,123		,123		,123		,2147483648		,123		,123		,123		,123		,2147483648		,123		,2147483648		,123		,2147483648		,123		,123		,123		,123		,123		,123		,2147483648		,2147483648		,123		,123		,123		,2147483648		,2147483648		,123		,2147483648		,123		,123		,123		,123		,123		,2147483648		,123		,123		,2147483648		,123		,123		,123		,2147483648		,123		,123		,2147483648		,2147483648		,2147483648		,2147483648		,123		,123		,123		,2147483648		,2147483648		,123		,2147483648		,123		,2147483648		,123		,123		,123		,123		,2147483648		,123		,123		,123		,123		,122		,123		,123		,2147483648		,123		,123		,123		,123		,123		,123		,123		,123		,123		,2147483648		,123		,123		,123		,123		,123		,123		,123		,2147483648		,2147483648		,123		,2147483648		,123		,2147483648		,123		,123		,123		,2147483648		,2147483648		,2147483648		,123		,123		,2147483648		,123		,123		,123		,2147483648		,123		,123		,2147483648		,123		,123		,123		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,35		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{124		,124		,124		,2147483648		,124		,124		,124		,124		,124		,124		,2147483648		,124		,124		,124		,124		,2147483648		,124		,2147483648		,124		,2147483648		,124		,124		,124		,124		,124		,124		,2147483648		,2147483648		,124		,124		,124		,2147483648		,2147483648		,124		,2147483648		,124		,124		,124		,124		,124		,2147483648		,124		,124		,2147483648		,124		,124		,124		,2147483648		,124		,124		,2147483648		,2147483648		,2147483648		,2147483648		,124		,124		,124		,2147483648		,2147483648		,124		,2147483648		,124		,2147483648		,124		,124		,124		,124		,2147483648		,124		,124		,124		,124		,2147483648		,124		,124		,2147483648		,124		,124		,124		,124		,124		,124		,124		,124		,124		,2147483648		,124		,124		,124		,124		,124		,124		,124		,2147483648		,2147483648		,124		,2147483648		,124		,2147483648		,124		,124		,124		,2147483648		,2147483648		,2147483648		,124		,124		,2147483648		,124		,124		,124		,2147483648		,124		,124		,2147483648		,124		,124		,124		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{167		,167		,167		,2147483648		,167		,167		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,167		,167		,167		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,167		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,167		,167		,167		,2147483648		,167		,2147483648		,2147483648		,167		,167		,167		,167		,2147483648		,2147483648		,2147483648		,167		,2147483648		,167		,167		,2147483648		,2147483648		,167		,167		,2147483648		,2147483648		,167		,167		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,167		,167		,2147483648		,167		,167		,167		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,167		,167		,2147483648		,167		,167		,167		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,167		,2147483648		,167		,2147483648		,2147483648		,167		,167		,2147483648		,2147483648		,167		,2147483648		,167		,167		,2147483648		,167		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,167	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,175		,2147483648		,175		,2147483648		,175		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,134		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,132		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,121		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,128		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,119		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,120		,2147483648		,2147483648		,2147483648		,2147483648	}
+	{0		,2147483648		,0		,2147483648		,2147483648		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,2147483648		,2147483648		,2147483648		,0		,2147483648		,0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,2		,2147483648		,0		,2147483648		,2147483648		,2147483648		,0		,0		,2147483648		,2		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,1		,2147483648		,2147483648		,2147483648		,0		,2147483648		,2147483648		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,2147483648		,2147483648		,0		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,2147483648		,0	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,124		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,155		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,123		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,122		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648	},
+	{126		,126		,126		,2147483648		,2147483648		,2147483648		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,2147483648		,126		,2147483648		,2147483648		,2147483648		,126		,2147483648		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,2147483648		,126		,2147483648		,2147483648		,2147483648		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,2147483648		,2147483648		,126		,126		,126		,126		,126		,125		,126		,126		,2147483648		,2147483648		,2147483648		,126		,2147483648		,2147483648		,2147483648		,2147483648		,126		,126		,126		,126		,126		,126		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,2147483648		,2147483648		,126		,126		,126		,126		,126		,126		,2147483648		,126		,126		,126		,2147483648		,2147483648		,126		,2147483648		,126		,126		,126		,126		,126		,2147483648		,126		,126		,126		,126		,126		,126		,126		,126		,126		,2147483648		,126		,126		,2147483648		,126	},
+	{245		,2147483648		,2147483648		,2147483648		,245		,2147483648		,245		,245		,2147483648		,245		,2147483648		,2147483648		,2147483648		,245		,245		,2147483648		,245		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,2147483648		,2147483648		,245		,245		,2147483648		,245		,245		,2147483648		,2147483648		,245		,2147483648		,2147483648		,2147483648		,245		,245		,2147483648		,245		,2147483648		,2147483648		,245		,2147483648		,2147483648		,245		,245		,2147483648		,245		,2147483648		,245		,2147483648		,2147483648		,245		,2147483648		,245		,2147483648		,2147483648		,245		,2147483648		,245		,2147483648		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,245		,245		,2147483648		,245		,245		,2147483648		,2147483648		,245		,245		,245		,245		,2147483648		,245		,245		,2147483648		,245		,2147483648		,2147483648		,245		,245		,2147483648		,2147483648		,2147483648		,245		,245		,245		,2147483648		,2147483648		,246		,245		,245		,245		,245		,245		,245		,2147483648		,2147483648		,2147483648		,245		,2147483648		,2147483648		,245		,2147483648		,245		,245		,245		,245		,2147483648		,2147483648		,245		,2147483648		,245	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{100		,2147483648		,119		,2147483648		,2147483648		,2147483648		,108		,110		,71		,109		,2147483648		,72		,58		,75		,106		,2147483648		,78		,2147483648		,2147483648		,2147483648		,118		,2147483648		,2147483648		,112		,2147483648		,60		,121		,93		,2147483648		,2147483648		,88		,2147483648		,2147483648		,96		,73		,76		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,67		,2147483648		,2147483648		,2147483648		,102		,116		,2147483648		,89		,120		,2147483648		,2147483648		,70		,97		,69		,111		,59		,2147483648		,74		,2147483648		,2147483648		,2147483648		,2147483648		,57		,2147483648		,2147483648		,2147483648		,2147483648		,99		,81		,105		,64		,107		,114		,65		,55		,2147483648		,115		,2147483648		,84		,2147483648		,103		,91		,63		,95		,2147483648		,2147483648		,101		,85		,62		,53		,66		,86		,2147483648		,82		,68		,61		,2147483648		,2147483648		,2147483648		,2147483648		,117		,92		,113		,2147483648		,54		,2147483648		,90		,56		,77		,104		,2147483648		,83		,80		,98		,94		,2147483648		,2147483648		,79		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,151		,2147483648		,144		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648		,141		,2147483648		,2147483648		,145		,2147483648		,2147483648		,147		,2147483648		,2147483648		,143		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,146		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,139		,2147483648		,2147483648		,148		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,142		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,149		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,140		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,173		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,173		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,169		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,169		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,169		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,169		,169		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,169		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,168		,2147483648		,2147483648		,169		,2147483648	},
+	{166		,2147483648		,2147483648		,2147483648		,166		,2147483648		,166		,166		,2147483648		,166		,2147483648		,2147483648		,2147483648		,166		,166		,2147483648		,166		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,166		,166		,2147483648		,166		,166		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,166		,166		,2147483648		,166		,2147483648		,2147483648		,166		,2147483648		,2147483648		,166		,166		,2147483648		,166		,2147483648		,166		,2147483648		,2147483648		,166		,2147483648		,166		,2147483648		,2147483648		,166		,2147483648		,166		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,166		,166		,2147483648		,166		,166		,2147483648		,2147483648		,166		,166		,166		,166		,2147483648		,166		,166		,2147483648		,166		,2147483648		,2147483648		,166		,166		,2147483648		,2147483648		,2147483648		,166		,166		,166		,2147483648		,2147483648		,2147483648		,166		,166		,166		,166		,166		,166		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,166		,2147483648		,166		,166		,166		,166		,2147483648		,2147483648		,166		,2147483648		,166	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{170		,2147483648		,2147483648		,2147483648		,170		,2147483648		,170		,170		,2147483648		,170		,2147483648		,2147483648		,2147483648		,170		,170		,2147483648		,170		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,170		,170		,2147483648		,170		,170		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,170		,170		,2147483648		,170		,2147483648		,2147483648		,170		,2147483648		,2147483648		,170		,170		,2147483648		,170		,2147483648		,170		,2147483648		,2147483648		,170		,2147483648		,170		,2147483648		,2147483648		,170		,2147483648		,170		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,170		,170		,2147483648		,170		,170		,2147483648		,2147483648		,170		,170		,170		,170		,2147483648		,170		,170		,2147483648		,170		,2147483648		,2147483648		,170		,170		,2147483648		,2147483648		,2147483648		,170		,170		,170		,2147483648		,2147483648		,2147483648		,170		,170		,170		,170		,170		,170		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,170		,2147483648		,170		,170		,170		,170		,2147483648		,2147483648		,170		,2147483648		,170	},
+	{9		,2147483648		,9		,2147483648		,2147483648		,2147483648		,9		,9		,9		,9		,2147483648		,9		,9		,9		,9		,2147483648		,9		,2147483648		,2147483648		,2147483648		,9		,2147483648		,12		,9		,2147483648		,9		,9		,9		,5		,8		,9		,11		,2147483648		,9		,9		,9		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,9		,7		,2147483648		,2147483648		,9		,9		,3		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,2147483648		,9		,2147483648		,2147483648		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,9		,9		,7		,9		,2147483648		,9		,4		,9		,9		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,2147483648		,9		,9		,9		,2147483648		,2147483648		,7		,2147483648		,9		,9		,9		,10		,9		,2147483648		,9		,9		,9		,9		,2147483648		,9		,9		,9		,9		,2147483648		,6		,9		,2147483648		,7	},
+	{163		,2147483648		,2147483648		,2147483648		,163		,2147483648		,163		,163		,2147483648		,163		,2147483648		,2147483648		,2147483648		,163		,163		,2147483648		,163		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,163		,163		,2147483648		,163		,163		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,163		,163		,2147483648		,163		,2147483648		,2147483648		,163		,2147483648		,2147483648		,163		,163		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,163		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,163		,163		,2147483648		,163		,163		,2147483648		,2147483648		,163		,163		,163		,163		,2147483648		,163		,163		,2147483648		,163		,2147483648		,2147483648		,163		,163		,2147483648		,2147483648		,2147483648		,163		,163		,163		,2147483648		,2147483648		,2147483648		,163		,163		,163		,163		,163		,163		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,163		,2147483648		,163		,163		,163		,163		,2147483648		,2147483648		,163		,2147483648		,163	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33		,2147483648	},
+	{130		,130		,130		,2147483648		,2147483648		,2147483648		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,2147483648		,130		,2147483648		,2147483648		,2147483648		,130		,2147483648		,130		,130		,2147483648		,130		,130		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,2147483648		,130		,2147483648		,2147483648		,2147483648		,130		,130		,2147483648		,130		,130		,130		,130		,130		,130		,2147483648		,2147483648		,130		,130		,130		,130		,130		,2147483648		,130		,130		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,130		,130		,130		,130		,130		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,130		,130		,2147483648		,2147483648		,130		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,2147483648		,2147483648		,130		,2147483648		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,2147483648		,130		,130		,2147483648		,130	},
+	{13		,13		,13		,2147483648		,2147483648		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,2147483648		,2147483648		,2147483648		,13		,2147483648		,13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,15		,2147483648		,13		,2147483648		,2147483648		,2147483648		,13		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,14		,2147483648		,2147483648		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,13		,13		,13		,13		,13		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,2147483648		,2147483648		,13		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,2147483648		,13	},
+	{242		,2147483648		,2147483648		,2147483648		,242		,2147483648		,242		,242		,2147483648		,242		,2147483648		,2147483648		,2147483648		,242		,242		,2147483648		,242		,242		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,242		,242		,2147483648		,242		,242		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,242		,242		,2147483648		,242		,2147483648		,2147483648		,242		,2147483648		,2147483648		,242		,242		,2147483648		,242		,2147483648		,242		,2147483648		,2147483648		,242		,2147483648		,242		,2147483648		,2147483648		,242		,2147483648		,242		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,241		,242		,242		,242		,2147483648		,242		,242		,2147483648		,2147483648		,242		,242		,242		,242		,2147483648		,242		,242		,2147483648		,242		,2147483648		,2147483648		,242		,242		,2147483648		,2147483648		,2147483648		,242		,242		,242		,2147483648		,2147483648		,2147483648		,242		,242		,242		,242		,242		,242		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,242		,2147483648		,242		,242		,242		,242		,2147483648		,2147483648		,242		,2147483648		,242	},
+	{174		,2147483648		,2147483648		,2147483648		,174		,2147483648		,174		,174		,2147483648		,174		,2147483648		,2147483648		,2147483648		,174		,174		,2147483648		,174		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,174		,174		,2147483648		,174		,174		,2147483648		,2147483648		,174		,2147483648		,2147483648		,2147483648		,174		,174		,2147483648		,174		,2147483648		,2147483648		,174		,2147483648		,2147483648		,174		,174		,2147483648		,174		,2147483648		,174		,2147483648		,2147483648		,174		,2147483648		,174		,2147483648		,2147483648		,174		,2147483648		,174		,2147483648		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,174		,174		,2147483648		,174		,174		,2147483648		,2147483648		,174		,174		,174		,174		,2147483648		,174		,174		,2147483648		,174		,2147483648		,2147483648		,174		,174		,2147483648		,2147483648		,2147483648		,174		,174		,174		,2147483648		,2147483648		,2147483648		,174		,174		,174		,174		,174		,174		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,174		,2147483648		,174		,174		,174		,174		,2147483648		,2147483648		,174		,2147483648		,174	},
+	{129		,129		,129		,2147483648		,2147483648		,2147483648		,129		,129		,129		,129		,2147483648		,129		,129		,129		,129		,2147483648		,129		,2147483648		,2147483648		,2147483648		,129		,2147483648		,129		,129		,2147483648		,129		,129		,129		,129		,129		,129		,129		,2147483648		,129		,129		,129		,129		,2147483648		,129		,2147483648		,2147483648		,2147483648		,129		,129		,2147483648		,129		,129		,129		,129		,129		,129		,2147483648		,2147483648		,129		,129		,129		,129		,129		,2147483648		,129		,129		,2147483648		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,129		,129		,129		,129		,129		,129		,129		,129		,129		,129		,2147483648		,129		,129		,129		,129		,129		,129		,2147483648		,2147483648		,129		,129		,129		,129		,129		,129		,2147483648		,129		,129		,129		,2147483648		,2147483648		,129		,2147483648		,129		,129		,129		,129		,129		,2147483648		,129		,129		,129		,129		,128		,129		,129		,129		,129		,2147483648		,129		,129		,2147483648		,129	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,46		,2147483648		,2147483648		,2147483648		,2147483648		,40		,2147483648		,2147483648		,2147483648		,2147483648		,43		,2147483648		,2147483648		,47		,2147483648		,2147483648		,49		,2147483648		,2147483648		,45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,41		,2147483648		,2147483648		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,42		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,177		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,176		,178		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,178		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135	},
+	{247		,2147483648		,2147483648		,2147483648		,247		,2147483648		,247		,247		,2147483648		,247		,2147483648		,2147483648		,2147483648		,247		,247		,2147483648		,247		,247		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,247		,2147483648		,2147483648		,247		,247		,2147483648		,247		,247		,2147483648		,248		,247		,2147483648		,2147483648		,2147483648		,247		,247		,2147483648		,247		,2147483648		,2147483648		,247		,2147483648		,2147483648		,247		,247		,2147483648		,247		,2147483648		,247		,2147483648		,2147483648		,247		,2147483648		,247		,2147483648		,2147483648		,247		,2147483648		,247		,2147483648		,247		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,247		,247		,247		,2147483648		,247		,247		,2147483648		,2147483648		,247		,247		,247		,247		,2147483648		,247		,247		,2147483648		,247		,2147483648		,2147483648		,247		,247		,2147483648		,2147483648		,2147483648		,247		,247		,247		,2147483648		,2147483648		,2147483648		,247		,247		,247		,247		,247		,247		,2147483648		,2147483648		,2147483648		,247		,2147483648		,2147483648		,247		,2147483648		,247		,247		,247		,247		,2147483648		,2147483648		,247		,2147483648		,247	},
+	{2147483648		,2147483648		,2147483648		,152		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,152		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{28		,2147483648		,2147483648		,27		,28		,2147483648		,28		,28		,2147483648		,28		,2147483648		,2147483648		,2147483648		,28		,28		,2147483648		,28		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,28		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,28		,28		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,28		,2147483648		,28		,28		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,2147483648		,28		,28		,28		,2147483648		,2147483648		,2147483648		,28		,28		,28		,28		,28		,28		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,28		,28		,28		,28		,2147483648		,2147483648		,28		,2147483648		,28	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,243		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648	},
+	{22		,26		,22		,2147483648		,2147483648		,2147483648		,22		,22		,22		,22		,2147483648		,22		,22		,22		,22		,2147483648		,22		,2147483648		,2147483648		,2147483648		,22		,2147483648		,25		,22		,2147483648		,22		,22		,22		,18		,21		,22		,24		,2147483648		,22		,22		,22		,2147483648		,2147483648		,22		,2147483648		,2147483648		,2147483648		,22		,20		,2147483648		,2147483648		,22		,22		,16		,22		,22		,2147483648		,2147483648		,22		,22		,22		,22		,22		,2147483648		,22		,2147483648		,2147483648		,2147483648		,2147483648		,22		,2147483648		,2147483648		,2147483648		,2147483648		,22		,22		,22		,22		,22		,22		,22		,22		,20		,22		,2147483648		,22		,17		,22		,22		,22		,22		,2147483648		,2147483648		,22		,22		,22		,22		,22		,22		,2147483648		,22		,22		,22		,2147483648		,2147483648		,20		,2147483648		,22		,22		,22		,23		,22		,2147483648		,22		,22		,22		,22		,2147483648		,22		,22		,22		,22		,2147483648		,19		,22		,2147483648		,20	},
+	{2147483648		,2147483648		,2147483648		,165		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,165		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,2147483648	},
+	{157		,2147483648		,2147483648		,2147483648		,157		,2147483648		,157		,157		,2147483648		,157		,2147483648		,2147483648		,2147483648		,157		,157		,2147483648		,157		,157		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,157		,2147483648		,157		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,157		,157		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,157		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,157		,157		,2147483648		,157		,157		,2147483648		,2147483648		,157		,157		,157		,157		,2147483648		,157		,157		,2147483648		,157		,2147483648		,2147483648		,157		,157		,2147483648		,2147483648		,2147483648		,157		,157		,157		,2147483648		,2147483648		,2147483648		,157		,157		,157		,157		,157		,157		,2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,157		,157		,157		,157		,2147483648		,2147483648		,157		,2147483648		,157	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31	},
+	{127		,127		,127		,2147483648		,2147483648		,2147483648		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,2147483648		,127		,2147483648		,2147483648		,2147483648		,127		,2147483648		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,2147483648		,127		,2147483648		,2147483648		,2147483648		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,2147483648		,2147483648		,127		,127		,127		,127		,127		,2147483648		,127		,127		,2147483648		,2147483648		,2147483648		,127		,2147483648		,2147483648		,2147483648		,2147483648		,127		,127		,127		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,2147483648		,2147483648		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,2147483648		,2147483648		,127		,2147483648		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,2147483648		,127	},
+	{203		,2147483648		,2147483648		,2147483648		,232		,2147483648		,211		,213		,2147483648		,212		,2147483648		,2147483648		,2147483648		,180		,209		,2147483648		,181		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,215		,2147483648		,2147483648		,221		,196		,2147483648		,224		,191		,2147483648		,2147483648		,199		,2147483648		,2147483648		,2147483648		,228		,190		,2147483648		,225		,2147483648		,2147483648		,223		,2147483648		,2147483648		,205		,219		,2147483648		,192		,2147483648		,233		,2147483648		,2147483648		,200		,2147483648		,214		,2147483648		,2147483648		,179		,2147483648		,230		,2147483648		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,184		,208		,2147483648		,210		,217		,2147483648		,2147483648		,223		,218		,222		,187		,2147483648		,206		,194		,2147483648		,198		,2147483648		,2147483648		,204		,188		,2147483648		,2147483648		,2147483648		,189		,229		,185		,2147483648		,2147483648		,2147483648		,231		,223		,227		,220		,195		,216		,2147483648		,2147483648		,2147483648		,193		,2147483648		,2147483648		,207		,2147483648		,186		,183		,201		,197		,2147483648		,2147483648		,182		,2147483648		,223	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{160		,2147483648		,2147483648		,2147483648		,160		,2147483648		,160		,160		,2147483648		,160		,2147483648		,2147483648		,2147483648		,160		,160		,2147483648		,160		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,160		,2147483648		,160		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,160		,160		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,160		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,160		,160		,2147483648		,160		,160		,2147483648		,2147483648		,160		,160		,160		,160		,2147483648		,160		,160		,2147483648		,160		,2147483648		,2147483648		,160		,160		,2147483648		,2147483648		,2147483648		,160		,160		,160		,2147483648		,2147483648		,2147483648		,160		,160		,160		,160		,160		,160		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,160		,160		,160		,160		,2147483648		,2147483648		,160		,2147483648		,160	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	}
 };
 const char* KeywordList[]= {
 "print",
@@ -983,6 +995,7 @@ const char* KeywordList[]= {
 "spinlock_unlock",
 "event_sc",
 "microsleep",
+"lbr_snapshot",
 "printf",
 "pause",
 "flush",
@@ -991,6 +1004,8 @@ const char* KeywordList[]= {
 "event_trace_step_out",
 "event_trace_instrumentation_step",
 "event_trace_instrumentation_step_in",
+"pt_start",
+"pt_stop",
 "rdtsc",
 "rdtscp",
 "spinlock_lock_custom_wait",
@@ -1179,6 +1194,7 @@ const char* OneOpFunc2[] = {
 "@SPINLOCK_UNLOCK",
 "@EVENT_SC",
 "@MICROSLEEP",
+"@LBR_SNAPSHOT",
 };
 const char* OneOpFunc3[] = {
 "@STRLEN"
@@ -1207,6 +1223,8 @@ const char* ZeroOpFunc1[] = {
 "@EVENT_TRACE_STEP_OUT",
 "@EVENT_TRACE_INSTRUMENTATION_STEP",
 "@EVENT_TRACE_INSTRUMENTATION_STEP_IN",
+"@PT_START",
+"@PT_STOP",
 };
 const char* ZeroOpFunc2[] = {
 "@RDTSC",
@@ -1262,6 +1280,7 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@SPINLOCK_UNLOCK", FUNC_SPINLOCK_UNLOCK},
 {"@EVENT_SC", FUNC_EVENT_SC},
 {"@MICROSLEEP", FUNC_MICROSLEEP},
+{"@LBR_SNAPSHOT", FUNC_LBR_SNAPSHOT},
 {"@PRINTF", FUNC_PRINTF},
 {"@PAUSE", FUNC_PAUSE},
 {"@FLUSH", FUNC_FLUSH},
@@ -1270,6 +1289,8 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EVENT_TRACE_STEP_OUT", FUNC_EVENT_TRACE_STEP_OUT},
 {"@EVENT_TRACE_INSTRUMENTATION_STEP", FUNC_EVENT_TRACE_INSTRUMENTATION_STEP},
 {"@EVENT_TRACE_INSTRUMENTATION_STEP_IN", FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN},
+{"@PT_START", FUNC_PT_START},
+{"@PT_STOP", FUNC_PT_STOP},
 {"@RDTSC", FUNC_RDTSC},
 {"@RDTSCP", FUNC_RDTSCP},
 {"@SPINLOCK_LOCK_CUSTOM_WAIT", FUNC_SPINLOCK_LOCK_CUSTOM_WAIT},
@@ -1844,111 +1865,111 @@ const unsigned int LalrRhsSize[RULES_COUNT]=
 };
 const char* LalrNoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"EXP",
-"WstringNumber",
+"S",
+"E13",
+"WSTRING",
+"B2",
+"StringNumber",
+"E3",
+"E4",
+"VA2",
 "E5",
+"WstringNumber",
+"B3",
+"B1",
 "VA3",
-"B2",
 "CMP",
-"BE",
-"S",
-"WSTRING",
+"EXP",
 "B5",
-"VA2",
-"E10",
-"STRING",
+"BE",
 "E12",
+"STRING",
 "B4",
-"B1",
-"E13",
 "B6",
-"StringNumber",
-"E3",
-"B3",
-"E4"
+"E10"
 };
 const char* LalrTerminalMap[TERMINAL_COUNT]= 
 {
-">>",
-"low_pa",
 "dd_pa",
-"_string",
-"memcmp",
-"physical_to_virtual",
-"_register",
+"_function_id",
+"disassemble_len",
+"+",
+"<=",
+"poi_pa",
+"_wstring",
+"-",
 "_function_parameter_id",
-"db",
-"dw",
-"&&",
-"dq",
-"<",
+"~",
 "_decimal",
-"disassemble_len",
-"hi",
+"_octal",
+"wcscmp",
 "eb_pa",
-"*",
-"interlocked_compare_exchange",
-"_binary",
-"&",
-"wcslen",
-"ed",
-"_local_id",
-"disassemble_len64",
+"<",
+"interlocked_decrement",
+">>",
+"check_address",
+"%",
+"||",
+"^",
+"eq_pa",
 "strcmp",
-"strncmp",
+"_hex",
+"_binary",
+")",
+"db_pa",
+"ed_pa",
 ">",
-"-",
-",",
-"wcscmp",
-"reference",
-"eb",
-"==",
-"poi",
-"_wstring",
-"wcsncmp",
-"%",
-"interlocked_increment",
-"strlen",
+"dw",
 "eq",
-"_global_id",
-"virtual_to_physical",
-"interlocked_exchange",
-"not",
-"_hex",
-"_octal",
-"<<",
-"||",
-"/",
-"_function_id",
-"low",
-">=",
-"interlocked_decrement",
-"dd",
-"dw_pa",
-"check_address",
+"_register",
 "|",
+"_string",
 "interlocked_exchange_add",
-"neg",
-"^",
+"disassemble_len64",
+"dq_pa",
+"eb",
+"memcmp",
+"$",
+"wcslen",
+"_global_id",
+">=",
+"strncmp",
 "disassemble_len32",
-"hi_pa",
-")",
-"+",
+"interlocked_exchange",
 "_pseudo_register",
-"<=",
-"dq_pa",
-"poi_pa",
-"ed_pa",
-"eq_pa",
+"_local_id",
+"==",
+"*",
+"poi",
+"neg",
+"&",
+"(",
+"hi",
+"hi_pa",
+"ed",
 "!=",
-"db_pa",
-"$",
-"~",
-"("
+"dd",
+"interlocked_increment",
+"physical_to_virtual",
+"/",
+"<<",
+"low_pa",
+"virtual_to_physical",
+"db",
+",",
+"dw_pa",
+"low",
+"interlocked_compare_exchange",
+"strlen",
+"not",
+"dq",
+"wcsncmp",
+"&&",
+"reference"
 };
 const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]= 
 {
-	{10		,2147483648		,13		,2147483648		,4		,9		,2		,1		,2147483648		,7		,2147483648		,14		,2147483648		,15		,6		,3		,16		,8		,2147483648		,11		,5		,12	},
+	{1		,16		,2147483648		,4		,2147483648		,11		,12		,2147483648		,13		,2147483648		,5		,3		,2147483648		,9		,10		,7		,2		,15		,2147483648		,6		,8		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -1969,7 +1990,6 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,97		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -1985,7 +2005,6 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,111		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -1993,101 +2012,103 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{10		,2147483648		,13		,2147483648		,4		,9		,117		,2147483648		,2147483648		,7		,2147483648		,14		,2147483648		,15		,6		,3		,16		,8		,2147483648		,11		,5		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,4		,2147483648		,11		,12		,2147483648		,13		,2147483648		,5		,3		,2147483648		,9		,10		,7		,113		,15		,2147483648		,6		,8		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,121		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,122		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,120		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,126		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{10		,2147483648		,13		,2147483648		,140		,9		,2147483648		,2147483648		,2147483648		,7		,2147483648		,14		,2147483648		,15		,6		,2147483648		,16		,8		,2147483648		,11		,5		,12	},
-	{10		,2147483648		,13		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,7		,2147483648		,14		,2147483648		,15		,6		,2147483648		,16		,8		,2147483648		,11		,141		,12	},
-	{10		,2147483648		,13		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,7		,2147483648		,14		,2147483648		,15		,142		,2147483648		,16		,8		,2147483648		,11		,2147483648		,12	},
-	{10		,2147483648		,13		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,143		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,8		,2147483648		,11		,2147483648		,12	},
-	{10		,2147483648		,13		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,144		,2147483648		,11		,2147483648		,12	},
-	{145		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{146		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{147		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{148		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{149		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{150		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{2147483648		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,151	},
-	{2147483648		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,152	},
-	{2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,155		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{158		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{160		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{161		,163		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{165		,166		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{167		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,140		,2147483648		,11		,12		,2147483648		,13		,2147483648		,5		,2147483648		,2147483648		,9		,10		,7		,2147483648		,15		,2147483648		,6		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,141		,2147483648		,2147483648		,9		,10		,7		,2147483648		,15		,2147483648		,6		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,9		,10		,7		,2147483648		,15		,2147483648		,142		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,9		,10		,143		,2147483648		,15		,2147483648		,2147483648		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,9		,10		,2147483648		,2147483648		,15		,2147483648		,2147483648		,144		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,145		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,146		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,147		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,148		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,149		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,152		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,155	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,156	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,157	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,159		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,164		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,168		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,176		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,177		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,181		,2147483648		,2147483648		,2147483648		,2147483648		,180		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,183		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,182		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,184		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,185		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,186		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,187		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{168		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{169		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{170		,171		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{172		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{173		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{174		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{175		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{176		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{177		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{178		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{179		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{180		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{181		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,190		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,191		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,192		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,193		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,194		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,195		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{182		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{183		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{184		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{185		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{186		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,188		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,196		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,197		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,198		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,199		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,200		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{191		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{186		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,192		,11		,2147483648		,12	},
-	{193		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,201		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,203		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,204		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,205		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,206		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,207		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,208		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,209		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{194		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{195		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{196		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{186		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,197		,11		,2147483648		,12	},
-	{198		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{199		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{200		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{201		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{202		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{203		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{204		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{205		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{206		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{207		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{208		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{209		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,210		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,210		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2106,7 +2127,7 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,211		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,211		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2160,53 +2181,53 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{258		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,258		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,259		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{165		,259		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{260		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,260		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{261		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{165		,262		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,261		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,262		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,263		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,264		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,265		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,266		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,267		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{263		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{264		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,268		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,269		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,270		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,271		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{265		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{186		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,266		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{186		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,267		,11		,2147483648		,12	},
-	{268		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{269		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{186		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,187		,15		,2147483648		,2147483648		,16		,2147483648		,270		,11		,2147483648		,12	},
-	{271		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,272		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{272		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
-	{273		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,273		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,274		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,274		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2223,20 +2244,20 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{290		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,290		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,291		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{291		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,292		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,293		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{292		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{293		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,2147483648		,15		,2147483648		,2147483648		,16		,2147483648		,2147483648		,11		,2147483648		,12	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2249,304 +2270,304 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 };
 const int LalrActionTable[LALR_STATE_COUNT][LALR_TERMINAL_COUNT]= 
 {
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483647		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-1		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,77		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,82		,2147483648		,2147483648		,2147483648		,2147483648		,81		,2147483648		,-13		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,-20		,2147483648		,2147483648	},
-	{85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,86		,-21		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,-21		,2147483648		,2147483648	},
-	{-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,88		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,-24		,87		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,-24		,2147483648		,2147483648	},
-	{-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,91		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,-27		,-27		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,-27		,89		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,-27		,-27		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,-27		,2147483648		,2147483648	},
-	{-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,-31		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,-31		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,-31		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,-31		,2147483648		,2147483648	},
-	{-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,-32		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,-32		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,-32		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,-32		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,93	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,94	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,95	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,96	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,2147483648		,60		,24		,2147483648		,18		,33		,69		,53		,44		,57		,2147483648		,2147483648		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,2147483648		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,2147483648		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,98	},
-	{-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,-83		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,-83		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,-83		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,-83		,2147483648		,2147483648	},
-	{-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,-90		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,-90		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,-90		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,-90		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,99	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,100	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,101	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,102	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,103	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,104	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,105	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,106	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,107	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,108	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,109	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,110	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,2147483648		,60		,24		,2147483648		,18		,33		,69		,53		,44		,57		,2147483648		,2147483648		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,2147483648		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,2147483648		,45	},
-	{-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,-89		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,-89		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,-89		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,-89		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,112	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,113	},
-	{-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,-86		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,-86		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,-86		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,-86		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,114	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,115	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,116	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,118	},
-	{-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,-88		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,-88		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,-88		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,-88		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-93	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,119	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,120	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,2147483648		,60		,24		,2147483648		,18		,33		,69		,53		,44		,57		,2147483648		,2147483648		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,2147483648		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,2147483648		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,2147483648		,60		,24		,2147483648		,18		,33		,69		,53		,44		,57		,2147483648		,2147483648		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,2147483648		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,2147483648		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,123	},
-	{-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,-84		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,-84		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,-84		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,-84		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,124	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,125	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,126	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,127	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,128	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130	},
-	{-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,-87		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,-87		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,-87		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,-87		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,2147483648		,60		,24		,2147483648		,18		,33		,69		,53		,44		,57		,2147483648		,2147483648		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,2147483648		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,2147483648		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136	},
-	{-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,-85		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,-85		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,-85		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,-85		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138	},
-	{-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,-91		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,-91		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,-91		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,-91		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,139	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,-94		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,164		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,164		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,-35		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,-35		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,-35		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,-35		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,164		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,-34		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,-34		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,-34		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,-34		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,190		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,-37		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,-37		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,-37		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,-37		,2147483648		,2147483648	},
-	{-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,-36		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,-36		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,-36		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,-36		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,-33		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,-33		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,-33		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,-33		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,77		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,-18		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,-15		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,-19		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,-17		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,-14		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,-16		,2147483648		,2147483648	},
-	{-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,88		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,-22		,87		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,-22		,2147483648		,2147483648	},
-	{-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,88		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,-23		,87		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,-23		,2147483648		,2147483648	},
-	{-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,91		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,-25		,-25		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,-25		,89		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,-25		,-25		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,-25		,2147483648		,2147483648	},
-	{-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,91		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,-26		,-26		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,-26		,89		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,-26		,-26		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,-26		,2147483648		,2147483648	},
-	{-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,-28		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,-28		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,-28		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,-28		,2147483648		,2147483648	},
-	{-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,-29		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,-29		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,-29		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,-29		,2147483648		,2147483648	},
-	{-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,-30		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,-30		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,-30		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,-30		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,213		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,214		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,215		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,216		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,217		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,218		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,219		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,220		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,221		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,222		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,224		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,230		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,233		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,-82		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,-82		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,-82		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,-82		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,243		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,247		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,250		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,251		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,252		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,253		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,254		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,255		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,257		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,-92		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,-92		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,-92		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,-92		,2147483648		,2147483648	},
-	{-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,-45		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,-45		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,-45		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,-45		,2147483648		,2147483648	},
-	{-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,-49		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,-49		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,-49		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,-49		,2147483648		,2147483648	},
-	{-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,-79		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,-79		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,-79		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,-79		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,164		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,-44		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,-44		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,-44		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,-44		,2147483648		,2147483648	},
-	{-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,-38		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,-38		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,-38		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,-38		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,164		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,-41		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,-41		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,-41		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,-41		,2147483648		,2147483648	},
-	{-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,-62		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,-62		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,-62		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,-62		,2147483648		,2147483648	},
-	{-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,-57		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,-57		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,-57		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,-57		,2147483648		,2147483648	},
-	{-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,-59		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,-59		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,-59		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,-59		,2147483648		,2147483648	},
-	{-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,-42		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,-42		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,-42		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,-42		,2147483648		,2147483648	},
-	{-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,-58		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,-58		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,-58		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,-58		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,-50		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,-50		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,-50		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,-50		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,-56		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,-56		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,-56		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,-56		,2147483648		,2147483648	},
-	{-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,-60		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,-60		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,-60		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,-60		,2147483648		,2147483648	},
-	{-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,-47		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,-47		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,-47		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,-47		,2147483648		,2147483648	},
-	{-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,-54		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,-54		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,-54		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,-54		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,-61		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,-61		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,-61		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,-61		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,-52		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,-52		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,-52		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,-52		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,-64		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,-64		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,-64		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,-64		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,189		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,-46		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,-46		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,-46		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,-46		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,-63		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,-63		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,-63		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,-63		,2147483648		,2147483648	},
-	{-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,-53		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,-53		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,-53		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,-53		,2147483648		,2147483648	},
-	{-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,-43		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,-43		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,-43		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,-43		,2147483648		,2147483648	},
-	{-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,-39		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,-39		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,-39		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,-39		,2147483648		,2147483648	},
-	{-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,-55		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,-55		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,-55		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,-55		,2147483648		,2147483648	},
-	{-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,-40		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,-40		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,-40		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,-40		,2147483648		,2147483648	},
-	{-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,-51		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,-51		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,-51		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,-51		,2147483648		,2147483648	},
-	{-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,-48		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,-48		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,-48		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,-48		,2147483648		,2147483648	},
-	{-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,-75		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,-75		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,-75		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,-75		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,275		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,276		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,277		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,278		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,279		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,280		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,281		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,282		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,283		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,284		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,285		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,286		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,287		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,288		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,289		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,-69		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,-69		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,-69		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,-69		,2147483648		,2147483648	},
-	{-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,-70		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,-70		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,-70		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,-70		,2147483648		,2147483648	},
-	{-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,-80		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,-80		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,-80		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,-80		,2147483648		,2147483648	},
-	{-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,-65		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,-65		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,-65		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,-65		,2147483648		,2147483648	},
-	{-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,-68		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,-68		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,-68		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,-68		,2147483648		,2147483648	},
-	{-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,-67		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,-67		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,-67		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,-67		,2147483648		,2147483648	},
-	{-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,-76		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,-76		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,-76		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,-76		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,-72		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,-72		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,-72		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,-72		,2147483648		,2147483648	},
-	{-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,-71		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,-71		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,-71		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,-71		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,-66		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,-66		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,-66		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,-66		,2147483648		,2147483648	},
-	{2147483648		,39		,28		,2147483648		,49		,36		,23		,41		,67		,27		,2147483648		,31		,2147483648		,47		,34		,22		,55		,52		,60		,24		,51		,18		,33		,69		,53		,44		,57		,2147483648		,64		,2147483648		,26		,68		,58		,2147483648		,25		,2147483648		,19		,2147483648		,65		,73		,43		,54		,29		,35		,59		,62		,38		,2147483648		,2147483648		,2147483648		,48		,17		,2147483648		,42		,70		,63		,40		,2147483648		,20		,66		,2147483648		,71		,30		,2147483648		,37		,72		,2147483648		,56		,32		,50		,61		,2147483648		,46		,2147483648		,21		,45	},
-	{-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,-73		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,-73		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,-73		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,-73		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,294		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,295		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,296		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,-81		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,-81		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,-81		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,-81		,2147483648		,2147483648	},
-	{-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,-77		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,-77		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,-77		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,-77		,2147483648		,2147483648	},
-	{-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,-78		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,-78		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,-78		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,-78		,2147483648		,2147483648	},
-	{-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,-74		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,-74		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,-74		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,-74		,2147483648		,2147483648	}
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483647		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-1		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,77		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,82		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,81		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,86		,2147483648		,2147483648		,-21		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,85		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,88		,-24		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,-24		,2147483648		,2147483648		,-24		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-27		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,-27		,2147483648		,90		,-27		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,91		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,89		,-27		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-31		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,-31		,2147483648		,-31		,-31		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-32		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,-32		,2147483648		,-32		,-32		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,94		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-88		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,-88		,2147483648		,-88		,-88		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-84		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,-84		,2147483648		,-84		,-84		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-83		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,-83		,2147483648		,-83		,-83		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-89		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,-89		,2147483648		,-89		,-89		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,104		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,105		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-86		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,-86		,2147483648		,-86		,-86		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,106		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,107		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,108		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,109		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,110		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,111		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-85		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,-85		,2147483648		,-85		,-85		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,112		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,114		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-90		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,-90		,2147483648		,-90		,-90		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,115		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,116		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,117		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,118		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-91		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,-91		,2147483648		,-91		,-91		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,119		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-87		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,-87		,2147483648		,-87		,-87		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,121		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,122		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,123		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,124		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,125		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,127		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,128		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,139		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,-94		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,188		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-33		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,-33		,2147483648		,-33		,-33		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-37		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,-37		,2147483648		,-37		,-37		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-35		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,-35		,2147483648		,-35		,-35		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-34		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,-34		,2147483648		,-34		,-34		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-36		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,-36		,2147483648		,-36		,-36		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,77		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,88		,-23		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,-23		,2147483648		,2147483648		,-23		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,88		,-22		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,-22		,2147483648		,2147483648		,-22		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-26		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,-26		,2147483648		,90		,-26		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,91		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,89		,-26		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-25		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,-25		,2147483648		,90		,-25		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,91		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,89		,-25		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-28		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,-28		,2147483648		,-28		,-28		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-29		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,-29		,2147483648		,-29		,-29		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-30		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,-30		,2147483648		,-30		,-30		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,213		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,214		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,215		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,216		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,217		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,218		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,219		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,220		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,221		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,222		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,224		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,230		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,233		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-82		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,-82		,2147483648		,-82		,-82		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,243		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,247		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,250		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,251		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,252		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,253		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,254		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,255		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,256		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,257		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-92		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,-92		,2147483648		,-92		,-92		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-45		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,-45		,2147483648		,-45		,-45		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-49		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,-49		,2147483648		,-49		,-49		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-79		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,-79		,2147483648		,-79		,-79		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-52		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,-52		,2147483648		,-52		,-52		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-40		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,-40		,2147483648		,-40		,-40		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-47		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,-47		,2147483648		,-47		,-47		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-60		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,-60		,2147483648		,-60		,-60		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-54		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,-54		,2147483648		,-54		,-54		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-48		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,-48		,2147483648		,-48		,-48		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-75		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,-75		,2147483648		,-75		,-75		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-62		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,-62		,2147483648		,-62		,-62		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-61		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,-61		,2147483648		,-61		,-61		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-41		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,-41		,2147483648		,-41		,-41		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-43		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,-43		,2147483648		,-43		,-43		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-59		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,-59		,2147483648		,-59		,-59		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-57		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,-57		,2147483648		,-57		,-57		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-51		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,-51		,2147483648		,-51		,-51		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-39		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,-39		,2147483648		,-39		,-39		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-55		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,-55		,2147483648		,-55		,-55		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-38		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,-38		,2147483648		,-38		,-38		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-42		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,-42		,2147483648		,-42		,-42		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-44		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,-44		,2147483648		,-44		,-44		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-50		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,-50		,2147483648		,-50		,-50		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-63		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,-63		,2147483648		,-63		,-63		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-46		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,-46		,2147483648		,-46		,-46		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-56		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,-56		,2147483648		,-56		,-56		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-58		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,-58		,2147483648		,-58		,-58		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-64		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,-64		,2147483648		,-64		,-64		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-53		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,-53		,2147483648		,-53		,-53		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,275		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,276		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,277		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,278		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,279		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,280		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,281		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,282		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,283		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,284		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,285		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,286		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,287		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,288		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,289		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-68		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,-68		,2147483648		,-68		,-68		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-76		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,-76		,2147483648		,-76		,-76		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-71		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,-71		,2147483648		,-71		,-71		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-73		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,-73		,2147483648		,-73		,-73		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-67		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,-67		,2147483648		,-67		,-67		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-70		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,-70		,2147483648		,-70		,-70		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-80		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,-80		,2147483648		,-80		,-80		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-72		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,-72		,2147483648		,-72		,-72		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-66		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,-66		,2147483648		,-66		,-66		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-69		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,-69		,2147483648		,-69		,-69		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-65		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,-65		,2147483648		,-65		,-65		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,294		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,295		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,296		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-74		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,-74		,2147483648		,-74		,-74		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-78		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,-78		,2147483648		,-78		,-78		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-81		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,-81		,2147483648		,-81		,-81		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-77		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,-77		,2147483648		,-77		,-77		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648	}
 };
 const struct _SCRIPT_ENGINE_TOKEN LalrSemanticRules[RULES_COUNT]= 
 {
@@ -751,6 +751,11 @@ GetToken(char * c, char * str)
                     if (HasBang)
                     {
                         Address = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
+
+                        if (!WasFound && *c == '.')
+                        {
+                            WasFound = GetTypeMemberOffset(Token, str, c, &Address);
+                        }
                     }
 
                     if (WasFound)
@@ -813,6 +818,11 @@ GetToken(char * c, char * str)
                     if (HasBang)
                     {
                         Address = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
+
+                        if (!WasFound && *c == '.')
+                        {
+                            WasFound = GetTypeMemberOffset(Token, str, c, &Address);
+                        }
                     }
 
                     if (WasFound)
@@ -886,6 +896,11 @@ GetToken(char * c, char * str)
                 if (HasBang)
                 {
                     Address = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
+
+                    if (!WasFound && *c == '.')
+                    {
+                        WasFound = GetTypeMemberOffset(Token, str, c, &Address);
+                    }
                 }
 
                 if (WasFound)
@@ -1000,6 +1015,97 @@ Scan(char * str, char * c)
     }
 }
 
+/**
+ * @brief Resolve a member access of a structure (e.g., nt!_EPROCESS.ImageFileName
+ * or nt!_EPROCESS.Pcb.DirectoryTableBase) to the offset of the field
+ * @details The offset is resolved at compile time from the type-layout database
+ * of the module, so the member access is compiled as a constant
+ *
+ * @param Token The token that contains the name of the structure, the name of
+ * the fields are appended to it
+ * @param str
+ * @param c
+ * @param Offset
+ * @return BOOLEAN
+ */
+BOOLEAN
+GetTypeMemberOffset(PSCRIPT_ENGINE_TOKEN Token, char * str, char * c, UINT64 * Offset)
+{
+    char    TypeName[MAXIMUM_TYPE_NAME_LENGTH]  = {0};
+    char    FieldName[MAXIMUM_TYPE_NAME_LENGTH] = {0};
+    char *  NewTypeName                         = TypeName;
+    BOOLEAN IsStructPointer                     = FALSE;
+    BOOLEAN IsFieldPointer                      = FALSE;
+    UINT32  FieldOffset                         = 0;
+    UINT32  FieldSize                           = 0;
+    UINT32  FieldNameLength                     = 0;
+    UINT64  TotalOffset                         = 0;
+
+    if (strlen(Token->Value) >= MAXIMUM_TYPE_NAME_LENGTH)
+    {
+        return FALSE;
+    }
+
+    strcpy(TypeName, Token->Value);
+
+    while (*c == '.')
+    {
+        //
+        // Pointers could not be dereferenced at compile time
+        //
+        if (IsFieldPointer)
+        {
+            return FALSE;
+        }
+
+        AppendByte(Token, *c);
+        *c = sgetc(str);
+
+        FieldNameLength = 0;
+
+        while (IsLetter(*c) || IsDecimal(*c) || *c == '_')
+        {
+            if (FieldNameLength == MAXIMUM_TYPE_NAME_LENGTH - 1)
+            {
+                return FALSE;
+            }
+
+            FieldName[FieldNameLength++] = *c;
+            AppendByte(Token, *c);
+            *c = sgetc(str);
+        }
+
+        FieldName[FieldNameLength] = '\0';
+
+        if (FieldNameLength == 0 ||
+            !ScriptEngineCastingQueryForFiledsAndTypes(TypeName,
+                                                       FieldName,
+                                                       &IsStructPointer,
+                                                       &IsFieldPointer,
+                                                       &NewTypeName,
+                                                       &FieldOffset,
+                                                       &FieldSize))
+        {
+            return FALSE;
+        }
+
+        //
+        // The members of a pointer type are not at a constant offset
+        // (the pointer should be dereferenced first)
+        //
+        if (IsStructPointer)
+        {
+            return FALSE;
+        }
+
+        TotalOffset += FieldOffset;
+    }
+
+    *Offset = TotalOffset;
+
+    return TRUE;
+}
+
 /**
  * @brief returns last character of string
  *
@@ -190,6 +190,40 @@ ScriptEngineGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
     return SymGetDataTypeSize(TypeName, TypeSize);
 }
 
+/**
+ * @brief Get the details of a field of a structure (used for resolving
+ * member accesses at compile time)
+ *
+ * @param StructName
+ * @param FiledOfStructName
+ * @param IsStructNamePointerOrNot
+ * @param IsFiledOfStructNamePointerOrNot
+ * @param NewStructOrTypeName
+ * @param OffsetOfFieldFromTop
+ * @param SizeOfField
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineCastingQueryForFiledsAndTypes(const char * StructName,
+                                          const char * FiledOfStructName,
+                                          PBOOLEAN     IsStructNamePointerOrNot,
+                                          PBOOLEAN     IsFiledOfStructNamePointerOrNot,
+                                          char **      NewStructOrTypeName,
+                                          UINT32 *     OffsetOfFieldFromTop,
+                                          UINT32 *     SizeOfField)
+{
+    //
+    // A wrapper for querying the type-layout database
+    //
+    return SymCastingQueryForFiledsAndTypes(StructName,
+                                            FiledOfStructName,
+                                            IsStructNamePointerOrNot,
+                                            IsFiledOfStructNamePointerOrNot,
+                                            NewStructOrTypeName,
+                                            OffsetOfFieldFromTop,
+                                            SizeOfField);
+}
+
 /**
  * @brief Create symbol table for disassembler
  *
@@ -1,32 +1,32 @@
 #pragma once
 #ifndef PARSE_TABLE_H
 #define PARSE_TABLE_H
-#define RULES_COUNT 246
-#define TERMINAL_COUNT 119
+#define RULES_COUNT 249
+#define TERMINAL_COUNT 122
 #define NONETERMINAL_COUNT 49
 #define START_VARIABLE "S"
 #define MAX_RHS_LEN 15
-#define KEYWORD_LIST_LENGTH 109
+#define KEYWORD_LIST_LENGTH 112
 #define OPERATORS_ONE_OPERAND_LIST_LENGTH 4
 #define OPERATORS_TWO_OPERAND_LIST_LENGTH 16
 #define REGISTER_MAP_LIST_LENGTH 120
 #define PSEUDO_REGISTER_MAP_LIST_LENGTH 16
 #define SCRIPT_VARIABLE_TYPE_LIST_LENGTH 10
 #define ASSIGNMENT_OPERATOR_LIST_LENGTH 10
-#define SEMANTIC_RULES_MAP_LIST_LENGTH 155
+#define SEMANTIC_RULES_MAP_LIST_LENGTH 158
 #define THREEOPFUNC1_LENGTH 1
 #define THREEOPFUNC2_LENGTH 3
 #define TWOOPFUNC1_LENGTH 8
 #define TWOOPFUNC2_LENGTH 2
 #define ONEOPFUNC1_LENGTH 25
-#define ONEOPFUNC2_LENGTH 10
+#define ONEOPFUNC2_LENGTH 11
 #define ONEOPFUNC3_LENGTH 1
 #define TWOOPFUNC3_LENGTH 1
 #define THREEOPFUNC3_LENGTH 2
 #define THREEOPFUNC4_LENGTH 1
 #define ONEOPFUNC4_LENGTH 1
 #define TWOOPFUNC4_LENGTH 1
-#define ZEROOPFUNC1_LENGTH 7
+#define ZEROOPFUNC1_LENGTH 9
 #define ZEROOPFUNC2_LENGTH 2
 #define VARARGFUNC1_LENGTH 1
 extern const struct _SCRIPT_ENGINE_TOKEN Lhs[RULES_COUNT];
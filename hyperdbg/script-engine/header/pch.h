@@ -47,6 +47,11 @@
 #include "type.h"
 #include "hardware.h"
 
+//
+// Components
+//
+#include "components/hwdbg-script-packing/header/HwdbgScriptPacking.h"
+
 //
 // Import/export definitions
 //
@@ -59,6 +59,9 @@ Scan(char * str, char * c);
 char
 sgetc(char * str);
 
+BOOLEAN
+GetTypeMemberOffset(PSCRIPT_ENGINE_TOKEN Token, char * str, char * c, UINT64 * Offset);
+
 char
 IsKeyword(char * str);
 
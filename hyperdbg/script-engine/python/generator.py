@@ -88,6 +88,11 @@ object ScriptConstants {
   val SYMBOL_MEM_VALID_CHECK_MASK = 1 << 31
   val INVALID = 0x80000000
   val LALR_ACCEPT = 0x7fffffff
+
+  //
+  // Width of "Type" in the bit-packed script buffer (Same as HWDBG_SCRIPT_BIT_PACKED_TYPE_WIDTH in HyperDbg)
+  //
+  val SYMBOL_TYPE_BIT_PACKED_WIDTH = 5
 }
 
 /**
@@ -1166,6 +1166,72 @@ ScriptEngineFunctionFlush()
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
 
+/**
+ * @brief Implementation of pt_start function
+ * @details Starts Intel Processor Trace on the current core (the buffers
+ * are configured by the '!pt start paused' command)
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionPtStart()
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("err, it's not possible to start the processor trace in user-mode\n");
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    VmFuncProcessorTraceControlCurrentCore(TRUE);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
+/**
+ * @brief Implementation of pt_stop function
+ * @details Stops Intel Processor Trace on the current core, the buffer of
+ * the core is kept for decoding
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionPtStop()
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("err, it's not possible to stop the processor trace in user-mode\n");
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    VmFuncProcessorTraceControlCurrentCore(FALSE);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
+/**
+ * @brief Implementation of lbr_snapshot function
+ * @details Shows the last branches of the current core (the records are
+ * enabled by the '!lbr enable' command)
+ *
+ * @param Tag
+ * @param ImmediateMessagePassing
+ * @param Count Count of the branches
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionLbrSnapshot(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT64 Count)
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("err, it's not possible to capture the last branch records in user-mode\n");
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    DebuggerLbrSnapshotPerform(Tag, ImmediateMessagePassing, Count > LBR_SNAPSHOT_MAXIMUM_RECORDS ? LBR_SNAPSHOT_MAXIMUM_RECORDS : (UINT32)Count);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
 /**
  * @brief Implementation of event_ignore function
  * @param State
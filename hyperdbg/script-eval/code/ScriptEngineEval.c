@@ -730,6 +730,18 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
 
         break;
 
+    case FUNC_PT_START:
+
+        ScriptEngineFunctionPtStart();
+
+        break;
+
+    case FUNC_PT_STOP:
+
+        ScriptEngineFunctionPtStop();
+
+        break;
+
     case FUNC_EVENT_TRACE_INSTRUMENTATION_STEP:
     case FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN:
 
@@ -1654,6 +1666,19 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
         ScriptEngineFunctionMicroSleep(SrcVal0);
         break;
 
+    case FUNC_LBR_SNAPSHOT:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        ScriptEngineFunctionLbrSnapshot(ActionDetail->Tag,
+                                        ActionDetail->ImmediatelySendTheResults,
+                                        SrcVal0);
+        break;
+
     case FUNC_RDTSC:
 
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
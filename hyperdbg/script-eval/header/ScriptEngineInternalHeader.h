@@ -234,6 +234,15 @@ ScriptEngineFunctionPause(
 VOID
 ScriptEngineFunctionFlush();
 
+VOID
+ScriptEngineFunctionPtStart();
+
+VOID
+ScriptEngineFunctionPtStop();
+
+VOID
+ScriptEngineFunctionLbrSnapshot(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT64 Count);
+
 VOID
 ScriptEngineFunctionShortCircuitingEvent(UINT64 State, ACTION_BUFFER * ActionDetail);
 
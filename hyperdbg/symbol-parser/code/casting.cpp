@@ -21,34 +21,85 @@
 
  */
 
-typedef struct _UNICODE_STRING
+/**
+ * @brief Normalize the name of a structure which might be a pointer
+ * (e.g., _EPROCESS*, nt!_EPROCESS *, or PEPROCESS) and find it in the
+ * type-layout database of the modules
+ *
+ * @param StructName
+ * @param Database
+ * @param Type
+ * @param ModuleName
+ * @param IsPointer
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymCastingFindStructure(const char *              StructName,
+                        PTYPE_LAYOUT_DATABASE *   Database,
+                        PTYPE_LAYOUT_TYPE_ENTRY * Type,
+                        const char **             ModuleName,
+                        PBOOLEAN                  IsPointer)
 {
-    USHORT Length;        // +0x000
-    USHORT MaximumLength; // +0x002
-    PWSTR  Buffer;        // +0x004
-} UNICODE_STRING, *PUNICODE_STRING;
+    std::string Name(StructName);
+    std::string ModulePrefix;
+    size_t      Bang = 0;
 
-typedef struct _STUPID_STRUCT1
-{
-    UINT32          Flag32;      // +0x000
-    UINT64          Flag64;      // +0x004
-    PVOID           Context;     // +0x00c
-    PUNICODE_STRING StringValue; // +0x014
-} STUPID_STRUCT1, *PSTUPID_STRUCT1;
+    *IsPointer = FALSE;
 
-typedef struct _STUPID_STRUCT2
-{
-    UINT32          Sina32;        // +0x000
-    UINT64          Sina64;        // +0x004
-    PVOID           AghaaSina;     // +0x00c
-    PUNICODE_STRING UnicodeStr;    // +0x014
-    PSTUPID_STRUCT1 StupidStruct1; // +0x01c
+    //
+    // Remove the pointer sign
+    //
+    while (!Name.empty() && (Name.back() == ' ' || Name.back() == '*'))
+    {
+        if (Name.back() == '*')
+        {
+            *IsPointer = TRUE;
+        }
+
+        Name.pop_back();
+    }
+
+    if (TypeLayoutQueryType(Name.c_str(), Database, Type, ModuleName))
+    {
+        return TRUE;
+    }
+
+    //
+    // If it's not found, we'll check whether it's a pointer-type naming
+    // convention (PEPROCESS -> _EPROCESS or EPROCESS) or not
+    //
+    Bang = Name.find('!');
+
+    if (Bang != std::string::npos)
+    {
+        ModulePrefix = Name.substr(0, Bang + 1);
+        Name         = Name.substr(Bang + 1);
+    }
+
+    if (*IsPointer || Name.size() < 2 || (Name[0] != 'P' && Name[0] != 'p'))
+    {
+        return FALSE;
+    }
 
-} STUPID_STRUCT2, *PSTUPID_STRUCT2;
+    *IsPointer = TRUE;
+
+    if (TypeLayoutQueryType((ModulePrefix + "_" + Name.substr(1)).c_str(), Database, Type, ModuleName) ||
+        TypeLayoutQueryType((ModulePrefix + Name.substr(1)).c_str(), Database, Type, ModuleName))
+    {
+        return TRUE;
+    }
+
+    *IsPointer = FALSE;
+
+    return FALSE;
+}
 
 /**
  * @brief This function returns the needed details for making support
  * for the casting in the script engine
+ * @details The details are resolved from the precompiled type-layout
+ * database of the module
  *
  * @param StructName Top-level name of struct to perform the look up on this
  * struct
@@ -58,7 +109,8 @@ typedef struct _STUPID_STRUCT2
  * @param IsFiledOfStructNamePointerOrNot Shows whether the field specified in
  * FiledOfStructName is a pointer or not
  * @param NewStructOrTypeName Returns the type (structure name) of the
- * FiledOfStructName for future (next '->' or '.' )
+ * FiledOfStructName for future (next '->' or '.' ), the buffer should be at
+ * least MAXIMUM_TYPE_NAME_LENGTH bytes
  * @param OffsetOfFieldFromTop The start position of this field from the top of
  * structure
  * @param SizeOfField The exact size of the target field
@@ -77,157 +129,46 @@ SymCastingQueryForFiledsAndTypes(const char * StructName,
                                  UINT32 *     OffsetOfFieldFromTop,
                                  UINT32 *     SizeOfField)
 {
-    BOOLEAN IsPointer                 = FALSE;
-    BOOLEAN IsTheStructItselfAPointer = FALSE;
-    UINT32  TempOffsetOfFieldFromTop  = 0;
-    UINT32  TempSizeOfField           = 0;
+    PTYPE_LAYOUT_DATABASE    Database                  = NULL;
+    PTYPE_LAYOUT_TYPE_ENTRY  Type                      = NULL;
+    PTYPE_LAYOUT_FIELD_ENTRY Field                     = NULL;
+    const char *             ModuleName                = NULL;
+    BOOLEAN                  IsTheStructItselfAPointer = FALSE;
 
-    if (strcmp(StructName, "STUPID_STRUCT1") == 0 ||
-        strcmp(StructName, "PSTUPID_STRUCT1") == 0)
+    if (!SymCastingFindStructure(StructName, &Database, &Type, &ModuleName, &IsTheStructItselfAPointer))
     {
-        if (strcmp(StructName, "PSTUPID_STRUCT1") == 0)
-        {
-            IsTheStructItselfAPointer = TRUE;
-        }
-
-        if (strcmp(FiledOfStructName, "Flag32") == 0)
-        {
-            IsPointer                = FALSE;
-            TempOffsetOfFieldFromTop = 0x0;
-            TempSizeOfField          = 0x4;
-            strcpy(*NewStructOrTypeName, "UINT32");
-        }
-        else if (strcmp(FiledOfStructName, "Flag64") == 0)
-        {
-            IsPointer                = FALSE;
-            TempOffsetOfFieldFromTop = 0x4;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "UINT64");
-        }
-        else if (strcmp(FiledOfStructName, "Context") == 0)
-        {
-            IsPointer                = TRUE;
-            TempOffsetOfFieldFromTop = 0xc;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "PVOID");
-        }
-        else if (strcmp(FiledOfStructName, "StringValue") == 0)
-        {
-            IsPointer                = TRUE;
-            TempOffsetOfFieldFromTop = 0x14;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "PUNICODE_STRING");
-        }
-        else
-        {
-            //
-            // Unknown Field
-            //
-            return FALSE;
-        }
+        //
+        // Unknown Structure
+        //
+        return FALSE;
     }
-    else if (strcmp(StructName, "STUPID_STRUCT2") == 0 ||
-             strcmp(StructName, "PSTUPID_STRUCT2") == 0)
-    {
-        if (strcmp(StructName, "PSTUPID_STRUCT2") == 0)
-        {
-            IsTheStructItselfAPointer = TRUE;
-        }
 
-        if (strcmp(FiledOfStructName, "Sina32") == 0)
-        {
-            IsPointer                = FALSE;
-            TempOffsetOfFieldFromTop = 0x0;
-            TempSizeOfField          = 0x4;
-            strcpy(*NewStructOrTypeName, "UINT32");
-        }
-        else if (strcmp(FiledOfStructName, "Sina64") == 0)
-        {
-            IsPointer                = FALSE;
-            TempOffsetOfFieldFromTop = 0x4;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "UINT64");
-        }
-        else if (strcmp(FiledOfStructName, "AghaaSina") == 0)
-        {
-            IsPointer                = TRUE;
-            TempOffsetOfFieldFromTop = 0xc;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "PVOID");
-        }
-        else if (strcmp(FiledOfStructName, "UnicodeStr") == 0)
-        {
-            IsPointer                = TRUE;
-            TempOffsetOfFieldFromTop = 0x14;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "PUNICODE_STRING");
-        }
-        else if (strcmp(FiledOfStructName, "StupidStruct1") == 0)
-        {
-            IsPointer                = TRUE;
-            TempOffsetOfFieldFromTop = 0x1c;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "PSTUPID_STRUCT1");
-        }
-        else
-        {
-            //
-            // Unknown Field
-            //
-            return FALSE;
-        }
-    }
-    else if (strcmp(StructName, "UNICODE_STRING") == 0 ||
-             strcmp(StructName, "PUNICODE_STRING") == 0)
-    {
-        if (strcmp(StructName, "PUNICODE_STRING") == 0)
-        {
-            IsTheStructItselfAPointer = TRUE;
-        }
+    Field = TypeLayoutLookupField(Database, Type, FiledOfStructName);
 
-        if (strcmp(FiledOfStructName, "Length") == 0)
-        {
-            IsPointer                = FALSE;
-            TempOffsetOfFieldFromTop = 0x0;
-            TempSizeOfField          = 0x2;
-            strcpy(*NewStructOrTypeName, "USHORT");
-        }
-        else if (strcmp(FiledOfStructName, "MaximumLength") == 0)
-        {
-            IsPointer                = FALSE;
-            TempOffsetOfFieldFromTop = 0x2;
-            TempSizeOfField          = 0x2;
-            strcpy(*NewStructOrTypeName, "USHORT");
-        }
-        else if (strcmp(FiledOfStructName, "Buffer") == 0)
-        {
-            IsPointer                = TRUE;
-            TempOffsetOfFieldFromTop = 0x4;
-            TempSizeOfField          = 0x8;
-            strcpy(*NewStructOrTypeName, "PWSTR");
-        }
-        else
-        {
-            //
-            // Unknown Field
-            //
-            return FALSE;
-        }
-    }
-    else
+    if (Field == NULL)
     {
         //
-        // Unknown Structure
+        // Unknown Field
         //
         return FALSE;
     }
 
+    //
+    // The type is prefixed with the module name so the next lookups
+    // ('->' or '.') are performed on the same module
+    //
+    sprintf_s(*NewStructOrTypeName,
+              MAXIMUM_TYPE_NAME_LENGTH,
+              "%s!%s",
+              ModuleName,
+              &Database->StringPool[Field->TypeNameOffset]);
+
     //
     // Apply the needed information
     //
-    *OffsetOfFieldFromTop            = TempOffsetOfFieldFromTop;
-    *SizeOfField                     = TempSizeOfField;
-    *IsFiledOfStructNamePointerOrNot = IsPointer;
+    *OffsetOfFieldFromTop            = Field->Offset;
+    *SizeOfField                     = Field->Size;
+    *IsFiledOfStructNamePointerOrNot = (Field->Flags & TYPE_LAYOUT_FIELD_FLAG_POINTER) ? TRUE : FALSE;
     *IsStructNamePointerOrNot        = IsTheStructItselfAPointer;
 
     return TRUE;
@@ -247,31 +188,11 @@ SymCastingQueryForFiledsAndTypes(const char * StructName,
 BOOLEAN
 SymQuerySizeof(const char * StructNameOrTypeName, UINT32 * SizeOfField)
 {
-    if (strcmp(StructNameOrTypeName, "STUPID_STRUCT1") == 0)
-    {
-        *SizeOfField = sizeof(STUPID_STRUCT1);
-    }
-    else if (strcmp(StructNameOrTypeName, "STUPID_STRUCT2") == 0)
-    {
-        *SizeOfField = sizeof(STUPID_STRUCT2);
-    }
-    else if (strcmp(StructNameOrTypeName, "UNICODE_STRING") == 0)
-    {
-        *SizeOfField = sizeof(UNICODE_STRING);
-    }
-    else if (strcmp(StructNameOrTypeName, "PSTUPID_STRUCT1") == 0)
-    {
-        *SizeOfField = sizeof(PSTUPID_STRUCT1);
-    }
-    else if (strcmp(StructNameOrTypeName, "PSTUPID_STRUCT2") == 0)
-    {
-        *SizeOfField = sizeof(PSTUPID_STRUCT2);
-    }
-    else if (strcmp(StructNameOrTypeName, "PUNICODE_STRING") == 0)
-    {
-        *SizeOfField = sizeof(PUNICODE_STRING);
-    }
-    else
+    PTYPE_LAYOUT_DATABASE   Database  = NULL;
+    PTYPE_LAYOUT_TYPE_ENTRY Type      = NULL;
+    BOOLEAN                 IsPointer = FALSE;
+
+    if (!SymCastingFindStructure(StructNameOrTypeName, &Database, &Type, NULL, &IsPointer))
     {
         //
         // Unknown Structure
@@ -279,136 +200,7 @@ SymQuerySizeof(const char * StructNameOrTypeName, UINT32 * SizeOfField)
         return FALSE;
     }
 
-    return TRUE;
-}
-
-int
-main()
-{
-    UINT32 SizeofResult = 0;
+    *SizeOfField = IsPointer ? sizeof(PVOID) : Type->Size;
 
-    //
-    // Test sizeof operator
-    //
-
-    if (SymQuerySizeof("PUNICODE_STRING", &SizeofResult))
-    {
-        printf("result of sizeof(PUNICODE_STRING) is : 0x%x\n", SizeofResult);
-    }
-
-    if (SymQuerySizeof("SOME_UNKNOWN_STRUCT", &SizeofResult))
-    {
-        printf("result of sizeof(SOME_UNKNOWN_STRUCT) is : 0x%x\n", SizeofResult);
-    }
-    else
-    {
-        printf("SOME_UNKNOWN_STRUCT is not found\n");
-    }
-
-    printf("\n\n\n");
-
-    //
-    // ********* Test casting *********
-    //
-
-    /*
-
-
-        Local var @ 0x95fa18df58 Type AllocateStructForCasting::__l2::_STUPID_STRUCT2*
-        0x00000260`d065ee30
-
-           +0x000 Sina32           : 0x32
-           +0x008 Sina64           : 0x64
-           +0x010 AghaaSina        : 0x00000000`00000055 Void
-           +0x018 UnicodeStr       : 0x00000260`d065ec70 AllocateStructForCasting::__l2::_UNICODE_STRING
-              +0x000 Length           : 0x40
-              +0x002 MaximumLength    : 0x40
-              +0x008 Buffer           : 0x00000260`d065ecf0  "Goodbye I'm at stupid struct 2!"
-           +0x020 StupidStruct1    : 0x00000260`d065eda0 AllocateStructForCasting::__l2::_STUPID_STRUCT1
-              +0x000 Flag32           : 0x3232
-              +0x008 Flag64           : 0x6464
-              +0x010 Context          : 0x00000000`00000085 Void
-              +0x018 StringValue      : 0x00000260`d065eb50 AllocateStructForCasting::__l2::_UNICODE_STRING
-                 +0x000 Length           : 0x3c
-                 +0x002 MaximumLength    : 0x3c
-                 +0x008 Buffer           : 0x00000260`d065ebd0  "Hi come from stupid struct 1!"
-
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->Sina32;
-        // my_var = 0x32
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->Sina64;
-        // my_var = 0x64
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->AghaaSina;
-        // my_var = 0x55
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx).Unknownnnnnn;
-        // Error because Unknownnnnnn not found
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->Unknownnnnnn;
-        // Error because Unknownnnnnn not found
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx).Sina32;
-        // Error because PSTUPID_STRUCT2 is pointer, should use '->'
-
-        my_var =  cast<PSTUPID_STRUCT2>(*@rcx).Sina32;
-        // Error because PSTUPID_STRUCT2 is pointer, should use '->'
-
-        my_var =  cast<STUPID_STRUCT2>(*@rcx).Sina32;
-        // my_var = 0x32
-
-        my_var =  cast<STUPID_STRUCT2>(*@rcx).Sina64;
-        // my_var = 0x64
-
-        my_var =  cast<STUPID_STRUCT2>(*@rcx).AghaaSina;
-        // my_var = 0x55
-
-        my_var =  cast<STUPID_STRUCT2>(*@rcx).UnicodeStr->MaximumLength;
-        // my_var = 0x40
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->UnicodeStr->MaximumLength;
-        // my_var = 0x40
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->StupidStruct1->Flag32;
-        // my_var = 0x3232
-
-        my_var =  cast<PSTUPID_STRUCT2>(@rcx)->StupidStruct1->Flag64;
-        // my_var = 0x6464
-
-        my_var = cast<STUPID_STRUCT2>(*@rcx).StupidStruct1->StringValue->MaximumLength;
-        // my_var = 0x3c
-
-        printf("Result is : %ws\n", cast<PSTUPID_STRUCT2>(@rcx)->UnicodeStr->Buffer );
-        // Result is : Goodbye I'm at stupid struct 2!"
-
-        printf("Result is : %ws\n", cast<PSTUPID_STRUCT2>(@rcx)->StupidStruct1->StringValue->Buffer );
-        // Result is : Goodbye I'm at stupid struct 2!"
-
-  */
-
-    BOOLEAN IsStructPointerOrNot = FALSE;
-    BOOLEAN IsFieldPointerOrNot  = FALSE;
-    UINT32  OffsetOfFieldFromTop = NULL;
-    UINT32  SizeOfField          = NULL;
-    CHAR *  NewStructOrTypeName  = (CHAR *)malloc(100);
-
-    if (SymCastingQueryForFiledsAndTypes(
-            "STUPID_STRUCT2",
-            "UnicodeStr",
-            &IsStructPointerOrNot,
-            &IsFieldPointerOrNot,
-            &NewStructOrTypeName,
-            &OffsetOfFieldFromTop,
-            &SizeOfField))
-    {
-        printf("is the structure itself pointer or not: %s\n",
-               IsStructPointerOrNot ? "yes" : "no");
-        printf("is the field of structure itself pointer or not: %s\n",
-               IsFieldPointerOrNot ? "yes" : "no");
-        printf("offset of field from top : %x\n", OffsetOfFieldFromTop);
-        printf("size of field : %x\n", SizeOfField);
-    }
-
-    free(NewStructOrTypeName);
+    return TRUE;
 }
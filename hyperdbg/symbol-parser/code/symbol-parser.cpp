@@ -690,6 +690,7 @@ SymUnloadModuleSymbol(char * ModuleName)
 
             OneModuleFound = TRUE;
 
+            TypeLayoutFreeDatabase((PTYPE_LAYOUT_DATABASE)item->TypeLayoutDatabase);
             free(item);
 
             break;
@@ -754,6 +755,7 @@ SymUnloadAllSymbols()
             //              GetLastError());
         }
 
+        TypeLayoutFreeDatabase((PTYPE_LAYOUT_DATABASE)item->TypeLayoutDatabase);
         free(item);
     }
 
@@ -945,6 +947,9 @@ SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffset)
     UINT32                        Index      = 0;
     PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
     BOOLEAN                       Result     = FALSE;
+    PTYPE_LAYOUT_DATABASE         Database   = NULL;
+    PTYPE_LAYOUT_TYPE_ENTRY       Type       = NULL;
+    PTYPE_LAYOUT_FIELD_ENTRY      Field      = NULL;
 
     //
     // Find module info
@@ -977,6 +982,32 @@ SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffset)
         Index++;
     }
 
+    //
+    // Check the precompiled type-layout database first as it avoids
+    // querying DbgHelp for each of the fields
+    //
+    Database = TypeLayoutGetModuleDatabase(SymbolInfo);
+
+    if (Database != NULL && (Type = TypeLayoutLookupType(Database, TypeName)) != NULL)
+    {
+        Field = TypeLayoutLookupField(Database, Type, FieldName);
+
+        if (Field == NULL)
+        {
+            return FALSE;
+        }
+
+        //
+        // Same as querying DbgHelp (below), only the one-bit fields are
+        // reported by their bit position, other fields (including the wider
+        // bit-fields) are reported by their offset
+        //
+        *FieldOffset = ((Field->Flags & TYPE_LAYOUT_FIELD_FLAG_BITFIELD) && Field->BitLength == 1) ? Field->BitPosition
+                                                                                                   : Field->Offset;
+
+        return TRUE;
+    }
+
     //
     // Convert TypeName to wide-char, it's because SymGetTypeInfo supports
     // wide-char
@@ -1034,6 +1065,8 @@ SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
     UINT32                        Index      = 0;
     PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
     BOOLEAN                       Result     = FALSE;
+    PTYPE_LAYOUT_DATABASE         Database   = NULL;
+    PTYPE_LAYOUT_TYPE_ENTRY       Type       = NULL;
 
     //
     // Find module info
@@ -1066,6 +1099,17 @@ SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
         Index++;
     }
 
+    //
+    // Check the precompiled type-layout database first
+    //
+    Database = TypeLayoutGetModuleDatabase(SymbolInfo);
+
+    if (Database != NULL && (Type = TypeLayoutLookupType(Database, TypeName)) != NULL)
+    {
+        *TypeSize = Type->Size;
+        return TRUE;
+    }
+
     //
     // Convert FieldName to wide-char, it's because SymGetTypeInfo supports
     // wide-char
@@ -0,0 +1,690 @@
+/**
+ * @file type-layout.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Precompiled type-layout database (structures, fields, offsets)
+ * @details The layout of the structures of a module is extracted from
+ * the PDB type information once and is stored into a compact binary
+ * image (cached alongside of the PDB file). After that, queries for the
+ * fields of structures are answered by hashed lookups instead of calling
+ * DbgHelp for each of the fields. The image itself is built and queried by
+ * the type-layout component, this file extracts the layouts from DbgHelp
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Basic types of DbgHelp (cvconst.h is not included)
+//
+#define TYPE_LAYOUT_BT_VOID    1
+#define TYPE_LAYOUT_BT_CHAR    2
+#define TYPE_LAYOUT_BT_WCHAR   3
+#define TYPE_LAYOUT_BT_INT     6
+#define TYPE_LAYOUT_BT_UINT    7
+#define TYPE_LAYOUT_BT_FLOAT   8
+#define TYPE_LAYOUT_BT_BOOL    10
+#define TYPE_LAYOUT_BT_LONG    13
+#define TYPE_LAYOUT_BT_ULONG   14
+#define TYPE_LAYOUT_BT_HRESULT 31
+
+/**
+ * @brief Maximum depth of resolving the name of nested types
+ *
+ */
+#define TYPE_LAYOUT_MAXIMUM_TYPE_NAME_DEPTH 8
+
+/**
+ * @brief A field of a structure before being serialized
+ *
+ */
+typedef struct _TYPE_LAYOUT_STAGING_FIELD
+{
+    std::string Name;
+    std::string TypeName;
+    UINT32      Offset;
+    UINT32      Size;
+    UINT16      BitPosition;
+    UINT8       BitLength;
+    UINT8       Flags;
+
+} TYPE_LAYOUT_STAGING_FIELD, *PTYPE_LAYOUT_STAGING_FIELD;
+
+/**
+ * @brief A structure before being serialized
+ *
+ */
+typedef struct _TYPE_LAYOUT_STAGING_TYPE
+{
+    std::string                            Name;
+    UINT32                                 Size;
+    std::vector<TYPE_LAYOUT_STAGING_FIELD> Fields;
+
+} TYPE_LAYOUT_STAGING_TYPE, *PTYPE_LAYOUT_STAGING_TYPE;
+
+/**
+ * @brief Context of enumerating types of a module
+ *
+ */
+typedef struct _TYPE_LAYOUT_ENUMERATION_CONTEXT
+{
+    UINT64                                  ModuleBase;
+    std::vector<TYPE_LAYOUT_STAGING_TYPE> * Types;
+
+} TYPE_LAYOUT_ENUMERATION_CONTEXT, *PTYPE_LAYOUT_ENUMERATION_CONTEXT;
+
+/**
+ * @brief Convert a wide-char name (allocated by DbgHelp) to a string and
+ * free the DbgHelp buffer
+ *
+ * @param WideName
+ * @param Name
+ *
+ * @return VOID
+ */
+VOID
+TypeLayoutConvertAndFreeWideName(WCHAR * WideName, std::string & Name)
+{
+    CHAR TempName[MAXIMUM_TYPE_NAME_LENGTH] = {0};
+
+    if (WideName == NULL)
+    {
+        Name.clear();
+        return;
+    }
+
+    wcstombs(TempName, WideName, MAXIMUM_TYPE_NAME_LENGTH - 1);
+    Name = TempName;
+
+    LocalFree(WideName);
+}
+
+/**
+ * @brief Get the name of a basic type based on its size
+ *
+ * @param BaseType
+ * @param Length
+ *
+ * @return const char *
+ */
+const char *
+TypeLayoutGetBaseTypeName(DWORD BaseType, UINT64 Length)
+{
+    switch (BaseType)
+    {
+    case TYPE_LAYOUT_BT_VOID:
+        return "VOID";
+    case TYPE_LAYOUT_BT_CHAR:
+        return "CHAR";
+    case TYPE_LAYOUT_BT_WCHAR:
+        return "WCHAR";
+    case TYPE_LAYOUT_BT_BOOL:
+        return "BOOLEAN";
+    case TYPE_LAYOUT_BT_FLOAT:
+        return Length == 4 ? "FLOAT" : "DOUBLE";
+    case TYPE_LAYOUT_BT_INT:
+    case TYPE_LAYOUT_BT_LONG:
+    case TYPE_LAYOUT_BT_HRESULT:
+        if (Length == 1)
+        {
+            return "INT8";
+        }
+        else if (Length == 2)
+        {
+            return "INT16";
+        }
+        else if (Length == 4)
+        {
+            return "INT32";
+        }
+        else
+        {
+            return "INT64";
+        }
+    default:
+        if (Length == 1)
+        {
+            return "UINT8";
+        }
+        else if (Length == 2)
+        {
+            return "UINT16";
+        }
+        else if (Length == 4)
+        {
+            return "UINT32";
+        }
+        else
+        {
+            return "UINT64";
+        }
+    }
+}
+
+/**
+ * @brief Resolve the name of a type (pointers are shown with the '*' suffix)
+ *
+ * @param ModuleBase
+ * @param TypeId
+ * @param Depth
+ * @param Name
+ * @param Flags
+ *
+ * @return VOID
+ */
+VOID
+TypeLayoutResolveTypeName(UINT64 ModuleBase, ULONG TypeId, UINT32 Depth, std::string & Name, UINT8 * Flags)
+{
+    DWORD   Tag       = 0;
+    DWORD   BaseType  = 0;
+    ULONG   SubTypeId = 0;
+    UINT64  Length    = 0;
+    WCHAR * WideName  = NULL;
+
+    if (Depth >= TYPE_LAYOUT_MAXIMUM_TYPE_NAME_DEPTH ||
+        !SymGetTypeInfo(GetCurrentProcess(), ModuleBase, TypeId, TI_GET_SYMTAG, &Tag))
+    {
+        Name = "VOID";
+        return;
+    }
+
+    switch (Tag)
+    {
+    case SymTagPointerType:
+
+        SymGetTypeInfo(GetCurrentProcess(), ModuleBase, TypeId, TI_GET_TYPEID, &SubTypeId);
+        TypeLayoutResolveTypeName(ModuleBase, SubTypeId, Depth + 1, Name, NULL);
+        Name += "*";
+
+        if (Flags != NULL)
+        {
+            *Flags |= TYPE_LAYOUT_FIELD_FLAG_POINTER;
+        }
+
+        break;
+
+    case SymTagArrayType:
+
+        SymGetTypeInfo(GetCurrentProcess(), ModuleBase, TypeId, TI_GET_TYPEID, &SubTypeId);
+        TypeLayoutResolveTypeName(ModuleBase, SubTypeId, Depth + 1, Name, NULL);
+        Name += "[]";
+
+        if (Flags != NULL)
+        {
+            *Flags |= TYPE_LAYOUT_FIELD_FLAG_ARRAY;
+        }
+
+        break;
+
+    case SymTagBaseType:
+
+        SymGetTypeInfo(GetCurrentProcess(), ModuleBase, TypeId, TI_GET_BASETYPE, &BaseType);
+        SymGetTypeInfo(GetCurrentProcess(), ModuleBase, TypeId, TI_GET_LENGTH, &Length);
+        Name = TypeLayoutGetBaseTypeName(BaseType, Length);
+
+        break;
+
+    case SymTagFunctionType:
+
+        Name = "FUNCTION";
+
+        break;
+
+    default:
+
+        //
+        // UDTs, enums and typedefs have names
+        //
+        SymGetTypeInfo(GetCurrentProcess(), ModuleBase, TypeId, TI_GET_SYMNAME, &WideName);
+        TypeLayoutConvertAndFreeWideName(WideName, Name);
+
+        if (Name.empty())
+        {
+            Name = "VOID";
+        }
+
+        break;
+    }
+}
+
+/**
+ * @brief Callback of enumerating the types of the module
+ *
+ * @param SymInfo
+ * @param SymbolSize
+ * @param UserContext
+ *
+ * @return BOOL
+ */
+BOOL CALLBACK
+TypeLayoutEnumTypesCallback(PSYMBOL_INFO SymInfo, ULONG SymbolSize, PVOID UserContext)
+{
+    PTYPE_LAYOUT_ENUMERATION_CONTEXT Context       = (PTYPE_LAYOUT_ENUMERATION_CONTEXT)UserContext;
+    HANDLE                           Process       = GetCurrentProcess();
+    DWORD                            ChildrenCount = 0;
+    TYPE_LAYOUT_STAGING_TYPE         StagingType;
+
+    UNREFERENCED_PARAMETER(SymbolSize);
+
+    //
+    // We only need structures, classes and unions
+    //
+    if (SymInfo->Tag != SymTagUDT || SymInfo->NameLen == 0)
+    {
+        return TRUE;
+    }
+
+    if (!SymGetTypeInfo(Process, Context->ModuleBase, SymInfo->TypeIndex, TI_GET_CHILDRENCOUNT, &ChildrenCount) ||
+        ChildrenCount == 0)
+    {
+        //
+        // Forward declarations do not have children
+        //
+        return TRUE;
+    }
+
+    auto FindChildrenParamsBacking = std::make_unique<uint8_t[]>(
+        sizeof(_TI_FINDCHILDREN_PARAMS) + ((ChildrenCount - 1) * sizeof(ULONG)));
+    auto FindChildrenParams = (_TI_FINDCHILDREN_PARAMS *)FindChildrenParamsBacking.get();
+
+    FindChildrenParams->Count = ChildrenCount;
+
+    if (!SymGetTypeInfo(Process, Context->ModuleBase, SymInfo->TypeIndex, TI_FINDCHILDREN, FindChildrenParams))
+    {
+        return TRUE;
+    }
+
+    StagingType.Name = SymInfo->Name;
+    StagingType.Size = SymInfo->Size;
+
+    for (DWORD ChildIdx = 0; ChildIdx < ChildrenCount; ChildIdx++)
+    {
+        TYPE_LAYOUT_STAGING_FIELD Field       = {};
+        const ULONG               ChildId     = FindChildrenParams->ChildId[ChildIdx];
+        DWORD                     Tag         = 0;
+        DWORD                     Offset      = 0;
+        DWORD                     BitPosition = 0;
+        ULONG                     TypeId      = 0;
+        UINT64                    Length      = 0;
+        WCHAR *                   WideName    = NULL;
+
+        //
+        // Only data members (base classes, functions, etc. are ignored), the
+        // static members do not have an offset so they're ignored too
+        //
+        if (!SymGetTypeInfo(Process, Context->ModuleBase, ChildId, TI_GET_SYMTAG, &Tag) || Tag != SymTagData ||
+            !SymGetTypeInfo(Process, Context->ModuleBase, ChildId, TI_GET_OFFSET, &Offset))
+        {
+            continue;
+        }
+
+        SymGetTypeInfo(Process, Context->ModuleBase, ChildId, TI_GET_SYMNAME, &WideName);
+        TypeLayoutConvertAndFreeWideName(WideName, Field.Name);
+
+        if (Field.Name.empty())
+        {
+            continue;
+        }
+
+        SymGetTypeInfo(Process, Context->ModuleBase, ChildId, TI_GET_TYPEID, &TypeId);
+        SymGetTypeInfo(Process, Context->ModuleBase, TypeId, TI_GET_LENGTH, &Length);
+
+        Field.Offset = Offset;
+        Field.Size   = (UINT32)Length;
+
+        //
+        // Bit-fields have a bit position, and their length is the number of bits
+        //
+        if (SymGetTypeInfo(Process, Context->ModuleBase, ChildId, TI_GET_BITPOSITION, &BitPosition))
+        {
+            SymGetTypeInfo(Process, Context->ModuleBase, ChildId, TI_GET_LENGTH, &Length);
+
+            Field.BitPosition = (UINT16)BitPosition;
+            Field.BitLength   = (UINT8)Length;
+            Field.Flags |= TYPE_LAYOUT_FIELD_FLAG_BITFIELD;
+        }
+
+        TypeLayoutResolveTypeName(Context->ModuleBase, TypeId, 0, Field.TypeName, &Field.Flags);
+
+        StagingType.Fields.push_back(Field);
+    }
+
+    if (!StagingType.Fields.empty())
+    {
+        Context->Types->push_back(std::move(StagingType));
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Serialize the staged types into a type-layout database
+ *
+ * @param StagingTypes
+ * @param PdbFileSize
+ * @param PdbLastWriteTime
+ *
+ * @return PTYPE_LAYOUT_DATABASE
+ */
+PTYPE_LAYOUT_DATABASE
+TypeLayoutSerialize(std::vector<TYPE_LAYOUT_STAGING_TYPE> & StagingTypes,
+                    UINT64                                  PdbFileSize,
+                    UINT64                                  PdbLastWriteTime)
+{
+    std::vector<TYPE_LAYOUT_BUILD_TYPE>  Types;
+    std::vector<TYPE_LAYOUT_BUILD_FIELD> Fields;
+    size_t                               NumberOfFields = 0;
+    size_t                               FieldIndex     = 0;
+
+    if (StagingTypes.size() > MAXUINT32)
+    {
+        return NULL;
+    }
+
+    for (auto & StagingType : StagingTypes)
+    {
+        NumberOfFields += StagingType.Fields.size();
+    }
+
+    //
+    // The records only point to the staged strings, the database copies
+    // them into its own pool
+    //
+    Types.reserve(StagingTypes.size());
+    Fields.reserve(NumberOfFields);
+
+    for (auto & StagingType : StagingTypes)
+    {
+        TYPE_LAYOUT_BUILD_TYPE Type = {0};
+
+        for (auto & StagingField : StagingType.Fields)
+        {
+            TYPE_LAYOUT_BUILD_FIELD Field = {0};
+
+            Field.Name        = StagingField.Name.c_str();
+            Field.TypeName    = StagingField.TypeName.c_str();
+            Field.Offset      = StagingField.Offset;
+            Field.Size        = StagingField.Size;
+            Field.BitPosition = StagingField.BitPosition;
+            Field.BitLength   = StagingField.BitLength;
+            Field.Flags       = StagingField.Flags;
+
+            Fields.push_back(Field);
+        }
+
+        Type.Name           = StagingType.Name.c_str();
+        Type.Size           = StagingType.Size;
+        Type.Fields         = Fields.data() + FieldIndex;
+        Type.NumberOfFields = (UINT32)StagingType.Fields.size();
+
+        Types.push_back(Type);
+
+        FieldIndex += StagingType.Fields.size();
+    }
+
+    return TypeLayoutBuildDatabase(Types.data(), (UINT32)Types.size(), PdbFileSize, PdbLastWriteTime);
+}
+
+/**
+ * @brief Get the size and the last write time of the PDB file
+ *
+ * @param PdbFilePath
+ * @param PdbFileSize
+ * @param PdbLastWriteTime
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TypeLayoutGetPdbFileStamp(const char * PdbFilePath, UINT64 * PdbFileSize, UINT64 * PdbLastWriteTime)
+{
+    WIN32_FILE_ATTRIBUTE_DATA Attributes = {0};
+
+    if (!GetFileAttributesExA(PdbFilePath, GetFileExInfoStandard, &Attributes))
+    {
+        return FALSE;
+    }
+
+    *PdbFileSize      = ((UINT64)Attributes.nFileSizeHigh << 32) | Attributes.nFileSizeLow;
+    *PdbLastWriteTime = ((UINT64)Attributes.ftLastWriteTime.dwHighDateTime << 32) |
+                        Attributes.ftLastWriteTime.dwLowDateTime;
+
+    return TRUE;
+}
+
+/**
+ * @brief Load the cached type-layout database from the disk
+ *
+ * @param CacheFilePath
+ * @param PdbFileSize
+ * @param PdbLastWriteTime
+ *
+ * @return PTYPE_LAYOUT_DATABASE NULL if the cache is not available or it's stale
+ */
+PTYPE_LAYOUT_DATABASE
+TypeLayoutLoadFromFile(const char * CacheFilePath, UINT64 PdbFileSize, UINT64 PdbLastWriteTime)
+{
+    FILE *                File     = NULL;
+    BYTE *                Image    = NULL;
+    long                  FileSize = 0;
+    PTYPE_LAYOUT_DATABASE Database = NULL;
+
+    File = fopen(CacheFilePath, "rb");
+
+    if (File == NULL)
+    {
+        return NULL;
+    }
+
+    if (fseek(File, 0, SEEK_END) != 0 || (FileSize = ftell(File)) <= 0 || fseek(File, 0, SEEK_SET) != 0)
+    {
+        fclose(File);
+        return NULL;
+    }
+
+    Image = (BYTE *)malloc(FileSize);
+
+    if (Image == NULL)
+    {
+        fclose(File);
+        return NULL;
+    }
+
+    if (fread(Image, 1, FileSize, File) != (size_t)FileSize)
+    {
+        free(Image);
+        fclose(File);
+        return NULL;
+    }
+
+    fclose(File);
+
+    Database = TypeLayoutMapImage(Image, (UINT32)FileSize);
+
+    if (Database == NULL)
+    {
+        free(Image);
+        return NULL;
+    }
+
+    //
+    // The PDB file is changed after creating the cache
+    //
+    if (Database->Header->PdbFileSize != PdbFileSize || Database->Header->PdbLastWriteTime != PdbLastWriteTime)
+    {
+        TypeLayoutFreeDatabase(Database);
+        return NULL;
+    }
+
+    return Database;
+}
+
+/**
+ * @brief Save the type-layout database into the disk
+ *
+ * @param Database
+ * @param CacheFilePath
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TypeLayoutSaveToFile(PTYPE_LAYOUT_DATABASE Database, const char * CacheFilePath)
+{
+    FILE *  File   = NULL;
+    BOOLEAN Result = FALSE;
+
+    File = fopen(CacheFilePath, "wb");
+
+    if (File == NULL)
+    {
+        return FALSE;
+    }
+
+    Result = fwrite(Database->Image, 1, Database->ImageSize, File) == Database->ImageSize;
+
+    fclose(File);
+
+    if (!Result)
+    {
+        //
+        // Do not leave a partially written cache
+        //
+        remove(CacheFilePath);
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Get (load or build) the type-layout database of a module
+ * @details The database is built from the PDB once, and it's cached
+ * alongside of the PDB file for the next sessions
+ *
+ * @param ModuleDetails
+ *
+ * @return PTYPE_LAYOUT_DATABASE NULL if it's not possible to build the database
+ */
+PTYPE_LAYOUT_DATABASE
+TypeLayoutGetModuleDatabase(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    UINT64                                PdbFileSize      = 0;
+    UINT64                                PdbLastWriteTime = 0;
+    PTYPE_LAYOUT_DATABASE                 Database         = NULL;
+    TYPE_LAYOUT_ENUMERATION_CONTEXT       Context          = {0};
+    std::vector<TYPE_LAYOUT_STAGING_TYPE> StagingTypes;
+    std::string                           CacheFilePath;
+
+    if (ModuleDetails->TypeLayoutDatabase != NULL)
+    {
+        return (PTYPE_LAYOUT_DATABASE)ModuleDetails->TypeLayoutDatabase;
+    }
+
+    if (!TypeLayoutGetPdbFileStamp(ModuleDetails->PdbFilePath, &PdbFileSize, &PdbLastWriteTime))
+    {
+        return NULL;
+    }
+
+    CacheFilePath = std::string(ModuleDetails->PdbFilePath) + TYPE_LAYOUT_DATABASE_FILE_EXTENSION;
+
+    //
+    // Check whether we previously cached the database or not
+    //
+    Database = TypeLayoutLoadFromFile(CacheFilePath.c_str(), PdbFileSize, PdbLastWriteTime);
+
+    if (Database == NULL)
+    {
+        //
+        // Extract the layouts from the PDB type information
+        //
+        Context.ModuleBase = ModuleDetails->ModuleBase;
+        Context.Types      = &StagingTypes;
+
+        if (!SymEnumTypes(GetCurrentProcess(), ModuleDetails->ModuleBase, TypeLayoutEnumTypesCallback, &Context))
+        {
+            return NULL;
+        }
+
+        Database = TypeLayoutSerialize(StagingTypes, PdbFileSize, PdbLastWriteTime);
+
+        if (Database == NULL)
+        {
+            return NULL;
+        }
+
+        //
+        // It's not a problem if we couldn't save the cache (e.g., the symbol
+        // directory is read-only), it will be built again next time
+        //
+        TypeLayoutSaveToFile(Database, CacheFilePath.c_str());
+    }
+
+    ModuleDetails->TypeLayoutDatabase = Database;
+
+    return Database;
+}
+
+/**
+ * @brief Find a structure (the name might contain the module name
+ * e.g., nt!_EPROCESS) in the loaded modules
+ *
+ * @param TypeName
+ * @param Database
+ * @param Type
+ * @param ModuleName The name of the module that is used for the nested types
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TypeLayoutQueryType(const char *              TypeName,
+                    PTYPE_LAYOUT_DATABASE *   Database,
+                    PTYPE_LAYOUT_TYPE_ENTRY * Type,
+                    const char **             ModuleName)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails = NULL;
+    PTYPE_LAYOUT_DATABASE         TempDatabase  = NULL;
+    PTYPE_LAYOUT_TYPE_ENTRY       TempType      = NULL;
+    const char *                  Bang          = NULL;
+
+    ModuleDetails = SymGetModuleBaseFromSearchMask(TypeName, FALSE);
+
+    if (ModuleDetails == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Remove the module name
+    //
+    Bang = strchr(TypeName, '!');
+
+    if (Bang != NULL)
+    {
+        TypeName = Bang + 1;
+    }
+
+    TempDatabase = TypeLayoutGetModuleDatabase(ModuleDetails);
+
+    if (TempDatabase == NULL)
+    {
+        return FALSE;
+    }
+
+    TempType = TypeLayoutLookupType(TempDatabase, TypeName);
+
+    if (TempType == NULL)
+    {
+        return FALSE;
+    }
+
+    *Database = TempDatabase;
+    *Type     = TempType;
+
+    if (ModuleName != NULL)
+    {
+        *ModuleName = ModuleDetails->ModuleAlternativeName[0] != '\0' ? ModuleDetails->ModuleAlternativeName
+                                                                      : ModuleDetails->ModuleName;
+    }
+
+    return TRUE;
+}
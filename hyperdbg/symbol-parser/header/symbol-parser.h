@@ -32,6 +32,7 @@ typedef struct _SYMBOL_LOADED_MODULE_DETAILS
     char   ModuleName[_MAX_FNAME];
     char   ModuleAlternativeName[_MAX_FNAME];
     char   PdbFilePath[MAX_PATH];
+    PVOID  TypeLayoutDatabase;
 
 } SYMBOL_LOADED_MODULE_DETAILS, *PSYMBOL_LOADED_MODULE_DETAILS;
 
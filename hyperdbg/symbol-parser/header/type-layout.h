@@ -0,0 +1,36 @@
+/**
+ * @file type-layout.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the precompiled type-layout database
+ * @details
+ * @version 0.17
+ * @date 2026-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Constants                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Extension of the cached type-layout database (stored
+ * alongside of the PDB file)
+ *
+ */
+#define TYPE_LAYOUT_DATABASE_FILE_EXTENSION ".tld"
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+PTYPE_LAYOUT_DATABASE
+TypeLayoutGetModuleDatabase(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+BOOLEAN
+TypeLayoutQueryType(const char *              TypeName,
+                    PTYPE_LAYOUT_DATABASE *   Database,
+                    PTYPE_LAYOUT_TYPE_ENTRY * Type,
+                    const char **             ModuleName);
@@ -51,6 +51,8 @@ typedef RFLAGS * PRFLAGS;
 #include "SDK/imports/user/HyperDbgLibImports.h"
 #include "../symbol-parser/header/common-utils.h"
 #include "../symbol-parser/header/symbol-parser.h"
+#include "components/type-layout/header/TypeLayout.h"
+#include "../symbol-parser/header/type-layout.h"
 
 //
 // Module imports/exports